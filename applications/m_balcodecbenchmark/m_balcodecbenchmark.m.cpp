@@ -0,0 +1,958 @@
+// m_balcodecbenchmark.m.cpp                                          -*-C++-*-
+
+//@PURPOSE: Measure the throughput and allocations of the 'bal' codecs.
+//
+//@DESCRIPTION: This application measures, for each of a set of messages
+// built from the types in 's_baltst', the time taken and the memory
+// allocations made to encode and to decode the message with each of the
+// 'bdlat'-based codecs:
+//..
+//  codec   encoder                   decoder
+//  -----   -----------------------   --------------------------------------
+//  ber     'balber::BerEncoder'      'balber::BerDecoder'
+//  json    'baljsn::Encoder'         'baljsn::Decoder'
+//  xml     'balxml::Encoder'         'balxml::Decoder' ('balxml::MiniReader')
+//..
+// and, for comparison with a schema-less representation, to encode and decode
+// the JSON form of the message to and from a 'bdld::Datum' with
+// 'baljsn::DatumUtil' (codec 'datum').
+//
+// The messages are:
+//..
+//  message    type                     shape
+//  --------   ----------------------   --------------------------------------
+//  employee   'Employee'               small nested sequence of strings
+//  basic      'TimingRequest'          choice holding one 'BasicRecord'
+//  big        'TimingRequest'          choice holding a 'BigRecord' with an
+//                                      array of 'size' 'BasicRecord's
+//  strings    'MySequenceWithArray'    array of 'size' strings
+//  choices    'FeatureTestMessage'     array of 'size' nested choices
+//..
+// Each operation is first run once, and the decoded value is compared with
+// the original (or, for 'datum', with the 'Datum' decoded from the JSON form);
+// the result of the comparison is reported in the 'verified' column.  Then
+// the operation is run in batches, doubling the size of each batch until a
+// batch takes at least the specified minimum time, and the time and
+// allocations of the last batch are reported per message.  An encoder or
+// decoder, and (when decoding) the value, is created for each message, as is
+// typical of services handling a stream of messages; the encoded form is
+// written to (and read from) a contiguous buffer.
+//
+// Every allocation, from the allocator supplied to the codec and from the
+// default allocator, is counted.
+//
+// The usage of the application is:
+//..
+//  m_balcodecbenchmark [-t|time <seconds>] [-n|size <count>]
+//                      [-m|message <name>] [-c|codec <name>]
+//                      [-f|format csv|json]
+//..
+// where:
+//..
+//  -t|time      minimum duration, in seconds, of the measured batch of each
+//               operation; the default is 0.5
+//  -n|size      number of elements of the arrays in the 'big', 'strings',
+//               and 'choices' messages; the default is 100
+//  -m|message   measure only the specified message; by default, all messages
+//               are measured
+//  -c|codec     measure only the specified codec; by default, all codecs are
+//               measured
+//  -f|format    output format: 'csv' (the default) prints a header line and
+//               one line per measurement; 'json' prints an array of objects
+//..
+// Each measurement has the following fields:
+//..
+//  field                 description
+//  -------------------   ---------------------------------------------------
+//  message               name of the message
+//  codec                 name of the codec
+//  operation             'encode' or 'decode'
+//  bytes                 size of the encoded message
+//  iterations            number of messages in the measured batch
+//  nsPerMessage          nanoseconds per message
+//  messagesPerSecond     messages per second
+//  megabytesPerSecond    encoded megabytes (10^6 bytes) per second
+//  allocationsPerMessage number of allocations per message
+//  bytesPerMessage       number of bytes allocated per message
+//  verified              whether the message survived a round trip
+//..
+// The application returns 0 on success, 1 if the command line is invalid, and
+// 2 if any operation failed.
+
+#include <s_baltst_address.h>
+#include <s_baltst_basicrecord.h>
+#include <s_baltst_bigrecord.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_featuretestmessage.h>
+#include <s_baltst_mysequencewitharray.h>
+#include <s_baltst_ratsnest.h>
+#include <s_baltst_timingrequest.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berencoder.h>
+
+#include <balcl_commandline.h>
+#include <balcl_occurrenceinfo.h>
+#include <balcl_optioninfo.h>
+#include <balcl_typeinfo.h>
+
+#include <baljsn_datumutil.h>
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+
+#include <balxml_decoder.h>
+#include <balxml_decoderoptions.h>
+#include <balxml_encoder.h>
+#include <balxml_encoderoptions.h>
+#include <balxml_minireader.h>
+
+#include <bdld_manageddatum.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_time.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+                          // =======================
+                          // class CountingAllocator
+                          // =======================
+
+class CountingAllocator : public bslma::Allocator {
+    // This class provides an allocator that counts the allocations, and the
+    // bytes allocated, since it was last reset, and obtains memory from the
+    // new-delete allocator.
+
+    // DATA
+    bsls::Types::Int64 d_numAllocations;     // allocations since reset
+    bsls::Types::Int64 d_numBytesAllocated;  // bytes allocated since reset
+
+  public:
+    // CREATORS
+    CountingAllocator()
+    : d_numAllocations(0)
+    , d_numBytesAllocated(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        ++d_numAllocations;
+        d_numBytesAllocated += size;
+        return bslma::NewDeleteAllocator::singleton().allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        bslma::NewDeleteAllocator::singleton().deallocate(address);
+    }
+
+    void reset()
+        // Reset the counts of this allocator to 0.
+    {
+        d_numAllocations    = 0;
+        d_numBytesAllocated = 0;
+    }
+
+    // ACCESSORS
+    bsls::Types::Int64 numAllocations() const
+        // Return the number of allocations since the last reset.
+    {
+        return d_numAllocations;
+    }
+
+    bsls::Types::Int64 numBytesAllocated() const
+        // Return the number of bytes allocated since the last reset.
+    {
+        return d_numBytesAllocated;
+    }
+};
+
+                            // ==================
+                            // struct Measurement
+                            // ==================
+
+struct Measurement {
+    // This 'struct' holds the result of measuring one operation.
+
+    // DATA
+    bsl::string        d_message;            // name of the message
+    const char        *d_codec;              // name of the codec
+    const char        *d_operation;          // "encode" or "decode"
+    bsls::Types::Int64 d_numBytes;           // size of the encoded message
+    bsls::Types::Int64 d_iterations;         // messages in measured batch
+    bsls::Types::Int64 d_elapsedNanoseconds; // duration of measured batch
+    bsls::Types::Int64 d_numAllocations;     // allocations in measured batch
+    bsls::Types::Int64 d_numBytesAllocated;  // bytes allocated in batch
+    bool               d_verified;           // message survived round trip
+};
+
+                               // =============
+                               // struct Config
+                               // =============
+
+struct Config {
+    // This 'struct' holds the configuration of the benchmark.
+
+    // DATA
+    double             d_minSeconds;  // minimum duration of measured batch
+    bsl::string        d_codec;       // codec to measure, or "" for all
+    CountingAllocator *d_allocator;   // allocator counting all allocations
+};
+
+                              // ===============
+                              // struct BerCodec
+                              // ===============
+
+struct BerCodec {
+    // This 'struct' provides the operations of the BER codec.
+
+    static const char *name()
+    {
+        return "ber";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf   *buffer,
+                      const TYPE&       value,
+                      bslma::Allocator *allocator)
+    {
+        balber::BerEncoder encoder(0, allocator);
+        return encoder.encode(buffer, value);
+    }
+
+    template <class TYPE>
+    static int decode(TYPE             *value,
+                      const char       *data,
+                      int               length,
+                      bslma::Allocator *allocator)
+    {
+        balber::BerDecoder decoder(0, allocator);
+        return decoder.decode(data, length, value);
+    }
+};
+
+                              // ================
+                              // struct JsonCodec
+                              // ================
+
+struct JsonCodec {
+    // This 'struct' provides the operations of the JSON codec.
+
+    static const char *name()
+    {
+        return "json";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf   *buffer,
+                      const TYPE&       value,
+                      bslma::Allocator *allocator)
+    {
+        static const baljsn::EncoderOptions options;
+
+        baljsn::Encoder encoder(allocator);
+        return encoder.encode(buffer, value, options);
+    }
+
+    template <class TYPE>
+    static int decode(TYPE             *value,
+                      const char       *data,
+                      int               length,
+                      bslma::Allocator *allocator)
+    {
+        static const baljsn::DecoderOptions options;
+
+        baljsn::Decoder decoder(allocator);
+        return decoder.decode(bslstl::StringRef(data, length),
+                              value,
+                              options);
+    }
+};
+
+                              // ===============
+                              // struct XmlCodec
+                              // ===============
+
+struct XmlCodec {
+    // This 'struct' provides the operations of the XML codec.
+
+    static const char *name()
+    {
+        return "xml";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf   *buffer,
+                      const TYPE&       value,
+                      bslma::Allocator *allocator)
+    {
+        static const balxml::EncoderOptions options;
+
+        balxml::Encoder encoder(&options, allocator);
+        return encoder.encode(buffer, value);
+    }
+
+    template <class TYPE>
+    static int decode(TYPE             *value,
+                      const char       *data,
+                      int               length,
+                      bslma::Allocator *allocator)
+    {
+        static const balxml::DecoderOptions options;
+
+        balxml::MiniReader reader(allocator);
+        balxml::Decoder    decoder(&options, &reader, 0, allocator);
+        return decoder.decode(data, length, value);
+    }
+};
+
+                          // =====================
+                          // class EncodeOperation
+                          // =====================
+
+template <class CODEC, class TYPE>
+class EncodeOperation {
+    // This class provides a function object that encodes a value with a
+    // (template parameter) 'CODEC' to the start of a buffer.
+
+    // DATA
+    const TYPE             *d_value_p;      // value to encode
+    bdlsb::MemOutStreamBuf *d_buffer_p;     // buffer to encode to
+    bslma::Allocator       *d_allocator_p;  // allocator for the encoder
+
+  public:
+    // CREATORS
+    EncodeOperation(const TYPE             *value,
+                    bdlsb::MemOutStreamBuf *buffer,
+                    bslma::Allocator       *allocator)
+    : d_value_p(value)
+    , d_buffer_p(buffer)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    int operator()()
+    {
+        d_buffer_p->pubseekpos(0);
+        return CODEC::encode(d_buffer_p, *d_value_p, d_allocator_p);
+    }
+};
+
+                          // =====================
+                          // class DecodeOperation
+                          // =====================
+
+template <class CODEC, class TYPE>
+class DecodeOperation {
+    // This class provides a function object that decodes a value with a
+    // (template parameter) 'CODEC' from a buffer, into a newly created
+    // object.
+
+    // DATA
+    const char       *d_data_p;       // encoded value
+    int               d_length;       // length of the encoded value
+    bslma::Allocator *d_allocator_p;  // allocator for the decoder and value
+
+  public:
+    // CREATORS
+    DecodeOperation(const char       *data,
+                    int               length,
+                    bslma::Allocator *allocator)
+    : d_data_p(data)
+    , d_length(length)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    int operator()()
+    {
+        TYPE value(d_allocator_p);
+        return CODEC::decode(&value, d_data_p, d_length, d_allocator_p);
+    }
+};
+
+                       // ==========================
+                       // class DatumEncodeOperation
+                       // ==========================
+
+class DatumEncodeOperation {
+    // This class provides a function object that encodes a 'Datum' as JSON
+    // to the start of a buffer.
+
+    // DATA
+    const bdld::Datum *d_datum_p;   // value to encode
+    bsl::ostream      *d_stream_p;  // stream to encode to
+
+  public:
+    // CREATORS
+    DatumEncodeOperation(const bdld::Datum *datum, bsl::ostream *stream)
+    : d_datum_p(datum)
+    , d_stream_p(stream)
+    {
+    }
+
+    // MANIPULATORS
+    int operator()()
+    {
+        d_stream_p->rdbuf()->pubseekpos(0);
+        return baljsn::DatumUtil::encode(*d_stream_p, *d_datum_p);
+    }
+};
+
+                       // ==========================
+                       // class DatumDecodeOperation
+                       // ==========================
+
+class DatumDecodeOperation {
+    // This class provides a function object that decodes a 'Datum' from
+    // JSON into a newly created object.
+
+    // DATA
+    bslstl::StringRef  d_json;         // encoded value
+    bslma::Allocator  *d_allocator_p;  // allocator for the value
+
+  public:
+    // CREATORS
+    DatumDecodeOperation(const bslstl::StringRef&  json,
+                         bslma::Allocator         *allocator)
+    : d_json(json)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    int operator()()
+    {
+        bdld::ManagedDatum datum(d_allocator_p);
+        return baljsn::DatumUtil::decode(&datum, d_json);
+    }
+};
+
+                            // ===================
+                            // function templates
+                            // ===================
+
+template <class OPERATION>
+int measure(Measurement   *result,
+            OPERATION&     operation,
+            const Config&  config)
+    // Run the specified 'operation' in batches, doubling the size of each
+    // batch until a batch takes at least 'config.d_minSeconds', and load the
+    // size, duration, and allocations of that batch into the specified
+    // 'result'.  Return 0 on success, and the non-zero status returned by
+    // 'operation' otherwise.
+{
+    enum { k_MAX_ITERATIONS = 1 << 30 };
+
+    const bsls::Types::Int64 minNanoseconds =
+               static_cast<bsls::Types::Int64>(config.d_minSeconds * 1.0E9);
+
+    bsls::Types::Int64 iterations = 1;
+    for (;;) {
+        config.d_allocator->reset();
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        for (bsls::Types::Int64 i = 0; i < iterations; ++i) {
+            const int rc = operation();
+            if (0 != rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+        if (elapsed >= minNanoseconds || iterations >= k_MAX_ITERATIONS) {
+            result->d_iterations         = iterations;
+            result->d_elapsedNanoseconds = elapsed;
+            result->d_numAllocations     =
+                                          config.d_allocator->numAllocations();
+            result->d_numBytesAllocated  =
+                                       config.d_allocator->numBytesAllocated();
+            return 0;                                                 // RETURN
+        }
+
+        iterations *= 2;
+    }
+}
+
+template <class CODEC, class TYPE>
+int benchmarkCodec(bsl::vector<Measurement> *results,
+                   const char               *message,
+                   const TYPE&               value,
+                   const Config&             config)
+    // Measure encoding the specified 'value', named by the specified
+    // 'message', with the (template parameter) 'CODEC', and decoding the
+    // result, according to the specified 'config', and append the
+    // measurements to the specified 'results'.  Return 0 on success, and a
+    // non-zero value if any operation fails.
+{
+    if (!config.d_codec.empty() && config.d_codec != CODEC::name()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslma::Allocator *allocator = config.d_allocator;
+
+    bdlsb::MemOutStreamBuf buffer(allocator);
+    if (0 != CODEC::encode(&buffer, value, allocator)) {
+        bsl::cerr << "Failed to encode '" << message << "' with '"
+                  << CODEC::name() << "'." << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string encoded(buffer.data(), buffer.length(), allocator);
+    const int         length = static_cast<int>(encoded.length());
+
+    TYPE decoded(allocator);
+    if (0 != CODEC::decode(&decoded, encoded.data(), length, allocator)) {
+        bsl::cerr << "Failed to decode '" << message << "' with '"
+                  << CODEC::name() << "'." << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    Measurement result;
+    result.d_message  = message;
+    result.d_codec    = CODEC::name();
+    result.d_numBytes = length;
+    result.d_verified = value == decoded;
+
+    EncodeOperation<CODEC, TYPE> encodeOperation(&value, &buffer, allocator);
+
+    result.d_operation = "encode";
+    if (0 != measure(&result, encodeOperation, config)) {
+        return -1;                                                    // RETURN
+    }
+    results->push_back(result);
+
+    DecodeOperation<CODEC, TYPE> decodeOperation(encoded.data(),
+                                                 length,
+                                                 allocator);
+
+    result.d_operation = "decode";
+    if (0 != measure(&result, decodeOperation, config)) {
+        return -1;                                                    // RETURN
+    }
+    results->push_back(result);
+
+    return 0;
+}
+
+int benchmarkDatum(bsl::vector<Measurement> *results,
+                   const char               *message,
+                   const bsl::string&        json,
+                   const Config&             config)
+    // Measure decoding the specified 'json', the JSON form of the message
+    // named by the specified 'message', into a 'bdld::Datum', and encoding
+    // the result, according to the specified 'config', and append the
+    // measurements to the specified 'results'.  Return 0 on success, and a
+    // non-zero value if any operation fails.
+{
+    if (!config.d_codec.empty() && config.d_codec != "datum") {
+        return 0;                                                     // RETURN
+    }
+
+    bslma::Allocator *allocator = config.d_allocator;
+
+    bdld::ManagedDatum datum(allocator);
+    if (0 != baljsn::DatumUtil::decode(&datum, json)) {
+        bsl::cerr << "Failed to decode '" << message << "' with 'datum'."
+                  << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    bdlsb::MemOutStreamBuf buffer(allocator);
+    bsl::ostream           stream(&buffer);
+    if (0 != baljsn::DatumUtil::encode(stream, *datum)) {
+        bsl::cerr << "Failed to encode '" << message << "' with 'datum'."
+                  << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string encoded(buffer.data(), buffer.length(), allocator);
+
+    bdld::ManagedDatum decoded(allocator);
+
+    Measurement result;
+    result.d_message  = message;
+    result.d_codec    = "datum";
+    result.d_numBytes = static_cast<int>(encoded.length());
+    result.d_verified = 0 == baljsn::DatumUtil::decode(&decoded, encoded)
+                     && datum == decoded;
+
+    DatumEncodeOperation encodeOperation(&*datum, &stream);
+
+    result.d_operation = "encode";
+    if (0 != measure(&result, encodeOperation, config)) {
+        return -1;                                                    // RETURN
+    }
+    results->push_back(result);
+
+    DatumDecodeOperation decodeOperation(encoded, allocator);
+
+    result.d_operation = "decode";
+    if (0 != measure(&result, decodeOperation, config)) {
+        return -1;                                                    // RETURN
+    }
+    results->push_back(result);
+
+    return 0;
+}
+
+template <class TYPE>
+int benchmarkMessage(bsl::vector<Measurement> *results,
+                     const char               *message,
+                     const TYPE&               value,
+                     const Config&             config)
+    // Measure encoding and decoding the specified 'value', named by the
+    // specified 'message', with each codec selected by the specified
+    // 'config', and append the measurements to the specified 'results'.
+    // Return 0 on success, and a non-zero value if any operation fails.
+{
+    int rc = 0;
+
+    rc |= benchmarkCodec<BerCodec>(results, message, value, config);
+    rc |= benchmarkCodec<JsonCodec>(results, message, value, config);
+    rc |= benchmarkCodec<XmlCodec>(results, message, value, config);
+
+    bdlsb::MemOutStreamBuf buffer(config.d_allocator);
+    if (0 != JsonCodec::encode(&buffer, value, config.d_allocator)) {
+        return -1;                                                    // RETURN
+    }
+
+    rc |= benchmarkDatum(results,
+                         message,
+                         bsl::string(buffer.data(),
+                                     buffer.length(),
+                                     config.d_allocator),
+                         config);
+
+    return rc;
+}
+
+                            // =================
+                            // message factories
+                            // =================
+
+void makeBasicRecord(s_baltst::BasicRecord *record, int index)
+    // Load into the specified 'record' a value derived from the specified
+    // 'index'.
+{
+    record->i1() = 11 + index;
+    record->i2() = 22 * index;
+    record->dt() = bdlt::DatetimeTz(
+                         bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                        bdlt::Time(16, 30, index % 60, 125)),
+                         -300);
+    record->s()  = "The quick brown fox jumped over the lazy dog.";
+}
+
+void makeEmployee(s_baltst::Employee *employee)
+    // Load into the specified 'employee' a typical value.
+{
+    employee->name()                 = "Bob Smith";
+    employee->homeAddress().street() = "731 Lexington Avenue";
+    employee->homeAddress().city()   = "New York";
+    employee->homeAddress().state()  = "New York";
+    employee->age()                  = 42;
+}
+
+void makeBig(s_baltst::TimingRequest *request, int size)
+    // Load into the specified 'request' a 'BigRecord' having an array of the
+    // specified 'size' records.
+{
+    s_baltst::BigRecord& record = request->makeBig();
+    record.name() = "This record is so big, it has its own gravity.";
+    record.array().resize(size);
+    for (int i = 0; i < size; ++i) {
+        makeBasicRecord(&record.array()[i], i);
+    }
+}
+
+void makeStrings(s_baltst::MySequenceWithArray *sequence, int size)
+    // Load into the specified 'sequence' an array of the specified 'size'
+    // strings of various lengths.
+{
+    static const char TEXT[] = "Lorem ipsum dolor sit amet, consectetur "
+                               "adipiscing elit, sed do eiusmod tempor.";
+
+    sequence->attribute1() = size;
+    sequence->attribute2().resize(size);
+    for (int i = 0; i < size; ++i) {
+        sequence->attribute2()[i].assign(TEXT, 4 + i % (sizeof TEXT - 4));
+    }
+}
+
+void makeChoices(s_baltst::FeatureTestMessage *message, int size)
+    // Load into the specified 'message' a sequence having an array of the
+    // specified 'size' choices, of which half have nested choices.
+{
+    s_baltst::Sequence1& sequence = message->makeSelection1();
+    sequence.element3().makeSelection1(true);
+    sequence.element2().resize(size);
+
+    for (int i = 0; i < size; ++i) {
+        s_baltst::Choice1& choice = sequence.element2()[i];
+        switch (i % 4) {
+          case 0: {
+            choice.makeSelection1(i);
+          } break;
+          case 1: {
+            choice.makeSelection2(i * 0.25);
+          } break;
+          case 2: {
+            choice.makeSelection4().makeSelection2("nested string");
+          } break;
+          default: {
+            choice.makeSelection4().makeSelection3().makeSelection4()
+                                                         .makeSelection4(i);
+          } break;
+        }
+    }
+}
+
+                             // ================
+                             // output functions
+                             // ================
+
+void printCsv(bsl::ostream& stream, const bsl::vector<Measurement>& results)
+    // Print the specified 'results' to the specified 'stream' as comma
+    // separated values, preceded by a header line.
+{
+    stream << "message,codec,operation,bytes,iterations,nsPerMessage,"
+              "messagesPerSecond,megabytesPerSecond,allocationsPerMessage,"
+              "bytesPerMessage,verified\n";
+
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Measurement& r = results[i];
+
+        const double iterations = static_cast<double>(r.d_iterations);
+        const double seconds    = r.d_elapsedNanoseconds * 1.0E-9;
+
+        stream << r.d_message << ','
+               << r.d_codec << ','
+               << r.d_operation << ','
+               << r.d_numBytes << ','
+               << r.d_iterations << ','
+               << r.d_elapsedNanoseconds / iterations << ','
+               << iterations / seconds << ','
+               << r.d_numBytes * iterations / seconds * 1.0E-6 << ','
+               << r.d_numAllocations / iterations << ','
+               << r.d_numBytesAllocated / iterations << ','
+               << (r.d_verified ? "true" : "false") << '\n';
+    }
+}
+
+void printJson(bsl::ostream& stream, const bsl::vector<Measurement>& results)
+    // Print the specified 'results' to the specified 'stream' as a JSON
+    // array of objects.
+{
+    stream << "[";
+
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Measurement& r = results[i];
+
+        const double iterations = static_cast<double>(r.d_iterations);
+        const double seconds    = r.d_elapsedNanoseconds * 1.0E-9;
+
+        stream << (0 == i ? "\n" : ",\n")
+               << "  {\"message\":\"" << r.d_message << "\""
+               << ",\"codec\":\"" << r.d_codec << "\""
+               << ",\"operation\":\"" << r.d_operation << "\""
+               << ",\"bytes\":" << r.d_numBytes
+               << ",\"iterations\":" << r.d_iterations
+               << ",\"nsPerMessage\":"
+               << r.d_elapsedNanoseconds / iterations
+               << ",\"messagesPerSecond\":" << iterations / seconds
+               << ",\"megabytesPerSecond\":"
+               << r.d_numBytes * iterations / seconds * 1.0E-6
+               << ",\"allocationsPerMessage\":"
+               << r.d_numAllocations / iterations
+               << ",\"bytesPerMessage\":"
+               << r.d_numBytesAllocated / iterations
+               << ",\"verified\":" << (r.d_verified ? "true" : "false")
+               << "}";
+    }
+
+    stream << "\n]\n";
+}
+
+}  // close unnamed namespace
+
+int main(int argc, const char *argv[])
+{
+    // Count every allocation, including those from the default allocator.
+
+    CountingAllocator allocator;
+    bslma::Default::setDefaultAllocatorRaw(&allocator);
+
+    double      minSeconds = 0.5;
+    int         size       = 100;
+    bsl::string message;
+    bsl::string codec;
+    bsl::string format("csv");
+
+    balcl::OptionInfo specTable[] = {
+      {
+        "t|time",
+        "time",
+        "minimum duration of the measured batch of each operation",
+        balcl::TypeInfo(&minSeconds),
+        balcl::OccurrenceInfo(minSeconds)
+      },
+      {
+        "n|size",
+        "size",
+        "number of array elements in the 'big', 'strings', and 'choices' "
+        "messages",
+        balcl::TypeInfo(&size),
+        balcl::OccurrenceInfo(size)
+      },
+      {
+        "m|message",
+        "message",
+        "measure only this message (employee, basic, big, strings, choices)",
+        balcl::TypeInfo(&message),
+        balcl::OccurrenceInfo::e_OPTIONAL
+      },
+      {
+        "c|codec",
+        "codec",
+        "measure only this codec (ber, json, xml, datum)",
+        balcl::TypeInfo(&codec),
+        balcl::OccurrenceInfo::e_OPTIONAL
+      },
+      {
+        "f|format",
+        "format",
+        "output format (csv, json)",
+        balcl::TypeInfo(&format),
+        balcl::OccurrenceInfo(format)
+      }
+    };
+
+    balcl::CommandLine commandLine(specTable);
+    if (0 != commandLine.parse(argc, argv)) {
+        commandLine.printUsage();
+        return 1;                                                     // RETURN
+    }
+
+    if (minSeconds < 0 || size < 0) {
+        bsl::cerr << "Invalid time or size." << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    if (!codec.empty() && "ber"  != codec && "json"  != codec
+                       && "xml"  != codec && "datum" != codec) {
+        bsl::cerr << "Invalid codec: " << codec << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    if ("csv" != format && "json" != format) {
+        bsl::cerr << "Invalid format: " << format << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    Config config;
+    config.d_minSeconds = minSeconds;
+    config.d_codec      = codec;
+    config.d_allocator  = &allocator;
+
+    bsl::vector<Measurement> results;
+
+    bool found = false;
+    int  rc    = 0;
+
+    if (message.empty() || "employee" == message) {
+        found = true;
+
+        s_baltst::Employee value;
+        makeEmployee(&value);
+        rc |= benchmarkMessage(&results, "employee", value, config);
+    }
+
+    if (message.empty() || "basic" == message) {
+        found = true;
+
+        s_baltst::TimingRequest value;
+        makeBasicRecord(&value.makeBasic(), 0);
+        rc |= benchmarkMessage(&results, "basic", value, config);
+    }
+
+    if (message.empty() || "big" == message) {
+        found = true;
+
+        s_baltst::TimingRequest value;
+        makeBig(&value, size);
+        rc |= benchmarkMessage(&results, "big", value, config);
+    }
+
+    if (message.empty() || "strings" == message) {
+        found = true;
+
+        s_baltst::MySequenceWithArray value;
+        makeStrings(&value, size);
+        rc |= benchmarkMessage(&results, "strings", value, config);
+    }
+
+    if (message.empty() || "choices" == message) {
+        found = true;
+
+        s_baltst::FeatureTestMessage value;
+        makeChoices(&value, size);
+        rc |= benchmarkMessage(&results, "choices", value, config);
+    }
+
+    if (!found) {
+        bsl::cerr << "Invalid message: " << message << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    if ("json" == format) {
+        printJson(bsl::cout, results);
+    }
+    else {
+        printCsv(bsl::cout, results);
+    }
+    bsl::cout.flush();
+
+    return 0 == rc ? 0 : 2;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
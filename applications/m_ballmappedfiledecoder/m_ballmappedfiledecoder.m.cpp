@@ -0,0 +1,166 @@
+// m_ballmappedfiledecoder.m.cpp                                      -*-C++-*-
+
+//@PURPOSE: Print the records of a mapped log file in human-readable form.
+//
+//@DESCRIPTION: This application decodes a mapped log file, written by
+// 'ball::MappedFileObserver', and prints its records (from the oldest to the
+// most recent) to standard output, formatted by a
+// 'ball::RecordStringFormatter'.  Records can be selected by severity and by
+// category name pattern (see 'ball_patternutil').
+//
+// The usage of the application is:
+//..
+//  m_ballmappedfiledecoder [-s|severity <level>] [-c|category <pattern>]
+//                          [-f|format <spec>] [-n|sequence] <file>
+//..
+// where:
+//..
+//  -s|severity   print only the records at least as severe as the specified
+//                level (e.g., "WARN"); by default, all records are printed
+//  -c|category   print only the records whose category matches the specified
+//                pattern (e.g., "EQ.*"); by default, all records are printed
+//  -f|format     format records according to the specified
+//                'ball::RecordStringFormatter' specification; the default is
+//                "%d %p:%t %s %f:%l %c %m\n"
+//  -n|sequence   precede each record with its sequence number, which reveals
+//                the number of records that were overwritten
+//..
+// The application returns 0 on success, 1 if the command line is invalid, 2
+// if the file cannot be opened or is not a mapped log file, and 3 if the file
+// is corrupt (in which case the records preceding the corrupt frame are
+// printed).
+
+#include <ball_mappedfilereader.h>
+#include <ball_patternutil.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+
+#include <balcl_commandline.h>
+#include <balcl_occurrenceinfo.h>
+#include <balcl_optioninfo.h>
+#include <balcl_typeinfo.h>
+
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+int main(int argc, const char *argv[])
+{
+    bsl::string fileName;
+    bsl::string severityName("TRACE");
+    bsl::string categoryPattern("*");
+    bsl::string format("%d %p:%t %s %f:%l %c %m\n");
+    bool        printSequence = false;
+
+    balcl::OptionInfo specTable[] = {
+      {
+        "s|severity",
+        "severity",
+        "minimum severity of the records to print",
+        balcl::TypeInfo(&severityName),
+        balcl::OccurrenceInfo(severityName)
+      },
+      {
+        "c|category",
+        "category",
+        "pattern matching the categories of the records to print",
+        balcl::TypeInfo(&categoryPattern),
+        balcl::OccurrenceInfo(categoryPattern)
+      },
+      {
+        "f|format",
+        "format",
+        "record format specification (see 'ball_recordstringformatter')",
+        balcl::TypeInfo(&format),
+        balcl::OccurrenceInfo(format)
+      },
+      {
+        "n|sequence",
+        "sequence",
+        "print the sequence number of each record",
+        balcl::TypeInfo(&printSequence),
+        balcl::OccurrenceInfo::e_OPTIONAL
+      },
+      {
+        "",
+        "file",
+        "mapped log file to decode",
+        balcl::TypeInfo(&fileName),
+        balcl::OccurrenceInfo::e_REQUIRED
+      }
+    };
+
+    balcl::CommandLine commandLine(specTable);
+    if (0 != commandLine.parse(argc, argv)) {
+        commandLine.printUsage();
+        return 1;                                                     // RETURN
+    }
+
+    ball::Severity::Level threshold;
+    if (0 != ball::Severity::fromAscii(&threshold,
+                                       severityName.c_str(),
+                                       static_cast<int>(
+                                                     severityName.length()))) {
+        bsl::cerr << "Invalid severity: " << severityName << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    if (!ball::PatternUtil::isValidPattern(categoryPattern.c_str())) {
+        bsl::cerr << "Invalid category pattern: " << categoryPattern
+                  << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    ball::MappedFileReader reader;
+    if (0 != reader.open(fileName.c_str())) {
+        bsl::cerr << "Cannot open mapped log file: " << fileName << bsl::endl;
+        return 2;                                                     // RETURN
+    }
+
+    const ball::RecordStringFormatter formatter(format.c_str());
+
+    ball::Record record;
+
+    int rc;
+    while (0 == (rc = reader.readRecord(&record))) {
+        const ball::RecordAttributes& attributes = record.fixedFields();
+
+        if (attributes.severity() > threshold
+         || !ball::PatternUtil::isMatch(attributes.category(),
+                                        categoryPattern.c_str())) {
+            continue;
+        }
+
+        if (printSequence) {
+            bsl::cout << '#' << reader.sequenceNumber() << ' ';
+        }
+        formatter(bsl::cout, record);
+    }
+    bsl::cout.flush();
+
+    if (0 > rc) {
+        bsl::cerr << "Corrupt mapped log file: " << fileName << bsl::endl;
+        return 3;                                                     // RETURN
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
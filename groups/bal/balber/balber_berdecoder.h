@@ -27,10 +27,28 @@ BSLS_IDENT("$Id: $")
 // for two types of input streams:
 //: o 'bsl::streambuf'
 //: o 'bsl::istream'
+// and for two types of in-memory input:
+//: o a contiguous buffer, given as an address and a length
+//: o a 'bdlbb::Blob'
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
 //
+///Decoding from Memory
+///--------------------
+// When the BER data is already in memory, the in-memory 'decode' overloads
+// should be preferred to wrapping the data in a stream.  The contiguous
+// overload reads the buffer in place, through a stream buffer whose get area
+// is the whole buffer, so that each octet of a tag, length, or integral value
+// is read by inline, bounds-checked pointer arithmetic, with no virtual call
+// to refill the get area, and each string or other multi-octet value is
+// copied directly from the buffer.  The 'bdlbb::Blob' overload reads each
+// data buffer of the blob in place in the same way, crossing to the next data
+// buffer only when the current one is exhausted; in particular, a blob need
+// not be copied into a contiguous buffer (linearized) to be decoded.  Note
+// that neither overload requires that all of the input be consumed by the
+// decoded object.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -110,6 +128,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_assert.h>
@@ -265,6 +287,24 @@ class BerDecoder {
         // Return 0 on success, and a non-zero value otherwise.  If the
         // decoding fails 'stream' will be invalidated.
 
+    template <typename TYPE>
+    int decode(const char *buffer, int length, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified
+        // contiguous 'buffer' having the specified 'length', and load the
+        // result into the specified modifiable 'variable'.  Return 0 on
+        // success, and a non-zero value otherwise.  The behavior is undefined
+        // unless '0 <= length'.  Note that 'buffer' is read in place, and
+        // that bytes following the encoding of 'variable' are ignored.
+
+    template <typename TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the data buffers of
+        // the specified 'blob', and load the result into the specified
+        // modifiable 'variable'.  Return 0 on success, and a non-zero value
+        // otherwise.  Note that the data buffers of 'blob' are read in place,
+        // without being copied into a contiguous buffer, and that bytes
+        // following the encoding of 'variable' are ignored.
+
     void setNumUnknownElementsSkipped(int value);
         // Set the number of unknown elements skipped by the decoder during the
         // current decoding operation to the specified 'value'.  The behavior
@@ -626,6 +666,25 @@ int BerDecoder::decode(bsl::istream& stream, TYPE *variable)
     return 0;
 }
 
+template <typename TYPE>
+inline
+int BerDecoder::decode(const char *buffer, int length, TYPE *variable)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(0 <= length);
+
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+    return this->decode(&streamBuf, variable);
+}
+
+template <typename TYPE>
+inline
+int BerDecoder::decode(const bdlbb::Blob& blob, TYPE *variable)
+{
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+    return this->decode(&streamBuf, variable);
+}
+
 template <typename TYPE>
 int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
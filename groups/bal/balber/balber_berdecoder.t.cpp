@@ -35,6 +35,9 @@
 #include <bdlb_string.h>
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 
 #include <bslim_printer.h>
 #include <bslim_testutil.h>
@@ -61,9 +64,11 @@
 #include <bslma_testallocatormonitor.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
+#include <bsl_sstream.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -1958,7 +1963,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 21: {
+      case 22: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1983,6 +1988,171 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING decoding from memory
+        //   Ensure that objects are decoded from a contiguous buffer, and from
+        //   a 'bdlbb::Blob' having data buffers of any size, as from a
+        //   'bsl::streambuf'.
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer, and from a blob, produces the
+        //:   same value as decoding from a stream buffer over the same data.
+        //:
+        //: 2 Values, tags, and lengths split across the data buffers of a
+        //:   blob are decoded correctly.
+        //:
+        //: 3 Bytes of the last data buffer past the length of a blob, and
+        //:   capacity buffers, are not read.
+        //:
+        //: 4 Decoding fails if the input is truncated.
+        //:
+        //: 5 Bytes following the encoded object are ignored.
+        //
+        // Plan:
+        //: 1 Encode an 'Employee' and a 'TimingRequest' holding a big record.
+        //:
+        //: 2 Decode each encoding from a contiguous buffer, and from blobs
+        //:   having data buffers of several sizes, from 1 to larger than the
+        //:   encoding, and excess capacity; verify the decoded value.
+        //:   (C-1..3)
+        //:
+        //: 3 Decode each encoding, less its last byte, from a contiguous
+        //:   buffer and from a blob, and verify that decoding fails.  (C-4)
+        //:
+        //: 4 Decode each encoding followed by garbage, and verify the decoded
+        //:   value.  (C-5)
+        //
+        // Testing:
+        //   int decode(const char *buffer, int length, TYPE *variable);
+        //   int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTesting decoding from memory"
+                               << "\n============================"
+                               << bsl::endl;
+
+        test::Employee employee;
+        employee.name()                 = "Bob";
+        employee.homeAddress().street() = "Some Street";
+        employee.homeAddress().city()   = "Some City";
+        employee.homeAddress().state()  = "Some State";
+        employee.age()                  = 21;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                  bdlt::Datetime(bdlt::Date(2007, 9, 3), bdlt::Time(16, 30)),
+                  0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        bigRec.array().resize(20, basicRec);
+
+        test::TimingRequest request;
+        request.makeBig(bigRec);
+
+        bdlsb::MemOutStreamBuf employeeOsb;
+        ASSERT(0 == encoder.encode(&employeeOsb, employee));
+
+        bdlsb::MemOutStreamBuf requestOsb;
+        ASSERT(0 == encoder.encode(&requestOsb, request));
+
+        const int BUFFER_SIZES[] = { 1, 2, 3, 5, 8, 64, 100000 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                   / sizeof *BUFFER_SIZES;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const bdlsb::MemOutStreamBuf& OSB    = ti ? requestOsb
+                                                      : employeeOsb;
+            const int                     LENGTH =
+                                               static_cast<int>(OSB.length());
+
+            if (veryVerbose) { P_(ti) P(LENGTH) }
+
+            {
+                test::Employee      decodedEmployee;
+                test::TimingRequest decodedRequest;
+
+                int rc = ti ? decoder.decode(OSB.data(),
+                                             LENGTH,
+                                             &decodedRequest)
+                            : decoder.decode(OSB.data(),
+                                             LENGTH,
+                                             &decodedEmployee);
+                ASSERTV(ti, rc, 0 == rc);
+                ASSERTV(ti, ti ? request == decodedRequest
+                               : employee == decodedEmployee);
+
+                rc = ti ? decoder.decode(OSB.data(),
+                                         LENGTH - 1,
+                                         &decodedRequest)
+                        : decoder.decode(OSB.data(),
+                                         LENGTH - 1,
+                                         &decodedEmployee);
+                ASSERTV(ti, rc, 0 != rc);
+
+                bsl::vector<char> padded(OSB.data(), OSB.data() + LENGTH);
+                padded.resize(LENGTH + 10, '\x5A');
+
+                rc = ti ? decoder.decode(padded.data(),
+                                         LENGTH + 10,
+                                         &decodedRequest)
+                        : decoder.decode(padded.data(),
+                                         LENGTH + 10,
+                                         &decodedEmployee);
+                ASSERTV(ti, rc, 0 == rc);
+                ASSERTV(ti, ti ? request == decodedRequest
+                               : employee == decodedEmployee);
+            }
+
+            for (int tj = 0; tj < NUM_BUFFER_SIZES; ++tj) {
+                const int BUFFER_SIZE = BUFFER_SIZES[tj];
+
+                if (veryVerbose) { T_ P(BUFFER_SIZE) }
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+
+                bdlbb::Blob blob(&factory);
+                bdlbb::BlobUtil::append(&blob, OSB.data(), LENGTH);
+
+                // Fill the remainder of the last data buffer, and a capacity
+                // buffer, with garbage.
+
+                blob.setLength(LENGTH + BUFFER_SIZE * 2);
+                for (int i = blob.numDataBuffers() - 1;
+                     i < blob.numBuffers();
+                     ++i) {
+                    bsl::memset(blob.buffer(i).data(),
+                                0xFF,
+                                blob.buffer(i).size());
+                }
+                blob.setLength(0);
+                bdlbb::BlobUtil::append(&blob, OSB.data(), LENGTH);
+                ASSERTV(ti, BUFFER_SIZE,
+                        blob.numBuffers() > blob.numDataBuffers());
+
+                test::Employee      decodedEmployee;
+                test::TimingRequest decodedRequest;
+
+                int rc = ti ? decoder.decode(blob, &decodedRequest)
+                            : decoder.decode(blob, &decodedEmployee);
+                ASSERTV(ti, BUFFER_SIZE, rc, 0 == rc);
+                ASSERTV(ti, BUFFER_SIZE, ti ? request == decodedRequest
+                                            : employee == decodedEmployee);
+
+                blob.setLength(LENGTH - 1);
+
+                rc = ti ? decoder.decode(blob, &decodedRequest)
+                        : decoder.decode(blob, &decodedEmployee);
+                ASSERTV(ti, BUFFER_SIZE, rc, 0 != rc);
+            }
+        }
+
+        if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING decoding sequences of maximum size
@@ -6933,8 +7103,141 @@ int main(int argc, char *argv[])
         bsl::cout << "    balber::BerDecoder: "
                   << elapsed          << " seconds, "
                   << (reps / elapsed) << " reps/sec" << bsl::endl;
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DECODING FROM MEMORY
+        //   Compare the throughput of decoding in-memory BER data through an
+        //   'bsl::istream', a 'bdlsb::FixedMemInStreamBuf', a contiguous
+        //   buffer, and a 'bdlbb::Blob' (both in place, and after copying it
+        //   into a contiguous buffer).
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer is no slower than decoding from
+        //:   a stream over the same buffer.
+        //:
+        //: 2 Decoding a blob in place is faster than linearizing it first.
+        //
+        // Plan:
+        //: 1 Encode an 'Employee' and a 'TimingRequest' holding a big record,
+        //:   and time the repeated decoding of each encoding by each method.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DECODING FROM MEMORY
+        // --------------------------------------------------------------------
 
-        delete[] inRequests;
+        if (verbose) bsl::cout << "\nPERFORMANCE TEST: DECODING FROM MEMORY"
+                               << "\n======================================"
+                               << bsl::endl;
+
+        const int REPS = argc > 2 ? bsl::atoi(argv[2]) : 2000;
+
+        test::Employee employee;
+        employee.name()                 = "Bob";
+        employee.homeAddress().street() = "Some Street";
+        employee.homeAddress().city()   = "Some City";
+        employee.homeAddress().state()  = "Some State";
+        employee.age()                  = 21;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                  bdlt::Datetime(bdlt::Date(2007, 9, 3), bdlt::Time(16, 30)),
+                  0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        bigRec.array().resize(200, basicRec);
+
+        test::TimingRequest request;
+        request.makeBig(bigRec);
+
+        static const char *const METHODS[] = {
+            "istream", "streambuf", "contiguous", "blob", "linearized blob"
+        };
+        const int NUM_METHODS = sizeof METHODS / sizeof *METHODS;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == (ti ? encoder.encode(&osb, request)
+                            : encoder.encode(&osb, employee)));
+
+            const int         LENGTH = static_cast<int>(osb.length());
+            const bsl::string INPUT(osb.data(), LENGTH);
+            const int         reps   = ti ? REPS : REPS * 100;
+
+            bdlbb::SimpleBlobBufferFactory factory(4096);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::BlobUtil::append(&blob, osb.data(), LENGTH);
+
+            bsl::cout << (ti ? "TimingRequest" : "Employee") << " ("
+                      << LENGTH << " bytes)" << bsl::endl;
+
+            for (int method = 0; method < NUM_METHODS; ++method) {
+                test::Employee      decodedEmployee;
+                test::TimingRequest decodedRequest;
+
+                bsls::Stopwatch stopwatch;
+                stopwatch.start();
+
+                for (int i = 0; i < reps; ++i) {
+                    balber::BerDecoder decoder;
+                    int                rc = 0;
+
+                    switch (method) {
+                      case 0: {
+                        bsl::istringstream stream(INPUT);
+                        rc = ti ? decoder.decode(stream, &decodedRequest)
+                                : decoder.decode(stream, &decodedEmployee);
+                      } break;
+                      case 1: {
+                        bdlsb::FixedMemInStreamBuf isb(osb.data(), LENGTH);
+                        rc = ti ? decoder.decode(&isb, &decodedRequest)
+                                : decoder.decode(&isb, &decodedEmployee);
+                      } break;
+                      case 2: {
+                        rc = ti ? decoder.decode(osb.data(),
+                                                 LENGTH,
+                                                 &decodedRequest)
+                                : decoder.decode(osb.data(),
+                                                 LENGTH,
+                                                 &decodedEmployee);
+                      } break;
+                      case 3: {
+                        rc = ti ? decoder.decode(blob, &decodedRequest)
+                                : decoder.decode(blob, &decodedEmployee);
+                      } break;
+                      default: {
+                        bsl::vector<char> buffer(LENGTH);
+                        bdlbb::BlobUtil::copy(buffer.data(), blob, 0, LENGTH);
+                        rc = ti ? decoder.decode(buffer.data(),
+                                                 LENGTH,
+                                                 &decodedRequest)
+                                : decoder.decode(buffer.data(),
+                                                 LENGTH,
+                                                 &decodedEmployee);
+                      } break;
+                    }
+                    ASSERTV(method, rc, 0 == rc);
+                }
+
+                stopwatch.stop();
+
+                ASSERTV(method, ti ? request == decodedRequest
+                                   : employee == decodedEmployee);
+
+                const double seconds = stopwatch.elapsedTime();
+                bsl::cout << "    " << bsl::setw(16) << bsl::left
+                          << METHODS[method] << bsl::right
+                          << bsl::setw(10) << seconds * 1e9 / reps
+                          << " ns/decode, "
+                          << static_cast<double>(LENGTH) * reps
+                                                    / seconds / (1024 * 1024)
+                          << " MB/s" << bsl::endl;
+            }
+        }
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
@@ -41,6 +41,11 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_severity     (e_BER_SUCCESS)
 , d_streamBuf    (0)
 , d_currentDepth (0)
+, d_lengthMode   (e_INDEFINITE_LENGTH)
+, d_lengths      (d_allocator)
+, d_openElements (d_allocator)
+, d_nextLength   (0)
+, d_numOctets    (0)
 {
 }
 
@@ -146,18 +151,23 @@ int BerEncoder::encodeImpl(const bsl::vector<char>&  value,
 
     const int size = static_cast<int>(value.size());
 
-    int status = BerUtil::putIdentifierOctets(d_streamBuf,
-                                              tagClass,
-                                              BerConstants::e_PRIMITIVE,
-                                              tagNumber);
-    status |= BerUtil::putLength(d_streamBuf, size);
+    int status = putIdentifierOctets(tagClass,
+                                     BerConstants::e_PRIMITIVE,
+                                     tagNumber);
 
-    // If 'size == 0', don't call 'sputn()'.  If 'size != 0', then set 'status'
-    // to a non-zero value if 'sputn()' returns a value other than 'size', in
-    // which case 'size ^ sputn()' will be non-zero.  If 'sputn() == size',
-    // 'status' will not be modified.
+    if (e_SIZING == d_lengthMode) {
+        d_numOctets += BerUtil::numLengthOctets(size) + size;
+    }
+    else {
+        status |= BerUtil::putLength(d_streamBuf, size);
 
-    status |= size && (size ^ d_streamBuf->sputn(&value[0], size));
+        // If 'size == 0', don't call 'sputn()'.  If 'size != 0', then set
+        // 'status' to a non-zero value if 'sputn()' returns a value other
+        // than 'size', in which case 'size ^ sputn()' will be non-zero.  If
+        // 'sputn() == size', 'status' will not be modified.
+
+        status |= size && (size ^ d_streamBuf->sputn(&value[0], size));
+    }
 
     if (status) {
         logError(tagClass,
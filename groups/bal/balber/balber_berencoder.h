@@ -31,6 +31,35 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Definite-Length Encoding
+///------------------------
+// By default, every constructed element (sequence, choice, array, and
+// nillable value) is encoded with the indefinite-length octet, and its
+// contents are terminated by two end-of-contents octets, so that each element
+// can be written as soon as it is visited.  If the 'encodeDefiniteLength'
+// option (see 'balber_berencoderoptions') is set, constructed elements are
+// instead encoded with their definite lengths, as required by some peers (and
+// by the DER subset of BER).  Such an encoding is typically smaller (for
+// contents shorter than 65536 bytes, the length octets are no longer than the
+// indefinite-length octet and end-of-contents octets they replace), and lets
+// a decoder skip an unknown element without parsing its contents.
+//
+// The length of a constructed element must precede its contents, so a
+// definite-length encoding is produced in two passes: the first pass visits
+// the value, computing (without formatting) the number of octets of each
+// identifier, length, and primitive value that would be written, and records
+// the length of the contents of each constructed element in the order in
+// which the elements are visited; the second pass visits the value again,
+// writing each element, and taking each length from that record.  Hence, the
+// encoding is still written forward, directly to the target stream buffer.
+// Only date and time values encoded in a binary format (see the
+// 'encodeDateAndTimeTypesAsBinary' option) are formatted, to a local buffer,
+// by the first pass.
+//
+// The first pass also yields the length of the whole encoding, so the
+// 'encode' overload taking a 'bsl::vector<char>' sizes the vector once, and
+// writes the encoding in place, without a growing intermediate buffer.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -188,11 +217,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_string.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_objectbuffer.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_vector.h>
 #include <bsl_typeinfo.h>
 
@@ -222,6 +254,15 @@ class BerEncoder {
     friend class  BerEncoder_LevelGuard;
 
     // PRIVATE TYPES
+    enum LengthMode {
+        // This enumeration defines how the lengths of constructed elements
+        // are encoded.
+
+        e_INDEFINITE_LENGTH,  // indefinite length, and end-of-contents octets
+        e_SIZING,             // sizing pass of a definite-length encoding
+        e_DEFINITE_LENGTH     // definite length, from the sizing pass
+    };
+
     class MemOutStream : public bsl::ostream {
         // This class provides stream for logging using
         // 'bdlsb::MemOutStreamBuf' as a streambuf.  The logging stream is
@@ -292,6 +333,24 @@ class BerEncoder {
     bsl::streambuf                   *d_streamBuf;      // held, not owned
     int                               d_currentDepth;   // current depth
 
+    LengthMode                        d_lengthMode;
+        // how the lengths of constructed elements are encoded
+
+    bsl::vector<int>                  d_lengths;
+        // lengths of the contents of the constructed elements, in visitation
+        // order, computed by the sizing pass of a definite-length encoding
+
+    bsl::vector<int>                  d_openElements;
+        // indices in 'd_lengths' of the constructed elements being sized
+
+    bsl::size_t                       d_nextLength;
+        // index in 'd_lengths' of the length of the next constructed element
+        // to be written
+
+    int                               d_numOctets;
+        // number of octets of the encoding computed so far by the sizing
+        // pass of a definite-length encoding
+
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
     BerEncoder& operator=(const BerEncoder&);  // = delete;
@@ -315,6 +374,53 @@ class BerEncoder {
         // Return the stream for logging.  Note the if stream has not been
         // created yet, it will be created during this call.
 
+    int putIdentifierOctets(BerConstants::TagClass tagClass,
+                            BerConstants::TagType  tagType,
+                            int                    tagNumber);
+        // Encode the identifier octets for the specified 'tagClass',
+        // 'tagType', and 'tagNumber', or (while sizing) count them.  Return 0
+        // on success, and a non-zero value otherwise.
+
+    template <typename TYPE>
+    int putValue(const TYPE& value);
+        // Encode the length and contents octets of the specified primitive
+        // 'value', or (while sizing) count them.  Return 0 on success, and a
+        // non-zero value otherwise.
+
+    int putContentsLength();
+        // Encode the length octets of the constructed element whose
+        // identifier octets were just encoded, according to the current
+        // length mode: the indefinite-length octet, nothing (while sizing, in
+        // which case the element is opened), or the definite length computed
+        // by the sizing pass.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    int putContentsEnd();
+        // Complete the encoding of the innermost constructed element whose
+        // contents were just encoded, according to the current length mode:
+        // encode the end-of-contents octets, or (while sizing) record the
+        // length of the contents of the element and count its length octets.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    template <typename TYPE>
+    int encodeWithOptions(bsl::streambuf    *streamBuf,
+                          bsl::vector<char> *buffer,
+                          const TYPE&        value);
+        // Encode the specified 'value' to the specified 'streamBuf' if it is
+        // not 0, and to the specified 'buffer' otherwise, using the options
+        // of this encoder, or default options if it has none.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    template <typename TYPE>
+    int encodeValue(bsl::streambuf    *streamBuf,
+                    bsl::vector<char> *buffer,
+                    const TYPE&        value);
+        // Encode the specified 'value' to the specified 'streamBuf' if it is
+        // not 0, and otherwise assign the encoding to the specified 'buffer',
+        // in two passes if 'd_options->encodeDefiniteLength()' is 'true'.
+        // Return 0 on success, and a non-zero value otherwise, in which case
+        // 'buffer', if used, is empty.
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -402,6 +508,15 @@ class BerEncoder {
         // Encode the specified non-modifiable 'value' to the specified
         // 'streamBuf'.  Return 0 on success, and a non-zero value otherwise.
 
+    template <typename TYPE>
+    int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // Assign to the specified 'buffer' the encoding of the specified
+        // non-modifiable 'value'.  Return 0 on success, and a non-zero value
+        // otherwise, in which case 'buffer' is empty.  Note that, if the
+        // 'encodeDefiniteLength' option is set, 'buffer' is resized once, to
+        // the length computed by the sizing pass, and the encoding is written
+        // in place.
+
     template <typename TYPE>
     int encode(bsl::ostream& stream, const TYPE& value);
         // Encode the specified non-modifiable 'value' to the specified
@@ -667,11 +782,141 @@ bsl::ostream& BerEncoder::logStream()
 
 template <typename TYPE>
 int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    BSLS_ASSERT(streamBuf);
+
+    const int rc = encodeWithOptions(streamBuf, 0, value);
+
+    streamBuf->pubsync();
+
+    return rc;
+}
+
+template <typename TYPE>
+int BerEncoder::encode(bsl::vector<char> *buffer, const TYPE& value)
+{
+    BSLS_ASSERT(buffer);
+
+    return encodeWithOptions(0, buffer, value);
+}
+
+template <typename TYPE>
+int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
+{
+    if (!stream.good()) {
+        return -1;
+    }
+
+    if (0 != this->encode(stream.rdbuf(), value)) {
+        stream.setstate(bsl::ios_base::failbit);
+        return -1;
+    }
+    return 0;
+}
+
+// PRIVATE MANIPULATORS
+inline
+int BerEncoder::putIdentifierOctets(BerConstants::TagClass tagClass,
+                                    BerConstants::TagType  tagType,
+                                    int                    tagNumber)
+{
+    if (e_SIZING == d_lengthMode) {
+        if (tagNumber < 0) {
+            return -1;                                                // RETURN
+        }
+
+        d_numOctets += BerUtil::numIdentifierOctets(tagNumber);
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putIdentifierOctets(d_streamBuf,
+                                        tagClass,
+                                        tagType,
+                                        tagNumber);
+}
+
+template <typename TYPE>
+inline
+int BerEncoder::putValue(const TYPE& value)
+{
+    if (e_SIZING == d_lengthMode) {
+        const int numOctets = BerUtil::numValueOctets(value, d_options);
+        if (numOctets < 0) {
+            return -1;                                                // RETURN
+        }
+
+        d_numOctets += numOctets;
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putValue(d_streamBuf, value, d_options);
+}
+
+inline
+int BerEncoder::putContentsLength()
+{
+    switch (d_lengthMode) {
+      case e_INDEFINITE_LENGTH: {
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+      case e_SIZING: {
+        // Until the element is closed, its slot holds the count at the start
+        // of its contents.
+
+        d_openElements.push_back(static_cast<int>(d_lengths.size()));
+        d_lengths.push_back(d_numOctets);
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        return BerUtil::putLength(d_streamBuf, d_lengths[d_nextLength++]);
+                                                                      // RETURN
+      }
+    }
+
+    BSLS_ASSERT_OPT(!"Unreachable");
+    return -1;
+}
+
+inline
+int BerEncoder::putContentsEnd()
+{
+    switch (d_lengthMode) {
+      case e_INDEFINITE_LENGTH: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+      case e_SIZING: {
+        BSLS_ASSERT(!d_openElements.empty());
+
+        int& length = d_lengths[d_openElements.back()];
+        d_openElements.pop_back();
+
+        length = d_numOctets - length;
+
+        // Count the length octets, which precede the contents but are part of
+        // the contents of the enclosing element.
+
+        d_numOctets += BerUtil::numLengthOctets(length);
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        return 0;                                                     // RETURN
+      }
+    }
+
+    BSLS_ASSERT_OPT(!"Unreachable");
+    return -1;
+}
+
+template <typename TYPE>
+int BerEncoder::encodeWithOptions(bsl::streambuf    *streamBuf,
+                                  bsl::vector<char> *buffer,
+                                  const TYPE&        value)
 {
     BSLS_ASSERT(!d_streamBuf);
 
-    d_streamBuf = streamBuf;
-    d_severity  = e_BER_SUCCESS;
+    d_severity = e_BER_SUCCESS;
 
     if (d_logStream != 0) {
         d_logStream->reset();
@@ -679,47 +924,113 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 
     d_currentDepth = 0;
 
-    int rc;
-
     if (! d_options) {
         BerEncoderOptions options;  // temporary options object
         d_options = &options;
-        BerEncoder_UniversalElementVisitor visitor(
+        const int rc = encodeValue(streamBuf, buffer, value);
+        d_options = 0;
+        return rc;                                                    // RETURN
+    }
+
+    return encodeValue(streamBuf, buffer, value);
+}
+
+template <typename TYPE>
+int BerEncoder::encodeValue(bsl::streambuf    *streamBuf,
+                            bsl::vector<char> *buffer,
+                            const TYPE&        value)
+{
+    BSLS_ASSERT(streamBuf || buffer);
+
+    int rc;
+
+    if (!d_options->encodeDefiniteLength()) {
+        if (streamBuf) {
+            d_streamBuf = streamBuf;
+
+            BerEncoder_UniversalElementVisitor visitor(
                                               this,
                                               bdlat_FormattingMode::e_DEFAULT);
+            rc = visitor(value);
 
+            d_streamBuf = 0;
+            return rc;                                                // RETURN
+        }
+
+        bdlsb::MemOutStreamBuf memStreamBuf(d_allocator);
+        d_streamBuf = &memStreamBuf;
+
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
         rc = visitor(value);
-        d_options = 0;
+
+        d_streamBuf = 0;
+
+        if (0 == rc) {
+            buffer->assign(memStreamBuf.data(),
+                           memStreamBuf.data() + memStreamBuf.length());
+        }
+        else {
+            buffer->clear();
+        }
+        return rc;                                                    // RETURN
     }
-    else {
+
+    // The sizing pass writes nothing, so it has no stream buffer.
+
+    d_lengthMode = e_SIZING;
+    d_lengths.clear();
+    d_openElements.clear();
+    d_numOctets  = 0;
+
+    {
         BerEncoder_UniversalElementVisitor visitor(
                                               this,
                                               bdlat_FormattingMode::e_DEFAULT);
         rc = visitor(value);
     }
 
-    d_streamBuf = 0;
+    if (0 == rc) {
+        d_lengthMode = e_DEFINITE_LENGTH;
+        d_nextLength = 0;
 
-    streamBuf->pubsync();
+        if (streamBuf) {
+            d_streamBuf = streamBuf;
 
-    return rc;
-}
+            BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+            rc = visitor(value);
+        }
+        else {
+            buffer->resize(d_numOctets);
 
-template <typename TYPE>
-int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
-{
-    if (!stream.good()) {
-        return -1;
+            bdlsb::FixedMemOutStreamBuf fixedStreamBuf(buffer->data(),
+                                                       buffer->size());
+            d_streamBuf = &fixedStreamBuf;
+
+            BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+            rc = visitor(value);
+
+            BSLS_ASSERT(0 != rc || fixedStreamBuf.length() == buffer->size());
+        }
+
+        BSLS_ASSERT(0 != rc || d_nextLength == d_lengths.size());
     }
 
-    if (0 != this->encode(stream.rdbuf(), value)) {
-        stream.setstate(bsl::ios_base::failbit);
-        return -1;
+    if (0 != rc && buffer) {
+        buffer->clear();
     }
-    return 0;
+
+    d_streamBuf  = 0;
+    d_lengthMode = e_INDEFINITE_LENGTH;
+
+    return rc;
 }
 
-// PRIVATE MANIPULATORS
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
                            BerConstants::TagClass     tagClass,
@@ -731,11 +1042,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          tagType,
-                                          tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    int rc = putIdentifierOctets(tagClass,
+                                 tagType,
+                                 tagNumber);
+    if (rc | putContentsLength()) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -746,11 +1056,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // According to X.694 (clause 20.4), an XML choice (not anonymous)
         // element is encoded as a sequence with 1 element.
 
-        rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          BerConstants::e_CONTEXT_SPECIFIC,
-                                          tagType,
-                                          0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        rc = putIdentifierOctets(BerConstants::e_CONTEXT_SPECIFIC,
+                                 tagType,
+                                 0);
+        if (rc | putContentsLength()) {
             return k_FAILURE;
         }
     }
@@ -781,13 +1090,12 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // According to X.694 (clause 20.4), an XML choice (not anonymous)
         // element is encoded as a sequence with 1 element.
 
-        // Don't waste time checking the result of this call -- the only thing
-        // that can go wrong is eof, which will happen again when we call it
-        // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        if (0 != putContentsEnd()) {
+            return k_FAILURE;                                         // RETURN
+        }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putContentsEnd();
 }
 
 template <typename TYPE>
@@ -805,11 +1113,10 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
 
         // nillable is encoded in BER as a sequence with one optional element
 
-        int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                              tagClass,
-                                              BerConstants::e_CONSTRUCTED,
-                                              tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        int rc = putIdentifierOctets(tagClass,
+                                     BerConstants::e_CONSTRUCTED,
+                                     tagNumber);
+        if (rc | putContentsLength()) {
             return k_FAILURE;
         }
 
@@ -827,7 +1134,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return putContentsEnd();
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -875,15 +1182,14 @@ int BerEncoder::encodeImpl(const TYPE&                     value,
                            int                             ,
                            bdlat_TypeCategory::Enumeration )
 {
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_PRIMITIVE,
-                                          tagNumber);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_PRIMITIVE,
+                                 tagNumber);
 
     int intValue;
     bdlat_EnumFunctions::toInt(&intValue, value);
 
-    rc |= BerUtil::putValue(d_streamBuf, intValue);
+    rc |= putValue(intValue);
 
     return rc;
 }
@@ -897,19 +1203,20 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
 {
     BerEncoder_Visitor visitor(this);
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_CONSTRUCTED,
-                                          tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_CONSTRUCTED,
+                                 tagNumber);
+    rc |= putContentsLength();
     if (rc) {
-        return rc;
+        return rc;                                                    // RETURN
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
 
-    return rc;
+    return putContentsEnd();
 }
 
 template <typename TYPE>
@@ -919,11 +1226,10 @@ int BerEncoder::encodeImpl(const TYPE&                     value,
                                 int                        ,
                                 bdlat_TypeCategory::Simple )
 {
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_PRIMITIVE,
-                                          tagNumber);
-    rc |= BerUtil::putValue(d_streamBuf, value, d_options);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_PRIMITIVE,
+                                 tagNumber);
+    rc |= putValue(value);
 
     return rc;
 }
@@ -965,11 +1271,10 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          tagType,
-                                          tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int rc = putIdentifierOctets(tagClass,
+                                 tagType,
+                                 tagNumber);
+    rc |= putContentsLength();
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -988,7 +1293,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putContentsEnd();
 }
 
 template <typename TYPE>
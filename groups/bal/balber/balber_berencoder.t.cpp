@@ -65,6 +65,7 @@
 #include <bsl_iosfwd.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
@@ -232,6 +233,206 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+int flattenElements(bsl::string          *events,
+                    bool                 *hasIndefiniteLength,
+                    const unsigned char **position,
+                    const unsigned char  *end,
+                    bool                  isIndefinite)
+    // Append to the specified 'events' a description of the BER elements
+    // starting at the specified '*position' and ending at the specified 'end'
+    // (or, if the specified 'isIndefinite' is 'true', at the first
+    // end-of-contents octets) and set '*position' to the end of the elements.
+    // Set '*hasIndefiniteLength' to 'true' if any constructed element has an
+    // indefinite length.  Return 0 if the elements are well formed, and the
+    // contents of every constructed element end exactly where its length
+    // indicates, and a non-zero value otherwise.  Note that the description
+    // does not depend on how the lengths of constructed elements are encoded.
+{
+    const unsigned char *p = *position;
+
+    while (p < end) {
+        if (isIndefinite && end - p >= 2 && 0 == p[0] && 0 == p[1]) {
+            *position = p + 2;
+            return 0;                                                 // RETURN
+        }
+
+        const unsigned char identifier = *p++;
+        events->push_back(static_cast<char>(identifier));
+
+        if (0x1F == (identifier & 0x1F)) {
+            do {
+                if (p == end) {
+                    return -1;                                        // RETURN
+                }
+                events->push_back(static_cast<char>(*p));
+            } while (*p++ & 0x80);
+        }
+
+        if (p == end) {
+            return -1;                                                // RETURN
+        }
+
+        const bool          isConstructed = identifier & 0x20;
+        const unsigned char lengthOctet   = *p++;
+
+        if (0x80 == lengthOctet) {
+            if (!isConstructed) {
+                return -1;                                            // RETURN
+            }
+
+            *hasIndefiniteLength = true;
+
+            events->push_back('{');
+            if (0 != flattenElements(events,
+                                     hasIndefiniteLength,
+                                     &p,
+                                     end,
+                                     true)) {
+                return -1;                                            // RETURN
+            }
+            events->push_back('}');
+            continue;                                               // CONTINUE
+        }
+
+        int length = lengthOctet;
+        if (lengthOctet & 0x80) {
+            int numOctets = lengthOctet & 0x7F;
+            if (numOctets > 3 || end - p < numOctets) {
+                return -1;                                            // RETURN
+            }
+
+            length = 0;
+            while (numOctets--) {
+                length = length << 8 | *p++;
+            }
+        }
+
+        if (end - p < length) {
+            return -1;                                                // RETURN
+        }
+
+        if (isConstructed) {
+            const unsigned char *contents = p;
+
+            events->push_back('{');
+            if (0 != flattenElements(events,
+                                     hasIndefiniteLength,
+                                     &contents,
+                                     p + length,
+                                     false)) {
+                return -1;                                            // RETURN
+            }
+            events->push_back('}');
+        }
+        else {
+            bsl::ostringstream lengthPrefix;
+            lengthPrefix << length << ':';
+            events->append(lengthPrefix.str());
+            events->append(reinterpret_cast<const char *>(p), length);
+        }
+
+        p += length;
+    }
+
+    *position = p;
+    return isIndefinite ? -1 : 0;
+}
+
+int flattenEncoding(bsl::string *events,
+                    bool        *hasIndefiniteLength,
+                    const char  *data,
+                    int          length)
+    // Load into the specified 'events' a description of the BER elements in
+    // the specified 'data' having the specified 'length', and load into the
+    // specified 'hasIndefiniteLength' whether any constructed element has an
+    // indefinite length.  Return 0 if 'data' consists of well-formed
+    // elements, and a non-zero value otherwise.  Two encodings have the same
+    // description if they differ only in how the lengths of constructed
+    // elements are encoded.
+{
+    const unsigned char *position =
+                                reinterpret_cast<const unsigned char *>(data);
+
+    events->clear();
+    *hasIndefiniteLength = false;
+
+    return flattenElements(events,
+                           hasIndefiniteLength,
+                           &position,
+                           position + length,
+                           false);
+}
+
+template <class TYPE>
+void testDefiniteLength(int line, const TYPE& value)
+    // Encode the specified 'value' with, and without, the
+    // 'encodeDefiniteLength' option, and verify that the definite-length
+    // encoding has no indefinite lengths, is no larger, and differs from the
+    // indefinite-length encoding only in the lengths of constructed elements,
+    // and that encoding to a 'bsl::vector<char>' yields the same octets as
+    // encoding to a stream buffer.  Use the specified 'line' to identify
+    // failures.
+{
+    balber::BerEncoderOptions indefiniteOptions;
+    balber::BerEncoderOptions definiteOptions;
+    definiteOptions.setEncodeDefiniteLength(true);
+
+    balber::BerEncoder indefiniteEncoder(&indefiniteOptions);
+    balber::BerEncoder definiteEncoder(&definiteOptions);
+
+    bdlsb::MemOutStreamBuf indefiniteOsb;
+    bdlsb::MemOutStreamBuf definiteOsb;
+
+    ASSERTV(line, 0 == indefiniteEncoder.encode(&indefiniteOsb, value));
+    ASSERTV(line, 0 == definiteEncoder.encode(&definiteOsb, value));
+    printDiagnostic(definiteEncoder);
+
+    if (veryVerbose) {
+        P(line)
+        printBuffer(indefiniteOsb.data(),
+                    static_cast<int>(indefiniteOsb.length()));
+        printBuffer(definiteOsb.data(),
+                    static_cast<int>(definiteOsb.length()));
+    }
+
+    bsl::string indefiniteEvents;
+    bsl::string definiteEvents;
+    bool        indefiniteHasIndefiniteLength;
+    bool        definiteHasIndefiniteLength;
+
+    ASSERTV(line, 0 == flattenEncoding(
+                                 &indefiniteEvents,
+                                 &indefiniteHasIndefiniteLength,
+                                 indefiniteOsb.data(),
+                                 static_cast<int>(indefiniteOsb.length())));
+    ASSERTV(line, 0 == flattenEncoding(
+                                   &definiteEvents,
+                                   &definiteHasIndefiniteLength,
+                                   definiteOsb.data(),
+                                   static_cast<int>(definiteOsb.length())));
+
+    ASSERTV(line, indefiniteHasIndefiniteLength);
+    ASSERTV(line, !definiteHasIndefiniteLength);
+    ASSERTV(line, indefiniteEvents == definiteEvents);
+    ASSERTV(line, indefiniteOsb.length(), definiteOsb.length(),
+            definiteOsb.length() <= indefiniteOsb.length());
+
+    bsl::vector<char> indefiniteBuffer(1, 'x');
+    bsl::vector<char> definiteBuffer(1, 'x');
+
+    ASSERTV(line, 0 == indefiniteEncoder.encode(&indefiniteBuffer, value));
+    ASSERTV(line, 0 == definiteEncoder.encode(&definiteBuffer, value));
+
+    ASSERTV(line, indefiniteOsb.length() == indefiniteBuffer.size());
+    ASSERTV(line, 0 == memcmp(indefiniteOsb.data(),
+                              indefiniteBuffer.data(),
+                              indefiniteOsb.length()));
+    ASSERTV(line, definiteOsb.length() == definiteBuffer.size());
+    ASSERTV(line, 0 == memcmp(definiteOsb.data(),
+                              definiteBuffer.data(),
+                              definiteOsb.length()));
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -813,7 +1014,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -837,6 +1038,203 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING DEFINITE-LENGTH ENCODING
+        //
+        // Concerns:
+        //: 1 If the 'encodeDefiniteLength' option is set, every constructed
+        //:   element is encoded with its definite length, and no
+        //:   end-of-contents octets are written.
+        //:
+        //: 2 The definite-length encoding differs from the indefinite-length
+        //:   encoding only in the lengths of constructed elements, for every
+        //:   kind of constructed element (sequence, choice, untagged choice,
+        //:   nillable value, and array), however deeply nested, and for
+        //:   lengths requiring the long form.
+        //:
+        //: 3 The definite-length encoding is no larger than the
+        //:   indefinite-length encoding.
+        //:
+        //: 4 If the encoding fails, nothing is written.
+        //:
+        //: 5 An encoder can be reused, with the option changed between uses.
+        //:
+        //: 6 Encoding to a 'bsl::vector<char>' yields the same octets as
+        //:   encoding to a stream buffer, with, and without, the option, and
+        //:   leaves the vector empty on failure.
+        //
+        // Plan:
+        //: 1 Encode a simple sequence, and compare the result with the
+        //:   expected octets.  (C-1)
+        //:
+        //: 2 For a set of values, encode each with, and without, the option,
+        //:   and compare descriptions of the two encodings that do not depend
+        //:   on how the lengths of constructed elements are encoded.  Verify
+        //:   that the definite-length encoding has no indefinite lengths, and
+        //:   is no larger.  Encode each also to a 'bsl::vector<char>', and
+        //:   compare the octets.  (C-1..3, 6)
+        //:
+        //: 3 Encode an unselected choice with both the
+        //:   'disableUnselectedChoiceEncoding' and 'encodeDefiniteLength'
+        //:   options set, and verify that the encoding fails, and that the
+        //:   stream buffer, or vector, is empty.  (C-4, 6)
+        //:
+        //: 4 Encode a value with one encoder, toggling the option between
+        //:   encodings, and verify the results.  (C-5)
+        //
+        // Testing:
+        //   BerEncoderOptions::encodeDefiniteLength
+        //   int encode(bsl::vector<char> *buffer, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING DEFINITE-LENGTH ENCODING"
+                               << "\n================================"
+                               << bsl::endl;
+
+        if (verbose) bsl::cout << "\nTesting expected octets." << bsl::endl;
+        {
+            const char *INDEFINITE = "30 80 80 01 22 81 05 48656c6c6f 0000";
+            const char *DEFINITE   = "30 0a 80 01 22 81 05 48656c6c6f";
+
+            test::MySequence value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            balber::BerEncoderOptions options;
+            balber::BerEncoder        encoder(&options);
+
+            bdlsb::MemOutStreamBuf osb1;
+            ASSERT(0 == encoder.encode(&osb1, value));
+            ASSERTV(osb1.length(),
+                    numOctets(INDEFINITE) == (int)osb1.length());
+            ASSERT(0 == compareBuffers(osb1.data(), INDEFINITE));
+
+            options.setEncodeDefiniteLength(true);
+
+            bdlsb::MemOutStreamBuf osb2;
+            ASSERT(0 == encoder.encode(&osb2, value));
+            ASSERTV(osb2.length(), numOctets(DEFINITE) == (int)osb2.length());
+            ASSERT(0 == compareBuffers(osb2.data(), DEFINITE));
+
+            options.setEncodeDefiniteLength(false);
+
+            bdlsb::MemOutStreamBuf osb3;
+            ASSERT(0 == encoder.encode(&osb3, value));
+            ASSERT(osb1.length() == osb3.length());
+            ASSERT(0 == memcmp(osb1.data(), osb3.data(), osb1.length()));
+
+            if (veryVerbose) {
+                printBuffer(osb1.data(), static_cast<int>(osb1.length()));
+                printBuffer(osb2.data(), static_cast<int>(osb2.length()));
+            }
+        }
+
+        if (verbose) bsl::cout << "\nTesting constructed elements."
+                               << bsl::endl;
+        {
+            test::MySequence sequence;
+            sequence.attribute1() = 34;
+            sequence.attribute2() = "Hello";
+            testDefiniteLength(L_, sequence);
+
+            test::MyChoice unselectedChoice;
+            testDefiniteLength(L_, unselectedChoice);
+
+            test::MyChoice choice;
+            choice.makeSelection2("World!");
+            testDefiniteLength(L_, choice);
+
+            test::MySequenceWithAnonymousChoice anonymousChoice;
+            anonymousChoice.attribute1() = 34;
+            anonymousChoice.choice().makeMyChoice2("World!");
+            anonymousChoice.attribute2() = "Hello";
+            testDefiniteLength(L_, anonymousChoice);
+
+            test::MySequenceWithNillable nillable;
+            nillable.attribute1() = 34;
+            nillable.attribute2() = "Hello";
+            testDefiniteLength(L_, nillable);
+
+            nillable.myNillable() = "World!";
+            testDefiniteLength(L_, nillable);
+
+            test::MySequenceWithArray array;
+            array.attribute1() = 34;
+            testDefiniteLength(L_, array);
+
+            array.attribute2().push_back("Hello");
+            array.attribute2().push_back("World!");
+            testDefiniteLength(L_, array);
+
+            test::Employee employee;
+            employee.name()                 = "Bob";
+            employee.homeAddress().street() = "Some Street";
+            employee.homeAddress().city()   = "Some City";
+            employee.homeAddress().state()  = "Some State";
+            employee.age()                  = 21;
+            testDefiniteLength(L_, employee);
+
+            test::BasicRecord basicRecord;
+            basicRecord.i1() = 11;
+            basicRecord.i2() = 22;
+            basicRecord.dt() = bdlt::DatetimeTz(
+                                      bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                     bdlt::Time(16, 30)),
+                                      0);
+            basicRecord.s()  = "The quick brown fox jumped over the lazy dog.";
+
+            // Array sizes chosen so that the contents of the enclosing
+            // elements have lengths encoded in one, two, and three octets.
+
+            const int ARRAY_SIZES[] = { 0, 1, 2, 3, 10, 100, 1000 };
+            const int NUM_ARRAY_SIZES = sizeof ARRAY_SIZES
+                                      / sizeof *ARRAY_SIZES;
+
+            for (int i = 0; i < NUM_ARRAY_SIZES; ++i) {
+                test::BigRecord bigRecord;
+                bigRecord.name() = "Big";
+                bigRecord.array().resize(ARRAY_SIZES[i], basicRecord);
+
+                test::TimingRequest request;
+                request.makeBig(bigRecord);
+                testDefiniteLength(L_, request);
+            }
+        }
+
+        if (verbose) bsl::cout << "\nTesting failure." << bsl::endl;
+        {
+            balber::BerEncoderOptions options;
+            options.setDisableUnselectedChoiceEncoding(true);
+            options.setEncodeDefiniteLength(true);
+
+            test::MySequenceWithAnonymousChoice value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            balber::BerEncoder     encoder(&options);
+            bdlsb::MemOutStreamBuf osb;
+
+            ASSERT(0 != encoder.encode(&osb, value));
+            ASSERT(0 == osb.length());
+            printDiagnostic(encoder);
+
+            bsl::vector<char> buffer(1, 'x');
+
+            ASSERT(0 != encoder.encode(&buffer, value));
+            ASSERT(buffer.empty());
+
+            value.choice().makeMyChoice1(58);
+
+            ASSERT(0 == encoder.encode(&osb, value));
+            ASSERT(0 <  osb.length());
+
+            ASSERT(0 == encoder.encode(&buffer, value));
+            ASSERT(osb.length() == buffer.size());
+        }
+
+        if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
@@ -3888,6 +4286,51 @@ int main(int argc, char *argv[])
                   << elapsed          << " seconds, "
                   << (reps / elapsed) << " reps/sec, "
                   << osb.length()     << " bytes" << bsl::endl;
+
+        // Measure definite-length ber encoding times:
+        balber::BerEncoderOptions options;
+        options.setEncodeDefiniteLength(true);
+
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            osb.pubseekpos(0);
+            balber::BerEncoder encoder(&options);
+            encoder.encode(&osb, request);
+        }
+        stopwatch.stop();
+
+        ASSERT(minOutputSize     <= (int)osb.length());
+        ASSERT((int)osb.length() <= MAX_BUF_SIZE);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
+
+        bsl::cout << "    balber::BerEncoder (definite length): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec, "
+                  << osb.length()     << " bytes" << bsl::endl;
+
+        // Measure definite-length ber encoding times to a vector sized by
+        // the sizing pass:
+        bsl::vector<char> buffer;
+        buffer.reserve(MAX_BUF_SIZE);
+
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            balber::BerEncoder encoder(&options);
+            encoder.encode(&buffer, request);
+        }
+        stopwatch.stop();
+
+        ASSERT(osb.length() == buffer.size());
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
+
+        bsl::cout << "    balber::BerEncoder (definite length, vector): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec, "
+                  << buffer.size()    << " bytes" << bsl::endl;
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
@@ -44,6 +44,7 @@ using namespace bsl;
 //: o 'setEncodeDateAndTimeTypesAsBinary'
 //: o 'setDatetimeFractionalSecondPrecision'
 //: o 'setDisableUnselectedChoiceEncoding'
+//: o 'setEncodeDefiniteLength'
 //
 // Basic Accessors:
 //: o 'traceLevel'
@@ -52,6 +53,7 @@ using namespace bsl;
 //: o 'encodeDateAndTimeTypesAsBinary'
 //: o 'datetimeFractionalSecondPrecision'
 //: o 'disableUnselectedChoiceEncoding'
+//: o 'encodeDefiniteLength'
 //
 // Certain standard value-semantic-type test cases are omitted:
 //: o [ 8] -- 'swap' is not implemented for this class.
@@ -81,6 +83,7 @@ using namespace bsl;
 // [ 3] setEncodeDateAndTimeTypesAsBinary(bool value);
 // [ 3] setDatetimeFractionalSecondPrecision(int value);
 // [ 3] setDisableUnselectedChoiceEncoding(bool value);
+// [ 3] setEncodeDefiniteLength(bool value);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -236,6 +239,7 @@ int main(int argc, char *argv[])
     const bool ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = true;
     const int  DATETIME_FRACTIONAL_SECOND_PRECISION = 6;
     const bool DISABLE_UNSELECTED_CHOICE_ENCODING   = true;
+    const bool ENCODE_DEFINITE_LENGTH               = true;
 
     balber::BerEncoderOptions options;
     ASSERT(0 == options.traceLevel());
@@ -244,6 +248,7 @@ int main(int argc, char *argv[])
     ASSERT(false == options.encodeDateAndTimeTypesAsBinary());
     ASSERT(3     == options.datetimeFractionalSecondPrecision());
     ASSERT(false == options.disableUnselectedChoiceEncoding());
+    ASSERT(false == options.encodeDefiniteLength());
 //..
 // Next, we populate that object to with non-default values:
 //..
@@ -265,6 +270,9 @@ int main(int argc, char *argv[])
     options.setDisableUnselectedChoiceEncoding(DISABLE_UNSELECTED_CHOICE_ENCODING);
     ASSERT(DISABLE_UNSELECTED_CHOICE_ENCODING == options.disableUnselectedChoiceEncoding());
 
+    options.setEncodeDefiniteLength(ENCODE_DEFINITE_LENGTH);
+    ASSERT(ENCODE_DEFINITE_LENGTH == options.encodeDefiniteLength());
+
 //..
       } break;
       case 10: {
@@ -612,6 +620,7 @@ int main(int argc, char *argv[])
         //   bool  encodeDateAndTimeTypesAsBinary() const;
         //   int   datetimeFractionalSecondPrecision() const;
         //   bool  disableUnselectedChoiceEncoding() const;
+        //   bool  encodeDefiniteLength() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -666,6 +675,7 @@ int main(int argc, char *argv[])
         //   setEncodeDateAndTimeTypesAsBinary(bool value);
         //   setDatetimeFractionalSecondPrecision(int value);
         //   setDisableUnselectedChoiceEncoding(bool value);
+        //   setEncodeDefiniteLength(bool value);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -705,6 +715,7 @@ int main(int argc, char *argv[])
         const bool  D4   = false;        // 'encodeDateAndTimeTypesAsBinary'
         const int   D5   = 3;            // 'datetimeFractionalSecondPrecision'
         const int   D6   = false;        // 'disableUnselectedChoiceEncoding'
+        const bool  D7   = false;        // 'encodeDefiniteLength'
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -726,6 +737,8 @@ int main(int argc, char *argv[])
                      D5 == X.datetimeFractionalSecondPrecision());
         LOOP2_ASSERT(D6, X.disableUnselectedChoiceEncoding(),
                      D6 == X.disableUnselectedChoiceEncoding());
+        LOOP2_ASSERT(D7, X.encodeDefiniteLength(),
+                     D7 == X.encodeDefiniteLength());
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -763,6 +776,7 @@ int main(int argc, char *argv[])
         typedef bool  T4;        // 'encodeDateAndTimeTypesAsBinary'
         typedef int   T5;        // 'datetimeFractionalSecondPrecision'
         typedef int   T6;        // 'disableUnselectedChoiceEncoding'
+        typedef bool  T7;        // 'encodeDefiniteLength'
 
         // Attribute 1 Values: 'traceLevel'
 
@@ -794,6 +808,11 @@ int main(int argc, char *argv[])
         const T6 D6 = false;    // default value
         const T6 A6 = true;
 
+        // Attribute 7 Values: 'encodeDefiniteLength'
+
+        const T7 D7 = false;    // default value
+        const T7 A7 = true;
+
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
         if (verbose) cout << "\n 1. Create an object 'w' (default ctor)."
@@ -810,6 +829,7 @@ int main(int argc, char *argv[])
         ASSERT(D4 == W.encodeDateAndTimeTypesAsBinary());
         ASSERT(D5 == W.datetimeFractionalSecondPrecision());
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
+        ASSERT(D7 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                   "\tb. Try equality operators: 'w' <op> 'w'." << endl;
@@ -832,6 +852,7 @@ int main(int argc, char *argv[])
         ASSERT(D4 == X.encodeDateAndTimeTypesAsBinary());
         ASSERT(D5 == X.datetimeFractionalSecondPrecision());
         ASSERT(D6 == X.disableUnselectedChoiceEncoding());
+        ASSERT(D7 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                    "\tb. Try equality operators: 'x' <op> 'w', 'x'." << endl;
@@ -850,6 +871,7 @@ int main(int argc, char *argv[])
         mX.setEncodeDateAndTimeTypesAsBinary(A4);
         mX.setDatetimeFractionalSecondPrecision(A5);
         mX.setDisableUnselectedChoiceEncoding(A6);
+        mX.setEncodeDefiniteLength(A7);
 
         if (veryVerbose) cout << "\ta. Check new value of 'x'." << endl;
         if (veryVeryVerbose) { T_ T_ P(X) }
@@ -860,6 +882,7 @@ int main(int argc, char *argv[])
         ASSERT(A4 == X.encodeDateAndTimeTypesAsBinary());
         ASSERT(A5 == X.datetimeFractionalSecondPrecision());
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
+        ASSERT(A7 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: 'x' <op> 'w', 'x'." << endl;
@@ -879,6 +902,7 @@ int main(int argc, char *argv[])
         mY.setEncodeDateAndTimeTypesAsBinary(A4);
         mY.setDatetimeFractionalSecondPrecision(A5);
         mY.setDisableUnselectedChoiceEncoding(A6);
+        mY.setEncodeDefiniteLength(A7);
 
         if (veryVerbose) cout << "\ta. Check initial value of 'y'." << endl;
         if (veryVeryVerbose) { T_ T_ P(Y) }
@@ -889,6 +913,7 @@ int main(int argc, char *argv[])
         ASSERT(A4 == X.encodeDateAndTimeTypesAsBinary());
         ASSERT(A5 == Y.datetimeFractionalSecondPrecision());
         ASSERT(A6 == Y.disableUnselectedChoiceEncoding());
+        ASSERT(A7 == Y.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: 'y' <op> 'w', 'x', 'y'" << endl;
@@ -913,6 +938,7 @@ int main(int argc, char *argv[])
         ASSERT(A4 == Z.encodeDateAndTimeTypesAsBinary());
         ASSERT(A5 == Z.datetimeFractionalSecondPrecision());
         ASSERT(A6 == Z.disableUnselectedChoiceEncoding());
+        ASSERT(A7 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'z' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -933,6 +959,7 @@ int main(int argc, char *argv[])
         mZ.setEncodeDateAndTimeTypesAsBinary(D4);
         mZ.setDatetimeFractionalSecondPrecision(D5);
         mZ.setDisableUnselectedChoiceEncoding(D6);
+        mZ.setEncodeDefiniteLength(D7);
 
         if (veryVerbose) cout << "\ta. Check new value of 'z'." << endl;
         if (veryVeryVerbose) { T_ T_ P(Z) }
@@ -943,6 +970,7 @@ int main(int argc, char *argv[])
         ASSERT(D4 == Z.encodeDateAndTimeTypesAsBinary());
         ASSERT(D5 == Z.datetimeFractionalSecondPrecision());
         ASSERT(D6 == Z.disableUnselectedChoiceEncoding());
+        ASSERT(D7 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'z' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -967,6 +995,7 @@ int main(int argc, char *argv[])
         ASSERT(A4 == W.encodeDateAndTimeTypesAsBinary());
         ASSERT(A5 == W.datetimeFractionalSecondPrecision());
         ASSERT(A6 == W.disableUnselectedChoiceEncoding());
+        ASSERT(A7 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'w' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -991,6 +1020,7 @@ int main(int argc, char *argv[])
         ASSERT(D4 == W.encodeDateAndTimeTypesAsBinary());
         ASSERT(D5 == W.datetimeFractionalSecondPrecision());
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
+        ASSERT(D7 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'x' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -1015,6 +1045,7 @@ int main(int argc, char *argv[])
         ASSERT(A4 == X.encodeDateAndTimeTypesAsBinary());
         ASSERT(A5 == X.datetimeFractionalSecondPrecision());
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
+        ASSERT(A7 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'x' <op> 'w', 'x', 'y', 'z'." << endl;
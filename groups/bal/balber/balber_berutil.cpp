@@ -970,6 +970,33 @@ int BerUtil_FloatingPointImpUtil::putDoubleValue(bsl::streambuf *streamBuf,
                : SUCCESS;
 }
 
+int BerUtil_FloatingPointImpUtil::numDoubleValueOctets(double value)
+{
+    if (0.0 == value) {
+        return 1;                                                     // RETURN
+    }
+
+    int       exponent, sign;
+    long long mantissa;
+
+    parseDouble(&exponent, &mantissa, &sign, value);
+
+    if (k_DOUBLE_INFINITY_EXPONENT_ID == exponent) {
+        // Infinities and NaN are a length octet and a single contents octet.
+
+        return 2;                                                     // RETURN
+    }
+
+    normalizeMantissaAndAdjustExp(&mantissa, &exponent, 0 == exponent);
+
+    exponent -= k_DOUBLE_BIAS;
+
+    // One length octet, one octet of flags, then the exponent and mantissa.
+
+    return 2 + IntegerUtil::getNumOctetsToStream(exponent)
+             + IntegerUtil::getNumOctetsToStream(mantissa);
+}
+
                         // ----------------------------
                         // struct BerUtil_StringImpUtil
                         // ----------------------------
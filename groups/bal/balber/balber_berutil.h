@@ -108,6 +108,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bslmf_assert.h>
 
 #include <bsla_nodiscard.h>
@@ -205,6 +207,28 @@ struct BerUtil {
         // contents primitives.  Also note that only fundamental C++ types,
         // 'bsl::string', and BDE date/time types are supported.
 
+    static int numIdentifierOctets(int tagNumber);
+        // Return the number of identifier octets that 'putIdentifierOctets'
+        // encodes for the specified 'tagNumber'.  The behavior is undefined
+        // unless '0 <= tagNumber'.
+
+    static int numLengthOctets(int length);
+        // Return the number of length octets that 'putLength' encodes for the
+        // specified 'length'.  The behavior is undefined unless
+        // '0 <= length'.
+
+    template <typename TYPE>
+    static int numValueOctets(const TYPE&              value,
+                              const BerEncoderOptions *options = 0);
+        // Return the number of octets that 'putValue' encodes for the
+        // specified 'value' using the optionally specified 'options', or a
+        // negative value if 'putValue' cannot encode 'value'.  Note that the
+        // value consists of the length and contents primitives.  Also note
+        // that the number is computed without encoding 'value', unless it is a
+        // date or time value that 'options' selects a binary encoding for.
+        // Also note that the validity of a date or time value, which can be
+        // invalid only in optimized build modes, is not checked.
+
     static int putEndOfContentOctets(bsl::streambuf *streamBuf);
         // Encode the "end-of-content" octets (two consecutive zero-octets) to
         // the specified 'streamBuf'.  The "end-of-content" octets act as the
@@ -389,6 +413,11 @@ struct BerUtil_IdentifierImpUtil {
         // Encode the identifier octets for the specified 'tagClass', 'tagType'
         // and 'tagNumber', in that order, to the specified 'streamBuf'.
         // Return 0 on success, and a non-zero value otherwise.
+
+    static int numIdentifierOctets(int tagNumber);
+        // Return the number of identifier octets that 'putIdentifierOctets'
+        // encodes for the specified 'tagNumber'.  The behavior is undefined
+        // unless '0 <= tagNumber'.
 };
 
                       // ================================
@@ -504,6 +533,11 @@ struct BerUtil_LengthImpUtil {
         // Encode the identifier octets for the specified 'tagClass', 'tagType'
         // and 'tagNumber' to the specified 'streamBuf'.  Return 0 on success,
         // and a non-zero value otherwise.
+
+    static int numLengthOctets(int length);
+        // Return the number of length octets that 'putLength' encodes for the
+        // specified 'length'.  The behavior is undefined unless
+        // '0 <= length'.
 };
 
                        // =============================
@@ -970,6 +1004,10 @@ struct BerUtil_FloatingPointImpUtil {
         // the write position becoming unavailable.  See the package-level
         // documentation of {'balber'} for the definition of the format used to
         // encode 64-bit decimal values.
+
+    static int numDoubleValueOctets(double value);
+        // Return the number of length and contents octets that
+        // 'putDoubleValue' writes for the specified 'value'.
 };
 
                         // ============================
@@ -1100,6 +1138,11 @@ struct BerUtil_Iso8601ImpUtil {
     static int putValue(bsl::streambuf          *streamBuf,
                         const TYPE&              value,
                         const BerEncoderOptions *options);
+
+    static int numFractionalSecondChars(const BerEncoderOptions *options);
+        // Return the number of characters of the fractional seconds, including
+        // the decimal point, of the ISO 8601 representation of a time value
+        // that 'putValue' writes using the specified 'options'.
         // Write the ISO 8601 representation of the specified 'value' to the
         // output sequence of the specified 'streamBuf'.  If the specified
         // 'options' is 0, use 3 decimal places of fractional second precision,
@@ -1261,6 +1304,26 @@ struct BerUtil_Iso8601ImpUtil {
         // succeeds if all bytes of the ISO 8601 representation of the 'value'
         // are written to the 'streamBuf' without the write position becoming
         // unavailable.
+
+    // Sizing
+
+    static int numValueOctets(const bdlt::Date&        value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::DateTz&      value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::Datetime&    value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::DatetimeTz&  value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::Time&        value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::TimeTz&      value,
+                              const BerEncoderOptions *options);
+        // Return the number of length and contents octets of the ISO 8601
+        // representation of the specified 'value' that the corresponding
+        // 'put...Value' function writes using the specified 'options'.  Note
+        // that this number depends only on the type of 'value' and on the
+        // fractional second precision selected by 'options'.
 };
 
                     // ====================================
@@ -3709,6 +3772,11 @@ struct BerUtil_PutValueImpUtil {
         // used by 'BerUtil' to implement BER encoding and decoding operations
         // for date and time values.
 
+    typedef BerUtil_ExtendedBinaryEncodingUtil ExtendedBinaryEncodingUtil;
+        // 'ExtendedBinaryEncodingUtil' is an alias to a namespace for a suite
+        // of functions used to determine whether date and time values are
+        // encoded in a binary format.
+
     typedef BerUtil_FloatingPointImpUtil FloatingPointUtil;
         // 'FloatingPointUtil' is an alias to a namespace for a suite of
         // functions used by 'BerUtil' to implement BER encoding and decoding
@@ -3719,6 +3787,16 @@ struct BerUtil_PutValueImpUtil {
         // used by 'BerUtil' to implement BER encoding and decoding operations
         // for integer values.
 
+    typedef BerUtil_Iso8601ImpUtil Iso8601Util;
+        // 'Iso8601Util' is an alias to a namespace for a suite of functions
+        // used to implement BER encoding and decoding operations for date and
+        // time values in the ISO 8601 format.
+
+    typedef BerUtil_LengthImpUtil LengthUtil;
+        // 'LengthUtil' is an alias to a namespace for a suite of functions
+        // used to implement BER encoding and decoding operations for length
+        // quantities.
+
     typedef BerUtil_StringImpUtil StringUtil;
         // 'StringUtil' is an alias to a namespace for a suite of functions
         // used by 'BerUtil' to implement BER encoding and decoding operations
@@ -3784,6 +3862,54 @@ struct BerUtil_PutValueImpUtil {
         // consists of the length and contents primitives.  Also note that only
         // fundamental C++ types, 'bsl::string', 'bslstl::StringRef' and BDE
         // date/time types are supported.
+
+    template <typename TYPE>
+    static int numValueOctets(const TYPE&              value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(bool                     value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(char                     value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(unsigned char            value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(signed char              value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(float                    value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(double                   value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(bdldfp::Decimal64        value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bsl::string&       value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bslstl::StringRef& value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::Date&        value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::DateTz&      value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::Datetime&    value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::DatetimeTz&  value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::Time&        value,
+                              const BerEncoderOptions *options);
+    static int numValueOctets(const bdlt::TimeTz&      value,
+                              const BerEncoderOptions *options);
+        // Return the number of octets that 'putValue' encodes for the
+        // specified 'value' using the specified 'options', or a negative value
+        // if 'putValue' cannot encode 'value'.  Note that the number is
+        // computed without encoding 'value', unless it is a date or time value
+        // that 'options' selects a binary encoding for.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <typename TYPE>
+    static int numEncodedOctets(const TYPE&              value,
+                                const BerEncoderOptions *options);
+        // Return the number of octets that 'putValue' writes to a local
+        // buffer to encode the specified 'value' using the specified
+        // 'options', or a negative value if it fails.
 };
 
                              // ==================
@@ -3866,6 +3992,26 @@ int BerUtil::getValue(bsl::streambuf           *streamBuf,
     return 0;
 }
 
+inline
+int BerUtil::numIdentifierOctets(int tagNumber)
+{
+    return BerUtil_IdentifierImpUtil::numIdentifierOctets(tagNumber);
+}
+
+inline
+int BerUtil::numLengthOctets(int length)
+{
+    return BerUtil_LengthImpUtil::numLengthOctets(length);
+}
+
+template <typename TYPE>
+inline
+int BerUtil::numValueOctets(const TYPE&              value,
+                            const BerEncoderOptions *options)
+{
+    return BerUtil_PutValueImpUtil::numValueOctets(value, options);
+}
+
 inline
 int BerUtil::putEndOfContentOctets(bsl::streambuf *streamBuf)
 {
@@ -3940,6 +4086,31 @@ int BerUtil_StreambufUtil::putChars(bsl::streambuf *streamBuf,
     return 0;
 }
 
+                      // --------------------------------
+                      // struct BerUtil_IdentifierImpUtil
+                      // --------------------------------
+
+// CLASS METHODS
+inline
+int BerUtil_IdentifierImpUtil::numIdentifierOctets(int tagNumber)
+{
+    BSLS_ASSERT(0 <= tagNumber);
+
+    if (tagNumber <= k_MAX_TAG_NUMBER_IN_ONE_OCTET) {
+        return 1;                                                     // RETURN
+    }
+
+    // One octet for the class and type, then the tag number in 7-bit groups.
+
+    int numOctets = 1;
+    do {
+        ++numOctets;
+        tagNumber >>= k_NUM_VALUE_BITS_IN_TAG_OCTET;
+    } while (tagNumber);
+
+    return numOctets;
+}
+
                       // --------------------------------
                       // struct BerUtil_RawIntegerImpUtil
                       // --------------------------------
@@ -4003,6 +4174,31 @@ int BerUtil_RawIntegerImpUtil::putIntegerGivenLength(bsl::streambuf *streamBuf,
 #endif
 }
 
+                        // ----------------------------
+                        // struct BerUtil_LengthImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+inline
+int BerUtil_LengthImpUtil::numLengthOctets(int length)
+{
+    BSLS_ASSERT(0 <= length);
+
+    if (length <= 127) {
+        return 1;                                                     // RETURN
+    }
+
+    // One octet for the number of octets, then the length in 8-bit groups.
+
+    int numOctets = 1;
+    do {
+        ++numOctets;
+        length >>= Constants::k_NUM_BITS_PER_OCTET;
+    } while (length);
+
+    return numOctets;
+}
+
                        // -----------------------------
                        // struct BerUtil_BooleanImpUtil
                        // -----------------------------
@@ -4483,6 +4679,67 @@ int BerUtil_Iso8601ImpUtil::putValue(bsl::streambuf          *streamBuf,
                                          bslstl::StringRef(buf, len));
 }
 
+inline
+int BerUtil_Iso8601ImpUtil::numFractionalSecondChars(
+                                              const BerEncoderOptions *options)
+{
+    const int precision =
+                   options ? options->datetimeFractionalSecondPrecision() : 6;
+
+    return precision ? 1 + precision : 0;
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::Date&,
+                                           const BerEncoderOptions *)
+{
+    // Every ISO 8601 representation is shorter than 128 characters, so its
+    // length is encoded in one octet.
+
+    return 1 + bdlt::Iso8601Util::k_DATE_STRLEN;
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::DateTz&,
+                                           const BerEncoderOptions *)
+{
+    return 1 + bdlt::Iso8601Util::k_DATETZ_STRLEN;
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::Datetime&,
+                                           const BerEncoderOptions *options)
+{
+    // The '..._STRLEN' constants include 7 characters of fractional seconds.
+
+    return 1 + bdlt::Iso8601Util::k_DATETIME_STRLEN - 7
+             + numFractionalSecondChars(options);
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::DatetimeTz&,
+                                           const BerEncoderOptions *options)
+{
+    return 1 + bdlt::Iso8601Util::k_DATETIMETZ_STRLEN - 7
+             + numFractionalSecondChars(options);
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::Time&,
+                                           const BerEncoderOptions *options)
+{
+    return 1 + bdlt::Iso8601Util::k_TIME_STRLEN - 7
+             + numFractionalSecondChars(options);
+}
+
+inline
+int BerUtil_Iso8601ImpUtil::numValueOctets(const bdlt::TimeTz&,
+                                           const BerEncoderOptions *options)
+{
+    return 1 + bdlt::Iso8601Util::k_TIMETZ_STRLEN - 7
+             + numFractionalSecondChars(options);
+}
+
                  // --------------------------------------
                  // struct BerUtil_ExtendedBinaryEncodingUtil
                  // --------------------------------------
@@ -6523,6 +6780,165 @@ int BerUtil_PutValueImpUtil::putValue(bsl::streambuf          *streamBuf,
     return TimeUtil::putTimeTzValue(streamBuf, value, options);
 }
 
+template <typename TYPE>
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const TYPE&              value,
+                                            const BerEncoderOptions *)
+{
+    return 1 + IntegerUtil::getNumOctetsToStream(value);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(bool,
+                                            const BerEncoderOptions *)
+{
+    return 2;
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(char,
+                                            const BerEncoderOptions *)
+{
+    return 2;
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(unsigned char            value,
+                                            const BerEncoderOptions *)
+{
+    return 1 + IntegerUtil::getNumOctetsToStream(
+                                           static_cast<unsigned short>(value));
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(signed char,
+                                            const BerEncoderOptions *)
+{
+    return 2;
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(float                    value,
+                                            const BerEncoderOptions *)
+{
+    return FloatingPointUtil::numDoubleValueOctets(static_cast<double>(value));
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(double                   value,
+                                            const BerEncoderOptions *)
+{
+    return FloatingPointUtil::numDoubleValueOctets(value);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(bdldfp::Decimal64        value,
+                                            const BerEncoderOptions *options)
+{
+    return numEncodedOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bsl::string&       value,
+                                            const BerEncoderOptions *)
+{
+    const int length = static_cast<int>(value.length());
+    return LengthUtil::numLengthOctets(length) + length;
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bslstl::StringRef& value,
+                                            const BerEncoderOptions *)
+{
+    const int length = static_cast<int>(value.length());
+    return LengthUtil::numLengthOctets(length) + length;
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::Date&        value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::DateTz&      value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::Datetime&    value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::DatetimeTz&  value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::Time&        value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+inline
+int BerUtil_PutValueImpUtil::numValueOctets(const bdlt::TimeTz&      value,
+                                            const BerEncoderOptions *options)
+{
+    if (ExtendedBinaryEncodingUtil::useBinaryEncoding(options)) {
+        return numEncodedOctets(value, options);                      // RETURN
+    }
+
+    return Iso8601Util::numValueOctets(value, options);
+}
+
+// PRIVATE CLASS METHODS
+template <typename TYPE>
+int BerUtil_PutValueImpUtil::numEncodedOctets(
+                                              const TYPE&              value,
+                                              const BerEncoderOptions *options)
+{
+    // The encodings of these types are short: the longest is an ISO 8601
+    // string, preceded by a single length octet.
+
+    char                       buffer[1 + bdlt::Iso8601Util::k_MAX_STRLEN];
+    bdlsb::FixedMemOutStreamBuf streamBuf(buffer, sizeof buffer);
+
+    if (0 != putValue(&streamBuf, value, options)) {
+        return -1;                                                    // RETURN
+    }
+
+    return static_cast<int>(streamBuf.length());
+}
+
                              // ------------------
                              // struct BerUtil_Imp
                              // ------------------
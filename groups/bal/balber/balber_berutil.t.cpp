@@ -109,6 +109,9 @@ using namespace bsl;
 // [12] int getLength(bsl::streambuf *, int *result, int *nBytes);
 // [23] int getValue(bsl::streambuf *, TYPE *, int length, const Options&);
 // [23] int getValue(bsl::streambuf *, TYPE *, int *nBytes, const Options&);
+// [30] int numIdentifierOctets(int tagNumber);
+// [30] int numLengthOctets(int length);
+// [30] int numValueOctets(const TYPE& value, const Options * = 0);
 // [16] int putEndOfContentOctets(bsl::streambuf *);
 // [17] int putIdentifierOctets(bsl::streambuf *, cls *, ty *, int tag);
 // [16] int putIndefiniteLengthOctet(bsl::streambuf *);
@@ -138,6 +141,7 @@ using namespace bsl;
 // [27] CONCERN: 'getValue' reports all failures to read from stream buffer
 // [28] CONCERN: 'put'- & 'getValue' for date/time types in extended binary fmt
 // [29] CONCERN: 'putValue' encoding formation selection
+// [31] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -421,6 +425,13 @@ struct TestUtil {
         // 'value' does not encode to the bytes specified by
         // 'hexadecimalExpression', load an unspecified, human-readable
         // description of the error condition to the specified 'log'.
+
+    template <class TYPE>
+    static int numPutValueOctets(const TYPE&                      value,
+                                 const balber::BerEncoderOptions *options);
+        // Return the number of octets that 'balber::BerUtil::putValue'
+        // writes to encode the specified 'value' using the specified
+        // 'options', or -1 if it fails.
 };
 
 
@@ -1912,6 +1923,18 @@ bool TestUtil::valueEncodesToBytes(
     return true;
 }
 
+template <class TYPE>
+int TestUtil::numPutValueOctets(const TYPE&                      value,
+                                const balber::BerEncoderOptions *options)
+{
+    bdlsb::MemOutStreamBuf osb;
+    if (0 != balber::BerUtil::putValue(&osb, value, options)) {
+        return -1;                                                    // RETURN
+    }
+
+    return static_cast<int>(osb.length());
+}
+
                              // ------------------
                              // class Case27Tester
                              // ------------------
@@ -5309,7 +5332,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -5391,6 +5414,194 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'numIdentifierOctets', 'numLengthOctets', 'numValueOctets'
+        //
+        // Concerns:
+        //: 1 'numIdentifierOctets' returns the number of octets that
+        //:   'putIdentifierOctets' writes for a tag number, for each number
+        //:   of octets.
+        //:
+        //: 2 'numLengthOctets' returns the number of octets that 'putLength'
+        //:   writes for a length, for each number of octets.
+        //:
+        //: 3 'numValueOctets' returns the number of octets that 'putValue'
+        //:   writes for a value of each supported type, including the
+        //:   boundaries between the numbers of octets of integers, and the
+        //:   special values of floating-point types.
+        //:
+        //: 4 'numValueOctets' respects the options that select the encoding,
+        //:   and the fractional second precision, of date and time types.
+        //
+        // Plan:
+        //: 1 For tag numbers and lengths around each power of 2, compare the
+        //:   result of 'numIdentifierOctets' and 'numLengthOctets' to the
+        //:   length of the output of 'putIdentifierOctets' and 'putLength'.
+        //:   (C-1..2)
+        //:
+        //: 2 For values of each supported type, including integers around
+        //:   each power of 2, compare the result of 'numValueOctets' to the
+        //:   length of the output of 'putValue', with and without options
+        //:   that select binary and extended-binary encodings of date and time
+        //:   types, and ISO 8601 encodings of each fractional second
+        //:   precision.  (C-3..4)
+        //
+        // Testing:
+        //   int numIdentifierOctets(int tagNumber);
+        //   int numLengthOctets(int length);
+        //   int numValueOctets(const TYPE& value, const Options * = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'numIdentifierOctets', "
+                             "'numLengthOctets', 'numValueOctets'"
+                          << "\n================================"
+                             "==================================" << endl;
+
+        if (verbose) cout << "\nTesting identifier and length octets." << endl;
+        {
+            for (int bit = 0; bit < 31; ++bit) {
+                for (int delta = -1; delta <= 1; ++delta) {
+                    const int VALUE = (1 << bit) + delta;
+                    if (VALUE < 0) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    bdlsb::MemOutStreamBuf osb;
+                    ASSERT(0 == Util::putIdentifierOctets(
+                                         &osb,
+                                         balber::BerConstants::e_APPLICATION,
+                                         balber::BerConstants::e_PRIMITIVE,
+                                         VALUE));
+                    LOOP2_ASSERT(VALUE,
+                                 osb.length(),
+                                 static_cast<int>(osb.length()) ==
+                                           Util::numIdentifierOctets(VALUE));
+
+                    osb.reset();
+                    ASSERT(0 == Util::putLength(&osb, VALUE));
+                    LOOP2_ASSERT(VALUE,
+                                 osb.length(),
+                                 static_cast<int>(osb.length()) ==
+                                               Util::numLengthOctets(VALUE));
+                }
+            }
+        }
+
+        balber::BerEncoderOptions binaryOptions;
+        binaryOptions.setEncodeDateAndTimeTypesAsBinary(true);
+
+        balber::BerEncoderOptions extendedOptions;
+        extendedOptions.setEncodeDateAndTimeTypesAsBinary(true);
+        extendedOptions.setDatetimeFractionalSecondPrecision(6);
+
+        balber::BerEncoderOptions millisecondOptions;
+        millisecondOptions.setDatetimeFractionalSecondPrecision(3);
+
+        balber::BerEncoderOptions microsecondOptions;
+        microsecondOptions.setDatetimeFractionalSecondPrecision(6);
+
+        const balber::BerEncoderOptions *const OPTIONS[] = {
+            0, &binaryOptions, &extendedOptions, &millisecondOptions,
+            &microsecondOptions
+        };
+        const int NUM_OPTIONS = sizeof OPTIONS / sizeof *OPTIONS;
+
+#define TEST_NUM_VALUE_OCTETS(VALUE)                                          \
+        for (int oi = 0; oi < NUM_OPTIONS; ++oi) {                            \
+            const int EXP = u::TestUtil::numPutValueOctets(VALUE,             \
+                                                           OPTIONS[oi]);      \
+            LOOP3_ASSERT(oi, EXP, Util::numValueOctets(VALUE, OPTIONS[oi]),   \
+                         EXP == Util::numValueOctets(VALUE, OPTIONS[oi]));    \
+        }
+
+        if (verbose) cout << "\nTesting integers." << endl;
+        {
+            for (int bit = 0; bit < 64; ++bit) {
+                for (int delta = -1; delta <= 1; ++delta) {
+                    const bsls::Types::Uint64 ONE = 1;
+                    const bsls::Types::Uint64 U64 = (ONE << bit) + delta;
+                    const bsls::Types::Int64  I64 = U64;
+
+                    TEST_NUM_VALUE_OCTETS(U64);
+                    TEST_NUM_VALUE_OCTETS(I64);
+                    TEST_NUM_VALUE_OCTETS(-I64);
+                    TEST_NUM_VALUE_OCTETS(static_cast<int>(I64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<int>(-I64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<unsigned int>(U64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<short>(I64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<unsigned short>(U64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<char>(I64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<signed char>(I64));
+                    TEST_NUM_VALUE_OCTETS(static_cast<unsigned char>(U64));
+                }
+            }
+            TEST_NUM_VALUE_OCTETS(true);
+            TEST_NUM_VALUE_OCTETS(false);
+        }
+
+        if (verbose) cout << "\nTesting floating-point values." << endl;
+        {
+            const double DATA[] = {
+                0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 1.5e300, -2.5e-300,
+                DBL_MIN, DBL_MAX, DBL_MIN / 4, -DBL_MIN / 1024,
+                FLT_MIN, FLT_MAX, 3.14159265358979, 1024.0, 1.0 / 3,
+                bsl::numeric_limits<double>::infinity(),
+                -bsl::numeric_limits<double>::infinity(),
+                bsl::numeric_limits<double>::quiet_NaN()
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const double VALUE = DATA[i];
+
+                TEST_NUM_VALUE_OCTETS(VALUE);
+                TEST_NUM_VALUE_OCTETS(static_cast<float>(VALUE));
+            }
+
+            bdldfp::Decimal64 (*MDF)(long long, int) =
+                                           &bdldfp::DecimalUtil::makeDecimal64;
+
+            TEST_NUM_VALUE_OCTETS(MDF(1, 0));
+            TEST_NUM_VALUE_OCTETS(MDF(0, 1));
+            TEST_NUM_VALUE_OCTETS(MDF(1 << 14, 2));
+            TEST_NUM_VALUE_OCTETS(MDF(-123456789012345LL, -300));
+        }
+
+        if (verbose) cout << "\nTesting strings." << endl;
+        {
+            const bsl::string LONG(70000, 'x');
+
+            for (int length = 0; length < 300; ++length) {
+                const bsl::string       STRING(LONG, 0, length);
+                const bslstl::StringRef REF(STRING);
+
+                TEST_NUM_VALUE_OCTETS(STRING);
+                TEST_NUM_VALUE_OCTETS(REF);
+            }
+            TEST_NUM_VALUE_OCTETS(LONG);
+            TEST_NUM_VALUE_OCTETS(bslstl::StringRef(LONG));
+        }
+
+        if (verbose) cout << "\nTesting date and time values." << endl;
+        {
+            const bdlt::Date     DATE(2020, 2, 29);
+            const bdlt::Time     TIME(23, 59, 58, 123, 456);
+            const bdlt::Datetime DATETIME(DATE, TIME);
+
+            TEST_NUM_VALUE_OCTETS(DATE);
+            TEST_NUM_VALUE_OCTETS(bdlt::Date(1, 1, 1));
+            TEST_NUM_VALUE_OCTETS(bdlt::DateTz(DATE, -90));
+            TEST_NUM_VALUE_OCTETS(TIME);
+            TEST_NUM_VALUE_OCTETS(bdlt::Time());
+            TEST_NUM_VALUE_OCTETS(bdlt::TimeTz(TIME, 600));
+            TEST_NUM_VALUE_OCTETS(DATETIME);
+            TEST_NUM_VALUE_OCTETS(bdlt::Datetime());
+            TEST_NUM_VALUE_OCTETS(bdlt::DatetimeTz(DATETIME, -1439));
+        }
+
+#undef TEST_NUM_VALUE_OCTETS
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING DATE/TIME FORMAT SELECTION
@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_decoder_cpp,"$Id$ $CSID$")
 
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_iterator.h>
 
 #include <bsls_annotation.h>
@@ -16,6 +18,69 @@ namespace baljsn {
                                // -------------
 
 // PRIVATE MANIPULATORS
+int Decoder::decodeImp(bslstl::StringRef *value,
+                       int,
+                       bdlat_TypeCategory::Simple)
+{
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+        d_logStream << "Simple element value was not found\n";
+        return -1;                                                    // RETURN
+    }
+
+    if (!d_allowStringReferences) {
+        d_logStream << "Decoding a string reference requires the "
+                    << "'allowStringReferences' option\n";
+        return -1;                                                    // RETURN
+    }
+
+    bslstl::StringRef dataValue;
+    int rc = d_tokenizer.value(&dataValue);
+    if (rc
+     || dataValue.length() < 2
+     || '"' != dataValue[0]
+     || '"' != dataValue[dataValue.length() - 1]) {
+        d_logStream << "Error reading string reference value\n";
+        return -1;                                                    // RETURN
+    }
+
+    const bslstl::StringRef content(dataValue.data() + 1,
+                                    dataValue.length() - 2);
+
+    if (0 == bsl::memchr(content.data(), '\\', content.length())) {
+        if (d_contiguousInput) {
+            // 'content' refers into the caller's buffer, which outlives this
+            // call, so it can be handed out as is.
+
+            *value = content;
+            return 0;                                                 // RETURN
+        }
+
+        char *buffer = static_cast<char *>(
+                                 d_stringStorage.allocate(content.length()));
+        bsl::copy(content.begin(), content.end(), buffer);
+        value->assign(buffer, content.length());
+        return 0;                                                     // RETURN
+    }
+
+    // Escape sequences must be resolved, which cannot be done in place.
+
+    const int                                     BAL_BUF_SIZE = 128;
+    bdlma::LocalSequentialAllocator<BAL_BUF_SIZE> bufferAllocator;
+    bsl::string                                   tmpString(&bufferAllocator);
+
+    rc = ParserUtil::getValue(&tmpString, dataValue);
+    if (rc) {
+        d_logStream << "Error reading string reference value\n";
+        return -1;                                                    // RETURN
+    }
+
+    char *buffer = static_cast<char *>(
+                                 d_stringStorage.allocate(tmpString.length()));
+    bsl::copy(tmpString.begin(), tmpString.end(), buffer);
+    value->assign(buffer, tmpString.length());
+    return 0;
+}
+
 int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
 {
     int rc = d_tokenizer.advanceToNextToken();
@@ -15,11 +15,17 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous buffer, given as a 'bslstl::StringRef'
+//
+// Decoding from a contiguous buffer is the most efficient of the three: the
+// tokenizer scans the buffer in place instead of first copying it into an
+// internal buffer, and string values free of escape sequences are copied
+// directly from the buffer into the decoded object.
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -38,6 +44,19 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this decoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Decoding String References
+///--------------------------
+// A 'bdeat'-compatible type may have elements of type 'bslstl::StringRef'
+// that refer to (rather than own) their string values.  Decoding into such an
+// element is supported only when the 'allowStringReferences' option is set
+// (see 'baljsn_decoderoptions'); otherwise decoding the element fails.  When
+// the JSON data is decoded from a contiguous buffer and the string value
+// contains no escape sequences, the decoded reference refers directly into
+// that buffer, and so remains valid only as long as the buffer does.
+// Otherwise, the decoded (unescaped) string is stored in memory owned by the
+// decoder, and the reference remains valid until the next call to 'decode' or
+// the destruction of the decoder, whichever comes first.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -142,6 +161,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_printmethods.h>
 
 #include <bdlma_localsequentialallocator.h>
+#include <bdlma_sequentialallocator.h>
 
 #include <bslmf_assert.h>
 
@@ -172,12 +192,24 @@ class Decoder {
     // necessary interface and can be decoded using this component.
 
     // DATA
-    bsl::ostringstream  d_logStream;            // stream to record errors
-    Tokenizer    d_tokenizer;            // JSON tokenizer
-    bsl::string         d_elementName;          // current element name
-    int                 d_currentDepth;         // current decoding depth
-    int                 d_maxDepth;             // max decoding depth
-    bool                d_skipUnknownElements;  // skip unknown elements flag
+    bsl::ostringstream          d_logStream;            // stream to record
+                                                        // errors
+    Tokenizer                   d_tokenizer;            // JSON tokenizer
+    bsl::string                 d_elementName;          // current element
+                                                        // name
+    bdlma::SequentialAllocator  d_stringStorage;        // storage for
+                                                        // decoded string
+                                                        // references
+    int                         d_currentDepth;         // current decoding
+                                                        // depth
+    int                         d_maxDepth;             // max decoding depth
+    bool                        d_skipUnknownElements;  // skip unknown
+                                                        // elements flag
+    bool                        d_allowStringReferences;
+                                                        // decode string
+                                                        // references flag
+    bool                        d_contiguousInput;      // decoding from a
+                                                        // contiguous buffer
 
     // FRIENDS
     friend struct Decoder_DecodeImpProxy;
@@ -203,6 +235,9 @@ class Decoder {
     int decodeImp(bsl::vector<char>         *value,
                   int                        mode,
                   bdlat_TypeCategory::Array);
+    int decodeImp(bslstl::StringRef         *value,
+                  int                        mode,
+                  bdlat_TypeCategory::Simple);
     template <class TYPE, class ANY_CATEGORY>
     int decodeImp(TYPE *value, ANY_CATEGORY category);
         // Decode into the specified 'value', of a (template parameter) 'TYPE'
@@ -214,6 +249,13 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON document to which the tokenizer owned by this object has
+        // been reset, using the specified 'options'.  Return 0 on success, and
+        // a non-zero value otherwise.
+
     int skipUnknownElement(const bslstl::StringRef& elementName);
         // Skip the unknown element specified by 'elementName' by discarding
         // all the data associated with it and advancing the parser to the next
@@ -269,6 +311,26 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  data,
+               TYPE                     *value,
+               const DecoderOptions&     options);
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  data,
+               TYPE                     *value,
+               const DecoderOptions     *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the contiguous buffer referred to by the specified
+        // 'data' and using the specified 'options'.  'TYPE' shall be a
+        // 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Specifying a nullptr 'options' is equivalent to passing a
+        // default-constructed DecoderOptions in 'options'.  Return 0 on
+        // success, and a non-zero value otherwise.  Note that the buffer is
+        // not copied, and that any 'bslstl::StringRef' element of 'value'
+        // decoded by this call may refer into the buffer (see {Decoding String
+        // References}).
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -862,27 +924,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -897,7 +941,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
 
@@ -911,11 +954,43 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     }
 
     bdlat_ValueTypeFunctions::reset(value);
+    d_stringStorage.release();
 
-    d_maxDepth            = options.maxDepth();
-    d_skipUnknownElements = options.skipUnknownElements();
+    d_maxDepth              = options.maxDepth();
+    d_skipUnknownElements   = options.skipUnknownElements();
+    d_allowStringReferences = options.allowStringReferences();
 
-    rc = decodeImp(value, 0, TypeCategory());
+    return decodeImp(value, 0, TypeCategory());
+}
+
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_stringStorage(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+, d_allowStringReferences(false)
+, d_contiguousInput(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+    d_contiguousInput = false;
+
+    const int rc = decodeDocument(value, options);
 
     d_tokenizer.resetStreamBufGetPointer();
 
@@ -957,6 +1032,28 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  data,
+                    TYPE                     *value,
+                    const DecoderOptions&     options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(data);
+    d_contiguousInput = true;
+
+    return decodeDocument(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  data,
+                    TYPE                     *value,
+                    const DecoderOptions     *options)
+{
+    DecoderOptions localOpts;
+    return decode(data, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
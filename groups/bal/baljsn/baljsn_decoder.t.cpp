@@ -28,11 +28,17 @@
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
 #include <bslmt_testutil.h>
 
 #include <bslim_printer.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsl_sstream.h>
@@ -56,7 +62,8 @@ namespace test = BloombergLP::s_baltst;
 // 'bdlat'-compatible objects in the JSON format.  The object types that can be
 // decoded include 'bdlat' sequence, choice, array, enumeration, customized,
 // simple, and dynamic types.  In addition, the decoder supports options to
-// specify the max depth and whether unknown elements should be skipped.
+// specify the max depth, whether unknown elements should be skipped, and
+// whether 'bslstl::StringRef' elements may be decoded.
 //
 // We use standard table-based approach to testing where we put both input and
 // expected output in the same table row and verify that the actual result
@@ -71,14 +78,18 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [ 9] int decode(const bslstl::StringRef& data, TYPE *v, options);
+// [ 9] int decode(const bslstl::StringRef& data, TYPE *v, &options);
+// [10] int decode(..., bsl::vector<bslstl::StringRef> *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
+// [-1] PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -36493,14 +36504,15 @@ struct IsEnumeration<test::Enumeration0> {
 
 int main(int argc, char *argv[])
 {
-    int         test = argc > 1 ? atoi(argv[1]) : 0;
-    bool     verbose = argc > 2;
-    bool veryVerbose = argc > 3;
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -36607,6 +36619,298 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING STRING REFERENCES
+        //
+        // Concerns:
+        //: 1 A 'bslstl::StringRef' element is not decoded unless the
+        //:   'allowStringReferences' option is set, and the failure is
+        //:   logged.
+        //:
+        //: 2 When decoding from a contiguous buffer, a string value without
+        //:   escape sequences is decoded as a reference into the buffer.
+        //:
+        //: 3 A string value with escape sequences, or any string value
+        //:   decoded from a 'streambuf', is unescaped into storage owned by
+        //:   the decoder.
+        //:
+        //: 4 Values that are not JSON strings are rejected.
+        //:
+        //: 5 The storage owned by the decoder is obtained from the allocator
+        //:   supplied at construction, and is reclaimed by the next call to
+        //:   'decode'.
+        //
+        // Plan:
+        //: 1 Decode an array of strings into a
+        //:   'bsl::vector<bslstl::StringRef>' without the option set, and
+        //:   verify that decoding fails with the expected logged message.
+        //:   (C-1)
+        //:
+        //: 2 Decode the same array with the option set, both from a
+        //:   contiguous buffer and from a 'streambuf', and verify the decoded
+        //:   values and whether each refers into the input.  (C-2..3)
+        //:
+        //: 3 Decode arrays holding non-string values and verify that
+        //:   decoding fails.  (C-4)
+        //:
+        //: 4 Using test allocators, decode repeatedly and verify that the
+        //:   default allocator is not used and that the number of blocks in
+        //:   use does not grow.  (C-5)
+        //
+        // Testing:
+        //   int decode(..., bsl::vector<bslstl::StringRef> *v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING STRING REFERENCES" << endl
+                          << "==================================" << endl;
+
+        typedef bsl::vector<bslstl::StringRef> Refs;
+
+        const char INPUT[] = "[\"plain\", \"\", \"a\\nb\", \"\\u0041BC\","
+                             " \"x\\\\\"]";
+        const bslstl::StringRef INPUT_REF(INPUT);
+
+        const struct {
+            const char *d_exp_p;       // expected value
+            bool        d_inInput;     // refers into contiguous input
+        } EXP[] = {
+            { "plain",  true  },
+            { "",       true  },
+            { "a\nb",   false },
+            { "ABC",    false },
+            { "x\\",    false },
+        };
+        const bsl::size_t NUM_EXP = sizeof EXP / sizeof *EXP;
+
+        if (verbose) cout << "\nDecoding without the option." << endl;
+        {
+            Obj                    mX;
+            baljsn::DecoderOptions options;
+            Refs                   value;
+
+            ASSERT(0 != mX.decode(INPUT_REF, &value, options));
+            ASSERTV(mX.loggedMessages(),
+                    bsl::string::npos != mX.loggedMessages().find(
+                                                     "allowStringReferences"));
+
+            bsl::istringstream iss(INPUT);
+            ASSERT(0 != mX.decode(iss, &value, options));
+        }
+
+        if (verbose) cout << "\nDecoding with the option." << endl;
+
+        for (int contiguous = 0; contiguous < 2; ++contiguous) {
+            Obj                    mX;
+            baljsn::DecoderOptions options;
+            options.setAllowStringReferences(true);
+
+            Refs value;
+
+            int rc;
+            if (contiguous) {
+                rc = mX.decode(INPUT_REF, &value, options);
+            }
+            else {
+                bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+                rc = mX.decode(&isb, &value, &options);
+            }
+            ASSERTV(contiguous, rc, mX.loggedMessages(), 0 == rc);
+            ASSERTV(contiguous, value.size(), NUM_EXP == value.size());
+
+            for (bsl::size_t i = 0; i < NUM_EXP && i < value.size(); ++i) {
+                const bslstl::StringRef EXP_VALUE(EXP[i].d_exp_p);
+                const bool              IN_INPUT =
+                                            contiguous && EXP[i].d_inInput;
+
+                ASSERTV(contiguous, i, EXP_VALUE, value[i],
+                        EXP_VALUE == value[i]);
+
+                const bool inInput = value[i].data() >= INPUT
+                                  && value[i].data() < INPUT + sizeof INPUT;
+                ASSERTV(contiguous, i, IN_INPUT, inInput,
+                        IN_INPUT == inInput);
+            }
+        }
+
+        if (verbose) cout << "\nDecoding non-string values." << endl;
+        {
+            static const char *const BAD[] = {
+                "[1]",
+                "[true]",
+                "[null]",
+                "[\"abc\", 2]",
+                "[[\"abc\"]]",
+                "[{}]",
+            };
+            const int NUM_BAD = sizeof BAD / sizeof *BAD;
+
+            baljsn::DecoderOptions options;
+            options.setAllowStringReferences(true);
+
+            for (int ti = 0; ti < NUM_BAD; ++ti) {
+                Obj  mX;
+                Refs value;
+
+                ASSERTV(BAD[ti],
+                        0 != mX.decode(bslstl::StringRef(BAD[ti]),
+                                       &value,
+                                       options));
+            }
+        }
+
+        if (verbose) cout << "\nTesting memory usage." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::TestAllocator         oa("object",  veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj                    mX(&oa);
+            baljsn::DecoderOptions options;
+            options.setAllowStringReferences(true);
+
+            Refs value(&oa);
+
+            ASSERT(0 == mX.decode(INPUT_REF, &value, options));
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.decode(INPUT_REF, &value, options));
+                ASSERTV(i, NUM_BLOCKS, oa.numBlocksInUse(),
+                        NUM_BLOCKS == oa.numBlocksInUse());
+                ASSERTV(i, value.size(), NUM_EXP == value.size());
+            }
+
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM A CONTIGUOUS BUFFER
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer produces the same value, and
+        //:   the same success or failure, as decoding the same data from a
+        //:   stream.
+        //:
+        //: 2 The decoder does not read beyond the end of the buffer.
+        //:
+        //: 3 Specifying a null 'options' is equivalent to specifying default
+        //:   options.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of valid and
+        //:   invalid inputs for a 'test::Employee'.
+        //:
+        //: 2 For each row, decode the input from an 'istringstream' and from
+        //:   a 'bslstl::StringRef', passing the options both by reference and
+        //:   by (null) address, and verify that the results agree.  (C-1,3)
+        //:
+        //: 3 For each valid row, decode every proper prefix of the input from
+        //:   a copy of that prefix in a buffer of exactly the prefix length,
+        //:   and verify that decoding fails.  (C-2)
+        //
+        // Testing:
+        //   int decode(const bslstl::StringRef& data, TYPE *v, options);
+        //   int decode(const bslstl::StringRef& data, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING FROM A CONTIGUOUS BUFFER"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input_p;  // JSON input
+            bool        d_isValid;  // input decodes successfully
+        } DATA[] = {
+            //LINE  INPUT                                         VALID
+            //----  -----                                         -----
+            { L_,   "{}",                                         true },
+            { L_,   "{\"name\":\"Bob\"}",                         true },
+            { L_,   " { \"name\" : \"Bob\" , \"age\" : 21 } ",    true },
+            { L_,   "{\"name\":\"B\\\"o\\\\b\\n\",\"age\":-3}",   true },
+            { L_,   "{\"name\":\"\\u00e9t\\u00E9\"}",             true },
+            { L_,   "{\"homeAddress\":{\"street\":\"Lexington Ave\","
+                    "\"city\":\"New York City\",\"state\":\"New York\"},"
+                    "\"name\":\"Bob\",\"age\":21}",               true },
+            { L_,   "{\"name\":\"Bob\",\"unknown\":[{\"a\":[1,2]}]}", true },
+
+            { L_,   "",                                           false },
+            { L_,   "[]",                                         false },
+            { L_,   "{\"name\":Bob}",                             false },
+            { L_,   "{\"name\":\"Bob\",}",                        false },
+            { L_,   "{\"age\":\"21\"}",                           false },
+            { L_,   "{\"name\":\"\\x\"}",                         false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        baljsn::DecoderOptions options;
+        options.setSkipUnknownElements(true);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const bsl::string  INPUT    = DATA[ti].d_input_p;
+            const bool         IS_VALID = DATA[ti].d_isValid;
+
+            if (veryVerbose) { T_; P_(LINE); P(INPUT); }
+
+            Obj mX;
+
+            test::Employee     expected;
+            bsl::istringstream iss(INPUT);
+            const int          expRc = mX.decode(iss, &expected, options);
+            ASSERTV(LINE, expRc, IS_VALID == (0 == expRc));
+
+            test::Employee value;
+            int            rc = mX.decode(bslstl::StringRef(INPUT),
+                                          &value,
+                                          options);
+            ASSERTV(LINE, rc, mX.loggedMessages(), IS_VALID == (0 == rc));
+            if (IS_VALID) {
+                ASSERTV(LINE, expected, value, expected == value);
+            }
+
+            test::Employee          defaultExpected;
+            bsl::istringstream      iss2(INPUT);
+            const int               defaultExpRc =
+                                       mX.decode(iss2, &defaultExpected, 0);
+
+            const baljsn::DecoderOptions *NULL_OPTIONS = 0;
+
+            test::Employee defaultValue;
+            rc = mX.decode(bslstl::StringRef(INPUT),
+                           &defaultValue,
+                           NULL_OPTIONS);
+            ASSERTV(LINE, rc, defaultExpRc, (0 == rc) == (0 == defaultExpRc));
+            if (0 == rc) {
+                ASSERTV(LINE, defaultExpected, defaultValue,
+                        defaultExpected == defaultValue);
+            }
+
+            if (!IS_VALID) {
+                continue;
+            }
+
+            // Every prefix lacking the closing brace of the document is
+            // incomplete.  Copy each into a buffer of exactly its length, so
+            // that any read past its end is detectable by memory checkers.
+
+            const bsl::size_t END = INPUT.find_last_of('}');
+            for (bsl::size_t len = 0; len <= END; ++len) {
+                bsl::vector<char> buffer(INPUT.begin(), INPUT.begin() + len);
+
+                test::Employee prefixValue;
+                rc = mX.decode(bslstl::StringRef(buffer.data(), len),
+                               &prefixValue,
+                               options);
+                ASSERTV(LINE, len, rc, 0 != rc);
+            }
+        }
+      } break;
       case 8: {
         // ------------------------------------------------------------------
         // TESTING CLEARING OF LOGGED MESSAGES ON DECODE CALLS
@@ -39023,6 +39327,136 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of decoding a document read from a
+        //:   'streambuf' and in place, into owning and referring strings.
+        //
+        // Plan:
+        //: 1 Generate an array of 'test::Employee' objects about 1MB long,
+        //:   and time decoding it repeatedly from a
+        //:   'bdlsb::FixedMemInStreamBuf' and in place.  The number of
+        //:   repetitions may be given as the second argument.
+        //:
+        //: 2 Generate an array of strings about 1MB long, and time decoding it
+        //:   into a 'bsl::vector<bsl::string>' and, in place, into a
+        //:   'bsl::vector<bslstl::StringRef>'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT" << endl
+             << "===========================================" << endl;
+
+        const int REPS = argc > 2 ? atoi(argv[2]) : 20;
+
+        const bsl::string EMPLOYEE(
+                    "{\n"
+                    "    \"name\" : \"Employee Name\",\n"
+                    "    \"homeAddress\" : {\n"
+                    "        \"street\" : \"731 Lexington Avenue\",\n"
+                    "        \"city\" : \"New York City\",\n"
+                    "        \"state\" : \"New York \\\"NY\\\"\"\n"
+                    "    },\n"
+                    "    \"age\" : 42\n"
+                    "}");
+        const bsl::string STRING("\"a longer string value, without escape "
+                                 "sequences, as is typical\"");
+
+        bsl::string employees("[\n");
+        bsl::string strings("[\n");
+        while (employees.length() < 1024 * 1024) {
+            if (employees.length() > 2) {
+                employees += ",\n";
+            }
+            employees += EMPLOYEE;
+        }
+        while (strings.length() < 1024 * 1024) {
+            if (strings.length() > 2) {
+                strings += ",\n";
+            }
+            strings += STRING;
+        }
+        employees += "\n]";
+        strings   += "\n]";
+
+        baljsn::DecoderOptions options;
+        options.setAllowStringReferences(true);
+
+        const double megabytes = static_cast<double>(employees.length())
+                               * REPS / (1024 * 1024);
+
+        for (int contiguous = 0; contiguous < 2; ++contiguous) {
+            Obj                          mX;
+            bsl::vector<test::Employee>  value;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                int rc;
+                if (contiguous) {
+                    rc = mX.decode(bslstl::StringRef(employees),
+                                   &value,
+                                   options);
+                }
+                else {
+                    bdlsb::FixedMemInStreamBuf isb(employees.data(),
+                                                   employees.length());
+                    rc = mX.decode(&isb, &value, options);
+                }
+                ASSERTV(rc, mX.loggedMessages(), 0 == rc);
+            }
+            timer.stop();
+
+            cout << "employees ("
+                 << (contiguous ? "contiguous" : "streambuf") << "): "
+                 << value.size() << " objects, "
+                 << megabytes / timer.elapsedTime() << " MB/s" << endl;
+        }
+
+        {
+            Obj                      mX;
+            bsl::vector<bsl::string> value;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                bdlsb::FixedMemInStreamBuf isb(strings.data(),
+                                               strings.length());
+                const int rc = mX.decode(&isb, &value, options);
+                ASSERTV(rc, mX.loggedMessages(), 0 == rc);
+            }
+            timer.stop();
+
+            cout << "strings (streambuf, bsl::string): "
+                 << value.size() << " values, "
+                 << megabytes / timer.elapsedTime() << " MB/s" << endl;
+        }
+
+        {
+            Obj                            mX;
+            bsl::vector<bslstl::StringRef> value;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < REPS; ++i) {
+                const int rc = mX.decode(bslstl::StringRef(strings),
+                                         &value,
+                                         options);
+                ASSERTV(rc, mX.loggedMessages(), 0 == rc);
+            }
+            timer.stop();
+
+            cout << "strings (contiguous, bslstl::StringRef): "
+                 << value.size() << " values, "
+                 << megabytes / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
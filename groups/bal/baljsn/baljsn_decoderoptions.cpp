@@ -37,6 +37,8 @@ const int DecoderOptions::DEFAULT_INITIALIZER_MAX_DEPTH = 32;
 
 const bool DecoderOptions::DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS = true;
 
+const bool DecoderOptions::DEFAULT_INITIALIZER_ALLOW_STRING_REFERENCES = false;
+
 const bdlat_AttributeInfo DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         ATTRIBUTE_ID_MAX_DEPTH,
@@ -51,6 +53,13 @@ const bdlat_AttributeInfo DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("SkipUnknownElements") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_ALLOW_STRING_REFERENCES,
+        "AllowStringReferences",
+        sizeof("AllowStringReferences") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -60,7 +69,7 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
                     DecoderOptions::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -81,6 +90,8 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_DEPTH];
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS];
+      case ATTRIBUTE_ID_ALLOW_STRING_REFERENCES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES];
       default:
         return 0;
     }
@@ -91,12 +102,14 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(int id)
 DecoderOptions::DecoderOptions()
 : d_maxDepth(DEFAULT_INITIALIZER_MAX_DEPTH)
 , d_skipUnknownElements(DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS)
+, d_allowStringReferences(DEFAULT_INITIALIZER_ALLOW_STRING_REFERENCES)
 {
 }
 
 DecoderOptions::DecoderOptions(const DecoderOptions& original)
 : d_maxDepth(original.d_maxDepth)
 , d_skipUnknownElements(original.d_skipUnknownElements)
+, d_allowStringReferences(original.d_allowStringReferences)
 {
 }
 
@@ -112,6 +125,7 @@ DecoderOptions::operator=(const DecoderOptions& rhs)
     if (this != &rhs) {
         d_maxDepth = rhs.d_maxDepth;
         d_skipUnknownElements = rhs.d_skipUnknownElements;
+        d_allowStringReferences = rhs.d_allowStringReferences;
     }
 
     return *this;
@@ -121,6 +135,7 @@ void DecoderOptions::reset()
 {
     d_maxDepth = DEFAULT_INITIALIZER_MAX_DEPTH;
     d_skipUnknownElements = DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
+    d_allowStringReferences = DEFAULT_INITIALIZER_ALLOW_STRING_REFERENCES;
 }
 
 // ACCESSORS
@@ -134,6 +149,7 @@ bsl::ostream& DecoderOptions::print(
     printer.start();
     printer.printAttribute("maxDepth", d_maxDepth);
     printer.printAttribute("skipUnknownElements", d_skipUnknownElements);
+    printer.printAttribute("allowStringReferences", d_allowStringReferences);
     printer.end();
     return stream;
 }
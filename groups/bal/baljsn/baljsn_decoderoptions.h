@@ -23,10 +23,14 @@ BSLS_IDENT("$Id: $")
 //  ------------------    -----------    -------         ------------------
 //  maxDepth              int            32              >= 0
 //  skipUnknownElements   bool           true            none
+//  allowStringReferences bool           false           none
 //..
 //: o 'maxDepth': maximum depth of the decoded data
 //:
 //: o 'skipUnknownElements': flag specifying if unknown elements are skipped
+//:
+//: o 'allowStringReferences': flag specifying if 'bslstl::StringRef'
+//:   elements can be decoded (see 'baljsn_decoder')
 //
 ///Implementation Note
 ///- - - - - - - - - -
@@ -94,21 +98,25 @@ class DecoderOptions {
         // maximum recursion depth
     bool  d_skipUnknownElements;
         // option to skip unknown elements
+    bool  d_allowStringReferences;
+        // option to decode string references
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_MAX_DEPTH             = 0
-      , ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS = 1
+        ATTRIBUTE_ID_MAX_DEPTH               = 0
+      , ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS   = 1
+      , ATTRIBUTE_ID_ALLOW_STRING_REFERENCES = 2
     };
 
     enum {
-        NUM_ATTRIBUTES = 2
+        NUM_ATTRIBUTES = 3
     };
 
     enum {
-        ATTRIBUTE_INDEX_MAX_DEPTH             = 0
-      , ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS = 1
+        ATTRIBUTE_INDEX_MAX_DEPTH               = 0
+      , ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS   = 1
+      , ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES = 2
     };
 
     // CONSTANTS
@@ -118,6 +126,8 @@ class DecoderOptions {
 
     static const bool DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
 
+    static const bool DEFAULT_INITIALIZER_ALLOW_STRING_REFERENCES;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -189,6 +199,10 @@ class DecoderOptions {
         // Set the "SkipUnknownElements" attribute of this object to the
         // specified 'value'.
 
+    void setAllowStringReferences(bool value);
+        // Set the "AllowStringReferences" attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -240,6 +254,10 @@ class DecoderOptions {
     bool skipUnknownElements() const;
         // Return a reference to the non-modifiable "SkipUnknownElements"
         // attribute of this object.
+
+    bool allowStringReferences() const;
+        // Return a reference to the non-modifiable "AllowStringReferences"
+        // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -294,6 +312,11 @@ int DecoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_allowStringReferences, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -309,6 +332,9 @@ int DecoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS: {
         return manipulator(&d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
       } break;
+      case ATTRIBUTE_ID_ALLOW_STRING_REFERENCES: {
+        return manipulator(&d_allowStringReferences, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -345,6 +371,12 @@ void DecoderOptions::setSkipUnknownElements(bool value)
     d_skipUnknownElements = value;
 }
 
+inline
+void DecoderOptions::setAllowStringReferences(bool value)
+{
+    d_allowStringReferences = value;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
@@ -361,6 +393,11 @@ int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_allowStringReferences, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -376,6 +413,9 @@ int DecoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS: {
         return accessor(d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
       } break;
+      case ATTRIBUTE_ID_ALLOW_STRING_REFERENCES: {
+        return accessor(d_allowStringReferences, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ALLOW_STRING_REFERENCES]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -410,6 +450,12 @@ bool DecoderOptions::skipUnknownElements() const
     return d_skipUnknownElements;
 }
 
+inline
+bool DecoderOptions::allowStringReferences() const
+{
+    return d_allowStringReferences;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -420,7 +466,8 @@ bool baljsn::operator==(
         const baljsn::DecoderOptions& rhs)
 {
     return  lhs.maxDepth() == rhs.maxDepth()
-         && lhs.skipUnknownElements() == rhs.skipUnknownElements();
+         && lhs.skipUnknownElements() == rhs.skipUnknownElements()
+         && lhs.allowStringReferences() == rhs.allowStringReferences();
 }
 
 inline
@@ -429,7 +476,8 @@ bool baljsn::operator!=(
         const baljsn::DecoderOptions& rhs)
 {
     return  lhs.maxDepth() != rhs.maxDepth()
-         || lhs.skipUnknownElements() != rhs.skipUnknownElements();
+         || lhs.skipUnknownElements() != rhs.skipUnknownElements()
+         || lhs.allowStringReferences() != rhs.allowStringReferences();
 }
 
 inline
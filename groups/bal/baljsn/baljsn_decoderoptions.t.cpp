@@ -34,10 +34,12 @@ using namespace bsl;
 // Primary Manipulators:
 //: o 'setMaxDepth'
 //: o 'setSkipUnknownElements'
+//: o 'setAllowStringReferences'
 //
 // Basic Accessors:
 //: o 'maxDepth'
 //: o 'skipUnknownElements'
+//: o 'allowStringReferences'
 //
 // Certain standard value-semantic-type test cases are omitted:
 //: o [ 8] -- 'swap' is not implemented for this class.
@@ -64,11 +66,13 @@ using namespace bsl;
 // [10] STREAM& bdexStreamIn(STREAM& stream, int version);
 // [ 3] setMaxDepth(int value);
 // [ 3] setSkipUnknownElements(bool value);
+// [ 3] setAllowStringReferences(bool value);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
 // [ 4] int  maxDepth() const;
 // [ 4] bool skipUnknownElements() const;
+// [ 4] bool allowStringReferences() const;
 //
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 //
@@ -659,6 +663,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // 'maxDepth'
         typedef bool  T2;        // 'skipUnknownElements'
+        typedef bool  T3;        // 'allowStringReferences'
 
                       // ------------------------------
                       // Attribute 1 Values: 'maxDepth'
@@ -674,6 +679,13 @@ int main(int argc, char *argv[])
         const T2 A2 = true;                  // baseline
         const T2 B2 = false;
 
+               // -------------------------------------------
+               // Attribute 3 Values: 'allowStringReferences'
+               // -------------------------------------------
+
+        const T3 A3 = false;                 // baseline
+        const T3 B3 = true;
+
         if (verbose) cout <<
             "\nCreate a table of distinct, but similar object values." << endl;
 
@@ -681,6 +693,7 @@ int main(int argc, char *argv[])
             int   d_line;        // source line number
             int   d_maxDepth;
             bool  d_skipUnknownElements;
+            bool  d_allowStringReferences;
         } DATA[] = {
 
         // The first row of the table below represents an object value
@@ -688,13 +701,14 @@ int main(int argc, char *argv[])
         // row differs (slightly) from the first in exactly one attribute value
         // (Bi).
 
-        //LINE  DEPTH   SKIP
-        //----  -----   ----
+        //LINE  DEPTH   SKIP   REFS
+        //----  -----   ----   ----
 
-        { L_,       A1,   A2   },          // baseline
+        { L_,       A1,   A2,    A3   },          // baseline
 
-        { L_,       B1,   A2   },
-        { L_,       A1,   B2   },
+        { L_,       B1,   A2,    A3   },
+        { L_,       A1,   B2,    A3   },
+        { L_,       A1,   A2,    B3   },
 
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -705,6 +719,7 @@ int main(int argc, char *argv[])
             const int   LINE1    = DATA[ti].d_line;
             const int   DEPTH1  = DATA[ti].d_maxDepth;
             const int   SKIP1     = DATA[ti].d_skipUnknownElements;
+            const bool  REFS1     = DATA[ti].d_allowStringReferences;
 
             if (veryVerbose) { T_ P_(LINE1) P_(DEPTH1) P_(SKIP1)  }
 
@@ -714,6 +729,7 @@ int main(int argc, char *argv[])
 
                 mX.setMaxDepth(DEPTH1);
                 mX.setSkipUnknownElements(SKIP1);
+                mX.setAllowStringReferences(REFS1);
 
                 LOOP2_ASSERT(LINE1, X,   X == X);
                 LOOP2_ASSERT(LINE1, X, !(X != X));
@@ -723,6 +739,7 @@ int main(int argc, char *argv[])
                 const int   LINE2    = DATA[tj].d_line;
                 const int   DEPTH2  = DATA[tj].d_maxDepth;
                 const int   SKIP2     = DATA[tj].d_skipUnknownElements;
+                const bool  REFS2     = DATA[tj].d_allowStringReferences;
 
                 if (veryVerbose) { T_ P_(LINE1) P_(DEPTH2) P_(SKIP2) }
 
@@ -733,9 +750,11 @@ int main(int argc, char *argv[])
 
                 mX.setMaxDepth(DEPTH1);
                 mX.setSkipUnknownElements(SKIP1);
+                mX.setAllowStringReferences(REFS1);
 
                 mY.setMaxDepth(DEPTH2);
                 mY.setSkipUnknownElements(SKIP2);
+                mY.setAllowStringReferences(REFS2);
 
                 if (veryVerbose) { T_ T_ T_ P_(EXP) P_(X) P(Y) }
 
@@ -858,18 +877,21 @@ int main(int argc, char *argv[])
         { L_,  0,  0, 89, true,  "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "allowStringReferences = false"             NL
                                  "]"                                         NL
                                                                              },
 
         { L_,  0,  1, 89, true,  "["                                         NL
                                  " maxDepth = 89"                            NL
                                  " skipUnknownElements = true"               NL
+                                 " allowStringReferences = false"            NL
                                  "]"                                         NL
                                                                              },
 
         { L_,  0, -1, 89, false, "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = false"               SP
+                                 "allowStringReferences = false"             SP
                                  "]"
                                                                              },
 
@@ -883,36 +905,42 @@ int main(int argc, char *argv[])
         { L_,  3,  0, 89, true,  "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "allowStringReferences = false"             NL
                                  "]"                                         NL
                                                                              },
 
         { L_,  3,  2, 89, false, "      ["                                   NL
                                  "        maxDepth = 89"                     NL
                                  "        skipUnknownElements = false"       NL
+                                 "        allowStringReferences = false"     NL
                                  "      ]"                                   NL
                                                                              },
 
         { L_,  3, -2, 89, false, "      ["                                   SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = false"               SP
+                                 "allowStringReferences = false"             SP
                                  "]"
                                                                              },
 
         { L_, -3,  0, 89, true,  "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "allowStringReferences = false"             NL
                                  "]"                                         NL
                                                                              },
 
         { L_, -3,  2, 89, false, "["                                         NL
                                  "        maxDepth = 89"                     NL
                                  "        skipUnknownElements = false"       NL
+                                 "        allowStringReferences = false"     NL
                                  "      ]"                                   NL
                                                                              },
 
         { L_, -3, -2, 89, true,  "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = true"                SP
+                                 "allowStringReferences = false"             SP
                                  "]"
                                                                              },
 
@@ -926,6 +954,7 @@ int main(int argc, char *argv[])
         { L_,  2,  3, 89, true,  "      ["                                   NL
                                  "         maxDepth = 89"                    NL
                                  "         skipUnknownElements = true"       NL
+                                 "         allowStringReferences = false"    NL
                                  "      ]"                                   NL
                                                                              },
 
@@ -939,11 +968,13 @@ int main(int argc, char *argv[])
         { L_, -9, -9,  89, true, "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = true"                SP
+                                 "allowStringReferences = false"             SP
                                  "]"                                         },
 
         { L_, -9, -9,   7, false, "["                                        SP
                                  "maxDepth = 7"                              SP
                                  "skipUnknownElements = false"               SP
+                                 "allowStringReferences = false"             SP
                                  "]"                                         },
 
 #undef NL
@@ -1032,6 +1063,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   int  maxDepth() const;
         //   bool skipUnknownElements() const;
+        //   bool allowStringReferences() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1042,6 +1074,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // 'maxDepth'
         typedef bool  T2;        // 'skipUnknownElements'
+        typedef bool  T3;        // 'allowStringReferences'
 
         if (verbose) cout << "\nEstablish suitable attribute values." << endl;
 
@@ -1051,6 +1084,7 @@ int main(int argc, char *argv[])
 
         const int   D1   = 32;                    // 'maxDepth'
         const int   D2   = true;                  // 'skipUnknownElements'
+        const bool  D3   = false;                 // 'allowStringReferences'
 
                        // ----------------------------
                        // 'A' values: Boundary values.
@@ -1058,6 +1092,7 @@ int main(int argc, char *argv[])
 
         const int   A1   = INT_MAX;              // 'maxDepth'
         const int   A2   = false;                // 'skipUnknownElements'
+        const bool  A3   = true;                 // 'allowStringReferences'
 
         if (verbose) cout << "\nCreate an object." << endl;
 
@@ -1071,6 +1106,10 @@ int main(int argc, char *argv[])
 
             const T2& skipUnknownElements = X.skipUnknownElements();
             LOOP2_ASSERT(D2, skipUnknownElements, D2 == skipUnknownElements);
+
+            const T3& allowStringReferences = X.allowStringReferences();
+            LOOP2_ASSERT(D3, allowStringReferences,
+                         D3 == allowStringReferences);
         }
 
         if (verbose) cout <<
@@ -1091,6 +1130,15 @@ int main(int argc, char *argv[])
             const T2& skipUnknownElements = X.skipUnknownElements();
             LOOP2_ASSERT(A2, skipUnknownElements, A2 == skipUnknownElements);
         }
+
+        if (veryVerbose) { T_ Q(allowStringReferences) }
+        {
+            mX.setAllowStringReferences(A3);
+
+            const T3& allowStringReferences = X.allowStringReferences();
+            LOOP2_ASSERT(A3, allowStringReferences,
+                         A3 == allowStringReferences);
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -1136,6 +1184,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   setMaxDepth(int value);
         //   setSkipUnknownElements(int value);
+        //   setAllowStringReferences(bool value);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1148,16 +1197,19 @@ int main(int argc, char *argv[])
 
         const int   D1   = 32;                   // 'maxDepth'
         const bool  D2   = true;                 // 'skipUnknownElements'
+        const bool  D3   = false;                // 'allowStringReferences'
 
         // 'A' values.
 
         const int   A1   = 1;                    // 'maxDepth'
         const int   A2   = false;                // 'skipUnknownElements'
+        const bool  A3   = true;                 // 'allowStringReferences'
 
         // 'B' values.
 
         const int   B1   = INT_MAX;              // 'maxDepth'
         const int   B2   = true;                 // 'skipUnknownElements'
+        const bool  B3   = false;                // 'allowStringReferences'
 
         Obj mX;  const Obj& X = mX;
 
@@ -1198,6 +1250,26 @@ int main(int argc, char *argv[])
             ASSERT(D2 == X.skipUnknownElements());
         }
 
+        // -----------------------
+        // 'allowStringReferences'
+        // -----------------------
+        {
+            mX.setAllowStringReferences(A3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(A3 == X.allowStringReferences());
+
+            mX.setAllowStringReferences(B3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(B3 == X.allowStringReferences());
+
+            mX.setAllowStringReferences(D3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.allowStringReferences());
+        }
+
         if (verbose) cout << "Corroborate attribute independence." << endl;
         {
             // ---------------------------------------
@@ -1206,9 +1278,11 @@ int main(int argc, char *argv[])
 
             mX.setMaxDepth(A1);
             mX.setSkipUnknownElements(A2);
+            mX.setAllowStringReferences(A3);
 
             ASSERT(A1 == X.maxDepth());
             ASSERT(A2 == X.skipUnknownElements());
+            ASSERT(A3 == X.allowStringReferences());
 
                  // ---------------------------------------
                  // Set all attributes to their 'B' values.
@@ -1223,6 +1297,13 @@ int main(int argc, char *argv[])
 
             ASSERT(B1 == X.maxDepth());
             ASSERT(B2 == X.skipUnknownElements());
+            ASSERT(A3 == X.allowStringReferences());
+
+            mX.setAllowStringReferences(B3);
+
+            ASSERT(B1 == X.maxDepth());
+            ASSERT(B2 == X.skipUnknownElements());
+            ASSERT(B3 == X.allowStringReferences());
         }
 
         if (verbose) cout << "\nNegative Testing." << endl;
@@ -57,6 +57,9 @@ const int EncoderOptions::DEFAULT_INITIALIZER_MAX_DOUBLE_PRECISION = bsl::numeri
 
 const bool EncoderOptions::DEFAULT_INITIALIZER_ENCODE_QUOTED_DECIMAL64 = true;
 
+const bool EncoderOptions::DEFAULT_INITIALIZER_ENCODE_SHORTEST_FLOATING_POINT =
+                                                                         false;
+
 const bdlat_AttributeInfo EncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         ATTRIBUTE_ID_INITIAL_INDENT_LEVEL,
@@ -127,6 +130,13 @@ const bdlat_AttributeInfo EncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("EncodeQuotedDecimal64") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_ENCODE_SHORTEST_FLOATING_POINT,
+        "EncodeShortestFloatingPoint",
+        sizeof("EncodeShortestFloatingPoint") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -136,7 +146,7 @@ const bdlat_AttributeInfo *EncoderOptions::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 10; ++i) {
+    for (int i = 0; i < 11; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
                     EncoderOptions::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -173,6 +183,9 @@ const bdlat_AttributeInfo *EncoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_DOUBLE_PRECISION];
       case ATTRIBUTE_ID_ENCODE_QUOTED_DECIMAL64:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_QUOTED_DECIMAL64];
+      case ATTRIBUTE_ID_ENCODE_SHORTEST_FLOATING_POINT:
+        return &ATTRIBUTE_INFO_ARRAY[
+                              ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT];
       default:
         return 0;
     }
@@ -191,6 +204,8 @@ EncoderOptions::EncoderOptions()
 , d_encodeNullElements(DEFAULT_INITIALIZER_ENCODE_NULL_ELEMENTS)
 , d_encodeInfAndNaNAsStrings(DEFAULT_INITIALIZER_ENCODE_INF_AND_NA_N_AS_STRINGS)
 , d_encodeQuotedDecimal64(DEFAULT_INITIALIZER_ENCODE_QUOTED_DECIMAL64)
+, d_encodeShortestFloatingPoint(
+                            DEFAULT_INITIALIZER_ENCODE_SHORTEST_FLOATING_POINT)
 {
 }
 
@@ -205,6 +220,7 @@ EncoderOptions::EncoderOptions(const EncoderOptions& original)
 , d_encodeNullElements(original.d_encodeNullElements)
 , d_encodeInfAndNaNAsStrings(original.d_encodeInfAndNaNAsStrings)
 , d_encodeQuotedDecimal64(original.d_encodeQuotedDecimal64)
+, d_encodeShortestFloatingPoint(original.d_encodeShortestFloatingPoint)
 {
 }
 
@@ -230,6 +246,7 @@ EncoderOptions::operator=(const EncoderOptions& rhs)
         d_maxFloatPrecision = rhs.d_maxFloatPrecision;
         d_maxDoublePrecision = rhs.d_maxDoublePrecision;
         d_encodeQuotedDecimal64 = rhs.d_encodeQuotedDecimal64;
+        d_encodeShortestFloatingPoint = rhs.d_encodeShortestFloatingPoint;
     }
 
     return *this;
@@ -247,6 +264,8 @@ void EncoderOptions::reset()
     d_maxFloatPrecision = DEFAULT_INITIALIZER_MAX_FLOAT_PRECISION;
     d_maxDoublePrecision = DEFAULT_INITIALIZER_MAX_DOUBLE_PRECISION;
     d_encodeQuotedDecimal64 = DEFAULT_INITIALIZER_ENCODE_QUOTED_DECIMAL64;
+    d_encodeShortestFloatingPoint =
+                            DEFAULT_INITIALIZER_ENCODE_SHORTEST_FLOATING_POINT;
 }
 
 // ACCESSORS
@@ -268,6 +287,8 @@ bsl::ostream& EncoderOptions::print(
     printer.printAttribute("maxFloatPrecision", d_maxFloatPrecision);
     printer.printAttribute("maxDoublePrecision", d_maxDoublePrecision);
     printer.printAttribute("encodeQuotedDecimal64", d_encodeQuotedDecimal64);
+    printer.printAttribute("encodeShortestFloatingPoint",
+                           d_encodeShortestFloatingPoint);
     printer.end();
     return stream;
 }
@@ -30,6 +30,8 @@ BSLS_IDENT("$Id: $")
 //                      bool           false           none
 //  encodeQuotedDecimal64
 //                      bool           true            none
+//  encodeShortestFloatingPoint
+//                      bool           false           none
 //  datetimeFractionalSecondPrecision
 //                      int            3               >= 0 and <= 6
 //  maxFloatPrecision   int            bsl::numeric_limits<float>::digits10
@@ -66,6 +68,14 @@ BSLS_IDENT("$Id: $")
 //:                            'Decimal64' value is encoded enclosed in quotes,
 //:                            and as a JSON number otherwise.
 //:
+//: o 'encodeShortestFloatingPoint': option specifying if 'float' and
+//:                                  'double' values are encoded with the
+//:                                  fewest significant digits that parse back
+//:                                  to the same value (see
+//:                                  'bdlb_floatconvertutil'), in which case
+//:                                  'maxFloatPrecision' and
+//:                                  'maxDoublePrecision' are ignored.
+//:
 //: o 'datetimeFractionalSecondPrecision': option specifying the number of
 //:                                        decimal places used for seconds when
 //:                                        encoding 'Datetime' and
@@ -104,6 +114,7 @@ BSLS_IDENT("$Id: $")
 //  const int  FLOAT_PRECISION           = 3;
 //  const int  DOUBLE_PRECISION          = 9;
 //  const bool ENCODE_QUOTED_DECIMAL64   = false;
+//  const bool ENCODE_SHORTEST_FP        = true;
 //
 //  baljsn::EncoderOptions options;
 //  assert(0     == options.initialIndentLevel());
@@ -119,6 +130,7 @@ BSLS_IDENT("$Id: $")
 //                                            ==
 //                                            options.maxDoublePrecision());
 //  assert(true == options.encodeQuotedDecimal64());
+//  assert(false == options.encodeShortestFloatingPoint());
 //..
 // Next, we populate that object to encode in a pretty format using a
 // pre-defined initial indent level and spaces per level:
@@ -152,6 +164,9 @@ BSLS_IDENT("$Id: $")
 //
 //  options.setEncodeQuotedDecimal64(ENCODE_QUOTED_DECIMAL64);
 //  ASSERT(ENCODE_QUOTED_DECIMAL64 == options.encodeQuotedDecimal64());
+//
+//  options.setEncodeShortestFloatingPoint(ENCODE_SHORTEST_FP);
+//  ASSERT(ENCODE_SHORTEST_FP == options.encodeShortestFloatingPoint());
 //..
 
 #include <balscm_version.h>
@@ -197,7 +212,9 @@ class EncoderOptions {
     // milliseconds printed with date time values.  By default a precision of
     // '3' decimal places is used.  The 'MaxFloatPrecision' and
     // 'MaxDoublePrecision' attributes allow specifying the maximum precision
-    // for 'float' and 'double' values.
+    // for 'float' and 'double' values.  The 'EncodeShortestFloatingPoint'
+    // attribute specifies that 'float' and 'double' values are instead
+    // encoded with the fewest digits that preserve their values.
 
     // INSTANCE DATA
     int                   d_initialIndentLevel;
@@ -233,6 +250,9 @@ class EncoderOptions {
         // option specifying a way to encode 'Decimal64' values.  If the option
         // value is 'true' then the 'Decimal64' value is encoded quoted
         // { "dec": "1.2e-5" }, and unquoted { "dec": 1.2e-5 } otherwise.
+    bool                   d_encodeShortestFloatingPoint;
+        // option specifying if 'float' and 'double' values are encoded with
+        // the fewest significant digits that preserve their values
   public:
     // TYPES
     enum EncodingStyle {
@@ -260,10 +280,11 @@ class EncoderOptions {
       , ATTRIBUTE_ID_MAX_FLOAT_PRECISION                  = 7
       , ATTRIBUTE_ID_MAX_DOUBLE_PRECISION                 = 8
       , ATTRIBUTE_ID_ENCODE_QUOTED_DECIMAL64              = 9
+      , ATTRIBUTE_ID_ENCODE_SHORTEST_FLOATING_POINT       = 10
     };
 
     enum {
-        NUM_ATTRIBUTES = 10
+        NUM_ATTRIBUTES = 11
     };
 
     enum {
@@ -277,6 +298,7 @@ class EncoderOptions {
       , ATTRIBUTE_INDEX_MAX_FLOAT_PRECISION                  = 7
       , ATTRIBUTE_INDEX_MAX_DOUBLE_PRECISION                 = 8
       , ATTRIBUTE_INDEX_ENCODE_QUOTED_DECIMAL64              = 9
+      , ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT       = 10
     };
 
     // CONSTANTS
@@ -302,6 +324,8 @@ class EncoderOptions {
 
     static const bool DEFAULT_INITIALIZER_ENCODE_QUOTED_DECIMAL64;
 
+    static const bool DEFAULT_INITIALIZER_ENCODE_SHORTEST_FLOATING_POINT;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -406,6 +430,10 @@ class EncoderOptions {
         // Set the "EncodeQuotedDecimal64" attribute of this object to the
         // specified 'value'.
 
+    void setEncodeShortestFloatingPoint(bool value);
+        // Set the "EncodeShortestFloatingPoint" attribute of this object to
+        // the specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -491,6 +519,10 @@ class EncoderOptions {
     bool encodeQuotedDecimal64() const;
         // Return the value of the "EncodeQuotedDecimal64" attribute of this
         // object.
+
+    bool encodeShortestFloatingPoint() const;
+        // Return the value of the "EncodeShortestFloatingPoint" attribute of
+        // this object.
 };
 
 // FREE OPERATORS
@@ -585,6 +617,11 @@ int EncoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_encodeShortestFloatingPoint, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -624,6 +661,9 @@ int EncoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
       case ATTRIBUTE_ID_ENCODE_QUOTED_DECIMAL64: {
         return manipulator(&d_encodeQuotedDecimal64, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_QUOTED_DECIMAL64]);
       } break;
+      case ATTRIBUTE_ID_ENCODE_SHORTEST_FLOATING_POINT: {
+        return manipulator(&d_encodeShortestFloatingPoint, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -726,6 +766,12 @@ void EncoderOptions::setEncodeQuotedDecimal64(bool value)
     d_encodeQuotedDecimal64 = value;
 }
 
+inline
+void EncoderOptions::setEncodeShortestFloatingPoint(bool value)
+{
+    d_encodeShortestFloatingPoint = value;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int EncoderOptions::accessAttributes(ACCESSOR& accessor) const
@@ -782,6 +828,11 @@ int EncoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_encodeShortestFloatingPoint, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -821,6 +872,9 @@ int EncoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
       case ATTRIBUTE_ID_ENCODE_QUOTED_DECIMAL64: {
         return accessor(d_encodeQuotedDecimal64, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_QUOTED_DECIMAL64]);
       } break;
+      case ATTRIBUTE_ID_ENCODE_SHORTEST_FLOATING_POINT: {
+        return accessor(d_encodeShortestFloatingPoint, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_SHORTEST_FLOATING_POINT]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -903,6 +957,12 @@ bool EncoderOptions::encodeQuotedDecimal64() const
     return d_encodeQuotedDecimal64;
 }
 
+inline
+bool EncoderOptions::encodeShortestFloatingPoint() const
+{
+    return d_encodeShortestFloatingPoint;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -921,7 +981,8 @@ bool baljsn::operator==(
          && lhs.datetimeFractionalSecondPrecision() == rhs.datetimeFractionalSecondPrecision()
          && lhs.maxFloatPrecision() == rhs.maxFloatPrecision()
          && lhs.maxDoublePrecision() == rhs.maxDoublePrecision()
-         && lhs.encodeQuotedDecimal64() == rhs.encodeQuotedDecimal64();
+         && lhs.encodeQuotedDecimal64() == rhs.encodeQuotedDecimal64()
+         && lhs.encodeShortestFloatingPoint() == rhs.encodeShortestFloatingPoint();
 }
 
 inline
@@ -938,7 +999,8 @@ bool baljsn::operator!=(
          || lhs.datetimeFractionalSecondPrecision() != rhs.datetimeFractionalSecondPrecision()
          || lhs.maxFloatPrecision() != rhs.maxFloatPrecision()
          || lhs.maxDoublePrecision() != rhs.maxDoublePrecision()
-         || lhs.encodeQuotedDecimal64() != rhs.encodeQuotedDecimal64();
+         || lhs.encodeQuotedDecimal64() != rhs.encodeQuotedDecimal64()
+         || lhs.encodeShortestFloatingPoint() != rhs.encodeShortestFloatingPoint();
 }
 
 inline
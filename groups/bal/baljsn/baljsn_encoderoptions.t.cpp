@@ -44,6 +44,7 @@ using namespace bsl;
 //: o 'setDatetimeFractionalSecondPrecision'
 //: o 'setMaxFloatPrecision'
 //: o 'setMaxDoublePrecision'
+//: o 'setEncodeShortestFloatingPoint'
 //
 // Basic Accessors:
 //: o 'initialIndentLevel'
@@ -56,6 +57,7 @@ using namespace bsl;
 //: o 'datetimeFractionalSecondPrecision'
 //: o 'maxFloatPrecision'
 //: o 'maxDoublePrecision'
+//: o 'encodeShortestFloatingPoint'
 //
 // Certain standard value-semantic-type test cases are omitted:
 //: o [ 8] -- 'swap' is not implemented for this class.
@@ -90,6 +92,7 @@ using namespace bsl;
 // [ 3] setDatetimeFractionalSecondPrecision(int value);
 // [ 3] setMaxFloatPrecision(int value);
 // [ 3] setMaxDoublePrecision(int value);
+// [ 3] setEncodeShortestFloatingPoint(bool value);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -103,6 +106,7 @@ using namespace bsl;
 // [ 4] int datetimeFractionalSecondPrecision() const;
 // [ 4] maxFloatPrecision() const;
 // [ 4] maxDoublePrecision() const;
+// [ 4] bool encodeShortestFloatingPoint() const;
 //
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 //
@@ -423,6 +427,7 @@ int main(int argc, char *argv[])
     const int  FLOAT_PRECISION           = 3;
     const int  DOUBLE_PRECISION          = 9;
     const bool ENCODE_QUOTED_DECIMAL64   = false;
+    const bool ENCODE_SHORTEST_FP        = true;
 
     baljsn::EncoderOptions options;
     ASSERT(0 == options.initialIndentLevel());
@@ -437,6 +442,7 @@ int main(int argc, char *argv[])
     ASSERT(bsl::numeric_limits<double>::digits10
                                               == options.maxDoublePrecision());
     ASSERT(true == options.encodeQuotedDecimal64());
+    ASSERT(false == options.encodeShortestFloatingPoint());
 //..
 // Next, we populate that object to encode in a pretty format using a
 // pre-defined initial indent level and spaces per level:
@@ -470,6 +476,9 @@ int main(int argc, char *argv[])
 
     options.setEncodeQuotedDecimal64(ENCODE_QUOTED_DECIMAL64);
     ASSERT(ENCODE_QUOTED_DECIMAL64 == options.encodeQuotedDecimal64());
+
+    options.setEncodeShortestFloatingPoint(ENCODE_SHORTEST_FP);
+    ASSERT(ENCODE_SHORTEST_FP == options.encodeShortestFloatingPoint());
 //..
       } break;
       case 12: {
@@ -1292,6 +1301,13 @@ int main(int argc, char *argv[])
         const T10 A10 = true;          // baseline
         const T10 B10 = false;
 
+        // --------------------------------------------------
+        // Attribute 11 Values: 'encodeShortestFloatingPoint'
+        // --------------------------------------------------
+
+        const bool A11 = false;        // baseline
+        const bool B11 = true;
+
         if (verbose) cout <<
             "\nCreate a table of distinct, but similar object values." << endl;
 
@@ -1307,6 +1323,7 @@ int main(int argc, char *argv[])
             int   d_maxFloatPrecision;
             int   d_maxDoublePrecision;
             bool  d_encodeQuotedDecimal64;
+            bool  d_encodeShortestFloatingPoint;
         } DATA[] = {
 
         // The first row of the table below represents an object value
@@ -1314,21 +1331,22 @@ int main(int argc, char *argv[])
         // row differs (slightly) from the first in exactly one attribute value
         // (Bi).
 
-       //LINE INDENT  SPL  STYLE   EEA  ENE  EINAS  DTP MFP  MDP EQD
-       //---- ------  ---  -----   ---  ---  -----  --- ---  --- ---
-
-        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10 }, // base
-                                                                        // line
-        { L_,    B1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10 },
-        { L_,    A1,   B2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10 },
-        { L_,    A1,   A2,   B3,  A4,   A5,    A6,  A7, A8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  B4,   A5,    A6,  A7, A8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   B5,    A6,  A7, A8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   A5,    B6,  A7, A8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  B7, A8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, B8,  A9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  B9, A10 },
-        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, B10 },
+       //LINE INDENT  SPL  STYLE   EEA  ENE  EINAS  DTP MFP  MDP EQD  ESF
+       //---- ------  ---  -----   ---  ---  -----  --- ---  --- ---  ---
+
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10, A11 },
+                                                                   // baseline
+        { L_,    B1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   B2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   B3,  A4,   A5,    A6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  B4,   A5,    A6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   B5,    A6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    B6,  A7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  B7, A8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, B8,  A9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  B9, A10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, B10, A11 },
+        { L_,    A1,   A2,   A3,  A4,   A5,    A6,  A7, A8,  A9, A10, B11 },
 
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -1347,6 +1365,7 @@ int main(int argc, char *argv[])
             const int   MFP1     = DATA[ti].d_maxFloatPrecision;
             const int   MDP1     = DATA[ti].d_maxDoublePrecision;
             const bool  EQD1     = DATA[ti].d_encodeQuotedDecimal64;
+            const bool  ESF1     = DATA[ti].d_encodeShortestFloatingPoint;
 
             if (veryVerbose) { T_ P_(LINE1) P_(INDENT1)
                               P_(SPL1)  P_(STYLE1) P_(EEA1) P_(ENE1) P_(EQD1) }
@@ -1365,6 +1384,7 @@ int main(int argc, char *argv[])
                 mX.setMaxFloatPrecision(MFP1);
                 mX.setMaxDoublePrecision(MDP1);
                 mX.setEncodeQuotedDecimal64(EQD1);
+                mX.setEncodeShortestFloatingPoint(ESF1);
 
                 LOOP2_ASSERT(LINE1, X,   X == X);
                 LOOP2_ASSERT(LINE1, X, !(X != X));
@@ -1382,6 +1402,8 @@ int main(int argc, char *argv[])
                 const int   MFP2     = DATA[tj].d_maxFloatPrecision;
                 const int   MDP2     = DATA[tj].d_maxDoublePrecision;
                 const bool  EQD2     = DATA[tj].d_encodeQuotedDecimal64;
+                const bool  ESF2     =
+                                   DATA[tj].d_encodeShortestFloatingPoint;
 
                 if (veryVerbose) { T_ P_(LINE1) P_(INDENT2)
                                P_(SPL2) P_(STYLE2) P_(EEA2) P_(ENE2) P_(EQD2) }
@@ -1401,6 +1423,7 @@ int main(int argc, char *argv[])
                 mX.setMaxFloatPrecision(MFP1);
                 mX.setMaxDoublePrecision(MDP1);
                 mX.setEncodeQuotedDecimal64(EQD1);
+                mX.setEncodeShortestFloatingPoint(ESF1);
 
                 mY.setInitialIndentLevel(INDENT2);
                 mY.setSpacesPerLevel(SPL2);
@@ -1412,6 +1435,7 @@ int main(int argc, char *argv[])
                 mY.setMaxFloatPrecision(MFP2);
                 mY.setMaxDoublePrecision(MDP2);
                 mY.setEncodeQuotedDecimal64(EQD2);
+                mY.setEncodeShortestFloatingPoint(ESF2);
 
                 if (veryVerbose) { T_ T_ T_ P_(EXP) P_(X) P(Y) }
 
@@ -1554,6 +1578,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     NL
                                  "maxDoublePrecision = 15"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
+                                 "encodeShortestFloatingPoint = false"       NL
                                         "]"                                  NL
                                                                              },
 
@@ -1569,6 +1594,7 @@ int main(int argc, char *argv[])
                                  " maxFloatPrecision = 6"                    NL
                                  " maxDoublePrecision = 15"                  NL
                                  " encodeQuotedDecimal64 = true"             NL
+                                 " encodeShortestFloatingPoint = false"      NL
                                        "]"                                   NL
                                                                              },
 
@@ -1584,6 +1610,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     SP
                                  "maxDoublePrecision = 15"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
+                                 "encodeShortestFloatingPoint = false"       SP
                                        "]"
                                                                              },
 
@@ -1606,6 +1633,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     NL
                                  "maxDoublePrecision = 15"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
+                                 "encodeShortestFloatingPoint = false"       NL
                                        "]"                                   NL
                                                                              },
 
@@ -1621,6 +1649,7 @@ int main(int argc, char *argv[])
                          "        maxFloatPrecision = 6"                     NL
                          "        maxDoublePrecision = 15"                   NL
                          "        encodeQuotedDecimal64 = true"              NL
+                         "        encodeShortestFloatingPoint = false"       NL
                                "      ]"                                     NL
                                                                              },
 
@@ -1636,6 +1665,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     SP
                                  "maxDoublePrecision = 15"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
+                                 "encodeShortestFloatingPoint = false"       SP
                                        "]"
                                                                              },
 
@@ -1651,6 +1681,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     NL
                                  "maxDoublePrecision = 15"                   NL
                                  "encodeQuotedDecimal64 = true"              NL
+                                 "encodeShortestFloatingPoint = false"       NL
                                        "]"                                   NL
                                                                              },
 
@@ -1666,6 +1697,7 @@ int main(int argc, char *argv[])
                          "        maxFloatPrecision = 6"                     NL
                          "        maxDoublePrecision = 15"                   NL
                          "        encodeQuotedDecimal64 = true"              NL
+                         "        encodeShortestFloatingPoint = false"       NL
                                "      ]"                                     NL
                                                                              },
 
@@ -1680,6 +1712,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     SP
                                  "maxDoublePrecision = 15"                   SP
                                  "encodeQuotedDecimal64 = false"             SP
+                                 "encodeShortestFloatingPoint = false"       SP
                                        "]"
                                                                              },
 
@@ -1702,6 +1735,7 @@ int main(int argc, char *argv[])
                          "         maxFloatPrecision = 6"                    NL
                          "         maxDoublePrecision = 15"                  NL
                          "         encodeQuotedDecimal64 = true"             NL
+                         "         encodeShortestFloatingPoint = false"      NL
                                "      ]"                                     NL
                                                                              },
 
@@ -1724,6 +1758,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     SP
                                  "maxDoublePrecision = 15"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
+                                 "encodeShortestFloatingPoint = false"       SP
                                  "]" },
 
 { L_, -9, -9,   7,   5,    P,  F,   F,  T,  T,
@@ -1738,6 +1773,7 @@ int main(int argc, char *argv[])
                                  "maxFloatPrecision = 6"                     SP
                                  "maxDoublePrecision = 15"                   SP
                                  "encodeQuotedDecimal64 = true"              SP
+                                 "encodeShortestFloatingPoint = false"       SP
                                  "]" },
 
 #undef NL
@@ -1879,6 +1915,7 @@ int main(int argc, char *argv[])
         const int   D8   = 6;                    // 'maxFloatPrecision'
         const int   D9   = 15;                   // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
+        const bool  D11  = false;          // 'encodeShortestFloatingPoint'
 
                        // ----------------------------
                        // 'A' values: Boundary values.
@@ -1894,6 +1931,7 @@ int main(int argc, char *argv[])
         const int   A8   = 6;                    // 'maxFloatPrecision'
         const int   A9   = 15;                   // 'maxDoublePrecision'
         const bool  A10  = false;                // 'encodeQuotedDecimal64'
+        const bool  A11  = true;           // 'encodeShortestFloatingPoint'
 
         if (verbose) cout << "\nCreate an object." << endl;
 
@@ -1933,6 +1971,11 @@ int main(int argc, char *argv[])
             const T10& encodeQuotedDecimal64 = X.encodeQuotedDecimal64();
             LOOP2_ASSERT(D10, encodeQuotedDecimal64,
                          D10 == encodeQuotedDecimal64);
+
+            const bool encodeShortestFloatingPoint =
+                                             X.encodeShortestFloatingPoint();
+            LOOP2_ASSERT(D11, encodeShortestFloatingPoint,
+                         D11 == encodeShortestFloatingPoint);
         }
 
         if (verbose) cout <<
@@ -2019,6 +2062,16 @@ int main(int argc, char *argv[])
             LOOP2_ASSERT(A10, encodeQuotedDecimal64,
                          A10 == encodeQuotedDecimal64);
         }
+
+        if (veryVerbose) { T_ Q(encodeShortestFloatingPoint) }
+        {
+            mX.setEncodeShortestFloatingPoint(A11);
+
+            const bool encodeShortestFloatingPoint =
+                                             X.encodeShortestFloatingPoint();
+            LOOP2_ASSERT(A11, encodeShortestFloatingPoint,
+                         A11 == encodeShortestFloatingPoint);
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -2091,6 +2144,7 @@ int main(int argc, char *argv[])
         const int   D8   = 6;                    // 'maxFloatPrecision'
         const int   D9   = 15;                   // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
+        const bool  D11  = false;          // 'encodeShortestFloatingPoint'
         // 'A' values.
 
         const int   A1   = 1;                    // 'initialIndentLevel'
@@ -2103,6 +2157,7 @@ int main(int argc, char *argv[])
         const int   A8   = 6;                    // 'maxFloatPrecision'
         const int   A9   = 15;                   // 'maxDoublePrecision'
         const bool  A10  = false;                // 'encodeQuotedDecimal64'
+        const bool  A11  = true;           // 'encodeShortestFloatingPoint'
 
         // 'B' values.
 
@@ -2116,6 +2171,7 @@ int main(int argc, char *argv[])
         const int   B8   = 3;                    // 'maxFloatPrecision'
         const int   B9   = 9;                    // 'maxDoublePrecision'
         const bool  B10  = false;                // 'encodeQuotedDecimal64'
+        const bool  B11  = false;          // 'encodeShortestFloatingPoint'
 
         Obj mX;  const Obj& X = mX;
 
@@ -2532,6 +2588,23 @@ int main(int argc, char *argv[])
             ASSERT(D10 == X.encodeQuotedDecimal64());
         }
 
+        // -----------------------------
+        // 'encodeShortestFloatingPoint'
+        // -----------------------------
+        {
+            mX.setEncodeShortestFloatingPoint(A11);
+            ASSERT(D10 == X.encodeQuotedDecimal64());
+            ASSERT(A11 == X.encodeShortestFloatingPoint());
+
+            mX.setEncodeShortestFloatingPoint(B11);
+            ASSERT(D10 == X.encodeQuotedDecimal64());
+            ASSERT(B11 == X.encodeShortestFloatingPoint());
+
+            mX.setEncodeShortestFloatingPoint(D11);
+            ASSERT(D10 == X.encodeQuotedDecimal64());
+            ASSERT(D11 == X.encodeShortestFloatingPoint());
+        }
+
         if (verbose) cout << "Corroborate attribute independence." << endl;
         {
             // ---------------------------------------
@@ -2688,6 +2761,14 @@ int main(int argc, char *argv[])
             ASSERT(B8  == X.maxFloatPrecision());
             ASSERT(B9  == X.maxDoublePrecision());
             ASSERT(B10 == X.encodeQuotedDecimal64());
+
+            mX.setEncodeShortestFloatingPoint(A11);
+            ASSERT(B10 == X.encodeQuotedDecimal64());
+            ASSERT(A11 == X.encodeShortestFloatingPoint());
+
+            mX.setEncodeShortestFloatingPoint(B11);
+            ASSERT(B10 == X.encodeQuotedDecimal64());
+            ASSERT(B11 == X.encodeShortestFloatingPoint());
         }
 
         if (verbose) cout << "\nNegative Testing." << endl;
@@ -2762,6 +2843,7 @@ int main(int argc, char *argv[])
         const int   D8   = 6;                    // 'maxFloatPrecision'
         const int   D9   = 15;                   // 'maxDoublePrecision'
         const bool  D10  = true;                 // 'encodeQuotedDecimal64'
+        const bool  D11  = false;          // 'encodeShortestFloatingPoint'
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -2787,6 +2869,8 @@ int main(int argc, char *argv[])
         LOOP2_ASSERT(D9, X.maxDoublePrecision(), D9 == X.maxDoublePrecision());
         LOOP2_ASSERT(D10, X.maxDoublePrecision(),
                           D10 == X.encodeQuotedDecimal64());
+        LOOP2_ASSERT(D11, X.encodeShortestFloatingPoint(),
+                          D11 == X.encodeShortestFloatingPoint());
       } break;
       case 1: {
         // --------------------------------------------------------------------
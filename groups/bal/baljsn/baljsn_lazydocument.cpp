@@ -0,0 +1,692 @@
+// baljsn_lazydocument.cpp                                            -*-C++-*-
+#include <baljsn_lazydocument.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <baljsn_parserutil.h>
+
+#include <bdlb_numericparseutil.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+
+#include <bslma_default.h>
+
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_unordered_set.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+namespace {
+
+// LOCAL METHODS
+inline
+const char *skipWhitespace(const char *iter, const char *end)
+    // Return the address of the first character in the range '[iter, end)'
+    // that is not JSON whitespace, and 'end' if there is none.
+{
+    while (iter < end
+        && (' ' == *iter || '\n' == *iter || '\r' == *iter || '\t' == *iter)) {
+        ++iter;
+    }
+    return iter;
+}
+
+inline
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is a decimal digit, and
+    // 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+inline
+bool isHexDigit(char character)
+    // Return 'true' if the specified 'character' is a hexadecimal digit, and
+    // 'false' otherwise.
+{
+    return isDigit(character)
+        || ('a' <= character && character <= 'f')
+        || ('A' <= character && character <= 'F');
+}
+
+const char *scanString(bool *hasEscapes, const char *iter, const char *end)
+    // Return the address one past the closing quote of the JSON string whose
+    // opening quote is at the specified 'iter', and 0 if the range
+    // '[iter, end)' does not start with a valid JSON string.  Load into the
+    // specified 'hasEscapes' 'true' if the string contains an escape sequence,
+    // and 'false' otherwise.
+{
+    *hasEscapes = false;
+
+    ++iter;
+    while (iter < end) {
+        const unsigned char character = static_cast<unsigned char>(*iter);
+
+        if ('"' == character) {
+            return iter + 1;                                          // RETURN
+        }
+
+        if (character < 0x20) {
+            return 0;                                                 // RETURN
+        }
+
+        if ('\\' != character) {
+            ++iter;
+            continue;                                               // CONTINUE
+        }
+
+        *hasEscapes = true;
+        if (++iter == end) {
+            return 0;                                                 // RETURN
+        }
+
+        switch (*iter) {
+          case '"':
+          case '\\':
+          case '/':
+          case 'b':
+          case 'f':
+          case 'n':
+          case 'r':
+          case 't': {
+            ++iter;
+          } break;
+          case 'u': {
+            if (end - iter < 5) {
+                return 0;                                             // RETURN
+            }
+            for (int i = 1; i <= 4; ++i) {
+                if (!isHexDigit(iter[i])) {
+                    return 0;                                         // RETURN
+                }
+            }
+            iter += 5;
+          } break;
+          default: {
+            return 0;                                                 // RETURN
+          }
+        }
+    }
+    return 0;
+}
+
+const char *scanNumber(const char *iter, const char *end)
+    // Return the address one past the end of the JSON number starting at the
+    // specified 'iter', and 0 if the range '[iter, end)' does not start with
+    // a valid JSON number.
+{
+    if (iter < end && '-' == *iter) {
+        ++iter;
+    }
+
+    if (iter == end || !isDigit(*iter)) {
+        return 0;                                                     // RETURN
+    }
+
+    if ('0' == *iter) {
+        ++iter;
+    }
+    else {
+        while (iter < end && isDigit(*iter)) {
+            ++iter;
+        }
+    }
+
+    if (iter < end && '.' == *iter) {
+        ++iter;
+        if (iter == end || !isDigit(*iter)) {
+            return 0;                                                 // RETURN
+        }
+        while (iter < end && isDigit(*iter)) {
+            ++iter;
+        }
+    }
+
+    if (iter < end && ('e' == *iter || 'E' == *iter)) {
+        ++iter;
+        if (iter < end && ('+' == *iter || '-' == *iter)) {
+            ++iter;
+        }
+        if (iter == end || !isDigit(*iter)) {
+            return 0;                                                 // RETURN
+        }
+        while (iter < end && isDigit(*iter)) {
+            ++iter;
+        }
+    }
+
+    return iter;
+}
+
+const char *scanLiteral(const char *iter, const char *end, const char *literal)
+    // Return the address one past the end of the specified 'literal' if the
+    // range starting at the specified 'iter' and ending at the specified
+    // 'end' starts with 'literal', and 0 otherwise.
+{
+    const bsl::size_t length = bsl::strlen(literal);
+
+    if (static_cast<bsl::size_t>(end - iter) < length
+     || 0 != bsl::memcmp(iter, literal, length)) {
+        return 0;                                                     // RETURN
+    }
+    return iter + length;
+}
+
+}  // close unnamed namespace
+
+                            // ------------------
+                            // class LazyDocument
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+void LazyDocument::pushEntry(int         type,
+                             const char *begin,
+                             const char *end,
+                             Uint32      size)
+{
+    Entry entry;
+    entry.d_offset = static_cast<Uint32>(begin - d_text_p);
+    entry.d_length = static_cast<Uint32>(end - begin);
+    entry.d_next   = static_cast<Uint32>(d_tape.size() + 1);
+    entry.d_size   = size;
+    entry.d_type   = type;
+
+    d_tape.push_back(entry);
+}
+
+const char *LazyDocument::indexMemberName(const char *iter, const char *end)
+{
+    bool        hasEscapes;
+    const char *nameEnd = iter < end && '"' == *iter
+                        ? scanString(&hasEscapes, iter, end)
+                        : 0;
+    if (!nameEnd) {
+        return 0;                                                     // RETURN
+    }
+    pushEntry(LazyValue::e_STRING, iter, nameEnd, hasEscapes);
+
+    iter = skipWhitespace(nameEnd, end);
+    if (iter == end || ':' != *iter) {
+        return 0;                                                     // RETURN
+    }
+    return iter + 1;
+}
+
+// CREATORS
+LazyDocument::LazyDocument(bslma::Allocator *basicAllocator)
+: d_tape(basicAllocator)
+, d_openEntries(basicAllocator)
+, d_text_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// MANIPULATORS
+int LazyDocument::parse(bsl::ostream             *errorStream,
+                        const bslstl::StringRef&  text)
+{
+    reset();
+
+    if (text.length() >= 0xFFFFFFFFu) {
+        if (errorStream) {
+            *errorStream << "Document too large: " << text.length()
+                         << " bytes\n";
+        }
+        return -1;                                                    // RETURN
+    }
+
+    d_text_p = text.data();
+
+    const char *iter = text.data();
+    const char *end  = text.data() + text.length();
+
+    // Typical JSON documents have at least one value per eight characters.
+    // Reserving the tape accordingly avoids, in the common case, repeatedly
+    // reallocating a large tape, which a sequential allocator cannot reuse.
+
+    d_tape.reserve(text.length() / 8 + 1);
+
+    const char *error = 0;
+
+    // Each iteration of the outer loop indexes one value starting at 'iter'
+    // (opening, if the value is an array or object, the container), and then,
+    // if the value is complete, closes each array and object that ends
+    // after it.
+
+    while (!error) {
+        iter = skipWhitespace(iter, end);
+        if (iter == end) {
+            error = "Expected a value";
+            break;                                                     // BREAK
+        }
+
+        bool isComplete = true;  // 'false' if an empty container is open
+
+        if ('{' == *iter || '[' == *iter) {
+            if (d_openEntries.size() >= k_MAX_NESTING_DEPTH) {
+                error = "Maximum nesting depth exceeded";
+                break;                                                 // BREAK
+            }
+
+            const bool isObject = '{' == *iter;
+            d_openEntries.push_back(static_cast<Uint32>(d_tape.size()));
+            pushEntry(isObject ? LazyValue::e_OBJECT : LazyValue::e_ARRAY,
+                      iter,
+                      iter + 1,
+                      0);
+
+            iter = skipWhitespace(iter + 1, end);
+            if (iter == end || (isObject ? '}' : ']') != *iter) {
+                if (isObject) {
+                    const char *valueBegin = indexMemberName(iter, end);
+                    if (valueBegin) {
+                        iter = valueBegin;
+                    }
+                    else {
+                        error = "Expected a member name";
+                    }
+                }
+                continue;                                           // CONTINUE
+            }
+            isComplete = false;
+        }
+        else {
+            const char *valueEnd = 0;
+            bool        hasEscapes;
+
+            switch (*iter) {
+              case '"': {
+                valueEnd = scanString(&hasEscapes, iter, end);
+                if (valueEnd) {
+                    pushEntry(LazyValue::e_STRING, iter, valueEnd, hasEscapes);
+                }
+              } break;
+              case 't': {
+                valueEnd = scanLiteral(iter, end, "true");
+                if (valueEnd) {
+                    pushEntry(LazyValue::e_BOOLEAN, iter, valueEnd, 0);
+                }
+              } break;
+              case 'f': {
+                valueEnd = scanLiteral(iter, end, "false");
+                if (valueEnd) {
+                    pushEntry(LazyValue::e_BOOLEAN, iter, valueEnd, 0);
+                }
+              } break;
+              case 'n': {
+                valueEnd = scanLiteral(iter, end, "null");
+                if (valueEnd) {
+                    pushEntry(LazyValue::e_NULL, iter, valueEnd, 0);
+                }
+              } break;
+              default: {
+                valueEnd = scanNumber(iter, end);
+                if (valueEnd) {
+                    pushEntry(LazyValue::e_NUMBER, iter, valueEnd, 0);
+                }
+              } break;
+            }
+
+            if (!valueEnd) {
+                error = "Invalid value";
+                break;                                                 // BREAK
+            }
+            iter = valueEnd;
+        }
+
+        // Unless an empty container is open, a value has been completed.
+        // Count it as an element of the enclosing container, if any, and
+        // close each container that ends after it.
+
+        while (true) {
+            if (isComplete) {
+                if (d_openEntries.empty()) {
+                    iter = skipWhitespace(iter, end);
+                    if (iter != end) {
+                        error = "Unexpected text after the document";
+                    }
+                    break;                                             // BREAK
+                }
+
+                ++d_tape[d_openEntries.back()].d_size;
+
+                iter = skipWhitespace(iter, end);
+                if (iter < end && ',' == *iter) {
+                    iter = skipWhitespace(iter + 1, end);
+                    const Entry& container = d_tape[d_openEntries.back()];
+                    if (LazyValue::e_OBJECT == container.d_type) {
+                        const char *valueBegin = indexMemberName(iter, end);
+                        if (valueBegin) {
+                            iter = valueBegin;
+                        }
+                        else {
+                            error = "Expected a member name";
+                        }
+                    }
+                    break;                                             // BREAK
+                }
+            }
+
+            Entry&     container = d_tape[d_openEntries.back()];
+            const char closing   = LazyValue::e_OBJECT == container.d_type
+                                 ? '}'
+                                 : ']';
+            if (iter == end || closing != *iter) {
+                error = LazyValue::e_OBJECT == container.d_type
+                      ? "Expected ',' or '}'"
+                      : "Expected ',' or ']'";
+                break;                                                 // BREAK
+            }
+
+            ++iter;
+            container.d_length = static_cast<Uint32>(iter - d_text_p)
+                               - container.d_offset;
+            container.d_next   = static_cast<Uint32>(d_tape.size());
+            d_openEntries.pop_back();
+
+            isComplete = true;
+        }
+
+        if (d_openEntries.empty()) {
+            break;                                                     // BREAK
+        }
+    }
+
+    if (error) {
+        if (errorStream) {
+            *errorStream << error << " at offset " << (iter - text.data())
+                         << '\n';
+        }
+        reset();
+        return -1;                                                    // RETURN
+    }
+
+    d_openEntries.clear();
+    return 0;
+}
+
+void LazyDocument::reset()
+{
+    bsl::vector<Entry>(d_tape.get_allocator()).swap(d_tape);
+    bsl::vector<Uint32>(d_openEntries.get_allocator()).swap(d_openEntries);
+    d_text_p = 0;
+}
+
+                              // ---------------
+                              // class LazyValue
+                              // ---------------
+
+// PRIVATE ACCESSORS
+int LazyValue::materializeImpl(bdld::Datum      *result,
+                               bslma::Allocator *allocator) const
+{
+    const Entry& e = entry();
+
+    switch (e.d_type) {
+      case e_NULL: {
+        *result = bdld::Datum::createNull();
+      } break;
+      case e_BOOLEAN: {
+        bool value;
+        getValue(&value);
+        *result = bdld::Datum::createBoolean(value);
+      } break;
+      case e_NUMBER: {
+        double value;
+        if (0 != getValue(&value)) {
+            return -1;                                                // RETURN
+        }
+        *result = bdld::Datum::createDouble(value);
+      } break;
+      case e_STRING: {
+        if (e.d_size) {
+            bsl::string value(allocator);
+            if (0 != getValue(&value)) {
+                return -1;                                            // RETURN
+            }
+            *result = bdld::Datum::copyString(value, allocator);
+        }
+        else {
+            const bslstl::StringRef text = rawText();
+            *result = bdld::Datum::copyString(text.data() + 1,
+                                              text.length() - 2,
+                                              allocator);
+        }
+      } break;
+      case e_ARRAY: {
+        bdld::DatumArrayBuilder builder(e.d_size, allocator);
+
+        for (LazyValue element = first(); element.isValid();
+                                                   element = element.next()) {
+            bdld::Datum value;
+            if (0 != element.materializeImpl(&value, allocator)) {
+                return -1;                                            // RETURN
+            }
+            builder.pushBack(value);
+        }
+        *result = builder.commit();
+      } break;
+      case e_OBJECT: {
+        bdld::DatumMapOwningKeysBuilder builder(allocator);
+        bsl::unordered_set<bsl::string> names(allocator);
+        bsl::string                     name(allocator);
+
+        for (LazyValue member = first(); member.isValid();
+                                                     member = member.next()) {
+            if (0 != LazyValue(d_document_p,
+                               member.d_index - 1,
+                               k_NO_PARENT).getValue(&name)) {
+                return -1;                                            // RETURN
+            }
+
+            // Keep the *first* member having any given name, as
+            // 'DatumUtil::decode' does.
+
+            if (!names.insert(name).second) {
+                continue;                                           // CONTINUE
+            }
+
+            bdld::Datum value;
+            if (0 != member.materializeImpl(&value, allocator)) {
+                return -1;                                            // RETURN
+            }
+            builder.pushBack(name, value);
+        }
+        *result = builder.commit();
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(!"Unreachable");
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+// ACCESSORS
+LazyValue LazyValue::element(int index) const
+{
+    if (index < 0 || index >= size()) {
+        return LazyValue();                                           // RETURN
+    }
+
+    LazyValue result = first();
+    while (index--) {
+        result = result.next();
+    }
+    return result;
+}
+
+LazyValue LazyValue::name(int index) const
+{
+    if (!isObject()) {
+        return LazyValue();                                           // RETURN
+    }
+
+    const LazyValue member = element(index);
+    if (!member.isValid()) {
+        return LazyValue();                                           // RETURN
+    }
+    return LazyValue(d_document_p, member.d_index - 1, k_NO_PARENT);
+}
+
+LazyValue LazyValue::find(const bslstl::StringRef& memberName) const
+{
+    if (!isObject()) {
+        return LazyValue();                                           // RETURN
+    }
+
+    const Entry *tape = d_document_p->d_tape.data();
+    const char  *text = d_document_p->d_text_p;
+    bsl::string  name(d_document_p->d_allocator_p);
+
+    for (Uint32 i = d_index + 1; i < tape[d_index].d_next;
+                                                   i = tape[i + 1].d_next) {
+        const Entry& nameEntry = tape[i];
+
+        if (0 == nameEntry.d_size) {
+            // The name has no escape sequences: compare its text, excluding
+            // the quotes, directly.
+
+            if (nameEntry.d_length - 2 == memberName.length()
+             && 0 == bsl::memcmp(text + nameEntry.d_offset + 1,
+                                 memberName.data(),
+                                 memberName.length())) {
+                return LazyValue(d_document_p, i + 1, d_index);       // RETURN
+            }
+        }
+        else if (0 == LazyValue(d_document_p, i, k_NO_PARENT).getValue(&name)
+              && name == memberName) {
+            return LazyValue(d_document_p, i + 1, d_index);           // RETURN
+        }
+    }
+    return LazyValue();
+}
+
+LazyValue LazyValue::first() const
+{
+    if (0 == size()) {
+        return LazyValue();                                           // RETURN
+    }
+
+    // The first member of an object is its name, followed by its value.
+
+    return LazyValue(d_document_p,
+                     d_index + (isObject() ? 2 : 1),
+                     d_index);
+}
+
+LazyValue LazyValue::next() const
+{
+    if (!d_document_p || k_NO_PARENT == d_parent) {
+        return LazyValue();                                           // RETURN
+    }
+
+    const Entry& parent = d_document_p->d_tape[d_parent];
+    const Uint32 index  = entry().d_next;
+
+    if (index >= parent.d_next) {
+        return LazyValue();                                           // RETURN
+    }
+
+    return LazyValue(d_document_p,
+                     index + (e_OBJECT == parent.d_type ? 1 : 0),
+                     d_parent);
+}
+
+int LazyValue::getValue(bool *value) const
+{
+    BSLS_ASSERT(value);
+
+    if (!isBoolean()) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = 't' == d_document_p->d_text_p[entry().d_offset];
+    return 0;
+}
+
+int LazyValue::getValue(double *value) const
+{
+    BSLS_ASSERT(value);
+
+    if (!isNumber()) {
+        return -1;                                                    // RETURN
+    }
+
+    double            result;
+    bslstl::StringRef remainder;
+    if (0 != bdlb::NumericParseUtil::parseDouble(&result,
+                                                 &remainder,
+                                                 rawText())
+     || 0 != remainder.length()) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = result;
+    return 0;
+}
+
+int LazyValue::getValue(bsl::string *value) const
+{
+    BSLS_ASSERT(value);
+
+    if (!isString()) {
+        return -1;                                                    // RETURN
+    }
+
+    const bslstl::StringRef text = rawText();
+
+    if (0 == entry().d_size) {
+        value->assign(text.data() + 1, text.length() - 2);
+        return 0;                                                     // RETURN
+    }
+    return ParserUtil::getValue(value, text);
+}
+
+int LazyValue::materialize(bdld::Datum *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!d_document_p) {
+        return -1;                                                    // RETURN
+    }
+    return materializeImpl(result, d_document_p->d_allocator_p);
+}
+
+int LazyValue::materialize(bdld::ManagedDatum *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!d_document_p) {
+        return -1;                                                    // RETURN
+    }
+
+    bdld::Datum value;
+    if (0 != materializeImpl(&value, result->allocator())) {
+        return -1;                                                    // RETURN
+    }
+    result->adopt(value);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
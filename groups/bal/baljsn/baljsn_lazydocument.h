@@ -0,0 +1,638 @@
+// baljsn_lazydocument.h                                              -*-C++-*-
+#ifndef INCLUDED_BALJSN_LAZYDOCUMENT
+#define INCLUDED_BALJSN_LAZYDOCUMENT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an indexed JSON document materialized lazily as 'Datum'.
+//
+//@CLASSES:
+//  baljsn::LazyDocument: one-pass index ("tape") of a JSON document
+//  baljsn::LazyValue: cursor referring to a value in a 'LazyDocument'
+//
+//@SEE_ALSO: baljsn_datumutil
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::LazyDocument', that
+// indexes a JSON document, in a single pass over its text, into a compact
+// array of fixed-size entries (a "tape"), and a class, 'baljsn::LazyValue',
+// that refers to a value in an indexed document.  Values are inspected through
+// the tape -- their types, the number of elements of arrays and objects, the
+// value of an object member having a given name -- and a 'bdld::Datum' is
+// built only for the values (and subtrees) that are actually accessed, by
+// 'LazyValue::materialize'.  Code that examines only a few fields of each
+// message thereby avoids the per-node allocations of decoding the whole
+// message with 'baljsn::DatumUtil::decode'.
+//
+// Each entry of the tape records the type of a value, the position of its text
+// in the document, and, for an array or object, the number of its elements and
+// the index of the entry following its last descendant, so that a value can be
+// skipped in constant time.  The members of an object are recorded as the
+// entry for the (string) name of each member, followed by the entries for its
+// value.  Strings and numbers are not converted while indexing: they are only
+// validated, and are converted when they are accessed.
+//
+// The text supplied to 'LazyDocument::parse' is *not* copied: it must remain
+// valid, and unmodified, for as long as the document (or any 'LazyValue'
+// referring to it) is used.
+//
+///Memory Management
+///-----------------
+// A 'LazyDocument' takes all of its memory -- the tape, and the 'bdld::Datum'
+// values materialized by 'LazyValue::materialize(bdld::Datum *)' -- from the
+// allocator supplied at construction, and never destroys the values that it
+// materializes.  It is intended to be used with a sequential allocator, such
+// as a 'bdlma::SequentialAllocator' (or, for messages of bounded size, a
+// 'bdlma::BufferedSequentialAllocator' over a local buffer), that is owned by
+// the caller and serves a single message: once the document has been reset
+// (or destroyed), all of the memory used for the message can be reclaimed at
+// once, in constant time, by releasing the allocator, without visiting any
+// materialized 'Datum'.  Values that must outlive the message can be
+// materialized into a 'bdld::ManagedDatum' instead, using its allocator.
+//
+///Decoding Rules
+///--------------
+// A value materialized from a 'LazyDocument' is equal to the corresponding
+// value decoded by 'baljsn::DatumUtil::decode': a JSON number is represented
+// by a 'double', a string by a string 'Datum' (copied from the text, with its
+// escape sequences decoded), 'true' and 'false' by a boolean 'Datum', 'null'
+// by a null 'Datum', an array by an array 'Datum', and an object by a map
+// (owning keys) 'Datum' whose entries are in the order of the members in the
+// text.  If an object has several members having the same name, only the
+// *first* of them is materialized, and is the one found by 'LazyValue::find'.
+// Unlike 'DatumUtil::decode', which copies member names verbatim, escape
+// sequences in member names are decoded (both when materializing and by
+// 'find').
+//
+// 'parse' verifies that the text is a single, syntactically valid, JSON value
+// (optionally surrounded by whitespace).  It does not verify that strings are
+// valid UTF-8.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing Messages Based on a Few Fields
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we route JSON messages based on two of their fields: the
+// 'type' of a message, and the 'region' in its 'header'.  Only messages of
+// type "order" have a 'body' that we need as a 'bdld::Datum'.
+//
+// First, we create a sequential allocator for the message, and a document
+// that takes its memory from that allocator:
+//..
+//  bdlma::SequentialAllocator arena;
+//  baljsn::LazyDocument       document(&arena);
+//..
+// Then, we index a message:
+//..
+//  const char *message =
+//      "{"
+//      "  \"header\": { \"id\": 17, \"region\": \"EMEA\", \"tags\": [] },"
+//      "  \"type\": \"order\","
+//      "  \"body\": { \"symbol\": \"IBM\", \"quantity\": 100 },"
+//      "  \"trailer\": [ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 ]"
+//      "}";
+//
+//  int rc = document.parse(message);
+//  assert(0 == rc);
+//..
+// Next, we inspect the two fields that we route on; no 'Datum' is created:
+//..
+//  baljsn::LazyValue root = document.root();
+//  assert(root.isObject());
+//  assert(4 == root.size());
+//
+//  bsl::string type(&arena);
+//  rc = root.find("type").getValue(&type);
+//  assert(0       == rc);
+//  assert("order" == type);
+//
+//  baljsn::LazyValue region = root.find("header").find("region");
+//  assert(region.isString());
+//  assert("\"EMEA\"" == region.rawText());
+//..
+// Then, we materialize the body of the order, and only the body, as a
+// 'bdld::Datum':
+//..
+//  bdld::Datum body;
+//  rc = root.find("body").materialize(&body);
+//  assert(0 == rc);
+//  assert(body.isMap());
+//  assert(2     == body.theMap().size());
+//  assert("IBM" == body.theMap().find("symbol")->theString());
+//  assert(100.0 == body.theMap().find("quantity")->theDouble());
+//..
+// Finally, having processed the message, we release all of the memory used for
+// it -- the tape and the materialized body -- at once.  Note that 'body' is
+// not destroyed; its memory is simply reclaimed with the rest of the arena:
+//..
+//  document.reset();
+//  arena.release();
+//..
+
+
+#include <balscm_version.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+class LazyValue;
+
+                            // ==================
+                            // class LazyDocument
+                            // ==================
+
+class LazyDocument {
+    // This class provides a mechanism that indexes the text of a JSON document
+    // into a tape of fixed-size entries, from which the values of the document
+    // can be inspected, through 'LazyValue' objects, and materialized as
+    // 'bdld::Datum' objects on demand.  The text of the document is referred
+    // to, not copied.
+
+    // PRIVATE TYPES
+    typedef bsl::uint32_t Uint32;
+
+    struct Entry {
+        // This 'struct' describes one value of the document.
+
+        Uint32 d_offset;  // offset of the first character of the value in
+                          // the text
+
+        Uint32 d_length;  // length of the text of the value
+
+        Uint32 d_next;    // index of the entry following the value and all
+                          // of its descendants
+
+        Uint32 d_size;    // number of elements of an array or members of an
+                          // object, or, for a string, 1 if it contains an
+                          // escape sequence and 0 otherwise
+
+        int    d_type;    // 'LazyValue::Type' of the value
+    };
+
+    // DATA
+    bsl::vector<Entry>   d_tape;         // entries, in document order
+    bsl::vector<Uint32>  d_openEntries;  // indices of the arrays and objects
+                                         // that are open during 'parse'
+
+    const char          *d_text_p;       // text of the document (held, not
+                                         // owned)
+
+    bslma::Allocator    *d_allocator_p;  // memory allocator (held, not owned)
+
+    // FRIENDS
+    friend class LazyValue;
+
+    // PRIVATE MANIPULATORS
+    void pushEntry(int type, const char *begin, const char *end, Uint32 size);
+        // Append to the tape an entry for a value of the specified 'type'
+        // whose text is in the range '[begin, end)', and having the specified
+        // 'size'.
+
+    const char *indexMemberName(const char *iter, const char *end);
+        // Append to the tape an entry for the name of an object member
+        // starting at the specified 'iter', and return the address one past
+        // the ':' following the name, or 0 if the range '[iter, end)' does
+        // not start with a JSON string followed by (optional whitespace and)
+        // a ':'.
+
+  private:
+    // NOT IMPLEMENTED
+    LazyDocument(const LazyDocument&);
+    LazyDocument& operator=(const LazyDocument&);
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_NESTING_DEPTH = 512  // maximum nesting depth of the arrays and
+                                   // objects of a document
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LazyDocument, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit LazyDocument(bslma::Allocator *basicAllocator = 0);
+        // Create an empty document.  Optionally specify a 'basicAllocator'
+        // used to supply memory, both for the tape and for the values
+        // materialized by 'LazyValue::materialize(bdld::Datum *)'.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that a sequential allocator owned by the caller is
+        // recommended (see {Memory Management}).
+
+    //! ~LazyDocument() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int parse(const bslstl::StringRef& text);
+    int parse(bsl::ostream *errorStream, const bslstl::StringRef& text);
+        // Index the JSON document in the specified 'text', replacing any
+        // document previously indexed by this object.  Optionally specify an
+        // 'errorStream' to which a description of the error, if any, is
+        // written.  Return 0 on success, and a non-zero value, leaving this
+        // document empty, if 'text' is not a single, syntactically valid, JSON
+        // value (optionally surrounded by whitespace), or if its arrays and
+        // objects are nested more deeply than 'k_MAX_NESTING_DEPTH'.  The
+        // behavior is undefined unless the characters of 'text' remain valid,
+        // and unmodified, until this document is reset, destroyed, or indexes
+        // another document.
+
+    void reset();
+        // Discard the document indexed by this object, if any, and return the
+        // memory of its tape to the allocator of this object.  Note that
+        // values materialized from the document are not affected.
+
+    // ACCESSORS
+    bool isEmpty() const;
+        // Return 'true' if this object has no indexed document, and 'false'
+        // otherwise.
+
+    bsl::size_t numEntries() const;
+        // Return the number of entries in the tape of this document, that is,
+        // the number of values in the document, including the names of the
+        // members of objects.
+
+    LazyValue root() const;
+        // Return the top-level value of this document.  The behavior is
+        // undefined if 'isEmpty()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                              // ===============
+                              // class LazyValue
+                              // ===============
+
+class LazyValue {
+    // This in-core value-semantic class provides a cursor that refers to a
+    // value of a 'LazyDocument', or to no value (in which case the cursor is
+    // *invalid*).  Accessors that return a 'LazyValue' return an invalid one,
+    // rather than having undefined behavior, if the value they look up does
+    // not exist, so that lookups can be chained.  A 'LazyValue' is valid only
+    // as long as the document that it refers to is neither reset, destroyed,
+    // nor used to index another document.
+
+  public:
+    // TYPES
+    enum Type {
+        // This enumeration defines the types of JSON values.
+
+        e_NULL,
+        e_BOOLEAN,
+        e_NUMBER,
+        e_STRING,
+        e_ARRAY,
+        e_OBJECT
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef LazyDocument::Entry  Entry;
+    typedef bsl::uint32_t        Uint32;
+
+    // PRIVATE CONSTANTS
+    static const Uint32 k_NO_PARENT = 0xFFFFFFFF;
+
+    // DATA
+    const LazyDocument *d_document_p;  // referenced document, or 0 if this
+                                       // value is invalid
+
+    Uint32              d_index;       // index of the entry of this value
+
+    Uint32              d_parent;      // index of the entry of the array or
+                                       // object of which this value is an
+                                       // element or member value, or
+                                       // 'k_NO_PARENT'
+
+    // FRIENDS
+    friend class LazyDocument;
+    friend bool operator==(const LazyValue&, const LazyValue&);
+
+    // PRIVATE CREATORS
+    LazyValue(const LazyDocument *document, Uint32 index, Uint32 parent);
+        // Create a value referring to the value described by the entry having
+        // the specified 'index' in the specified 'document', that is an
+        // element or member value of the array or object described by the
+        // entry having the specified 'parent' index, if 'parent' is not
+        // 'k_NO_PARENT'.
+
+    // PRIVATE ACCESSORS
+    const Entry& entry() const;
+        // Return a reference providing non-modifiable access to the entry of
+        // this value.  The behavior is undefined unless this value is valid.
+
+    int materializeImpl(bdld::Datum      *result,
+                        bslma::Allocator *allocator) const;
+        // Load into the specified 'result' this value, using the specified
+        // 'allocator' to supply memory.  Return 0 on success, and a non-zero
+        // value, with no memory remaining allocated, otherwise.  The behavior
+        // is undefined unless this value is valid.
+
+  public:
+    // CREATORS
+    LazyValue();
+        // Create an invalid value.
+
+    //! LazyValue(const LazyValue& original) = default;
+    //! ~LazyValue() = default;
+    //! LazyValue& operator=(const LazyValue& rhs) = default;
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if this object refers to a value, and 'false'
+        // otherwise.
+
+    Type type() const;
+        // Return the type of this value.  The behavior is undefined unless
+        // this value is valid.
+
+    bool isArray() const;
+    bool isBoolean() const;
+    bool isNull() const;
+    bool isNumber() const;
+    bool isObject() const;
+    bool isString() const;
+        // Return 'true' if this value is valid and of the type indicated by
+        // the name of the method, and 'false' otherwise.
+
+    int size() const;
+        // Return the number of elements of this array, or the number of
+        // members of this object, and 0 if this value is neither an array nor
+        // an object.
+
+    LazyValue element(int index) const;
+        // Return the element having the specified 'index' of this array, or
+        // the value of the member having 'index' of this object, and an
+        // invalid value if this value is neither an array nor an object, or
+        // if 'index' is not in the range '[0, size())'.  Note that this method
+        // runs in time proportional to 'index'; an array or object is best
+        // traversed by 'first' and 'next'.
+
+    LazyValue name(int index) const;
+        // Return the (string) name of the member having the specified 'index'
+        // of this object, and an invalid value if this value is not an
+        // object, or if 'index' is not in the range '[0, size())'.
+
+    LazyValue find(const bslstl::StringRef& memberName) const;
+        // Return the value of the first member of this object having the
+        // specified 'memberName', and an invalid value if this value is not an
+        // object, or has no such member.  Note that this method runs in time
+        // proportional to the number of members of this object.
+
+    LazyValue first() const;
+        // Return the first element of this array, or the value of the first
+        // member of this object, and an invalid value if this value is neither
+        // a non-empty array nor a non-empty object.
+
+    LazyValue next() const;
+        // Return the element of an array following this element, or the value
+        // of the member of an object following this member value, and an
+        // invalid value if this value is the last element or member value, or
+        // is neither an element nor a member value.  Note that 'first' and
+        // 'next' traverse an array or object in constant time per element.
+
+    bslstl::StringRef rawText() const;
+        // Return a reference to the JSON text of this value in the text of
+        // its document (including, for a string, the enclosing quotes), and
+        // an empty reference if this value is invalid.  Note that the text of
+        // an array or object can be supplied to any JSON decoder, such as
+        // 'baljsn::Decoder'.
+
+    int getValue(bool *value) const;
+        // Load into the specified 'value' this boolean value.  Return 0 on
+        // success, and a non-zero value, with no effect on 'value', if this
+        // value is not a valid boolean value.
+
+    int getValue(double *value) const;
+        // Load into the specified 'value' this number.  Return 0 on success,
+        // and a non-zero value, with no effect on 'value', if this value is
+        // not a valid number, or cannot be represented as a 'double'.
+
+    int getValue(bsl::string *value) const;
+        // Load into the specified 'value' this string, with its escape
+        // sequences decoded.  Return 0 on success, and a non-zero value if
+        // this value is not a valid string or cannot be decoded.
+
+    int materialize(bdld::Datum *result) const;
+        // Load into the specified 'result' this value, and all of its
+        // descendants, using the allocator of the document to supply memory
+        // (see {Memory Management}).  Return 0 on success, and a non-zero
+        // value, with no effect on 'result', if this value is invalid or
+        // cannot be decoded.  Note that 'result' is never destroyed by the
+        // document; its memory is reclaimed when the allocator of the
+        // document is released.
+
+    int materialize(bdld::ManagedDatum *result) const;
+        // Load into the specified 'result' this value, and all of its
+        // descendants, using the allocator of 'result' to supply memory.
+        // Return 0 on success, and a non-zero value, with no effect on
+        // 'result', if this value is invalid or cannot be decoded.
+};
+
+// FREE OPERATORS
+bool operator==(const LazyValue& lhs, const LazyValue& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same value
+    // of the same document, or are both invalid, and 'false' otherwise.
+
+bool operator!=(const LazyValue& lhs, const LazyValue& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' do not refer to the same
+    // value of the same document, and are not both invalid, and 'false'
+    // otherwise.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class LazyDocument
+                            // ------------------
+
+// MANIPULATORS
+inline
+int LazyDocument::parse(const bslstl::StringRef& text)
+{
+    return parse(0, text);
+}
+
+// ACCESSORS
+inline
+bool LazyDocument::isEmpty() const
+{
+    return d_tape.empty();
+}
+
+inline
+bsl::size_t LazyDocument::numEntries() const
+{
+    return d_tape.size();
+}
+
+inline
+LazyValue LazyDocument::root() const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    return LazyValue(this, 0, LazyValue::k_NO_PARENT);
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *LazyDocument::allocator() const
+{
+    return d_allocator_p;
+}
+
+                              // ---------------
+                              // class LazyValue
+                              // ---------------
+
+// PRIVATE CREATORS
+inline
+LazyValue::LazyValue(const LazyDocument *document,
+                     Uint32              index,
+                     Uint32              parent)
+: d_document_p(document)
+, d_index(index)
+, d_parent(parent)
+{
+}
+
+// PRIVATE ACCESSORS
+inline
+const LazyValue::Entry& LazyValue::entry() const
+{
+    BSLS_ASSERT(d_document_p);
+
+    return d_document_p->d_tape[d_index];
+}
+
+// CREATORS
+inline
+LazyValue::LazyValue()
+: d_document_p(0)
+, d_index(0)
+, d_parent(k_NO_PARENT)
+{
+}
+
+// ACCESSORS
+inline
+bool LazyValue::isValid() const
+{
+    return 0 != d_document_p;
+}
+
+inline
+LazyValue::Type LazyValue::type() const
+{
+    return static_cast<Type>(entry().d_type);
+}
+
+inline
+bool LazyValue::isArray() const
+{
+    return d_document_p && e_ARRAY == entry().d_type;
+}
+
+inline
+bool LazyValue::isBoolean() const
+{
+    return d_document_p && e_BOOLEAN == entry().d_type;
+}
+
+inline
+bool LazyValue::isNull() const
+{
+    return d_document_p && e_NULL == entry().d_type;
+}
+
+inline
+bool LazyValue::isNumber() const
+{
+    return d_document_p && e_NUMBER == entry().d_type;
+}
+
+inline
+bool LazyValue::isObject() const
+{
+    return d_document_p && e_OBJECT == entry().d_type;
+}
+
+inline
+bool LazyValue::isString() const
+{
+    return d_document_p && e_STRING == entry().d_type;
+}
+
+inline
+int LazyValue::size() const
+{
+    return isArray() || isObject() ? static_cast<int>(entry().d_size) : 0;
+}
+
+inline
+bslstl::StringRef LazyValue::rawText() const
+{
+    if (!d_document_p) {
+        return bslstl::StringRef();                                   // RETURN
+    }
+
+    const Entry& e = entry();
+    return bslstl::StringRef(d_document_p->d_text_p + e.d_offset, e.d_length);
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool baljsn::operator==(const LazyValue& lhs, const LazyValue& rhs)
+{
+    return lhs.d_document_p == rhs.d_document_p && lhs.d_index == rhs.d_index;
+}
+
+inline
+bool baljsn::operator!=(const LazyValue& lhs, const LazyValue& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1150 @@
+// baljsn_lazydocument.t.cpp                                          -*-C++-*-
+#include <baljsn_lazydocument.h>
+
+#include <baljsn_datumutil.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test implements a mechanism that indexes a JSON
+// document into a tape, and a cursor into the tape.  The indexing is a state
+// machine (with an explicit stack of open arrays and objects) that we test by
+// a table of valid and invalid documents, including every kind of truncation
+// and misplaced separator.  The values materialized from the tape must equal
+// those decoded by 'baljsn::DatumUtil::decode', which we use as an oracle.
+// ----------------------------------------------------------------------------
+// LazyDocument
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] LazyDocument(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~LazyDocument();
+//
+// MANIPULATORS
+// [ 2] int parse(const bslstl::StringRef& text);
+// [ 2] int parse(bsl::ostream *errorStream, const bslstl::StringRef& text);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] bool isEmpty() const;
+// [ 2] bsl::size_t numEntries() const;
+// [ 3] LazyValue root() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// LazyValue
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] LazyValue();
+//
+// ACCESSORS
+// [ 3] bool isValid() const;
+// [ 3] Type type() const;
+// [ 3] bool isArray() const;
+// [ 3] bool isBoolean() const;
+// [ 3] bool isNull() const;
+// [ 3] bool isNumber() const;
+// [ 3] bool isObject() const;
+// [ 3] bool isString() const;
+// [ 3] int size() const;
+// [ 3] LazyValue element(int index) const;
+// [ 3] LazyValue name(int index) const;
+// [ 3] LazyValue find(const bslstl::StringRef& memberName) const;
+// [ 3] LazyValue first() const;
+// [ 3] LazyValue next() const;
+// [ 3] bslstl::StringRef rawText() const;
+// [ 4] int getValue(bool *value) const;
+// [ 4] int getValue(double *value) const;
+// [ 4] int getValue(bsl::string *value) const;
+// [ 5] int materialize(bdld::Datum *result) const;
+// [ 5] int materialize(bdld::ManagedDatum *result) const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const LazyValue& lhs, const LazyValue& rhs);
+// [ 3] bool operator!=(const LazyValue& lhs, const LazyValue& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: LAZY ACCESS VS. 'DatumUtil::decode'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::LazyDocument Obj;
+typedef baljsn::LazyValue    Value;
+
+static const char MESSAGE[] =
+    "{"
+    "  \"header\": {"
+    "    \"id\": 17,"
+    "    \"region\": \"EMEA\","
+    "    \"tags\": [ \"a\", \"b\\n\", \"\\u00e9\" ]"
+    "  },"
+    "  \"type\": \"order\","
+    "  \"body\": {"
+    "    \"symbol\": \"IBM\","
+    "    \"quantity\": 100,"
+    "    \"price\": -1.25e2,"
+    "    \"flags\": [ true, false, null ],"
+    "    \"legs\": [ { \"n\": 1 }, { \"n\": 2 }, {} ]"
+    "  },"
+    "  \"n\\u0061me\": \"escaped\","
+    "  \"type\": \"duplicate\""
+    "}";
+    // A message exercising every type of value, nested arrays and objects,
+    // empty containers, escape sequences in names and values, and a duplicate
+    // member name.
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("arena", veryVeryVerbose);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing Messages Based on a Few Fields
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we route JSON messages based on two of their fields: the
+// 'type' of a message, and the 'region' in its 'header'.  Only messages of
+// type "order" have a 'body' that we need as a 'bdld::Datum'.
+//
+// First, we create a sequential allocator for the message, and a document
+// that takes its memory from that allocator:
+//..
+    bdlma::SequentialAllocator arena(&ta);
+    baljsn::LazyDocument       document(&arena);
+//..
+// Then, we index a message:
+//..
+    const char *message =
+        "{"
+        "  \"header\": { \"id\": 17, \"region\": \"EMEA\", \"tags\": [] },"
+        "  \"type\": \"order\","
+        "  \"body\": { \"symbol\": \"IBM\", \"quantity\": 100 },"
+        "  \"trailer\": [ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 ]"
+        "}";
+
+    int rc = document.parse(message);
+    ASSERT(0 == rc);
+//..
+// Next, we inspect the two fields that we route on; no 'Datum' is created:
+//..
+    baljsn::LazyValue root = document.root();
+    ASSERT(root.isObject());
+    ASSERT(4 == root.size());
+
+    bsl::string type(&arena);
+    rc = root.find("type").getValue(&type);
+    ASSERT(0       == rc);
+    ASSERT("order" == type);
+
+    baljsn::LazyValue region = root.find("header").find("region");
+    ASSERT(region.isString());
+    ASSERT("\"EMEA\"" == region.rawText());
+//..
+// Then, we materialize the body of the order, and only the body, as a
+// 'bdld::Datum':
+//..
+    bdld::Datum body;
+    rc = root.find("body").materialize(&body);
+    ASSERT(0 == rc);
+    ASSERT(body.isMap());
+    ASSERT(2     == body.theMap().size());
+    ASSERT("IBM" == body.theMap().find("symbol")->theString());
+    ASSERT(100.0 == body.theMap().find("quantity")->theDouble());
+//..
+// Finally, having processed the message, we release all of the memory used for
+// it -- the tape and the materialized body -- at once.  Note that 'body' is
+// not destroyed; its memory is simply reclaimed with the rest of the arena:
+//..
+    document.reset();
+    arena.release();
+//..
+
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MATERIALIZATION
+        //
+        // Concerns:
+        //: 1 A value materialized from the document equals the value decoded
+        //:   from its text by 'DatumUtil::decode'; in particular, numbers are
+        //:   'double's, escape sequences are decoded, and only the first of
+        //:   several members having the same name is kept.  (Escape sequences
+        //:   in member names, which 'DatumUtil::decode' does not decode, are
+        //:   decoded.)
+        //:
+        //: 2 Any subtree can be materialized independently of the rest of
+        //:   the document.
+        //:
+        //: 3 'materialize(bdld::Datum *)' takes memory from the allocator of
+        //:   the document, and 'materialize(bdld::ManagedDatum *)' from the
+        //:   allocator of the managed datum, which owns the result.
+        //:
+        //: 4 Materializing an invalid value fails without effect.
+        //
+        // Plan:
+        //: 1 For a table of documents, materialize the root, and every
+        //:   element and member value of the root, and compare them with the
+        //:   values decoded by 'DatumUtil::decode' from their 'rawText'.
+        //:   (C-1..2)
+        //:
+        //: 2 Use test allocators to verify where memory is taken from, and
+        //:   that the managed datum releases all of it.  (C-3)
+        //:
+        //: 3 Materialize objects having escape sequences in member names,
+        //:   and verify the names explicitly.  (C-1)
+        //:
+        //: 4 Materialize a default-constructed value.  (C-4)
+        //
+        // Testing:
+        //   int materialize(bdld::Datum *result) const;
+        //   int materialize(bdld::ManagedDatum *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MATERIALIZATION" << endl
+                          << "===============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+        } DATA[] = {
+            { L_, "null"                                                   },
+            { L_, "true"                                                   },
+            { L_, "false"                                                  },
+            { L_, "0"                                                      },
+            { L_, "-12.5e-3"                                               },
+            { L_, "\"\""                                                   },
+            { L_, "\"plain\""                                              },
+            { L_, "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\""                  },
+            { L_, "[]"                                                     },
+            { L_, "{}"                                                     },
+            { L_, "[1,\"two\",[3,[4,[]]],{\"five\":5}]"                    },
+            { L_, "{\"a\":1,\"b\":{\"c\":[true,null]},\"a\":2}"            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *TEXT = DATA[ti].d_text_p;
+
+            if (veryVerbose) { P_(LINE) P(TEXT) }
+
+            bslma::TestAllocator da("document", veryVeryVerbose);
+            bslma::TestAllocator ma("managed",  veryVeryVerbose);
+            bslma::TestAllocator ea("expected", veryVeryVerbose);
+
+            Obj mX(&da);  const Obj& X = mX;
+            ASSERTV(LINE, 0 == mX.parse(TEXT));
+
+            // Collect the root, and its element and member values.
+
+            bsl::vector<Value> values(&ea);
+            values.push_back(X.root());
+            for (Value v = X.root().first(); v.isValid(); v = v.next()) {
+                values.push_back(v);
+            }
+
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                const Value V = values[i];
+
+                bdld::ManagedDatum expected(&ea);
+                ASSERTV(LINE, i, 0 == baljsn::DatumUtil::decode(
+                                                             &expected,
+                                                             V.rawText()));
+
+                bsls::Types::Int64 numBlocks = da.numBlocksInUse();
+
+                bdld::Datum result;
+                ASSERTV(LINE, i, 0 == V.materialize(&result));
+                ASSERTV(LINE, i, expected.datum(), result,
+                        expected.datum() == result);
+
+                ASSERTV(LINE, i, expected.datum().isMap()
+                              || expected.datum().isArray()
+                              || expected.datum().isString()
+                              || numBlocks == da.numBlocksInUse());
+                bdld::Datum::destroy(result, &da);
+                ASSERTV(LINE, i, numBlocks == da.numBlocksInUse());
+
+                numBlocks = da.numBlocksInUse();
+                {
+                    bdld::ManagedDatum managed(&ma);
+                    ASSERTV(LINE, i, 0 == V.materialize(&managed));
+                    ASSERTV(LINE, i, expected.datum(), managed.datum(),
+                            expected.datum() == managed.datum());
+                }
+                ASSERTV(LINE, i, numBlocks == da.numBlocksInUse());
+                ASSERTV(LINE, i, 0 == ma.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tEscape sequences in member names." << endl;
+        {
+            // 'DatumUtil::decode' does not decode the escape sequences in
+            // member names, hence it cannot serve as the oracle here.
+
+            bslma::TestAllocator da("document", veryVeryVerbose);
+
+            Obj mX(&da);  const Obj& X = mX;
+            ASSERT(0 == mX.parse("{\"\\u0061\":1,\"a\":2,\"\\n\":3}"));
+
+            bdld::ManagedDatum result(&da);
+            ASSERT(0 == X.root().materialize(&result));
+            ASSERT(result->isMap());
+            ASSERT(2 == result->theMap().size());
+            ASSERT(1.0 == result->theMap().find("a")->theDouble());
+            ASSERT(3.0 == result->theMap().find("\n")->theDouble());
+
+            ASSERT(0 == mX.parse(MESSAGE));
+            ASSERT(0 == X.root().materialize(&result));
+            ASSERT(4 == result->theMap().size());
+            ASSERT("escaped" == result->theMap().find("name")->theString());
+            ASSERT("order"   == result->theMap().find("type")->theString());
+        }
+
+        if (verbose) cout << "\tInvalid values." << endl;
+        {
+            const Value V;
+
+            bdld::Datum result = bdld::Datum::createInteger(7);
+            ASSERT(0 != V.materialize(&result));
+            ASSERT(bdld::Datum::createInteger(7) == result);
+
+            bdld::ManagedDatum managed(bdld::Datum::createInteger(7));
+            ASSERT(0 != V.materialize(&managed));
+            ASSERT(bdld::Datum::createInteger(7) == managed.datum());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SCALAR ACCESSORS
+        //
+        // Concerns:
+        //: 1 'getValue' loads the value of a boolean, number, or string, with
+        //:   the escape sequences of strings decoded.
+        //:
+        //: 2 'getValue' fails, without effect, if the value is invalid or of
+        //:   another type.
+        //
+        // Plan:
+        //: 1 Index a table of scalar documents, and call each overload of
+        //:   'getValue' on the root.  (C-1..2)
+        //
+        // Testing:
+        //   int getValue(bool *value) const;
+        //   int getValue(double *value) const;
+        //   int getValue(bsl::string *value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR ACCESSORS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator sa("scalar", veryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            char        d_type;     // 'b'oolean, 'n'umber, 's'tring, or
+                                    // '-' (none)
+            bool        d_boolean;
+            double      d_number;
+            const char *d_string_p;
+        } DATA[] = {
+            { L_, "true",                 'b', true,   0,     0            },
+            { L_, "false",                'b', false,  0,     0            },
+            { L_, "0",                    'n', false,  0,     0            },
+            { L_, "-0",                   'n', false,  0,     0            },
+            { L_, "42",                   'n', false,  42,    0            },
+            { L_, "-1.5",                 'n', false,  -1.5,  0            },
+            { L_, "2.5E+2",               'n', false,  250,   0            },
+            { L_, "125e-3",               'n', false,  0.125, 0            },
+            { L_, "\"\"",                 's', false,  0,     ""           },
+            { L_, "\"abc\"",              's', false,  0,     "abc"        },
+            { L_, "\"a\\\"b\"",           's', false,  0,     "a\"b"       },
+            { L_, "\"\\\\\\/\"",          's', false,  0,     "\\/"        },
+            { L_, "\"\\b\\f\\n\\r\\t\"",  's', false,  0,     "\b\f\n\r\t" },
+            { L_, "\"\\u0041\\u00e9\"",   's', false,  0,     "A\xc3\xa9"  },
+            { L_, "\"\\ud83d\\ude00\"",   's', false,  0,
+                                                        "\xf0\x9f\x98\x80" },
+            { L_, "\"\xc3\xa9\"",         's', false,  0,     "\xc3\xa9"   },
+            { L_, "null",                 '-', false,  0,     0            },
+            { L_, "[]",                   '-', false,  0,     0            },
+            { L_, "{}",                   '-', false,  0,     0            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *TEXT = DATA[ti].d_text_p;
+            const char  TYPE = DATA[ti].d_type;
+
+            if (veryVerbose) { P_(LINE) P(TEXT) }
+
+            Obj mX(&sa);  const Obj& X = mX;
+            ASSERTV(LINE, 0 == mX.parse(TEXT));
+
+            const Value V = X.root();
+
+            bool        b = !DATA[ti].d_boolean;
+            double      d = -99;
+            bsl::string s("unset", &sa);
+
+            ASSERTV(LINE, ('b' == TYPE) == (0 == V.getValue(&b)));
+            ASSERTV(LINE, ('n' == TYPE) == (0 == V.getValue(&d)));
+            ASSERTV(LINE, ('s' == TYPE) == (0 == V.getValue(&s)));
+
+            ASSERTV(LINE, b, ('b' == TYPE) == (DATA[ti].d_boolean == b));
+            ASSERTV(LINE, d, ('n' == TYPE) == (DATA[ti].d_number  == d));
+            if ('s' == TYPE) {
+                ASSERTV(LINE, s, DATA[ti].d_string_p == s);
+            }
+            else {
+                ASSERTV(LINE, s, "unset" == s);
+            }
+        }
+
+        if (verbose) cout << "\tInvalid values." << endl;
+        {
+            const Value V;
+
+            bool        b = true;
+            double      d = 1;
+            bsl::string s("unset", &sa);
+
+            ASSERT(0 != V.getValue(&b));
+            ASSERT(0 != V.getValue(&d));
+            ASSERT(0 != V.getValue(&s));
+
+            ASSERT(true    == b);
+            ASSERT(1       == d);
+            ASSERT("unset" == s);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NAVIGATION
+        //
+        // Concerns:
+        //: 1 The root, and each element and member value, has the type,
+        //:   size, and raw text of the corresponding JSON value.
+        //:
+        //: 2 'element', 'first', and 'next' visit the elements of an array,
+        //:   and the member values of an object, in order, skipping any
+        //:   nested values, and 'name' returns the names of the members.
+        //:
+        //: 3 'find' returns the value of the *first* member having the given
+        //:   name, whether or not the name contains escape sequences, and an
+        //:   invalid value if there is none.
+        //:
+        //: 4 Accessors applied to an invalid value, or to a value of the
+        //:   wrong type, or given an index out of range, return an invalid
+        //:   value (or 0, or 'false'), so that lookups can be chained.
+        //:
+        //: 5 Two values compare equal if they refer to the same value of the
+        //:   same document, or are both invalid.
+        //:
+        //: 6 No memory is allocated by navigation, except by 'find' to decode
+        //:   member names containing escape sequences.
+        //
+        // Plan:
+        //: 1 Index 'MESSAGE', and verify its structure using every accessor.
+        //:   (C-1..5)
+        //:
+        //: 2 Monitor the allocator of the document.  (C-6)
+        //
+        // Testing:
+        //   LazyValue root() const;
+        //   LazyValue();
+        //   bool isValid() const;
+        //   Type type() const;
+        //   bool isArray() const;
+        //   bool isBoolean() const;
+        //   bool isNull() const;
+        //   bool isNumber() const;
+        //   bool isObject() const;
+        //   bool isString() const;
+        //   int size() const;
+        //   LazyValue element(int index) const;
+        //   LazyValue name(int index) const;
+        //   LazyValue find(const bslstl::StringRef& memberName) const;
+        //   LazyValue first() const;
+        //   LazyValue next() const;
+        //   bslstl::StringRef rawText() const;
+        //   bool operator==(const LazyValue& lhs, const LazyValue& rhs);
+        //   bool operator!=(const LazyValue& lhs, const LazyValue& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NAVIGATION" << endl
+                          << "==========" << endl;
+
+        bslma::TestAllocator da("document", veryVeryVerbose);
+
+        Obj mX(&da);  const Obj& X = mX;
+        ASSERT(0 == mX.parse(MESSAGE));
+
+        const bsls::Types::Int64 numAllocations = da.numAllocations();
+
+        if (verbose) cout << "\tInvalid value." << endl;
+        {
+            const Value V;
+
+            ASSERT(!V.isValid());
+            ASSERT(!V.isArray());
+            ASSERT(!V.isBoolean());
+            ASSERT(!V.isNull());
+            ASSERT(!V.isNumber());
+            ASSERT(!V.isObject());
+            ASSERT(!V.isString());
+            ASSERT(0 == V.size());
+            ASSERT(!V.element(0).isValid());
+            ASSERT(!V.name(0).isValid());
+            ASSERT(!V.find("type").isValid());
+            ASSERT(!V.first().isValid());
+            ASSERT(!V.next().isValid());
+            ASSERT(V.rawText().isEmpty());
+            ASSERT(V == Value());
+        }
+
+        if (verbose) cout << "\tRoot object." << endl;
+
+        const Value ROOT = X.root();
+        ASSERT(ROOT.isValid());
+        ASSERT(Value::e_OBJECT == ROOT.type());
+        ASSERT(ROOT.isObject());
+        ASSERT(!ROOT.isArray());
+        ASSERT(5 == ROOT.size());
+        ASSERT(MESSAGE == ROOT.rawText());
+        ASSERT(!ROOT.next().isValid());
+        ASSERT(ROOT == X.root());
+        ASSERT(ROOT != Value());
+
+        {
+            static const char *const NAMES[] = {
+                "\"header\"", "\"type\"", "\"body\"", "\"n\\u0061me\"",
+                "\"type\""
+            };
+
+            int i = 0;
+            for (Value v = ROOT.first(); v.isValid(); v = v.next(), ++i) {
+                ASSERTV(i, v == ROOT.element(i));
+                ASSERTV(i, ROOT.name(i).isString());
+                ASSERTV(i, NAMES[i] == ROOT.name(i).rawText());
+                ASSERTV(i, !ROOT.name(i).next().isValid());
+            }
+            ASSERTV(i, 5 == i);
+            ASSERT(!ROOT.element(-1).isValid());
+            ASSERT(!ROOT.element(5).isValid());
+            ASSERT(!ROOT.name(5).isValid());
+        }
+
+        if (verbose) cout << "\tFind." << endl;
+        {
+            const Value HEADER = ROOT.find("header");
+            ASSERT(HEADER == ROOT.element(0));
+            ASSERT(HEADER.isObject());
+            ASSERT(3 == HEADER.size());
+
+            const Value TYPE = ROOT.find("type");
+            ASSERT(TYPE == ROOT.element(1));
+            ASSERT("\"order\"" == TYPE.rawText());
+            ASSERT(ROOT.element(2) == TYPE.next());
+
+            ASSERT(!ROOT.find("").isValid());
+            ASSERT(!ROOT.find("typ").isValid());
+            ASSERT(!ROOT.find("types").isValid());
+            ASSERT(!ROOT.find("id").isValid());
+            ASSERT(!TYPE.find("type").isValid());
+
+            ASSERT(numAllocations == da.numAllocations());
+
+            const Value NAME = ROOT.find("name");
+            ASSERT(NAME == ROOT.element(3));
+            ASSERT("\"escaped\"" == NAME.rawText());
+
+            ASSERT("17" == HEADER.find("id").rawText());
+            ASSERT(!ROOT.find("header").find("missing").find("id").isValid());
+        }
+
+        if (verbose) cout << "\tNested arrays and objects." << endl;
+        {
+            const Value TAGS = ROOT.find("header").find("tags");
+            ASSERT(TAGS.isArray());
+            ASSERT(Value::e_ARRAY == TAGS.type());
+            ASSERT(3 == TAGS.size());
+            ASSERT("\"b\\n\"" == TAGS.element(1).rawText());
+            ASSERT(!TAGS.name(0).isValid());
+            ASSERT(!TAGS.find("a").isValid());
+            ASSERT("[ \"a\", \"b\\n\", \"\\u00e9\" ]" == TAGS.rawText());
+
+            const Value BODY = ROOT.find("body");
+            ASSERT(5 == BODY.size());
+            ASSERT(BODY.find("quantity").isNumber());
+            ASSERT(Value::e_NUMBER == BODY.find("price").type());
+            ASSERT("-1.25e2" == BODY.find("price").rawText());
+
+            const Value FLAGS = BODY.find("flags");
+            ASSERT(3 == FLAGS.size());
+            ASSERT(FLAGS.element(0).isBoolean());
+            ASSERT(FLAGS.element(1).isBoolean());
+            ASSERT(FLAGS.element(2).isNull());
+            ASSERT(Value::e_NULL == FLAGS.element(2).type());
+            ASSERT(!FLAGS.element(2).next().isValid());
+
+            const Value LEGS = BODY.find("legs");
+            ASSERT(3 == LEGS.size());
+            ASSERT("2" == LEGS.element(1).find("n").rawText());
+            ASSERT(LEGS.element(2).isObject());
+            ASSERT(0 == LEGS.element(2).size());
+            ASSERT(!LEGS.element(2).first().isValid());
+            ASSERT("{}" == LEGS.element(2).rawText());
+            ASSERT(!LEGS.element(2).next().isValid());
+            ASSERT(!LEGS.next().isValid());
+
+            // The value following a nested subtree is reached directly.
+
+            ASSERT(BODY.next() == ROOT.find("name"));
+            ASSERT(!ROOT.find("n\\u0061me").isValid());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PARSE
+        //
+        // Concerns:
+        //: 1 'parse' accepts exactly the syntactically valid JSON documents
+        //:   consisting of a single value (optionally surrounded by
+        //:   whitespace).
+        //:
+        //: 2 The tape has one entry per value, and per member name.
+        //:
+        //: 3 On failure, the document is empty, and a description of the
+        //:   error is written to the error stream, if one is supplied.
+        //:
+        //: 4 Arrays and objects may be nested up to 'k_MAX_NESTING_DEPTH'
+        //:   levels deep.
+        //:
+        //: 5 'reset' empties the document, and releases the memory of the
+        //:   tape.  All memory is taken from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Parse a table of valid and invalid documents, and check the
+        //:   status and number of entries.  (C-1..3)
+        //:
+        //: 2 Parse documents nested 'k_MAX_NESTING_DEPTH' and one more levels
+        //:   deep.  (C-4)
+        //:
+        //: 3 Use test allocators to monitor memory use.  (C-5)
+        //
+        // Testing:
+        //   LazyDocument(bslma::Allocator *basicAllocator = 0);
+        //   ~LazyDocument();
+        //   int parse(const bslstl::StringRef& text);
+        //   int parse(bsl::ostream *errorStream, const bslstl::StringRef&);
+        //   void reset();
+        //   bool isEmpty() const;
+        //   bsl::size_t numEntries() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSE" << endl
+                          << "=====" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            int         d_numEntries;  // -1 if the text is invalid
+        } DATA[] = {
+            // Scalars
+
+            { L_, "null",                        1 },
+            { L_, " true ",                      1 },
+            { L_, "\tfalse\r\n",                 1 },
+            { L_, "0",                           1 },
+            { L_, "-0",                          1 },
+            { L_, "123",                         1 },
+            { L_, "-1.5e+10",                    1 },
+            { L_, "0.5E-3",                      1 },
+            { L_, "\"\"",                        1 },
+            { L_, "\"a\\\"\\\\\\/\\b\\f\\n\\r\\t\\u12aF\"",
+                                                 1 },
+            { L_, "\"}]\"",                      1 },
+
+            { L_, "",                           -1 },
+            { L_, "   ",                        -1 },
+            { L_, "nul",                        -1 },
+            { L_, "nulll",                      -1 },
+            { L_, "True",                       -1 },
+            { L_, "tru",                        -1 },
+            { L_, "falsey",                     -1 },
+            { L_, "01",                         -1 },
+            { L_, "+1",                         -1 },
+            { L_, "-",                          -1 },
+            { L_, "1.",                         -1 },
+            { L_, ".5",                         -1 },
+            { L_, "1e",                         -1 },
+            { L_, "1e+",                        -1 },
+            { L_, "0x10",                       -1 },
+            { L_, "\"",                         -1 },
+            { L_, "\"abc",                      -1 },
+            { L_, "\"\\\"",                     -1 },
+            { L_, "\"\\x\"",                    -1 },
+            { L_, "\"\\u12\"",                  -1 },
+            { L_, "\"\\u12G4\"",                -1 },
+            { L_, "\"\n\"",                     -1 },
+            { L_, "'a'",                        -1 },
+            { L_, "1 2",                        -1 },
+            { L_, "null,",                      -1 },
+
+            // Arrays
+
+            { L_, "[]",                          1 },
+            { L_, " [ ] ",                       1 },
+            { L_, "[1]",                         2 },
+            { L_, "[1,2,3]",                     4 },
+            { L_, "[ [], [[]], {} ]",            5 },
+            { L_, "[\"a\",true,null,-1]",        5 },
+
+            { L_, "[",                          -1 },
+            { L_, "]",                          -1 },
+            { L_, "[1",                         -1 },
+            { L_, "[1,",                        -1 },
+            { L_, "[1,]",                       -1 },
+            { L_, "[,1]",                       -1 },
+            { L_, "[1 2]",                      -1 },
+            { L_, "[1:2]",                      -1 },
+            { L_, "[}",                         -1 },
+            { L_, "[1}",                        -1 },
+            { L_, "[]]",                        -1 },
+            { L_, "[][]",                       -1 },
+
+            // Objects
+
+            { L_, "{}",                          1 },
+            { L_, "{ }",                         1 },
+            { L_, "{\"a\":1}",                   3 },
+            { L_, " { \"a\" : 1 , \"b\" : [ ] } ",
+                                                 5 },
+            { L_, "{\"a\":{\"b\":{}}}",          5 },
+            { L_, "{\"a\":1,\"a\":2}",           5 },
+
+            { L_, "{",                          -1 },
+            { L_, "}",                          -1 },
+            { L_, "{\"a\"",                     -1 },
+            { L_, "{\"a\":",                    -1 },
+            { L_, "{\"a\":1",                   -1 },
+            { L_, "{\"a\":1,",                  -1 },
+            { L_, "{\"a\":1,}",                 -1 },
+            { L_, "{\"a\" 1}",                  -1 },
+            { L_, "{\"a\":1 \"b\":2}",          -1 },
+            { L_, "{a:1}",                      -1 },
+            { L_, "{1:1}",                      -1 },
+            { L_, "{\"a\":1]",                  -1 },
+            { L_, "{,}",                        -1 },
+            { L_, "{\"a\"::1}",                 -1 },
+            { L_, "{}}",                        -1 },
+
+            { L_, MESSAGE,                      40 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator da("document", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE        = DATA[ti].d_line;
+            const char *TEXT        = DATA[ti].d_text_p;
+            const int   NUM_ENTRIES = DATA[ti].d_numEntries;
+
+            if (veryVerbose) { P_(LINE) P(TEXT) }
+
+            // Parse the text followed by other characters, to verify that
+            // characters outside the given range are not read.
+
+            bsl::string buffer(TEXT, &da);
+            buffer += "]}\"";
+            const bslstl::StringRef text(buffer.data(), bsl::strlen(TEXT));
+
+            Obj mX(&da);  const Obj& X = mX;
+            ASSERTV(LINE, &da == X.allocator());
+            ASSERTV(LINE, X.isEmpty());
+
+            bdlsb::MemOutStreamBuf errorBuffer(&da);
+            bsl::ostream           errors(&errorBuffer);
+            const int              rc = mX.parse(&errors, text);
+            const bslstl::StringRef message(errorBuffer.data(),
+                                            errorBuffer.length());
+
+            if (0 <= NUM_ENTRIES) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, message, message.isEmpty());
+                ASSERTV(LINE, !X.isEmpty());
+                ASSERTV(LINE, X.numEntries(),
+                        NUM_ENTRIES == static_cast<int>(X.numEntries()));
+                ASSERTV(LINE, text == X.root().rawText() ||
+                              (' ' == TEXT[0] || '\t' == TEXT[0]));
+            }
+            else {
+                ASSERTV(LINE, 0 != rc);
+                ASSERTV(LINE, !message.isEmpty());
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, 0 == X.numEntries());
+                if (veryVeryVerbose) { P(message) }
+            }
+
+            // The document can be reused, with or without an error stream.
+
+            ASSERTV(LINE, 0 == mX.parse("[1,2]"));
+            ASSERTV(LINE, 3 == X.numEntries());
+            ASSERTV(LINE, (0 == rc) == (0 == mX.parse(text)));
+
+            mX.reset();
+            ASSERTV(LINE, X.isEmpty());
+            ASSERTV(LINE, 0 == X.numEntries());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tNesting depth." << endl;
+        {
+            const int MAX = Obj::k_MAX_NESTING_DEPTH;
+
+            bsl::string text(&da);
+            text.append(MAX, '[');
+            text.append(MAX, ']');
+
+            Obj mX(&da);  const Obj& X = mX;
+            ASSERT(0 == mX.parse(text));
+            ASSERT(static_cast<bsl::size_t>(MAX) == X.numEntries());
+
+            text.assign(MAX + 1, '[');
+            text.append(MAX + 1, ']');
+            ASSERT(0 != mX.parse(text));
+            ASSERT(X.isEmpty());
+
+            text.clear();
+            for (int i = 0; i < MAX; ++i) {
+                text += "{\"a\":";
+            }
+            text += "1";
+            text.append(MAX, '}');
+            ASSERT(0 == mX.parse(text));
+            ASSERT(static_cast<bsl::size_t>(2 * MAX + 1) == X.numEntries());
+        }
+
+        if (verbose) cout << "\tMemory." << endl;
+        {
+            bslma::TestAllocator ta("tape", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+                ASSERT(0 == ta.numBlocksTotal());
+
+                ASSERT(0 == mX.parse(MESSAGE));
+                ASSERT(0 <  ta.numBlocksInUse());
+
+                mX.reset();
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+
+            {
+                bslma::DefaultAllocatorGuard dag(&ta);
+
+                Obj mX;  const Obj& X = mX;
+                ASSERT(&ta == X.allocator());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a small document, navigate it, and materialize a subtree.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("arena", veryVeryVerbose);
+        bdlma::SequentialAllocator arena(&ta);
+
+        Obj mX(&arena);  const Obj& X = mX;
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == mX.parse("{\"a\":[1,2,{\"b\":\"c\"}],\"d\":true}"));
+        ASSERT(!X.isEmpty());
+        ASSERT(10 == X.numEntries());
+
+        const Value ROOT = X.root();
+        ASSERT(ROOT.isObject());
+        ASSERT(2 == ROOT.size());
+
+        const Value A = ROOT.find("a");
+        ASSERT(A.isArray());
+        ASSERT(3 == A.size());
+        ASSERT("\"c\"" == A.element(2).find("b").rawText());
+
+        bool d = false;
+        ASSERT(0 == ROOT.find("d").getValue(&d));
+        ASSERT(true == d);
+
+        bdld::Datum datum;
+        ASSERT(0 == A.materialize(&datum));
+        ASSERT(datum.isArray());
+        ASSERT(3   == datum.theArray().length());
+        ASSERT(1.0 == datum.theArray()[0].theDouble());
+        ASSERT("c" == datum.theArray()[2].theMap().find("b")->theString());
+
+        mX.reset();
+        arena.release();
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LAZY ACCESS VS. 'DatumUtil::decode'
+        //
+        // Concerns:
+        //: 1 Indexing a message and reading a few of its fields is
+        //:   substantially faster than decoding the whole message.
+        //
+        // Plan:
+        //: 1 Time reading two fields of a message, 'N' times, with a
+        //:   'LazyDocument' over a 'bdlma::SequentialAllocator' released
+        //:   after each message, and with 'DatumUtil::decode'.  Also time
+        //:   materializing the whole message from the tape.
+        //
+        // Testing:
+        //   PERFORMANCE: LAZY ACCESS VS. 'DatumUtil::decode'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: LAZY ACCESS VS. 'DatumUtil::decode'"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        const int N = argc > 2 ? bsl::atoi(argv[2]) : 20000;
+
+        bsl::string text(MESSAGE);
+        text.erase(text.length() - 1);
+        text += ", \"trailer\": [";
+        for (int i = 0; i < 200; ++i) {
+            text += i ? ", " : "";
+            text += "{ \"seq\": 1234567, \"value\": 3.25, \"ok\": true }";
+        }
+        text += "] }";
+
+        double lazy, materialized, eager;
+        {
+            bdlma::SequentialAllocator arena;
+            bsls::TimeInterval         start = bdlt::CurrentTime::now();
+            for (int i = 0; i < N; ++i) {
+                {
+                    Obj mX(&arena);
+                    mX.parse(text);
+                    bsl::string type(&arena);
+                    mX.root().find("type").getValue(&type);
+                    double id;
+                    mX.root().find("header").find("id").getValue(&id);
+                }
+                arena.release();
+            }
+            lazy = (bdlt::CurrentTime::now() - start).totalSecondsAsDouble();
+
+            start = bdlt::CurrentTime::now();
+            for (int i = 0; i < N; ++i) {
+                {
+                    Obj mX(&arena);
+                    mX.parse(text);
+                    bdld::Datum datum;
+                    mX.root().materialize(&datum);
+                }
+                arena.release();
+            }
+            materialized = (bdlt::CurrentTime::now() - start).
+                                                       totalSecondsAsDouble();
+        }
+        {
+            bsls::TimeInterval start = bdlt::CurrentTime::now();
+            for (int i = 0; i < N; ++i) {
+                bdld::ManagedDatum datum;
+                baljsn::DatumUtil::decode(&datum, text);
+                const bdld::DatumMapRef map = datum->theMap();
+                bsl::string type(map.find("type")->theString());
+                double id = map.find("header")->theMap().find("id")->
+                                                                   theDouble();
+                (void)id;
+            }
+            eager = (bdlt::CurrentTime::now() - start).totalSecondsAsDouble();
+        }
+
+        cout << "message size: " << text.length() << " bytes, " << N
+             << " messages\n"
+             << "lazy (2 fields):          " << lazy * 1e6 / N << " us\n"
+             << "lazy (materialize all):   " << materialized * 1e6 / N
+             << " us\n"
+             << "DatumUtil::decode:        " << eager * 1e6 / N << " us\n";
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
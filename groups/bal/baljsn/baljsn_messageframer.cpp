@@ -0,0 +1,190 @@
+// baljsn_messageframer.cpp                                           -*-C++-*-
+#include <baljsn_messageframer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_messageframer_cpp,"$Id$ $CSID$")
+
+#include <bdlbb_blob.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                            // -------------------
+                            // class MessageFramer
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void MessageFramer::discardConsumed()
+{
+    if (0 == d_consumed) {
+        return;                                                       // RETURN
+    }
+
+    d_buffer.erase(d_buffer.begin(), d_buffer.begin() + d_consumed);
+    d_scanPosition -= d_consumed;
+    d_consumed      = 0;
+}
+
+int MessageFramer::scan()
+{
+    if (e_MESSAGE_END == d_state) {
+        return e_COMPLETE;                                            // RETURN
+    }
+    if (e_SCAN_ERROR == d_state) {
+        return e_ERROR;                                               // RETURN
+    }
+
+    const char        *data = d_buffer.data();
+    const bsl::size_t  size = d_buffer.size();
+
+    for (bsl::size_t i = d_scanPosition; i < size; ++i) {
+        const char c = data[i];
+
+        switch (d_state) {
+          case e_BEFORE_MESSAGE: {
+            if (' ' == c || '\n' == c || '\t' == c || '\r' == c) {
+                continue;                                           // CONTINUE
+            }
+            d_consumed = i;  // discard the leading whitespace
+
+            if ('{' != c && '[' != c) {
+                d_scanPosition = i;
+                d_state        = e_SCAN_ERROR;
+                return e_ERROR;                                       // RETURN
+            }
+            d_depth = 1;
+            d_state = e_IN_MESSAGE;
+          } break;
+          case e_IN_MESSAGE: {
+            switch (c) {
+              case '{':
+              case '[': {
+                ++d_depth;
+              } break;
+              case '}':
+              case ']': {
+                if (0 == --d_depth) {
+                    d_scanPosition = i + 1;
+                    d_state        = e_MESSAGE_END;
+                    return e_COMPLETE;                                // RETURN
+                }
+              } break;
+              case '"': {
+                d_state = e_IN_STRING;
+              } break;
+              default: {
+              } break;
+            }
+          } break;
+          case e_IN_STRING: {
+            if ('"' == c) {
+                d_state = e_IN_MESSAGE;
+            }
+            else if ('\\' == c) {
+                d_state = e_IN_ESCAPE;
+            }
+          } break;
+          default: {
+            BSLS_ASSERT(e_IN_ESCAPE == d_state);
+
+            d_state = e_IN_STRING;
+          } break;
+        }
+    }
+
+    d_scanPosition = size;
+
+    if (e_BEFORE_MESSAGE == d_state) {
+        // Only whitespace remains; it need not be retained.
+
+        d_consumed = size;
+    }
+
+    return e_INCOMPLETE;
+}
+
+// CREATORS
+MessageFramer::MessageFramer(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_consumed(0)
+, d_scanPosition(0)
+, d_depth(0)
+, d_state(e_BEFORE_MESSAGE)
+{
+}
+
+// MANIPULATORS
+int MessageFramer::append(const char *data, int length)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(0 <= length);
+
+    if (e_SCAN_ERROR == d_state) {
+        return e_ERROR;                                               // RETURN
+    }
+
+    discardConsumed();
+    d_buffer.insert(d_buffer.end(), data, data + length);
+
+    return scan();
+}
+
+int MessageFramer::append(const bdlbb::Blob& data)
+{
+    if (e_SCAN_ERROR == d_state) {
+        return e_ERROR;                                               // RETURN
+    }
+
+    discardConsumed();
+    d_buffer.reserve(d_buffer.size() + data.length());
+
+    const int numDataBuffers = data.numDataBuffers();
+    for (int i = 0; i < numDataBuffers; ++i) {
+        const char *buffer = data.buffer(i).data();
+        const int   length = i == numDataBuffers - 1
+                           ? data.lastDataBufferLength()
+                           : data.buffer(i).size();
+
+        d_buffer.insert(d_buffer.end(), buffer, buffer + length);
+    }
+
+    return scan();
+}
+
+int MessageFramer::popMessage()
+{
+    BSLS_ASSERT(isComplete());
+
+    d_consumed = d_scanPosition;
+    d_state    = e_BEFORE_MESSAGE;
+
+    return scan();
+}
+
+void MessageFramer::reset()
+{
+    d_buffer.clear();
+    d_consumed     = 0;
+    d_scanPosition = 0;
+    d_depth        = 0;
+    d_state        = e_BEFORE_MESSAGE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,328 @@
+// baljsn_messageframer.h                                             -*-C++-*-
+#ifndef INCLUDED_BALJSN_MESSAGEFRAMER
+#define INCLUDED_BALJSN_MESSAGEFRAMER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to find JSON messages in chunked input.
+//
+//@CLASSES:
+//  baljsn::MessageFramer: push-mode framer for a stream of JSON messages
+//
+//@SEE_ALSO: baljsn_decoder
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::MessageFramer',
+// that finds the boundaries of JSON messages (objects or arrays) in a stream
+// of data delivered in arbitrary chunks, such as the buffers of a
+// 'bdlbb::Blob' read from a socket.  Rather than blocking on (or failing at) a
+// short read, as 'baljsn::Decoder' does when reading from a 'bsl::streambuf',
+// the framer is *pushed* each chunk as it arrives by one of the 'append'
+// methods, which report whether a complete message is now buffered.
+//
+// Each chunk is scanned as it is appended, and the scan state (the nesting
+// depth, and whether the scan is inside a string or an escape sequence) is
+// kept between calls, so that the work of finding the end of a message
+// overlaps with receiving it, and no byte is scanned twice.  Once a complete
+// message has been received, 'message' provides it as a contiguous
+// 'bslstl::StringRef', which can be decoded with the most efficient form of
+// 'baljsn::Decoder::decode', and 'popMessage' removes it from the buffer.
+//
+// Note that the framer does not decode: decoding of a message starts only
+// once the whole message has been received.
+//
+// Any bytes appended after the end of a message are retained, and scanned,
+// as the beginning of the next message; hence, a stream carrying a sequence
+// of messages (separated by optional whitespace) can be appended in chunks
+// without regard to message boundaries, and the messages processed one at a
+// time.
+//
+// Note that the scan verifies only the structure needed to find the end of a
+// message: a message must start, after optional whitespace, with '{' or '['.
+// All other syntax errors are left to be reported by the decoder.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages as They Arrive
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive 'Employee' messages from a network connection, in
+// chunks whose boundaries are unrelated to those of the messages.  The
+// 'Employee' type is a 'bdeat'-compatible sequence having the following
+// definition:
+//..
+//  <complexType name='Address'>
+//    <sequence>
+//      <element name='street' type='string'/>
+//      <element name='city'   type='string'/>
+//      <element name='state'  type='string'/>
+//    </sequence>
+//  </complexType>
+//
+//  <complexType name='Employee'>
+//    <sequence>
+//      <element name='name'        type='string'/>
+//      <element name='homeAddress' type='test:Address'/>
+//      <element name='age'         type='int'/>
+//    </sequence>
+//  </complexType>
+//..
+// First, we create a message framer, a decoder, and a default decoder options
+// object:
+//..
+//  baljsn::MessageFramer        framer;
+//  baljsn::Decoder              decoder;
+//  const baljsn::DecoderOptions options;
+//..
+// Then, we simulate the arrival of two messages, split into three chunks:
+//..
+//  const char *chunks[] = {
+//      "{\"name\":\"Bob\",\"homeAddress\":{\"street\":\"Lex",
+//      "ington Ave\",\"city\":\"New York City\",\"state\":\"New York\"},"
+//      "\"age\":21}\n{\"name\":\"Alice\",",
+//      "\"age\":30}"
+//  };
+//..
+// Next, we append the first chunk, which does not contain a complete message:
+//..
+//  int rc = framer.append(chunks[0], static_cast<int>(strlen(chunks[0])));
+//  assert(baljsn::MessageFramer::e_INCOMPLETE == rc);
+//..
+// Then, we append the second chunk, completing the first message, decode it,
+// and remove it from the framer:
+//..
+//  rc = framer.append(chunks[1], static_cast<int>(strlen(chunks[1])));
+//  assert(baljsn::MessageFramer::e_COMPLETE == rc);
+//
+//  test::Employee bob;
+//  rc = decoder.decode(framer.message(), &bob, options);
+//  assert(0                         == rc);
+//  assert("Bob"                     == bob.name());
+//  assert("Lexington Ave"           == bob.homeAddress().street());
+//  assert(21                        == bob.age());
+//
+//  framer.popMessage();
+//..
+// Next, we observe that the start of the second message, which arrived with
+// the second chunk, is retained, but the message is not yet complete:
+//..
+//  assert(false == framer.isComplete());
+//  assert(0     <  framer.numBufferedBytes());
+//..
+// Finally, we append the third chunk, and decode the second message:
+//..
+//  rc = framer.append(chunks[2], static_cast<int>(strlen(chunks[2])));
+//  assert(baljsn::MessageFramer::e_COMPLETE == rc);
+//
+//  test::Employee alice;
+//  rc = decoder.decode(framer.message(), &alice, options);
+//  assert(0       == rc);
+//  assert("Alice" == alice.name());
+//  assert(30      == alice.age());
+//
+//  framer.popMessage();
+//  assert(0       == framer.numBufferedBytes());
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+namespace bdlbb { class Blob; }
+
+namespace baljsn {
+
+                            // ===================
+                            // class MessageFramer
+                            // ===================
+
+class MessageFramer {
+    // This class provides a mechanism for finding the JSON messages in a
+    // stream of data supplied in chunks.  Appended data is buffered, and
+    // scanned to find the end of the current message; once it is found, the
+    // message is available, as a contiguous string, until it is popped.
+
+  public:
+    // TYPES
+    enum Status {
+        // This enumeration defines the values returned by the 'append'
+        // methods.
+
+        e_ERROR      = -1,  // the buffered data is not a JSON object or array
+        e_COMPLETE   =  0,  // a complete message is buffered
+        e_INCOMPLETE =  1   // more data are needed to complete the message
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum ScanState {
+        // This enumeration defines the states of the scan for the end of the
+        // current message.
+
+        e_BEFORE_MESSAGE,   // skipping whitespace before the message
+        e_IN_MESSAGE,       // inside the message, outside any string
+        e_IN_STRING,        // inside a string
+        e_IN_ESCAPE,        // after a '\' inside a string
+        e_MESSAGE_END,      // at the end of a complete message
+        e_SCAN_ERROR        // the data is not a JSON object or array
+    };
+
+    // DATA
+    bsl::vector<char> d_buffer;         // buffered data
+    bsl::size_t       d_consumed;       // number of leading bytes of
+                                        // 'd_buffer' already popped or
+                                        // skipped as whitespace (hence, the
+                                        // index of the first byte of the
+                                        // current message, once found)
+
+    bsl::size_t       d_scanPosition;   // index in 'd_buffer' of the next
+                                        // byte to scan
+
+    int               d_depth;          // nesting depth at 'd_scanPosition'
+    ScanState         d_state;          // state at 'd_scanPosition'
+
+    // PRIVATE MANIPULATORS
+    void discardConsumed();
+        // Remove the consumed bytes (see 'd_consumed') from the buffer.
+
+    int scan();
+        // Scan the buffered data from the current scan position for the end
+        // of the current message, and return the resulting status.
+
+  private:
+    // NOT IMPLEMENTED
+    MessageFramer(const MessageFramer&);
+    MessageFramer& operator=(const MessageFramer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MessageFramer, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit MessageFramer(bslma::Allocator *basicAllocator = 0);
+        // Create a message framer having no buffered data.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    //! ~MessageFramer() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int append(const char *data, int length);
+        // Append the specified 'data' having the specified 'length' to the
+        // data buffered by this framer, and return 'e_COMPLETE' if a complete
+        // message is then buffered, 'e_INCOMPLETE' if more data are needed,
+        // and 'e_ERROR' if the buffered data cannot be the start of a JSON
+        // object or array.  If a complete message was already buffered,
+        // 'data' is buffered (but not scanned) as the start of the next
+        // message, and 'e_COMPLETE' is returned.  If 'e_ERROR' was returned,
+        // this framer remains in the error state, and 'data' is discarded,
+        // until 'reset' is called.  The behavior is undefined unless
+        // '0 <= length'.
+
+    int append(const bdlbb::Blob& data);
+        // Append the data in the specified 'data' blob to the data buffered by
+        // this framer, and return the status as described for the other
+        // overload of 'append'.
+
+    int popMessage();
+        // Remove the complete message from the buffer, scan the remaining
+        // buffered data for the end of the next message, and return the
+        // resulting status, as described for 'append'.  Any reference
+        // returned by 'message' is invalidated.  The behavior is undefined
+        // unless 'isComplete()'.
+
+    void reset();
+        // Discard all buffered data, and leave the error state, if any, so
+        // that the next appended byte is scanned as the start of a message.
+
+    // ACCESSORS
+    bool isComplete() const;
+        // Return 'true' if a complete message is buffered, and 'false'
+        // otherwise.
+
+    bool isError() const;
+        // Return 'true' if this framer is in the error state (see 'append'),
+        // and 'false' otherwise.
+
+    bslstl::StringRef message() const;
+        // Return a reference to the complete message buffered by this framer,
+        // excluding any surrounding whitespace.  The reference remains valid
+        // until the next call to any manipulator of this framer.  The
+        // behavior is undefined unless 'isComplete()'.
+
+    bsl::size_t numBufferedBytes() const;
+        // Return the number of bytes buffered by this framer that have not
+        // been popped.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class MessageFramer
+                            // -------------------
+
+// ACCESSORS
+inline
+bool MessageFramer::isComplete() const
+{
+    return e_MESSAGE_END == d_state;
+}
+
+inline
+bool MessageFramer::isError() const
+{
+    return e_SCAN_ERROR == d_state;
+}
+
+inline
+bslstl::StringRef MessageFramer::message() const
+{
+    BSLS_ASSERT(isComplete());
+
+    return bslstl::StringRef(d_buffer.data() + d_consumed,
+                             d_scanPosition - d_consumed);
+}
+
+inline
+bsl::size_t MessageFramer::numBufferedBytes() const
+{
+    return d_buffer.size() - d_consumed;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
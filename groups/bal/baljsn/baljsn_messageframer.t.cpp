@@ -0,0 +1,829 @@
+// baljsn_messageframer.t.cpp                                         -*-C++-*-
+#include <baljsn_messageframer.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_employee.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+namespace test = BloombergLP::s_baltst;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test implements a mechanism that buffers JSON data
+// appended in chunks, scans it for the end of the current message, and
+// provides complete messages as contiguous strings.  The scan is a small
+// state machine whose state must be carried correctly across chunk
+// boundaries; we therefore test it by splitting each input of a table at every
+// possible position, and by appending it one byte at a time, and verify that
+// the reported status is the same as for the input appended as a whole.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] baljsn::MessageFramer(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~baljsn::MessageFramer();
+//
+// MANIPULATORS
+// [ 2] int append(const char *data, int length);
+// [ 4] int append(const bdlbb::Blob& data);
+// [ 3] int popMessage();
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] bool isComplete() const;
+// [ 2] bool isError() const;
+// [ 3] bslstl::StringRef message() const;
+// [ 2] bsl::size_t numBufferedBytes() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::MessageFramer Obj;
+
+static const char EMPLOYEE_BOB[] =
+    "{\"name\":\"Bob\","
+     "\"homeAddress\":{\"street\":\"Lexington Ave\","
+                      "\"city\":\"New York City\","
+                      "\"state\":\"New York\"},"
+     "\"age\":21}";
+
+static const char EMPLOYEE_TRICKY[] =
+    "{\n"
+    "  \"name\" : \"a \\\"}]\\\\ , \\\\\\\"\",\n"
+    "  \"homeAddress\" : { \"street\" : \"{[\\\\\\\"\" },\n"
+    "  \"age\" : 42\n"
+    "}";
+    // The name of this employee contains (escaped) quotes, backslashes, and
+    // closing brackets, and the street contains opening brackets.
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages as They Arrive
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive 'Employee' messages from a network connection, in
+// chunks whose boundaries are unrelated to those of the messages.  The
+// 'Employee' type is a 'bdeat'-compatible sequence having the following
+// definition:
+//..
+//  <complexType name='Address'>
+//    <sequence>
+//      <element name='street' type='string'/>
+//      <element name='city'   type='string'/>
+//      <element name='state'  type='string'/>
+//    </sequence>
+//  </complexType>
+//
+//  <complexType name='Employee'>
+//    <sequence>
+//      <element name='name'        type='string'/>
+//      <element name='homeAddress' type='test:Address'/>
+//      <element name='age'         type='int'/>
+//    </sequence>
+//  </complexType>
+//..
+// First, we create a message framer, a decoder, and a default decoder options
+// object:
+//..
+    baljsn::MessageFramer        framer;
+    baljsn::Decoder              decoder;
+    const baljsn::DecoderOptions options;
+//..
+// Then, we simulate the arrival of two messages, split into three chunks:
+//..
+    const char *chunks[] = {
+        "{\"name\":\"Bob\",\"homeAddress\":{\"street\":\"Lex",
+        "ington Ave\",\"city\":\"New York City\",\"state\":\"New York\"},"
+        "\"age\":21}\n{\"name\":\"Alice\",",
+        "\"age\":30}"
+    };
+//..
+// Next, we append the first chunk, which does not contain a complete message:
+//..
+    int rc = framer.append(chunks[0], static_cast<int>(strlen(chunks[0])));
+    ASSERT(baljsn::MessageFramer::e_INCOMPLETE == rc);
+//..
+// Then, we append the second chunk, completing the first message, decode it,
+// and remove it from the framer:
+//..
+    rc = framer.append(chunks[1], static_cast<int>(strlen(chunks[1])));
+    ASSERT(baljsn::MessageFramer::e_COMPLETE == rc);
+
+    test::Employee bob;
+    rc = decoder.decode(framer.message(), &bob, options);
+    ASSERT(0                         == rc);
+    ASSERT("Bob"                     == bob.name());
+    ASSERT("Lexington Ave"           == bob.homeAddress().street());
+    ASSERT(21                        == bob.age());
+
+    framer.popMessage();
+//..
+// Next, we observe that the start of the second message, which arrived with
+// the second chunk, is retained, but the message is not yet complete:
+//..
+    ASSERT(false == framer.isComplete());
+    ASSERT(0     <  framer.numBufferedBytes());
+//..
+// Finally, we append the third chunk, and decode the second message:
+//..
+    rc = framer.append(chunks[2], static_cast<int>(strlen(chunks[2])));
+    ASSERT(baljsn::MessageFramer::e_COMPLETE == rc);
+
+    test::Employee alice;
+    rc = decoder.decode(framer.message(), &alice, options);
+    ASSERT(0       == rc);
+    ASSERT("Alice" == alice.name());
+    ASSERT(30      == alice.age());
+
+    framer.popMessage();
+    ASSERT(0       == framer.numBufferedBytes());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'append(const bdlbb::Blob&)'
+        //
+        // Concerns:
+        //: 1 All data buffers of the blob are appended, in order.
+        //:
+        //: 2 Only the first 'lastDataBufferLength()' bytes of the last data
+        //:   buffer, and no bytes of any capacity buffers, are appended.
+        //:
+        //: 3 An empty blob may be appended, and does not change the status.
+        //:
+        //: 4 Appending to a framer in the error state has no effect.
+        //
+        // Plan:
+        //: 1 For a sequence of blob buffer sizes, create a blob holding two
+        //:   employee messages, having excess capacity, and append it, or
+        //:   successive single-byte sub-blobs of it, to a framer.  Verify
+        //:   that both messages are framed correctly.  (C-1..2)
+        //:
+        //: 2 Append an empty blob, before and after the data.  (C-3)
+        //:
+        //: 3 Append a blob to a framer in the error state.  (C-4)
+        //
+        // Testing:
+        //   int append(const bdlbb::Blob& data);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'append(const bdlbb::Blob&)'" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator         oa("object",  veryVeryVerbose);
+        bslma::TestAllocator         sa("scratch", veryVeryVerbose);
+        const baljsn::DecoderOptions options;
+
+        baljsn::Decoder decoder(&sa);
+
+        bsl::string mINPUT(EMPLOYEE_BOB, &sa);
+        mINPUT += " \r\n";
+        mINPUT += EMPLOYEE_TRICKY;
+
+        const bsl::string& INPUT  = mINPUT;
+        const int          LENGTH = static_cast<int>(INPUT.length());
+
+        const int BUFFER_SIZES[] = { 1, 2, 3, 7, 16, 64, 4096 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(sizeof BUFFER_SIZES
+                                                    / sizeof *BUFFER_SIZES);
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            for (int bytewise = 0; bytewise < 2; ++bytewise) {
+                if (veryVerbose) { T_ P_(BUFFER_SIZE) P(bytewise) }
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &sa);
+
+                bdlbb::Blob blob(&factory, &sa);
+                bdlbb::BlobUtil::append(&blob, INPUT.data(), LENGTH);
+                blob.setLength(LENGTH + BUFFER_SIZE * 2);
+                blob.setLength(LENGTH);
+
+                ASSERTV(BUFFER_SIZE, blob.numBuffers() >
+                                                        blob.numDataBuffers());
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                const bdlbb::Blob EMPTY(&sa);
+                ASSERTV(BUFFER_SIZE, Obj::e_INCOMPLETE == mX.append(EMPTY));
+
+                int status = Obj::e_INCOMPLETE;
+                if (bytewise) {
+                    for (int i = 0; i < LENGTH; ++i) {
+                        bdlbb::Blob byte(&sa);
+                        bdlbb::BlobUtil::append(&byte, blob, i, 1);
+
+                        status = mX.append(byte);
+                        if (Obj::e_COMPLETE == status) {
+                            break;
+                        }
+                    }
+                }
+                else {
+                    status = mX.append(blob);
+                }
+                ASSERTV(BUFFER_SIZE, status, Obj::e_COMPLETE == status);
+                ASSERTV(BUFFER_SIZE, Obj::e_COMPLETE == mX.append(EMPTY));
+
+                test::Employee bob(&sa);
+                ASSERTV(BUFFER_SIZE, 0 == decoder.decode(X.message(),
+                                                         &bob,
+                                                         options));
+                ASSERTV(BUFFER_SIZE, "Bob" == bob.name());
+                ASSERTV(BUFFER_SIZE, "New York" == bob.homeAddress().state());
+                ASSERTV(BUFFER_SIZE, 21 == bob.age());
+
+                status = mX.popMessage();
+                ASSERTV(BUFFER_SIZE, status,
+                        bytewise ? Obj::e_INCOMPLETE == status
+                                 : Obj::e_COMPLETE   == status);
+
+                if (bytewise) {
+                    // Append the remaining bytes.
+
+                    bdlbb::Blob rest(&sa);
+                    const int   offset = static_cast<int>(
+                                                  sizeof EMPLOYEE_BOB - 1);
+                    bdlbb::BlobUtil::append(&rest, blob, offset);
+
+                    ASSERTV(BUFFER_SIZE, X.numBufferedBytes() <
+                                               static_cast<bsl::size_t>(
+                                                       LENGTH - offset));
+                    ASSERTV(BUFFER_SIZE, !X.isComplete());
+
+                    for (int i = 0; i < rest.length(); ++i) {
+                        bdlbb::Blob byte(&sa);
+                        bdlbb::BlobUtil::append(&byte, rest, i, 1);
+
+                        status = mX.append(byte);
+                        ASSERTV(BUFFER_SIZE, i,
+                                (i == rest.length() - 1) ==
+                                                 (Obj::e_COMPLETE == status));
+                    }
+                }
+
+                ASSERTV(BUFFER_SIZE, X.isComplete());
+
+                test::Employee tricky(&sa);
+                ASSERTV(BUFFER_SIZE, 0 == decoder.decode(X.message(),
+                                                         &tricky,
+                                                         options));
+                ASSERTV(BUFFER_SIZE, tricky.name(),
+                        "a \"}]\\ , \\\"" == tricky.name());
+                ASSERTV(BUFFER_SIZE, tricky.homeAddress().street(),
+                        "{[\\\"" == tricky.homeAddress().street());
+                ASSERTV(BUFFER_SIZE, 42 == tricky.age());
+
+                ASSERTV(BUFFER_SIZE, Obj::e_INCOMPLETE == mX.popMessage());
+
+                ASSERTV(BUFFER_SIZE, 0 == X.numBufferedBytes());
+                ASSERTV(BUFFER_SIZE, !X.isComplete());
+
+                // Put the framer in the error state.
+
+                bdlbb::Blob bad(&factory, &sa);
+                bdlbb::BlobUtil::append(&bad, " x{}", 4);
+
+                ASSERTV(BUFFER_SIZE, Obj::e_ERROR == mX.append(bad));
+                ASSERTV(BUFFER_SIZE, Obj::e_ERROR == mX.append(blob));
+                ASSERTV(BUFFER_SIZE, X.isError());
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'message' AND 'popMessage'
+        //
+        // Concerns:
+        //: 1 'message' refers to exactly the complete message, excluding any
+        //:   surrounding whitespace, regardless of how the data were split
+        //:   into chunks, and can be decoded by 'baljsn::Decoder'.
+        //:
+        //: 2 Data following a message are retained, and 'popMessage' scans
+        //:   them as the start of the next message, so that a sequence of
+        //:   messages may be appended without regard to their boundaries.
+        //:
+        //: 3 'popMessage' returns the status of the scan for the next
+        //:   message.
+        //:
+        //: 4 A message that is not valid JSON is framed like any other, so
+        //:   that its decoding fails without affecting the next message.
+        //:
+        //: 5 Decoded string references refer into the buffer of the framer,
+        //:   and remain valid until the next call to a manipulator.
+        //
+        // Plan:
+        //: 1 Concatenate several employee messages, one of them invalid,
+        //:   separated by whitespace.  For every chunk size from 1 to the
+        //:   length of the input, append the input in chunks of that size,
+        //:   decoding and popping each message as soon as it is complete.
+        //:   Verify the messages, the decoded values, and the return values
+        //:   of 'popMessage'.  (C-1..4)
+        //:
+        //: 2 Decode a message into a vector of string references with the
+        //:   'allowStringReferences' option set, and verify that the
+        //:   references refer into the message.  (C-5)
+        //
+        // Testing:
+        //   int popMessage();
+        //   bslstl::StringRef message() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'message' AND 'popMessage'" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator         oa("object",  veryVeryVerbose);
+        bslma::TestAllocator         sa("scratch", veryVeryVerbose);
+        const baljsn::DecoderOptions options;
+
+        if (verbose) cout << "\nFraming messages appended in chunks."
+                          << endl;
+        {
+            const char EMPLOYEE_EVE[] = "{\"name\":\"Eve\",\"age\":\"old\"}";
+
+            const char *const MESSAGES[] = {
+                EMPLOYEE_BOB, EMPLOYEE_EVE, EMPLOYEE_TRICKY
+            };
+            const int NUM_MESSAGES = static_cast<int>(sizeof MESSAGES
+                                                    / sizeof *MESSAGES);
+
+            bsl::string mINPUT("\n", &sa);
+            mINPUT += EMPLOYEE_BOB;
+            mINPUT += EMPLOYEE_EVE;
+            mINPUT += "\t";
+            mINPUT += EMPLOYEE_TRICKY;
+            mINPUT += " \n ";
+
+            const bsl::string& INPUT  = mINPUT;
+            const int          LENGTH = static_cast<int>(INPUT.length());
+
+            for (int chunkSize = 1; chunkSize <= LENGTH; ++chunkSize) {
+                if (veryVerbose) { T_ P(chunkSize) }
+
+                Obj             mX(&oa);  const Obj& X = mX;
+                baljsn::Decoder decoder(&sa);
+
+                int numFramed = 0;
+                for (int offset = 0; offset < LENGTH; offset += chunkSize) {
+                    const int length = bsl::min(chunkSize, LENGTH - offset);
+
+                    int status = mX.append(INPUT.data() + offset, length);
+                    ASSERTV(chunkSize, offset, Obj::e_ERROR != status);
+
+                    while (Obj::e_COMPLETE == status) {
+                        ASSERTV(chunkSize, numFramed,
+                                numFramed < NUM_MESSAGES);
+                        if (NUM_MESSAGES <= numFramed) {
+                            break;
+                        }
+
+                        ASSERTV(chunkSize, numFramed, X.message(),
+                                MESSAGES[numFramed] == X.message());
+
+                        test::Employee employee(&sa);
+
+                        const int rc = decoder.decode(X.message(),
+                                                      &employee,
+                                                      options);
+                        switch (numFramed) {
+                          case 0: {
+                            ASSERTV(chunkSize, rc, 0 == rc);
+                            ASSERTV(chunkSize, "Bob" == employee.name());
+                            ASSERTV(chunkSize, 21 == employee.age());
+                          } break;
+                          case 1: {
+                            ASSERTV(chunkSize, rc, 0 != rc);
+                          } break;
+                          default: {
+                            ASSERTV(chunkSize, rc, decoder.loggedMessages(),
+                                    0 == rc);
+                            ASSERTV(chunkSize, 42 == employee.age());
+                          } break;
+                        }
+                        ++numFramed;
+
+                        status = mX.popMessage();
+                        ASSERTV(chunkSize, status, Obj::e_ERROR != status);
+                        ASSERTV(chunkSize, (Obj::e_COMPLETE == status) ==
+                                                             X.isComplete());
+                    }
+                }
+
+                ASSERTV(chunkSize, numFramed, NUM_MESSAGES == numFramed);
+                ASSERTV(chunkSize, X.numBufferedBytes(),
+                        0 == X.numBufferedBytes());
+                ASSERTV(chunkSize, !X.isComplete());
+                ASSERTV(chunkSize, !X.isError());
+            }
+        }
+
+        if (verbose) cout << "\nDecoding string references." << endl;
+        {
+            baljsn::DecoderOptions mOptions;
+            mOptions.setAllowStringReferences(true);
+
+            Obj             mX(&oa);  const Obj& X = mX;
+            baljsn::Decoder decoder(&sa);
+
+            const char INPUT[] = "[\"abc\", \"d\"] [\"efg\"]";
+
+            ASSERT(Obj::e_COMPLETE == mX.append(INPUT, sizeof INPUT - 1));
+
+            const bslstl::StringRef MESSAGE = X.message();
+            ASSERTV(MESSAGE, "[\"abc\", \"d\"]" == MESSAGE);
+
+            bsl::vector<bslstl::StringRef> refs(&sa);
+            ASSERT(0 == decoder.decode(MESSAGE, &refs, mOptions));
+            ASSERTV(refs.size(), 2 == refs.size());
+            ASSERT("abc" == refs[0]);
+            ASSERT("d"   == refs[1]);
+            ASSERT(MESSAGE.begin() < refs[0].begin());
+            ASSERT(MESSAGE.end()   > refs[1].end());
+
+            ASSERT(Obj::e_COMPLETE == mX.popMessage());
+            ASSERT(X.isComplete());
+
+            // The references are not invalidated by the rescan of the
+            // remaining data.
+
+            ASSERT("abc" == refs[0]);
+
+            ASSERT(0 == decoder.decode(X.message(), &refs, mOptions));
+            ASSERTV(refs.size(), 1 == refs.size());
+            ASSERT("efg" == refs[0]);
+
+            ASSERT(Obj::e_INCOMPLETE == mX.popMessage());
+            ASSERT(0 == X.numBufferedBytes());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SCANNING FOR THE END OF A MESSAGE
+        //
+        // Concerns:
+        //: 1 'append' returns 'e_COMPLETE' exactly when a complete JSON
+        //:   object or array is buffered, counting only brackets outside of
+        //:   strings, and treating escaped quotes as part of a string.
+        //:
+        //: 2 The status does not depend on where the data are split into
+        //:   chunks, including splits within escape sequences.
+        //:
+        //: 3 Leading whitespace is skipped, and not buffered.
+        //:
+        //: 4 Data that do not start with '{' or '[' put the framer in the
+        //:   error state, in which further data are discarded until 'reset'
+        //:   is called.
+        //:
+        //: 5 'reset' discards all buffered data.
+        //
+        // Plan:
+        //: 1 Using a table of inputs and their expected status and length of
+        //:   the first message, append each input as a whole, split in two
+        //:   at every position, and one byte at a time; verify the status
+        //:   after each call, and the accessors at the end.  (C-1..3)
+        //:
+        //: 2 Verify the error state, and 'reset', directly.  (C-4..5)
+        //
+        // Testing:
+        //   baljsn::MessageFramer(bslma::Allocator *basicAllocator = 0);
+        //   ~baljsn::MessageFramer();
+        //   int append(const char *data, int length);
+        //   void reset();
+        //   bool isComplete() const;
+        //   bool isError() const;
+        //   bsl::size_t numBufferedBytes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCANNING FOR THE END OF A MESSAGE" << endl
+                          << "=================================" << endl;
+
+        const int C = Obj::e_COMPLETE;
+        const int I = Obj::e_INCOMPLETE;
+        const int E = Obj::e_ERROR;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input;     // appended data
+            int         d_status;    // expected status
+            int         d_buffered;  // expected 'numBufferedBytes()'
+        } DATA[] = {
+            //LINE  INPUT                           STATUS  BUFFERED
+            //----  ------------------------------  ------  --------
+            { L_,   "",                             I,      0        },
+            { L_,   " \t\r\n",                      I,      0        },
+            { L_,   "{",                            I,      1        },
+            { L_,   "[",                            I,      1        },
+            { L_,   "{}",                           C,      2        },
+            { L_,   "[]",                           C,      2        },
+            { L_,   "  {}",                         C,      2        },
+            { L_,   "{} ",                          C,      3        },
+            { L_,   "{}{",                          C,      3        },
+            { L_,   "{\"a\":[1,{}]}",               C,      12       },
+            { L_,   "{\"a\":[1,{}]",                I,      11       },
+            { L_,   "[[[]]",                        I,      5        },
+            { L_,   "[[[]]]",                       C,      6        },
+            { L_,   "{\"}\"",                       I,      4        },
+            { L_,   "{\"}\"}",                      C,      5        },
+            { L_,   "{\"\\\"}\"",                   I,      6        },
+            { L_,   "{\"\\\"}\"}",                  C,      7        },
+            { L_,   "{\"\\\\\"}",                   C,      6        },
+            { L_,   "{\"\\\\\\\"}\"}",              C,      9        },
+            { L_,   "[\"[\",\"{\"]",                C,      9        },
+            { L_,   "{\"a\":\"\\u007d\"}",          C,      14       },
+            { L_,   "{]",                           C,      2        },
+            { L_,   "x",                            E,      1        },
+            { L_,   "  1",                          E,      1        },
+            { L_,   "\"",                           E,      1        },
+            { L_,   "}",                            E,      1        },
+            { L_,   " ]",                           E,      1        },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *INPUT    = DATA[ti].d_input;
+            const int   STATUS   = DATA[ti].d_status;
+            const int   BUFFERED = DATA[ti].d_buffered;
+            const int   LENGTH   = static_cast<int>(bsl::strlen(INPUT));
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            // Split the input in two at every position.
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                mX.append(INPUT, split);
+                const int status = mX.append(INPUT + split, LENGTH - split);
+
+                ASSERTV(LINE, split, status, STATUS == status);
+                ASSERTV(LINE, split, X.numBufferedBytes(),
+                        static_cast<bsl::size_t>(BUFFERED) ==
+                                                        X.numBufferedBytes());
+                ASSERTV(LINE, split, (C == STATUS) == X.isComplete());
+                ASSERTV(LINE, split, (E == STATUS) == X.isError());
+            }
+
+            // Append the input one byte at a time.
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                int status = mX.append(INPUT, 0);
+                for (int i = 0; i < LENGTH; ++i) {
+                    const int prior = status;
+
+                    status = mX.append(INPUT + i, 1);
+
+                    // Once complete, or in error, the status is unchanged.
+
+                    if (I != prior) {
+                        ASSERTV(LINE, i, status, prior == status);
+                    }
+                }
+
+                ASSERTV(LINE, status, STATUS == status);
+                ASSERTV(LINE, X.numBufferedBytes(),
+                        static_cast<bsl::size_t>(BUFFERED) ==
+                                                        X.numBufferedBytes());
+
+                mX.reset();
+
+                ASSERTV(LINE, 0 == X.numBufferedBytes());
+                ASSERTV(LINE, !X.isComplete());
+                ASSERTV(LINE, !X.isError());
+            }
+        }
+
+        if (verbose) cout << "\nTesting the error state and 'reset'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(E == mX.append("?", 1));
+            ASSERT(X.isError());
+            ASSERT(1 == X.numBufferedBytes());
+
+            ASSERT(E == mX.append("{}", 2));
+            ASSERT(X.isError());
+            ASSERT(1 == X.numBufferedBytes());
+
+            mX.reset();
+            ASSERT(!X.isError());
+            ASSERT(0 == X.numBufferedBytes());
+
+            ASSERT(I == mX.append("[", 1));
+            ASSERT(I == mX.append("\"", 1));
+            mX.reset();
+            ASSERT(I == mX.append("{\"", 2));
+            ASSERT(C == mX.append("\"}", 2));
+            ASSERT(4 == X.numBufferedBytes());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append a message in two chunks, decode it, and pop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const baljsn::DecoderOptions options;
+        baljsn::Decoder              decoder;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(!X.isComplete());
+        ASSERT(0 == X.numBufferedBytes());
+
+        ASSERT(Obj::e_INCOMPLETE == mX.append(EMPLOYEE_BOB, 20));
+        ASSERT(!X.isComplete());
+        ASSERT(20 == X.numBufferedBytes());
+
+        ASSERT(Obj::e_COMPLETE == mX.append(EMPLOYEE_BOB + 20,
+                                            sizeof EMPLOYEE_BOB - 21));
+        ASSERT(X.isComplete());
+        ASSERT(EMPLOYEE_BOB == X.message());
+
+        test::Employee bob;
+        ASSERTV(decoder.loggedMessages(),
+                0 == decoder.decode(X.message(), &bob, options));
+        ASSERT("Bob"           == bob.name());
+        ASSERT("New York City" == bob.homeAddress().city());
+        ASSERT(21              == bob.age());
+
+        ASSERT(Obj::e_INCOMPLETE == mX.popMessage());
+        ASSERT(!X.isComplete());
+        ASSERT(0 == X.numBufferedBytes());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_floatconvertutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -153,6 +154,12 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
     value->clear();
 
     ++iter;
+
+    // No escape sequence decodes to more characters than it occupies, so the
+    // remaining input bounds the length of the result.
+
+    value->reserve(end - iter);
+
     while (iter < end) {
         if ('\\' == *iter) {
             ++iter;
@@ -287,7 +294,16 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
             return 0;                                                 // RETURN
         }
         else {
-            *value += *iter;
+            // Copy the whole run of characters up to the next quote or escape
+            // sequence at once.
+
+            const char *runEnd = iter + 1;
+            while (runEnd < end && '"' != *runEnd && '\\' != *runEnd) {
+                ++runEnd;
+            }
+            value->append(iter, runEnd);
+            iter = runEnd;
+            continue;
         }
         ++iter;
     }
@@ -366,6 +382,16 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
+    // Most numbers are parsed exactly without 'strtod', which also avoids
+    // copying 'data' into a null-terminated string.
+
+    if (0 == bdlb::FloatConvertUtil::parseSimpleDouble(
+                                         value,
+                                         data.data(),
+                                         static_cast<int>(data.length()))) {
+        return 0;                                                     // RETURN
+    }
+
     const int k_MAX_STRING_LENGTH = 63;
     char      buffer[k_MAX_STRING_LENGTH + 1];
 
@@ -2356,6 +2356,15 @@ int main(int argc, char *argv[])
                 {  L_, "\"\\r\"",        -1, "\r",                    -1, 1  },
                 {  L_, "\"\\t\"",        -1, "\t",                    -1, 1  },
 
+                {  L_, "\"AB\\nCD\"",    -1, "AB\nCD",                -1, 1  },
+                {  L_, "\"\\tAB\\t\"",   -1, "\tAB\t",                -1, 1  },
+                {  L_, "\"AB\\\"CD\\\\\"", -1, "AB\"CD\\",             -1, 1  },
+                {  L_, "\"ABC\"DEF\"",   -1, "ABC",                   -1, 1  },
+                {  L_, "\"A\\u0042C\"",  -1, "ABC",                   -1, 1  },
+                {  L_, "\"0123456789abcdef0123456789abcdef\"",
+                                         -1, "0123456789abcdef"
+                                             "0123456789abcdef",      -1, 1  },
+
                 {  L_, "\"u0001\"",      -1, "u0001",                 -1, 1  },
                 {  L_, "\"UABCD\"",      -1, "UABCD",                 -1, 1  },
 
@@ -82,6 +82,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_floatconvertutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -93,7 +94,6 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
-#include <bsl_c_stdio.h>
 #include <bsl_cmath.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
@@ -136,7 +136,10 @@ struct PrintUtil {
                                   const EncoderOptions *options);
         // Encode the specified floating point 'value' into JSON and output the
         // result to the specified 'stream'.  Use the optionally-specified
-        // 'options' to decide how 'value' is encoded.
+        // 'options' to decide how 'value' is encoded: with the fewest digits
+        // that preserve 'value' if 'options->encodeShortestFloatingPoint()'
+        // is 'true', and as "%.*g" formats it with the maximum precision for
+        // 'TYPE' otherwise.
 
     static int printString(bsl::ostream&             stream,
                            const bslstl::StringRef&  value);
@@ -299,22 +302,19 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
-        const int k_SIZE = 32;
-        char      buffer[k_SIZE];
+        char buffer[bdlb::FloatConvertUtil::k_SHORTEST_BUFFER_SIZE];
+        int  len;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+        if (options && options->encodeShortestFloatingPoint()) {
+            len = bdlb::FloatConvertUtil::formatShortest(buffer, value);
+        }
+        else {
+            len = bdlb::FloatConvertUtil::formatGeneral(
+                                            buffer,
+                                            sizeof buffer,
+                                            value,
+                                            maxStreamPrecision<TYPE>(options));
+        }
         stream.write(buffer, len);
       }
     }
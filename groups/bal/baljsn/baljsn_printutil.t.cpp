@@ -12,10 +12,13 @@
 
 #include <bslim_testutil.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
+#include <bsl_c_stdio.h>
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
@@ -121,6 +124,10 @@ void aSsErT(bool condition, const char *message, int line)
 # define BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
 #endif
 
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1012,6 +1019,113 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "Encode with encodeShortestFloatingPoint option"
+                          << endl;
+        {
+            const struct {
+                int         d_line;
+                double      d_value;
+                bool        d_isFloat;
+                const char *d_result;
+            } DATA[] = {
+      //LINE                   VALUE  FLOAT  RESULT
+      //----                   -----  -----  ------
+
+      { L_,                      0.0,  false, "0" },
+      { L_,                     -0.0,  false, "-0" },
+      { L_,                      1.0,  false, "1" },
+      { L_,                   101.25,  false, "101.25" },
+      { L_,                      0.1,  false, "0.1" },
+      { L_,                0.1 + 0.2,  false, "0.30000000000000004" },
+      { L_,     0.123456789012345678,  false, "0.12345678901234568" },
+      { L_,                  1.0 / 3,  false, "0.3333333333333333" },
+      { L_,                      0.1,  true,  "0.1" },
+      { L_,                  1.0 / 3,  true,  "0.33333334" },
+      { L_,             0.123456789f,  true,  "0.12345679" },
+      { L_,                 16777218,  true,  "16777218" },
+
+#if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
+      { L_,                 -9.9e100,  false, "-9.9e+100" },
+      { L_,  -1.2345678901234567e-20,  false, "-1.2345678901234567e-020" },
+      { L_,           -1.23456e-20f,  true,  "-1.23456e-020" },
+#else
+      { L_,                 -9.9e100,  false, "-9.9e+100" },
+      { L_,  -1.2345678901234567e-20,  false, "-1.2345678901234567e-20" },
+      { L_,           -1.23456e-20f,  true,  "-1.23456e-20" },
+#endif
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const double      VALUE    = DATA[ti].d_value;
+                const bool        IS_FLOAT = DATA[ti].d_isFloat;
+                const char *const EXP      = DATA[ti].d_result;
+
+                baljsn::EncoderOptions options;
+                options.setEncodeShortestFloatingPoint(true);
+
+                bsl::ostringstream oss;
+                if (IS_FLOAT) {
+                    ASSERTV(LINE, 0 == Obj::printValue(
+                                                  oss,
+                                                  static_cast<float>(VALUE),
+                                                  &options));
+                }
+                else {
+                    ASSERTV(LINE, 0 == Obj::printValue(oss, VALUE, &options));
+                }
+
+                bsl::string result = oss.str();
+                ASSERTV(LINE, result, EXP, result == EXP);
+            }
+        }
+
+        if (verbose) cout << "Compare encoded doubles with 'snprintf'"
+                          << endl;
+        {
+            // The encoder has always formatted floating-point values with
+            // 'snprintf', and must continue to produce the same bytes.
+
+            bsls::Types::Uint64 state = 1;
+
+            for (int i = 0; i < 20000; ++i) {
+                state = state * 6364136223846793005ULL
+                                                      + 1442695040888963407ULL;
+
+                double value;
+                if (i % 2) {
+                    value = static_cast<double>(state >> 24 & 0xFFFFFFF) /
+                                                                         100.0;
+                }
+                else {
+                    const bsls::Types::Uint64 bits = state;
+                    bsl::memcpy(&value, &bits, sizeof value);
+                    if (!(value == value) || value - value != 0) {
+                        continue;                                   // CONTINUE
+                    }
+                }
+
+                for (int precision = 1; precision <= 17; ++precision) {
+                    baljsn::EncoderOptions options;
+                    options.setMaxDoublePrecision(precision);
+
+                    bsl::ostringstream oss;
+                    ASSERTV(value, 0 == Obj::printValue(oss, value, &options));
+
+                    char expected[32];
+                    snprintf(expected,
+                             sizeof expected,
+                             "%-1.*g",
+                             precision,
+                             value);
+
+                    ASSERTV(value, precision, oss.str(), expected,
+                            oss.str() == expected);
+                }
+            }
+        }
+
         if (verbose) cout << "Encode invalid double" << endl;
         {
             bsl::ostringstream oss;
@@ -4,12 +4,20 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BALJSN_TOKENIZER_X86_SIMD
+#include <immintrin.h>
+#endif
+
 #include <baljsn_parserutil.h>                 // for testing only
 
 // IMPLEMENTATION NOTES
@@ -53,12 +61,237 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
 
+// Most of the time spent tokenizing is spent finding the end of a run of
+// characters: whitespace between tokens, the characters of a string, and the
+// characters of a number or literal.  Each of these scans looks for the first
+// character belonging to (or not belonging to) a small set of characters, and
+// is performed by one of the 'find' functions below.  On x86-64 the scan
+// classifies 16 characters at a time using SSE2 instructions (which every
+// x86-64 processor supports), in the manner of simdjson's structural
+// character classification, and falls back to a table lookup for the
+// trailing characters and on other platforms.  Note that the vector loop
+// never reads past the end of the characters being scanned.
+//
+// Wider (AVX2) scanning, selected at run time, was measured and rejected:
+// the runs found in typical documents are short, and the 32-character loop
+// was no faster on large documents and markedly slower on small ones.
+
 namespace BloombergLP {
 namespace {
+namespace u {
+
+enum CharClass {
+    // This 'enum' lists the classes of characters that terminate a scan.
+
+    e_WS  = 1,  // whitespace: ' ', '\t', '\n', '\v', '\f', '\r'
+    e_TK  = 2,  // token: '{', '}', '[', ']', ':', ','
+    e_ST  = 4   // string special: '"', '\\'
+};
+
+static const unsigned char CHAR_CLASS[256] = {
+  // 0     1     2     3     4     5     6     7
+  // 8     9     A     B     C     D     E     F
+
+     0,    0,    0,    0,    0,    0,    0,    0,              // 00
+     0, e_WS, e_WS, e_WS, e_WS, e_WS,    0,    0,              // 08
+     0,    0,    0,    0,    0,    0,    0,    0,              // 10
+     0,    0,    0,    0,    0,    0,    0,    0,              // 18
+  e_WS,    0, e_ST,    0,    0,    0,    0,    0,              // 20
+     0,    0,    0,    0, e_TK,    0,    0,    0,              // 28
+     0,    0,    0,    0,    0,    0,    0,    0,              // 30
+     0,    0, e_TK,    0,    0,    0,    0,    0,              // 38
+     0,    0,    0,    0,    0,    0,    0,    0,              // 40
+     0,    0,    0,    0,    0,    0,    0,    0,              // 48
+     0,    0,    0,    0,    0,    0,    0,    0,              // 50
+     0,    0,    0, e_TK, e_ST, e_TK,    0,    0,              // 58
+     0,    0,    0,    0,    0,    0,    0,    0,              // 60
+     0,    0,    0,    0,    0,    0,    0,    0,              // 68
+     0,    0,    0,    0,    0,    0,    0,    0,              // 70
+     0,    0,    0, e_TK,    0, e_TK,    0,    0,              // 78
+
+     0,    0,    0,    0,    0,    0,    0,    0,              // 80
+     0,    0,    0,    0,    0,    0,    0,    0,              // 88
+     0,    0,    0,    0,    0,    0,    0,    0,              // 90
+     0,    0,    0,    0,    0,    0,    0,    0,              // 98
+     0,    0,    0,    0,    0,    0,    0,    0,              // A0
+     0,    0,    0,    0,    0,    0,    0,    0,              // A8
+     0,    0,    0,    0,    0,    0,    0,    0,              // B0
+     0,    0,    0,    0,    0,    0,    0,    0,              // B8
+     0,    0,    0,    0,    0,    0,    0,    0,              // C0
+     0,    0,    0,    0,    0,    0,    0,    0,              // C8
+     0,    0,    0,    0,    0,    0,    0,    0,              // D0
+     0,    0,    0,    0,    0,    0,    0,    0,              // D8
+     0,    0,    0,    0,    0,    0,    0,    0,              // E0
+     0,    0,    0,    0,    0,    0,    0,    0,              // E8
+     0,    0,    0,    0,    0,    0,    0,    0,              // F0
+     0,    0,    0,    0,    0,    0,    0,    0               // F8
+};
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+
+inline
+__m128i whitespace128(__m128i chars)
+    // Return a mask having all bits of each byte set for which the
+    // corresponding byte in the specified 'chars' is whitespace.
+{
+    // '\t', '\n', '\v', '\f', and '\r' are the contiguous range [9 .. 13].
+
+    const __m128i offset  = _mm_sub_epi8(chars, _mm_set1_epi8(9));
+    const __m128i control = _mm_cmpeq_epi8(
+                                 _mm_min_epu8(offset, _mm_set1_epi8(4)),
+                                 offset);
+    return _mm_or_si128(control,
+                        _mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')));
+}
+
+inline
+__m128i token128(__m128i chars)
+    // Return a mask having all bits of each byte set for which the
+    // corresponding byte in the specified 'chars' is a token character.
+{
+    // '[' and ']' differ from '{' and '}' only in bit 5.
+
+    const __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    return _mm_or_si128(
+               _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                            _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+               _mm_or_si128(_mm_cmpeq_epi8(chars,  _mm_set1_epi8(':')),
+                            _mm_cmpeq_epi8(chars,  _mm_set1_epi8(','))));
+}
+
+#endif  // BALJSN_TOKENIZER_X86_SIMD
+
+struct NonWhitespace {
+    // This 'struct' identifies the characters that are not whitespace.
+
+    static bool isMatch(char ch)
+        // Return 'true' if the specified 'ch' is not whitespace, and 'false'
+        // otherwise.
+    {
+        return 0 == (CHAR_CLASS[static_cast<unsigned char>(ch)] & e_WS);
+    }
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+    static unsigned int match16(const char *data)
+        // Return a bit mask of the bytes in the 16 characters at the
+        // specified 'data' that are not whitespace.
+    {
+        const __m128i chars = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(data));
+        return ~_mm_movemask_epi8(whitespace128(chars)) & 0xFFFFu;
+    }
+#endif
+};
+
+struct Delimiter {
+    // This 'struct' identifies the characters that end a number or a literal:
+    // whitespace and token characters.
+
+    static bool isMatch(char ch)
+        // Return 'true' if the specified 'ch' is whitespace or a token
+        // character, and 'false' otherwise.
+    {
+        return 0 != (CHAR_CLASS[static_cast<unsigned char>(ch)]
+                     & (e_WS | e_TK));
+    }
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+    static unsigned int match16(const char *data)
+        // Return a bit mask of the bytes in the 16 characters at the
+        // specified 'data' that are whitespace or token characters.
+    {
+        const __m128i chars = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(data));
+        return _mm_movemask_epi8(_mm_or_si128(whitespace128(chars),
+                                              token128(chars)));
+    }
+#endif
+};
+
+struct StringSpecial {
+    // This 'struct' identifies the characters that end or escape a character
+    // within a string: '"' and '\\'.
+
+    static bool isMatch(char ch)
+        // Return 'true' if the specified 'ch' is '"' or '\\', and 'false'
+        // otherwise.
+    {
+        return 0 != (CHAR_CLASS[static_cast<unsigned char>(ch)] & e_ST);
+    }
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+    static unsigned int match16(const char *data)
+        // Return a bit mask of the bytes in the 16 characters at the
+        // specified 'data' that are '"' or '\\'.
+    {
+        const __m128i chars = _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i *>(data));
+        return _mm_movemask_epi8(
+                     _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')),
+                                  _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))));
+    }
+#endif
+};
+
+template <class CLASS>
+bsl::size_t findScalar(const char *data, bsl::size_t pos, bsl::size_t length)
+    // Return the position of the first character in the specified 'data' at
+    // or after the specified 'pos' and before the specified 'length' that is
+    // matched by the specified 'CLASS', or 'length' if there is no such
+    // character.
+{
+    while (pos < length && !CLASS::isMatch(data[pos])) {
+        ++pos;
+    }
+    return pos;
+}
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+
+template <class CLASS>
+bsl::size_t findSse2(const char *data, bsl::size_t pos, bsl::size_t length)
+    // Return the position of the first character in the specified 'data' at
+    // or after the specified 'pos' and before the specified 'length' that is
+    // matched by the specified 'CLASS', or 'length' if there is no such
+    // character.  Use SSE2 instructions.
+{
+    while (pos + 16 <= length) {
+        const unsigned int mask = CLASS::match16(data + pos);
+        if (mask) {
+            return pos + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        pos += 16;
+    }
+    return findScalar<CLASS>(data, pos, length);
+}
+
+#endif  // BALJSN_TOKENIZER_X86_SIMD
+
+template <class CLASS>
+inline
+bsl::size_t find(const char *data, bsl::size_t pos, bsl::size_t length)
+    // Return the position of the first character in the specified 'data' at
+    // or after the specified 'pos' and before the specified 'length' that is
+    // matched by the specified 'CLASS', or 'length' if there is no such
+    // character.
+{
+    // Runs are frequently empty (e.g., a single space between tokens), so
+    // check the first character before entering the vector loop.
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+    if (pos >= length || CLASS::isMatch(data[pos])) {
+        return pos;                                                   // RETURN
+    }
+
+#ifdef BALJSN_TOKENIZER_X86_SIMD
+    return findSse2<CLASS>(data, pos + 1, length);
+#else
+    return findScalar<CLASS>(data, pos + 1, length);
+#endif
+}
 
+}  // close namespace u
 }  // close unnamed namespace
 
 namespace baljsn {
@@ -70,17 +303,27 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    d_input_p     = d_stringBuffer.data();
+    d_inputLength = d_stringBuffer.length();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -88,11 +331,17 @@ int Tokenizer::expandBufferForLargeValue()
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
     d_stringBuffer.resize(currLength + numRead);
+    d_input_p     = d_stringBuffer.data();
+    d_inputLength = d_stringBuffer.length();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -105,6 +354,8 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
                                              k_MAX_STRING_SIZE - d_valueIter));
 
     d_stringBuffer.resize(d_valueIter + numRead);
+    d_input_p     = d_stringBuffer.data();
+    d_inputLength = d_stringBuffer.length();
 
     return numRead;
 }
@@ -112,9 +363,10 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
+        const bsl::size_t pos = u::find<u::NonWhitespace>(d_input_p,
+                                                          d_cursor,
+                                                          d_inputLength);
+        if (pos < d_inputLength) {
             d_cursor = pos;
             break;
         }
@@ -133,21 +385,32 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        while (d_valueIter < d_inputLength
+            && '"' != d_input_p[d_valueIter]) {
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+            if ('\\' == previousChar || '\\' == d_input_p[d_valueIter]) {
+                if ('\\' == d_input_p[d_valueIter]
+                 && '\\' == previousChar) {
+                    previousChar = 0;
+                }
+                else {
+                    previousChar = d_input_p[d_valueIter];
+                }
+
+                ++d_valueIter;
             }
             else {
-                previousChar = d_stringBuffer[d_valueIter];
-            }
+                // Skip the run of characters that neither end the string nor
+                // escape the next character.
 
-            ++d_valueIter;
+                d_valueIter  = u::find<u::StringSpecial>(d_input_p,
+                                                         d_valueIter + 1,
+                                                         d_inputLength);
+                previousChar = d_input_p[d_valueIter - 1];
+            }
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_inputLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -194,13 +457,11 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        d_valueIter = u::find<u::Delimiter>(d_input_p,
+                                            d_valueIter,
+                                            d_inputLength);
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_inputLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -239,7 +500,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_inputLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +519,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_input_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -572,6 +833,10 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
@@ -590,8 +855,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_input_p + d_valueBegin, d_input_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
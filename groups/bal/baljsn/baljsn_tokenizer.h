@@ -23,6 +23,24 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Contiguous Input
+///----------------
+// A tokenizer can also be associated with JSON data that is already in
+// memory, by supplying that data (as a 'bslstl::StringRef') to 'reset'.  In
+// that case the tokenizer scans the data in place: no characters are copied
+// into the internal buffer, and the string references returned by 'value'
+// refer directly into the supplied data (and so remain valid for as long as
+// the data does).  Note that 'resetStreamBufGetPointer' fails for such a
+// tokenizer, as there is no 'streambuf' to reposition.
+//
+///Performance
+///-----------
+// On x86-64 platforms, the tokenizer finds the end of each run of whitespace,
+// string characters, and number or literal characters by classifying 16
+// characters at a time using SSE2 instructions, and uses a table-driven
+// scalar scan otherwise.  Tokenizing contiguous input additionally avoids
+// copying the input into the internal buffer.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -131,6 +149,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
+#include <bslstl_stringref.h>
+
+#include <bsl_cstddef.h>
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -144,8 +165,9 @@ namespace baljsn {
 
 class Tokenizer {
     // This 'class' provides a mechanism for traversing JSON data stored in a
-    // 'bsl::streambuf' one node at a time and allows clients to access the
-    // data associated with that node, including its type and data value.
+    // 'bsl::streambuf' (or in contiguous memory) one node at a time and
+    // allows clients to access the data associated with that node, including
+    // its type and data value.
 
   public:
     // TYPES
@@ -208,7 +230,20 @@ class Tokenizer {
 
     bsl::streambuf                      *d_streambuf_p;     // streambuf
                                                             // (held, not
-                                                            // owned)
+                                                            // owned), or 0
+                                                            // for contiguous
+                                                            // input
+
+    const char                          *d_input_p;         // characters
+                                                            // being tokenized
+                                                            // (either
+                                                            // 'd_stringBuffer'
+                                                            // or contiguous
+                                                            // input)
+
+    bsl::size_t                          d_inputLength;     // number of
+                                                            // characters at
+                                                            // 'd_input_p'
 
     bsl::size_t                          d_cursor;          // current cursor
 
@@ -251,19 +286,22 @@ class Tokenizer {
         // additional characters, from the internally-held 'streambuf'
         // ('d_streambuf_p') to the end of that sequence up to a maximum
         // sequence length of 'd_buffer.size()' characters.  Return the number
-        // of bytes read from the 'streambuf'.
+        // of bytes read from the 'streambuf', which is 0 if this tokenizer
+        // reads contiguous input.
 
     int reloadStringBuffer();
         // Reload the string buffer with new data read from the underlying
         // 'streambuf' and overwriting the current buffer.  After reading
         // update the cursor to the new read location.  Return the number of
-        // bytes read from the 'streambuf'.
+        // bytes read from the 'streambuf', which is 0 if this tokenizer reads
+        // contiguous input.
 
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
         // append additional characters, from the internally-held 'streambuf' (
         // 'd_streambuf_p') to the end of the current sequence of characters.
-        // Return 0 on success and a non-zero value otherwise.
+        // Return 0 on success and a non-zero value otherwise (including if
+        // this tokenizer reads contiguous input).
 
     int skipWhitespace();
         // Skip all whitespace characters and position the cursor onto the
@@ -307,6 +345,14 @@ class Tokenizer {
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const bslstl::StringRef& data);
+        // Reset this tokenizer to read the specified contiguous JSON 'data'.
+        // The characters of 'data' are tokenized in place, and must remain
+        // valid and unmodified until this tokenizer is reset or destroyed.
+        // Note that the reader will not be on a valid node until
+        // 'advanceToNextToken' is called.  Note that this function does not
+        // change the value of the 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Note that each call to
@@ -323,7 +369,8 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  Also note that this function fails if
+        // this object reads contiguous input.
 
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
@@ -358,7 +405,8 @@ class Tokenizer {
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'BAEJSN_ELEMENT_NAME' or
         // 'BAEJSN_ELEMENT_VALUE' or leave 'data' unmodified otherwise.  Return
-        // 0 on success and a non-zero value otherwise.
+        // 0 on success and a non-zero value otherwise.  Note that if this
+        // tokenizer reads contiguous input, 'data' refers into that input.
 };
 
 // ============================================================================
@@ -399,6 +447,8 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_input_p(0)
+, d_inputLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -425,6 +475,25 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p = streambuf;
     d_stringBuffer.clear();
+    d_input_p     = d_stringBuffer.data();
+    d_inputLength = 0;
+    d_cursor      = 0;
+    d_valueBegin  = 0;
+    d_valueEnd    = 0;
+    d_valueIter   = 0;
+    d_tokenType   = e_BEGIN;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
+inline
+void Tokenizer::reset(const bslstl::StringRef& data)
+{
+    d_streambuf_p = 0;
+    d_stringBuffer.clear();
+    d_input_p     = data.data();
+    d_inputLength = data.length();
     d_cursor      = 0;
     d_valueBegin  = 0;
     d_valueEnd    = 0;
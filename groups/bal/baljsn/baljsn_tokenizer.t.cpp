@@ -17,6 +17,8 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bdlsb_memoutstreambuf.h>            // for testing only
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
@@ -49,6 +51,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [17] void reset(const bslstl::StringRef& data);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -61,7 +64,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [17] USAGE EXAMPLE
+// [18] CONCERN: SCANNING RUNS OF CHARACTERS OF ANY LENGTH
+// [19] USAGE EXAMPLE
+// [-1] PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -175,6 +180,38 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+int tokenize(bsl::vector<Obj::TokenType> *tokens,
+             bsl::vector<bsl::string>    *values,
+             const bsl::string&           input,
+             bool                         contiguous)
+    // Append to the specified 'tokens' and 'values' the type and the value
+    // (or the empty string if the token has no value) of each token of the
+    // specified 'input', read in place if the specified 'contiguous' is
+    // 'true', and from a 'streambuf' otherwise, until 'advanceToNextToken'
+    // fails.  Return the number of tokens appended.
+{
+    bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+    Obj mX;  const Obj& X = mX;
+    if (contiguous) {
+        mX.reset(input);
+    }
+    else {
+        mX.reset(&isb);
+    }
+
+    int numTokens = 0;
+    while (0 == mX.advanceToNextToken()) {
+        bslstl::StringRef value;
+
+        tokens->push_back(X.tokenType());
+        values->push_back(0 == X.value(&value) ? bsl::string(value)
+                                               : bsl::string());
+        ++numTokens;
+    }
+    return numTokens;
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -196,7 +233,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +355,357 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // CONCERN: SCANNING RUNS OF CHARACTERS OF ANY LENGTH
+        //
+        // Concerns:
+        //: 1 A run of whitespace, of string characters, or of number
+        //:   characters is correctly delimited whatever its length, and
+        //:   wherever its delimiter falls relative to the 16- and 32-byte
+        //:   blocks in which characters are classified.
+        //:
+        //: 2 Each whitespace character, and each token character, ends a
+        //:   number.
+        //:
+        //: 3 An escaped '"' does not end a string, whereas a '"' following an
+        //:   escaped '\\' does, wherever the escape sequences appear.
+        //:
+        //: 4 Runs that are longer than the internal buffer are delimited
+        //:   correctly when read from a 'streambuf'.
+        //:
+        //: 5 QoI: Scanning never reads past the end of contiguous input.
+        //
+        // Plan:
+        //: 1 For run lengths from 0 to 80, and for selected lengths spanning
+        //:   the size of the internal buffer, tokenize, both in place and from
+        //:   a 'streambuf', documents having a run of whitespace of that
+        //:   length before and after a value, a number of that length
+        //:   followed by each possible delimiter, and a string of that length
+        //:   having an escape sequence at each position.  Verify the tokens
+        //:   and values.  (C-1..4)
+        //:
+        //: 2 Tokenize in place inputs copied to the end of a buffer that is
+        //:   immediately followed by a '"' (and a digit) and verify that the
+        //:   result is unaffected.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: SCANNING RUNS OF CHARACTERS OF ANY LENGTH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                   << endl
+                   << "CONCERN: SCANNING RUNS OF CHARACTERS OF ANY LENGTH\n"
+                   << "=================================================="
+                   << endl;
+
+        bsl::vector<bsl::size_t> lengths;
+        for (bsl::size_t i = 0; i <= 80; ++i) {
+            lengths.push_back(i);
+        }
+        lengths.push_back(8190);
+        lengths.push_back(8191);
+        lengths.push_back(8192);
+        lengths.push_back(8193);
+        lengths.push_back(20000);
+
+        const char WHITESPACE[] = " \t\n\v\f\r";
+
+        if (verbose) cout << "\nTesting whitespace." << endl;
+
+        for (bsl::size_t ti = 0; ti < lengths.size(); ++ti) {
+            const bsl::size_t LENGTH = lengths[ti];
+
+            bsl::string ws;
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                ws += WHITESPACE[i % 6];
+            }
+            const bsl::string INPUT = ws + "[" + ws + "12" + ws + "]" + ws;
+
+            for (int contiguous = 0; contiguous < 2; ++contiguous) {
+                bsl::vector<Obj::TokenType> tokens;
+                bsl::vector<bsl::string>    values;
+
+                const int NUM = tokenize(&tokens, &values, INPUT, contiguous);
+                ASSERTV(LENGTH, contiguous, NUM, 3 == NUM);
+                if (3 != NUM) {
+                    continue;
+                }
+                ASSERTV(LENGTH, Obj::e_START_ARRAY   == tokens[0]);
+                ASSERTV(LENGTH, Obj::e_ELEMENT_VALUE == tokens[1]);
+                ASSERTV(LENGTH, Obj::e_END_ARRAY     == tokens[2]);
+                ASSERTV(LENGTH, values[1], "12" == values[1]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting numbers." << endl;
+
+        const char *const SUFFIXES[] = {
+            " }", "\t}", "\n}", "\v}", "\f}", "\r}", "}", ",\"b\":1}",
+            "]}", "[]}", "{}}", ":1}"
+        };
+        enum { NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES };
+
+        for (bsl::size_t ti = 0; ti < lengths.size(); ++ti) {
+            const bsl::size_t LENGTH = lengths[ti];
+
+            bsl::string number("-");
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                number += static_cast<char>('0' + i % 10);
+            }
+
+            for (int si = 0; si < NUM_SUFFIXES; ++si) {
+                const bsl::string INPUT = "{\"a\":" + number + SUFFIXES[si];
+
+                for (int contiguous = 0; contiguous < 2; ++contiguous) {
+                    bsl::vector<Obj::TokenType> tokens;
+                    bsl::vector<bsl::string>    values;
+
+                    const int NUM = tokenize(&tokens,
+                                             &values,
+                                             INPUT,
+                                             contiguous);
+                    ASSERTV(LENGTH, si, contiguous, NUM, 3 <= NUM);
+                    if (3 > NUM) {
+                        continue;
+                    }
+                    ASSERTV(LENGTH, si, Obj::e_ELEMENT_VALUE == tokens[2]);
+                    ASSERTV(LENGTH, si, number == values[2]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting strings." << endl;
+
+        const char *const ESCAPES[] = {
+            "", "\\\"", "\\\\", "\\\\\\\"", "\\\\\\\\", "\\u0022", "\\/"
+        };
+        enum { NUM_ESCAPES = sizeof ESCAPES / sizeof *ESCAPES };
+
+        for (bsl::size_t ti = 0; ti < lengths.size(); ++ti) {
+            const bsl::size_t LENGTH = lengths[ti];
+
+            for (int ei = 0; ei < NUM_ESCAPES; ++ei) {
+
+                // Insert the escape sequence at every position of short
+                // strings, and at the ends of long strings.
+
+                for (bsl::size_t pos = 0; pos <= LENGTH; ++pos) {
+                    if (LENGTH > 80 && pos > 2 && pos < LENGTH - 2) {
+                        pos = LENGTH - 2;
+                    }
+
+                    bsl::string text(LENGTH, 'x');
+                    text.insert(pos, ESCAPES[ei]);
+
+                    const bsl::string NAME  = text + "n";
+                    const bsl::string VALUE = "\"" + text + "\"";
+                    const bsl::string INPUT = "{\"" + NAME + "\":" + VALUE
+                                            + "}";
+
+                    for (int contiguous = 0; contiguous < 2; ++contiguous) {
+                        bsl::vector<Obj::TokenType> tokens;
+                        bsl::vector<bsl::string>    values;
+
+                        const int NUM = tokenize(&tokens,
+                                                 &values,
+                                                 INPUT,
+                                                 contiguous);
+                        ASSERTV(LENGTH, ei, pos, contiguous, NUM, 4 == NUM);
+                        if (4 != NUM) {
+                            continue;
+                        }
+                        ASSERTV(LENGTH, ei, pos,
+                                Obj::e_ELEMENT_NAME  == tokens[1]);
+                        ASSERTV(LENGTH, ei, pos, NAME  == values[1]);
+                        ASSERTV(LENGTH, ei, pos,
+                                Obj::e_ELEMENT_VALUE == tokens[2]);
+                        ASSERTV(LENGTH, ei, pos, VALUE == values[2]);
+                        ASSERTV(LENGTH, ei, pos,
+                                Obj::e_END_OBJECT    == tokens[3]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting the end of contiguous input." << endl;
+        {
+            // Each input ends within a run, so that a scan reading past its
+            // end would find the '"' or the digit that follows.
+
+            const char *const INPUTS[] = {
+                "\"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz",
+                "12345678901234567890123456789012345678901234567890",
+                "                                                   "
+            };
+            enum { NUM_INPUTS = sizeof INPUTS / sizeof *INPUTS };
+
+            for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+                const bsl::size_t LENGTH = bsl::strlen(INPUTS[ti]);
+
+                for (bsl::size_t len = 1; len <= LENGTH; ++len) {
+                    char buffer[128];
+                    char *begin = buffer + sizeof buffer - 2 - len;
+                    bsl::memcpy(begin, INPUTS[ti], len);
+                    begin[len]     = '"';
+                    begin[len + 1] = '1';
+
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(bslstl::StringRef(begin, len));
+
+                    const int rc = mX.advanceToNextToken();
+                    if ('1' == INPUTS[ti][0]) {
+                        // A number ends at the end of the input.
+
+                        bslstl::StringRef value;
+                        ASSERTV(ti, len, rc, 0 == rc);
+                        ASSERTV(ti, len, 0 == X.value(&value));
+                        ASSERTV(ti, len, len == value.length());
+                    }
+                    else {
+                        // An unterminated string, or whitespace only, is an
+                        // error.
+
+                        ASSERTV(ti, len, rc, 0 != rc);
+                    }
+                }
+            }
+        }
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset(const bslstl::StringRef&)'
+        //
+        // Concerns:
+        //: 1 A tokenizer reset to contiguous input produces the same tokens
+        //:   and values as a tokenizer reading the same data from a
+        //:   'streambuf', including for values larger than the internal
+        //:   buffer.
+        //:
+        //: 2 The string references loaded by 'value' refer into the input.
+        //:
+        //: 3 Invalid and truncated input is reported as an error.
+        //:
+        //: 4 'resetStreamBufGetPointer' fails for contiguous input.
+        //:
+        //: 5 A tokenizer can be reset from contiguous input to a 'streambuf',
+        //:   and vice versa.
+        //:
+        //: 6 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, tokenize a set of valid and
+        //:   invalid documents both in place and from a 'streambuf', and
+        //:   verify that the results are identical.  (C-1, 3)
+        //:
+        //: 2 Verify that the 'value' of each token addresses the input.  (C-2)
+        //:
+        //: 3 Call 'resetStreamBufGetPointer' on a tokenizer reading contiguous
+        //:   input, and verify that it fails.  (C-4)
+        //:
+        //: 4 Alternate the kind of input of a single tokenizer.  (C-5)
+        //:
+        //: 5 Install a test allocator as the default allocator and supply
+        //:   another to the tokenizer, and verify that neither allocates.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void reset(const bslstl::StringRef& data);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reset(const bslstl::StringRef&)'\n"
+                          << "========================================="
+                          << endl;
+
+        const bsl::string LONG_NAME(10000, 'n');
+        const bsl::string LONG_VALUE(10000, 'v');
+
+        bsl::vector<bsl::string> DATA;
+        DATA.push_back("");
+        DATA.push_back("   ");
+        DATA.push_back("{}");
+        DATA.push_back("[]");
+        DATA.push_back("1");
+        DATA.push_back("\"stand alone\"");
+        DATA.push_back("{ \"a\" : 1, \"b\" : [ true, false, null ] }");
+        DATA.push_back("{\"a\":{\"b\":{\"c\":[[1,2],[3,4]]}},\"d\":\"e\"}");
+        DATA.push_back("{\"esc\\\"aped\":\"a\\\\\",\"b\":\"\\u0041\"}");
+        DATA.push_back(WS "{" WS "\"a\"" WS ":" WS "-1.5e10" WS "}" WS);
+        DATA.push_back("{\"" + LONG_NAME + "\":\"" + LONG_VALUE + "\"}");
+        DATA.push_back("[" + LONG_VALUE.substr(0, 9000) + "]");
+        DATA.push_back("{\"a\" 1}");
+        DATA.push_back("{\"a\":1,}");
+        DATA.push_back("[1 2]");
+        DATA.push_back("{\"a\":\"unterminated");
+        DATA.push_back("{\"a\":[1,2");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (bsl::size_t ti = 0; ti < DATA.size(); ++ti) {
+            const bsl::string& INPUT = DATA[ti];
+
+            if (veryVerbose) { T_ P_(ti) P(INPUT.substr(0, 60)) }
+
+            bslma::TestAllocator xa("objectX", veryVeryVerbose);
+            bslma::TestAllocator ya("objectY", veryVeryVerbose);
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.length());
+
+            Obj mX(&xa);  const Obj& X = mX;  // contiguous
+            Obj mY(&ya);  const Obj& Y = mY;  // 'streambuf'
+
+            mX.reset(INPUT);
+            mY.reset(&isb);
+
+            while (true) {
+                const int rcX = mX.advanceToNextToken();
+                const int rcY = mY.advanceToNextToken();
+
+                ASSERTV(ti, rcX, rcY, rcX == rcY);
+                ASSERTV(ti, X.tokenType(), Y.tokenType(),
+                        X.tokenType() == Y.tokenType());
+
+                if (rcX || rcY) {
+                    break;
+                }
+
+                bslstl::StringRef valueX;
+                bslstl::StringRef valueY;
+                const int vX = X.value(&valueX);
+                const int vY = Y.value(&valueY);
+
+                ASSERTV(ti, vX, vY, vX == vY);
+                if (0 == vX && 0 == vY) {
+                    ASSERTV(ti, valueX, valueY, valueX == valueY);
+                    ASSERTV(ti, INPUT.data() <= valueX.data());
+                    ASSERTV(ti, valueX.data() + valueX.length()
+                                            <= INPUT.data() + INPUT.length());
+                }
+            }
+
+            ASSERTV(ti, 0 != mX.resetStreamBufGetPointer());
+            ASSERTV(ti, xa.numBlocksTotal(), 0 == xa.numBlocksTotal());
+
+            // Reuse each tokenizer for the other kind of input.
+
+            bdlsb::FixedMemInStreamBuf isb2(INPUT.data(), INPUT.length());
+            mX.reset(&isb2);
+            mY.reset(INPUT);
+
+            bsl::vector<Obj::TokenType> tokensX, tokensY;
+            while (0 == mX.advanceToNextToken()) {
+                tokensX.push_back(X.tokenType());
+            }
+            while (0 == mY.advanceToNextToken()) {
+                tokensY.push_back(Y.tokenType());
+            }
+            ASSERTV(ti, tokensX == tokensY);
+            ASSERTV(ti, X.tokenType() == Y.tokenType());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING that arrays of heterogenous types are handled correctly
@@ -6814,6 +7202,101 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of tokenizing a large and a small
+        //:   document, read both from a 'streambuf' and in place.
+        //
+        // Plan:
+        //: 1 Generate a large (about 1MB) pretty-printed document and a small
+        //:   (about 300 bytes) one, and time tokenizing each repeatedly, both
+        //:   from a 'bdlsb::FixedMemInStreamBuf' and in place.  The number of
+        //:   repetitions of the large document may be given as the second
+        //:   argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: STREAMBUF AND CONTIGUOUS INPUT" << endl
+             << "===========================================" << endl;
+
+        const int NUM_REPS = argc > 2 ? atoi(argv[2]) : 20;
+
+        const bsl::string small(
+                   "{\n"
+                   "    \"name\" : \"Employee Name\",\n"
+                   "    \"street\" : \"731 Lexington Avenue, New York, NY\",\n"
+                   "    \"note\" : \"line one\\nline two \\\"quoted\\\"\",\n"
+                   "    \"id\" : 1234567,\n"
+                   "    \"salary\" : 123456.75,\n"
+                   "    \"active\" : true,\n"
+                   "    \"tags\" : [ \"alpha\", \"beta\", \"gamma\" ],\n"
+                   "    \"manager\" : null\n"
+                   "}");
+
+        bsl::string large("[\n");
+        while (large.length() < 1024 * 1024) {
+            if (large.length() > 2) {
+                large += ",\n";
+            }
+            large += small;
+        }
+        large += "\n]";
+
+        struct {
+            const char        *d_name;
+            const bsl::string *d_input_p;
+            int                d_numReps;
+        } DATA[] = {
+            { "large", &large, NUM_REPS                                   },
+            { "small", &small, static_cast<int>(NUM_REPS * large.length()
+                                                       / small.length())  }
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::string& INPUT = *DATA[ti].d_input_p;
+            const int          REPS  = DATA[ti].d_numReps;
+
+            for (int contiguous = 0; contiguous < 2; ++contiguous) {
+                Obj mX;
+
+                bsls::Types::Int64 numTokens = 0;
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < REPS; ++i) {
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+                    if (contiguous) {
+                        mX.reset(INPUT);
+                    }
+                    else {
+                        mX.reset(&isb);
+                    }
+                    while (0 == mX.advanceToNextToken()) {
+                        ++numTokens;
+                    }
+                }
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+                const double megabytes = static_cast<double>(INPUT.length())
+                                       * REPS / (1024 * 1024);
+
+                cout << DATA[ti].d_name << " document ("
+                     << INPUT.length() << " bytes, "
+                     << (contiguous ? "contiguous" : "streambuf") << "): "
+                     << numTokens / REPS << " tokens, "
+                     << megabytes / seconds << " MB/s" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -26,6 +26,13 @@ AttributeContainer::~AttributeContainer()
 {
 }
 
+// ACCESSORS
+bool AttributeContainer::visitAttributes(
+                      const bsl::function<void(const Attribute&)>&) const
+{
+    return false;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -24,7 +24,17 @@ BSLS_IDENT("$Id: $")
 // 'ball::AttributeContainer', for containers of 'ball::Attribute' values.  The
 // 'ball::AttributeContainer' protocol primarily provides a 'hasValue()'
 // method, allowing clients to determine if a given attribute value is held by
-// the container.
+// the container, and a 'visitAttributes()' method, allowing clients (e.g.,
+// 'ball::StructuredRecordFormatter') to enumerate the attributes held by the
+// container.
+//
+// Note that 'visitAttributes()' was added to this protocol after its initial
+// release, and therefore has a default implementation that visits no
+// attributes and returns 'false', so that existing implementations of the
+// protocol continue to compile.  Such implementations should override it
+// (typically by invoking the visitor on each attribute they hold, and
+// returning 'true') to make their attributes available to clients that
+// enumerate attributes.
 //
 // This component participates in the implementation of "Rule-Based Logging".
 // For more information on how to use that feature, please see the package
@@ -104,6 +114,11 @@ BSLS_IDENT("$Id: $")
 //                                  int           level = 0,
 //                                  int           spacesPerLevel = 4) const;
 //          // Format this object to the specified output 'stream'.
+//
+//      virtual bool visitAttributes(
+//         const bsl::function<void(const ball::Attribute&)>& visitor) const;
+//          // Invoke the specified 'visitor' function for every attribute in
+//          // this container, and return 'true'.
 //  };
 //
 //  // CREATORS
@@ -146,6 +161,15 @@ BSLS_IDENT("$Id: $")
 //      printer.end();
 //      return stream;
 //  }
+//
+//  bool ServiceAttributes::visitAttributes(
+//         const bsl::function<void(const ball::Attribute&)>& visitor) const
+//  {
+//      visitor(d_uuid);
+//      visitor(d_luw);
+//      visitor(d_firmNumber);
+//      return true;
+//  }
 //..
 //
 ///Example 2: A Generic Implementation of 'ball::AttributeContainer'
@@ -233,6 +257,11 @@ BSLS_IDENT("$Id: $")
 //          // Format this object to the specified output 'stream' at the
 //          // (absolute value of) the optionally specified indentation 'level'
 //          // and return a reference to 'stream'.
+//
+//      virtual bool visitAttributes(
+//         const bsl::function<void(const ball::Attribute&)>& visitor) const;
+//          // Invoke the specified 'visitor' function for every attribute in
+//          // this set, and return 'true'.
 //  };
 //..
 // The 'AttributeSet' methods are simple wrappers around 'bsl::set' methods:
@@ -284,6 +313,16 @@ BSLS_IDENT("$Id: $")
 //
 //      return stream;
 //  }
+//
+//  bool AttributeSet::visitAttributes(
+//         const bsl::function<void(const ball::Attribute&)>& visitor) const
+//  {
+//      bsl::set<ball::Attribute>::const_iterator it = d_set.begin();
+//      for (; it != d_set.end(); ++it) {
+//          visitor(*it);
+//      }
+//      return true;
+//  }
 //..
 //
 ///Example 3. Using a 'ball::AttributeContainer'
@@ -319,6 +358,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -357,6 +397,16 @@ class AttributeContainer {
         // negative, format the entire output on one line, suppressing all but
         // the initial indentation (as governed by 'level').  If 'stream' is
         // not valid on entry, this operation has no effect.
+
+    virtual bool visitAttributes(
+         const bsl::function<void(const Attribute&)>& visitor) const;
+        // Invoke the specified 'visitor' function for every attribute in this
+        // container, and return 'true' if this container supports the
+        // enumeration of its attributes, and 'false' otherwise.  The default
+        // implementation of this method visits no attributes and returns
+        // 'false'; containers whose attributes should be available to
+        // consumers other than the rule-evaluation machinery (e.g.,
+        // 'ball::StructuredRecordFormatter') should override it.
 };
 
 // FREE OPERATORS
@@ -173,6 +173,11 @@ typedef ball::AttributeContainer Obj;
                                     int           level = 0,
                                     int           spacesPerLevel = 4) const;
             // Format this object to the specified output 'stream'.
+
+        virtual bool visitAttributes(
+           const bsl::function<void(const ball::Attribute&)>& visitor) const;
+            // Invoke the specified 'visitor' function for every attribute in
+            // this container, and return 'true'.
     };
 
 
@@ -216,6 +221,15 @@ typedef ball::AttributeContainer Obj;
         printer.end();
         return stream;
     }
+
+    bool ServiceAttributes::visitAttributes(
+           const bsl::function<void(const ball::Attribute&)>& visitor) const
+    {
+        visitor(d_uuid);
+        visitor(d_luw);
+        visitor(d_firmNumber);
+        return true;
+    }
 //
 ///Example 2: A Generic Implementation of 'ball::AttributeContainer'
 ///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -305,6 +319,11 @@ typedef ball::AttributeContainer Obj;
             // Format this object to the specified output 'stream' at the
             // (absolute value of) the optionally specified indentation 'level'
             // and return a reference to 'stream'.
+
+        virtual bool visitAttributes(
+           const bsl::function<void(const ball::Attribute&)>& visitor) const;
+            // Invoke the specified 'visitor' function for every attribute in
+            // this set, and return 'true'.
     };
 
 //..
@@ -360,6 +379,16 @@ typedef ball::AttributeContainer Obj;
         return stream;
     }
 
+    bool AttributeSet::visitAttributes(
+           const bsl::function<void(const ball::Attribute&)>& visitor) const
+    {
+        bsl::set<ball::Attribute>::const_iterator it = d_set.begin();
+        for (; it != d_set.end(); ++it) {
+            visitor(*it);
+        }
+        return true;
+    }
+
 //=============================================================================
 //                         GLOBAL CLASSES FOR TESTING
 //-----------------------------------------------------------------------------
@@ -369,6 +398,9 @@ struct AttributeContainerTest :
     bool hasValue(const ball::Attribute&) const        { return markDone(); }
     bsl::ostream& print(bsl::ostream&, int, int) const
                                                       { return markDoneRef(); }
+    bool visitAttributes(
+               const bsl::function<void(const ball::Attribute&)>&) const
+                                                        { return markDone(); }
 };
 
 //=============================================================================
@@ -461,6 +493,8 @@ int main(int argc, char *argv[])
 
         BSLS_PROTOCOLTEST_ASSERT(t, hasValue(ball::Attribute("", 0)));
         BSLS_PROTOCOLTEST_ASSERT(t, print(cout, 0, 0));
+        BSLS_PROTOCOLTEST_ASSERT(t, visitAttributes(
+                          bsl::function<void(const ball::Attribute&)>()));
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -186,6 +186,21 @@ AttributeContainerList::print(bsl::ostream& stream,
     return stream << bsl::flush;
 }
 
+bool AttributeContainerList::visitAttributes(
+                 const bsl::function<void(const Attribute&)>& visitor) const
+{
+    bool result = true;
+
+    Node *node = d_head_p;
+    while (node) {
+        if (!node->d_value_p->visitAttributes(visitor)) {
+            result = false;
+        }
+        node = node->d_next_p;
+    }
+    return result;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -106,6 +106,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -313,6 +314,14 @@ class AttributeContainerList {
         // suppressing all but the initial indentation (as governed by
         // 'level').  If 'stream' is not valid on entry, this operation has no
         // effect.
+
+    bool visitAttributes(
+         const bsl::function<void(const Attribute&)>& visitor) const;
+        // Invoke the specified 'visitor' function for every attribute in each
+        // of the attribute containers referred to by this object, in list
+        // order.  Return 'true' if each of these containers supports the
+        // enumeration of its attributes (see
+        // 'AttributeContainer::visitAttributes'), and 'false' otherwise.
 };
 
 // FREE OPERATORS
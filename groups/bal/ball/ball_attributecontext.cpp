@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 
 #include <ball_attributecontainer.h>   // for testing only
+#include <ball_category.h>
 #include <ball_categorymanager.h>
 #include <ball_predicate.h>            // for testing only
 #include <ball_rule.h>
@@ -405,6 +406,33 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
 }
 
 // ACCESSORS
+int AttributeContext::determineThreshold(const Category *category) const
+{
+    BSLS_ASSERT(category);
+
+    if (!category->relevantRuleMask()) {
+        return category->maxLevel();                                  // RETURN
+    }
+
+    // The generation must be loaded *before* the threshold is computed, so
+    // that a concurrent modification of the rules or thresholds that is not
+    // reflected in the computed threshold invalidates the cached entry.
+
+    const bsls::Types::Int64 generation = Category::thresholdGeneration();
+
+    int threshold;
+    if (d_thresholdCache.lookup(&threshold, category, generation)) {
+        return threshold;                                             // RETURN
+    }
+
+    ThresholdAggregate levels;
+    determineThresholdLevels(&levels, category);
+    threshold = ThresholdAggregate::maxLevel(levels);
+
+    d_thresholdCache.insert(category, generation, threshold);
+    return threshold;
+}
+
 bsl::ostream& AttributeContext::print(bsl::ostream& stream,
                                       int           level,
                                       int           spacesPerLevel) const
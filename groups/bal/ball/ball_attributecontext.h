@@ -67,6 +67,27 @@ BSLS_IDENT("$Id: $")
 // category, factoring in any active rules that apply to the category that
 // might override the category's thresholds.
 //
+// 'determineThreshold' returns the numerical maximum of the threshold levels
+// that 'determineThresholdLevels' would return for a category.  It is the
+// method used (by 'ball::LoggerManager::isCategoryEnabled') to decide whether
+// a log record is to be created at all, and its result is cached per thread
+// (see {Threshold Cache}).
+//
+///Threshold Cache
+///---------------
+// When a logging rule applies to a category, the logging macros cannot decide,
+// from the threshold cached at the point of logging (see 'ball_category'),
+// whether a record of a given severity is disabled for the current thread,
+// and must determine the thresholds for the category given the current
+// thread's attributes.  To keep the cost of disabled log statements low in
+// that case, each 'ball::AttributeContext' holds a small direct-mapped cache
+// from category address to the threshold returned by 'determineThreshold'.
+// A cache entry is valid as long as (1) the process-wide threshold generation
+// maintained by 'ball::Category' (which changes whenever any category's
+// thresholds or relevant rules change) is unchanged, and (2) the attributes
+// of the context have not been modified (i.e., 'addAttributes',
+// 'removeAttributes', and 'clearCache' invalidate every entry).
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of 'ball::AttributeContext'.
@@ -444,6 +465,80 @@ bsl::ostream& operator<<(
     // specified 'stream' in some single-line human readable format, and return
     // the modifiable 'stream'.
 
+                // =====================================
+                // class AttributeContext_ThresholdCache
+                // =====================================
+
+class AttributeContext_ThresholdCache {
+    // This is an implementation type of 'AttributeContext' and should not be
+    // used by clients of this package.  A threshold cache is a direct-mapped
+    // cache from the address of a category to the (rule-adjusted) threshold of
+    // that category, tagged with the threshold generation (see
+    // 'Category::thresholdGeneration') at which the threshold was computed.
+    // 'clear' invalidates all entries in constant time by incrementing an
+    // epoch number that is stored in each entry.
+
+    // PRIVATE TYPES
+    struct Entry {
+        // This 'struct' holds a single cache entry.
+
+        const Category     *d_category_p;  // key (held, not owned), or 0
+        bsls::Types::Int64  d_generation;  // threshold generation of entry
+        unsigned int        d_epoch;       // epoch at which entry was stored
+        int                 d_threshold;   // cached threshold
+    };
+
+    enum {
+        k_NUM_ENTRIES_LOG2 = 6,                       // log2 of cache size
+        k_NUM_ENTRIES      = 1 << k_NUM_ENTRIES_LOG2  // number of entries
+    };
+
+    // DATA
+    unsigned int d_epoch;                   // current epoch
+
+    Entry        d_entries[k_NUM_ENTRIES];  // cache entries
+
+    // NOT IMPLEMENTED
+    AttributeContext_ThresholdCache(const AttributeContext_ThresholdCache&);
+    AttributeContext_ThresholdCache& operator=(
+                                       const AttributeContext_ThresholdCache&);
+
+    // PRIVATE CLASS METHODS
+    static int index(const Category *category);
+        // Return the index of the entry that may cache the threshold of the
+        // specified 'category'.
+
+  public:
+    // CREATORS
+    AttributeContext_ThresholdCache();
+        // Create an empty threshold cache.
+
+    // ~AttributeContext_ThresholdCache();
+        // Destroy this threshold cache.  Note that this trivial destructor is
+        // generated by the compiler.
+
+    // MANIPULATORS
+    void clear();
+        // Invalidate all entries of this cache.
+
+    void insert(const Category     *category,
+                bsls::Types::Int64  generation,
+                int                 threshold);
+        // Cache the specified 'threshold' for the specified 'category',
+        // computed at the specified threshold 'generation', replacing any
+        // entry that occupies the same slot.
+
+    // ACCESSORS
+    bool lookup(int                *threshold,
+                const Category     *category,
+                bsls::Types::Int64  generation) const;
+        // Load into the specified 'threshold' the threshold cached for the
+        // specified 'category' and return 'true' if this cache holds a valid
+        // entry for 'category' computed at the specified threshold
+        // 'generation', and return 'false' (with no effect on 'threshold')
+        // otherwise.
+};
+
                         // ======================
                         // class AttributeContext
                         // ======================
@@ -495,6 +590,10 @@ class AttributeContext {
     mutable RuleEvaluationCache
                              d_ruleCache_p;        // cache of rule evaluations
 
+    mutable AttributeContext_ThresholdCache
+                             d_thresholdCache;     // cache of rule-adjusted
+                                                   // category thresholds
+
     bslma::Allocator        *d_allocator_p;        // allocator used to create
                                                    // this object (held, not
                                                    // owned)
@@ -629,6 +728,17 @@ class AttributeContext {
         // registry maintained by the category manager supplied to
         // 'initialize'.
 
+    int determineThreshold(const Category *category) const;
+        // Return the numerical maximum of the threshold levels that
+        // 'determineThresholdLevels' would load for the specified 'category'.
+        // The result is cached by this object, and is recomputed only if the
+        // threshold levels or relevant rules of any category, or the
+        // attributes of this object, have changed since it was cached.  The
+        // behavior is undefined unless 'initialize' has previously been
+        // invoked without a subsequent call to 'reset', and 'category' is
+        // contained in the registry maintained by the category manager
+        // supplied to 'initialize'.
+
     bool hasAttribute(const Attribute& value) const;
         // Return 'true' if an attribute having the specified 'value' exists in
         // any of the attribute containers maintained by this object, and
@@ -730,6 +840,85 @@ AttributeContext_RuleEvaluationCache::knownActiveRules() const
     return d_resultMask;
 }
 
+                // -------------------------------------
+                // class AttributeContext_ThresholdCache
+                // -------------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int AttributeContext_ThresholdCache::index(const Category *category)
+{
+    // Categories are heap allocated, so use a multiplicative (Fibonacci) hash
+    // to spread the address bits over the entries.
+
+    const bsls::Types::Uint64 address =
+                              reinterpret_cast<bsls::Types::UintPtr>(category);
+
+    return static_cast<int>((address * 0x9E3779B97F4A7C15ULL)
+                                                >> (64 - k_NUM_ENTRIES_LOG2));
+}
+
+// CREATORS
+inline
+AttributeContext_ThresholdCache::AttributeContext_ThresholdCache()
+: d_epoch(0)
+{
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        d_entries[i].d_category_p = 0;
+    }
+}
+
+// MANIPULATORS
+inline
+void AttributeContext_ThresholdCache::clear()
+{
+    if (0 == ++d_epoch) {
+        // The epoch wrapped around, so entries stored at an earlier epoch
+        // having the same value must be explicitly invalidated.
+
+        for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+            d_entries[i].d_category_p = 0;
+        }
+    }
+}
+
+inline
+void AttributeContext_ThresholdCache::insert(
+                                         const Category     *category,
+                                         bsls::Types::Int64  generation,
+                                         int                 threshold)
+{
+    BSLS_ASSERT(category);
+
+    Entry& entry = d_entries[index(category)];
+
+    entry.d_category_p = category;
+    entry.d_generation = generation;
+    entry.d_epoch      = d_epoch;
+    entry.d_threshold  = threshold;
+}
+
+// ACCESSORS
+inline
+bool AttributeContext_ThresholdCache::lookup(
+                                   int                *threshold,
+                                   const Category     *category,
+                                   bsls::Types::Int64  generation) const
+{
+    BSLS_ASSERT(threshold);
+    BSLS_ASSERT(category);
+
+    const Entry& entry = d_entries[index(category)];
+
+    if (entry.d_category_p == category
+     && entry.d_generation == generation
+     && entry.d_epoch      == d_epoch) {
+        *threshold = entry.d_threshold;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
                         // ----------------------
                         // class AttributeContext
                         // ----------------------
@@ -742,6 +931,7 @@ AttributeContext::addAttributes(const AttributeContainer *attributes)
     BSLS_ASSERT(attributes);
 
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
     return d_containerList.pushFront(attributes);
 }
 
@@ -749,12 +939,14 @@ inline
 void AttributeContext::clearCache()
 {
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
 }
 
 inline
 void AttributeContext::removeAttributes(iterator element)
 {
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
     d_containerList.remove(element);
 }
 
@@ -71,6 +71,7 @@ using namespace bsl;
 // [ 3] void removeAttributes(iterator element);
 // [ 4] bool hasRelevantActiveRules(const Cat *cat) const;
 // [ 4] void determineThresholdLevels(TL *lvls, const Cat *cat) const;
+// [ 4] int determineThreshold(const Cat *cat) const;
 // [ 3] bool hasAttribute(const Attribute& value) const;
 // [ 3] const AttributeContainerList& containers() const;
 // [  ] bsl::ostream& print(bsl::ostream& stream, int level, int spl) const;
@@ -915,6 +916,14 @@ extern "C" void *case4ContextThread(void *args)
         LOOP_ASSERT(i, i == levels.triggerLevel());
         LOOP_ASSERT(i, i == levels.triggerAllLevel());
 
+        // 'determineThreshold' must agree with 'determineThresholdLevels',
+        // both when the threshold is computed and when it is cached.
+
+        LOOP_ASSERT(i, ball::ThresholdAggregate::maxLevel(levels)
+                                      == X.determineThreshold(CATEGORIES[i]));
+        LOOP_ASSERT(i, ball::ThresholdAggregate::maxLevel(levels)
+                                      == X.determineThreshold(CATEGORIES[i]));
+
         // Forcibly clear the rule evaluation cache every few iterations.
 
         if (0 == i % 3) {
@@ -957,6 +966,12 @@ extern "C" void *case4ContextThread(void *args)
             LOOP2_ASSERT(i, j, level == levels.passLevel());
             LOOP2_ASSERT(i, j, level == levels.triggerLevel());
             LOOP2_ASSERT(i, j, level == levels.triggerAllLevel());
+
+            // A threshold cached before the attributes were modified must not
+            // be returned.
+
+            LOOP2_ASSERT(i, j, ball::ThresholdAggregate::maxLevel(levels)
+                                      == X.determineThreshold(CATEGORIES[j]));
         }
     }
 
@@ -1034,6 +1049,12 @@ extern "C" void *case4ContextThread(void *args)
         LOOP_ASSERT(i, CATEGORIES[i]->triggerLevel()== levels.triggerLevel());
         LOOP_ASSERT(i, CATEGORIES[i]->triggerAllLevel()
                                                   == levels.triggerAllLevel());
+
+        // A threshold cached while the (since removed) rules were active must
+        // not be returned.
+
+        LOOP_ASSERT(i, CATEGORIES[i]->maxLevel()
+                                      == X.determineThreshold(CATEGORIES[i]));
     }
 
     return 0;
@@ -1781,6 +1802,7 @@ int main(int argc, char *argv[])
         //   void clearCache();
         //   bool hasRelevantActiveRules(const Cat *cat) const;
         //   void determineThresholdLevels(TL *lvls, const Cat *cat) const;
+        //   int determineThreshold(const Cat *cat) const;
         // --------------------------------------------------------------------
 
         if (verbose) cout
@@ -1853,6 +1875,9 @@ int main(int argc, char *argv[])
             ASSERT_FAIL(context->determineThresholdLevels(&levels,   0));
             ASSERT_FAIL(context->determineThresholdLevels(      0, cat));
 
+            ASSERT_PASS(context->determineThreshold(cat));
+            ASSERT_FAIL(context->determineThreshold(  0));
+
             ball::AttributeContextProctor proctor;  // destroys context
         }
 
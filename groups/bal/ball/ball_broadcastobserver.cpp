@@ -25,6 +25,22 @@ BroadcastObserver::~BroadcastObserver()
     deregisterAllObservers();
 }
 
+// PRIVATE MANIPULATORS
+void BroadcastObserver::updateObserverList()
+{
+    ObserverList::Snapshot observers(d_observers.get_allocator());
+    observers.reserve(d_observers.size());
+
+    ObserverRegistry::const_iterator it  = d_observers.begin();
+    ObserverRegistry::const_iterator end = d_observers.end();
+
+    for (; it != end; ++it) {
+        observers.push_back(it->second.get());
+    }
+
+    d_observerList.setObservers(observers);
+}
+
 // MANIPULATORS
 int BroadcastObserver::deregisterObserver(
                                          const bslstl::StringRef& observerName)
@@ -41,6 +57,8 @@ int BroadcastObserver::deregisterObserver(
 
     d_observers.erase(it);
 
+    updateObserverList();
+
     observer->releaseRecords();
 
     return 0;
@@ -50,6 +68,8 @@ void BroadcastObserver::deregisterAllObservers()
 {
     bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
 
+    d_observerList.setObservers(ObserverList::Snapshot());
+
     ObserverRegistry::iterator it = d_observers.begin();
 
     while (it != d_observers.end()) {
@@ -78,13 +98,12 @@ bsl::shared_ptr<Observer> BroadcastObserver::findObserver(
 void BroadcastObserver::publish(const bsl::shared_ptr<const Record>& record,
                                 const Context&                       context)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
+    ObserverListGuard guard(&d_observerList);
 
-    ObserverRegistry::const_iterator it  = d_observers.begin();
-    ObserverRegistry::const_iterator end = d_observers.end();
+    const int numObservers = guard.numObservers();
 
-    for (; it != end; ++it) {
-        (it->second)->publish(record, context);
+    for (int i = 0; i < numObservers; ++i) {
+        guard.observer(i)->publish(record, context);
     }
 }
 
@@ -94,18 +113,23 @@ int BroadcastObserver::registerObserver(
 {
     bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
 
-    return !d_observers.emplace(observerName, observer).second;
+    if (!d_observers.emplace(observerName, observer).second) {
+        return 1;                                                     // RETURN
+    }
+
+    updateObserverList();
+
+    return 0;
 }
 
 void BroadcastObserver::releaseRecords()
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
+    ObserverListGuard guard(&d_observerList);
 
-    ObserverRegistry::const_iterator it  = d_observers.begin();
-    ObserverRegistry::const_iterator end = d_observers.end();
+    const int numObservers = guard.numObservers();
 
-    for (; it != end; ++it) {
-        (it->second)->releaseRecords();
+    for (int i = 0; i < numObservers; ++i) {
+        guard.observer(i)->releaseRecords();
     }
 }
 
@@ -49,6 +49,17 @@ BSLS_IDENT("$Id: $")
 // share the same instance, or may have their own instances (see
 // 'bsldoc_glossary').
 //
+///Performance
+///-----------
+// 'publish' and 'releaseRecords' do not acquire a lock: the registered
+// observers are read from an immutable snapshot (see 'ball_observerlist')
+// that is replaced, under a write lock, whenever an observer is registered or
+// deregistered.  Registering and deregistering observers is therefore
+// relatively expensive (in particular, 'deregisterObserver' waits for all
+// concurrent calls to 'publish' that may use the deregistered observer to
+// complete), which is appropriate since the set of registered observers
+// typically changes only during application start-up and shut-down.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -139,6 +150,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <ball_observer.h>
+#include <ball_observerlist.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
@@ -181,15 +193,29 @@ class BroadcastObserver : public Observer {
 
   private:
     // DATA
-    ObserverRegistry                 d_observers;  // observer registry
+    ObserverRegistry                 d_observers;     // observer registry
+
+    ObserverList                     d_observerList;  // snapshot of the
+                                                      // observers in
+                                                      // 'd_observers', read
+                                                      // by 'publish'
 
-    mutable bslmt::ReaderWriterMutex d_rwMutex;    // protects concurrent
-                                                   // access to 'd_observers'
+    mutable bslmt::ReaderWriterMutex d_rwMutex;       // protects concurrent
+                                                      // access to
+                                                      // 'd_observers'
 
     // NOT IMPLEMENTED
     BroadcastObserver(const BroadcastObserver&);
     BroadcastObserver& operator=(const BroadcastObserver&);
 
+    // PRIVATE MANIPULATORS
+    void updateObserverList();
+        // Replace the snapshot of registered observers read by 'publish' and
+        // 'releaseRecords' with the current contents of 'd_observers', and
+        // block until no concurrent call to those methods uses the previous
+        // snapshot.  The behavior is undefined unless the calling thread holds
+        // a write lock on 'd_rwMutex'.
+
   public:
     // CREATORS
     explicit BroadcastObserver(bslma::Allocator *basicAllocator = 0);
@@ -347,6 +373,7 @@ class BroadcastObserver : public Observer {
 inline
 BroadcastObserver::BroadcastObserver(bslma::Allocator *basicAllocator)
 : d_observers(bslma::Default::allocator(basicAllocator))
+, d_observerList(bslma::Default::allocator(basicAllocator))
 {
 }
 
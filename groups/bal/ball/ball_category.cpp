@@ -20,6 +20,10 @@ namespace ball {
                             // class Category
                             // --------------
 
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int64
+                                       Category::s_thresholdGeneration = { 0 };
+
 // PRIVATE CREATORS
 Category::Category(const char       *categoryName,
                    int               recordLevel,
@@ -42,6 +46,11 @@ Category::Category(const char       *categoryName,
 , d_ruleThreshold(0)
 {
     BSLS_ASSERT(categoryName);
+
+    // A new category may occupy the address of a destroyed one, so results
+    // cached for that address must be invalidated.
+
+    incrementThresholdGeneration();
 }
 
 // PRIVATE MANIPULATORS
@@ -105,6 +114,7 @@ int Category::setLevels(int recordLevel,
                                                    triggerLevel,
                                                    triggerAllLevel);
 
+        incrementThresholdGeneration();
         updateThresholdForHolders();
         return 0;                                                     // RETURN
     }
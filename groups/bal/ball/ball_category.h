@@ -54,6 +54,17 @@ BSLS_IDENT("$Id: $")
 //:   evaluation of the logging rules and current 'ball::AttributeContext' must
 //:   be performed).
 //
+///Threshold Generation
+/// - - - - - - - - - -
+// 'ball::Category' maintains a process-wide *threshold generation*, a counter
+// that is incremented (after the change is made) whenever a category is
+// created, or the threshold levels, relevant rule mask, or rule threshold of
+// any category are modified.  The value returned by
+// 'ball::Category::thresholdGeneration' can therefore be used to validate a
+// cached result that was computed from the state of a category: the result
+// is still valid if the generation loaded *before* it was computed is equal
+// to the current generation (see 'ball_attributecontext').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -151,6 +162,13 @@ class Category {
     mutable int         d_ruleThreshold;    // numerical maximum of all four
                                             // levels for all relevant rules
 
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int64
+                        s_thresholdGeneration;
+                                            // incremented after each change
+                                            // to the thresholds or rule
+                                            // cache of any category
+
     // FRIENDS
     friend class CategoryManagerImpUtil;
 
@@ -159,6 +177,12 @@ class Category {
     Category& operator=(const Category&);
 
   private:
+    // PRIVATE CLASS METHODS
+    static void incrementThresholdGeneration();
+        // Increment the process-wide threshold generation.  This method must
+        // be called *after* each modification of the threshold levels,
+        // relevant rule mask, or rule threshold of any category.
+
     // PRIVATE MANIPULATORS
     void linkCategoryHolder(CategoryHolder *categoryHolder);
         // Load this category and its corresponding 'maxLevel()' into the
@@ -186,6 +210,15 @@ class Category {
         // 'triggerLevel' and 'triggerAllLevel' threshold values are in the
         // range '[0 .. 255]', and 'false' otherwise.
 
+    static bsls::Types::Int64 thresholdGeneration();
+        // Return the current process-wide threshold generation.  The returned
+        // value changes after any category is created, and after the
+        // threshold levels, relevant rule mask, or rule threshold of any
+        // category are modified.  Note that a value computed from the state
+        // of categories is up-to-date if the threshold generation loaded
+        // before the value was computed is equal to the current threshold
+        // generation.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Category, bslma::UsesBslmaAllocator);
 
@@ -410,6 +443,13 @@ class CategoryManagerImpUtil {
                         // class Category
                         // --------------
 
+// PRIVATE CLASS METHODS
+inline
+void Category::incrementThresholdGeneration()
+{
+    bsls::AtomicOperations::addInt64AcqRel(&s_thresholdGeneration, 1);
+}
+
 // CLASS METHODS
 inline
 bool Category::areValidThresholdLevels(int recordLevel,
@@ -423,6 +463,12 @@ bool Category::areValidThresholdLevels(int recordLevel,
              >> k_BITS_PER_CHAR);
 }
 
+inline
+bsls::Types::Int64 Category::thresholdGeneration()
+{
+    return bsls::AtomicOperations::getInt64Acquire(&s_thresholdGeneration);
+}
+
 // ACCESSORS
 inline
 const char *Category::categoryName() const
@@ -570,6 +616,7 @@ void CategoryManagerImpUtil::setRuleThreshold(Category *category,
                                               int       ruleThreshold)
 {
     category->d_ruleThreshold = ruleThreshold;
+    Category::incrementThresholdGeneration();
 }
 
 inline
@@ -577,6 +624,7 @@ void CategoryManagerImpUtil::enableRule(Category *category, int ruleIndex)
 {
     category->d_relevantRuleMask =
         bdlb::BitUtil::withBitSet(category->d_relevantRuleMask, ruleIndex);
+    Category::incrementThresholdGeneration();
 }
 
 inline
@@ -584,6 +632,7 @@ void CategoryManagerImpUtil::disableRule(Category *category, int ruleIndex)
 {
     category->d_relevantRuleMask =
         bdlb::BitUtil::withBitCleared(category->d_relevantRuleMask, ruleIndex);
+    Category::incrementThresholdGeneration();
 }
 
 inline
@@ -591,6 +640,7 @@ void CategoryManagerImpUtil::setRelevantRuleMask(Category          *category,
                                                  RuleSet::MaskType  mask)
 {
     category->d_relevantRuleMask = mask;
+    Category::incrementThresholdGeneration();
 }
 
 }  // close package namespace
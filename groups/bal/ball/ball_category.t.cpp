@@ -45,12 +45,15 @@ using namespace bsl;
 //: o No memory is ever allocated from the default allocator.
 //: o Precondition violations are detected in appropriate build modes.
 // ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bsls::Types::Int64 thresholdGeneration();
+//
 // CREATORS
 // [  ] Category();
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [ 3] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -152,7 +155,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -210,6 +213,84 @@ int main(int argc, char *argv[])
     }
 //..
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'thresholdGeneration'
+        //
+        // Concerns:
+        //: 1 The threshold generation changes when a category is created.
+        //:
+        //: 2 The threshold generation changes when the threshold levels of a
+        //:   category are set, but not when 'setLevels' fails.
+        //:
+        //: 3 The threshold generation changes when the relevant rule mask or
+        //:   the rule threshold of a category is modified through
+        //:   'CategoryManagerImpUtil'.
+        //:
+        //: 4 The threshold generation does not change when category holders
+        //:   are linked, updated, or reset.
+        //
+        // Plan:
+        //: 1 Perform each operation of concerns 1-4 in turn, and compare the
+        //:   threshold generation before and after the operation.  (C-1..4)
+        //
+        // Testing:
+        //   static bsls::Types::Int64 thresholdGeneration();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'thresholdGeneration'" << endl
+                          << "=============================" << endl;
+
+        typedef ball::CategoryManagerImpUtil Util;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsls::Types::Int64 generation = Obj::thresholdGeneration();
+
+        Obj mX("example", 1, 2, 3, 4, &oa);
+
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        ASSERT(0 == mX.setLevels(5, 6, 7, 8));
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        ASSERT(0 != mX.setLevels(256, 6, 7, 8));
+        ASSERT(generation == Obj::thresholdGeneration());
+
+        Util::enableRule(&mX, 3);
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        Util::disableRule(&mX, 3);
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        Util::setRelevantRuleMask(&mX, 5);
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        Util::setRuleThreshold(&mX, 64);
+        ASSERT(generation != Obj::thresholdGeneration());
+
+        generation = Obj::thresholdGeneration();
+
+        ball::CategoryHolder holder = {
+            { ball::CategoryHolder::e_UNINITIALIZED_CATEGORY }, { 0 }, { 0 }
+        };
+
+        Util::linkCategoryHolder(&mX, &holder);
+        Util::updateThresholdForHolders(&mX);
+        Util::resetCategoryHolders(&mX);
+        ASSERT(generation == Obj::thresholdGeneration());
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST
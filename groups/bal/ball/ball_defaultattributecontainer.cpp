@@ -63,6 +63,15 @@ bsl::ostream& DefaultAttributeContainer::print(
     return stream;
 }
 
+bool DefaultAttributeContainer::visitAttributes(
+                 const bsl::function<void(const Attribute&)>& visitor) const
+{
+    for (const_iterator iter = begin(); iter != end(); ++iter) {
+        visitor(*iter);
+    }
+    return true;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -225,6 +225,11 @@ class DefaultAttributeContainer : public AttributeContainer {
         // suppressing all but the initial indentation (as governed by
         // 'level').  If 'stream' is not valid on entry, this operation has no
         // effect.
+
+    virtual bool visitAttributes(
+         const bsl::function<void(const Attribute&)>& visitor) const;
+        // Invoke the specified 'visitor' function for every attribute in this
+        // container, and return 'true'.
 };
 
 // FREE OPERATORS
@@ -49,6 +49,7 @@ using namespace bsl;
 // [11] const_iterator begin() const;
 // [11] const_iterator end() const;
 // [ 5] bsl::ostream& print(bsl::ostream& stream, int lvl, int spl) const;
+// [13] bool visitAttributes(const bsl::function<void(const Attr&)>&) const;
 // [ 6] bool operator==(const ball::AS& lhs, const ball::AS& rhs)
 // [ 6] bool operator!=(const ball::AS& lhs, const ball::AS& rhs)
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const ball::AS&) const;
@@ -57,7 +58,7 @@ using namespace bsl;
 // [ 3] Obj& gg(Obj *obj, const char *spec);
 // [ 8] UNUSED
 // [10] UNUSED
-// [13] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -303,6 +304,70 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'visitAttributes'
+        //
+        // Concerns:
+        //: 1 'visitAttributes' invokes the visitor exactly once for each
+        //:   attribute in the container, and not at all for an empty
+        //:   container.
+        //:
+        //: 2 'visitAttributes' returns 'true'.
+        //
+        // Plan:
+        //: 1 For a set of test vectors, generate a container using 'gg',
+        //:   visit its attributes, collecting them into a second container,
+        //:   and verify that the two containers are equal, that the number
+        //:   of visits equals the number of attributes, and that 'true' is
+        //:   returned.  (C-1..2)
+        //
+        // Testing:
+        //   bool visitAttributes(const bsl::function<...>& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'visitAttributes'"
+                          << "\n========================="
+                          << endl;
+
+        struct Collector {
+            // Add each visited attribute to a container, and count visits.
+
+            Obj *d_container_p;
+            int *d_count_p;
+
+            void operator()(const ball::Attribute& attribute) const
+            {
+                d_container_p->addAttribute(attribute);
+                ++*d_count_p;
+            }
+        };
+
+        static const char* SPECS[] = {
+            "",
+            "AA",
+            "Ai1",
+            "AI1",
+            "AABi1",
+            "AABBCCDDEEFFGGHH",
+        };
+        enum { NUM_SPECS = sizeof SPECS / sizeof *SPECS };
+
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            Obj mX; const Obj& X = mX;
+            gg(&mX, SPECS[i]);
+
+            Obj mY; const Obj& Y = mY;
+            int count = 0;
+            Collector collector = { &mY, &count };
+
+            const ball::AttributeContainer& C = X;
+            ASSERTV(i, true == C.visitAttributes(collector));
+
+            ASSERTV(i, X.numAttributes() == count);
+            ASSERTV(i, X == Y);
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -2927,6 +2927,28 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+double disabledLogCost(int numIterations)
+    // Return the average time, in nanoseconds, of executing a disabled
+    // 'BALL_LOG_DEBUG' statement the specified 'numIterations' times.
+{
+    BALL_LOG_SET_CATEGORY("PERFORMANCE.DISABLED");
+
+    BloombergLP::bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numIterations; ++i) {
+        BALL_LOG_DEBUG << "disabled " << i;
+    }
+
+    timer.stop();
+
+    return timer.elapsedTime() * 1e9 / numIterations;
+}
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -12026,6 +12048,82 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DISABLED LOG COST
+        //
+        // Concerns:
+        //: 1 The cost of a logging statement whose severity is disabled is
+        //:   small, including when rules that do not apply to the calling
+        //:   thread are attached to the category.
+        //
+        // Plan:
+        //: 1 Measure the average time of a disabled 'BALL_LOG_DEBUG'
+        //:   statement (1) with no rules, (2) with 31 rules at 'e_TRACE'
+        //:   attached to the category, none of which is active for the
+        //:   calling thread, and (3) with the same rules and one active rule
+        //:   at 'e_INFO' (for a total of 32, the maximum number of rules).
+        //:   The number of iterations can be specified as the second
+        //:   argument.
+        // --------------------------------------------------------------------
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+        using namespace BloombergLP;
+
+        bsl::cout << "\nPERFORMANCE: DISABLED LOG COST"
+                  << "\n==============================" << bsl::endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(ball::Severity::e_ERROR,
+                                             ball::Severity::e_OFF,
+                                             ball::Severity::e_OFF,
+                                             ball::Severity::e_OFF);
+
+        ball::LoggerManagerScopedGuard lmg(lmc);
+        ball::LoggerManager&           manager =
+                                              ball::LoggerManager::singleton();
+
+        bsl::cout << "\tNo rules:               "
+                  << disabledLogCost(NUM_ITERATIONS) << " ns" << bsl::endl;
+
+        enum { k_NUM_INACTIVE_RULES = 31 };
+
+        for (int i = 0; i < k_NUM_INACTIVE_RULES; ++i) {
+            ball::Rule rule("PERFORMANCE.*",
+                            ball::Severity::e_TRACE,
+                            ball::Severity::e_OFF,
+                            ball::Severity::e_OFF,
+                            ball::Severity::e_OFF);
+            rule.addPredicate(ball::Predicate("uuid", i));
+            ASSERT(1 == manager.addRule(rule));
+        }
+
+        {
+            ball::ScopedAttribute attribute("uuid", k_NUM_INACTIVE_RULES);
+
+            bsl::cout << "\t31 inactive rules:      "
+                      << disabledLogCost(NUM_ITERATIONS) << " ns"
+                      << bsl::endl;
+        }
+
+        ball::Rule rule("PERFORMANCE.*",
+                        ball::Severity::e_INFO,
+                        ball::Severity::e_OFF,
+                        ball::Severity::e_OFF,
+                        ball::Severity::e_OFF);
+        rule.addPredicate(ball::Predicate("uuid", k_NUM_INACTIVE_RULES));
+        ASSERT(1 == manager.addRule(rule));
+
+        {
+            ball::ScopedAttribute attribute("uuid", k_NUM_INACTIVE_RULES);
+
+            bsl::cout << "\t31 inactive, 1 active: "
+                      << disabledLogCost(NUM_ITERATIONS) << " ns"
+                      << bsl::endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
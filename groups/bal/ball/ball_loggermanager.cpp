@@ -1425,10 +1425,12 @@ bool LoggerManager::isCategoryEnabled(const Category *category,
                                       int             severity) const
 {
     if (category->relevantRuleMask()) {
-        AttributeContext *context = AttributeContext::getContext();
-        ThresholdAggregate levels;
-        context->determineThresholdLevels(&levels, category);
-        int threshold = ThresholdAggregate::maxLevel(levels);
+        // The rule-adjusted threshold is cached by the thread's attribute
+        // context, so a disabled log statement in a category having relevant
+        // rules does not re-evaluate those rules.
+
+        const int threshold =
+                  AttributeContext::getContext()->determineThreshold(category);
         return threshold >= severity;                                 // RETURN
     }
     return category->maxLevel() >= severity;
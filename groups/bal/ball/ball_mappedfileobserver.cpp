@@ -0,0 +1,291 @@
+// ball_mappedfileobserver.cpp                                        -*-C++-*-
+#include <ball_mappedfileobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedfileobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_mappedfilereader.h>        // for testing only
+#include <ball_mappedfileutil.h>
+#include <ball_record.h>
+#include <ball_severity.h>                // for testing only
+
+#include <bdls_memoryutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+///Implementation Notes
+///--------------------
+// The ring is managed by the 'head' offset at which the next frame is written,
+// and the number of bytes 'used' by the frames preceding the head (see
+// 'ball_mappedfileutil').  The "tail" (the offset of the oldest frame) is
+// 'head - used', modulo the capacity of the ring.
+//
+// To write a frame of 'length' bytes, 'reserve' first ensures that 'length'
+// contiguous free bytes follow the head: if the bytes between the head and
+// the end of the ring are in use by older frames, the oldest frames are
+// evicted from the tail; if there are too few bytes between the head and the
+// end of the ring, those bytes are covered by a wrap marker, and the head
+// moves to the beginning of the ring.  The resulting state (which no longer
+// covers the bytes about to be written) is stored in the header *before* the
+// frame is written, and the state covering the new frame is stored after it
+// is written.  Hence the state stored in the header never covers a partially
+// written frame.
+
+namespace BloombergLP {
+namespace ball {
+
+                          // ------------------------
+                          // class MappedFileObserver
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void MappedFileObserver::closeLogFile()
+{
+    BSLS_ASSERT(d_mapping_p);
+
+    bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+    bdls::FilesystemUtil::close(d_descriptor);
+
+    d_descriptor  = bdls::FilesystemUtil::k_INVALID_FD;
+    d_mapping_p   = 0;
+    d_mappingSize = 0;
+    d_capacity    = 0;
+    d_head        = 0;
+    d_used        = 0;
+    d_fileName.clear();
+}
+
+int MappedFileObserver::reserve(int length)
+{
+    BSLS_ASSERT(d_mapping_p);
+    BSLS_ASSERT(0 < length);
+    BSLS_ASSERT(length <= d_capacity);
+    BSLS_ASSERT(0 == length % MappedFileUtil::k_FRAME_ALIGNMENT);
+
+    char *ring = d_mapping_p + MappedFileUtil::k_HEADER_SIZE;
+
+    while (0 != d_used) {
+        int tail = d_head - d_used;
+        if (tail < 0) {
+            tail += d_capacity;
+        }
+
+        if (tail < d_head) {
+            // The frames occupy '[tail .. head)', so the free bytes following
+            // the head extend to the end of the ring.
+
+            if (d_capacity - d_head >= length) {
+                return d_head;                                        // RETURN
+            }
+
+            MappedFileUtil::encodeWrapMarker(ring + d_head,
+                                             d_capacity - d_head);
+            d_used += d_capacity - d_head;
+            d_head  = 0;
+        }
+        else {
+            // The frames wrap around the end of the ring (or fill it), so the
+            // free bytes following the head extend to the tail.
+
+            if (tail - d_head >= length) {
+                return d_head;                                        // RETURN
+            }
+
+            bool      isWrapMarker;
+            const int frameLength = MappedFileUtil::decodeFrameLength(
+                                                         &isWrapMarker,
+                                                         ring + tail,
+                                                         d_capacity - tail);
+            BSLS_ASSERT(0 < frameLength);
+
+            d_used -= frameLength;
+        }
+    }
+
+    // The ring is empty: restart at its beginning.
+
+    d_head = 0;
+    return 0;
+}
+
+// CREATORS
+MappedFileObserver::MappedFileObserver(bslma::Allocator *basicAllocator)
+: d_descriptor(bdls::FilesystemUtil::k_INVALID_FD)
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_capacity(0)
+, d_head(0)
+, d_used(0)
+, d_sequenceNumber(0)
+, d_fileName(bslma::Default::allocator(basicAllocator))
+{
+}
+
+MappedFileObserver::~MappedFileObserver()
+{
+    if (d_mapping_p) {
+        closeLogFile();
+    }
+}
+
+// MANIPULATORS
+void MappedFileObserver::disableFileLogging()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_mapping_p) {
+        closeLogFile();
+    }
+}
+
+int MappedFileObserver::enableFileLogging(const char *fileName, int capacity)
+{
+    BSLS_ASSERT(fileName);
+    BSLS_ASSERT(MappedFileUtil::k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT(capacity <= MappedFileUtil::k_MAX_CAPACITY);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_mapping_p) {
+        return 1;                                                     // RETURN
+    }
+
+    const int ringCapacity = (capacity + MappedFileUtil::k_FRAME_ALIGNMENT - 1)
+                                  & ~(MappedFileUtil::k_FRAME_ALIGNMENT - 1);
+
+    const bsl::size_t size = MappedFileUtil::k_HEADER_SIZE
+                           + static_cast<bsl::size_t>(ringCapacity);
+
+    FileUtil::FileDescriptor descriptor =
+                                    FileUtil::open(fileName,
+                                                   FileUtil::e_OPEN_OR_CREATE,
+                                                   FileUtil::e_READ_WRITE,
+                                                   FileUtil::e_TRUNCATE);
+    if (FileUtil::k_INVALID_FD == descriptor) {
+        return -1;                                                    // RETURN
+    }
+
+    // Preallocate the file, so that writing to the mapping cannot fail for
+    // lack of disk space.
+
+    void *address;
+    if (0 != FileUtil::growFile(descriptor, size, true)
+     || 0 != FileUtil::map(descriptor,
+                           &address,
+                           0,
+                           size,
+                           bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FileUtil::close(descriptor);
+        return -2;                                                    // RETURN
+    }
+
+    d_descriptor     = descriptor;
+    d_mapping_p      = static_cast<char *>(address);
+    d_mappingSize    = size;
+    d_capacity       = ringCapacity;
+    d_head           = 0;
+    d_used           = 0;
+    d_sequenceNumber = 0;
+    d_fileName.assign(fileName);
+
+    MappedFileUtil::initializeHeader(d_mapping_p, ringCapacity);
+
+    return 0;
+}
+
+void MappedFileObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&)
+{
+    BSLS_ASSERT(record);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    const int length = MappedFileUtil::encodedLength(*record, d_capacity);
+    const int offset = reserve(length);
+
+    MappedFileUtil::storeState(d_mapping_p, d_head, d_used);
+
+    MappedFileUtil::encodeRecord(d_mapping_p + MappedFileUtil::k_HEADER_SIZE
+                                                                     + offset,
+                                 *record,
+                                 d_sequenceNumber,
+                                 d_capacity);
+    ++d_sequenceNumber;
+
+    d_head += length;
+    if (d_capacity == d_head) {
+        d_head = 0;
+    }
+    d_used += length;
+
+    MappedFileUtil::storeState(d_mapping_p, d_head, d_used);
+}
+
+void MappedFileObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+int MappedFileObserver::capacity() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_capacity;
+}
+
+bool MappedFileObserver::isFileLoggingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_mapping_p;
+}
+
+bool MappedFileObserver::isFileLoggingEnabled(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_mapping_p) {
+        *result = d_fileName;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
+bsls::Types::Uint64 MappedFileObserver::numPublishedRecords() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_sequenceNumber;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,245 @@
+// ball_mappedfileobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDFILEOBSERVER
+#define INCLUDED_BALL_MAPPEDFILEOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that logs to a memory-mapped circular file.
+//
+//@CLASSES:
+//  ball::MappedFileObserver: observer writing binary records to a mapped file
+//
+//@SEE_ALSO: ball_mappedfileutil, ball_mappedfilereader, ball_fileobserver2
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::MappedFileObserver', that writes each
+// published log record, in a compact binary encoding, into a file of fixed
+// size that is mapped into memory.  The file holds a circular buffer (a
+// "ring") of records: when the ring is full, the oldest records are
+// overwritten by new ones.  The file therefore always holds the most recent
+// records published to the observer, in the manner of a "flight recorder".
+// The file can be decoded offline using 'ball::MappedFileReader' (or the
+// 'm_ballmappedfiledecoder' application).  See 'ball_mappedfileutil' for a
+// description of the file format.
+//
+// Publishing a record formats nothing and performs no system call: the fixed
+// fields of the record are copied into the mapped memory, and the state of
+// the ring (stored in the header of the file) is updated with a single atomic
+// store.  Since the pages of the file are shared with the operating system,
+// every record published before an abnormal termination of the process
+// (e.g., a crash) remains in the file, and the file always describes a
+// consistent ring.  Note, however, that records are not guaranteed to reach
+// the disk if the operating system itself fails.
+//
+// User fields and attributes of published records are not written to the
+// file, and the messages of records that do not fit in the ring are
+// truncated (see {'ball_mappedfileutil'|File Layout}).
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::MappedFileObserver' are thread-safe, and can be
+// called concurrently by multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording Log Records in a Mapped File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to keep the most recent log records of a service in a
+// file that can be inspected after the service terminates unexpectedly.
+//
+// First, we create a mapped file observer and enable logging to a file having
+// a ring of 1 MB:
+//..
+//  ball::MappedFileObserver observer;
+//
+//  int rc = observer.enableFileLogging(fileName, 1024 * 1024);
+//  assert(0 == rc);
+//  assert(observer.isFileLoggingEnabled());
+//..
+// Then, we publish a record to the observer (typically, the observer would be
+// registered with the logger manager, which would publish records to it):
+//..
+//  bsl::shared_ptr<ball::Record> record(new ball::Record());
+//
+//  record->fixedFields().setCategory("EXAMPLE");
+//  record->fixedFields().setSeverity(ball::Severity::e_WARN);
+//  record->fixedFields().setMessage("disk space is low");
+//
+//  observer.publish(record, ball::Context());
+//
+//  assert(1 == observer.numPublishedRecords());
+//..
+// Finally, we disable file logging.  The file remains in place, and can be
+// decoded by 'ball::MappedFileReader':
+//..
+//  observer.disableFileLogging();
+//  assert(!observer.isFileLoggingEnabled());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                          // ========================
+                          // class MappedFileObserver
+                          // ========================
+
+class MappedFileObserver : public Observer {
+    // This class provides a concrete implementation of the 'Observer'
+    // protocol that writes published records into a circular buffer held in
+    // a memory-mapped file.
+
+    // DATA
+    bdls::FilesystemUtil::FileDescriptor
+                        d_descriptor;      // descriptor of the log file
+
+    char               *d_mapping_p;       // mapped log file (header and
+                                           // ring), or 0 if file logging is
+                                           // disabled
+
+    bsl::size_t         d_mappingSize;     // size of the mapping
+
+    int                 d_capacity;        // capacity of the ring
+
+    int                 d_head;            // offset of the next frame
+
+    int                 d_used;            // number of bytes of the ring in
+                                           // use
+
+    bsls::Types::Uint64 d_sequenceNumber;  // sequence number of the next
+                                           // record
+
+    bsl::string         d_fileName;        // name of the log file
+
+    mutable bslmt::Mutex
+                        d_mutex;           // serializes access to this object
+
+    // NOT IMPLEMENTED
+    MappedFileObserver(const MappedFileObserver&);
+    MappedFileObserver& operator=(const MappedFileObserver&);
+
+    // PRIVATE MANIPULATORS
+    void closeLogFile();
+        // Unmap and close the log file.  The behavior is undefined unless file
+        // logging is enabled, and 'd_mutex' is locked.
+
+    int reserve(int length);
+        // Make the specified 'length' contiguous bytes of the ring available
+        // for a new frame, overwriting the oldest frames if necessary, and
+        // return the offset of those bytes within the ring.  The behavior is
+        // undefined unless file logging is enabled, 'length' is a multiple of
+        // 'MappedFileUtil::k_FRAME_ALIGNMENT' in the range '[0 .. capacity]',
+        // and 'd_mutex' is locked.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MappedFileObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit MappedFileObserver(bslma::Allocator *basicAllocator = 0);
+        // Create a mapped file observer with file logging initially disabled.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    virtual ~MappedFileObserver();
+        // Unmap and close the log file of this observer if file logging is
+        // enabled, and destroy this observer.
+
+    // MANIPULATORS
+    void disableFileLogging();
+        // Disable file logging for this observer, unmapping and closing the
+        // log file.  This method has no effect if file logging is not
+        // enabled.  Note that records subsequently received through the
+        // 'publish' method will be dropped until file logging is reenabled.
+
+    int enableFileLogging(const char *fileName, int capacity);
+        // Enable logging of all records published to this observer to the
+        // file having the specified 'fileName', holding a ring of (at least)
+        // the specified 'capacity' bytes, rounded up to a multiple of
+        // 'MappedFileUtil::k_FRAME_ALIGNMENT'.  The file is created if it
+        // does not exist, and its previous contents, if any, are discarded.
+        // Return 0 on success, a positive value if file logging is already
+        // enabled (with no effect), and a negative value otherwise.  The
+        // behavior is undefined unless
+        // 'MappedFileUtil::k_MIN_CAPACITY <= capacity' and
+        // 'capacity <= MappedFileUtil::k_MAX_CAPACITY'.
+
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by writing the fixed fields of 'record' into the ring of
+        // the log file, if file logging is enabled.  The message of 'record'
+        // is truncated if its encoding does not fit in the ring.
+
+    virtual void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer.  Note that
+        // this observer does not hold any shared references, so this method
+        // has no effect.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the capacity of the ring of the log file if file logging is
+        // enabled, and 0 otherwise.
+
+    bool isFileLoggingEnabled() const;
+    bool isFileLoggingEnabled(bsl::string *result) const;
+        // Return 'true' if file logging is enabled for this observer, and
+        // 'false' otherwise.  Load the optionally specified 'result' with the
+        // name of the current log file if file logging is enabled, and leave
+        // 'result' unmodified otherwise.
+
+    bsls::Types::Uint64 numPublishedRecords() const;
+        // Return the number of records written to the log file since file
+        // logging was most recently enabled.  Note that the sequence numbers
+        // of the records in the file are '[0 .. numPublishedRecords() - 1]'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,825 @@
+// ball_mappedfileobserver.t.cpp                                      -*-C++-*-
+#include <ball_mappedfileobserver.h>
+
+#include <ball_context.h>
+#include <ball_mappedfilereader.h>
+#include <ball_mappedfileutil.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines an observer ('ball::MappedFileObserver')
+// that writes log records into a circular buffer held in a memory-mapped
+// file.  The contents of the file are verified using 'ball::MappedFileReader'
+// while the observer still has the file mapped, which also verifies that the
+// file is consistent after every published record.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] MappedFileObserver(bslma::Allocator *);
+// [ 1] ~MappedFileObserver();
+//
+// MANIPULATORS
+// [ 2] void disableFileLogging();
+// [ 2] int enableFileLogging(const char *fileName, int capacity);
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 1] void releaseRecords();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isFileLoggingEnabled() const;
+// [ 2] bool isFileLoggingEnabled(bsl::string *result) const;
+// [ 3] bsls::Types::Uint64 numPublishedRecords() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CONCURRENT PUBLICATION
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::MappedFileObserver Obj;
+typedef ball::MappedFileUtil     Util;
+typedef bsls::Types::Uint64      Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+bsl::shared_ptr<ball::Record> makeRecord(const bsl::string&  message,
+                                         bslma::Allocator   *allocator)
+    // Return a record having the specified 'message', and fixed file and
+    // category names.  Use the specified 'allocator' to supply memory.
+{
+    bsl::shared_ptr<ball::Record> record =
+                           bsl::allocate_shared<ball::Record>(allocator);
+
+    record->fixedFields().setFileName("f");
+    record->fixedFields().setCategory("c");
+    record->fixedFields().setSeverity(ball::Severity::e_INFO);
+    record->fixedFields().clearMessage();
+    record->fixedFields().messageStreamBuf().sputn(message.data(),
+                                                   message.length());
+    return record;
+}
+
+int readFile(bsl::vector<Uint64>      *sequenceNumbers,
+             bsl::vector<bsl::string> *messages,
+             const bsl::string&        fileName)
+    // Load into the specified 'sequenceNumbers' and 'messages' the sequence
+    // numbers and messages of the records of the mapped log file having the
+    // specified 'fileName'.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    sequenceNumbers->clear();
+    messages->clear();
+
+    ball::MappedFileReader reader;
+    if (0 != reader.open(fileName.c_str())) {
+        return -1;                                                    // RETURN
+    }
+
+    ball::Record record(messages->get_allocator().mechanism());
+
+    int rc;
+    while (0 == (rc = reader.readRecord(&record))) {
+        sequenceNumbers->push_back(reader.sequenceNumber());
+        messages->push_back(record.fixedFields().messageRef());
+    }
+
+    return 1 == rc ? 0 : -2;
+}
+
+                       // ============================
+                       // case 4: concurrent publishing
+                       // ============================
+
+struct ThreadArgs {
+    // This 'struct' holds the arguments of 'publishRecords'.
+
+    Obj              *d_observer_p;   // observer to publish to
+    int               d_threadIndex;  // index of the thread
+    int               d_numRecords;   // number of records to publish
+    bslma::Allocator *d_allocator_p;  // allocator for the records
+};
+
+extern "C" void *publishRecords(void *arg)
+    // Publish 'd_numRecords' records, having messages identifying the thread
+    // and the record, to the observer described by the specified 'arg',
+    // which refers to a 'ThreadArgs' object.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        bsl::ostringstream message(args->d_allocator_p);
+        message << args->d_threadIndex << ':' << i << ':'
+                << bsl::string(i % 200, 'x');
+
+        args->d_observer_p->publish(makeRecord(message.str(),
+                                               args->d_allocator_p),
+                                    ball::Context());
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        // This is standard preamble to create the directory and filename for
+        // the test.
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string name(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&name, "usage.log");
+
+        const char *fileName = name.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording Log Records in a Mapped File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to keep the most recent log records of a service in a
+// file that can be inspected after the service terminates unexpectedly.
+//
+// First, we create a mapped file observer and enable logging to a file having
+// a ring of 1 MB:
+//..
+    ball::MappedFileObserver observer;
+
+    int rc = observer.enableFileLogging(fileName, 1024 * 1024);
+    ASSERT(0 == rc);
+    ASSERT(observer.isFileLoggingEnabled());
+//..
+// Then, we publish a record to the observer (typically, the observer would be
+// registered with the logger manager, which would publish records to it):
+//..
+    bsl::shared_ptr<ball::Record> record(new ball::Record());
+
+    record->fixedFields().setCategory("EXAMPLE");
+    record->fixedFields().setSeverity(ball::Severity::e_WARN);
+    record->fixedFields().setMessage("disk space is low");
+
+    observer.publish(record, ball::Context());
+
+    ASSERT(1 == observer.numPublishedRecords());
+//..
+// Finally, we disable file logging.  The file remains in place, and can be
+// decoded by 'ball::MappedFileReader':
+//..
+    observer.disableFileLogging();
+    ASSERT(!observer.isFileLoggingEnabled());
+//..
+
+        bsl::vector<Uint64>      sequenceNumbers;
+        bsl::vector<bsl::string> messages;
+
+        ASSERT(0 == readFile(&sequenceNumbers, &messages, name));
+        ASSERT(1 == messages.size());
+        ASSERT(1 == messages.size() && "disk space is low" == messages[0]);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by multiple threads are written
+        //:   to the file without corruption.
+        //:
+        //: 2 The sequence numbers of the records in the file are consecutive
+        //:   and end with the number of published records minus one.
+        //
+        // Plan:
+        //: 1 Publish records from several threads to an observer having a
+        //:   small ring, so that the ring wraps many times, and verify the
+        //:   records read from the file.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT PUBLICATION"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 2000 };
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "concurrent.log");
+
+        bslma::TestAllocator threadAllocator("thread", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str(), 16 * 1024));
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        ThreadArgs                args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_observer_p  = &mX;
+            args[i].d_threadIndex = i;
+            args[i].d_numRecords  = k_NUM_RECORDS;
+            args[i].d_allocator_p = &threadAllocator;
+
+            ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      publishRecords,
+                                                      &args[i]));
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        const Uint64 TOTAL = k_NUM_THREADS * k_NUM_RECORDS;
+
+        ASSERTV(X.numPublishedRecords(), TOTAL == X.numPublishedRecords());
+
+        bsl::vector<Uint64>      sequenceNumbers(&ta);
+        bsl::vector<bsl::string> messages(&ta);
+
+        ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+        ASSERT(!sequenceNumbers.empty());
+
+        if (veryVerbose) { T_ P(sequenceNumbers.size()) }
+
+        for (bsl::size_t i = 0; i < sequenceNumbers.size(); ++i) {
+            ASSERTV(i, TOTAL - sequenceNumbers.size() + i ==
+                                                         sequenceNumbers[i]);
+
+            // Each message has the form "<thread>:<index>:x...x".
+
+            bsl::istringstream in(messages[i]);
+            int  thread = -1;
+            int  index  = -1;
+            char colon1 = 0;
+            char colon2 = 0;
+            in >> thread >> colon1 >> index >> colon2;
+
+            ASSERTV(i, messages[i], 0 <= thread && thread < k_NUM_THREADS);
+            ASSERTV(i, messages[i], 0 <= index && index < k_NUM_RECORDS);
+            ASSERTV(i, messages[i], ':' == colon1 && ':' == colon2);
+
+            bsl::string rest;
+            bsl::getline(in, rest);
+            ASSERTV(i, messages[i], bsl::string(index % 200, 'x') == rest);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'publish'
+        //
+        // Concerns:
+        //: 1 After each call to 'publish', the file holds the published
+        //:   record preceded by the most recent previously published records,
+        //:   with consecutive sequence numbers.
+        //:
+        //: 2 When the ring is full, the oldest records are evicted: a ring
+        //:   holding records of equal length holds as many records as fit in
+        //:   the ring (less any wrap marker).
+        //:
+        //: 3 A record whose message does not fit in the ring is written with
+        //:   a truncated message, and is then the only record in the file.
+        //:
+        //: 4 Records published while file logging is disabled are dropped.
+        //:
+        //: 5 'numPublishedRecords' returns the number of records written.
+        //
+        // Plan:
+        //: 1 Publish records having a variety of message lengths to an
+        //:   observer having a ring of the minimum capacity, and verify the
+        //:   file after each call.  (C-1, 5)
+        //:
+        //: 2 Publish many records having frames of 128 and 120 bytes, and
+        //:   verify the number of records in the file.  (C-2)
+        //:
+        //: 3 Publish a record having a message longer than the ring, and
+        //:   verify the file.  (C-3)
+        //:
+        //: 4 Publish a record while file logging is disabled.  (C-4)
+        //
+        // Testing:
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   bsls::Types::Uint64 numPublishedRecords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publish'"
+                          << "\n=================" << endl;
+
+        const int CAPACITY = Util::k_MIN_CAPACITY;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "publish.log");
+
+        bsl::vector<Uint64>      sequenceNumbers(&ta);
+        bsl::vector<bsl::string> messages(&ta);
+
+        if (verbose) cout << "\nVarying message lengths." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.publish(makeRecord("dropped", &ta), ball::Context());
+            ASSERT(0 == X.numPublishedRecords());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str(), CAPACITY));
+
+            bsl::vector<bsl::string> published(&ta);
+
+            for (int i = 0; i < 200; ++i) {
+                // Message lengths between 0 and 600, in a pseudo-random
+                // order.
+
+                const int LENGTH = (i * 337) % 601;
+
+                bsl::string message(LENGTH,
+                                    static_cast<char>('a' + i % 26),
+                                    &ta);
+                published.push_back(message);
+
+                mX.publish(makeRecord(message, &ta), ball::Context());
+                ASSERTV(i, static_cast<Uint64>(i + 1) ==
+                                                      X.numPublishedRecords());
+
+                ASSERTV(i, 0 == readFile(&sequenceNumbers,
+                                         &messages,
+                                         fileName));
+
+                const int NUM = static_cast<int>(sequenceNumbers.size());
+                ASSERTV(i, NUM, 1 <= NUM && NUM <= i + 1);
+
+                int totalLength = 0;
+                for (int j = 0; j < NUM; ++j) {
+                    const int K = i + 1 - NUM + j;
+
+                    ASSERTV(i, j, static_cast<Uint64>(K) ==
+                                                       sequenceNumbers[j]);
+                    ASSERTV(i, j, published[K] == messages[j]);
+
+                    totalLength += Util::encodedLength(
+                                           *makeRecord(published[K], &ta),
+                                           CAPACITY);
+                }
+                ASSERTV(i, totalLength, totalLength <= CAPACITY);
+            }
+        }
+
+        if (verbose) cout << "\nRecords of equal length." << endl;
+        {
+            // With one-character file and category names, the fixed part of
+            // a frame (including the three null characters) is 61 bytes.
+
+            const int LENGTHS[]  = { 128, 120 };
+            const int EXPECTED[] = {   8,   8 };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                Obj mX(&ta);
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str(), CAPACITY));
+
+                const bsl::string message(LENGTH - 61, 'm', &ta);
+
+                for (int i = 0; i < 50; ++i) {
+                    mX.publish(makeRecord(message, &ta), ball::Context());
+
+                    ASSERTV(LENGTH, i, 0 == readFile(&sequenceNumbers,
+                                                     &messages,
+                                                     fileName));
+
+                    const int NUM = static_cast<int>(sequenceNumbers.size());
+                    const int EXP = bsl::min(i + 1, EXPECTED[ti]);
+
+                    ASSERTV(LENGTH, i, NUM, EXP, EXP == NUM);
+                    ASSERTV(LENGTH, i, static_cast<Uint64>(i) ==
+                                                      sequenceNumbers.back());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nMessage longer than the ring." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str(), CAPACITY));
+
+            mX.publish(makeRecord("first", &ta), ball::Context());
+
+            const bsl::string message(5000, 'L', &ta);
+            mX.publish(makeRecord(message, &ta), ball::Context());
+
+            ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+            ASSERT(1 == sequenceNumbers.size());
+            ASSERT(1 == sequenceNumbers.back());
+            ASSERTV(messages.back().length(),
+                    message.substr(0, CAPACITY - 61) == messages.back());
+
+            mX.publish(makeRecord("last", &ta), ball::Context());
+
+            ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+            ASSERT(1 == sequenceNumbers.size());
+            ASSERT(2 == sequenceNumbers.back());
+            ASSERT("last" == messages.back());
+        }
+
+        if (verbose) cout << "\nDisabled file logging." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str(), CAPACITY));
+
+            mX.publish(makeRecord("kept", &ta), ball::Context());
+            mX.disableFileLogging();
+
+            mX.publish(makeRecord("dropped", &ta), ball::Context());
+            ASSERT(1 == X.numPublishedRecords());
+
+            ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+            ASSERT(1 == messages.size());
+            ASSERT("kept" == messages.back());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'enableFileLogging' AND 'disableFileLogging'
+        //
+        // Concerns:
+        //: 1 'enableFileLogging' creates a file holding a header and a ring
+        //:   of the specified capacity, rounded up to a multiple of the frame
+        //:   alignment.
+        //:
+        //: 2 'enableFileLogging' discards the previous contents of the file,
+        //:   and resets the number of published records.
+        //:
+        //: 3 'enableFileLogging' returns a positive value, with no effect, if
+        //:   file logging is already enabled, and a negative value if the
+        //:   file cannot be created.
+        //:
+        //: 4 'disableFileLogging' has no effect if file logging is disabled.
+        //:
+        //: 5 The accessors reflect the state of the observer.
+        //
+        // Plan:
+        //: 1 Enable and disable file logging with a variety of capacities and
+        //:   file names, and verify the accessors and the file.  (C-1..5)
+        //
+        // Testing:
+        //   void disableFileLogging();
+        //   int enableFileLogging(const char *fileName, int capacity);
+        //   int capacity() const;
+        //   bool isFileLoggingEnabled() const;
+        //   bool isFileLoggingEnabled(bsl::string *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                << "\nTESTING 'enableFileLogging' AND 'disableFileLogging'"
+                << "\n====================================================="
+                << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "enable.log");
+
+        bsl::string badName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&badName, "missing");
+        bdls::PathUtil::appendRaw(&badName, "enable.log");
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        bsl::string name("unchanged", &ta);
+
+        ASSERT(!X.isFileLoggingEnabled());
+        ASSERT(!X.isFileLoggingEnabled(&name));
+        ASSERT("unchanged" == name);
+        ASSERT(0 == X.capacity());
+
+        mX.disableFileLogging();
+        ASSERT(!X.isFileLoggingEnabled());
+
+        ASSERT(0 > mX.enableFileLogging(badName.c_str(),
+                                        Util::k_MIN_CAPACITY));
+        ASSERT(!X.isFileLoggingEnabled());
+
+        const int CAPACITIES[] = { Util::k_MIN_CAPACITY,
+                                   Util::k_MIN_CAPACITY + 1,
+                                   Util::k_MIN_CAPACITY + 7,
+                                   Util::k_MIN_CAPACITY + 8,
+                                   100000 };
+        const int NUM_CAPACITIES = static_cast<int>(sizeof CAPACITIES
+                                                    / sizeof *CAPACITIES);
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti];
+            const int EXPECTED = (CAPACITY + 7) / 8 * 8;
+
+            if (veryVerbose) { T_ P_(CAPACITY) P(EXPECTED) }
+
+            ASSERTV(CAPACITY, 0 == mX.enableFileLogging(fileName.c_str(),
+                                                        CAPACITY));
+            ASSERTV(CAPACITY, X.isFileLoggingEnabled());
+            ASSERTV(CAPACITY, X.isFileLoggingEnabled(&name));
+            ASSERTV(CAPACITY, fileName == name);
+            ASSERTV(CAPACITY, EXPECTED == X.capacity());
+            ASSERTV(CAPACITY, 0 == X.numPublishedRecords());
+
+            ASSERTV(CAPACITY, Util::k_HEADER_SIZE + EXPECTED ==
+                              bdls::FilesystemUtil::getFileSize(fileName));
+
+            ASSERTV(CAPACITY, 0 < mX.enableFileLogging(fileName.c_str(),
+                                                       2 * CAPACITY));
+            ASSERTV(CAPACITY, EXPECTED == X.capacity());
+
+            mX.publish(makeRecord("record", &ta), ball::Context());
+            ASSERTV(CAPACITY, 1 == X.numPublishedRecords());
+
+            ball::MappedFileReader reader;
+            ASSERTV(CAPACITY, 0 == reader.open(fileName.c_str()));
+            ASSERTV(CAPACITY, EXPECTED == reader.capacity());
+
+            mX.disableFileLogging();
+            ASSERTV(CAPACITY, !X.isFileLoggingEnabled());
+            ASSERTV(CAPACITY, 0 == X.capacity());
+
+            // The reader still has the file mapped.
+
+            ball::Record record(&ta);
+            ASSERTV(CAPACITY, 0 == reader.readRecord(&record));
+            ASSERTV(CAPACITY, 1 == reader.readRecord(&record));
+        }
+
+        // Reenabling file logging discards the previous contents.
+
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str(),
+                                         Util::k_MIN_CAPACITY));
+
+        bsl::vector<Uint64>      sequenceNumbers(&ta);
+        bsl::vector<bsl::string> messages(&ta);
+
+        ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+        ASSERT(sequenceNumbers.empty());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Publish a few records to an observer, and read them back from
+        //:   the file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "breathing.log");
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str(), 4096));
+            ASSERT(X.isFileLoggingEnabled());
+
+            mX.publish(makeRecord("one", &ta), ball::Context());
+            mX.publish(makeRecord("two", &ta), ball::Context());
+            mX.releaseRecords();
+
+            ASSERT(2 == X.numPublishedRecords());
+
+            // The observer is destroyed with file logging enabled.
+        }
+
+        bsl::vector<Uint64>      sequenceNumbers(&ta);
+        bsl::vector<bsl::string> messages(&ta);
+
+        ASSERT(0 == readFile(&sequenceNumbers, &messages, fileName));
+        ASSERT(2     == messages.size());
+        ASSERT(0     == sequenceNumbers[0]);
+        ASSERT(1     == sequenceNumbers[1]);
+        ASSERT("one" == messages[0]);
+        ASSERT("two" == messages[1]);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
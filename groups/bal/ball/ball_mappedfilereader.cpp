@@ -0,0 +1,197 @@
+// ball_mappedfilereader.cpp                                          -*-C++-*-
+#include <ball_mappedfilereader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedfilereader_cpp,"$Id$ $CSID$")
+
+#include <ball_mappedfileutil.h>
+#include <ball_record.h>
+#include <ball_severity.h>                // for testing only
+
+#include <bdls_memoryutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                           // ----------------------
+                           // class MappedFileReader
+                           // ----------------------
+
+// CREATORS
+MappedFileReader::MappedFileReader()
+: d_descriptor(bdls::FilesystemUtil::k_INVALID_FD)
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_capacity(0)
+, d_offset(0)
+, d_remaining(0)
+, d_sequenceNumber(0)
+{
+}
+
+MappedFileReader::~MappedFileReader()
+{
+    close();
+}
+
+// MANIPULATORS
+void MappedFileReader::close()
+{
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    bdls::FilesystemUtil::unmap(const_cast<char *>(d_mapping_p),
+                                d_mappingSize);
+    bdls::FilesystemUtil::close(d_descriptor);
+
+    d_descriptor     = bdls::FilesystemUtil::k_INVALID_FD;
+    d_mapping_p      = 0;
+    d_mappingSize    = 0;
+    d_capacity       = 0;
+    d_offset         = 0;
+    d_remaining      = 0;
+    d_sequenceNumber = 0;
+}
+
+int MappedFileReader::open(const char *fileName)
+{
+    BSLS_ASSERT(fileName);
+
+    typedef bdls::FilesystemUtil FileUtil;
+
+    if (d_mapping_p) {
+        return 1;                                                     // RETURN
+    }
+
+    const FileUtil::Offset fileSize = FileUtil::getFileSize(fileName);
+    if (fileSize < MappedFileUtil::k_HEADER_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    FileUtil::FileDescriptor descriptor =
+                                         FileUtil::open(fileName,
+                                                        FileUtil::e_OPEN,
+                                                        FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == descriptor) {
+        return -2;                                                    // RETURN
+    }
+
+    // Map the header first, to determine the size of the ring.
+
+    void *address;
+    if (0 != FileUtil::map(descriptor,
+                           &address,
+                           0,
+                           MappedFileUtil::k_HEADER_SIZE,
+                           bdls::MemoryUtil::k_ACCESS_READ)) {
+        FileUtil::close(descriptor);
+        return -3;                                                    // RETURN
+    }
+
+    int capacity;
+    const int rc = MappedFileUtil::validateHeader(
+                                               &capacity,
+                                               static_cast<char *>(address),
+                                               fileSize);
+    FileUtil::unmap(address, MappedFileUtil::k_HEADER_SIZE);
+
+    if (0 != rc) {
+        FileUtil::close(descriptor);
+        return -4;                                                    // RETURN
+    }
+
+    const bsl::size_t size = MappedFileUtil::k_HEADER_SIZE
+                           + static_cast<bsl::size_t>(capacity);
+
+    if (0 != FileUtil::map(descriptor,
+                           &address,
+                           0,
+                           size,
+                           bdls::MemoryUtil::k_ACCESS_READ)) {
+        FileUtil::close(descriptor);
+        return -5;                                                    // RETURN
+    }
+
+    d_descriptor  = descriptor;
+    d_mapping_p   = static_cast<const char *>(address);
+    d_mappingSize = size;
+    d_capacity    = capacity;
+
+    int head;
+    int used;
+    MappedFileUtil::loadState(&head, &used, d_mapping_p);
+
+    d_offset    = head >= used ? head - used : head - used + capacity;
+    d_remaining = used;
+
+    return 0;
+}
+
+int MappedFileReader::readRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(d_mapping_p);
+
+    const char *ring = d_mapping_p + MappedFileUtil::k_HEADER_SIZE;
+
+    while (0 < d_remaining) {
+        // A frame never extends past the end of the ring, nor past the bytes
+        // in use.
+
+        const int maxLength = bsl::min(d_remaining, d_capacity - d_offset);
+
+        bool      isWrapMarker;
+        const int length = MappedFileUtil::decodeFrameLength(&isWrapMarker,
+                                                             ring + d_offset,
+                                                             maxLength);
+        if (0 > length) {
+            d_remaining = 0;
+            return -1;                                                // RETURN
+        }
+
+        const char *frame = ring + d_offset;
+
+        d_offset += length;
+        if (d_capacity == d_offset) {
+            d_offset = 0;
+        }
+        d_remaining -= length;
+
+        if (!isWrapMarker) {
+            if (0 != MappedFileUtil::decodeRecord(record,
+                                                  &d_sequenceNumber,
+                                                  frame,
+                                                  length)) {
+                d_remaining = 0;
+                return -2;                                            // RETURN
+            }
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,205 @@
+// ball_mappedfilereader.h                                            -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDFILEREADER
+#define INCLUDED_BALL_MAPPEDFILEREADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to read the records of a mapped log file.
+//
+//@CLASSES:
+//  ball::MappedFileReader: reader of the records of a mapped log file
+//
+//@SEE_ALSO: ball_mappedfileobserver, ball_mappedfileutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'ball::MappedFileReader', that reads the log records held in a mapped log
+// file, such as one written by 'ball::MappedFileObserver' (see
+// 'ball_mappedfileutil' for a description of the file format).  Records are
+// read one at a time, from the oldest to the most recent, together with the
+// sequence number assigned to each record by the writer.  Since the oldest
+// records of a mapped log file are overwritten when its ring is full, the
+// sequence number of the first record read is not necessarily 0.
+//
+// A reader maps the file read-only, and reads the ring as described by the
+// state stored in the header of the file when the file was opened.  Records
+// written to the file after it was opened are not read.  A reader can
+// therefore be used to read the file of a process that has terminated, as
+// well as a snapshot of the file of a running process, provided that the
+// writer does not overwrite the records being read (i.e., that the writer
+// wraps around the ring more slowly than the reader reads it).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Printing the Records of a Mapped Log File
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a process has logged records to a mapped log file named
+// 'fileName' using a 'ball::MappedFileObserver', and that we want to print
+// the most recent of those records.
+//
+// First, we open the file:
+//..
+//  ball::MappedFileReader reader;
+//
+//  int rc = reader.open(fileName);
+//  assert(0 == rc);
+//  assert(reader.isOpen());
+//..
+// Then, we read the records of the file in order, and print each record
+// with its sequence number:
+//..
+//  ball::Record record;
+//
+//  while (0 == (rc = reader.readRecord(&record))) {
+//      bsl::cout << reader.sequenceNumber() << ": "
+//                << record.fixedFields().messageRef() << bsl::endl;
+//  }
+//..
+// Next, we verify that all the records of the file were read (a negative
+// value would indicate that the file is corrupt):
+//..
+//  assert(1 == rc);
+//..
+// Finally, we close the file:
+//..
+//  reader.close();
+//  assert(!reader.isOpen());
+//..
+
+#include <balscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                           // ======================
+                           // class MappedFileReader
+                           // ======================
+
+class MappedFileReader {
+    // This mechanism class reads, in order, the records held in the ring of a
+    // mapped log file.
+
+    // DATA
+    bdls::FilesystemUtil::FileDescriptor
+                        d_descriptor;      // descriptor of the open file
+
+    const char         *d_mapping_p;       // mapped file, or 0 if no file is
+                                           // open
+
+    bsl::size_t         d_mappingSize;     // size of the mapping
+
+    int                 d_capacity;        // capacity of the ring
+
+    int                 d_offset;          // offset of the next frame to read
+
+    int                 d_remaining;       // number of bytes of the ring
+                                           // still to be read
+
+    bsls::Types::Uint64 d_sequenceNumber;  // sequence number of the most
+                                           // recently read record
+
+    // NOT IMPLEMENTED
+    MappedFileReader(const MappedFileReader&);
+    MappedFileReader& operator=(const MappedFileReader&);
+
+  public:
+    // CREATORS
+    MappedFileReader();
+        // Create a reader having no open file.
+
+    ~MappedFileReader();
+        // Close the file of this reader, if any, and destroy this reader.
+
+    // MANIPULATORS
+    void close();
+        // Close the file of this reader.  This method has no effect if no
+        // file is open.
+
+    int open(const char *fileName);
+        // Open the mapped log file having the specified 'fileName', and
+        // prepare to read its oldest record.  Return 0 on success, a positive
+        // value if a file is already open (with no effect), and a negative
+        // value if the file cannot be opened or is not a valid mapped log
+        // file.
+
+    int readRecord(Record *record);
+        // Load into the specified 'record' the fixed fields of the next record
+        // of the file of this reader, and return 0.  Return 1, with no effect
+        // on 'record', if all the records of the file have been read, and a
+        // negative value, leaving 'record' in a valid but unspecified state,
+        // if the next frame of the file is corrupt.  The behavior is undefined
+        // unless a file is open.  Note that the user fields and attributes of
+        // 'record' are not modified.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the capacity of the ring of the open file, or 0 if no file
+        // is open.
+
+    bool isOpen() const;
+        // Return 'true' if this reader has an open file, and 'false'
+        // otherwise.
+
+    bsls::Types::Uint64 sequenceNumber() const;
+        // Return the sequence number of the record most recently loaded by
+        // 'readRecord'.  The behavior is undefined unless the most recent
+        // call to 'readRecord' since the file was opened returned 0.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class MappedFileReader
+                           // ----------------------
+
+// ACCESSORS
+inline
+int MappedFileReader::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+bool MappedFileReader::isOpen() const
+{
+    return 0 != d_mapping_p;
+}
+
+inline
+bsls::Types::Uint64 MappedFileReader::sequenceNumber() const
+{
+    return d_sequenceNumber;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,762 @@
+// ball_mappedfilereader.t.cpp                                        -*-C++-*-
+#include <ball_mappedfilereader.h>
+
+#include <ball_mappedfileutil.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a mechanism that reads the records of a
+// mapped log file.  The test driver builds mapped log files in memory using
+// 'ball::MappedFileUtil', writes them to a temporary directory, and verifies
+// that the reader opens valid files, rejects invalid ones, and reads the
+// records of a ring in order, whatever the position of the ring's tail.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] MappedFileReader();
+// [ 1] ~MappedFileReader();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const char *fileName);
+// [ 3] int readRecord(Record *record);
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isOpen() const;
+// [ 3] bsls::Types::Uint64 sequenceNumber() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CORRUPT FRAMES ARE DETECTED
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::MappedFileReader Obj;
+typedef ball::MappedFileUtil   Util;
+typedef bdls::FilesystemUtil   FsUtil;
+typedef bsls::Types::Uint64    Uint64;
+
+const int k_CAPACITY = 1024;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+class FileImage {
+    // This class provides an in-memory image of a mapped log file, having a
+    // ring of 'k_CAPACITY' bytes, that can be written to a file.
+
+    // DATA
+    bsl::vector<Uint64> d_words;  // aligned storage for the image
+
+  public:
+    // CREATORS
+    explicit FileImage(bslma::Allocator *basicAllocator = 0)
+        // Create an image of a file having an empty ring.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.
+    : d_words((Util::k_HEADER_SIZE + k_CAPACITY) / 8, 0, basicAllocator)
+    {
+        Util::initializeHeader(header(), k_CAPACITY);
+    }
+
+    // MANIPULATORS
+    char *header()
+        // Return the address of the header of this image.
+    {
+        return reinterpret_cast<char *>(d_words.data());
+    }
+
+    char *ring()
+        // Return the address of the ring of this image.
+    {
+        return header() + Util::k_HEADER_SIZE;
+    }
+
+    // ACCESSORS
+    int write(const bsl::string& fileName) const
+        // Write this image to the file having the specified 'fileName',
+        // replacing its contents.  Return 0 on success, and a non-zero value
+        // otherwise.
+    {
+        return writeBytes(fileName, size());
+    }
+
+    int writeBytes(const bsl::string& fileName, int numBytes) const
+        // Write the specified 'numBytes' first bytes of this image to the
+        // file having the specified 'fileName', replacing its contents.
+        // Return 0 on success, and a non-zero value otherwise.
+    {
+        FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                                 FsUtil::e_OPEN_OR_CREATE,
+                                                 FsUtil::e_READ_WRITE,
+                                                 FsUtil::e_TRUNCATE);
+        if (FsUtil::k_INVALID_FD == fd) {
+            return -1;                                                // RETURN
+        }
+
+        const int rc = FsUtil::write(fd, d_words.data(), numBytes);
+        FsUtil::close(fd);
+
+        return numBytes == rc ? 0 : -2;
+    }
+
+    int size() const
+        // Return the size of this image.
+    {
+        return static_cast<int>(d_words.size() * 8);
+    }
+};
+
+int encodeRecord(char               *frame,
+                 int                 length,
+                 Uint64              sequenceNumber,
+                 bslma::Allocator   *allocator)
+    // Encode into the specified 'frame' a record having the specified
+    // 'sequenceNumber', and a message chosen so that the frame has the
+    // specified 'length'.  Use the specified 'allocator' to supply memory.
+    // Return 'length'.  The behavior is undefined unless 'length' is a
+    // multiple of 8 that is at least 64.
+{
+    // With one-character file and category names, the fixed part of the
+    // frame (including the three null characters) is 61 bytes.
+
+    const bsl::string message(length - 61,
+                              static_cast<char>('a' + sequenceNumber % 26),
+                              allocator);
+
+    ball::Record record(allocator);
+    record.fixedFields().setFileName("f");
+    record.fixedFields().setCategory("c");
+    record.fixedFields().setLineNumber(static_cast<int>(sequenceNumber));
+    record.fixedFields().setSeverity(ball::Severity::e_INFO);
+    record.fixedFields().setMessage(message.c_str());
+
+    const int rc = Util::encodeRecord(frame, record, sequenceNumber, length);
+    ASSERTV(length, rc, length == rc);
+    return rc;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        // This is standard preamble to create a mapped log file holding two
+        // records.
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "usage.log");
+
+        {
+            FileImage image(&ta);
+
+            encodeRecord(image.ring(),      64, 0, &ta);
+            encodeRecord(image.ring() + 64, 72, 1, &ta);
+            Util::storeState(image.header(), 136, 136);
+
+            ASSERT(0 == image.write(fileName));
+        }
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Printing the Records of a Mapped Log File
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a process has logged records to a mapped log file named
+// 'fileName' using a 'ball::MappedFileObserver', and that we want to print
+// the most recent of those records.
+//
+// First, we open the file:
+//..
+    ball::MappedFileReader reader;
+
+    int rc = reader.open(fileName.c_str());
+    ASSERT(0 == rc);
+    ASSERT(reader.isOpen());
+//..
+// Then, we read the records of the file in order, and print each record
+// with its sequence number:
+//..
+    ball::Record record;
+
+    while (0 == (rc = reader.readRecord(&record))) {
+        if (verbose)
+        bsl::cout << reader.sequenceNumber() << ": "
+                  << record.fixedFields().messageRef() << bsl::endl;
+    }
+//..
+// Next, we verify that all the records of the file were read (a negative
+// value would indicate that the file is corrupt):
+//..
+    ASSERT(1 == rc);
+//..
+// Finally, we close the file:
+//..
+    reader.close();
+    ASSERT(!reader.isOpen());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING CORRUPT FRAMES
+        //
+        // Concerns:
+        //: 1 The records preceding a corrupt frame are read.
+        //:
+        //: 2 'readRecord' returns a negative value when it encounters a frame
+        //:   having an invalid header, a frame that extends past the bytes in
+        //:   use, or a record frame that cannot be decoded.
+        //
+        // Plan:
+        //: 1 Write files holding three records, of which the second is
+        //:   corrupt in various ways, and verify that the first record is
+        //:   read, and that reading the second fails.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CORRUPT FRAMES ARE DETECTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CORRUPT FRAMES"
+                          << "\n======================" << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "corrupt.log");
+
+        enum { e_MAGIC, e_LENGTH, e_OVERRUN, e_NULL, e_NUM_CORRUPTIONS };
+
+        for (int ti = 0; ti < e_NUM_CORRUPTIONS; ++ti) {
+            if (veryVerbose) { T_ P(ti) }
+
+            FileImage image(&ta);
+            char *ring = image.ring();
+
+            encodeRecord(ring,       64, 0, &ta);
+            encodeRecord(ring +  64, 96, 1, &ta);
+            encodeRecord(ring + 160, 64, 2, &ta);
+
+            int used = 224;
+
+            switch (ti) {
+              case e_MAGIC: {
+                ring[64] ^= 0x41;
+              } break;
+              case e_LENGTH: {
+                ring[68] ^= 0x41;
+              } break;
+              case e_OVERRUN: {
+                // The bytes in use end within the second frame.
+
+                used = 120;
+              } break;
+              case e_NULL: {
+                ring[64 + 95] = 'x';
+              } break;
+            }
+
+            Util::storeState(image.header(), used, used);
+            ASSERTV(ti, 0 == image.write(fileName));
+
+            Obj mX;
+            ASSERTV(ti, 0 == mX.open(fileName.c_str()));
+
+            ball::Record record(&ta);
+            ASSERTV(ti, 0 == mX.readRecord(&record));
+            ASSERTV(ti, 0 == mX.sequenceNumber());
+
+            ASSERTV(ti, 0 > mX.readRecord(&record));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'readRecord'
+        //
+        // Concerns:
+        //: 1 'readRecord' returns 1 immediately for an empty ring.
+        //:
+        //: 2 The records of the ring are read from the tail to the head, in
+        //:   order, and 'readRecord' returns 1 after the last record.
+        //:
+        //: 3 Wrap markers are skipped.
+        //:
+        //: 4 A full ring (having its head equal to its tail) is read
+        //:   entirely.
+        //:
+        //: 5 'sequenceNumber' returns the sequence number of the last record
+        //:   read.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write files holding rings of
+        //:   records having a variety of lengths, starting at a variety of
+        //:   offsets, and read them back.  (C-1..5)
+        //
+        // Testing:
+        //   int readRecord(Record *record);
+        //   bsls::Types::Uint64 sequenceNumber() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'readRecord'"
+                          << "\n====================" << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "ring.log");
+
+        static const struct {
+            int d_line;
+            int d_tail;        // offset of the first frame
+            int d_numRecords;  // number of records
+            int d_length;      // length of each record frame
+        } DATA[] = {
+            //LINE  TAIL  NUM  LENGTH
+            //----  ----  ---  ------
+            { L_,      0,   0,     64 },
+            { L_,    512,   0,     64 },
+            { L_,      0,   1,     64 },
+            { L_,      0,  16,     64 },  // full, no wrap
+            { L_,    256,  16,     64 },  // full, wrapped
+            { L_,    960,   2,     64 },  // wraps exactly at the end
+            { L_,    592,   5,    104 },  // wrap marker of 16 bytes
+            { L_,    592,   9,    104 },  // wrap marker, nearly full
+            { L_,   1016,   1,     64 },  // wrap marker of 8 bytes
+            { L_,      8,   1,   1016 },  // a single large frame
+            { L_,      0,   1,   1024 },  // a single frame filling the ring
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE   = DATA[ti].d_line;
+            const int TAIL   = DATA[ti].d_tail;
+            const int NUM    = DATA[ti].d_numRecords;
+            const int LENGTH = DATA[ti].d_length;
+
+            const Uint64 FIRST = 1000 + ti;
+
+            if (veryVerbose) { T_ P_(LINE) P_(TAIL) P_(NUM) P(LENGTH) }
+
+            FileImage image(&ta);
+            char *ring = image.ring();
+
+            int head = TAIL;
+            int used = 0;
+
+            for (int i = 0; i < NUM; ++i) {
+                if (k_CAPACITY - head < LENGTH) {
+                    Util::encodeWrapMarker(ring + head, k_CAPACITY - head);
+                    used += k_CAPACITY - head;
+                    head  = 0;
+                }
+
+                encodeRecord(ring + head, LENGTH, FIRST + i, &ta);
+
+                head += LENGTH;
+                if (k_CAPACITY == head) {
+                    head = 0;
+                }
+                used += LENGTH;
+            }
+            ASSERTV(LINE, used, used <= k_CAPACITY);
+
+            Util::storeState(image.header(), head, used);
+            ASSERTV(LINE, 0 == image.write(fileName));
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(LINE, 0 == mX.open(fileName.c_str()));
+            ASSERTV(LINE, k_CAPACITY == X.capacity());
+
+            ball::Record record(&ta);
+
+            for (int i = 0; i < NUM; ++i) {
+                ASSERTV(LINE, i, 0 == mX.readRecord(&record));
+                ASSERTV(LINE, i, FIRST + i == X.sequenceNumber());
+                ASSERTV(LINE, i, static_cast<int>(FIRST + i) ==
+                                            record.fixedFields().lineNumber());
+                ASSERTV(LINE, i, LENGTH - 61 == static_cast<int>(
+                                  record.fixedFields().messageRef().length()));
+            }
+
+            ASSERTV(LINE, 1 == mX.readRecord(&record));
+            ASSERTV(LINE, 1 == mX.readRecord(&record));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'open' AND 'close'
+        //
+        // Concerns:
+        //: 1 'open' succeeds for a valid mapped log file, including one that
+        //:   is larger than its header and ring.
+        //:
+        //: 2 'open' fails for a missing file, a file smaller than a header,
+        //:   a file smaller than its ring, and a file having an invalid
+        //:   header, leaving the reader closed.
+        //:
+        //: 3 'open' returns a positive value if a file is already open.
+        //:
+        //: 4 'close' closes the file, has no effect if no file is open, and
+        //:   allows another file to be opened.
+        //:
+        //: 5 'capacity' and 'isOpen' reflect the state of the reader.
+        //
+        // Plan:
+        //: 1 Write valid and invalid files, and verify the results of 'open'
+        //:   and the accessors.  (C-1..5)
+        //
+        // Testing:
+        //   void close();
+        //   int open(const char *fileName);
+        //   int capacity() const;
+        //   bool isOpen() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'open' AND 'close'"
+                          << "\n==========================" << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "open.log");
+
+        FileImage image(&ta);
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(!X.isOpen());
+        ASSERT(0 == X.capacity());
+
+        if (verbose) cout << "\nMissing file." << endl;
+        {
+            ASSERT(0 > mX.open(fileName.c_str()));
+            ASSERT(!X.isOpen());
+        }
+
+        if (verbose) cout << "\nTruncated files." << endl;
+        {
+            const int SIZES[] = { 0, 1, Util::k_HEADER_SIZE - 1,
+                                  Util::k_HEADER_SIZE,
+                                  Util::k_HEADER_SIZE + k_CAPACITY - 1 };
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, 0 == image.writeBytes(fileName, SIZES[i]));
+
+                ASSERTV(i, 0 > mX.open(fileName.c_str()));
+                ASSERTV(i, !X.isOpen());
+                ASSERTV(i, 0 == X.capacity());
+            }
+        }
+
+        if (verbose) cout << "\nCorrupt header." << endl;
+        {
+            image.header()[0] ^= 1;
+            ASSERT(0 == image.write(fileName));
+
+            ASSERT(0 > mX.open(fileName.c_str()));
+            ASSERT(!X.isOpen());
+
+            image.header()[0] ^= 1;
+        }
+
+        if (verbose) cout << "\nValid file." << endl;
+        {
+            ASSERT(0 == image.write(fileName));
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+            ASSERT(X.isOpen());
+            ASSERT(k_CAPACITY == X.capacity());
+
+            ASSERT(0 <  mX.open(fileName.c_str()));
+            ASSERT(X.isOpen());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.capacity());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+        }
+
+        if (verbose) cout << "\nFile larger than its ring." << endl;
+        {
+            FileImage larger(&ta);
+            ASSERT(0 == larger.write(fileName));
+
+            FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                                     FsUtil::e_OPEN,
+                                                     FsUtil::e_READ_WRITE);
+            ASSERT(FsUtil::k_INVALID_FD != fd);
+            ASSERT(0 == FsUtil::growFile(fd, 2 * larger.size()));
+            FsUtil::close(fd);
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+            ASSERT(X.isOpen());
+            ASSERT(k_CAPACITY == X.capacity());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a file holding two records, and read them back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&fileName, "breathing.log");
+
+        FileImage image(&ta);
+
+        encodeRecord(image.ring(),      64, 7, &ta);
+        encodeRecord(image.ring() + 64, 80, 8, &ta);
+        Util::storeState(image.header(), 144, 144);
+
+        ASSERT(0 == image.write(fileName));
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X.isOpen());
+
+        ASSERT(0 == mX.open(fileName.c_str()));
+        ASSERT(X.isOpen());
+
+        ball::Record record(&ta);
+
+        ASSERT(0 == mX.readRecord(&record));
+        ASSERT(7 == X.sequenceNumber());
+        ASSERT(3 == record.fixedFields().messageRef().length());
+
+        ASSERT(0 == mX.readRecord(&record));
+        ASSERT(8 == X.sequenceNumber());
+        ASSERT(19 == record.fixedFields().messageRef().length());
+
+        ASSERT(1 == mX.readRecord(&record));
+
+        mX.close();
+        ASSERT(!X.isOpen());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,459 @@
+// ball_mappedfileutil.cpp                                            -*-C++-*-
+#include <ball_mappedfileutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedfileutil_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>                // for testing only
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_epochutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignedbuffer.h>           // for testing only
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+///Implementation Notes
+///--------------------
+// The header and the fixed-length part of a record frame are described by
+// the 'FileHeader' and 'FrameHeader' 'struct's below, whose layouts match the
+// tables in the component documentation.  Frames are always aligned on a
+// 'k_FRAME_ALIGNMENT' boundary, so these 'struct's are accessed in place.
+//
+// The ring state is encoded in a single 64-bit word, having the head offset in
+// the high-order 32 bits and the number of bytes used in the low-order 32
+// bits, so that it can be stored with a single atomic operation.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+
+const bsls::Types::Uint64 k_FILE_MAGIC   = 0x314650414D4C4C42ULL;
+    // "BLLMAPF1" in little-endian byte order
+
+const unsigned int        k_VERSION      = 1;
+const unsigned int        k_BYTE_ORDER   = 0x01020304;
+const unsigned int        k_RECORD_MAGIC = 0x4352; // "RC"
+const unsigned int        k_WRAP_MAGIC   = 0x5057; // "WP"
+
+const int                 k_MAX_NAME_LENGTH = 0xFFFF;
+
+struct FileHeader {
+    // This 'struct' describes the header of a mapped log file.
+
+    bsls::Types::Uint64                     d_magic;      // 'k_FILE_MAGIC'
+    unsigned int                            d_version;    // 'k_VERSION'
+    unsigned int                            d_byteOrder;  // 'k_BYTE_ORDER'
+    unsigned int                            d_headerSize; // 'k_HEADER_SIZE'
+    unsigned int                            d_capacity;   // ring capacity
+    bsls::AtomicOperations::AtomicTypes::Uint64
+                                            d_state;      // head and used
+    char                                    d_reserved[32];
+};
+
+struct FrameHeader {
+    // This 'struct' describes the fixed-length part of a record frame.  A
+    // wrap marker consists of the 'd_magic' and 'd_length' fields only.
+
+    unsigned int        d_magic;           // 'k_RECORD_MAGIC' or
+                                           // 'k_WRAP_MAGIC'
+    unsigned int        d_length;          // frame length
+    bsls::Types::Uint64 d_sequenceNumber;  // sequence number
+    bsls::Types::Int64  d_timestamp;       // microseconds since the epoch
+    bsls::Types::Uint64 d_threadId;        // thread id
+    int                 d_processId;       // process id
+    int                 d_lineNumber;      // line number
+    int                 d_severity;        // severity
+    unsigned short      d_fileNameLength;  // length of the file name
+    unsigned short      d_categoryLength;  // length of the category name
+    unsigned int        d_messageLength;   // length of the message
+    unsigned int        d_reserved;        // unused
+};
+
+BSLMF_ASSERT(MappedFileUtil::k_HEADER_SIZE == sizeof(FileHeader));
+BSLMF_ASSERT(MappedFileUtil::k_FRAME_HEADER_SIZE == sizeof(FrameHeader));
+
+struct FrameLayout {
+    // This 'struct' holds the (possibly truncated) lengths of the
+    // variable-length fields of a record frame.
+
+    int d_fileNameLength;  // length of the file name
+    int d_categoryLength;  // length of the category name
+    int d_messageLength;   // length of the message
+    int d_frameLength;     // length of the frame (including padding)
+};
+
+inline
+int alignFrameLength(int length)
+    // Return the specified 'length' rounded up to a multiple of
+    // 'MappedFileUtil::k_FRAME_ALIGNMENT'.
+{
+    return (length + MappedFileUtil::k_FRAME_ALIGNMENT - 1)
+                                    & ~(MappedFileUtil::k_FRAME_ALIGNMENT - 1);
+}
+
+void computeLayout(FrameLayout             *layout,
+                   const RecordAttributes&  attributes,
+                   int                      maxFrameLength)
+    // Load into the specified 'layout' the lengths of the fields of the record
+    // frame encoding the specified 'attributes', truncated so that the frame
+    // length does not exceed the specified 'maxFrameLength'.
+{
+    BSLS_ASSERT(MappedFileUtil::k_FRAME_HEADER_SIZE
+                        + MappedFileUtil::k_FRAME_ALIGNMENT <= maxFrameLength);
+
+    // Limit each name to a quarter of the space available for the
+    // variable-length fields, so that at least half remains for the message
+    // and the null characters.
+
+    const bsl::size_t maxNameLength = bsl::min<bsl::size_t>(
+             k_MAX_NAME_LENGTH,
+             (maxFrameLength - MappedFileUtil::k_FRAME_HEADER_SIZE - 3) / 4);
+
+    layout->d_fileNameLength = static_cast<int>(
+                      bsl::min<bsl::size_t>(bsl::strlen(attributes.fileName()),
+                                            maxNameLength));
+    layout->d_categoryLength = static_cast<int>(
+                      bsl::min<bsl::size_t>(bsl::strlen(attributes.category()),
+                                            maxNameLength));
+
+    // Each string is followed by a null character.
+
+    const int fixedLength = MappedFileUtil::k_FRAME_HEADER_SIZE
+                          + layout->d_fileNameLength + 1
+                          + layout->d_categoryLength + 1
+                          + 1;
+
+    BSLS_ASSERT(fixedLength <= maxFrameLength);
+
+    layout->d_messageLength = static_cast<int>(
+              bsl::min<bsl::size_t>(attributes.messageRef().length(),
+                                    maxFrameLength - fixedLength));
+
+    layout->d_frameLength = alignFrameLength(fixedLength
+                                             + layout->d_messageLength);
+
+    BSLS_ASSERT(layout->d_frameLength <= maxFrameLength);
+}
+
+inline
+const FileHeader *fileHeader(const char *header)
+    // Return the address of the file header at the specified 'header'.
+{
+    return reinterpret_cast<const FileHeader *>(header);
+}
+
+inline
+FileHeader *fileHeader(char *header)
+    // Return the address of the modifiable file header at the specified
+    // 'header'.
+{
+    return reinterpret_cast<FileHeader *>(header);
+}
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // struct MappedFileUtil
+                           // ---------------------
+
+// CLASS METHODS
+void MappedFileUtil::initializeHeader(char *header, int capacity)
+{
+    BSLS_ASSERT(header);
+    BSLS_ASSERT(k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT(capacity <= k_MAX_CAPACITY);
+    BSLS_ASSERT(0 == capacity % k_FRAME_ALIGNMENT);
+
+    bsl::memset(header, 0, k_HEADER_SIZE);
+
+    FileHeader *fh = fileHeader(header);
+
+    fh->d_magic      = k_FILE_MAGIC;
+    fh->d_version    = k_VERSION;
+    fh->d_byteOrder  = k_BYTE_ORDER;
+    fh->d_headerSize = k_HEADER_SIZE;
+    fh->d_capacity   = capacity;
+
+    storeState(header, 0, 0);
+}
+
+int MappedFileUtil::validateHeader(int                *capacity,
+                                   const char         *header,
+                                   bsls::Types::Int64  fileSize)
+{
+    BSLS_ASSERT(capacity);
+    BSLS_ASSERT(header);
+
+    if (fileSize < k_HEADER_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const FileHeader *fh = fileHeader(header);
+
+    if (k_FILE_MAGIC   != fh->d_magic
+     || k_VERSION      != fh->d_version
+     || k_BYTE_ORDER   != fh->d_byteOrder
+     || k_HEADER_SIZE  != fh->d_headerSize) {
+        return -2;                                                    // RETURN
+    }
+
+    const unsigned int ringCapacity = fh->d_capacity;
+
+    if (ringCapacity < k_MIN_CAPACITY
+     || ringCapacity > k_MAX_CAPACITY
+     || 0 != ringCapacity % k_FRAME_ALIGNMENT
+     || fileSize < k_HEADER_SIZE + static_cast<bsls::Types::Int64>(
+                                                               ringCapacity)) {
+        return -3;                                                    // RETURN
+    }
+
+    int head;
+    int used;
+    loadState(&head, &used, header);
+
+    if (head < 0 || head >= static_cast<int>(ringCapacity)
+     || used < 0 || used >  static_cast<int>(ringCapacity)
+     || 0 != head % k_FRAME_ALIGNMENT
+     || 0 != used % k_FRAME_ALIGNMENT) {
+        return -4;                                                    // RETURN
+    }
+
+    *capacity = static_cast<int>(ringCapacity);
+    return 0;
+}
+
+void MappedFileUtil::loadState(int *head, int *used, const char *header)
+{
+    BSLS_ASSERT(head);
+    BSLS_ASSERT(used);
+    BSLS_ASSERT(header);
+
+    const bsls::Types::Uint64 state =
+                     AtomicOps::getUint64Acquire(&fileHeader(header)->d_state);
+
+    *head = static_cast<int>(state >> 32);
+    *used = static_cast<int>(state & 0xFFFFFFFF);
+}
+
+void MappedFileUtil::storeState(char *header, int head, int used)
+{
+    BSLS_ASSERT(header);
+    BSLS_ASSERT(0 <= head);
+    BSLS_ASSERT(0 <= used);
+
+    const bsls::Types::Uint64 state =
+                      (static_cast<bsls::Types::Uint64>(head) << 32)
+                    | static_cast<bsls::Types::Uint64>(used);
+
+    AtomicOps::setUint64Release(&fileHeader(header)->d_state, state);
+}
+
+int MappedFileUtil::encodedLength(const Record& record, int maxFrameLength)
+{
+    FrameLayout layout;
+    computeLayout(&layout, record.fixedFields(), maxFrameLength);
+
+    return layout.d_frameLength;
+}
+
+int MappedFileUtil::encodeRecord(char                *frame,
+                                 const Record&        record,
+                                 bsls::Types::Uint64  sequenceNumber,
+                                 int                  maxFrameLength)
+{
+    BSLS_ASSERT(frame);
+
+    const RecordAttributes& attributes = record.fixedFields();
+
+    FrameLayout layout;
+    computeLayout(&layout, attributes, maxFrameLength);
+
+    FrameHeader *fh = reinterpret_cast<FrameHeader *>(frame);
+
+    fh->d_magic          = k_RECORD_MAGIC;
+    fh->d_length         = layout.d_frameLength;
+    fh->d_sequenceNumber = sequenceNumber;
+    fh->d_timestamp      = (attributes.timestamp()
+                               - bdlt::EpochUtil::epoch()).totalMicroseconds();
+    fh->d_threadId       = attributes.threadID();
+    fh->d_processId      = attributes.processID();
+    fh->d_lineNumber     = attributes.lineNumber();
+    fh->d_severity       = attributes.severity();
+    fh->d_fileNameLength = static_cast<unsigned short>(
+                                                      layout.d_fileNameLength);
+    fh->d_categoryLength = static_cast<unsigned short>(
+                                                      layout.d_categoryLength);
+    fh->d_messageLength  = layout.d_messageLength;
+    fh->d_reserved       = 0;
+
+    char *data = frame + k_FRAME_HEADER_SIZE;
+
+    bsl::memcpy(data, attributes.fileName(), layout.d_fileNameLength);
+    data += layout.d_fileNameLength;
+    *data++ = 0;
+
+    bsl::memcpy(data, attributes.category(), layout.d_categoryLength);
+    data += layout.d_categoryLength;
+    *data++ = 0;
+
+    bsl::memcpy(data,
+                attributes.messageRef().data(),
+                layout.d_messageLength);
+    data += layout.d_messageLength;
+
+    // Terminate the message and clear the padding.
+
+    bsl::memset(data, 0, frame + layout.d_frameLength - data);
+
+    return layout.d_frameLength;
+}
+
+void MappedFileUtil::encodeWrapMarker(char *frame, int length)
+{
+    BSLS_ASSERT(frame);
+    BSLS_ASSERT(0 < length);
+    BSLS_ASSERT(0 == length % k_FRAME_ALIGNMENT);
+
+    FrameHeader *fh = reinterpret_cast<FrameHeader *>(frame);
+
+    fh->d_magic  = k_WRAP_MAGIC;
+    fh->d_length = length;
+}
+
+int MappedFileUtil::decodeFrameLength(bool       *isWrapMarker,
+                                      const char *frame,
+                                      int         maxLength)
+{
+    BSLS_ASSERT(isWrapMarker);
+    BSLS_ASSERT(frame);
+
+    if (maxLength < k_FRAME_ALIGNMENT) {
+        return -1;                                                    // RETURN
+    }
+
+    const FrameHeader *fh = reinterpret_cast<const FrameHeader *>(frame);
+
+    const unsigned int length = fh->d_length;
+
+    if (0 == length
+     || length > static_cast<unsigned int>(maxLength)
+     || 0 != length % k_FRAME_ALIGNMENT) {
+        return -2;                                                    // RETURN
+    }
+
+    if (k_WRAP_MAGIC == fh->d_magic) {
+        *isWrapMarker = true;
+        return static_cast<int>(length);                              // RETURN
+    }
+
+    if (k_RECORD_MAGIC != fh->d_magic || length < k_FRAME_HEADER_SIZE) {
+        return -3;                                                    // RETURN
+    }
+
+    *isWrapMarker = false;
+    return static_cast<int>(length);
+}
+
+int MappedFileUtil::decodeRecord(Record              *record,
+                                 bsls::Types::Uint64 *sequenceNumber,
+                                 const char          *frame,
+                                 int                  length)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(sequenceNumber);
+    BSLS_ASSERT(frame);
+
+    if (length < k_FRAME_HEADER_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const FrameHeader *fh = reinterpret_cast<const FrameHeader *>(frame);
+
+    if (k_RECORD_MAGIC != fh->d_magic
+     || static_cast<unsigned int>(length) != fh->d_length) {
+        return -2;                                                    // RETURN
+    }
+
+    const bsls::Types::Int64 dataLength =
+                     static_cast<bsls::Types::Int64>(fh->d_fileNameLength) + 1
+                   + static_cast<bsls::Types::Int64>(fh->d_categoryLength) + 1
+                   + static_cast<bsls::Types::Int64>(fh->d_messageLength)  + 1;
+
+    if (dataLength > length - k_FRAME_HEADER_SIZE) {
+        return -3;                                                    // RETURN
+    }
+
+    const char *fileName = frame + k_FRAME_HEADER_SIZE;
+    const char *category = fileName + fh->d_fileNameLength + 1;
+    const char *message  = category + fh->d_categoryLength + 1;
+
+    if (0 != category[-1]
+     || 0 != message[-1]
+     || 0 != message[fh->d_messageLength]) {
+        return -4;                                                    // RETURN
+    }
+
+    // Split the timestamp into whole seconds and a non-negative number of
+    // microseconds, so that only the addition of the seconds can produce an
+    // invalid 'Datetime' value.
+
+    bsls::Types::Int64 seconds      = fh->d_timestamp / 1000000;
+    bsls::Types::Int64 microseconds = fh->d_timestamp % 1000000;
+    if (microseconds < 0) {
+        microseconds += 1000000;
+        --seconds;
+    }
+
+    bdlt::Datetime timestamp = bdlt::EpochUtil::epoch();
+    if (0 != timestamp.addSecondsIfValid(seconds)) {
+        return -5;                                                    // RETURN
+    }
+    timestamp.addMicroseconds(microseconds);
+
+    RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(timestamp);
+    attributes.setThreadID(fh->d_threadId);
+    attributes.setProcessID(fh->d_processId);
+    attributes.setLineNumber(fh->d_lineNumber);
+    attributes.setSeverity(fh->d_severity);
+    attributes.setFileName(fileName);
+    attributes.setCategory(category);
+
+    attributes.clearMessage();
+    attributes.messageStreamBuf().sputn(message, fh->d_messageLength);
+
+    *sequenceNumber = fh->d_sequenceNumber;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,279 @@
+// ball_mappedfileutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDFILEUTIL
+#define INCLUDED_BALL_MAPPEDFILEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities for the binary layout of a mapped log file.
+//
+//@CLASSES:
+//  ball::MappedFileUtil: namespace for mapped log file encoding functions
+//
+//@SEE_ALSO: ball_mappedfileobserver, ball_mappedfilereader
+//
+//@DESCRIPTION: This component provides a 'struct', 'ball::MappedFileUtil',
+// that defines the binary layout of a *mapped* *log* *file*: a file of fixed
+// size, written through a memory mapping by 'ball::MappedFileObserver' and
+// read by 'ball::MappedFileReader', that holds the most recent log records
+// published to the observer in a circular buffer (a "ring").
+//
+///File Layout
+///-----------
+// A mapped log file consists of a header of 'k_HEADER_SIZE' bytes followed by
+// a ring of 'capacity' bytes, where 'capacity' is a multiple of
+// 'k_FRAME_ALIGNMENT' recorded in the header.  The header holds, in addition
+// to a magic number, a format version, and a byte-order mark, the *state* of
+// the ring: the offset within the ring at which the next record will be
+// written (the "head"), and the number of bytes of the ring that are in use.
+// The bytes in use are the 'used' bytes that precede the head (circularly),
+// so the offset of the oldest record (the "tail") need not be stored.  The
+// state is a single 64-bit word that is loaded and stored atomically, so that
+// a reader of a file that was being written when the writing process
+// terminated always observes a consistent ring.
+//
+// The ring holds a sequence of *frames*, each aligned on a
+// 'k_FRAME_ALIGNMENT' boundary.  A *record* *frame* holds the fixed fields of
+// a single 'ball::Record' (see 'ball_recordattributes') and a sequence
+// number, and has the following layout (all integers are in the byte order of
+// the writing platform, which is identified by the byte-order mark in the
+// header):
+//..
+//  Offset  Size  Field
+//  ------  ----  -----------------------------------------------------
+//       0     4  frame magic number
+//       4     4  frame length (including padding)
+//       8     8  sequence number
+//      16     8  timestamp (microseconds since the Unix epoch, UTC)
+//      24     8  thread id
+//      32     4  process id
+//      36     4  line number
+//      40     4  severity
+//      44     2  length of the file name
+//      46     2  length of the category name
+//      48     4  length of the message
+//      52     4  (reserved)
+//      56     -  file name, category name, and message, each followed by
+//                a null character, and padding to a multiple of
+//                'k_FRAME_ALIGNMENT' bytes
+//..
+// A *wrap* *marker* is a frame that occupies the bytes between the end of
+// the last record frame and the end of the ring, when the next record frame
+// does not fit in those bytes; the frame following a wrap marker starts at
+// the beginning of the ring.  A wrap marker consists of a distinct magic
+// number and its length, and may be as short as 'k_FRAME_ALIGNMENT' bytes.
+//
+// A record is encoded in a frame no longer than a maximum frame length
+// supplied to 'encodedLength' and 'encodeRecord'.  The file name and category
+// name of a record are each truncated to 65535 bytes, and to a quarter of the
+// space that the maximum frame length leaves for variable-length fields, and
+// the message of a record is truncated to the remaining space.  User fields
+// and attributes of a record are not encoded.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Record
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a log record in a buffer, and later recreate
+// the record from the buffer.
+//
+// First, we create a record:
+//..
+//  ball::Record record;
+//
+//  ball::RecordAttributes& attributes = record.fixedFields();
+//
+//  attributes.setTimestamp(bdlt::Datetime(2020, 1, 2, 3, 4, 5, 6, 7));
+//  attributes.setProcessID(1234);
+//  attributes.setThreadID(5678);
+//  attributes.setFileName("example.cpp");
+//  attributes.setLineNumber(42);
+//  attributes.setCategory("EXAMPLE");
+//  attributes.setSeverity(ball::Severity::e_INFO);
+//  attributes.setMessage("Hello, world!");
+//..
+// Then, we determine the length of the frame encoding the record, and encode
+// the record, with sequence number 17, into a suitably aligned buffer:
+//..
+//  bsls::AlignedBuffer<256, 8> buffer;
+//
+//  const int length = ball::MappedFileUtil::encodedLength(record, 256);
+//  assert(ball::MappedFileUtil::k_FRAME_HEADER_SIZE < length);
+//  assert(length <= 256);
+//
+//  assert(length == ball::MappedFileUtil::encodeRecord(buffer.buffer(),
+//                                                      record,
+//                                                      17,
+//                                                      256));
+//..
+// Now, we verify that the buffer holds a record frame of 'length' bytes:
+//..
+//  bool isWrapMarker;
+//
+//  assert(length == ball::MappedFileUtil::decodeFrameLength(&isWrapMarker,
+//                                                           buffer.buffer(),
+//                                                           256));
+//  assert(!isWrapMarker);
+//..
+// Finally, we decode the frame and verify that the fixed fields of the
+// decoded record are equal to those of the original record:
+//..
+//  ball::Record        decoded;
+//  bsls::Types::Uint64 sequenceNumber;
+//
+//  assert(0 == ball::MappedFileUtil::decodeRecord(&decoded,
+//                                                 &sequenceNumber,
+//                                                 buffer.buffer(),
+//                                                 length));
+//
+//  assert(17         == sequenceNumber);
+//  assert(attributes == decoded.fixedFields());
+//..
+
+#include <balscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                           // =====================
+                           // struct MappedFileUtil
+                           // =====================
+
+struct MappedFileUtil {
+    // This 'struct' provides a namespace for utility functions that read and
+    // write the header and frames of a mapped log file.
+
+    // TYPES
+    enum {
+        k_HEADER_SIZE       = 64,          // size of the file header
+
+        k_FRAME_HEADER_SIZE = 56,          // size of the fixed-length part of
+                                           // a record frame
+
+        k_FRAME_ALIGNMENT   = 8,           // alignment of frames and of the
+                                           // ring capacity
+
+        k_MIN_CAPACITY      = 1024,        // minimum ring capacity
+
+        k_MAX_CAPACITY      = 0x7FFFFFF8   // maximum ring capacity
+    };
+
+    // CLASS METHODS
+    static void initializeHeader(char *header, int capacity);
+        // Initialize the specified 'header' of a mapped log file to describe
+        // an empty ring having the specified 'capacity'.  The behavior is
+        // undefined unless 'header' refers to at least 'k_HEADER_SIZE'
+        // writable bytes aligned on a 'k_FRAME_ALIGNMENT' boundary, and
+        // 'capacity' is a multiple of 'k_FRAME_ALIGNMENT' in the range
+        // '[k_MIN_CAPACITY .. k_MAX_CAPACITY]'.
+
+    static int validateHeader(int                *capacity,
+                              const char         *header,
+                              bsls::Types::Int64  fileSize);
+        // Load into the specified 'capacity' the capacity of the ring
+        // described by the specified 'header' of a mapped log file having the
+        // specified 'fileSize', and return 0 if 'header' is a valid header
+        // for a file of 'fileSize' bytes written on a platform having the
+        // byte order of this platform.  Return a non-zero value, with no
+        // effect on 'capacity', otherwise.  The behavior is undefined unless
+        // 'header' refers to at least 'k_HEADER_SIZE' bytes aligned on a
+        // 'k_FRAME_ALIGNMENT' boundary.
+
+    static void loadState(int *head, int *used, const char *header);
+        // Load into the specified 'head' and 'used' the offset of the next
+        // frame and the number of bytes in use, respectively, of the ring
+        // described by the specified 'header'.  The behavior is undefined
+        // unless 'header' is a valid header (see 'validateHeader').
+
+    static void storeState(char *header, int head, int used);
+        // Store into the specified 'header' the specified 'head' offset of
+        // the next frame and the specified number of bytes 'used' of the
+        // ring.  All writes to the ring made before this call are visible to
+        // a thread that observes the stored state.  The behavior is undefined
+        // unless 'header' is a valid header, and '0 <= head < capacity' and
+        // '0 <= used <= capacity', where 'capacity' is the capacity recorded
+        // in 'header'.
+
+    static int encodedLength(const Record& record, int maxFrameLength);
+        // Return the length of the record frame that encodes the specified
+        // 'record', having its message truncated, if necessary, so that the
+        // frame length does not exceed the specified 'maxFrameLength'.  The
+        // behavior is undefined unless 'maxFrameLength' is a multiple of
+        // 'k_FRAME_ALIGNMENT' that is at least
+        // 'k_FRAME_HEADER_SIZE + k_FRAME_ALIGNMENT'.  Note that the returned
+        // value is a multiple of 'k_FRAME_ALIGNMENT'.
+
+    static int encodeRecord(char                *frame,
+                            const Record&        record,
+                            bsls::Types::Uint64  sequenceNumber,
+                            int                  maxFrameLength);
+        // Encode the specified 'record' having the specified 'sequenceNumber'
+        // into the record frame at the specified 'frame', truncating the
+        // message of 'record', if necessary, so that the frame length does
+        // not exceed the specified 'maxFrameLength'.  Return the length of
+        // the frame, which is 'encodedLength(record, maxFrameLength)'.  The
+        // behavior is undefined unless 'frame' refers to at least
+        // 'encodedLength(record, maxFrameLength)' writable bytes aligned on a
+        // 'k_FRAME_ALIGNMENT' boundary, and 'maxFrameLength' meets the
+        // requirements of 'encodedLength'.
+
+    static void encodeWrapMarker(char *frame, int length);
+        // Encode a wrap marker of the specified 'length' at the specified
+        // 'frame'.  The behavior is undefined unless 'frame' refers to at
+        // least 'length' writable bytes aligned on a 'k_FRAME_ALIGNMENT'
+        // boundary, and 'length' is a positive multiple of
+        // 'k_FRAME_ALIGNMENT'.
+
+    static int decodeFrameLength(bool       *isWrapMarker,
+                                 const char *frame,
+                                 int         maxLength);
+        // Return the length of the frame at the specified 'frame', and load
+        // into the specified 'isWrapMarker' 'true' if the frame is a wrap
+        // marker, and 'false' if it is a record frame.  Return a negative
+        // value, with no effect on 'isWrapMarker', if the bytes at 'frame' do
+        // not start a valid frame of at most the specified 'maxLength' bytes.
+        // The behavior is undefined unless 'frame' refers to at least
+        // 'k_FRAME_ALIGNMENT' bytes aligned on a 'k_FRAME_ALIGNMENT'
+        // boundary, and 'maxLength' bytes are readable at 'frame'.
+
+    static int decodeRecord(Record              *record,
+                            bsls::Types::Uint64 *sequenceNumber,
+                            const char          *frame,
+                            int                  length);
+        // Load into the specified 'record' and 'sequenceNumber' the fixed
+        // fields and sequence number encoded by the record frame of the
+        // specified 'length' at the specified 'frame'.  Return 0 on success,
+        // and a non-zero value, with no effect on 'sequenceNumber' and an
+        // unspecified value of 'record', if the frame is not a valid record
+        // frame of 'length' bytes.  The user fields and attributes of
+        // 'record' are not modified.  The behavior is undefined unless 'frame'
+        // refers to at least 'length' bytes aligned on a 'k_FRAME_ALIGNMENT'
+        // boundary.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,830 @@
+// ball_mappedfileutil.t.cpp                                          -*-C++-*-
+#include <ball_mappedfileutil.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a utility 'struct' whose functions read
+// and write the header and the frames of a mapped log file.  The header
+// functions are tested by initializing a header and verifying that it is
+// valid, then corrupting each of its fields in turn.  The frame functions are
+// tested by encoding records having a variety of field values and maximum
+// frame lengths, and verifying that decoding the frames yields the (possibly
+// truncated) original fixed fields.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void initializeHeader(char *header, int capacity);
+// [ 2] int validateHeader(int *, const char *, Int64);
+// [ 2] void loadState(int *head, int *used, const char *header);
+// [ 2] void storeState(char *header, int head, int used);
+// [ 3] int encodedLength(const Record& record, int maxFrameLength);
+// [ 3] int encodeRecord(char *, const Record&, Uint64, int);
+// [ 4] void encodeWrapMarker(char *frame, int length);
+// [ 3] int decodeFrameLength(bool *, const char *, int);
+// [ 3] int decodeRecord(Record *, Uint64 *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CORRUPT FRAMES ARE DETECTED
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::MappedFileUtil Util;
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+
+const int k_BUFFER_SIZE = 4096;
+
+typedef bsls::AlignedBuffer<k_BUFFER_SIZE, Util::k_FRAME_ALIGNMENT> Buffer;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void setAttributes(ball::Record          *record,
+                   const bdlt::Datetime&  timestamp,
+                   int                    processId,
+                   Uint64                 threadId,
+                   const char            *fileName,
+                   int                    lineNumber,
+                   const char            *category,
+                   int                    severity,
+                   const bsl::string&     message)
+    // Set the fixed fields of the specified 'record' to the specified
+    // 'timestamp', 'processId', 'threadId', 'fileName', 'lineNumber',
+    // 'category', 'severity', and 'message'.
+{
+    ball::RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(timestamp);
+    attributes.setProcessID(processId);
+    attributes.setThreadID(threadId);
+    attributes.setFileName(fileName);
+    attributes.setLineNumber(lineNumber);
+    attributes.setCategory(category);
+    attributes.setSeverity(severity);
+    attributes.clearMessage();
+    attributes.messageStreamBuf().sputn(message.data(), message.length());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Record
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a log record in a buffer, and later recreate
+// the record from the buffer.
+//
+// First, we create a record:
+//..
+    ball::Record record;
+
+    ball::RecordAttributes& attributes = record.fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2020, 1, 2, 3, 4, 5, 6, 7));
+    attributes.setProcessID(1234);
+    attributes.setThreadID(5678);
+    attributes.setFileName("example.cpp");
+    attributes.setLineNumber(42);
+    attributes.setCategory("EXAMPLE");
+    attributes.setSeverity(ball::Severity::e_INFO);
+    attributes.setMessage("Hello, world!");
+//..
+// Then, we determine the length of the frame encoding the record, and encode
+// the record, with sequence number 17, into a suitably aligned buffer:
+//..
+    bsls::AlignedBuffer<256, 8> buffer;
+
+    const int length = ball::MappedFileUtil::encodedLength(record, 256);
+    ASSERT(ball::MappedFileUtil::k_FRAME_HEADER_SIZE < length);
+    ASSERT(length <= 256);
+
+    ASSERT(length == ball::MappedFileUtil::encodeRecord(buffer.buffer(),
+                                                        record,
+                                                        17,
+                                                        256));
+//..
+// Now, we verify that the buffer holds a record frame of 'length' bytes:
+//..
+    bool isWrapMarker;
+
+    ASSERT(length == ball::MappedFileUtil::decodeFrameLength(&isWrapMarker,
+                                                             buffer.buffer(),
+                                                             256));
+    ASSERT(!isWrapMarker);
+//..
+// Finally, we decode the frame and verify that the fixed fields of the
+// decoded record are equal to those of the original record:
+//..
+    ball::Record        decoded;
+    bsls::Types::Uint64 sequenceNumber;
+
+    ASSERT(0 == ball::MappedFileUtil::decodeRecord(&decoded,
+                                                   &sequenceNumber,
+                                                   buffer.buffer(),
+                                                   length));
+
+    ASSERT(17         == sequenceNumber);
+    ASSERT(attributes == decoded.fixedFields());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING WRAP MARKERS AND CORRUPT FRAMES
+        //
+        // Concerns:
+        //: 1 A wrap marker of any valid length is decoded as a wrap marker of
+        //:   that length.
+        //:
+        //: 2 A frame whose length exceeds the maximum length, is zero, or is
+        //:   not a multiple of the frame alignment is rejected.
+        //:
+        //: 3 A frame having an unknown magic number is rejected.
+        //:
+        //: 4 A record frame whose field lengths are inconsistent with its
+        //:   frame length, or whose strings are not null-terminated, is
+        //:   rejected by 'decodeRecord'.
+        //
+        // Plan:
+        //: 1 Encode wrap markers of several lengths, and decode their length.
+        //:   (C-1)
+        //:
+        //: 2 Encode a record, corrupt each relevant byte of the frame in turn,
+        //:   and verify that the frame is rejected.  (C-2..4)
+        //
+        // Testing:
+        //   void encodeWrapMarker(char *frame, int length);
+        //   CONCERN: CORRUPT FRAMES ARE DETECTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << "\nTESTING WRAP MARKERS AND CORRUPT FRAMES"
+                        << "\n=======================================" << endl;
+
+        if (verbose) cout << "\nTesting wrap markers." << endl;
+        {
+            const int LENGTHS[] = { 8, 16, 56, 64, 1000, k_BUFFER_SIZE };
+
+            for (int i = 0; i < static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS); ++i) {
+                const int LENGTH = LENGTHS[i];
+
+                Buffer buffer;
+                bsl::memset(buffer.buffer(), 0xA5, k_BUFFER_SIZE);
+
+                Util::encodeWrapMarker(buffer.buffer(), LENGTH);
+
+                bool isWrapMarker = false;
+                ASSERTV(LENGTH, LENGTH == Util::decodeFrameLength(
+                                                             &isWrapMarker,
+                                                             buffer.buffer(),
+                                                             LENGTH));
+                ASSERTV(LENGTH, isWrapMarker);
+
+                ASSERTV(LENGTH, 0 > Util::decodeFrameLength(&isWrapMarker,
+                                                            buffer.buffer(),
+                                                            LENGTH - 8));
+            }
+        }
+
+        if (verbose) cout << "\nTesting corrupt frames." << endl;
+        {
+            ball::Record record(&ta);
+            setAttributes(&record,
+                          bdlt::Datetime(2021, 6, 7, 8, 9, 10, 11, 12),
+                          99,
+                          100,
+                          "file.cpp",
+                          7,
+                          "CATEGORY",
+                          ball::Severity::e_ERROR,
+                          "message");
+
+            Buffer original;
+            const int LENGTH = Util::encodeRecord(original.buffer(),
+                                                  record,
+                                                  5,
+                                                  k_BUFFER_SIZE);
+
+            ball::Record decoded(&ta);
+            Uint64       sequenceNumber = 0;
+            bool         isWrapMarker;
+
+            ASSERT(0 == Util::decodeRecord(&decoded,
+                                           &sequenceNumber,
+                                           original.buffer(),
+                                           LENGTH));
+            ASSERT(5 == sequenceNumber);
+
+            // Corrupt each byte of the frame header (excepting the fields
+            // whose values are not validated), and of the null characters
+            // following the strings.
+
+            const int FILE_NAME = Util::k_FRAME_HEADER_SIZE;
+            const int CATEGORY  = FILE_NAME + 8 + 1;
+            const int MESSAGE   = CATEGORY  + 8 + 1;
+
+            const int OFFSETS[] = {
+                0, 1, 3,                 // magic number
+                4, 5, 7,                 // frame length
+                44, 45,                  // file name length
+                46, 47,                  // category length
+                48, 49, 51,              // message length
+                CATEGORY - 1,            // null after the file name
+                MESSAGE - 1,             // null after the category
+                MESSAGE + 7              // null after the message
+            };
+
+            for (int i = 0; i < static_cast<int>(sizeof OFFSETS
+                                                 / sizeof *OFFSETS); ++i) {
+                const int OFFSET = OFFSETS[i];
+
+                Buffer buffer;
+                bsl::memcpy(buffer.buffer(), original.buffer(), LENGTH);
+
+                buffer.buffer()[OFFSET] ^= 0x41;
+
+                const int length = Util::decodeFrameLength(&isWrapMarker,
+                                                           buffer.buffer(),
+                                                           LENGTH);
+
+                const int rc = Util::decodeRecord(&decoded,
+                                                  &sequenceNumber,
+                                                  buffer.buffer(),
+                                                  LENGTH);
+
+                ASSERTV(OFFSET, length, rc, 0 > length || 0 != rc);
+            }
+
+            // A frame shorter than the frame header is rejected.
+
+            ASSERT(0 != Util::decodeRecord(&decoded,
+                                           &sequenceNumber,
+                                           original.buffer(),
+                                           Util::k_FRAME_HEADER_SIZE - 8));
+
+            // A buffer shorter than the minimum frame length is rejected.
+
+            ASSERT(0 > Util::decodeFrameLength(&isWrapMarker,
+                                               original.buffer(),
+                                               Util::k_FRAME_ALIGNMENT - 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ENCODING AND DECODING RECORDS
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the length of the frame written by
+        //:   'encodeRecord', which is a multiple of the frame alignment that
+        //:   does not exceed the maximum frame length.
+        //:
+        //: 2 A record whose frame fits in the maximum frame length is decoded
+        //:   to a record having the same fixed fields, and the sequence number
+        //:   is preserved.
+        //:
+        //: 3 Otherwise, the file name and category are each truncated to a
+        //:   quarter of the space available for variable-length fields, and
+        //:   the message is truncated to fit the remaining space.
+        //:
+        //: 4 Timestamps before and after the epoch, with microsecond
+        //:   precision, are preserved.
+        //:
+        //: 5 Messages having embedded null characters are preserved.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, encode records having a variety
+        //:   of field values with a variety of maximum frame lengths, and
+        //:   verify the frame length and the decoded fields.  (C-1..5)
+        //
+        // Testing:
+        //   int encodedLength(const Record& record, int maxFrameLength);
+        //   int encodeRecord(char *, const Record&, Uint64, int);
+        //   int decodeFrameLength(bool *, const char *, int);
+        //   int decodeRecord(Record *, Uint64 *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ENCODING AND DECODING RECORDS"
+                          << "\n=====================================" << endl;
+
+        const bsl::string LONG(2000, 'x', &ta);
+        const bsl::string NULLS("a\0b\0c", 5, &ta);
+
+        static const struct {
+            int         d_line;
+            int         d_year;        // timestamp year
+            int         d_usec;        // timestamp microseconds
+            const char *d_fileName;
+            const char *d_category;
+            int         d_messageLength;  // -1 for 'NULLS'
+            int         d_maxFrameLength;
+        } DATA[] = {
+            //LINE  YEAR  USEC  FILE         CAT     MSGLEN  MAX
+            //----  ----  ----  -----------  ------  ------  ----
+            { L_,   1970,    0, "",          "",          0,   64 },
+            { L_,   1970,    1, "a.cpp",     "A",         1,  128 },
+            { L_,   2038,  999, "a.cpp",     "A",        -1,  128 },
+            { L_,   1969,  999, "b.cpp",     "B",        10,  256 },
+            { L_,      1,    0, "b.cpp",     "B",        10,  256 },
+            { L_,   9999,  999, "c.cpp",     "CAT",     100, 4096 },
+            { L_,   2020,  500, "c.cpp",     "CAT",     100,  120 },
+            { L_,   2020,  500, "long.cpp",  "LONG",   2000, 4096 },
+            { L_,   2020,  500, "long.cpp",  "LONG",   2000, 1024 },
+            { L_,   2020,  500, "long.cpp",  "LONG",   2000,   64 },
+            { L_,   2020,  500, 0,           0,        2000, 4096 },
+            { L_,   2020,  500, 0,           0,        2000,  256 },
+            { L_,   2020,  500, 0,           0,        2000,   64 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const int   MAX    = DATA[ti].d_maxFrameLength;
+
+            // A null 'd_fileName' and 'd_category' designate 'LONG'.
+
+            const char *FILE   = DATA[ti].d_fileName
+                                 ? DATA[ti].d_fileName
+                                 : LONG.c_str();
+            const char *CAT    = DATA[ti].d_category
+                                 ? DATA[ti].d_category
+                                 : LONG.c_str();
+            const bsl::string MESSAGE = 0 > DATA[ti].d_messageLength
+                                        ? NULLS
+                                        : LONG.substr(
+                                                 0,
+                                                 DATA[ti].d_messageLength);
+
+            const bdlt::Datetime TIMESTAMP(DATA[ti].d_year, 1, 1,
+                                           0, 0, 0,
+                                           0, DATA[ti].d_usec);
+
+            const Uint64 SEQUENCE_NUMBER = ti * 0x100000001ULL;
+
+            if (veryVerbose) { T_ P_(LINE) P_(MAX) P(TIMESTAMP) }
+
+            ball::Record record(&ta);
+            setAttributes(&record,
+                          TIMESTAMP,
+                          ti,
+                          SEQUENCE_NUMBER + 1,
+                          FILE,
+                          LINE,
+                          CAT,
+                          ti % 256,
+                          MESSAGE);
+
+            const int LENGTH = Util::encodedLength(record, MAX);
+
+            ASSERTV(LINE, LENGTH, MAX, LENGTH <= MAX);
+            ASSERTV(LINE, LENGTH, Util::k_FRAME_HEADER_SIZE < LENGTH);
+            ASSERTV(LINE, LENGTH, 0 == LENGTH % Util::k_FRAME_ALIGNMENT);
+
+            // Fill the buffer with garbage, to verify that padding is cleared.
+
+            Buffer buffer;
+            bsl::memset(buffer.buffer(), 0xA5, k_BUFFER_SIZE);
+
+            ASSERTV(LINE, LENGTH == Util::encodeRecord(buffer.buffer(),
+                                                       record,
+                                                       SEQUENCE_NUMBER,
+                                                       MAX));
+
+            for (int i = LENGTH; i < k_BUFFER_SIZE; ++i) {
+                ASSERTV(LINE, i, static_cast<char>(0xA5) ==
+                                                          buffer.buffer()[i]);
+            }
+
+            bool isWrapMarker = true;
+            ASSERTV(LINE, LENGTH == Util::decodeFrameLength(&isWrapMarker,
+                                                            buffer.buffer(),
+                                                            MAX));
+            ASSERTV(LINE, !isWrapMarker);
+
+            ball::Record decoded(&ta);
+            Uint64       sequenceNumber = 0;
+
+            ASSERTV(LINE, 0 == Util::decodeRecord(&decoded,
+                                                  &sequenceNumber,
+                                                  buffer.buffer(),
+                                                  LENGTH));
+            ASSERTV(LINE, SEQUENCE_NUMBER == sequenceNumber);
+
+            const ball::RecordAttributes& A = record.fixedFields();
+            const ball::RecordAttributes& D = decoded.fixedFields();
+
+            ASSERTV(LINE, A.timestamp(), D.timestamp(),
+                    A.timestamp() == D.timestamp());
+            ASSERTV(LINE, A.processID()  == D.processID());
+            ASSERTV(LINE, A.threadID()   == D.threadID());
+            ASSERTV(LINE, A.lineNumber() == D.lineNumber());
+            ASSERTV(LINE, A.severity()   == D.severity());
+
+            // Verify that each string is the original string, truncated as
+            // documented.
+
+            const bsl::size_t maxName = bsl::min<bsl::size_t>(
+                                       65535,
+                                       (MAX - Util::k_FRAME_HEADER_SIZE - 3)
+                                                                         / 4);
+
+            const bsl::string file(A.fileName(), &ta);
+            const bsl::string cat(A.category(), &ta);
+
+            ASSERTV(LINE, D.fileName(),
+                    file.substr(0, maxName) == D.fileName());
+            ASSERTV(LINE, D.category(),
+                    cat.substr(0, maxName) == D.category());
+
+            const bsl::size_t fixedLength =
+                                   Util::k_FRAME_HEADER_SIZE
+                                 + bsl::strlen(D.fileName()) + 1
+                                 + bsl::strlen(D.category()) + 1
+                                 + 1;
+
+            ASSERTV(LINE, D.messageRef(),
+                    MESSAGE.substr(0, MAX - fixedLength) == D.messageRef());
+
+            const bool truncated = file.length() > maxName
+                                || cat.length()  > maxName
+                                || MESSAGE.length() > MAX - fixedLength;
+
+            ASSERTV(LINE, truncated || A == D);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING HEADER FUNCTIONS
+        //
+        // Concerns:
+        //: 1 An initialized header is valid for a file holding the header and
+        //:   the ring, and describes an empty ring of the specified capacity.
+        //:
+        //: 2 A header is invalid for a file too small to hold the ring.
+        //:
+        //: 3 A header having a corrupt magic number, version, byte-order mark,
+        //:   header size, or capacity is invalid.
+        //:
+        //: 4 A header having a state that is not consistent with its capacity
+        //:   is invalid.
+        //:
+        //: 5 'storeState' and 'loadState' preserve the head and number of
+        //:   bytes used.
+        //
+        // Plan:
+        //: 1 Initialize headers for several capacities, and verify their
+        //:   validity against several file sizes.  (C-1..2)
+        //:
+        //: 2 Corrupt each byte of the fixed part of a valid header in turn,
+        //:   and verify that the header is invalid.  (C-3)
+        //:
+        //: 3 Store valid and invalid states, and verify the loaded state and
+        //:   the validity of the header.  (C-4..5)
+        //
+        // Testing:
+        //   void initializeHeader(char *header, int capacity);
+        //   int validateHeader(int *, const char *, Int64);
+        //   void loadState(int *head, int *used, const char *header);
+        //   void storeState(char *header, int head, int used);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING HEADER FUNCTIONS"
+                          << "\n========================" << endl;
+
+        const int CAPACITIES[] = { Util::k_MIN_CAPACITY,
+                                   Util::k_MIN_CAPACITY + 8,
+                                   1024 * 1024,
+                                   Util::k_MAX_CAPACITY };
+        const int NUM_CAPACITIES = static_cast<int>(sizeof CAPACITIES
+                                                    / sizeof *CAPACITIES);
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int   CAPACITY = CAPACITIES[ti];
+            const Int64 SIZE     = Util::k_HEADER_SIZE
+                                 + static_cast<Int64>(CAPACITY);
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            bsls::AlignedBuffer<Util::k_HEADER_SIZE, 8> header;
+            Util::initializeHeader(header.buffer(), CAPACITY);
+
+            int capacity = -1;
+            ASSERTV(CAPACITY, 0 != Util::validateHeader(&capacity,
+                                                        header.buffer(),
+                                                        SIZE - 1));
+            ASSERTV(CAPACITY, -1 == capacity);
+
+            ASSERTV(CAPACITY, 0 != Util::validateHeader(&capacity,
+                                                        header.buffer(),
+                                                        0));
+            ASSERTV(CAPACITY, -1 == capacity);
+
+            ASSERTV(CAPACITY, 0 == Util::validateHeader(&capacity,
+                                                        header.buffer(),
+                                                        SIZE));
+            ASSERTV(CAPACITY, CAPACITY == capacity);
+
+            ASSERTV(CAPACITY, 0 == Util::validateHeader(&capacity,
+                                                        header.buffer(),
+                                                        SIZE + 4096));
+
+            int head = -1;
+            int used = -1;
+            Util::loadState(&head, &used, header.buffer());
+            ASSERTV(CAPACITY, 0 == head);
+            ASSERTV(CAPACITY, 0 == used);
+
+            // Valid states.
+
+            const int STATES[][2] = { { 0,            CAPACITY     },
+                                      { CAPACITY - 8, 8            },
+                                      { CAPACITY - 8, CAPACITY     },
+                                      { 8,            CAPACITY - 8 } };
+
+            for (int si = 0; si < 4; ++si) {
+                const int HEAD = STATES[si][0];
+                const int USED = STATES[si][1];
+
+                Util::storeState(header.buffer(), HEAD, USED);
+                Util::loadState(&head, &used, header.buffer());
+
+                ASSERTV(CAPACITY, HEAD, head, HEAD == head);
+                ASSERTV(CAPACITY, USED, used, USED == used);
+                ASSERTV(CAPACITY, HEAD, USED,
+                        0 == Util::validateHeader(&capacity,
+                                                  header.buffer(),
+                                                  SIZE));
+            }
+
+            // Invalid states.
+
+            // The last state is not representable for the maximum capacity.
+
+            const bool IS_MAX = Util::k_MAX_CAPACITY == CAPACITY;
+
+            const int BAD_STATES[][2] = {
+                                      { CAPACITY, 0                        },
+                                      { 4,        8                        },
+                                      { 8,        12                       },
+                                      { 0,        IS_MAX ? 0 : CAPACITY + 8 }
+            };
+            const int NUM_BAD_STATES = IS_MAX ? 3 : 4;
+
+            for (int si = 0; si < NUM_BAD_STATES; ++si) {
+                const int HEAD = BAD_STATES[si][0];
+                const int USED = BAD_STATES[si][1];
+
+                Util::storeState(header.buffer(), HEAD, USED);
+
+                ASSERTV(CAPACITY, HEAD, USED,
+                        0 != Util::validateHeader(&capacity,
+                                                  header.buffer(),
+                                                  SIZE));
+            }
+
+            Util::storeState(header.buffer(), 0, 0);
+
+            // Corrupt fields: magic (0..7), version (8..11), byte order
+            // (12..15), header size (16..19), and capacity (20..23).  Bytes
+            // 21 and 22 are skipped, as flipping a bit of those bytes may
+            // yield a smaller capacity that is valid.
+
+            for (int offset = 0; offset < 24; ++offset) {
+                if (21 == offset || 22 == offset) {
+                    continue;
+                }
+
+                bsls::AlignedBuffer<Util::k_HEADER_SIZE, 8> corrupt;
+                bsl::memcpy(corrupt.buffer(),
+                            header.buffer(),
+                            Util::k_HEADER_SIZE);
+
+                // Flip a bit that changes the capacity by a non-multiple of
+                // the alignment, or out of range.
+
+                corrupt.buffer()[offset] ^= offset == 20 ? 0x04 : 0x80;
+
+                capacity = -1;
+                ASSERTV(CAPACITY, offset,
+                        0 != Util::validateHeader(&capacity,
+                                                  corrupt.buffer(),
+                                                  SIZE));
+                ASSERTV(CAPACITY, offset, -1 == capacity);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Initialize a header, encode a record and a wrap marker, and
+        //:   decode them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Buffer file;
+
+        Util::initializeHeader(file.buffer(), 2048);
+
+        int capacity;
+        ASSERT(0    == Util::validateHeader(&capacity, file.buffer(), 4096));
+        ASSERT(2048 == capacity);
+
+        char *ring = file.buffer() + Util::k_HEADER_SIZE;
+
+        ball::Record record(&ta);
+        setAttributes(&record,
+                      bdlt::EpochUtil::epoch(),
+                      1,
+                      2,
+                      "breathing.cpp",
+                      3,
+                      "BREATHING",
+                      ball::Severity::e_FATAL,
+                      "breathing test");
+
+        const int LENGTH = Util::encodeRecord(ring, record, 0, 2048);
+        ASSERT(LENGTH == Util::encodedLength(record, 2048));
+
+        Util::encodeWrapMarker(ring + LENGTH, 2048 - LENGTH);
+        Util::storeState(file.buffer(), 0, 2048);
+
+        int head;
+        int used;
+        Util::loadState(&head, &used, file.buffer());
+        ASSERT(0    == head);
+        ASSERT(2048 == used);
+
+        bool isWrapMarker;
+        ASSERT(LENGTH == Util::decodeFrameLength(&isWrapMarker, ring, 2048));
+        ASSERT(!isWrapMarker);
+
+        ASSERT(2048 - LENGTH == Util::decodeFrameLength(&isWrapMarker,
+                                                        ring + LENGTH,
+                                                        2048 - LENGTH));
+        ASSERT(isWrapMarker);
+
+        ball::Record decoded(&ta);
+        Uint64       sequenceNumber = 99;
+        ASSERT(0 == Util::decodeRecord(&decoded,
+                                       &sequenceNumber,
+                                       ring,
+                                       LENGTH));
+        ASSERT(0 == sequenceNumber);
+        ASSERT(record.fixedFields() == decoded.fixedFields());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -36,10 +36,20 @@ MultiplexObserver::~MultiplexObserver()
     BSLS_ASSERT(0 <= numRegisteredObservers());
 }
 
+// PRIVATE MANIPULATORS
+void MultiplexObserver::updateObserverList()
+{
+    ObserverList::Snapshot observers(d_observerSet.begin(),
+                                     d_observerSet.end(),
+                                     d_observerSet.get_allocator());
+
+    d_observerList.setObservers(observers);
+}
+
 // MANIPULATORS
 void MultiplexObserver::publish(const Record& record, const Context& context)
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    ObserverListGuard guard(&d_observerList);
 
     // Print warning once that this publish method is deprecated.
 
@@ -51,40 +61,44 @@ void MultiplexObserver::publish(const Record& record, const Context& context)
         needWarning = false;
     }
 
-    bsl::set<Observer *>::const_iterator it = d_observerSet.begin();
-    for (; it != d_observerSet.end(); ++it) {
-        (*it)->publish(record, context);
+    const int numObservers = guard.numObservers();
+
+    for (int i = 0; i < numObservers; ++i) {
+        guard.observer(i)->publish(record, context);
     }
 }
 
 void MultiplexObserver::publish(const bsl::shared_ptr<const Record>& record,
                                 const Context&                       context)
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    ObserverListGuard guard(&d_observerList);
+
+    const int numObservers = guard.numObservers();
 
-    bsl::set<Observer *>::const_iterator it = d_observerSet.begin();
-    for (; it != d_observerSet.end(); ++it) {
-        (*it)->publish(record, context);
+    for (int i = 0; i < numObservers; ++i) {
+        guard.observer(i)->publish(record, context);
     }
 }
 
 void MultiplexObserver::releaseRecords()
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    ObserverListGuard guard(&d_observerList);
 
-    bsl::set<Observer *>::const_iterator it = d_observerSet.begin();
+    const int numObservers = guard.numObservers();
+
+    for (int i = 0; i < numObservers; ++i) {
+        Observer *observer = guard.observer(i);
 
-    for (; it != d_observerSet.end(); ++it) {
         // TBD: Remove this test once the observer changes in BDE 2.12 have
         // stabilized.
 
-        if (0xdeadbeef == *((unsigned int*)(*it))) {
+        if (0xdeadbeef == *((unsigned int*)(observer))) {
             bsl::cerr << "ERROR: MultiplexObserver: "
                       << "Observer is destroyed before being deregistered."
                       << " [releaseRecords]" << bsl::endl;
         }
         else {
-            (*it)->releaseRecords();
+            observer->releaseRecords();
         }
     }
 }
@@ -96,7 +110,14 @@ int MultiplexObserver::registerObserver(Observer *observer)
     }
 
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
-    return !d_observerSet.insert(observer).second;
+
+    if (!d_observerSet.insert(observer).second) {
+        return 1;                                                     // RETURN
+    }
+
+    updateObserverList();
+
+    return 0;
 }
 
 int MultiplexObserver::deregisterObserver(Observer *observer)
@@ -111,6 +132,7 @@ int MultiplexObserver::deregisterObserver(Observer *observer)
 
     if (isRegistered) {
         d_observerSet.erase(observer);
+        updateObserverList();
         observer->releaseRecords();
     }
 
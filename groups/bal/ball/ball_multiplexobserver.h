@@ -49,7 +49,9 @@ BSLS_IDENT("$Id: $")
 ///-------------
 // 'ball::MultiplexObserver' is thread-safe and thread-enabled, meaning that
 // multiple threads may share the same instance, or may have their own
-// instances.
+// instances.  'publish' and 'releaseRecords' acquire no lock; they read the
+// registered observers from an immutable snapshot (see 'ball_observerlist')
+// that is replaced whenever an observer is registered or deregistered.
 //
 ///Usage
 ///-----
@@ -134,6 +136,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <ball_observer.h>
+#include <ball_observerlist.h>
 
 #include <bslma_allocator.h>
 
@@ -164,15 +167,26 @@ class MultiplexObserver : public Observer {
     // each registered observer.
 
     // DATA
-    bsl::set<Observer *>   d_observerSet;  // observer registry
+    bsl::set<Observer *>   d_observerSet;   // observer registry
 
-    mutable bslmt::RWMutex d_rwMutex;      // protects concurrent access to
-                                           // 'd_observerSet'
+    ObserverList           d_observerList;  // snapshot of 'd_observerSet',
+                                            // read by 'publish'
+
+    mutable bslmt::RWMutex d_rwMutex;       // protects concurrent access to
+                                            // 'd_observerSet'
 
     // NOT IMPLEMENTED
     MultiplexObserver(const MultiplexObserver&);
     MultiplexObserver& operator=(const MultiplexObserver&);
 
+    // PRIVATE MANIPULATORS
+    void updateObserverList();
+        // Replace the snapshot of registered observers read by 'publish' and
+        // 'releaseRecords' with the current contents of 'd_observerSet', and
+        // block until no concurrent call to those methods uses the previous
+        // snapshot.  The behavior is undefined unless the calling thread holds
+        // a write lock on 'd_rwMutex'.
+
   public:
     // CREATORS
     explicit MultiplexObserver(bslma::Allocator *basicAllocator = 0);
@@ -245,6 +259,7 @@ class MultiplexObserver : public Observer {
 inline
 MultiplexObserver::MultiplexObserver(bslma::Allocator *basicAllocator)
 : d_observerSet(basicAllocator)
+, d_observerList(basicAllocator)
 {
 }
 
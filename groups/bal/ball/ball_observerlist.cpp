@@ -0,0 +1,102 @@
+// ball_observerlist.cpp                                              -*-C++-*-
+#include <ball_observerlist.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_observerlist_cpp,"$Id$ $CSID$")
+
+#include <ball_observer.h>               // for testing only
+#include <ball_testobserver.h>           // for testing only
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                            // ------------------
+                            // class ObserverList
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+int ObserverList::slotIndex()
+{
+    // Thread identifiers are typically addresses, so use a multiplicative
+    // (Fibonacci) hash to spread the high-order bits over the slots.
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+
+    return static_cast<int>((id * 0x9E3779B97F4A7C15ULL)
+                                                 >> (64 - k_NUM_SLOTS_LOG2));
+}
+
+// CREATORS
+ObserverList::ObserverList(bslma::Allocator *basicAllocator)
+: d_snapshot_p(0)
+, d_epoch(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ObserverList::~ObserverList()
+{
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        BSLS_ASSERT(0 == d_slots[i].d_count[0].loadRelaxed());
+        BSLS_ASSERT(0 == d_slots[i].d_count[1].loadRelaxed());
+    }
+
+    d_allocator_p->deleteObject(d_snapshot_p.load());
+}
+
+// MANIPULATORS
+void ObserverList::setObservers(const Snapshot& observers)
+{
+    // An empty sequence is represented by a null snapshot, so that an empty
+    // list allocates no memory.
+
+    Snapshot *newSnapshot = observers.empty()
+                            ? 0
+                            : new (*d_allocator_p) Snapshot(observers,
+                                                            d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_updateMutex);
+
+    const Snapshot *oldSnapshot = d_snapshot_p.swap(newSnapshot);
+
+    // Readers that register after the epoch is incremented observe the new
+    // snapshot; readers that registered with the previous epoch may hold
+    // 'oldSnapshot', so wait for their counters to drain.  Readers of the
+    // epoch before that were drained by the preceding update.
+
+    const int parity = (d_epoch.add(1) - 1) & 1;
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        while (0 != d_slots[i].d_count[parity].load()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    d_allocator_p->deleteObject(oldSnapshot);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,367 @@
+// ball_observerlist.h                                                -*-C++-*-
+#ifndef INCLUDED_BALL_OBSERVERLIST
+#define INCLUDED_BALL_OBSERVERLIST
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a read-copy-update list of observers for lock-free fan-out.
+//
+//@CLASSES:
+//  ball::ObserverList: list of observer addresses updated by copy
+//  ball::ObserverListGuard: guard providing read access to an 'ObserverList'
+//
+//@SEE_ALSO: ball_broadcastobserver, ball_multiplexobserver
+//
+//@DESCRIPTION: This component provides a mechanism, 'ball::ObserverList',
+// that holds an immutable sequence ("snapshot") of the addresses of
+// 'ball::Observer' objects, and a guard, 'ball::ObserverListGuard', that
+// provides read access to the current snapshot of an 'ObserverList'.
+// 'ball::ObserverList' is intended for implementing observers that forward
+// each published record to a set of other observers (e.g.,
+// 'ball::BroadcastObserver'), where the set of observers changes rarely (e.g.,
+// only during start-up and shut-down), but records are published at a high
+// rate from many threads.
+//
+// The list is updated by *read-copy-update*: 'setObservers' creates a new
+// snapshot, atomically replaces the current snapshot with it, and then waits
+// until every guard that might refer to the previous snapshot has been
+// destroyed before reclaiming the previous snapshot.  Creating and destroying
+// an 'ObserverListGuard' acquires no lock and never waits for a writer.
+//
+// Note that, since 'setObservers' returns only after all readers of the
+// previous snapshot have released it, an observer removed from the list by
+// 'setObservers' is guaranteed to be no longer in use (through this list)
+// when 'setObservers' returns, and may then safely be destroyed.
+//
+///Implementation Notes
+///--------------------
+// A guard registers itself by incrementing one of a small number of reader
+// counters, selected by hashing the identifier of the calling thread, and
+// each of which resides on its own cache line.  Threads publishing
+// concurrently therefore typically modify distinct cache lines, avoiding the
+// contention on a single reader count that a reader-writer lock incurs.  Each
+// counter slot holds a pair of counters, indexed by the parity of an epoch
+// number that is incremented by each update; an update waits only for the
+// counters of the epoch that preceded it to drain.
+//
+///Thread Safety
+///-------------
+// 'ball::ObserverList' is fully thread-safe, meaning that all non-creator
+// methods can be invoked concurrently on the same instance from different
+// threads.  'setObservers' must not be called by a thread that holds an
+// 'ObserverListGuard' for the same list (it would wait for itself).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Forwarding a Record to a List of Observers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to forward log records to a set of observers that is
+// configured during program start-up.
+//
+// First, we create two test observers and an observer list referring to them:
+//..
+//  ball::TestObserver observer1(&bsl::cout);
+//  ball::TestObserver observer2(&bsl::cout);
+//
+//  bsl::vector<ball::Observer *> observers;
+//  observers.push_back(&observer1);
+//  observers.push_back(&observer2);
+//
+//  ball::ObserverList observerList;
+//  observerList.setObservers(observers);
+//..
+// Then, we forward a record to each observer in the list, as would be done
+// in the 'publish' method of a forwarding observer:
+//..
+//  bsl::shared_ptr<const ball::Record> record(new ball::Record());
+//  ball::Context                       context;
+//
+//  {
+//      ball::ObserverListGuard guard(&observerList);
+//
+//      for (int i = 0; i < guard.numObservers(); ++i) {
+//          guard.observer(i)->publish(record, context);
+//      }
+//  }
+//
+//  assert(1 == observer1.numPublishedRecords());
+//  assert(1 == observer2.numPublishedRecords());
+//..
+// Finally, we remove 'observer2' from the list.  When 'setObservers' returns,
+// no guard refers to 'observer2' any longer:
+//..
+//  observers.pop_back();
+//  observerList.setObservers(observers);
+//
+//  assert(1 == ball::ObserverListGuard(&observerList).numObservers());
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Observer;
+
+                      // ==============================
+                      // struct ObserverList_ReaderSlot
+                      // ==============================
+
+struct ObserverList_ReaderSlot {
+    // This component-private 'struct' holds the pair of reader counters,
+    // indexed by epoch parity, for one slot of an 'ObserverList'.  Each slot
+    // occupies (at least) a full cache line.
+
+    // DATA
+    bsls::AtomicInt d_count[2];  // number of active readers per epoch parity
+
+    char            d_pad[bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                2 * sizeof(bsls::AtomicInt)];
+                                 // padding to the size of a cache line
+};
+
+                            // ==================
+                            // class ObserverList
+                            // ==================
+
+class ObserverList {
+    // This class holds an immutable snapshot of a sequence of observer
+    // addresses that is replaced atomically by 'setObservers', and that is
+    // read, without locking, through an 'ObserverListGuard'.
+
+  public:
+    // TYPES
+    typedef bsl::vector<Observer *> Snapshot;
+        // 'Snapshot' is an alias for the type of an (immutable) sequence of
+        // observer addresses.
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_SLOTS_LOG2 = 4,                      // log2 of number of slots
+        k_NUM_SLOTS      = 1 << k_NUM_SLOTS_LOG2   // number of reader slots
+    };
+
+    // DATA
+    bsls::AtomicPointer<const Snapshot>
+                            d_snapshot_p;          // current snapshot
+                                                   // (owned), or 0 if empty
+
+    bsls::AtomicInt         d_epoch;               // incremented by each
+                                                   // update
+
+    char                    d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                   // separates the fields
+                                                   // above from 'd_slots'
+
+    mutable ObserverList_ReaderSlot
+                            d_slots[k_NUM_SLOTS];  // reader counters
+
+    bslmt::Mutex            d_updateMutex;         // serializes updates
+
+    bslma::Allocator       *d_allocator_p;         // memory allocator (held,
+                                                   // not owned)
+
+    // FRIENDS
+    friend class ObserverListGuard;
+
+    // NOT IMPLEMENTED
+    ObserverList(const ObserverList&);
+    ObserverList& operator=(const ObserverList&);
+
+    // PRIVATE CLASS METHODS
+    static int slotIndex();
+        // Return the index of the reader slot to be used by the calling
+        // thread.
+
+    // PRIVATE ACCESSORS
+    const Snapshot *acquireSnapshot(int *ticket) const;
+        // Register the calling thread as a reader of this list, load into the
+        // specified 'ticket' a value that identifies the registration, and
+        // return the address of the current snapshot, or 0 if this list is
+        // empty.  The returned snapshot remains valid until 'releaseSnapshot'
+        // is called with 'ticket'.
+
+    void releaseSnapshot(int ticket) const;
+        // Release the reader registration identified by the specified
+        // 'ticket', as loaded by a previous call to 'acquireSnapshot'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ObserverList, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ObserverList(bslma::Allocator *basicAllocator = 0);
+        // Create an empty observer list.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that an
+        // empty list allocates no memory.
+
+    ~ObserverList();
+        // Destroy this object.  The behavior is undefined unless no
+        // 'ObserverListGuard' refers to this list.
+
+    // MANIPULATORS
+    void setObservers(const Snapshot& observers);
+        // Replace the sequence of observer addresses held by this list with
+        // the specified 'observers', and block until no guard refers to the
+        // previous sequence.  The behavior is undefined if the calling thread
+        // holds an 'ObserverListGuard' referring to this list.
+};
+
+                         // =======================
+                         // class ObserverListGuard
+                         // =======================
+
+class ObserverListGuard {
+    // This class implements a guard that provides read access to the snapshot
+    // held by an 'ObserverList' at the time the guard is created.  The
+    // snapshot remains valid, and the observers it refers to are not removed
+    // by a concurrent 'setObservers', for the lifetime of the guard.
+
+    // DATA
+    const ObserverList           *d_list_p;      // guarded list
+    const ObserverList::Snapshot *d_snapshot_p;  // snapshot being read, or 0
+                                                 // if empty
+    int                           d_ticket;      // reader registration
+
+    // NOT IMPLEMENTED
+    ObserverListGuard(const ObserverListGuard&);
+    ObserverListGuard& operator=(const ObserverListGuard&);
+
+  public:
+    // CREATORS
+    explicit ObserverListGuard(const ObserverList *list);
+        // Create a guard providing read access to the current snapshot of the
+        // specified 'list'.
+
+    ~ObserverListGuard();
+        // Destroy this guard, releasing the snapshot that it provides access
+        // to.
+
+    // ACCESSORS
+    int numObservers() const;
+        // Return the number of observer addresses in the guarded snapshot.
+
+    Observer *observer(int index) const;
+        // Return the observer address at the specified 'index' in the guarded
+        // snapshot.  The behavior is undefined unless
+        // '0 <= index < numObservers()'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class ObserverList
+                            // ------------------
+
+// PRIVATE ACCESSORS
+inline
+const ObserverList::Snapshot *ObserverList::acquireSnapshot(int *ticket) const
+{
+    BSLS_ASSERT(ticket);
+
+    ObserverList_ReaderSlot& slot = d_slots[slotIndex()];
+
+    for (;;) {
+        const int epoch  = d_epoch.load();
+        const int parity = epoch & 1;
+
+        slot.d_count[parity].add(1);
+
+        if (epoch == d_epoch.load()) {
+            // No update has started since 'epoch' was loaded, so an update
+            // that replaces the snapshot loaded below will wait for this
+            // registration to be released.
+
+            *ticket = static_cast<int>(&slot - d_slots) * 2 + parity;
+            return d_snapshot_p.load();                               // RETURN
+        }
+
+        slot.d_count[parity].add(-1);
+    }
+}
+
+inline
+void ObserverList::releaseSnapshot(int ticket) const
+{
+    BSLS_ASSERT(0 <= ticket);
+    BSLS_ASSERT(ticket < 2 * k_NUM_SLOTS);
+
+    d_slots[ticket >> 1].d_count[ticket & 1].add(-1);
+}
+
+                         // -----------------------
+                         // class ObserverListGuard
+                         // -----------------------
+
+// CREATORS
+inline
+ObserverListGuard::ObserverListGuard(const ObserverList *list)
+: d_list_p(list)
+{
+    BSLS_ASSERT(list);
+
+    d_snapshot_p = d_list_p->acquireSnapshot(&d_ticket);
+}
+
+inline
+ObserverListGuard::~ObserverListGuard()
+{
+    d_list_p->releaseSnapshot(d_ticket);
+}
+
+// ACCESSORS
+inline
+int ObserverListGuard::numObservers() const
+{
+    return d_snapshot_p ? static_cast<int>(d_snapshot_p->size()) : 0;
+}
+
+inline
+Observer *ObserverListGuard::observer(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numObservers());
+
+    return (*d_snapshot_p)[index];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,772 @@
+// ball_observerlist.t.cpp                                            -*-C++-*-
+#include <ball_observerlist.h>
+
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_testobserver.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is a read-copy-update list of observer addresses,
+// and a guard providing read access to it.  We first verify the sequential
+// behavior of 'setObservers' and of the guard accessors, including memory
+// allocation.  We then verify, using several reader threads and a writer
+// thread, that an observer removed from the list is never accessed through a
+// guard after 'setObservers' returns.
+//
+// ObserverList
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ObserverList(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~ObserverList();
+//
+// MANIPULATORS
+// [ 2] void setObservers(const Snapshot& observers);
+// [ 3] void setObservers(const Snapshot& observers);
+//
+// ObserverListGuard
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ObserverListGuard(const ObserverList *list);
+// [ 2] ~ObserverListGuard();
+//
+// ACCESSORS
+// [ 2] int numObservers() const;
+// [ 2] Observer *observer(int index) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT READERS AND WRITER
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: GUARD VS. READER-WRITER LOCK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//              GLOBAL TYPES, CONSTANTS, AND VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+static int veryVeryVeryVerbose = 0;
+
+typedef ball::ObserverList      Obj;
+typedef ball::ObserverListGuard Guard;
+typedef Obj::Snapshot           Snapshot;
+
+namespace {
+
+class LivenessObserver : public ball::Observer {
+    // This observer counts the records published to it, and records an error
+    // if a record is published to it while it is not "live".
+
+    // DATA
+    bsls::AtomicInt d_isLive;         // 1 if observer may be used, else 0
+    bsls::AtomicInt d_numPublished;   // number of records published
+    bsls::AtomicInt d_numErrors;      // number of records published while
+                                      // not live
+
+  public:
+    // CREATORS
+    LivenessObserver()
+    : d_isLive(1)
+    , d_numPublished(0)
+    , d_numErrors(0)
+        // Create a live observer.
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>&,
+                         const ball::Context&)
+        // Count the record, and count an error if this observer is not live.
+    {
+        if (!d_isLive.load()) {
+            ++d_numErrors;
+        }
+        ++d_numPublished;
+    }
+
+    void setLive(bool value)
+        // Set whether this observer may be used to the specified 'value'.
+    {
+        d_isLive = value ? 1 : 0;
+    }
+
+    // ACCESSORS
+    int numErrors() const
+        // Return the number of records published while not live.
+    {
+        return d_numErrors.load();
+    }
+
+    int numPublished() const
+        // Return the number of records published to this observer.
+    {
+        return d_numPublished.load();
+    }
+};
+
+struct ReaderThread {
+    // This functor repeatedly publishes a record to each observer of an
+    // observer list, until signaled to stop.
+
+    // DATA
+    const Obj                           *d_list_p;  // list (held)
+    const bsls::AtomicInt               *d_done_p;  // stop flag (held)
+    bsl::shared_ptr<const ball::Record>  d_record;  // record to publish
+
+    // ACCESSORS
+    void operator()() const
+        // Publish records until '*d_done_p' is non-zero.
+    {
+        ball::Context context;
+
+        while (!d_done_p->load()) {
+            Guard guard(d_list_p);
+
+            for (int i = 0; i < guard.numObservers(); ++i) {
+                guard.observer(i)->publish(d_record, context);
+            }
+        }
+    }
+};
+
+struct UpdateThread {
+    // This functor sets the observers of an observer list, and verifies that
+    // 'setObservers' did not return before a flag was set.
+
+    // DATA
+    Obj                   *d_list_p;      // list (held, not owned)
+    const Snapshot        *d_snapshot_p;  // observers to set (held)
+    const bsls::AtomicInt *d_released_p;  // flag set before the guard
+                                          // blocking the update is released
+
+    // ACCESSORS
+    void operator()() const
+        // Set the observers of '*d_list_p' to '*d_snapshot_p', and verify
+        // that '*d_released_p' is non-zero on return.
+    {
+        d_list_p->setObservers(*d_snapshot_p);
+        ASSERT(1 == d_released_p->load());
+    }
+};
+
+struct GuardPerformanceThread {
+    // This functor creates and destroys a fixed number of guards on an
+    // observer list, and records the elapsed time.
+
+    // DATA
+    const Obj *d_list_p;          // list (held, not owned)
+    int        d_numIterations;   // number of guards to create
+    double    *d_elapsedTime_p;   // elapsed time (held, not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Create 'd_numIterations' guards and load the elapsed time into
+        // '*d_elapsedTime_p'.
+    {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < d_numIterations; ++i) {
+            Guard guard(d_list_p);
+            ASSERT(1 == guard.numObservers());
+        }
+        timer.stop();
+
+        *d_elapsedTime_p = timer.elapsedTime();
+    }
+};
+
+struct LockPerformanceThread {
+    // This functor acquires and releases a read lock on a reader-writer mutex
+    // a fixed number of times, and records the elapsed time.
+
+    // DATA
+    bslmt::ReaderWriterMutex *d_mutex_p;         // mutex (held, not owned)
+    int                       d_numIterations;   // number of locks
+    double                   *d_elapsedTime_p;   // elapsed time (held, not
+                                                 // owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Acquire 'd_numIterations' read locks and load the elapsed time into
+        // '*d_elapsedTime_p'.
+    {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < d_numIterations; ++i) {
+            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(d_mutex_p);
+        }
+        timer.stop();
+
+        *d_elapsedTime_p = timer.elapsedTime();
+    }
+};
+
+template <class FUNCTOR>
+double averageThreadTime(bsl::vector<FUNCTOR> *functors,
+                         bsl::vector<double>  *times)
+    // Run each of the specified 'functors' in its own thread, each of which
+    // loads its elapsed time into the corresponding element of the specified
+    // 'times', and return the average elapsed time.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(functors->size());
+
+    for (bsl::size_t i = 0; i < functors->size(); ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], (*functors)[i]));
+    }
+
+    double totalTime = 0;
+    for (bsl::size_t i = 0; i < functors->size(); ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        totalTime += (*times)[i];
+    }
+
+    return totalTime / static_cast<double>(functors->size());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose = (argc > 2);
+    veryVerbose = (argc > 3);
+    veryVeryVerbose = (argc > 4);
+    veryVeryVeryVerbose = (argc > 5);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ga("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&ga);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        bsl::ostream *stream = veryVerbose ? &cout : 0;
+        bsl::ostringstream discard;
+        if (!stream) {
+            stream = &discard;
+        }
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Forwarding a Record to a List of Observers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to forward log records to a set of observers that is
+// configured during program start-up.
+//
+// First, we create two test observers and an observer list referring to them:
+//..
+    ball::TestObserver observer1(stream);
+    ball::TestObserver observer2(stream);
+
+    bsl::vector<ball::Observer *> observers;
+    observers.push_back(&observer1);
+    observers.push_back(&observer2);
+
+    ball::ObserverList observerList;
+    observerList.setObservers(observers);
+//..
+// Then, we forward a record to each observer in the list, as would be done
+// in the 'publish' method of a forwarding observer:
+//..
+    bsl::shared_ptr<const ball::Record> record(new ball::Record());
+    ball::Context                       context;
+
+    {
+        ball::ObserverListGuard guard(&observerList);
+
+        for (int i = 0; i < guard.numObservers(); ++i) {
+            guard.observer(i)->publish(record, context);
+        }
+    }
+
+    ASSERT(1 == observer1.numPublishedRecords());
+    ASSERT(1 == observer2.numPublishedRecords());
+//..
+// Finally, we remove 'observer2' from the list.  When 'setObservers' returns,
+// no guard refers to 'observer2' any longer:
+//..
+    observers.pop_back();
+    observerList.setObservers(observers);
+
+    ASSERT(1 == ball::ObserverListGuard(&observerList).numObservers());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT READERS AND WRITER
+        //
+        // Concerns:
+        //: 1 An observer removed from the list by 'setObservers' is not
+        //:   accessed through any guard after 'setObservers' returns.
+        //:
+        //: 2 Observers that remain in the list continue to be accessed while
+        //:   the list is being updated.
+        //:
+        //: 3 No memory is leaked by repeated updates.
+        //
+        // Plan:
+        //: 1 Create several reader threads that repeatedly create a guard and
+        //:   publish a record to each observer in the guarded snapshot.
+        //:
+        //: 2 In the main thread, repeatedly add and remove an observer from
+        //:   the list; after each removal, mark the observer as not live.
+        //:   Verify that no observer counts a record published while it was
+        //:   not live, and that the permanent observer receives records.
+        //:   (C-1..2)
+        //:
+        //: 3 Verify that all memory is returned to the object allocator.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void setObservers(const Snapshot& observers);
+        //   CONCURRENT READERS AND WRITER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT READERS AND WRITER" << endl
+                                  << "=============================" << endl;
+
+        enum { k_NUM_READERS = 4, k_NUM_UPDATES = 2000 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        LivenessObserver permanent;
+        LivenessObserver transient;
+
+        {
+            Obj mX(&oa);
+
+            Snapshot withTransient;
+            withTransient.push_back(&permanent);
+            withTransient.push_back(&transient);
+
+            Snapshot withoutTransient;
+            withoutTransient.push_back(&permanent);
+
+            mX.setObservers(withoutTransient);
+
+            bsls::AtomicInt done(0);
+
+            bsl::shared_ptr<const ball::Record> record(new ball::Record());
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ReaderThread functor = { &mX, &done, record };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+            }
+
+            for (int i = 0; i < k_NUM_UPDATES; ++i) {
+                transient.setLive(true);
+                mX.setObservers(withTransient);
+
+                if (0 == i % 16) {
+                    bslmt::ThreadUtil::yield();
+                }
+
+                mX.setObservers(withoutTransient);
+                transient.setLive(false);
+            }
+
+            done = 1;
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            if (veryVerbose) {
+                P_(permanent.numPublished()) P(transient.numPublished());
+            }
+
+            ASSERTV(permanent.numErrors(), 0 == permanent.numErrors());
+            ASSERTV(transient.numErrors(), 0 == transient.numErrors());
+            ASSERT(0 < permanent.numPublished());
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SET OBSERVERS AND GUARD ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed list is empty, and allocates no memory.
+        //:
+        //: 2 A guard provides access to the observers most recently set, in
+        //:   the order in which they were supplied.
+        //:
+        //: 3 A guard continues to refer to the snapshot current at the time
+        //:   of its creation.
+        //:
+        //: 4 Setting an empty sequence releases all memory held by the list.
+        //:
+        //: 5 Memory is supplied by the object allocator, and the default
+        //:   allocator is not used.
+        //:
+        //: 6 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Construct a list with a test allocator, and verify that it is
+        //:   empty and that no memory is allocated.  (C-1)
+        //:
+        //: 2 For sequences of increasing length, set the sequence and verify
+        //:   the guard accessors.  (C-2, 5)
+        //:
+        //: 3 Verify that a guard created before a concurrent update (in
+        //:   another thread) still refers to the previous snapshot.  (C-3)
+        //:
+        //: 4 Set an empty sequence and verify that no memory is in use, then
+        //:   destroy a non-empty list and verify that no memory is in use.
+        //:   (C-4, 6)
+        //
+        // Testing:
+        //   explicit ObserverList(bslma::Allocator *basicAllocator = 0);
+        //   ~ObserverList();
+        //   void setObservers(const Snapshot& observers);
+        //   explicit ObserverListGuard(const ObserverList *list);
+        //   ~ObserverListGuard();
+        //   int numObservers() const;
+        //   Observer *observer(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "SET OBSERVERS AND GUARD ACCESSORS"
+                          << endl << "================================="
+                          << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { k_MAX_OBSERVERS = 8 };
+
+        LivenessObserver observers[k_MAX_OBSERVERS];
+
+        {
+            Obj mX(&oa);
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == Guard(&mX).numObservers());
+
+            for (int n = 1; n <= k_MAX_OBSERVERS; ++n) {
+                Snapshot snapshot(&oa);
+                for (int i = 0; i < n; ++i) {
+                    snapshot.push_back(&observers[(i * 3) % k_MAX_OBSERVERS]);
+                }
+
+                mX.setObservers(snapshot);
+
+                Guard guard(&mX);
+
+                ASSERTV(n, guard.numObservers(), n == guard.numObservers());
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, snapshot[i] == guard.observer(i));
+                }
+            }
+
+            if (verbose) cout << "\tTesting guard stability." << endl;
+            {
+                Snapshot one(&oa);
+                one.push_back(&observers[0]);
+
+                Snapshot two(&oa);
+                two.push_back(&observers[1]);
+                two.push_back(&observers[2]);
+
+                mX.setObservers(one);
+
+                bsls::AtomicInt           released(0);
+                bslmt::ThreadUtil::Handle handle;
+
+                {
+                    Guard guard(&mX);
+
+                    // 'setObservers' in the other thread blocks until
+                    // 'guard' is destroyed.
+
+                    UpdateThread functor = { &mX, &two, &released };
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle, functor));
+
+                    bslmt::ThreadUtil::microSleep(50000);
+
+                    ASSERT(1             == guard.numObservers());
+                    ASSERT(&observers[0] == guard.observer(0));
+
+                    released = 1;
+                }
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                Guard current(&mX);
+                ASSERT(2 == current.numObservers());
+            }
+
+            if (verbose) cout << "\tTesting empty sequence." << endl;
+
+            mX.setObservers(Snapshot(&oa));
+
+            ASSERT(0 == Guard(&mX).numObservers());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            Snapshot snapshot(&oa);
+            for (int i = 0; i < k_MAX_OBSERVERS; ++i) {
+                snapshot.push_back(&observers[i]);
+            }
+            mX.setObservers(snapshot);
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Set a list of two observers, publish a record through a guard,
+        //:   and remove one observer.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        LivenessObserver o1;
+        LivenessObserver o2;
+
+        Obj mX;
+
+        Snapshot observers;
+        observers.push_back(&o1);
+        observers.push_back(&o2);
+
+        mX.setObservers(observers);
+
+        bsl::shared_ptr<const ball::Record> record(new ball::Record());
+        ball::Context                       context;
+
+        {
+            Guard guard(&mX);
+            ASSERT(2 == guard.numObservers());
+
+            for (int i = 0; i < guard.numObservers(); ++i) {
+                guard.observer(i)->publish(record, context);
+            }
+        }
+
+        ASSERT(1 == o1.numPublished());
+        ASSERT(1 == o2.numPublished());
+
+        observers.pop_back();
+        mX.setObservers(observers);
+
+        {
+            Guard guard(&mX);
+            ASSERT(1   == guard.numObservers());
+            ASSERT(&o1 == guard.observer(0));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: GUARD VS. READER-WRITER LOCK
+        //
+        // Concerns:
+        //: 1 Creating and destroying a guard is cheaper than acquiring and
+        //:   releasing a read lock, in particular when several threads do so
+        //:   concurrently.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time a fixed number of guards, and
+        //:   the same number of read locks on a 'bslmt::ReaderWriterMutex',
+        //:   and report the average time per operation.  The number of
+        //:   iterations per thread can be specified as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: GUARD VS. READER-WRITER LOCK
+        // --------------------------------------------------------------------
+
+        cout << endl << "PERFORMANCE: GUARD VS. READER-WRITER LOCK" << endl
+                     << "=========================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+
+        LivenessObserver observer;
+
+        Snapshot snapshot;
+        snapshot.push_back(&observer);
+
+        Obj mX;
+        mX.setObservers(snapshot);
+
+        bslmt::ReaderWriterMutex mutex;
+
+        static const int THREADS[] = { 1, 2, 4, 8 };
+        const int NUM_THREADS = static_cast<int>(sizeof  THREADS
+                                                 / sizeof *THREADS);
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int NUM = THREADS[ti];
+
+            bsl::vector<double> guardTimes(NUM, 0.0);
+            bsl::vector<double> lockTimes(NUM, 0.0);
+
+            bsl::vector<GuardPerformanceThread> guards;
+            bsl::vector<LockPerformanceThread>  locks;
+            for (int i = 0; i < NUM; ++i) {
+                GuardPerformanceThread g = { &mX,
+                                             NUM_ITERATIONS,
+                                             &guardTimes[i] };
+                guards.push_back(g);
+
+                LockPerformanceThread l = { &mutex,
+                                            NUM_ITERATIONS,
+                                            &lockTimes[i] };
+                locks.push_back(l);
+            }
+
+            const double guardTime = averageThreadTime(&guards, &guardTimes);
+            const double lockTime  = averageThreadTime(&locks,  &lockTimes);
+
+            cout << "\t" << NUM << " thread(s): guard "
+                 << guardTime / NUM_ITERATIONS * 1e9 << " ns/op, lock "
+                 << lockTime  / NUM_ITERATIONS * 1e9 << " ns/op" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
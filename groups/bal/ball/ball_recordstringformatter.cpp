@@ -13,6 +13,19 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is compiled by 'compileFormat' into a sequence of
+// 'RecordStringFormatter_Instruction' objects.  Literal text, with escape
+// sequences already resolved, is stored contiguously in 'd_literals', and
+// adjacent literal text is merged into a single instruction, so 'operator()'
+// is a single pass over the instructions.
+//
+// Rendering a timestamp through 'bdlt::Datetime::printToBuffer' or
+// 'bdlt::Iso8601Util::generateRaw' dominates the cost of formatting a short
+// record.  Since consecutive records usually share the same second, the text
+// up to the whole second is cached in 'd_cache', guarded by 'd_cacheLock'.
+// The lock is only ever acquired with 'tryLock': a thread that finds the
+// cache in use formats the timestamp itself rather than wait.
 
 #include <ball_recordstringformatter.h>
 
@@ -30,11 +43,13 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
 
+#include <bsls_alignmentutil.h>
 #include <bsls_annotation.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -44,7 +59,6 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>   // for 'INT_MAX'
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -59,61 +73,75 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 namespace BloombergLP {
 
 // STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
+static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[16];
+    char  buffer[24];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%d", value);
+    do {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    result->append(begin, end);
 }
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
+static void appendToString(bsl::string *result, int value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%llu", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    if (value < 0) {
+        *result += '-';
+        appendToString(result,
+                       0 - static_cast<bsls::Types::Uint64>(
+                                        static_cast<bsls::Types::Int64>(value)));
+    }
+    else {
+        appendToString(result, static_cast<bsls::Types::Uint64>(value));
+    }
 }
 
 static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into hexadecimal and append it to the
     // specified 'result'.
 {
-    char buffer[32];
+    static const char k_HEX[] = "0123456789ABCDEF";
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    char  buffer[16];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
 
-    snprintf(buffer, sizeof(buffer), "%llX", value);
+    do {
+        *--begin = k_HEX[value & 0xF];
+        value >>= 4;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    result->append(begin, end);
+}
 
-    *result += buffer;
+static void appendDigits(bsl::string *result, int value, int numDigits)
+    // Append to the specified 'result' the specified 'numDigits' least
+    // significant decimal digits of the specified non-negative 'value',
+    // padded with leading zeros.
+{
+    char buffer[8];
+    for (int i = numDigits - 1; i >= 0; --i) {
+        buffer[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    result->append(buffer, numDigits);
+}
+
+static bdlt::Datetime truncateToSeconds(const bdlt::Datetime& value)
+    // Return the specified 'value' with its millisecond and microsecond
+    // attributes set to 0.
+{
+    bdlt::Datetime result(value);
+    result.setTime(value.hour(), value.minute(), value.second());
+    return result;
 }
 
 namespace ball {
@@ -130,18 +158,248 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    d_program.clear();
+    d_literals.clear();
+
+    // Reset the timestamp cache.  Note that the cache is not part of the
+    // value of this object, and is not used by the compilation itself.
+
+    d_cache.d_hasDatetime = false;
+    d_cache.d_hasIso8601  = false;
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    Instruction instruction;
+    instruction.d_offset = 0;
+    instruction.d_length = 0;
+
+    // Literal text is accumulated in 'd_literals', and the pending literal
+    // begins at 'literalBegin'.  Adjacent literal text (including escape
+    // sequences and unrecognized conversion specifications) is merged into a
+    // single 'e_LITERAL' instruction.
+
+    bsl::size_t literalBegin = 0;
+
+    while (iter != end) {
+        Instruction::Opcode opcode = Instruction::e_LITERAL;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': d_literals += '%';                              break;
+              case 'd': opcode = Instruction::e_DATETIME_MS;            break;
+              case 'D': opcode = Instruction::e_DATETIME_US;            break;
+              case 'i': opcode = Instruction::e_ISO8601;                break;
+              case 'I': opcode = Instruction::e_ISO8601_MS;             break;
+              case 'O': opcode = Instruction::e_ISO8601_US;             break;
+              case 'p': opcode = Instruction::e_PROCESS_ID;             break;
+              case 't': opcode = Instruction::e_THREAD_ID;              break;
+              case 'T': opcode = Instruction::e_THREAD_ID_HEX;          break;
+              case 's': opcode = Instruction::e_SEVERITY;               break;
+              case 'f': opcode = Instruction::e_FILENAME;               break;
+              case 'F': opcode = Instruction::e_FILENAME_BASE;          break;
+              case 'l': opcode = Instruction::e_LINE_NUMBER;            break;
+              case 'c': opcode = Instruction::e_CATEGORY;               break;
+              case 'm': opcode = Instruction::e_MESSAGE;                break;
+              case 'x': opcode = Instruction::e_MESSAGE_PRINTABLE;      break;
+              case 'X': opcode = Instruction::e_MESSAGE_HEX;            break;
+              case 'u': opcode = Instruction::e_USER_FIELDS;            break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '%';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                d_literals += '\n';
+              } break;
+              case 't': {
+                d_literals += '\t';
+              } break;
+              case '\\': {
+                d_literals += '\\';
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '\\';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            d_literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (Instruction::e_LITERAL != opcode) {
+            if (literalBegin != d_literals.length()) {
+                instruction.d_opcode = Instruction::e_LITERAL;
+                instruction.d_offset = static_cast<int>(literalBegin);
+                instruction.d_length = static_cast<int>(d_literals.length() -
+                                                        literalBegin);
+                d_program.push_back(instruction);
+                literalBegin = d_literals.length();
+            }
+            instruction.d_opcode = opcode;
+            instruction.d_offset = 0;
+            instruction.d_length = 0;
+            d_program.push_back(instruction);
+        }
+    }
+
+    if (literalBegin != d_literals.length()) {
+        instruction.d_opcode = Instruction::e_LITERAL;
+        instruction.d_offset = static_cast<int>(literalBegin);
+        instruction.d_length = static_cast<int>(d_literals.length() -
+                                                literalBegin);
+        d_program.push_back(instruction);
+    }
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::appendDatetime(
+                                     bsl::string           *output,
+                                     const bdlt::Datetime&  timestamp,
+                                     int                    precision) const
+{
+    const bdlt::Datetime key = truncateToSeconds(timestamp);
+
+    if (0 == d_cacheLock.tryLock()) {
+        if (!d_cache.d_hasDatetime || d_cache.d_datetime != key) {
+            d_cache.d_datetimeLength = key.printToBuffer(
+                                               d_cache.d_datetimeText,
+                                               TimestampCache::k_BUFFER_SIZE,
+                                               0);
+            d_cache.d_datetime    = key;
+            d_cache.d_hasDatetime = true;
+        }
+        output->append(d_cache.d_datetimeText, d_cache.d_datetimeLength);
+        d_cacheLock.unlock();
+    }
+    else {
+        // Another thread is using the cache: format without it.
+
+        char buffer[TimestampCache::k_BUFFER_SIZE];
+        const int length = key.printToBuffer(buffer, sizeof buffer, 0);
+        output->append(buffer, length);
+    }
+
+    *output += '.';
+    if (3 == precision) {
+        appendDigits(output, timestamp.millisecond(), 3);
+    }
+    else {
+        appendDigits(output,
+                     timestamp.millisecond() * 1000 + timestamp.microsecond(),
+                     6);
+    }
+}
+
+void RecordStringFormatter::appendIso8601(
+                               bsl::string           *output,
+                               const bdlt::Datetime&  timestamp,
+                               int                    offsetInMinutes,
+                               int                    precision) const
+{
+    // The ISO 8601 text is composed of the (19 character) date and time up to
+    // whole seconds, the optional fractional seconds, and the time zone
+    // designator.  The cached text (which has no fractional seconds) is split
+    // after the seconds field to insert the fractional seconds.
+
+    enum { k_DECIMAL_SIGN_OFFSET = 19 };
+
+    const bdlt::Datetime key = truncateToSeconds(timestamp);
+
+    char        buffer[TimestampCache::k_BUFFER_SIZE];
+    const char *text;
+    int         length;
+
+    const bool locked = 0 == d_cacheLock.tryLock();
+
+    if (locked && d_cache.d_hasIso8601
+               && d_cache.d_iso8601       == key
+               && d_cache.d_iso8601Offset == offsetInMinutes) {
+        text   = d_cache.d_iso8601Text;
+        length = d_cache.d_iso8601Length;
+    }
+    else {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(0);
+        config.setUseZAbbreviationForUtc(true);
+
+        char *target = locked ? d_cache.d_iso8601Text : buffer;
+
+        length = bdlt::Iso8601Util::generateRaw(
+                                   target,
+                                   bdlt::DatetimeTz(key, offsetInMinutes),
+                                   config);
+        text = target;
+
+        if (locked) {
+            d_cache.d_iso8601       = key;
+            d_cache.d_iso8601Offset = offsetInMinutes;
+            d_cache.d_iso8601Length = length;
+            d_cache.d_hasIso8601    = true;
+        }
+    }
+
+    output->append(text, k_DECIMAL_SIGN_OFFSET);
+    if (3 == precision) {
+        *output += '.';
+        appendDigits(output, timestamp.millisecond(), 3);
+    }
+    else if (6 == precision) {
+        *output += '.';
+        appendDigits(output,
+                     timestamp.millisecond() * 1000 + timestamp.microsecond(),
+                     6);
+    }
+    output->append(text + k_DECIMAL_SIGN_OFFSET,
+                   length - k_DECIMAL_SIGN_OFFSET);
+
+    if (locked) {
+        d_cacheLock.unlock();
+    }
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -149,7 +407,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -163,7 +425,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -172,7 +438,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -187,7 +457,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -195,7 +469,12 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_program(original.d_program, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    d_cache.d_hasDatetime = false;
+    d_cache.d_hasIso8601  = false;
 }
 
 // MANIPULATORS
@@ -205,11 +484,19 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_program         = rhs.d_program;
+        d_literals        = rhs.d_literals;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
@@ -229,13 +516,9 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
         offset = d_timestampOffset;
     }
 
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
-
-    // Step through the format string, outputting the required elements.
-
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+    const bdlt::Datetime timestamp       = fixedFields.timestamp() + offset;
+    const int            offsetInMinutes = static_cast<int>(
+                                                        offset.totalMinutes());
 
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
@@ -251,173 +534,109 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'O': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
+    // Run the compiled format specification.
 
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+    const Instruction *iter = d_program.data();
+    const Instruction *end  = iter + d_program.size();
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
-
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
-
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
-
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
-
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 'T': {
-                appendToStringAsHex(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
+    for (; iter != end; ++iter) {
+        switch (iter->d_opcode) {
+          case Instruction::e_LITERAL: {
+            output.append(d_literals.data() + iter->d_offset,
+                          iter->d_length);
+          } break;
+          case Instruction::e_DATETIME_MS: {
+            appendDatetime(&output, timestamp, 3);
+          } break;
+          case Instruction::e_DATETIME_US: {
+            appendDatetime(&output, timestamp, 6);
+          } break;
+          case Instruction::e_ISO8601: {
+            appendIso8601(&output, timestamp, offsetInMinutes, 0);
+          } break;
+          case Instruction::e_ISO8601_MS: {
+            appendIso8601(&output, timestamp, offsetInMinutes, 3);
+          } break;
+          case Instruction::e_ISO8601_US: {
+            appendIso8601(&output, timestamp, offsetInMinutes, 6);
+          } break;
+          case Instruction::e_PROCESS_ID: {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case Instruction::e_THREAD_ID: {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case Instruction::e_THREAD_ID_HEX: {
+            appendToStringAsHex(&output, fixedFields.threadID());
+          } break;
+          case Instruction::e_SEVERITY: {
+            output += Severity::toAscii(
                                  (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+          } break;
+          case Instruction::e_FILENAME: {
+            output += fixedFields.fileName();
+          } break;
+          case Instruction::e_FILENAME_BASE: {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output += filename;
+            }
+            else {
+                output.append(filename.data() + rightmostSlashIndex + 1,
+                              filename.length() - rightmostSlashIndex - 1);
+            }
+          } break;
+          case Instruction::e_LINE_NUMBER: {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case Instruction::e_CATEGORY: {
+            output += fixedFields.category();
+          } break;
+          case Instruction::e_MESSAGE: {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(), message.length());
+          } break;
+          case Instruction::e_MESSAGE_PRINTABLE: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    length,
+                                    false);
+            output += ss.str();
+          } break;
+          case Instruction::e_MESSAGE_HEX: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          length);
+            output += ss.str();
           } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+          case Instruction::e_USER_FIELDS: {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output += ss.str();
             }
-            ++iter;
           } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
         }
     }
 
@@ -93,6 +93,19 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// A record formatter compiles its format specification, when the
+// specification is supplied (at construction or by 'setFormat'), into a
+// sequence of formatting instructions, so that formatting a record does not
+// re-interpret the format specification.  In addition, a record formatter
+// caches the text of the most recently formatted timestamp, truncated to
+// whole seconds, for each of the timestamp formats; records logged within
+// the same second therefore render their timestamps by copying the cached
+// text and appending the fractional seconds.  The cache is shared by the
+// threads using the same formatter, and is bypassed (rather than waited on)
+// by a thread that finds it in use by another thread.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -131,13 +144,18 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlt_datetimeinterval.h>
 
+#include <bdlt_datetime.h>
+
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_spinlock.h>
+
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -148,6 +166,71 @@ namespace ball {
 
 class Record;
 
+                 // =========================================
+                 // struct RecordStringFormatter_Instruction
+                 // =========================================
+
+struct RecordStringFormatter_Instruction {
+    // This component-private 'struct' describes one step of a compiled
+    // format specification: either the output of a field of a record, or the
+    // output of a literal substring of the format specification.
+
+    // TYPES
+    enum Opcode {
+        e_LITERAL,             // literal text
+        e_DATETIME_MS,         // '%d'
+        e_DATETIME_US,         // '%D'
+        e_ISO8601,             // '%i'
+        e_ISO8601_MS,          // '%I'
+        e_ISO8601_US,          // '%O'
+        e_PROCESS_ID,          // '%p'
+        e_THREAD_ID,           // '%t'
+        e_THREAD_ID_HEX,       // '%T'
+        e_SEVERITY,            // '%s'
+        e_FILENAME,            // '%f'
+        e_FILENAME_BASE,       // '%F'
+        e_LINE_NUMBER,         // '%l'
+        e_CATEGORY,            // '%c'
+        e_MESSAGE,             // '%m'
+        e_MESSAGE_PRINTABLE,   // '%x'
+        e_MESSAGE_HEX,         // '%X'
+        e_USER_FIELDS          // '%u'
+    };
+
+    // DATA
+    Opcode d_opcode;  // operation to perform
+    int    d_offset;  // offset of the literal text ('e_LITERAL' only)
+    int    d_length;  // length of the literal text ('e_LITERAL' only)
+};
+
+                 // ============================================
+                 // struct RecordStringFormatter_TimestampCache
+                 // ============================================
+
+struct RecordStringFormatter_TimestampCache {
+    // This component-private 'struct' holds the text of the most recently
+    // formatted timestamp, truncated to whole seconds, in each of the
+    // timestamp formats supported by 'RecordStringFormatter'.
+
+    // PUBLIC CONSTANTS
+    enum { k_BUFFER_SIZE = 40 };  // size of each text buffer
+
+    // DATA
+    bool           d_hasDatetime;   // 'true' if 'd_datetimeText' is valid
+    bdlt::Datetime d_datetime;      // key of 'd_datetimeText'
+    int            d_datetimeLength;
+    char           d_datetimeText[k_BUFFER_SIZE];
+                                    // 'DDMonYYYY_HH:MM:SS' text
+
+    bool           d_hasIso8601;    // 'true' if 'd_iso8601Text' is valid
+    bdlt::Datetime d_iso8601;       // key of 'd_iso8601Text' (with
+    int            d_iso8601Offset; // 'd_iso8601Offset')
+    int            d_iso8601Length;
+    char           d_iso8601Text[k_BUFFER_SIZE];
+                                    // ISO 8601 text without fractional
+                                    // seconds
+};
+
                         // ===========================
                         // class RecordStringFormatter
                         // ===========================
@@ -177,9 +260,46 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    typedef RecordStringFormatter_Instruction    Instruction;
+    typedef RecordStringFormatter_TimestampCache TimestampCache;
+
     // DATA
-    bsl::string            d_formatSpec;       // 'printf'-style format spec.
-    bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
+    bsl::string                  d_formatSpec;       // 'printf'-style format
+                                                     // spec.
+
+    bdlt::DatetimeInterval       d_timestampOffset;  // offset added to
+                                                     // timestamps
+
+    bsl::vector<Instruction>     d_program;          // compiled format spec.
+
+    bsl::string                  d_literals;         // literal text referred
+                                                     // to by 'd_program'
+
+    mutable bsls::SpinLock       d_cacheLock;        // guards 'd_cache'
+
+    mutable TimestampCache       d_cache;            // cached timestamp text
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Compile 'd_formatSpec' into 'd_program' and 'd_literals'.
+
+    // PRIVATE ACCESSORS
+    void appendDatetime(bsl::string           *output,
+                        const bdlt::Datetime&  timestamp,
+                        int                    precision) const;
+        // Append to the specified 'output' the specified 'timestamp' in the
+        // 'DDMonYYYY_HH:MM:SS' format followed by the specified 'precision'
+        // (either 3 or 6) fractional second digits.
+
+    void appendIso8601(bsl::string           *output,
+                       const bdlt::Datetime&  timestamp,
+                       int                    offsetInMinutes,
+                       int                    precision) const;
+        // Append to the specified 'output' the specified 'timestamp' having
+        // the specified 'offsetInMinutes' from UTC in the ISO 8601 format
+        // having the specified 'precision' (0, 3, or 6) fractional second
+        // digits.
 
   public:
     // TRAITS
@@ -355,12 +475,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -20,6 +20,8 @@
 
 #include <bslmt_threadutil.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -89,6 +91,8 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+// [-1] PERFORMANCE: RECORDS PER SECOND PER THREAD
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -246,6 +250,54 @@ bool compareText(bslstl::StringRef lhs, bslstl::StringRef rhs)
 
 namespace {
 
+class NullStreamBuf : public bsl::streambuf {
+    // This class implements a stream buffer that discards its output.
+
+  protected:
+    // MANIPULATORS
+    virtual int_type overflow(int_type c)
+        // Discard the specified 'c' and return a value other than 'eof'.
+    {
+        return traits_type::not_eof(c);
+    }
+
+    virtual bsl::streamsize xsputn(const char *, bsl::streamsize numChars)
+        // Discard the specified 'numChars' characters and return
+        // 'numChars'.
+    {
+        return numChars;
+    }
+};
+
+struct PerformanceThread {
+    // This functor formats a record a fixed number of times using a shared
+    // formatter, and records the elapsed time.
+
+    // DATA
+    const Obj *d_formatter_p;    // formatter (held, not owned)
+    const Rec *d_record_p;       // record (held, not owned)
+    int        d_numRecords;     // number of records to format
+    double    *d_elapsedTime_p;  // elapsed time (held, not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Format the record 'd_numRecords' times, and load the elapsed time
+        // into '*d_elapsedTime_p'.
+    {
+        NullStreamBuf nullBuf;
+        bsl::ostream  stream(&nullBuf);
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < d_numRecords; ++i) {
+            (*d_formatter_p)(stream, *d_record_p);
+        }
+        timer.stop();
+
+        *d_elapsedTime_p = timer.elapsedTime();
+    }
+};
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -263,6 +315,159 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+        //
+        // Concerns:
+        //: 1 Literal text, escape sequences, and unrecognized conversion
+        //:   specifications are output as they were before the format
+        //:   specification was compiled.
+        //:
+        //: 2 'setFormat' recompiles the format specification.
+        //:
+        //: 3 Timestamps are rendered correctly whether or not they share the
+        //:   second (and local time offset) of the previously formatted
+        //:   record.
+        //
+        // Plan:
+        //: 1 Format records using a table of format specifications containing
+        //:   literal text, and compare against expected output.  (C-1..2)
+        //:
+        //: 2 Format a sequence of records having timestamps that alternate
+        //:   between identical seconds, different seconds, and different
+        //:   offsets, and compare each output against a timestamp rendered
+        //:   directly by 'bdlt'.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: COMPILED FORMAT AND TIMESTAMP CACHE"
+                          << "\n============================================"
+                          << endl;
+
+        if (verbose) cout << "\tLiteral text." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  FORMAT                 EXPECTED
+                //----  ---------------------  -----------------------
+                { L_,   "",                    ""                      },
+                { L_,   "abc",                 "abc"                   },
+                { L_,   "%%",                  "%"                     },
+                { L_,   "%",                   ""                      },
+                { L_,   "\\",                  ""                      },
+                { L_,   "a%%b%l",              "a%b42"                 },
+                { L_,   "%l%l",                "4242"                  },
+                { L_,   "x%qy",                "x%qy"                  },
+                { L_,   "\\n\\t\\\\\\q",         "\n\t\\\\q"             },
+                { L_,   "<%c>\\n",             "<CAT>\n"               },
+                { L_,   "%m:%l:%m",            "msg:42:msg"            },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Rec record;
+            record.fixedFields().setLineNumber(42);
+            record.fixedFields().setCategory("CAT");
+            record.fixedFields().setMessage("msg");
+
+            Obj mY;  const Obj& Y = mY;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *FORMAT   = DATA[ti].d_format;
+                const char *EXPECTED = DATA[ti].d_expected;
+
+                const Obj X(FORMAT);
+
+                ostringstream os;
+                X(os, record);
+                ASSERTV(LINE, os.str(), EXPECTED == os.str());
+
+                mY.setFormat(FORMAT);
+
+                ostringstream os2;
+                Y(os2, record);
+                ASSERTV(LINE, os2.str(), EXPECTED == os2.str());
+            }
+        }
+
+        if (verbose) cout << "\tTimestamp cache." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_second;
+                int d_millisecond;
+                int d_microsecond;
+                int d_offset;        // in minutes
+            } DATA[] = {
+                //LINE  SEC  MSEC  USEC  OFFSET
+                //----  ---  ----  ----  ------
+                { L_,     1,    0,    0,      0 },
+                { L_,     1,    1,    2,      0 },
+                { L_,     1,  999,  999,      0 },
+                { L_,     2,    5,    0,      0 },
+                { L_,     2,    5,    0,     60 },
+                { L_,     2,    6,    0,     60 },
+                { L_,     2,    6,    0,    -90 },
+                { L_,     1,    7,    8,    -90 },
+                { L_,     1,    7,    8,      0 },
+                { L_,    59,  123,  456,      0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Obj mX("%d|%D|%i|%I|%O");  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int SEC    = DATA[ti].d_second;
+                const int MSEC   = DATA[ti].d_millisecond;
+                const int USEC   = DATA[ti].d_microsecond;
+                const int OFFSET = DATA[ti].d_offset;
+
+                const bdlt::Datetime UTC(2017, 12, 31, 23, 59, SEC, MSEC, USEC);
+
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                Rec record;
+                record.fixedFields().setTimestamp(UTC);
+
+                ostringstream os;
+                X(os, record);
+
+                const bdlt::Datetime   LOCAL = UTC +
+                                         bdlt::DatetimeInterval(0, 0, OFFSET);
+                const bdlt::DatetimeTz TZ(LOCAL, OFFSET);
+
+                char buffer[64];
+                bsl::string expected;
+
+                LOCAL.printToBuffer(buffer, sizeof buffer, 3);
+                expected += buffer;
+                expected += '|';
+                LOCAL.printToBuffer(buffer, sizeof buffer, 6);
+                expected += buffer;
+
+                for (int precision = 0; precision <= 6; precision += 3) {
+                    bdlt::Iso8601UtilConfiguration config;
+                    config.setFractionalSecondPrecision(precision);
+                    config.setUseZAbbreviationForUtc(true);
+
+                    int length = bdlt::Iso8601Util::generateRaw(buffer,
+                                                                TZ,
+                                                                config);
+                    expected += '|';
+                    expected.append(buffer, length);
+                }
+
+                ASSERTV(LINE, os.str(), expected, expected == os.str());
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -1771,6 +1976,88 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RECORDS PER SECOND PER THREAD
+        //
+        // Concerns:
+        //: 1 This test measures the number of records per second that can be
+        //:   formatted by each of a number of threads sharing a formatter,
+        //:   making it possible to compare the performance of different
+        //:   implementations.
+        //
+        // Plan:
+        //: 1 For 1, 2, and 4 threads, have each thread format a typical
+        //:   record (having the default format specification) a large number
+        //:   of times to a stream that discards its output, and report the
+        //:   number of records formatted per second by each thread.  Then
+        //:   repeat using an ISO 8601 format specification.
+        //
+        // Testing:
+        //   PERFORMANCE: RECORDS PER SECOND PER THREAD
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: RECORDS PER SECOND PER THREAD"
+             << "\n=========================================="
+             << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        Rec record;
+        record.fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+        record.fixedFields().setProcessID(2040);
+        record.fixedFields().setThreadID(17);
+        record.fixedFields().setSeverity(ball::Severity::e_WARN);
+        record.fixedFields().setFileName("subdir/process.cpp");
+        record.fixedFields().setLineNumber(542);
+        record.fixedFields().setCategory("FOO.BAR.BAZ");
+        record.fixedFields().setMessage("An ordinary log message of "
+                                        "typical length.");
+
+        static const char *const FORMATS[] = {
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "%I %p:%t %s %F:%l %c %m\n",
+        };
+        const int NUM_FORMATS = static_cast<int>(sizeof  FORMATS
+                                                 / sizeof *FORMATS);
+
+        static const int THREADS[] = { 1, 2, 4 };
+        const int NUM_THREADS = static_cast<int>(sizeof  THREADS
+                                                 / sizeof *THREADS);
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj X(FORMATS[fi]);
+
+            cout << "Format: \"" << X.format() << '"' << endl;
+
+            for (int ti = 0; ti < NUM_THREADS; ++ti) {
+                const int NUM = THREADS[ti];
+
+                bsl::vector<double>                    times(NUM, 0.0);
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM);
+
+                for (int i = 0; i < NUM; ++i) {
+                    PerformanceThread functor = { &X,
+                                                  &record,
+                                                  NUM_RECORDS,
+                                                  &times[i] };
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          functor));
+                }
+
+                double totalTime = 0;
+                for (int i = 0; i < NUM; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                    totalTime += times[i];
+                }
+
+                cout << "\t" << NUM << " thread(s): "
+                     << static_cast<bsls::Types::Int64>(
+                                           NUM_RECORDS / (totalTime / NUM))
+                     << " records/sec/thread" << endl;
+            }
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
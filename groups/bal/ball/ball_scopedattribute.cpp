@@ -40,6 +40,13 @@ ScopedAttribute_Container::print(bsl::ostream& stream,
     return stream;
 }
 
+bool ScopedAttribute_Container::visitAttributes(
+                 const bsl::function<void(const Attribute&)>& visitor) const
+{
+    visitor(d_attribute);
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -114,6 +114,11 @@ class ScopedAttribute_Container : public AttributeContainer {
         // negative, format the entire output on one line, suppressing all but
         // the initial indentation (as governed by 'level').  If 'stream' is
         // not valid on entry, this operation has no effect.
+
+    virtual bool visitAttributes(
+         const bsl::function<void(const Attribute&)>& visitor) const;
+        // Invoke the specified 'visitor' function for the single attribute in
+        // this container, and return 'true'.
 };
 
                          // =====================
@@ -0,0 +1,574 @@
+// ball_structuredrecordformatter.cpp                                 -*-C++-*-
+
+///Implementation Notes
+///--------------------
+// All output is appended directly to the caller-supplied string: integers are
+// converted into small stack buffers, and strings are escaped by appending
+// maximal runs of characters that need no escaping, so that no temporary
+// 'bsl::string' (or 'bsl::stringstream') objects are created while formatting
+// a record.  Attributes are collected by visiting the attribute containers of
+// the calling thread's 'AttributeContext' with a functor that holds only two
+// pointers, which fits in the small-object buffer of 'bsl::function' and so
+// does not allocate.
+
+#include <ball_structuredrecordformatter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_structuredrecordformatter_cpp,"$Id$ $CSID$")
+
+#include <ball_attribute.h>
+#include <ball_attributecontainerlist.h>
+#include <ball_attributecontext.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+#include <ball_userfieldvalue.h>
+
+#include <bdlb_float.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_localtimeoffset.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_c_stdio.h>   // for 'snprintf'
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+                         // ----------------------
+                         // local helper functions
+                         // ----------------------
+
+void appendUint64(bsl::string *output, Uint64 value)
+    // Append the decimal representation of the specified 'value' to the
+    // specified 'output'.
+{
+    char  buffer[24];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
+
+    do {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+
+    output->append(begin, end);
+}
+
+void appendInt64(bsl::string *output, Int64 value)
+    // Append the decimal representation of the specified 'value' to the
+    // specified 'output'.
+{
+    if (value < 0) {
+        *output += '-';
+        appendUint64(output, 0 - static_cast<Uint64>(value));
+    }
+    else {
+        appendUint64(output, static_cast<Uint64>(value));
+    }
+}
+
+void appendEscaped(bsl::string *output, const char *data, bsl::size_t length)
+    // Append the specified 'data' having the specified 'length' to the
+    // specified 'output', escaping '"', '\', and control characters as
+    // required for the body of a JSON string.  Note that non-ASCII bytes are
+    // copied verbatim.
+{
+    static const char k_HEX[] = "0123456789abcdef";
+
+    const char *runBegin = data;
+    const char *end      = data + length;
+
+    for (const char *p = data; p != end; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c >= 0x20 && '"' != c && '\\' != c) {
+            continue;                                               // CONTINUE
+        }
+
+        output->append(runBegin, p);
+        runBegin = p + 1;
+
+        switch (c) {
+          case '"':  output->append("\\\"", 2); break;
+          case '\\': output->append("\\\\", 2); break;
+          case '\n': output->append("\\n",  2); break;
+          case '\r': output->append("\\r",  2); break;
+          case '\t': output->append("\\t",  2); break;
+          case '\b': output->append("\\b",  2); break;
+          case '\f': output->append("\\f",  2); break;
+          default: {
+            char escape[6] = { '\\', 'u', '0', '0', k_HEX[c >> 4],
+                                                    k_HEX[c & 0xF] };
+            output->append(escape, sizeof escape);
+          }
+        }
+    }
+    output->append(runBegin, end);
+}
+
+bool needsLogfmtQuoting(const char *data, bsl::size_t length)
+    // Return 'true' if the specified 'data' having the specified 'length'
+    // must be quoted to be used as a logfmt key or value, and 'false'
+    // otherwise.
+{
+    if (0 == length) {
+        return true;                                                  // RETURN
+    }
+    for (const char *p = data; p != data + length; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c <= ' ' || '=' == c || '"' == c || '\\' == c) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+                          // ===================
+                          // class RecordEmitter
+                          // ===================
+
+class RecordEmitter {
+    // This class appends the keys and values of a single record to a string
+    // in either the JSON or the logfmt style.
+
+    // DATA
+    bsl::string *d_output_p;  // output (held, not owned)
+    bool         d_isJson;    // 'true' for JSON, 'false' for logfmt
+    bool         d_isFirst;   // 'true' until the first member is written
+
+  public:
+    // CREATORS
+    RecordEmitter(bsl::string *output, bool isJson)
+        // Create an emitter appending to the specified 'output' in JSON if
+        // the specified 'isJson' is 'true', and in logfmt otherwise.
+    : d_output_p(output)
+    , d_isJson(isJson)
+    , d_isFirst(true)
+    {
+    }
+
+    // MANIPULATORS
+    void beginRecord()
+        // Begin the output of a record.
+    {
+        if (d_isJson) {
+            *d_output_p += '{';
+        }
+        d_isFirst = true;
+    }
+
+    void endRecord()
+        // Complete the output of a record.
+    {
+        if (d_isJson) {
+            *d_output_p += '}';
+        }
+        *d_output_p += '\n';
+    }
+
+    void beginObject(const char *name, char open)
+        // Begin a JSON nested object or array having the specified 'name'
+        // and the specified 'open' bracket.  This method has no effect in
+        // logfmt.
+    {
+        if (d_isJson) {
+            key(name, bsl::strlen(name));
+            *d_output_p += open;
+            d_isFirst = true;
+        }
+    }
+
+    void endObject(char close)
+        // Complete the JSON nested object or array most recently begun with
+        // the specified 'close' bracket.  This method has no effect in
+        // logfmt.
+    {
+        if (d_isJson) {
+            *d_output_p += close;
+            d_isFirst = false;
+        }
+    }
+
+    void key(const char *name, bsl::size_t length)
+        // Write the specified 'name' having the specified 'length' as the key
+        // of the next value.
+    {
+        if (d_isJson) {
+            if (!d_isFirst) {
+                *d_output_p += ',';
+            }
+            *d_output_p += '"';
+            appendEscaped(d_output_p, name, length);
+            d_output_p->append("\":", 2);
+        }
+        else {
+            if (!d_isFirst) {
+                *d_output_p += ' ';
+            }
+            if (needsLogfmtQuoting(name, length)) {
+                *d_output_p += '"';
+                appendEscaped(d_output_p, name, length);
+                *d_output_p += '"';
+            }
+            else {
+                d_output_p->append(name, length);
+            }
+            *d_output_p += '=';
+        }
+        d_isFirst = false;
+    }
+
+    void key(const char *name)
+        // Write the specified null-terminated 'name' as the key of the next
+        // value.
+    {
+        key(name, bsl::strlen(name));
+    }
+
+    void element()
+        // Prepare to write the next element of a JSON array.  This method
+        // has no effect in logfmt.
+    {
+        if (d_isJson && !d_isFirst) {
+            *d_output_p += ',';
+        }
+        d_isFirst = false;
+    }
+
+    void stringValue(const char *data, bsl::size_t length)
+        // Write the specified 'data' having the specified 'length' as a
+        // string value.
+    {
+        if (d_isJson || needsLogfmtQuoting(data, length)) {
+            *d_output_p += '"';
+            appendEscaped(d_output_p, data, length);
+            *d_output_p += '"';
+        }
+        else {
+            d_output_p->append(data, length);
+        }
+    }
+
+    void stringValue(const bslstl::StringRef& value)
+        // Write the specified 'value' as a string value.
+    {
+        stringValue(value.data(), value.length());
+    }
+
+    void int64Value(Int64 value)
+        // Write the specified 'value' as a numeric value.
+    {
+        appendInt64(d_output_p, value);
+    }
+
+    void uint64Value(Uint64 value)
+        // Write the specified 'value' as a numeric value.
+    {
+        appendUint64(d_output_p, value);
+    }
+
+    void doubleValue(double value)
+        // Write the specified 'value' as a numeric value.  Non-finite values
+        // are written as 'null' in JSON.
+    {
+        if (d_isJson && (bdlb::Float::isNan(value)
+                      || bdlb::Float::isInfinite(value))) {
+            nullValue();
+            return;                                                   // RETURN
+        }
+
+        char buffer[32];
+        const int length = snprintf(buffer, sizeof buffer, "%.17g", value);
+        d_output_p->append(buffer, length);
+    }
+
+    void nullValue()
+        // Write a null value.
+    {
+        if (d_isJson) {
+            d_output_p->append("null", 4);
+        }
+    }
+
+    void datetimeTzValue(const bdlt::DatetimeTz& value, int precision)
+        // Write the specified 'value' as an ISO 8601 string having the
+        // specified 'precision' fractional second digits.
+    {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(precision);
+        config.setUseZAbbreviationForUtc(true);
+
+        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+        const int length = bdlt::Iso8601Util::generateRaw(buffer,
+                                                          value,
+                                                          config);
+        if (d_isJson) {
+            *d_output_p += '"';
+            d_output_p->append(buffer, length);
+            *d_output_p += '"';
+        }
+        else {
+            d_output_p->append(buffer, length);
+        }
+    }
+
+    void hexValue(const bsl::vector<char>& value)
+        // Write the specified 'value' as a string of hexadecimal digits.
+    {
+        static const char k_HEX[] = "0123456789ABCDEF";
+
+        if (d_isJson || value.empty()) {
+            *d_output_p += '"';
+        }
+        for (bsl::size_t i = 0; i < value.size(); ++i) {
+            const unsigned char c = static_cast<unsigned char>(value[i]);
+            *d_output_p += k_HEX[c >> 4];
+            *d_output_p += k_HEX[c & 0xF];
+        }
+        if (d_isJson || value.empty()) {
+            *d_output_p += '"';
+        }
+    }
+
+    void userFieldValue(const UserFieldValue& value)
+        // Write the specified 'value'.
+    {
+        switch (value.type()) {
+          case UserFieldType::e_VOID: {
+            nullValue();
+          } break;
+          case UserFieldType::e_INT64: {
+            int64Value(value.theInt64());
+          } break;
+          case UserFieldType::e_DOUBLE: {
+            doubleValue(value.theDouble());
+          } break;
+          case UserFieldType::e_STRING: {
+            stringValue(value.theString());
+          } break;
+          case UserFieldType::e_DATETIMETZ: {
+            datetimeTzValue(value.theDatetimeTz(), 6);
+          } break;
+          case UserFieldType::e_CHAR_ARRAY: {
+            hexValue(value.theCharArray());
+          } break;
+        }
+    }
+
+    void attribute(const Attribute& value)
+        // Write the specified attribute 'value' as a key/value pair.
+    {
+        key(value.name());
+
+        const Attribute::Value& v = value.value();
+        if (v.is<int>()) {
+            int64Value(v.the<int>());
+        }
+        else if (v.is<Int64>()) {
+            int64Value(v.the<Int64>());
+        }
+        else if (v.is<bsl::string>()) {
+            stringValue(v.the<bsl::string>());
+        }
+        else {
+            nullValue();
+        }
+    }
+};
+
+                        // ======================
+                        // struct AttributeVisitor
+                        // ======================
+
+struct AttributeVisitor {
+    // This functor forwards each visited attribute to a 'RecordEmitter'.
+
+    // DATA
+    RecordEmitter *d_emitter_p;  // emitter (held, not owned)
+
+    // ACCESSORS
+    void operator()(const Attribute& value) const
+        // Write the specified attribute 'value' to the emitter.
+    {
+        d_emitter_p->attribute(value);
+    }
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_unenumerableReported = { 0 };
+    // 1 once 'reportUnenumerableContainer' has logged its message, and 0
+    // otherwise.
+
+void reportUnenumerableContainer()
+    // Log, on the first call in this process only, that the attributes of an
+    // attribute container could not be enumerated, and are therefore missing
+    // from formatted records.
+{
+    if (0 == bsls::AtomicOperations::testAndSwapInt(&s_unenumerableReported,
+                                                    0,
+                                                    1)) {
+        BSLS_LOG_WARN("ball::StructuredRecordFormatter: an attribute"
+                      " container does not implement 'visitAttributes';"
+                      " its attributes are omitted from formatted records");
+    }
+}
+
+}  // close unnamed namespace
+
+                      // -------------------------------
+                      // class StructuredRecordFormatter
+                      // -------------------------------
+
+// ACCESSORS
+void StructuredRecordFormatter::operator()(bsl::ostream& stream,
+                                           const Record& record) const
+{
+    // Create a buffer on the stack for formatting the record.  Note that the
+    // size of the buffer should be slightly larger than the amount we reserve
+    // in order to ensure only a single allocation occurs.
+
+    const int BUFFER_SIZE        = 1024;
+    const int STRING_RESERVATION = BUFFER_SIZE -
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+    char fixedBuffer[BUFFER_SIZE];
+    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
+                                                       BUFFER_SIZE);
+    bsl::string output(&stringAllocator);
+    output.reserve(STRING_RESERVATION);
+
+    format(&output, record);
+
+    stream.write(output.data(), output.size());
+    stream.flush();
+}
+
+void StructuredRecordFormatter::format(bsl::string   *output,
+                                       const Record&  record) const
+{
+    BSLS_ASSERT(output);
+
+    const RecordAttributes& fixedFields = record.fixedFields();
+
+    int offsetInMinutes = 0;
+    if (d_publishInLocalTime) {
+        offsetInMinutes = static_cast<int>(
+                           bdlt::LocalTimeOffset::localTimeOffset(
+                                  fixedFields.timestamp()).totalMinutes());
+    }
+    bdlt::DatetimeTz timestamp(fixedFields.timestamp() +
+                                 bdlt::DatetimeInterval(0, 0, offsetInMinutes),
+                               offsetInMinutes);
+
+    RecordEmitter emitter(output, e_JSON == d_style);
+
+    emitter.beginRecord();
+
+    emitter.key("timestamp");
+    emitter.datetimeTzValue(timestamp, 3);
+
+    emitter.key("pid");
+    emitter.int64Value(fixedFields.processID());
+
+    emitter.key("thread");
+    emitter.uint64Value(fixedFields.threadID());
+
+    emitter.key("severity");
+    const char *severity = Severity::toAscii(
+                         static_cast<Severity::Level>(fixedFields.severity()));
+    emitter.stringValue(severity, bsl::strlen(severity));
+
+    emitter.key("file");
+    emitter.stringValue(fixedFields.fileName());
+
+    emitter.key("line");
+    emitter.int64Value(fixedFields.lineNumber());
+
+    emitter.key("category");
+    emitter.stringValue(fixedFields.category());
+
+    emitter.key("message");
+    emitter.stringValue(fixedFields.messageRef());
+
+    const UserFields& userFields = record.customFields();
+    if (0 < userFields.length()) {
+        if (e_JSON == d_style) {
+            emitter.beginObject("userFields", '[');
+            for (int i = 0; i < userFields.length(); ++i) {
+                emitter.element();
+                emitter.userFieldValue(userFields[i]);
+            }
+            emitter.endObject(']');
+        }
+        else {
+            char name[32] = "userField";
+            const bsl::size_t prefixLength = sizeof "userField" - 1;
+            for (int i = 0; i < userFields.length(); ++i) {
+                const int length = snprintf(name + prefixLength,
+                                            sizeof name - prefixLength,
+                                            "%d",
+                                            i);
+                emitter.key(name, prefixLength + length);
+                emitter.userFieldValue(userFields[i]);
+            }
+        }
+    }
+
+    if (d_includeAttributes) {
+        const AttributeContext *context = AttributeContext::lookupContext();
+        if (context && 0 < context->containers().numContainers()) {
+            AttributeVisitor visitor = { &emitter };
+
+            emitter.beginObject("attributes", '{');
+            if (!context->containers().visitAttributes(visitor)) {
+                reportUnenumerableContainer();
+            }
+            emitter.endObject('}');
+        }
+    }
+
+    emitter.endRecord();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
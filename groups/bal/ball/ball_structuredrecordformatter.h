@@ -0,0 +1,337 @@
+// ball_structuredrecordformatter.h                                   -*-C++-*-
+#ifndef INCLUDED_BALL_STRUCTUREDRECORDFORMATTER
+#define INCLUDED_BALL_STRUCTUREDRECORDFORMATTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record formatter producing JSON-lines or logfmt output.
+//
+//@CLASSES:
+//  ball::StructuredRecordFormatter: structured (key/value) record formatter
+//
+//@SEE_ALSO: ball_recordstringformatter, ball_attributecontext
+//
+//@DESCRIPTION: This component provides a value-semantic function-object
+// class, 'ball::StructuredRecordFormatter', that formats log records as
+// machine-readable key/value text, so that downstream log processing can
+// consume records without parsing free-form text.  Two output styles are
+// supported:
+//..
+//  Style      Output
+//  ---------  ---------------------------------------------------------------
+//  e_JSON     One JSON object per record, terminated by '\n' ("JSON lines").
+//
+//  e_LOGFMT   One line of space-separated 'key=value' pairs per record,
+//             terminated by '\n'.  Keys and values that are empty or
+//             contain spaces, '=', '"', '\', or control characters are
+//             double-quoted and escaped, so that attribute names and values
+//             supplied by users cannot introduce additional pairs or lines.
+//..
+// Each formatted record contains the following keys, in order:
+//..
+//  Key         Value
+//  ----------  -------------------------------------------------------------
+//  timestamp   ISO 8601 timestamp with milliseconds (UTC or local time)
+//  pid         process Id
+//  thread      thread Id
+//  severity    severity as returned by 'ball::Severity::toAscii'
+//  file        file name (as provided by '__FILE__')
+//  line        line number
+//  category    category name
+//  message     log message
+//..
+// The values of the user-defined fields of the record (see 'ball_userfields')
+// follow the fixed fields.  In JSON they are rendered as an array under the
+// key "userFields"; in logfmt, as the keys "userField0", "userField1", etc.
+// Unset user fields are rendered as 'null' (JSON) or an empty value (logfmt).
+//
+// If attribute output is enabled (the default), the attributes held by the
+// 'ball::AttributeContext' of the *calling* thread are then rendered, in JSON
+// as an object under the key "attributes", and in logfmt as additional
+// 'name=value' pairs.  The attributes of each container are enumerated with
+// 'ball::AttributeContainer::visitAttributes'; the attributes of a container
+// that does not override that method cannot be enumerated, and are omitted
+// from the output (a warning is logged, using 'bsls::Log', the first time
+// such a container is encountered in the process).  Note that, for observers
+// that publish records asynchronously (e.g., 'ball::AsyncFileObserver'), the
+// calling thread is not the thread that created the record, and attribute
+// output should be disabled.
+//
+///Performance
+///-----------
+// 'format' appends the formatted record directly to a caller-supplied
+// 'bsl::string' and does not create any temporary strings, so that a caller
+// that reuses the same output buffer for successive records performs no
+// memory allocation in the steady state.  'operator()' formats into a
+// stack-based buffer before writing to the supplied stream.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Record as a JSON Line
+///- - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a formatter that uses the JSON style, and that does not
+// render attributes:
+//..
+//  ball::StructuredRecordFormatter formatter(
+//                                   ball::StructuredRecordFormatter::e_JSON);
+//  formatter.setIncludeAttributes(false);
+//..
+// Then, we create a record and populate some of its fields:
+//..
+//  ball::Record record;
+//  record.fixedFields().setTimestamp(bdlt::Datetime(2017, 4, 28, 8, 9, 10));
+//  record.fixedFields().setProcessID(100);
+//  record.fixedFields().setThreadID(6);
+//  record.fixedFields().setSeverity(ball::Severity::e_WARN);
+//  record.fixedFields().setFileName("sample.cpp");
+//  record.fixedFields().setLineNumber(42);
+//  record.fixedFields().setCategory("EQUITY.NASD");
+//  record.fixedFields().setMessage("Price \"stale\"");
+//  record.customFields().appendInt64(17);
+//..
+// Finally, we format the record into a reusable output buffer:
+//..
+//  bsl::string output;
+//  formatter.format(&output, record);
+//
+//  assert("{\"timestamp\":\"2017-04-28T08:09:10.000Z\",\"pid\":100,"
+//         "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+//         "\"line\":42,\"category\":\"EQUITY.NASD\","
+//         "\"message\":\"Price \\\"stale\\\"\",\"userFields\":[17]}\n"
+//         == output);
+//..
+// Using the logfmt style instead would have produced:
+//..
+//  timestamp=2017-04-28T08:09:10.000Z pid=100 thread=6 severity=WARN
+//  file=sample.cpp line=42 category=EQUITY.NASD message="Price \"stale\""
+//  userField0=17
+//..
+// (on a single line).
+
+#include <balscm_version.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                      // ===============================
+                      // class StructuredRecordFormatter
+                      // ===============================
+
+class StructuredRecordFormatter {
+    // This class provides a value-semantic log record formatter that renders
+    // records as structured key/value text in one of the styles enumerated by
+    // 'Style'.  The overloaded 'operator()' formats a given record and
+    // outputs the result to a given stream, and 'format' appends the result
+    // to a given string.
+
+  public:
+    // TYPES
+    enum Style {
+        e_JSON,    // one JSON object per line
+        e_LOGFMT   // one line of 'key=value' pairs
+    };
+
+  private:
+    // DATA
+    Style d_style;               // output style
+    bool  d_publishInLocalTime;  // 'true' if timestamps are in local time
+    bool  d_includeAttributes;   // 'true' if context attributes are output
+
+  public:
+    // CREATORS
+    explicit StructuredRecordFormatter(Style style = e_JSON);
+        // Create a record formatter having the optionally specified 'style'
+        // that formats timestamps in UTC and includes attributes.  If 'style'
+        // is not specified, 'e_JSON' is used.
+
+    StructuredRecordFormatter(Style style, bool publishInLocalTime);
+        // Create a record formatter having the specified 'style' that
+        // includes attributes and, if the specified 'publishInLocalTime' is
+        // 'true', formats the timestamp of each record in the local time of
+        // the current task, and formats the timestamp in UTC otherwise.
+
+    //! StructuredRecordFormatter(
+    //!                   const StructuredRecordFormatter& original) = default;
+        // Create a record formatter having the value of the specified
+        // 'original' formatter.
+
+    //! ~StructuredRecordFormatter() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! StructuredRecordFormatter& operator=(
+    //!                        const StructuredRecordFormatter& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' formatter,
+        // and return a reference providing modifiable access to this object.
+
+    void disablePublishInLocalTime();
+        // Format the timestamp of subsequently formatted records in UTC.
+
+    void enablePublishInLocalTime();
+        // Format the timestamp of subsequently formatted records in the local
+        // time of the current task.
+
+    void setIncludeAttributes(bool value);
+        // Set whether the attributes of the calling thread's
+        // 'ball::AttributeContext' are rendered in subsequently formatted
+        // records to the specified 'value'.
+
+    void setStyle(Style style);
+        // Set the output style of this formatter to the specified 'style'.
+
+    // ACCESSORS
+    void operator()(bsl::ostream& stream, const Record& record) const;
+        // Format the specified 'record' according to the style of this
+        // formatter and write the result to the specified 'stream'.
+
+    void format(bsl::string *output, const Record& record) const;
+        // Append to the specified 'output' the specified 'record' formatted
+        // according to the style of this formatter.  Note that 'output' is
+        // not cleared, and that no memory is allocated if 'output' has
+        // sufficient capacity.
+
+    bool includeAttributes() const;
+        // Return 'true' if this formatter renders the attributes of the
+        // calling thread's 'ball::AttributeContext', and 'false' otherwise.
+
+    bool isPublishInLocalTimeEnabled() const;
+        // Return 'true' if this formatter formats timestamps in local time,
+        // and 'false' if it formats them in UTC.
+
+    Style style() const;
+        // Return the output style of this formatter.
+};
+
+// FREE OPERATORS
+bool operator==(const StructuredRecordFormatter& lhs,
+                const StructuredRecordFormatter& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' record formatters have
+    // the same value, and 'false' otherwise.  Two record formatters have the
+    // same value if their respective style, publish-in-local-time, and
+    // include-attributes attributes have the same value.
+
+bool operator!=(const StructuredRecordFormatter& lhs,
+                const StructuredRecordFormatter& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' record formatters do not
+    // have the same value, and 'false' otherwise.  Two record formatters do
+    // not have the same value if any of their respective style,
+    // publish-in-local-time, or include-attributes attributes differ.
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class StructuredRecordFormatter
+                      // -------------------------------
+
+// CREATORS
+inline
+StructuredRecordFormatter::StructuredRecordFormatter(Style style)
+: d_style(style)
+, d_publishInLocalTime(false)
+, d_includeAttributes(true)
+{
+}
+
+inline
+StructuredRecordFormatter::StructuredRecordFormatter(
+                                                 Style style,
+                                                 bool  publishInLocalTime)
+: d_style(style)
+, d_publishInLocalTime(publishInLocalTime)
+, d_includeAttributes(true)
+{
+}
+
+// MANIPULATORS
+inline
+void StructuredRecordFormatter::disablePublishInLocalTime()
+{
+    d_publishInLocalTime = false;
+}
+
+inline
+void StructuredRecordFormatter::enablePublishInLocalTime()
+{
+    d_publishInLocalTime = true;
+}
+
+inline
+void StructuredRecordFormatter::setIncludeAttributes(bool value)
+{
+    d_includeAttributes = value;
+}
+
+inline
+void StructuredRecordFormatter::setStyle(Style style)
+{
+    d_style = style;
+}
+
+// ACCESSORS
+inline
+bool StructuredRecordFormatter::includeAttributes() const
+{
+    return d_includeAttributes;
+}
+
+inline
+bool StructuredRecordFormatter::isPublishInLocalTimeEnabled() const
+{
+    return d_publishInLocalTime;
+}
+
+inline
+StructuredRecordFormatter::Style StructuredRecordFormatter::style() const
+{
+    return d_style;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool ball::operator==(const StructuredRecordFormatter& lhs,
+                      const StructuredRecordFormatter& rhs)
+{
+    return lhs.style()                       == rhs.style()
+        && lhs.isPublishInLocalTimeEnabled() ==
+                                             rhs.isPublishInLocalTimeEnabled()
+        && lhs.includeAttributes()           == rhs.includeAttributes();
+}
+
+inline
+bool ball::operator!=(const StructuredRecordFormatter& lhs,
+                      const StructuredRecordFormatter& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
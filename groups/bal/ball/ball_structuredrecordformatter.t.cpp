@@ -0,0 +1,855 @@
+// ball_structuredrecordformatter.t.cpp                               -*-C++-*-
+#include <ball_structuredrecordformatter.h>
+
+#include <ball_attribute.h>
+#include <ball_attributecontainer.h>
+#include <ball_attributecontext.h>
+#include <ball_categorymanager.h>
+#include <ball_defaultattributecontainer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_scopedattribute.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_log.h>
+#include <bsls_logseverity.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cerr;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is a simple value-semantic function object having
+// three attributes, and a formatting function that is tested by formatting a
+// table of records in each of the supported styles and comparing the output
+// against expected strings.
+//
+// CREATORS
+// [ 2] StructuredRecordFormatter(Style style = e_JSON);
+// [ 2] StructuredRecordFormatter(Style style, bool publishInLocalTime);
+//
+// MANIPULATORS
+// [ 2] void disablePublishInLocalTime();
+// [ 2] void enablePublishInLocalTime();
+// [ 2] void setIncludeAttributes(bool value);
+// [ 2] void setStyle(Style style);
+//
+// ACCESSORS
+// [ 3] void operator()(bsl::ostream& stream, const Record& record) const;
+// [ 3] void format(bsl::string *output, const Record& record) const;
+// [ 4] void format(bsl::string *output, const Record& record) const;
+// [ 5] void format(bsl::string *output, const Record& record) const;
+// [ 6] void format(bsl::string *output, const Record& record) const;
+// [ 2] bool includeAttributes() const;
+// [ 2] bool isPublishInLocalTimeEnabled() const;
+// [ 2] Style style() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const SRF& lhs, const SRF& rhs);
+// [ 2] bool operator!=(const SRF& lhs, const SRF& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//              GLOBAL TYPES, CONSTANTS, AND VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+static int veryVeryVeryVerbose = 0;
+
+typedef ball::StructuredRecordFormatter Obj;
+
+static int numWarnings = 0;
+
+static void countWarnings(bsls::LogSeverity::Enum  severity,
+                          const char              *,
+                          int                      ,
+                          const char              *message)
+    // Increment 'numWarnings' if the specified 'severity' is 'e_WARN'.  Print
+    // the specified 'message' in very verbose mode.
+{
+    if (bsls::LogSeverity::e_WARN == severity) {
+        ++numWarnings;
+    }
+    if (veryVerbose) {
+        P(message);
+    }
+}
+
+class OpaqueContainer : public ball::AttributeContainer {
+    // This class provides an attribute container holding a single attribute,
+    // that (like implementations of 'ball::AttributeContainer' predating
+    // 'visitAttributes') does not override 'visitAttributes'.
+
+    // DATA
+    ball::Attribute d_attribute;  // held attribute
+
+  public:
+    // CREATORS
+    explicit OpaqueContainer(const ball::Attribute& attribute)
+        // Create a container holding the specified 'attribute'.
+    : d_attribute(attribute)
+    {
+    }
+
+    // ACCESSORS
+    bool hasValue(const ball::Attribute& value) const
+        // Return 'true' if the specified 'value' is the held attribute, and
+        // 'false' otherwise.
+    {
+        return d_attribute == value;
+    }
+
+    bsl::ostream& print(bsl::ostream& stream, int, int) const
+        // Write the held attribute to the specified 'stream'.
+    {
+        return stream << d_attribute;
+    }
+};
+
+static void populateRecord(ball::Record *record, const char *message)
+    // Load into the specified 'record' a fixed set of field values and the
+    // specified 'message'.
+{
+    ball::RecordAttributes& fixedFields = record->fixedFields();
+    fixedFields.setTimestamp(bdlt::Datetime(2017, 4, 28, 8, 9, 10, 123));
+    fixedFields.setProcessID(100);
+    fixedFields.setThreadID(6);
+    fixedFields.setSeverity(ball::Severity::e_WARN);
+    fixedFields.setFileName("sample.cpp");
+    fixedFields.setLineNumber(42);
+    fixedFields.setCategory("EQUITY.NASD");
+    fixedFields.setMessage(message);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = (argc > 1) ? bsl::atoi(argv[1]) : 1;
+
+    verbose = (argc > 2);
+    veryVerbose = (argc > 3);
+    veryVeryVerbose = (argc > 4);
+    veryVeryVeryVerbose = (argc > 5);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ga("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&ga);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Record as a JSON Line
+///- - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a formatter that uses the JSON style, and that does not
+// render attributes:
+//..
+    ball::StructuredRecordFormatter formatter(
+                                     ball::StructuredRecordFormatter::e_JSON);
+    formatter.setIncludeAttributes(false);
+//..
+// Then, we create a record and populate some of its fields:
+//..
+    ball::Record record;
+    record.fixedFields().setTimestamp(bdlt::Datetime(2017, 4, 28, 8, 9, 10));
+    record.fixedFields().setProcessID(100);
+    record.fixedFields().setThreadID(6);
+    record.fixedFields().setSeverity(ball::Severity::e_WARN);
+    record.fixedFields().setFileName("sample.cpp");
+    record.fixedFields().setLineNumber(42);
+    record.fixedFields().setCategory("EQUITY.NASD");
+    record.fixedFields().setMessage("Price \"stale\"");
+    record.customFields().appendInt64(17);
+//..
+// Finally, we format the record into a reusable output buffer:
+//..
+    bsl::string output;
+    formatter.format(&output, record);
+
+    ASSERT("{\"timestamp\":\"2017-04-28T08:09:10.000Z\",\"pid\":100,"
+           "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+           "\"line\":42,\"category\":\"EQUITY.NASD\","
+           "\"message\":\"Price \\\"stale\\\"\",\"userFields\":[17]}\n"
+           == output);
+//..
+// Using the logfmt style instead would have produced:
+//..
+//  timestamp=2017-04-28T08:09:10.000Z pid=100 thread=6 severity=WARN
+//  file=sample.cpp line=42 category=EQUITY.NASD message="Price \"stale\""
+//  userField0=17
+//..
+// (on a single line).
+
+        if (veryVerbose) { P(output); }
+
+        output.clear();
+        formatter.setStyle(Obj::e_LOGFMT);
+        formatter.format(&output, record);
+
+        ASSERTV(output,
+                "timestamp=2017-04-28T08:09:10.000Z pid=100 thread=6 "
+                "severity=WARN file=sample.cpp line=42 category=EQUITY.NASD "
+                "message=\"Price \\\"stale\\\"\" userField0=17\n" == output);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING CONTAINERS NOT ENUMERATING ATTRIBUTES
+        //
+        // Concerns:
+        //: 1 The attributes of containers overriding 'visitAttributes' are
+        //:   rendered even if another container in the attribute context does
+        //:   not override it.
+        //:
+        //: 2 A warning is logged, once per process, when a container not
+        //:   overriding 'visitAttributes' is encountered, and not before.
+        //
+        // Plan:
+        //: 1 Install a log message handler counting warnings, and format a
+        //:   record with an attribute context holding only a scoped
+        //:   attribute; verify the output and that no warning is logged.
+        //:
+        //: 2 Add a container that does not override 'visitAttributes', and
+        //:   format the record twice in each style; verify that the output is
+        //:   unchanged, and that exactly one warning is logged.  (C-1..2)
+        //
+        // Testing:
+        //   void format(bsl::string *output, const Record& record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTAINERS NOT ENUMERATING ATTRIBUTES"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        bsls::Log::setLogMessageHandler(&countWarnings);
+
+        ball::CategoryManager categoryManager;
+        ball::AttributeContext::initialize(&categoryManager);
+
+        ball::AttributeContextProctor proctor;  // destroys context
+
+        ball::Record record;
+        populateRecord(&record, "m");
+
+        const bsl::string EXP_LOGFMT =
+                  "timestamp=2017-04-28T08:09:10.123Z pid=100 thread=6 "
+                  "severity=WARN file=sample.cpp line=42 category=EQUITY.NASD "
+                  "message=m shown=1\n";
+        const bsl::string EXP_JSON =
+                  "{\"timestamp\":\"2017-04-28T08:09:10.123Z\",\"pid\":100,"
+                  "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+                  "\"line\":42,\"category\":\"EQUITY.NASD\",\"message\":\"m\","
+                  "\"attributes\":{\"shown\":1}}\n";
+
+        const Obj J(Obj::e_JSON);
+        const Obj L(Obj::e_LOGFMT);
+
+        ball::ScopedAttribute shown("shown", 1);
+
+        bsl::string output;
+        L.format(&output, record);
+        ASSERTV(output, EXP_LOGFMT == output);
+        ASSERTV(numWarnings, 0 == numWarnings);
+
+        ball::AttributeContext *context = ball::AttributeContext::getContext();
+
+        OpaqueContainer opaque(ball::Attribute("hidden", 2));
+        ball::AttributeContext::iterator it = context->addAttributes(&opaque);
+
+        for (int i = 0; i < 2; ++i) {
+            output.clear();
+            L.format(&output, record);
+            ASSERTV(i, output, EXP_LOGFMT == output);
+
+            output.clear();
+            J.format(&output, record);
+            ASSERTV(i, output, EXP_JSON == output);
+        }
+        ASSERTV(numWarnings, 1 == numWarnings);
+
+        context->removeAttributes(it);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ATTRIBUTE NAMES REQUIRING ESCAPING
+        //
+        // Concerns:
+        //: 1 In logfmt, attribute names that are empty or contain spaces,
+        //:   '=', '"', '\', or control characters are double-quoted and
+        //:   escaped, so that they cannot introduce additional pairs or
+        //:   lines.
+        //:
+        //: 2 In logfmt, other attribute names are written verbatim.
+        //:
+        //: 3 In JSON, attribute names are escaped.
+        //
+        // Plan:
+        //: 1 Initialize the attribute context, add scoped attributes having
+        //:   names requiring escaping, and compare the formatted output
+        //:   against expected values in both styles.  (C-1..3)
+        //
+        // Testing:
+        //   void format(bsl::string *output, const Record& record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ATTRIBUTE NAMES REQUIRING ESCAPING"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        ball::CategoryManager categoryManager;
+        ball::AttributeContext::initialize(&categoryManager);
+
+        ball::AttributeContextProctor proctor;  // destroys context
+
+        ball::Record record;
+        populateRecord(&record, "m");
+
+        const char *PREFIX_JSON =
+                  "{\"timestamp\":\"2017-04-28T08:09:10.123Z\",\"pid\":100,"
+                  "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+                  "\"line\":42,\"category\":\"EQUITY.NASD\",\"message\":\"m\"";
+        const char *PREFIX_LOGFMT =
+                  "timestamp=2017-04-28T08:09:10.123Z pid=100 thread=6 "
+                  "severity=WARN file=sample.cpp line=42 category=EQUITY.NASD "
+                  "message=m";
+
+        const Obj J(Obj::e_JSON);
+        const Obj L(Obj::e_LOGFMT);
+
+        // Scoped attributes are pushed to the front of the container list,
+        // so the most recent appears first.
+
+        ball::ScopedAttribute a1("plain.name", 1);
+        ball::ScopedAttribute a2("two words", 2);
+        ball::ScopedAttribute a3("desk=fx severity", 3);
+        ball::ScopedAttribute a4("quote\"back\\slash", 4);
+        ball::ScopedAttribute a5("line\nseverity=FATAL", 5);
+        ball::ScopedAttribute a6("", 6);
+
+        bsl::string output;
+        L.format(&output, record);
+        if (veryVerbose) { P(output); }
+
+        ASSERTV(output,
+                bsl::string(PREFIX_LOGFMT) +
+                " \"\"=6"
+                " \"line\\nseverity=FATAL\"=5"
+                " \"quote\\\"back\\\\slash\"=4"
+                " \"desk=fx severity\"=3"
+                " \"two words\"=2"
+                " plain.name=1\n" == output);
+        ASSERTV(output, 1 == bsl::count(output.begin(), output.end(), '\n'));
+
+        output.clear();
+        J.format(&output, record);
+        if (veryVerbose) { P(output); }
+
+        ASSERTV(output,
+                bsl::string(PREFIX_JSON) +
+                ",\"attributes\":{"
+                "\"\":6,"
+                "\"line\\nseverity=FATAL\":5,"
+                "\"quote\\\"back\\\\slash\":4,"
+                "\"desk=fx severity\":3,"
+                "\"two words\":2,"
+                "\"plain.name\":1}}\n" == output);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ATTRIBUTES
+        //
+        // Concerns:
+        //: 1 Attributes held by the calling thread's attribute context are
+        //:   rendered, in container order, when attribute output is enabled.
+        //:
+        //: 2 No attributes are rendered when attribute output is disabled, or
+        //:   when the calling thread has no attribute containers.
+        //:
+        //: 3 Integer and string attributes are rendered with the proper
+        //:   types.
+        //
+        // Plan:
+        //: 1 Initialize the attribute context, add scoped attributes, and
+        //:   compare the formatted output against expected values in both
+        //:   styles.  (C-1..3)
+        //
+        // Testing:
+        //   void format(bsl::string *output, const Record& record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING ATTRIBUTES" << endl
+                                  << "==================" << endl;
+
+        ball::CategoryManager categoryManager;
+        ball::AttributeContext::initialize(&categoryManager);
+
+        ball::AttributeContextProctor proctor;  // destroys context
+
+        ball::Record record;
+        populateRecord(&record, "m");
+
+        const char *PREFIX_JSON =
+                  "{\"timestamp\":\"2017-04-28T08:09:10.123Z\",\"pid\":100,"
+                  "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+                  "\"line\":42,\"category\":\"EQUITY.NASD\",\"message\":\"m\"";
+        const char *PREFIX_LOGFMT =
+                  "timestamp=2017-04-28T08:09:10.123Z pid=100 thread=6 "
+                  "severity=WARN file=sample.cpp line=42 category=EQUITY.NASD "
+                  "message=m";
+
+        Obj mJ(Obj::e_JSON);    const Obj& J = mJ;
+        Obj mL(Obj::e_LOGFMT);  const Obj& L = mL;
+
+        {
+            bsl::string output;
+            J.format(&output, record);
+            ASSERTV(output, bsl::string(PREFIX_JSON) + "}\n" == output);
+        }
+
+        {
+            ball::ScopedAttribute a1("uuid", 1234);
+            ball::ScopedAttribute a2("desk", bsl::string("fx options"));
+
+            bsl::string output;
+            J.format(&output, record);
+
+            // Scoped attributes are pushed to the front of the container
+            // list, so the most recent appears first.
+
+            ASSERTV(output,
+                    bsl::string(PREFIX_JSON) +
+                    ",\"attributes\":{\"desk\":\"fx options\","
+                    "\"uuid\":1234}}\n" == output);
+
+            output.clear();
+            L.format(&output, record);
+            ASSERTV(output,
+                    bsl::string(PREFIX_LOGFMT) +
+                    " desk=\"fx options\" uuid=1234\n" == output);
+
+            mJ.setIncludeAttributes(false);
+            output.clear();
+            J.format(&output, record);
+            ASSERTV(output, bsl::string(PREFIX_JSON) + "}\n" == output);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING FORMATTING
+        //
+        // Concerns:
+        //: 1 All fixed fields are rendered with the expected keys, in order.
+        //:
+        //: 2 String values are escaped correctly in JSON, and quoted and
+        //:   escaped only when necessary in logfmt.
+        //:
+        //: 3 User fields of every type are rendered.
+        //:
+        //: 4 'format' appends to its output, and 'operator()' writes the same
+        //:   output to a stream.
+        //:
+        //: 5 'format' allocates no memory when 'output' has sufficient
+        //:   capacity.
+        //
+        // Plan:
+        //: 1 Using a table of messages, format records in both styles and
+        //:   compare against the expected output.  (C-1..2)
+        //:
+        //: 2 Format a record having user fields of every type.  (C-3)
+        //:
+        //: 3 Compare 'operator()' with 'format', and format into a string
+        //:   having sufficient capacity while monitoring the allocators.
+        //:   (C-4..5)
+        //
+        // Testing:
+        //   void operator()(bsl::ostream& stream, const Record& record) const;
+        //   void format(bsl::string *output, const Record& record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING FORMATTING" << endl
+                                  << "==================" << endl;
+
+        const char *PREFIX_JSON =
+                  "{\"timestamp\":\"2017-04-28T08:09:10.123Z\",\"pid\":100,"
+                  "\"thread\":6,\"severity\":\"WARN\",\"file\":\"sample.cpp\","
+                  "\"line\":42,\"category\":\"EQUITY.NASD\",\"message\":";
+        const char *PREFIX_LOGFMT =
+                  "timestamp=2017-04-28T08:09:10.123Z pid=100 thread=6 "
+                  "severity=WARN file=sample.cpp line=42 category=EQUITY.NASD "
+                  "message=";
+
+        if (verbose) cout << "\nEscaping of messages." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_message;
+                const char *d_json;
+                const char *d_logfmt;
+            } DATA[] = {
+                //LINE  MESSAGE        JSON                LOGFMT
+                //----  -------------  ------------------  ------------------
+                { L_,   "",            "\"\"",             "\"\""            },
+                { L_,   "abc",         "\"abc\"",          "abc"             },
+                { L_,   "a b",         "\"a b\"",          "\"a b\""         },
+                { L_,   "a=b",         "\"a=b\"",          "\"a=b\""         },
+                { L_,   "a\"b",        "\"a\\\"b\"",       "\"a\\\"b\""      },
+                { L_,   "a\\b",        "\"a\\\\b\"",       "\"a\\\\b\""      },
+                { L_,   "a\nb",        "\"a\\nb\"",        "\"a\\nb\""       },
+                { L_,   "a\tb\r",      "\"a\\tb\\r\"",     "\"a\\tb\\r\""    },
+                { L_,   "\x01",        "\"\\u0001\"",      "\"\\u0001\""     },
+                { L_,   "\x1f" "z",    "\"\\u001fz\"",     "\"\\u001fz\""    },
+                { L_,   "\xc3\xa9",    "\"\xc3\xa9\"",     "\xc3\xa9"        },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *MSG    = DATA[ti].d_message;
+                const char *JSON   = DATA[ti].d_json;
+                const char *LOGFMT = DATA[ti].d_logfmt;
+
+                ball::Record record;
+                populateRecord(&record, MSG);
+
+                Obj mX(Obj::e_JSON);  const Obj& X = mX;
+                mX.setIncludeAttributes(false);
+
+                bsl::string output("existing;");
+                X.format(&output, record);
+
+                bsl::string expected = bsl::string("existing;") +
+                                       PREFIX_JSON + JSON + "}\n";
+                ASSERTV(LINE, output, expected == output);
+
+                mX.setStyle(Obj::e_LOGFMT);
+                output.clear();
+                X.format(&output, record);
+
+                expected = bsl::string(PREFIX_LOGFMT) + LOGFMT + "\n";
+                ASSERTV(LINE, output, expected == output);
+            }
+        }
+
+        if (verbose) cout << "\nUser fields of every type." << endl;
+        {
+            ball::Record record;
+            populateRecord(&record, "m");
+
+            bsl::vector<char> bytes;
+            bytes.push_back('\x01');
+            bytes.push_back('\xAB');
+
+            ball::UserFields& fields = record.customFields();
+            fields.appendNull();
+            fields.appendInt64(-9223372036854775807LL - 1);
+            fields.appendDouble(1.5);
+            fields.appendString("x y");
+            fields.appendDatetimeTz(bdlt::DatetimeTz(
+                             bdlt::Datetime(2017, 1, 2, 3, 4, 5, 6, 7), -300));
+            fields.appendCharArray(bytes);
+
+            Obj mX(Obj::e_JSON);  const Obj& X = mX;
+            mX.setIncludeAttributes(false);
+
+            bsl::string output;
+            X.format(&output, record);
+
+            ASSERTV(output,
+                    bsl::string(PREFIX_JSON) +
+                    "\"m\",\"userFields\":[null,-9223372036854775808,1.5,"
+                    "\"x y\",\"2017-01-02T03:04:05.006007-05:00\",\"01AB\"]}\n"
+                    == output);
+
+            mX.setStyle(Obj::e_LOGFMT);
+            output.clear();
+            X.format(&output, record);
+
+            ASSERTV(output,
+                    bsl::string(PREFIX_LOGFMT) +
+                    "m userField0= userField1=-9223372036854775808 "
+                    "userField2=1.5 userField3=\"x y\" "
+                    "userField4=2017-01-02T03:04:05.006007-05:00 "
+                    "userField5=01AB\n" == output);
+        }
+
+        if (verbose) cout << "\n'operator()' and memory allocation." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+            bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+
+            ball::Record record(&oa);
+            populateRecord(&record, "hello, world");
+            record.customFields().appendInt64(7);
+
+            Obj mX;  const Obj& X = mX;
+            mX.setIncludeAttributes(false);
+
+            bsl::string output(&oa);
+            output.reserve(1024);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+            X.format(&output, record);
+
+            ASSERTV(NUM_ALLOCS == oa.numAllocations());
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+
+            bsl::ostringstream stream(&oa);
+            X(stream, record);
+            ASSERTV(stream.str(), output, output == stream.str());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected
+        //:   attributes.
+        //:
+        //: 2 Each manipulator sets the corresponding attribute, and each
+        //:   accessor returns it.
+        //:
+        //: 3 The equality operators compare every attribute.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, verify their attributes
+        //:   with the accessors, then modify them using the manipulators and
+        //:   compare them using the equality operators.  (C-1..3)
+        //
+        // Testing:
+        //   StructuredRecordFormatter(Style style = e_JSON);
+        //   StructuredRecordFormatter(Style style, bool publishInLocalTime);
+        //   void disablePublishInLocalTime();
+        //   void enablePublishInLocalTime();
+        //   void setIncludeAttributes(bool value);
+        //   void setStyle(Style style);
+        //   bool includeAttributes() const;
+        //   bool isPublishInLocalTimeEnabled() const;
+        //   Style style() const;
+        //   bool operator==(const SRF& lhs, const SRF& rhs);
+        //   bool operator!=(const SRF& lhs, const SRF& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, MANIPULATORS, AND ACCESSORS"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        Obj mA;                        const Obj& A = mA;
+        Obj mB(Obj::e_LOGFMT);         const Obj& B = mB;
+        Obj mC(Obj::e_LOGFMT, true);   const Obj& C = mC;
+
+        ASSERT(Obj::e_JSON   == A.style());
+        ASSERT(false         == A.isPublishInLocalTimeEnabled());
+        ASSERT(true          == A.includeAttributes());
+
+        ASSERT(Obj::e_LOGFMT == B.style());
+        ASSERT(false         == B.isPublishInLocalTimeEnabled());
+        ASSERT(true          == B.includeAttributes());
+
+        ASSERT(Obj::e_LOGFMT == C.style());
+        ASSERT(true          == C.isPublishInLocalTimeEnabled());
+        ASSERT(true          == C.includeAttributes());
+
+        ASSERT(A != B);  ASSERT(!(A == B));
+        ASSERT(B != C);  ASSERT(!(B == C));
+
+        mA.setStyle(Obj::e_LOGFMT);
+        ASSERT(Obj::e_LOGFMT == A.style());
+        ASSERT(A == B);  ASSERT(!(A != B));
+
+        mA.enablePublishInLocalTime();
+        ASSERT(true == A.isPublishInLocalTimeEnabled());
+        ASSERT(A == C);
+
+        mA.enablePublishInLocalTime();
+        ASSERT(true == A.isPublishInLocalTimeEnabled());
+
+        mA.disablePublishInLocalTime();
+        ASSERT(false == A.isPublishInLocalTimeEnabled());
+        ASSERT(A == B);
+
+        mA.setIncludeAttributes(false);
+        ASSERT(false == A.includeAttributes());
+        ASSERT(A != B);
+
+        mA.setIncludeAttributes(true);
+        ASSERT(true == A.includeAttributes());
+        ASSERT(A == B);
+
+        Obj mD(C);  const Obj& D = mD;
+        ASSERT(C == D);
+
+        mD = A;
+        ASSERT(A == D);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a record in each style and inspect the output.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        ball::Record record;
+        populateRecord(&record, "hello");
+
+        Obj mX;  const Obj& X = mX;
+
+        bsl::ostringstream stream;
+        X(stream, record);
+        if (veryVerbose) { P(stream.str()); }
+
+        ASSERT('{'  == stream.str()[0]);
+        ASSERT('\n' == stream.str()[stream.str().size() - 1]);
+
+        mX.setStyle(Obj::e_LOGFMT);
+        stream.str("");
+        X(stream, record);
+        if (veryVerbose) { P(stream.str()); }
+
+        ASSERT(0 == stream.str().find("timestamp="));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,12 +14,22 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
-#include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>    // for 'strlen', 'strchr', 'memcmp'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BALXML_MINIREADER_X86_SIMD
+#include <immintrin.h>
+#endif
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -106,6 +116,24 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 //     v
 //    END
 //..
+//
+// Scanning the Input
+// ------------------
+// Each of the scanning functions ('skipSpaces', 'scanForSymbol', and the
+// rest) advances 'd_scanPtr' to the first character of a small set.  Every
+// scan also stops at a null character, which always follows the input in the
+// parse buffer, so 'readInput' is called only once a scan reaches
+// 'd_endPtr'.  The scans are performed by the 'find' functions below, which,
+// on x86-64, compare 16 characters at a time with each character of the set
+// using SSE2 instructions (always available on that platform), and compare
+// one character at a time elsewhere and for the last few characters of the
+// input.  Rather than stopping at each newline, 'findSymbol' counts the
+// newlines it passes using the same comparisons, so that a text node or an
+// attribute value spanning several lines is scanned in a single call.  Note
+// that the vector loop never reads past 'd_endPtr', which, when a caller's
+// buffer is parsed in place, is the last character of that buffer.  Also
+// note that the replacement of character references relies on 'strchr',
+// which the C library already vectorizes.
 
 namespace {
 
@@ -285,6 +313,166 @@ void replaceCharReferences(char *text)
 }  // close unnamed namespace
 
 namespace BloombergLP  {
+namespace {
+namespace u {
+
+inline
+bool isBlank(char ch)
+    // Return 'true' if the specified 'ch' is a space, a tab, or a carriage
+    // return, and 'false' otherwise.
+{
+    return ' ' == ch || '\t' == ch || '\r' == ch;
+}
+
+const char *findNonBlank(const char *pos, const char *end)
+    // Return the address of the first character in the range starting at the
+    // specified 'pos' and ending at the specified 'end' that is not a space,
+    // a tab, or a carriage return, or 'end' if there is no such character.
+{
+    // Runs of blanks are frequently empty, e.g., before a text value or an
+    // attribute name, so check the first character before the vector loop.
+
+    if (pos >= end || !isBlank(*pos)) {
+        return pos;                                                   // RETURN
+    }
+    ++pos;
+
+#ifdef BALXML_MINIREADER_X86_SIMD
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab   = _mm_set1_epi8('\t');
+    const __m128i cr    = _mm_set1_epi8('\r');
+
+    while (end - pos >= 16) {
+        const __m128i chars = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(pos));
+        const __m128i blank = _mm_or_si128(
+                                    _mm_cmpeq_epi8(chars, space),
+                                    _mm_or_si128(_mm_cmpeq_epi8(chars, tab),
+                                                 _mm_cmpeq_epi8(chars, cr)));
+        const unsigned int mask = ~_mm_movemask_epi8(blank) & 0xFFFFu;
+        if (mask) {
+            return pos + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        pos += 16;
+    }
+#endif
+
+    while (pos < end && isBlank(*pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+const char *findSymbolOrSpace(const char *pos,
+                              const char *end,
+                              char        symbol1,
+                              char        symbol2)
+    // Return the address of the first character in the range starting at the
+    // specified 'pos' and ending at the specified 'end' that is the specified
+    // 'symbol1' or 'symbol2', a space, a tab, a carriage return, a newline,
+    // or a null character, or 'end' if there is no such character.
+{
+#ifdef BALXML_MINIREADER_X86_SIMD
+    const __m128i first   = _mm_set1_epi8(symbol1);
+    const __m128i second  = _mm_set1_epi8(symbol2);
+    const __m128i space   = _mm_set1_epi8(' ');
+    const __m128i tab     = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i cr      = _mm_set1_epi8('\r');
+    const __m128i zero    = _mm_setzero_si128();
+
+    while (end - pos >= 16) {
+        const __m128i chars = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(pos));
+        const __m128i symbols = _mm_or_si128(
+                                 _mm_or_si128(_mm_cmpeq_epi8(chars, first),
+                                              _mm_cmpeq_epi8(chars, second)),
+                                 _mm_cmpeq_epi8(chars, zero));
+        const __m128i spaces  = _mm_or_si128(
+                                  _mm_or_si128(_mm_cmpeq_epi8(chars, space),
+                                               _mm_cmpeq_epi8(chars, tab)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chars, newline),
+                                               _mm_cmpeq_epi8(chars, cr)));
+        const unsigned int mask = _mm_movemask_epi8(
+                                                _mm_or_si128(symbols, spaces));
+        if (mask) {
+            return pos + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        pos += 16;
+    }
+#endif
+
+    while (pos < end) {
+        const char ch = *pos;
+        if (symbol1 == ch || symbol2 == ch || isBlank(ch) || '\n' == ch
+         || '\0' == ch) {
+            break;                                                     // BREAK
+        }
+        ++pos;
+    }
+    return pos;
+}
+
+const char *findSymbol(const char  *pos,
+                       const char  *end,
+                       char         symbol,
+                       int         *numNewLines,
+                       const char **lastNewLine)
+    // Return the address of the first character in the range starting at the
+    // specified 'pos' and ending at the specified 'end' that is the specified
+    // 'symbol' or a null character, or 'end' if there is no such character.
+    // Add to the specified 'numNewLines' the number of newlines preceding
+    // that character in the range, and, if there are any, load the address
+    // of the last of them into the specified 'lastNewLine'.  The behavior is
+    // undefined if 'symbol' is a newline.
+{
+#ifdef BALXML_MINIREADER_X86_SIMD
+    const __m128i target  = _mm_set1_epi8(symbol);
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i zero    = _mm_setzero_si128();
+
+    while (end - pos >= 16) {
+        const __m128i chars = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(pos));
+        const unsigned int stop = _mm_movemask_epi8(
+                                 _mm_or_si128(_mm_cmpeq_epi8(chars, target),
+                                              _mm_cmpeq_epi8(chars, zero)));
+        bsl::uint32_t newlines = _mm_movemask_epi8(
+                                             _mm_cmpeq_epi8(chars, newline));
+        int length = 16;
+        if (stop) {
+            length = bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(stop));
+            newlines &= (1u << length) - 1;
+        }
+        if (newlines) {
+            *numNewLines += bdlb::BitUtil::numBitsSet(newlines);
+            *lastNewLine  = pos + 31
+                              - bdlb::BitUtil::numLeadingUnsetBits(newlines);
+        }
+        if (stop) {
+            return pos + length;                                      // RETURN
+        }
+        pos += 16;
+    }
+#endif
+
+    while (pos < end && symbol != *pos && '\0' != *pos) {
+        if ('\n' == *pos) {
+            ++*numNewLines;
+            *lastNewLine = pos;
+        }
+        ++pos;
+    }
+    return pos;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
 
                        // ------------------------------
                        // class balxml::MiniReader::Node
@@ -393,6 +581,8 @@ MiniReader::MiniReader(bslma::Allocator *basicAllocator)
 , d_streamBuf       (0)
 , d_memStream       (0)
 , d_memSize         (0)
+, d_inPlaceBuffer   (0)
+, d_inPlaceLastChar ('\0')
 , d_startPtr        (0)
 , d_endPtr          (0)
 , d_scanPtr         (0)
@@ -400,7 +590,7 @@ MiniReader::MiniReader(bslma::Allocator *basicAllocator)
 , d_attrNamePtr     (0)
 , d_attrValPtr      (0)
 , d_lineNum         (0)
-, d_linePtr         (0)
+, d_lineOffset      (0)
 , d_errorInfo       (basicAllocator)
 , d_resolver        ()
 , d_ownNamespaces   (basicAllocator)
@@ -428,6 +618,8 @@ MiniReader::MiniReader(int bufSize, bslma::Allocator *basicAllocator)
 , d_streamBuf       (0)
 , d_memStream       (0)
 , d_memSize         (0)
+, d_inPlaceBuffer   (0)
+, d_inPlaceLastChar ('\0')
 , d_startPtr        (0)
 , d_endPtr          (0)
 , d_scanPtr         (0)
@@ -435,7 +627,7 @@ MiniReader::MiniReader(int bufSize, bslma::Allocator *basicAllocator)
 , d_attrNamePtr     (0)
 , d_attrValPtr      (0)
 , d_lineNum         (0)
-, d_linePtr         (0)
+, d_lineOffset      (0)
 , d_errorInfo       (basicAllocator)
 , d_resolver        ()
 , d_ownNamespaces   (basicAllocator)
@@ -557,6 +749,7 @@ void MiniReader::close()
     d_streamBuf = 0;
     d_memStream = 0;
     d_memSize   = 0;
+    d_inPlaceBuffer = 0;
     d_flags    |= FLG_READ_EOF;
     d_state     = ST_CLOSED;
 }
@@ -578,13 +771,13 @@ int MiniReader::doOpen(const char *url, const char *encoding)
     d_streamOffset = 0;
     d_flags       = 0;
 
-    d_startPtr   = &d_parseBuf.front();
+    d_startPtr   = d_inPlaceBuffer ? d_inPlaceBuffer : &d_parseBuf.front();
     d_endPtr     = d_startPtr;
     d_scanPtr    = d_startPtr;
     d_markPtr    = d_startPtr;
 
     d_lineNum    = 0;
-    d_linePtr    = d_startPtr;
+    d_lineOffset = 0;
 
     d_attrNamePtr = 0;
     d_state       = ST_INITIAL;
@@ -592,6 +785,18 @@ int MiniReader::doOpen(const char *url, const char *encoding)
     d_baseURL  = nonNullStr(url);
     d_encoding = nonNullStr(encoding);
 
+    if (d_inPlaceBuffer) {
+        // The scanning functions rely on the input ending with a null
+        // character, so set the last character of the buffer aside and
+        // replace it with one.  'readInput' restores that character once the
+        // scan reaches it.
+
+        d_endPtr          = d_startPtr + d_memSize - 1;
+        d_inPlaceLastChar = *d_endPtr;
+        *d_endPtr         = '\0';
+        return 0;                                                     // RETURN
+    }
+
     return (readInput() > 0) ? 0 : -1;
 }
 
@@ -614,6 +819,25 @@ int MiniReader::open(const char *buffer,
     return doOpen(url, encoding);
 }
 
+int MiniReader::openInPlace(char        *buffer,
+                            size_t       size,
+                            const char  *url,
+                            const char  *encoding)
+{
+    if (d_state != ST_CLOSED) {
+        return -1;                                                    // RETURN
+    }
+
+    if (buffer == 0 || size == 0) {
+        return -1;                                                    // RETURN
+    }
+
+    d_inPlaceBuffer = buffer;
+    d_memSize = size;
+
+    return doOpen(url, encoding);
+}
+
 int MiniReader::open(const char *filename, const char *encoding)
 {
     if (d_state != ST_CLOSED) {
@@ -669,7 +893,7 @@ MiniReader::getLineNumber() const
 int
 MiniReader::getColumnNumber() const
 {
-    return static_cast<int>(d_scanPtr - d_linePtr) + 1;
+    return getCurrentPosition() - d_lineOffset + 1;
 }
 
 Reader::NodeType
@@ -896,14 +1120,19 @@ MiniReader::searchCommentCDataOrEndElementName(const bsl::string& name)
 {
     BSLS_ASSERT(!name.empty());
 
-    static const char strSet[] = "\n<";
-
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
-        if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
+        // find '<', counting the NLs on the way
+        int         numNewLines = 0;
+        const char *lastNewLine = 0;
+        d_scanPtr = const_cast<char *>(u::findSymbol(d_scanPtr,
+                                                     d_endPtr,
+                                                     '<',
+                                                     &numNewLines,
+                                                     &lastNewLine));
+        addNewLines(numNewLines, lastNewLine);
+        if (d_scanPtr == d_endPtr) { // No '<' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
                 return e_STRINGTYPE_NONE;                             // RETURN
@@ -911,11 +1140,7 @@ MiniReader::searchCommentCDataOrEndElementName(const bsl::string& name)
             continue;                                               // CONTINUE
         }
 
-        checkForNewLine();
         const int ch = getChar();
-        if (ch == '\n') {
-            continue;                                               // CONTINUE
-        }
 
         if (ch == '<') {
             if ('!' == peekChar()) {
@@ -992,14 +1217,19 @@ MiniReader::searchElementName(const bsl::string& name)
 {
     BSLS_ASSERT(!name.empty());
 
-    static const char strSet[] = { "\n<" };
-
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
-        if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
+        // find '<', counting the NLs on the way
+        int         numNewLines = 0;
+        const char *lastNewLine = 0;
+        d_scanPtr = const_cast<char *>(u::findSymbol(d_scanPtr,
+                                                     d_endPtr,
+                                                     '<',
+                                                     &numNewLines,
+                                                     &lastNewLine));
+        addNewLines(numNewLines, lastNewLine);
+        if (d_scanPtr == d_endPtr) { // No '<' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
                 return e_STRINGTYPE_NONE;                             // RETURN
@@ -1007,11 +1237,7 @@ MiniReader::searchElementName(const bsl::string& name)
             continue;                                               // CONTINUE
         }
 
-        checkForNewLine();
         const int ch = getChar();
-        if (ch == '\n') {
-            continue;                                               // CONTINUE
-        }
         if (ch == '<') {
             currentNode().d_startPos = getCurrentPosition() - 1;
             if (peekChar() == '/') {
@@ -1235,8 +1461,7 @@ MiniReader::skipSpaces()
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(u::findNonBlank(d_scanPtr, d_endPtr));
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1257,21 +1482,16 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
-
     while (1) {
-        // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
-
-        if (symbol == *d_scanPtr) {
-            return symbol;                                            // RETURN
-        }
-
-        if (checkForNewLine()) {
-            ++d_scanPtr;        //skip NL
-            continue;
-        }
+        // find 'symbol', counting the NLs on the way
+        int         numNewLines = 0;
+        const char *lastNewLine = 0;
+        d_scanPtr = const_cast<char *>(u::findSymbol(d_scanPtr,
+                                                     d_endPtr,
+                                                     symbol,
+                                                     &numNewLines,
+                                                     &lastNewLine));
+        addNewLines(numNewLines, lastNewLine);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1288,12 +1508,12 @@ MiniReader::scanForSymbol(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
-
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(u::findSymbolOrSpace(d_scanPtr,
+                                                            d_endPtr,
+                                                            symbol,
+                                                            symbol));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1309,14 +1529,12 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
-        symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
-    };
-
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(u::findSymbolOrSpace(d_scanPtr,
+                                                            d_endPtr,
+                                                            symbol1,
+                                                            symbol2));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -2120,7 +2338,6 @@ MiniReader::rebasePointers(const char *newBase, size_t newLength)
     d_attrValPtr  = const_cast<char *>(rebasePointer(d_attrValPtr, newBase));
 
     // adjust scan info ptrs
-    d_linePtr = const_cast<char *>(rebasePointer(d_linePtr, newBase));
     d_scanPtr = const_cast<char *>(rebasePointer(d_scanPtr, newBase));
     d_markPtr = const_cast<char *>(rebasePointer(d_markPtr, newBase));
 
@@ -2135,6 +2352,29 @@ MiniReader::readInput()
         return 0;                                                     // RETURN
     }
 
+    if (d_inPlaceBuffer) {
+        // The scan of the caller's buffer reached the character set aside by
+        // 'doOpen'.  Copy the unconsumed characters, followed by that
+        // character, to the parse buffer and continue from there.
+
+        size_t numLeft = d_endPtr - d_markPtr;
+
+        d_streamOffset += static_cast<int>(d_markPtr - d_startPtr);
+
+        if (d_parseBuf.size() < numLeft + 2) {
+            d_parseBuf.resize(numLeft + 2);
+        }
+        bsl::memcpy(&d_parseBuf.front(), d_markPtr, numLeft);
+        d_parseBuf[numLeft]     = d_inPlaceLastChar;
+        d_parseBuf[numLeft + 1] = '\0';
+
+        d_inPlaceBuffer = 0;
+        d_memSize       = 0;
+
+        rebasePointers(&d_parseBuf.front(), numLeft + 1);
+        return 1;                                                     // RETURN
+    }
+
     size_t numConsumed = d_markPtr - d_startPtr;
     size_t numLeft = d_endPtr - d_markPtr;
 
@@ -41,6 +41,18 @@ BSLS_IDENT("$Id: $")
 // To get stricter data validation, clients should use a concrete
 // implementation of a validating reader (such as 'a_xercesc::Reader') instead.
 //
+// Parsing a Buffer in Place
+// - - - - - - - - - - - - -
+// The 'open' methods copy the document, a chunk at a time, into a parse
+// buffer owned by the reader, where names and values are null-terminated and
+// character references are replaced as the nodes are read.  When the caller
+// owns a modifiable buffer holding the whole document (e.g., one read from a
+// file, or a file mapped privately, i.e., copy-on-write), 'openInPlace'
+// parses that buffer directly and so avoids the copy; only the characters of
+// the last node are ever moved to the parse buffer.  Note that a buffer that
+// cannot be written, such as a file mapped read-only or shared with other
+// processes, must be parsed with 'open(const char *, bsl::size_t, ...)'.
+//
 ///Usage
 ///-----
 // For this example, we will use 'balxml::MiniReader' to read each node in an
@@ -386,6 +398,13 @@ class MiniReader :  public Reader {
     bsl::streambuf           *d_streamBuf;
     const char *              d_memStream;      // memory buffer to decode from
     size_t                    d_memSize;        // memory buffer size
+    char                     *d_inPlaceBuffer;  // caller's buffer parsed in
+                                                // place, or 0
+
+    char                      d_inPlaceLastChar;
+                                                // last character of
+                                                // 'd_inPlaceBuffer', replaced
+                                                // by a null terminator
 
     char                     *d_startPtr;
     char                     *d_endPtr;
@@ -399,8 +418,8 @@ class MiniReader :  public Reader {
     char                     *d_attrValPtr;
 
     int                       d_lineNum;      // current line number
-    char                     *d_linePtr;      // position of the beginning of
-                                              // current line
+    int                       d_lineOffset;   // position in the document of
+                                              // the beginning of current line
 
     ErrorInfo                 d_errorInfo;
     XmlResolverFunctor        d_resolver;
@@ -510,6 +529,11 @@ class MiniReader :  public Reader {
         // Check if the current symbol is NL and adjust line number
         // information.  Return 'true' if it was NL, otherwise 'false'
 
+    void  addNewLines(int numNewLines, const char *lastNewLine);
+        // Add the specified 'numNewLines' to the line number and, if
+        // 'numNewLines' is not 0, set the beginning of the current line to
+        // follow the specified 'lastNewLine' in the parse buffer.
+
     int   skipSpaces();
         // Skip spaces and set the current position to first non space
         // character or to end if there is no non space found symbol.  Return
@@ -633,6 +657,25 @@ class MiniReader :  public Reader {
         // Note that the reader will not be on a valid node until
         // 'advanceToNextNode' is called.
 
+    int openInPlace(char        *buffer,
+                    bsl::size_t  size,
+                    const char  *url = 0,
+                    const char  *encoding = 0);
+        // Set up the reader for parsing the data contained in the specified
+        // (XML) modifiable 'buffer' of the specified 'size' directly, without
+        // first copying it into the internal parse buffer, set the base URL
+        // to the optionally specified 'url' and set the encoding value to the
+        // optionally specified 'encoding' ("ASCII", "UTF-8", etc).  Return 0
+        // on success and non-zero otherwise.  The 'url' and 'encoding' are
+        // treated as by 'open(const char *, bsl::size_t, ...)'.  The contents
+        // of 'buffer' are overwritten as the parse progresses, and the
+        // strings returned by the accessors may refer into 'buffer'.  The
+        // behavior is undefined unless 'buffer' is not otherwise accessed
+        // until 'close' is called.  It is an error to 'open' a reader that is
+        // already open.  Note that the reader will not be on a valid node
+        // until 'advanceToNextNode' is called.  See
+        // {Parsing a Buffer in Place}.
+
     virtual void close();
         // Close the reader.  Most, but not all state is reset.  Specifically,
         // the XML resource resolver and the prefix stack remain.  The prefix
@@ -936,12 +979,22 @@ bool MiniReader::checkForNewLine()
 {
     if (*d_scanPtr == '\n') {
         ++d_lineNum;
-        d_linePtr = d_scanPtr + 1;
+        d_lineOffset = getCurrentPosition() + 1;
         return true;                                                  // RETURN
     }
     return false;
 }
 
+inline
+void MiniReader::addNewLines(int numNewLines, const char *lastNewLine)
+{
+    if (numNewLines) {
+        d_lineNum    += numNewLines;
+        d_lineOffset  = static_cast<int>(d_streamOffset
+                                         + (lastNewLine - d_startPtr)) + 1;
+    }
+}
+
 inline
 int MiniReader::getCharAndSet(char ch)
 {
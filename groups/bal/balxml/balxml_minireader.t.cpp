@@ -11,13 +11,17 @@
 
 #include <balxml_errorinfo.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
 #include <bslim_testutil.h>
 
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>     // strlen()
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_iostream.h>
@@ -25,6 +29,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -75,30 +80,34 @@ using namespace bsl;
 //
 // [14] advanceToEndNodeRawBare()
 //
-// [15] MiniReader(basicAllocator)
-// [15] MiniReader(bufSize, basicAllocator)
-// [15] ~MiniReader()
-// [15] setPrefixStack(balxml::PrefixStack *prefixes)
-// [15] prefixStack()
-// [15] open()
-// [15] isOpen()
-// [15] documentEncoding()
-// [15] nodeType()
-// [15] nodeName()
-// [15] nodeHasValue()
-// [15] nodeValue()
-// [15] nodeDepth()
-// [15] numAttributes()
-// [15] isEmptyElement()
-// [15] advanceToNextNode()
-// [15] lookupAttribute(ElemAtt a, int index)
-// [15] lookupAttribute(ElemAtt a, char *qname)
-// [15] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
-// [15] lookupAttribute(ElemAtt a, char *localname, int nsId)
+// [16] int openInPlace(char *, size_t, const char *, const char *);
+//
+// [17] MiniReader(basicAllocator)
+// [17] MiniReader(bufSize, basicAllocator)
+// [17] ~MiniReader()
+// [17] setPrefixStack(balxml::PrefixStack *prefixes)
+// [17] prefixStack()
+// [17] open()
+// [17] isOpen()
+// [17] documentEncoding()
+// [17] nodeType()
+// [17] nodeName()
+// [17] nodeHasValue()
+// [17] nodeValue()
+// [17] nodeDepth()
+// [17] numAttributes()
+// [17] isEmptyElement()
+// [17] advanceToNextNode()
+// [17] lookupAttribute(ElemAtt a, int index)
+// [17] lookupAttribute(ElemAtt a, char *qname)
+// [17] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
+// [17] lookupAttribute(ElemAtt a, char *localname, int nsId)
 //-----------------------------------------------------------------------------
 // [-1] INTERACTIVE TEST
+// [-2] PERFORMANCE: PARSING THROUGHPUT
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [15] VECTORIZED SCANNING
+// [17] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -796,6 +805,313 @@ void advanceN(Obj& reader, bsl::size_t n)
     }
 }
 
+struct ScanNode {
+    // This 'struct' describes a node expected to be read from a document
+    // built by 'makeScanDocument'.
+
+    balxml::Reader::NodeType d_type;
+    bsl::string              d_name;       // node name, if checked
+    bsl::string              d_value;      // node value, if checked
+    bsl::string              d_attrName;   // name of the only attribute
+    bsl::string              d_attrValue;  // value of the only attribute
+};
+
+void addScanNode(bsl::vector<ScanNode>    *nodes,
+                 balxml::Reader::NodeType  type,
+                 const bsl::string&        name,
+                 const bsl::string&        value,
+                 const bsl::string&        attrName = bsl::string(),
+                 const bsl::string&        attrValue = bsl::string())
+    // Append to the specified 'nodes' a node of the specified 'type', 'name',
+    // and 'value', having an attribute of the optionally specified 'attrName'
+    // and 'attrValue' unless 'attrName' is empty.
+{
+    ScanNode node;
+    node.d_type      = type;
+    node.d_name      = name;
+    node.d_value     = value;
+    node.d_attrName  = attrName;
+    node.d_attrValue = attrValue;
+    nodes->push_back(node);
+}
+
+bsl::string blanks(int length)
+    // Return a run of spaces, tabs, and carriage returns of the specified
+    // 'length'.
+{
+    static const char BLANKS[] = " \t\r";
+
+    bsl::string result;
+    for (int i = 0; i < length; ++i) {
+        result += BLANKS[i % 3];
+    }
+    return result;
+}
+
+void makeScanDocument(bsl::string           *document,
+                      bsl::vector<ScanNode> *nodes,
+                      int                    padding)
+    // Load into the specified 'document' a document holding element names,
+    // attribute names and values, runs of whitespace, and text values of
+    // every length from 0 to 47, many of them spanning several lines, and
+    // preceded by a comment of the specified 'padding' characters, and load
+    // into the specified 'nodes' the nodes expected to be read from it.
+{
+    typedef balxml::Reader Reader;
+
+    nodes->clear();
+
+    const bsl::string comment(padding, 'c');
+
+    document->assign("<?xml version='1.0'?>\n<!--");
+    *document += comment;
+    *document += "-->\n<root>";
+
+    addScanNode(nodes, Reader::e_NODE_TYPE_XML_DECLARATION,
+                "xml", "version='1.0'");
+    addScanNode(nodes, Reader::e_NODE_TYPE_WHITESPACE, "", "\n");
+    addScanNode(nodes, Reader::e_NODE_TYPE_COMMENT, "", comment);
+    addScanNode(nodes, Reader::e_NODE_TYPE_WHITESPACE, "", "\n");
+    addScanNode(nodes, Reader::e_NODE_TYPE_ELEMENT, "root", "");
+
+    for (int length = 0; length < 48; ++length) {
+        const bsl::string name     = "n" + bsl::string(length, 'x');
+        const bsl::string attrName = "a" + bsl::string(length, 'y');
+        const char        quote    = length % 2 ? '"' : '\'';
+
+        bsl::string attrValue;
+        for (int i = 0; i < length; ++i) {
+            attrValue += i % 9 == 8 ? '\n' : static_cast<char>('A' + i % 26);
+        }
+
+        bsl::string text;
+        for (int i = 0; i < length; ++i) {
+            text += i % 11 == 10 ? '\n' : static_cast<char>('a' + i % 26);
+        }
+        bsl::string rawText = text;
+        if (0 != length && 0 == length % 3) {
+            rawText += "&lt;";
+            text    += "<";
+        }
+
+        *document += "\n<" + name + blanks(1 + length % 20) + attrName + "="
+                   + quote + attrValue + quote + blanks(length % 4) + ">"
+                   + rawText + "</" + name + ">";
+
+        addScanNode(nodes, Reader::e_NODE_TYPE_WHITESPACE, "", "\n");
+        addScanNode(nodes, Reader::e_NODE_TYPE_ELEMENT, name, "",
+                    attrName, attrValue);
+        if (0 != length) {
+            addScanNode(nodes, Reader::e_NODE_TYPE_TEXT, "", text);
+        }
+        addScanNode(nodes, Reader::e_NODE_TYPE_END_ELEMENT, name, "");
+    }
+
+    *document += "\n</root>\n";
+
+    addScanNode(nodes, Reader::e_NODE_TYPE_WHITESPACE, "", "\n");
+    addScanNode(nodes, Reader::e_NODE_TYPE_END_ELEMENT, "root", "");
+    addScanNode(nodes, Reader::e_NODE_TYPE_WHITESPACE, "", "\n");
+}
+
+void checkScan(int                          line,
+               Obj                         *reader,
+               const bsl::string&           document,
+               const bsl::vector<ScanNode>& nodes)
+    // Read all the nodes of the specified 'document' open in the specified
+    // 'reader' and verify that they match the specified 'nodes' and that the
+    // line and column numbers reported after each element and end element
+    // are the location of the end of that node in 'document'.  Report
+    // failures against the specified 'line'.
+{
+    typedef balxml::Reader Reader;
+
+    for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+        const ScanNode& EXP = nodes[i];
+
+        int rc = reader->advanceToNextNode();
+        ASSERTV(line, i, rc, 0 == rc);
+        if (0 != rc) {
+            return;                                                   // RETURN
+        }
+        ASSERTV(line, i, EXP.d_type, reader->nodeType(),
+                EXP.d_type == reader->nodeType());
+
+        if (Reader::e_NODE_TYPE_ELEMENT     == EXP.d_type
+         || Reader::e_NODE_TYPE_END_ELEMENT == EXP.d_type) {
+            ASSERTV(line, i, EXP.d_name, reader->nodeName(),
+                    EXP.d_name == reader->nodeName());
+
+            // The reader is positioned at the end of an element or an end
+            // element once it is read.
+
+            const int end = reader->nodeEndPosition();
+            ASSERTV(line, i, end, 0 < end && end <= (int)document.size());
+
+            const bsl::string::size_type newline = document.rfind('\n',
+                                                                  end - 1);
+            const int EXP_LINE = 1 + static_cast<int>(
+                 bsl::count(document.begin(), document.begin() + end, '\n'));
+            const int EXP_COLUMN = newline == npos
+                                   ? end + 1
+                                   : end - static_cast<int>(newline);
+
+            ASSERTV(line, i, EXP_LINE, reader->getLineNumber(),
+                    EXP_LINE == reader->getLineNumber());
+            ASSERTV(line, i, EXP_COLUMN, reader->getColumnNumber(),
+                    EXP_COLUMN == reader->getColumnNumber());
+        }
+        else {
+            ASSERTV(line, i, EXP.d_value, reader->nodeValue(),
+                    EXP.d_value == reader->nodeValue());
+        }
+
+        if (Reader::e_NODE_TYPE_ELEMENT == EXP.d_type
+         && Reader::e_NODE_TYPE_ELEMENT == reader->nodeType()) {
+            const int NUM_ATTRIBUTES = EXP.d_attrName.empty() ? 0 : 1;
+            ASSERTV(line, i, reader->numAttributes(),
+                    NUM_ATTRIBUTES == reader->numAttributes());
+            if (NUM_ATTRIBUTES && 1 == reader->numAttributes()) {
+                balxml::ElementAttribute attribute;
+                ASSERTV(line, i, 0 == reader->lookupAttribute(&attribute, 0));
+                ASSERTV(line, i, EXP.d_attrName, attribute.qualifiedName(),
+                        EXP.d_attrName == attribute.qualifiedName());
+                ASSERTV(line, i, EXP.d_attrValue, attribute.value(),
+                        EXP.d_attrValue == attribute.value());
+            }
+        }
+    }
+    ASSERTV(line, 1 == reader->advanceToNextNode());
+}
+
+void compareReaders(int line, Obj *reader, Obj *oracle)
+    // Read all the nodes of the documents open in the specified 'reader' and
+    // 'oracle' in lockstep, and verify that the status of each advance, and
+    // the type, name, value, depth, attributes, positions, line, and column
+    // of each node, are the same.  Report failures against the specified
+    // 'line'.
+{
+    for (int i = 0; ; ++i) {
+        const int rc  = reader->advanceToNextNode();
+        const int EXP = oracle->advanceToNextNode();
+        ASSERTV(line, i, EXP, rc, EXP == rc);
+        if (EXP != rc || 0 != rc) {
+            return;                                                   // RETURN
+        }
+
+        ASSERTV(line, i, oracle->nodeType() == reader->nodeType());
+        ASSERTV(line, i, CHK(oracle->nodeName()), CHK(reader->nodeName()),
+                0 == bsl::strcmp(CHK(oracle->nodeName()),
+                                 CHK(reader->nodeName())));
+        ASSERTV(line, i, CHK(oracle->nodeValue()), CHK(reader->nodeValue()),
+                0 == bsl::strcmp(CHK(oracle->nodeValue()),
+                                 CHK(reader->nodeValue())));
+        ASSERTV(line, i, oracle->nodeDepth() == reader->nodeDepth());
+        ASSERTV(line, i,
+                oracle->nodeStartPosition() == reader->nodeStartPosition());
+        ASSERTV(line, i,
+                oracle->nodeEndPosition() == reader->nodeEndPosition());
+        ASSERTV(line, i, oracle->getLineNumber(), reader->getLineNumber(),
+                oracle->getLineNumber() == reader->getLineNumber());
+        ASSERTV(line, i, oracle->getColumnNumber(), reader->getColumnNumber(),
+                oracle->getColumnNumber() == reader->getColumnNumber());
+        ASSERTV(line, i,
+                oracle->numAttributes() == reader->numAttributes());
+
+        for (int j = 0; j < oracle->numAttributes(); ++j) {
+            balxml::ElementAttribute attribute;
+            balxml::ElementAttribute expected;
+            reader->lookupAttribute(&attribute, j);
+            oracle->lookupAttribute(&expected, j);
+            ASSERTV(line, i, j, 0 == bsl::strcmp(expected.qualifiedName(),
+                                                 attribute.qualifiedName()));
+            ASSERTV(line, i, j, 0 == bsl::strcmp(expected.value(),
+                                                 attribute.value()));
+        }
+    }
+}
+
+void makeTradeDocument(bsl::string *document, int numTrades)
+    // Load into the specified 'document' an FpML-like confirmation message
+    // holding the specified 'numTrades' trades.  Each trade is about 1.5K
+    // of indented markup mixing attributes, short values, character
+    // references, comments, and a long text note.
+{
+    document->assign(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<dataDocument xmlns=\"http://www.fpml.org/FpML-5/confirmation\"\n"
+        "              fpmlVersion=\"5-10\">\n");
+
+    for (int i = 0; i < numTrades; ++i) {
+        bsl::ostringstream ss;
+        ss << "  <trade id=\"T" << i << "\">\n"
+              "    <!-- trade " << i << " booked by the rates desk -->\n"
+              "    <tradeHeader>\n"
+              "      <partyTradeIdentifier>\n"
+              "        <partyReference href=\"party1\"/>\n"
+              "        <tradeId tradeIdScheme="
+              "\"http://www.partyA.com/swaps/trade-id\">TW" << 9000 + i
+           << "</tradeId>\n"
+              "      </partyTradeIdentifier>\n"
+              "      <tradeDate>2026-01-15</tradeDate>\n"
+              "    </tradeHeader>\n"
+              "    <swap>\n"
+              "      <swapStream id=\"floatLeg" << i << "\">\n"
+              "        <payerPartyReference href=\"party1\"/>\n"
+              "        <receiverPartyReference href=\"party2\"/>\n"
+              "        <calculationPeriodDates id=\"floatingCalcPeriodDates\">"
+              "\n"
+              "          <effectiveDate>\n"
+              "            <unadjustedDate>2026-01-19</unadjustedDate>\n"
+              "            <dateAdjustments>\n"
+              "              <businessDayConvention>NONE"
+              "</businessDayConvention>\n"
+              "            </dateAdjustments>\n"
+              "          </effectiveDate>\n"
+              "        </calculationPeriodDates>\n"
+              "        <notionalAmount>50000000.00</notionalAmount>\n"
+              "        <currency currencyScheme="
+              "\"http://www.fpml.org/coding-scheme/external/iso4217\">EUR"
+              "</currency>\n"
+              "        <note>Fixed &amp; floating legs &lt;ISDA 2006&gt;"
+              "</note>\n"
+              "        <description>This swap stream exchanges a floating "
+              "rate, reset every six months against the reference index "
+              "published two business days before the start of each "
+              "calculation period, for a fixed rate agreed on the trade "
+              "date.  Payments are netted and settled in the currency of "
+              "the notional amount, adjusted under the modified following "
+              "business day convention in both the London and the Target "
+              "business centers.</description>\n"
+              "      </swapStream>\n"
+              "    </swap>\n"
+              "  </trade>\n";
+        document->append(ss.str());
+    }
+    document->append("</dataDocument>\n");
+}
+
+int countNodes(bsl::size_t *numNodes, Obj *reader)
+    // Read every node of the document open in the specified 'reader',
+    // touching the name, value, and attributes of each, and load the number
+    // of nodes read into the specified 'numNodes'.  Return the status of the
+    // last call to 'advanceToNextNode'.
+{
+    bsl::size_t count = 0;
+    int         rc;
+    while (0 == (rc = reader->advanceToNextNode())) {
+        ++count;
+        reader->nodeName();
+        reader->nodeValue();
+        for (int i = 0; i < reader->numAttributes(); ++i) {
+            balxml::ElementAttribute attribute;
+            reader->lookupAttribute(&attribute, i);
+        }
+    }
+    *numNodes = count;
+    return rc;
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -812,7 +1128,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -856,6 +1172,285 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 16: {
+        // --------------------------------------------------------------------
+        // PARSING A BUFFER IN PLACE
+        //
+        // Concerns:
+        //: 1 Parsing a buffer in place reads the same nodes, at the same
+        //:   positions, lines, and columns, as parsing a copy of the buffer,
+        //:   and reports the same errors.
+        //:
+        //: 2 The strings returned by the accessors refer into the buffer.
+        //:
+        //: 3 The last character of the buffer, which the reader sets aside
+        //:   during the parse, is read like any other, including when it is
+        //:   the only character.
+        //:
+        //: 4 'openInPlace' fails if the reader is open, or if the buffer is
+        //:   null or empty, and the reader may be reopened by any method once
+        //:   closed.
+        //
+        // Plan:
+        //: 1 Parse a copy of each document from a table of valid and invalid
+        //:   documents, and of a large generated document, with
+        //:   'openInPlace' and with 'open' in lockstep, and compare the nodes
+        //:   read.  (C-1, 3)
+        //:
+        //: 2 Read the documents built by 'makeScanDocument' in place, and
+        //:   verify the nodes, line numbers, and column numbers.  (C-1, 3)
+        //:
+        //: 3 Verify that the name of the first node read lies within the
+        //:   buffer.  (C-2)
+        //:
+        //: 4 Call 'openInPlace' with invalid arguments and on an open reader,
+        //:   and reopen a closed reader.  (C-4)
+        //
+        // Testing:
+        //   int openInPlace(char *, size_t, const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPARSING A BUFFER IN PLACE"
+                               << "\n=========================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\tComparing with 'open'." << bsl::endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_document;
+            } DATA[] = {
+                //LINE  DOCUMENT
+                //----  ------------------------------------------------------
+                { L_,   "<r/>"                                               },
+                { L_,   "<r></r>"                                            },
+                { L_,   "<r>text</r>"                                        },
+                { L_,   "<r a='1' b=\"2\"/>"                                 },
+                { L_,   "<r>\n  <e>x &amp; y</e>\n</r>\n"                    },
+                { L_,   "<?xml version='1.0'?>\n<r/>"                        },
+                { L_,   "<r><!-- comment --></r>"                            },
+                { L_,   "<r><![CDATA[<x>]]></r>"                             },
+                { L_,   "<r>t</r>  "                                         },
+                { L_,   "<"                                                  },
+                { L_,   "<r"                                                 },
+                { L_,   "<r>"                                                },
+                { L_,   "<r>t"                                               },
+                { L_,   "<r a='1"                                            },
+                { L_,   "<r></r>x"                                           },
+                { L_,   "<r></s>"                                            },
+                { L_,   "<!-- open"                                          },
+                { L_,   "x"                                                  },
+                { L_,   " "                                                  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE = DATA[ti].d_line;
+                const bsl::string  DOCUMENT(DATA[ti].d_document);
+
+                if (veryVerbose) { T_ P_(LINE) P(DOCUMENT) }
+
+                bsl::vector<char> buffer(DOCUMENT.begin(), DOCUMENT.end());
+
+                Obj mX(&testAllocator);  Obj mY(&testAllocator);
+                ASSERTV(LINE, 0 == mX.openInPlace(&buffer[0], buffer.size()));
+                ASSERTV(LINE, 0 == mY.open(DOCUMENT.data(), DOCUMENT.size()));
+
+                compareReaders(LINE, &mX, &mY);
+            }
+
+            bsl::string document;
+            makeTradeDocument(&document, 50);
+
+            bsl::vector<char> buffer(document.begin(), document.end());
+
+            Obj mX(&testAllocator);  Obj mY(&testAllocator);
+            ASSERT(0 == mX.openInPlace(&buffer[0], buffer.size()));
+            ASSERT(0 == mY.open(document.data(), document.size()));
+
+            compareReaders(L_, &mX, &mY);
+        }
+
+        if (verbose) bsl::cout << "\tReading every length." << bsl::endl;
+        {
+            for (int padding = 0; padding < 16; ++padding) {
+                bsl::string           document;
+                bsl::vector<ScanNode> nodes;
+                makeScanDocument(&document, &nodes, padding);
+
+                bsl::vector<char> buffer(document.begin(), document.end());
+
+                Obj mX(&testAllocator);
+                ASSERTV(padding,
+                        0 == mX.openInPlace(&buffer[0], buffer.size()));
+                checkScan(L_, &mX, document, nodes);
+            }
+        }
+
+        if (verbose) bsl::cout << "\tNot copying the buffer." << bsl::endl;
+        {
+            char buffer[] = "<root attr='value'>text</root>";
+
+            Obj mX(&testAllocator);
+            ASSERT(0 == mX.openInPlace(buffer, sizeof buffer - 1, "url"));
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(buffer + 1 == mX.nodeName());
+
+            balxml::ElementAttribute attribute;
+            ASSERT(0 == mX.lookupAttribute(&attribute, 0));
+            ASSERT(buffer + 12 == attribute.value());
+
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(buffer + 19 == mX.nodeValue());
+            ASSERT(0 == bsl::strcmp("text", mX.nodeValue()));
+
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("root", mX.nodeName()));
+            ASSERT(1 == mX.advanceToNextNode());
+        }
+
+        if (verbose) bsl::cout << "\tOpening and closing." << bsl::endl;
+        {
+            char buffer[] = "<r>t</r>";
+            char other[]  = "<s/>";
+
+            Obj mX(&testAllocator);
+            ASSERT(0 != mX.openInPlace(0, 8));
+            ASSERT(0 != mX.openInPlace(buffer, 0));
+            ASSERT(!mX.isOpen());
+
+            ASSERT(0 == mX.openInPlace(buffer, 8));
+            ASSERT( mX.isOpen());
+            ASSERT(0 != mX.openInPlace(other, 4));
+            ASSERT(0 != mX.open("<s/>", 4));
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("r", mX.nodeName()));
+            mX.close();
+            ASSERT(!mX.isOpen());
+
+            ASSERT(0 == mX.open("<s/>", 4));
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("s", mX.nodeName()));
+            ASSERT(1 == mX.advanceToNextNode());
+            mX.close();
+
+            ASSERT(0 == mX.openInPlace(other, 4));
+            ASSERT(0 == mX.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("s", mX.nodeName()));
+            ASSERT(mX.isEmptyElement());
+            ASSERT(1 == mX.advanceToNextNode());
+            mX.close();
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // VECTORIZED SCANNING
+        //
+        // Concerns:
+        //: 1 Names, attribute values, runs of whitespace, and text values of
+        //:   any length are found exactly, whatever their alignment and
+        //:   whether or not they straddle the end of the data read so far.
+        //:
+        //: 2 The line number reported after reading a node counts the
+        //:   newlines within attribute values and text values, and the
+        //:   column number is measured from the last of them, including
+        //:   once the beginning of the line is no longer in the buffer.
+        //:
+        //: 3 A null character within the input ends the scan of a name, an
+        //:   attribute value, or a text value, and the parse fails there.
+        //
+        // Plan:
+        //: 1 Build documents holding names, values, and runs of whitespace
+        //:   of every length from 0 to 47, preceded by a comment of every
+        //:   length from 0 to 15 so that each run starts at every alignment,
+        //:   and read them with the smallest and the largest buffer size
+        //:   through 'open' from memory and from a stream buffer.  Verify the
+        //:   nodes, the line numbers, and the column numbers.  (C-1..2)
+        //:
+        //: 2 Parse documents having a null character at every offset up to
+        //:   40 within a name, an attribute value, and a text value, and
+        //:   verify that the parse fails at that node.  (C-3)
+        //
+        // Testing:
+        //   VECTORIZED SCANNING
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nVECTORIZED SCANNING"
+                               << "\n===================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\tReading every length." << bsl::endl;
+        {
+            static const int BUFFER_SIZES[] = { 1024, 131072 };
+
+            for (int padding = 0; padding < 16; ++padding) {
+                bsl::string           document;
+                bsl::vector<ScanNode> nodes;
+                makeScanDocument(&document, &nodes, padding);
+                ASSERT(document.size() > 4 * 1024);
+                ASSERT(document.size() < 131072);
+
+                for (int si = 0; si < 2; ++si) {
+                    const int BUFFER_SIZE = BUFFER_SIZES[si];
+
+                    if (veryVerbose) { T_ P_(padding) P(BUFFER_SIZE) }
+
+                    {
+                        Obj mX(BUFFER_SIZE, &testAllocator);
+                        ASSERT(0 == mX.open(document.data(), document.size()));
+                        checkScan(L_, &mX, document, nodes);
+                    }
+                    {
+                        bdlsb::FixedMemInStreamBuf streamBuf(document.data(),
+                                                             document.size());
+
+                        Obj mX(BUFFER_SIZE, &testAllocator);
+                        ASSERT(0 == mX.open(&streamBuf));
+                        checkScan(L_, &mX, document, nodes);
+                    }
+                }
+            }
+        }
+
+        if (verbose) bsl::cout << "\tEmbedded null characters." << bsl::endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_prefix;
+                const char *d_suffix;
+                int         d_numNodes;  // nodes read before the failure
+            } DATA[] = {
+                //LINE  PREFIX         SUFFIX          NUM NODES
+                //----  -------------  --------------  ---------
+                { L_,   "<e",          "x/>",          0         },
+                { L_,   "<r a='",      "x'/>",         0         },
+                { L_,   "<r a=\"",     "x\"/>",        0         },
+                { L_,   "<r>t",        "x</r>",        1         },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE      = DATA[ti].d_line;
+                const int NUM_NODES = DATA[ti].d_numNodes;
+
+                for (int offset = 0; offset <= 40; ++offset) {
+                    bsl::string document(DATA[ti].d_prefix);
+                    document.append(offset, 'x');
+                    document += '\0';
+                    document += DATA[ti].d_suffix;
+
+                    Obj mX(&testAllocator);
+                    ASSERT(0 == mX.open(document.data(), document.size()));
+
+                    int rc = 0;
+                    for (int i = 0; i < NUM_NODES; ++i) {
+                        rc = mX.advanceToNextNode();
+                        ASSERTV(LINE, offset, i, rc, 0 == rc);
+                    }
+                    rc = mX.advanceToNextNode();
+                    ASSERTV(LINE, offset, rc, 0 > rc);
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // ADVANCE TO END NODE RAW BARE TEST
@@ -4121,6 +4716,97 @@ int main(int argc, char *argv[])
         reader.close();
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the parsing throughput, in MB/s, of large documents read
+        //:   from a memory buffer, from a stream buffer, and in place.
+        //
+        // Plan:
+        //: 1 Generate an FpML-like document of about 12MB and read all of its
+        //:   nodes 'N' times through each 'open' method and 'openInPlace'
+        //:   (excluding the time taken to copy the document to the buffer
+        //:   parsed in place), touching the name, the value, and the
+        //:   attributes of every node.
+        //
+        // Testing:
+        //   PERFORMANCE: PARSING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE: PARSING THROUGHPUT"
+                               << "\n===============================\n";
+
+        const int N = argc > 2 ? bsl::atoi(argv[2]) : 5;
+
+        bsl::string document;
+        makeTradeDocument(&document, 8000);
+        const double MEGABYTES = static_cast<double>(N) *
+                                 static_cast<double>(document.size()) / 1.0e6;
+
+        bsl::size_t expected = 0;
+        {
+            Obj reader;
+            ASSERT(0 == reader.open(document.data(), document.size()));
+            ASSERT(1 == countNodes(&expected, &reader));
+        }
+
+        bsls::Stopwatch timer;
+        {
+            Obj reader;
+            timer.start();
+            for (int i = 0; i < N; ++i) {
+                bsl::size_t numNodes;
+                reader.open(document.data(), document.size());
+                ASSERT(1 == countNodes(&numNodes, &reader));
+                ASSERTV(expected, numNodes, expected == numNodes);
+                reader.close();
+            }
+            timer.stop();
+        }
+        bsl::cout << "open(buffer):    "
+                  << MEGABYTES / timer.accumulatedWallTime() << " MB/s\n";
+
+        timer.reset();
+        {
+            Obj reader;
+            timer.start();
+            for (int i = 0; i < N; ++i) {
+                bsl::size_t                numNodes;
+                bdlsb::FixedMemInStreamBuf streamBuf(document.data(),
+                                                     document.size());
+                reader.open(&streamBuf);
+                ASSERT(1 == countNodes(&numNodes, &reader));
+                ASSERTV(expected, numNodes, expected == numNodes);
+                reader.close();
+            }
+            timer.stop();
+        }
+        bsl::cout << "open(streambuf): "
+                  << MEGABYTES / timer.accumulatedWallTime() << " MB/s\n";
+
+        timer.reset();
+        {
+            Obj               reader;
+            bsl::vector<char> buffer(document.size());
+            for (int i = 0; i < N; ++i) {
+                bsl::size_t numNodes;
+                bsl::memcpy(&buffer[0], document.data(), document.size());
+                timer.start();
+                reader.openInPlace(&buffer[0], buffer.size());
+                ASSERT(1 == countNodes(&numNodes, &reader));
+                ASSERTV(expected, numNodes, expected == numNodes);
+                reader.close();
+                timer.stop();
+            }
+        }
+        bsl::cout << "openInPlace:     "
+                  << MEGABYTES / timer.accumulatedWallTime() << " MB/s\n";
+
+        bsl::cout << "document: " << document.size() << " bytes, "
+                  << expected << " nodes, " << N << " iterations\n";
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
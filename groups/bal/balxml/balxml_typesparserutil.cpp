@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_floatconvertutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -176,6 +178,17 @@ int parseDouble(double     *result,
         return BAEXML_FAILURE;                                        // RETURN
     }
 
+    // Most numbers are parsed exactly without 'strtod', and without copying
+    // 'input'.  Exponents are not allowed in the decimal format, though.
+
+    if ((!formatDecimal || (0 == bsl::memchr(input, 'e', inputLength)
+                         && 0 == bsl::memchr(input, 'E', inputLength)))
+     && 0 == bdlb::FloatConvertUtil::parseSimpleDouble(result,
+                                                       input,
+                                                       inputLength)) {
+        return BAEXML_SUCCESS;                                        // RETURN
+    }
+
     if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
@@ -0,0 +1,193 @@
+// bdlat_namelookuputil.cpp                                           -*-C++-*-
+#include <bdlat_namelookuputil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_namelookuputil_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+
+namespace {
+namespace u {
+
+enum {
+    k_MAX_NAMES      = 65535,    // most names a table can index
+
+    k_SEEDS_PER_SIZE = 64,       // seeds tried before growing the table
+
+    k_MAX_SLOTS      = 1 << 17   // largest table tried
+};
+
+typedef bsl::pair<int, int> BucketSize;  // (number of names, bucket index)
+
+bool isGreater(const BucketSize& lhs, const BucketSize& rhs)
+    // Return 'true' if the specified 'lhs' bucket holds more names than the
+    // specified 'rhs' bucket, or as many names and a lower index, and 'false'
+    // otherwise.
+{
+    return lhs.first > rhs.first
+        || (lhs.first == rhs.first && lhs.second < rhs.second);
+}
+
+int tryBuild(bsl::vector<unsigned short>                *displacements,
+             bsl::vector<unsigned short>                *slots,
+             const bsl::vector<bsls::Types::Uint64>&     hashes,
+             int                                         numBuckets,
+             int                                         numSlots)
+    // Attempt to place the names having the specified 'hashes' into the
+    // specified 'numSlots' slots, divided among the specified 'numBuckets'
+    // buckets, and, on success, load the displacement of each bucket into
+    // the specified 'displacements' and 1 plus the index of the name mapped
+    // to each slot (or 0) into the specified 'slots'.  Return 0 on success,
+    // and a non-zero value otherwise.
+{
+    const int numNames = static_cast<int>(hashes.size());
+
+    bsl::vector<bsl::vector<int> > buckets(numBuckets);
+    for (int i = 0; i < numNames; ++i) {
+        const unsigned int high = static_cast<unsigned int>(hashes[i] >> 32);
+        buckets[(high >> 16) & (numBuckets - 1)].push_back(i);
+    }
+
+    // Place the names in the fullest buckets first, while most slots are
+    // still free.
+
+    bsl::vector<BucketSize> order;
+    order.reserve(numBuckets);
+    for (int b = 0; b < numBuckets; ++b) {
+        order.push_back(BucketSize(static_cast<int>(buckets[b].size()), b));
+    }
+    bsl::sort(order.begin(), order.end(), &isGreater);
+
+    displacements->assign(numBuckets, 0);
+    slots->assign(numSlots, 0);
+
+    bsl::vector<int> placed;
+    for (int o = 0; o < numBuckets && 0 < order[o].first; ++o) {
+        const bsl::vector<int>& bucket = buckets[order[o].second];
+
+        bool found = false;
+        const int maxDisplacement = bsl::min(numSlots - 1, 0xFFFF);
+
+        for (int d = 0; d <= maxDisplacement && !found; ++d) {
+            placed.clear();
+
+            for (bsl::size_t k = 0; k < bucket.size(); ++k) {
+                const bsls::Types::Uint64 h    = hashes[bucket[k]];
+                const unsigned int        high = static_cast<unsigned int>(
+                                                                      h >> 32);
+                const unsigned int        low  = static_cast<unsigned int>(h);
+                const int                 slot = static_cast<int>(
+                              (low + static_cast<unsigned int>(d) * (high | 1))
+                            & static_cast<unsigned int>(numSlots - 1));
+
+                if (0 != (*slots)[slot]) {
+                    break;
+                }
+                (*slots)[slot] = static_cast<unsigned short>(bucket[k] + 1);
+                placed.push_back(slot);
+            }
+
+            if (placed.size() == bucket.size()) {
+                (*displacements)[order[o].second] =
+                                                static_cast<unsigned short>(d);
+                found = true;
+            }
+            else {
+                for (bsl::size_t k = 0; k < placed.size(); ++k) {
+                    (*slots)[placed[k]] = 0;
+                }
+            }
+        }
+
+        if (!found) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // struct bdlat_NameLookupUtil
+                        // ---------------------------
+
+// CLASS METHODS
+int bdlat_NameLookupUtil::build(
+                         unsigned int                          *seed,
+                         bsl::vector<unsigned short>           *displacements,
+                         bsl::vector<unsigned short>           *slots,
+                         const bsl::vector<bslstl::StringRef>&  names)
+{
+    BSLS_ASSERT(seed);
+    BSLS_ASSERT(displacements);
+    BSLS_ASSERT(slots);
+
+    if (static_cast<bsl::size_t>(u::k_MAX_NAMES) < names.size()) {
+        return -1;                                                    // RETURN
+    }
+    const int numNames = static_cast<int>(names.size());
+
+    bsl::vector<bslstl::StringRef> sorted(names);
+    bsl::sort(sorted.begin(), sorted.end());
+    if (sorted.end() != bsl::adjacent_find(sorted.begin(), sorted.end())) {
+        return -1;                                                    // RETURN
+    }
+
+    int numSlots = 1;
+    while (numSlots < numNames) {
+        numSlots <<= 1;
+    }
+
+    bsl::vector<bsls::Types::Uint64> hashes(numNames);
+    bsl::vector<unsigned short>      newDisplacements;
+    bsl::vector<unsigned short>      newSlots;
+
+    for (; numSlots <= u::k_MAX_SLOTS; numSlots <<= 1) {
+        const int numBuckets = numSlots < 2 ? 1 : numSlots / 2;
+
+        for (unsigned int s = 0; s < u::k_SEEDS_PER_SIZE; ++s) {
+            for (int i = 0; i < numNames; ++i) {
+                hashes[i] = hash(names[i].data(),
+                                 static_cast<int>(names[i].length()),
+                                 s);
+            }
+
+            if (0 == u::tryBuild(&newDisplacements,
+                                 &newSlots,
+                                 hashes,
+                                 numBuckets,
+                                 numSlots)) {
+                *seed = s;
+                displacements->swap(newDisplacements);
+                slots->swap(newSlots);
+                return 0;                                             // RETURN
+            }
+        }
+    }
+
+    return -1;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,456 @@
+// bdlat_namelookuputil.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMELOOKUPUTIL
+#define INCLUDED_BDLAT_NAMELOOKUPUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide perfect-hash lookup of 'bdlat' info objects by name.
+//
+//@CLASSES:
+//  bdlat_NameLookupTable: POD describing a precomputed perfect-hash table
+//  bdlat_NameLookupUtil: namespace for building and querying such tables
+//
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_selectioninfo, bdlat_enumeratorinfo
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlat_NameLookupUtil',
+// that builds and queries perfect-hash tables mapping the names in an array of
+// 'bdlat_AttributeInfo', 'bdlat_SelectionInfo', or 'bdlat_EnumeratorInfo'
+// objects to the corresponding array elements, and a POD 'struct',
+// 'bdlat_NameLookupTable', describing such a table.
+//
+// Types generated by 'bas_codegen.pl' resolve a name passed to
+// 'lookupAttributeInfo', 'lookupSelectionInfo', or 'fromString' by comparing
+// it with every name in the type's info array in turn.  Decoders (such as
+// those in 'baljsn' and 'balxml') perform one such lookup per element, so for
+// types with many attributes the linear search dominates the cost of
+// decoding.  A type can instead opt into a lookup that hashes the name once,
+// reads the index of the one candidate info from the table, and compares the
+// name against that candidate only, regardless of the number of names.
+//
+// The table is computed ahead of time -- typically by the code generator --
+// using the 'build' function, and emitted as constant data together with the
+// info array.  Since the table is constant-initialized, the lookup requires no
+// run-time initialization and no synchronization.  The hash function is
+// defined independently of the platform (in particular, of its byte order), so
+// a table built on one platform is valid on every other.
+//
+///Table Layout
+///------------
+// The table uses the "hash and displace" scheme.  The 64-bit hash of a name
+// (see 'hash') selects one of 'd_numBuckets' buckets, and the 16-bit
+// displacement stored for that bucket, together with the hash, selects one of
+// 'd_numSlots' slots.  Each slot holds either 0 (no name maps to the slot) or
+// 1 plus the index in the info array of the only name that does.  'build'
+// chooses the hash seed and the displacements such that no two names map to
+// the same slot.  Both 'd_numBuckets' and 'd_numSlots' are powers of two, and
+// a table for 'N' names occupies '2 * (d_numBuckets + d_numSlots)' bytes,
+// where 'd_numSlots' is usually the smallest power of two not less than 'N'.
+//
+///When to Use a Table
+///-------------------
+// A table lookup has a fixed cost (hashing the name and two dependent memory
+// reads) that a linear search of a small info array does not: the linear
+// search rejects most names by their length alone, and its comparisons stay
+// in the cache lines of the info array.  Measurements (see the performance
+// test case of this component, and of 's_baltst_test') show the table to be
+// slower than the linear search for a generated type of 11 selections, and
+// faster for types of 15 or more attributes, with the benefit growing with
+// the number of names (e.g., about 20 times faster for 300 names).
+//
+// Code generators should therefore use a table only for info arrays having at
+// least 'bdlat_NameLookupUtil::k_MIN_RECOMMENDED_NUM_NAMES' (13) names, and
+// keep the linear search for smaller ones.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Opting a Sequence Type into Perfect-Hash Lookup
+///----------------------------------------------------------
+// Suppose we have a generated sequence type, 'Point', having the attributes
+// 'x', 'y', and 'label'.  (A type this small is better served by a linear
+// search (see {When to Use a Table}); it is used here for brevity.)
+//..
+//  struct Point {
+//      enum { NUM_ATTRIBUTES = 3 };
+//
+//      static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+//
+//      static const bdlat_AttributeInfo *lookupAttributeInfo(
+//                                                     const char *name,
+//                                                     int         nameLength);
+//          // Return attribute information for the attribute indicated by
+//          // the specified 'name' of the specified 'nameLength' if the
+//          // attribute exists, and 0 otherwise.
+//
+//      // ...
+//  };
+//
+//  const bdlat_AttributeInfo Point::ATTRIBUTE_INFO_ARRAY[] = {
+//      { 0, "x",     1, "", bdlat_FormattingMode::e_DEC     },
+//      { 1, "y",     1, "", bdlat_FormattingMode::e_DEC     },
+//      { 2, "label", 5, "", bdlat_FormattingMode::e_TEXT    }
+//  };
+//..
+// First, at code generation time, we build the lookup table for the names of
+// the attributes:
+//..
+//  unsigned int                seed;
+//  bsl::vector<unsigned short> displacements;
+//  bsl::vector<unsigned short> slots;
+//
+//  int rc = bdlat_NameLookupUtil::build(&seed,
+//                                       &displacements,
+//                                       &slots,
+//                                       Point::ATTRIBUTE_INFO_ARRAY,
+//                                       Point::NUM_ATTRIBUTES);
+//  assert(0 == rc);
+//  assert(1 <= displacements.size());
+//  assert(4 <= slots.size());
+//..
+// Then, the generator emits the contents of 'seed', 'displacements', and
+// 'slots' as constant data alongside the info array.  Here, we copy them into
+// arrays of their own, standing in for the generated constants:
+//..
+//  unsigned short DISPLACEMENTS[4];
+//  unsigned short SLOTS[8];
+//  assert(displacements.size() <= 4);
+//  assert(slots.size()         <= 8);
+//  bsl::copy(displacements.begin(), displacements.end(), DISPLACEMENTS);
+//  bsl::copy(slots.begin(),         slots.end(),         SLOTS);
+//
+//  const bdlat_NameLookupTable LOOKUP_TABLE = {
+//      seed,
+//      static_cast<int>(displacements.size()),
+//      static_cast<int>(slots.size()),
+//      DISPLACEMENTS,
+//      SLOTS
+//  };
+//..
+// Note that the generated code would instead spell out the values, e.g.:
+//..
+//  const unsigned short ATTRIBUTE_LOOKUP_DISPLACEMENTS[] = { 2, 0 };
+//  const unsigned short ATTRIBUTE_LOOKUP_SLOTS[]         = { 1, 3, 0, 2 };
+//  const bdlat_NameLookupTable ATTRIBUTE_LOOKUP_TABLE    = {
+//      1,
+//      2,
+//      4,
+//      ATTRIBUTE_LOOKUP_DISPLACEMENTS,
+//      ATTRIBUTE_LOOKUP_SLOTS
+//  };
+//..
+// Next, the generated 'lookupAttributeInfo' delegates to 'lookup' instead of
+// searching the info array:
+//..
+//  const bdlat_AttributeInfo *Point::lookupAttributeInfo(
+//                                                      const char *name,
+//                                                      int         nameLength)
+//  {
+//      return bdlat_NameLookupUtil::lookup(ATTRIBUTE_LOOKUP_TABLE,
+//                                          ATTRIBUTE_INFO_ARRAY,
+//                                          name,
+//                                          nameLength);
+//  }
+//..
+// Finally, we verify that every attribute is found by name, and that other
+// names are not found:
+//..
+//  const bdlat_AttributeInfo *const INFOS = Point::ATTRIBUTE_INFO_ARRAY;
+//
+//  for (int i = 0; i < Point::NUM_ATTRIBUTES; ++i) {
+//      const bdlat_AttributeInfo& INFO = INFOS[i];
+//
+//      assert(&INFO == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE,
+//                                                   INFOS,
+//                                                   INFO.d_name_p,
+//                                                   INFO.d_nameLength));
+//  }
+//
+//  assert(0 == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE, INFOS, "z", 1));
+//  assert(0 == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE, INFOS, "labe", 4));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+                        // ============================
+                        // struct bdlat_NameLookupTable
+                        // ============================
+
+struct bdlat_NameLookupTable {
+    // This POD 'struct' describes a perfect-hash table, built by
+    // 'bdlat_NameLookupUtil::build', that maps the names in an array of
+    // 'bdlat' info objects to the indices of the objects.  It is intended to
+    // be aggregate-initialized from constant data.
+
+    // DATA
+    unsigned int          d_seed;             // hash seed
+
+    int                   d_numBuckets;       // number of displacements
+                                              // (power of 2)
+
+    int                   d_numSlots;         // number of slots (power of 2)
+
+    const unsigned short *d_displacements_p;  // displacement of each bucket
+
+    const unsigned short *d_slots_p;          // 0, or 1 + the index of the
+                                              // name mapped to each slot
+};
+
+                        // ===========================
+                        // struct bdlat_NameLookupUtil
+                        // ===========================
+
+struct bdlat_NameLookupUtil {
+    // This 'struct' provides a namespace for functions that build and query
+    // 'bdlat_NameLookupTable' perfect-hash tables.
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Uint64 load(const char *data, int length);
+        // Return the word whose bytes, from the least significant to the most
+        // significant, are the specified 'length' bytes at the specified
+        // 'data' followed by 'sizeof(bsls::Types::Uint64) - length' zero
+        // bytes.  The behavior is undefined unless '0 < length <= 8'.
+
+    static bsls::Types::Uint64 mix(bsls::Types::Uint64 value);
+        // Return the result of scrambling the bits of the specified 'value'.
+
+    static int slotIndex(const bdlat_NameLookupTable& table,
+                         bsls::Types::Uint64          hashValue);
+        // Return the index of the slot in the specified 'table' to which a
+        // name having the specified 'hashValue' maps.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MIN_RECOMMENDED_NUM_NAMES = 13
+            // Smallest number of names for which a table is expected to be
+            // faster than a linear search (see {When to Use a Table}).
+    };
+
+    // CLASS METHODS
+    template <class INFO_TYPE>
+    static int build(unsigned int                *seed,
+                     bsl::vector<unsigned short> *displacements,
+                     bsl::vector<unsigned short> *slots,
+                     const INFO_TYPE             *infoArray,
+                     int                          numInfos);
+        // Build a perfect-hash table for the names in the specified
+        // 'infoArray' of the specified 'numInfos' elements of the (template
+        // parameter) 'INFO_TYPE', and load the hash seed of the table into the
+        // specified 'seed', and its buckets and slots into the specified
+        // 'displacements' and 'slots', respectively.  Return 0 on success,
+        // and a non-zero value (with no effect) if the names are not unique
+        // or 'numInfos' exceeds 65535.  'INFO_TYPE' shall have the
+        // 'd_name_p' and 'd_nameLength' data members of
+        // 'bdlat_AttributeInfo', 'bdlat_SelectionInfo', and
+        // 'bdlat_EnumeratorInfo'.  The behavior is undefined unless
+        // '0 <= numInfos' and 'infoArray' refers to at least 'numInfos'
+        // elements.
+
+    static int build(unsigned int                          *seed,
+                     bsl::vector<unsigned short>           *displacements,
+                     bsl::vector<unsigned short>           *slots,
+                     const bsl::vector<bslstl::StringRef>&  names);
+        // Build a perfect-hash table for the specified 'names', and load the
+        // hash seed of the table into the specified 'seed', and its buckets
+        // and slots into the specified 'displacements' and 'slots',
+        // respectively.  Return 0 on success, and a non-zero value (with no
+        // effect) if 'names' are not unique or there are more than 65535 of
+        // them.  Note that 'slots' refer to 'names' by position.
+
+    static bsls::Types::Uint64 hash(const char   *name,
+                                    int           nameLength,
+                                    unsigned int  seed);
+        // Return the hash, using the specified 'seed', of the specified 'name'
+        // of the specified 'nameLength'.  The result does not depend on the
+        // platform.  The behavior is undefined unless '0 <= nameLength'.
+
+    template <class INFO_TYPE>
+    static const INFO_TYPE *lookup(const bdlat_NameLookupTable&  table,
+                                   const INFO_TYPE              *infoArray,
+                                   const char                   *name,
+                                   int                           nameLength);
+        // Return the address of the element of the specified 'infoArray'
+        // whose name is the specified 'name' of the specified 'nameLength',
+        // using the specified 'table', or 0 if there is no such element.  The
+        // behavior is undefined unless 'table' was built (see 'build') for
+        // the names in 'infoArray' and '0 <= nameLength'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct bdlat_NameLookupUtil
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 bdlat_NameLookupUtil::load(const char *data, int length)
+{
+    BSLS_ASSERT_SAFE(0 < length);
+    BSLS_ASSERT_SAFE(length <= 8);
+
+    bsls::Types::Uint64 result = 0;
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // Avoid a variable-length 'memcpy': load the (possibly overlapping) first
+    // and last four bytes, or the first, middle, and last byte, and combine
+    // them into the same zero-padded word.
+
+    if (4 <= length) {
+        unsigned int low;
+        unsigned int high;
+        bsl::memcpy(&low,  data,              sizeof low);
+        bsl::memcpy(&high, data + length - 4, sizeof high);
+
+        result = static_cast<bsls::Types::Uint64>(high) >> (8 * (8 - length));
+        result = low | (result << 32);
+    }
+    else {
+        const unsigned char *bytes  = reinterpret_cast<const unsigned char *>(
+                                                                         data);
+        const int            middle = length >> 1;
+        const int            last   = length - 1;
+
+        result = bytes[0]
+               | static_cast<bsls::Types::Uint64>(bytes[middle]) << 8 * middle
+               | static_cast<bsls::Types::Uint64>(bytes[last])   << 8 * last;
+    }
+#else
+    for (int i = length - 1; 0 <= i; --i) {
+        result = (result << 8) | static_cast<unsigned char>(data[i]);
+    }
+#endif
+
+    return result;
+}
+
+inline
+bsls::Types::Uint64 bdlat_NameLookupUtil::mix(bsls::Types::Uint64 value)
+{
+    value *= 0xBF58476D1CE4E5B9ULL;
+    return value ^ (value >> 31);
+}
+
+inline
+int bdlat_NameLookupUtil::slotIndex(const bdlat_NameLookupTable& table,
+                                    bsls::Types::Uint64          hashValue)
+{
+    const unsigned int high = static_cast<unsigned int>(hashValue >> 32);
+    const unsigned int low  = static_cast<unsigned int>(hashValue);
+
+    const unsigned int displacement = table.d_displacements_p[
+                                    (high >> 16) & (table.d_numBuckets - 1)];
+
+    return static_cast<int>((low + displacement * (high | 1))
+                          & static_cast<unsigned int>(table.d_numSlots - 1));
+}
+
+// CLASS METHODS
+template <class INFO_TYPE>
+int bdlat_NameLookupUtil::build(unsigned int                *seed,
+                                bsl::vector<unsigned short> *displacements,
+                                bsl::vector<unsigned short> *slots,
+                                const INFO_TYPE             *infoArray,
+                                int                          numInfos)
+{
+    BSLS_ASSERT(seed);
+    BSLS_ASSERT(displacements);
+    BSLS_ASSERT(slots);
+    BSLS_ASSERT(0 <= numInfos);
+    BSLS_ASSERT(infoArray || 0 == numInfos);
+
+    bsl::vector<bslstl::StringRef> names;
+    names.reserve(numInfos);
+    for (int i = 0; i < numInfos; ++i) {
+        names.push_back(bslstl::StringRef(infoArray[i].d_name_p,
+                                          infoArray[i].d_nameLength));
+    }
+
+    return build(seed, displacements, slots, names);
+}
+
+inline
+bsls::Types::Uint64 bdlat_NameLookupUtil::hash(const char   *name,
+                                               int           nameLength,
+                                               unsigned int  seed)
+{
+    BSLS_ASSERT_SAFE(name || 0 == nameLength);
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+
+    bsls::Types::Uint64 result = mix((seed + 0x9E3779B97F4A7C15ULL)
+                               ^ static_cast<bsls::Types::Uint64>(nameLength));
+
+    while (8 <= nameLength) {
+        result      = mix(result ^ load(name, 8));
+        name       += 8;
+        nameLength -= 8;
+    }
+    if (0 < nameLength) {
+        result = mix(result ^ load(name, nameLength));
+    }
+
+    result *= 0x94D049BB133111EBULL;
+    return result ^ (result >> 32);
+}
+
+template <class INFO_TYPE>
+inline
+const INFO_TYPE *bdlat_NameLookupUtil::lookup(
+                                      const bdlat_NameLookupTable&  table,
+                                      const INFO_TYPE              *infoArray,
+                                      const char                   *name,
+                                      int                           nameLength)
+{
+    const bsls::Types::Uint64 hashValue = hash(name,
+                                               nameLength,
+                                               table.d_seed);
+    const int                 entry     = table.d_slots_p[
+                                                 slotIndex(table, hashValue)];
+
+    if (0 == entry) {
+        return 0;                                                     // RETURN
+    }
+
+    const INFO_TYPE& info = infoArray[entry - 1];
+
+    return nameLength == info.d_nameLength
+        && 0 == bsl::memcmp(info.d_name_p, name, nameLength)
+           ? &info
+           : 0;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
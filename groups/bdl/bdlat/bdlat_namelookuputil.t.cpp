@@ -0,0 +1,943 @@
+// bdlat_namelookuputil.t.cpp                                         -*-C++-*-
+#include <bdlat_namelookuputil.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_enumeratorinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_selectioninfo.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a utility that builds perfect-hash tables
+// over the names of 'bdlat' info objects, and looks names up in such tables.
+// We verify that the hash function is stable (the tables are built ahead of
+// time and must remain valid on every platform), that 'build' produces a
+// collision-free table for sets of names of many sizes, and rejects sets it
+// cannot index, and that 'lookup' finds exactly the names in the table.
+// ----------------------------------------------------------------------------
+// CONSTANTS
+// [ 1] k_MIN_RECOMMENDED_NUM_NAMES
+//
+// CLASS METHODS
+// [ 3] int build(seed, displacements, slots, const vector<StringRef>& n);
+// [ 4] int build(seed, displacements, slots, const INFO_TYPE *a, int n);
+// [ 2] Uint64 hash(const char *name, int nameLength, unsigned int seed);
+// [ 3] const INFO_TYPE *lookup(table, infoArray, name, nameLength);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: LINEAR SEARCH AND PERFECT HASH
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_NameLookupUtil  Util;
+typedef bdlat_NameLookupTable Table;
+typedef bsls::Types::Uint64   Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isPowerOfTwo(bsl::size_t value)
+    // Return 'true' if the specified 'value' is a power of two, and 'false'
+    // otherwise.
+{
+    return 0 != value && 0 == (value & (value - 1));
+}
+
+void makeNames(bsl::vector<bsl::string> *names, int numNames)
+    // Load into the specified 'names' the specified 'numNames' distinct names
+    // in the style of generated attribute names, differing in their lengths,
+    // their prefixes, and their suffixes.
+{
+    static const char *const PREFIXES[] = {
+        "element", "e", "attributeWithALongerName", "selection", "x", ""
+    };
+    const int NUM_PREFIXES = sizeof PREFIXES / sizeof *PREFIXES;
+
+    names->clear();
+    for (int i = 0; i < numNames; ++i) {
+        bsl::ostringstream oss;
+        oss << PREFIXES[i % NUM_PREFIXES] << i;
+        names->push_back(oss.str());
+    }
+}
+
+const bdlat_AttributeInfo *linearLookup(const bdlat_AttributeInfo *infoArray,
+                                        int                        numInfos,
+                                        const char                *name,
+                                        int                        nameLength)
+    // Return the address of the element of the specified 'infoArray', having
+    // the specified 'numInfos' elements, whose name is the specified 'name' of
+    // the specified 'nameLength', or 0 if there is no such element, searching
+    // the array in order as generated code does.
+{
+    for (int i = 0; i < numInfos; ++i) {
+        const bdlat_AttributeInfo& info = infoArray[i];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Opting a Sequence Type into Perfect-Hash Lookup
+///----------------------------------------------------------
+// Suppose we have a generated sequence type, 'Point', having the attributes
+// 'x', 'y', and 'label':
+//..
+    struct Point {
+        enum { NUM_ATTRIBUTES = 3 };
+
+        static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+        static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+            // Return attribute information for the attribute indicated by
+            // the specified 'name' of the specified 'nameLength' if the
+            // attribute exists, and 0 otherwise.
+
+        // ...
+    };
+
+    const bdlat_AttributeInfo Point::ATTRIBUTE_INFO_ARRAY[] = {
+        { 0, "x",     1, "", bdlat_FormattingMode::e_DEC     },
+        { 1, "y",     1, "", bdlat_FormattingMode::e_DEC     },
+        { 2, "label", 5, "", bdlat_FormattingMode::e_TEXT    }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// First, at code generation time, we build the lookup table for the names of
+// the attributes:
+//..
+    unsigned int                seed;
+    bsl::vector<unsigned short> displacements;
+    bsl::vector<unsigned short> slots;
+
+    int rc = bdlat_NameLookupUtil::build(&seed,
+                                         &displacements,
+                                         &slots,
+                                         Point::ATTRIBUTE_INFO_ARRAY,
+                                         Point::NUM_ATTRIBUTES);
+    ASSERT(0 == rc);
+    ASSERT(1 <= displacements.size());
+    ASSERT(4 <= slots.size());
+//..
+// Then, the generator emits the contents of 'seed', 'displacements', and
+// 'slots' as constant data alongside the info array.  Here, we copy them into
+// arrays of their own, standing in for the generated constants:
+//..
+    unsigned short DISPLACEMENTS[4];
+    unsigned short SLOTS[8];
+    ASSERT(displacements.size() <= 4);
+    ASSERT(slots.size()         <= 8);
+    bsl::copy(displacements.begin(), displacements.end(), DISPLACEMENTS);
+    bsl::copy(slots.begin(),         slots.end(),         SLOTS);
+
+    const bdlat_NameLookupTable LOOKUP_TABLE = {
+        seed,
+        static_cast<int>(displacements.size()),
+        static_cast<int>(slots.size()),
+        DISPLACEMENTS,
+        SLOTS
+    };
+//..
+// Note that the generated code would instead spell out the values, e.g.:
+//..
+//  const unsigned short ATTRIBUTE_LOOKUP_DISPLACEMENTS[] = { 2, 0 };
+//  const unsigned short ATTRIBUTE_LOOKUP_SLOTS[]         = { 1, 3, 0, 2 };
+//  const bdlat_NameLookupTable ATTRIBUTE_LOOKUP_TABLE    = {
+//      1,
+//      2,
+//      4,
+//      ATTRIBUTE_LOOKUP_DISPLACEMENTS,
+//      ATTRIBUTE_LOOKUP_SLOTS
+//  };
+//..
+// Next, the generated 'lookupAttributeInfo' delegates to 'lookup' instead of
+// searching the info array:
+//..
+//  const bdlat_AttributeInfo *Point::lookupAttributeInfo(
+//                                                      const char *name,
+//                                                      int         nameLength)
+//  {
+//      return bdlat_NameLookupUtil::lookup(ATTRIBUTE_LOOKUP_TABLE,
+//                                          ATTRIBUTE_INFO_ARRAY,
+//                                          name,
+//                                          nameLength);
+//  }
+//..
+// Finally, we verify that every attribute is found by name, and that other
+// names are not found:
+//..
+    const bdlat_AttributeInfo *const INFOS = Point::ATTRIBUTE_INFO_ARRAY;
+
+    for (int i = 0; i < Point::NUM_ATTRIBUTES; ++i) {
+        const bdlat_AttributeInfo& INFO = INFOS[i];
+
+        ASSERT(&INFO == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE,
+                                                     INFOS,
+                                                     INFO.d_name_p,
+                                                     INFO.d_nameLength));
+    }
+
+    ASSERT(0 == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE, INFOS, "z", 1));
+    ASSERT(0 == bdlat_NameLookupUtil::lookup(LOOKUP_TABLE, INFOS, "labe", 4));
+//..
+
+        if (veryVerbose) {
+            P(seed);
+            for (bsl::size_t i = 0; i < displacements.size(); ++i) {
+                T_; P_(i); P(displacements[i]);
+            }
+            for (bsl::size_t i = 0; i < slots.size(); ++i) {
+                T_; P_(i); P(slots[i]);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'build' AND 'lookup' FOR INFO TYPES
+        //
+        // Concerns:
+        //: 1 The 'build' function template reads the names of
+        //:   'bdlat_AttributeInfo', 'bdlat_SelectionInfo', and
+        //:   'bdlat_EnumeratorInfo' arrays, and 'lookup' returns the address
+        //:   of the matching element of each.
+        //:
+        //: 2 A failed 'build' has no effect on its output arguments.
+        //
+        // Plan:
+        //: 1 For an array of each info type, build a table, and verify that
+        //:   every element is found by its name and that a name not in the
+        //:   array is not found.  (C-1)
+        //:
+        //: 2 Build a table for an array with a repeated name, and verify that
+        //:   'build' fails and leaves its output arguments unchanged.  (C-2)
+        //
+        // Testing:
+        //   int build(seed, displacements, slots, const INFO_TYPE *a, int n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'build' AND 'lookup' FOR INFO TYPES"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        const bdlat_AttributeInfo ATTRIBUTES[] = {
+            { 1, "name",        4, "", bdlat_FormattingMode::e_TEXT },
+            { 2, "homeAddress", 11, "", bdlat_FormattingMode::e_DEFAULT },
+            { 3, "age",         3, "", bdlat_FormattingMode::e_DEC },
+        };
+        const bdlat_SelectionInfo SELECTIONS[] = {
+            { 1, "selection1",  10, "", bdlat_FormattingMode::e_DEFAULT },
+            { 2, "selection2",  10, "", bdlat_FormattingMode::e_DEFAULT },
+            { 3, "selection3",  10, "", bdlat_FormattingMode::e_DEFAULT },
+            { 4, "selection4",  10, "", bdlat_FormattingMode::e_DEFAULT },
+            { 5, "selection10", 11, "", bdlat_FormattingMode::e_DEFAULT },
+        };
+        const bdlat_EnumeratorInfo ENUMERATORS[] = {
+            { 0, "NEW_YORK",   8, "" },
+            { 1, "NEW_JERSEY", 10, "" },
+            { 2, "LONDON",     6, "" },
+        };
+        const int NUM_ATTRIBUTES  = sizeof ATTRIBUTES  / sizeof *ATTRIBUTES;
+        const int NUM_SELECTIONS  = sizeof SELECTIONS  / sizeof *SELECTIONS;
+        const int NUM_ENUMERATORS = sizeof ENUMERATORS / sizeof *ENUMERATORS;
+
+        unsigned int                seed;
+        bsl::vector<unsigned short> displacements;
+        bsl::vector<unsigned short> slots;
+
+        if (verbose) cout << "\t'bdlat_AttributeInfo'" << endl;
+        {
+            ASSERT(0 == Util::build(&seed,
+                                    &displacements,
+                                    &slots,
+                                    ATTRIBUTES,
+                                    NUM_ATTRIBUTES));
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+                ASSERTV(i, ATTRIBUTES + i == Util::lookup(
+                                                 TABLE,
+                                                 ATTRIBUTES,
+                                                 ATTRIBUTES[i].d_name_p,
+                                                 ATTRIBUTES[i].d_nameLength));
+            }
+            ASSERT(0 == Util::lookup(TABLE, ATTRIBUTES, "Name", 4));
+        }
+
+        if (verbose) cout << "\t'bdlat_SelectionInfo'" << endl;
+        {
+            ASSERT(0 == Util::build(&seed,
+                                    &displacements,
+                                    &slots,
+                                    SELECTIONS,
+                                    NUM_SELECTIONS));
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            for (int i = 0; i < NUM_SELECTIONS; ++i) {
+                ASSERTV(i, SELECTIONS + i == Util::lookup(
+                                                 TABLE,
+                                                 SELECTIONS,
+                                                 SELECTIONS[i].d_name_p,
+                                                 SELECTIONS[i].d_nameLength));
+            }
+            ASSERT(0 == Util::lookup(TABLE, SELECTIONS, "selection5", 10));
+        }
+
+        if (verbose) cout << "\t'bdlat_EnumeratorInfo'" << endl;
+        {
+            ASSERT(0 == Util::build(&seed,
+                                    &displacements,
+                                    &slots,
+                                    ENUMERATORS,
+                                    NUM_ENUMERATORS));
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            for (int i = 0; i < NUM_ENUMERATORS; ++i) {
+                ASSERTV(i, ENUMERATORS + i == Util::lookup(
+                                                TABLE,
+                                                ENUMERATORS,
+                                                ENUMERATORS[i].d_name_p,
+                                                ENUMERATORS[i].d_nameLength));
+            }
+            ASSERT(0 == Util::lookup(TABLE, ENUMERATORS, "NEW_YORK_", 9));
+        }
+
+        if (verbose) cout << "\tRepeated names." << endl;
+        {
+            const bdlat_EnumeratorInfo REPEATED[] = {
+                { 0, "A", 1, "" },
+                { 1, "B", 1, "" },
+                { 2, "A", 1, "" },
+            };
+
+            const bsl::vector<unsigned short> DISPLACEMENTS(displacements);
+            const bsl::vector<unsigned short> SLOTS(slots);
+            const unsigned int                SEED = seed;
+
+            ASSERT(0 != Util::build(&seed,
+                                    &displacements,
+                                    &slots,
+                                    REPEATED,
+                                    3));
+            ASSERT(SEED          == seed);
+            ASSERT(DISPLACEMENTS == displacements);
+            ASSERT(SLOTS         == slots);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'build' AND 'lookup'
+        //
+        // Concerns:
+        //: 1 'build' succeeds for any set of up to 65535 distinct names,
+        //:   including the empty set and sets containing the empty name.
+        //:
+        //: 2 The built table has a power-of-two number of buckets and of
+        //:   slots, at least as many slots as names, and refers to each name
+        //:   from exactly one slot.
+        //:
+        //: 3 For typical names, the number of slots is the smallest power of
+        //:   two not less than the number of names.
+        //:
+        //: 4 'lookup' finds every name in the table, and no other name,
+        //:   including prefixes and extensions of names in the table.
+        //:
+        //: 5 'build' fails for repeated names and for more than 65535 names.
+        //
+        // Plan:
+        //: 1 For every number of names from 0 to 320, and for some larger
+        //:   numbers, generate that many distinct names, build a table, and
+        //:   verify its layout.  (C-1..3)
+        //:
+        //: 2 Look up every name, and some names not in the table, in each
+        //:   table.  (C-4)
+        //:
+        //: 3 Verify that 'build' fails for a set with a repeated name, and
+        //:   for a set of 65536 names.  (C-5)
+        //
+        // Testing:
+        //   int build(seed, displacements, slots, const vector<StringRef>& n);
+        //   const INFO_TYPE *lookup(table, infoArray, name, nameLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'build' AND 'lookup'" << endl
+                          << "============================" << endl;
+
+        static const int EXTRA_SIZES[] = { 500, 512, 513, 1000, 4096 };
+        const int NUM_EXTRA_SIZES = sizeof EXTRA_SIZES / sizeof *EXTRA_SIZES;
+
+        for (int ti = 0; ti <= 320 + NUM_EXTRA_SIZES; ++ti) {
+            const int NUM_NAMES = ti <= 320 ? ti : EXTRA_SIZES[ti - 321];
+
+            bsl::vector<bsl::string> strings;
+            makeNames(&strings, NUM_NAMES);
+
+            bsl::vector<bslstl::StringRef>   names(strings.begin(),
+                                                   strings.end());
+            bsl::vector<bdlat_AttributeInfo> infos(NUM_NAMES);
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                bdlat_AttributeInfo& info = infos[i];
+                info.d_id             = i;
+                info.d_name_p         = strings[i].c_str();
+                info.d_nameLength     = static_cast<int>(strings[i].length());
+                info.d_annotation_p   = "";
+                info.d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+            }
+
+            unsigned int                seed;
+            bsl::vector<unsigned short> displacements;
+            bsl::vector<unsigned short> slots;
+
+            const int rc = Util::build(&seed, &displacements, &slots, names);
+            ASSERTV(NUM_NAMES, rc, 0 == rc);
+            if (rc) {
+                continue;
+            }
+
+            const bsl::size_t SIZE = static_cast<bsl::size_t>(NUM_NAMES);
+
+            ASSERTV(NUM_NAMES, displacements.size(),
+                    isPowerOfTwo(displacements.size()));
+            ASSERTV(NUM_NAMES, slots.size(), isPowerOfTwo(slots.size()));
+            ASSERTV(NUM_NAMES, slots.size(), SIZE <= slots.size());
+            ASSERTV(NUM_NAMES, slots.size(),
+                    slots.size() == 1 || slots.size() < 2 * SIZE);
+
+            bsl::vector<int> references(NUM_NAMES, 0);
+            for (bsl::size_t i = 0; i < slots.size(); ++i) {
+                if (slots[i]) {
+                    ASSERTV(NUM_NAMES, i, slots[i], slots[i] <= NUM_NAMES);
+                    if (slots[i] <= NUM_NAMES) {
+                        ++references[slots[i] - 1];
+                    }
+                }
+            }
+            ASSERTV(NUM_NAMES,
+                    bsl::vector<int>(NUM_NAMES, 1) == references);
+
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const bsl::string& NAME = strings[i];
+                const int          LEN  = static_cast<int>(NAME.length());
+
+                ASSERTV(NUM_NAMES, NAME,
+                        &infos[i] == Util::lookup(TABLE,
+                                                  infos.data(),
+                                                  NAME.data(),
+                                                  LEN));
+
+                const bsl::string EXTENDED = NAME + "_";
+                ASSERTV(NUM_NAMES, NAME,
+                        0 == Util::lookup(TABLE,
+                                          infos.data(),
+                                          EXTENDED.data(),
+                                          LEN + 1));
+
+                if (0 < LEN) {
+                    bsl::string changed(NAME);
+                    changed[LEN - 1] = '#';
+                    ASSERTV(NUM_NAMES, NAME,
+                            0 == Util::lookup(TABLE,
+                                              infos.data(),
+                                              changed.data(),
+                                              LEN));
+                }
+            }
+
+            if (0 < NUM_NAMES) {
+                // Every name made by 'makeNames' ends in a digit, so neither
+                // the empty name nor "#" is in the set.
+
+                ASSERTV(NUM_NAMES,
+                        0 == Util::lookup(TABLE, infos.data(), "", 0));
+                ASSERTV(NUM_NAMES,
+                        0 == Util::lookup(TABLE, infos.data(), "#", 1));
+            }
+        }
+
+        if (verbose) cout << "\tThe empty name." << endl;
+        {
+            bsl::vector<bslstl::StringRef> names;
+            names.push_back(bslstl::StringRef("", 0));
+            names.push_back(bslstl::StringRef("a"));
+
+            unsigned int                seed;
+            bsl::vector<unsigned short> displacements;
+            bsl::vector<unsigned short> slots;
+
+            ASSERT(0 == Util::build(&seed, &displacements, &slots, names));
+
+            const bdlat_EnumeratorInfo INFOS[] = {
+                { 0, "",  0, "" },
+                { 1, "a", 1, "" },
+            };
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            ASSERT(INFOS + 0 == Util::lookup(TABLE, INFOS, "",  0));
+            ASSERT(INFOS + 1 == Util::lookup(TABLE, INFOS, "a", 1));
+            ASSERT(0         == Util::lookup(TABLE, INFOS, "b", 1));
+        }
+
+        if (verbose) cout << "\tInvalid sets of names." << endl;
+        {
+            unsigned int                seed;
+            bsl::vector<unsigned short> displacements;
+            bsl::vector<unsigned short> slots;
+
+            bsl::vector<bslstl::StringRef> names;
+            names.push_back("alpha");
+            names.push_back("beta");
+            names.push_back("alpha");
+            ASSERT(0 != Util::build(&seed, &displacements, &slots, names));
+
+            bsl::vector<bsl::string> strings;
+            makeNames(&strings, 65536);
+            names.assign(strings.begin(), strings.end());
+            ASSERT(0 != Util::build(&seed, &displacements, &slots, names));
+
+            names.pop_back();
+            ASSERT(0 == Util::build(&seed, &displacements, &slots, names));
+            ASSERTV(slots.size(), 65536 == slots.size());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'hash'
+        //
+        // Concerns:
+        //: 1 The hash of a name does not depend on the platform, so that
+        //:   tables built on one platform are valid on all.
+        //:
+        //: 2 The hash depends on exactly the 'nameLength' bytes at 'name'.
+        //:
+        //: 3 The hash depends on the seed.
+        //
+        // Plan:
+        //: 1 Compare the hashes of a table of names of lengths from 0 to 19,
+        //:   computed with several seeds, with expected values.  (C-1)
+        //:
+        //: 2 For every length up to 40, hash a name copied into buffers with
+        //:   different trailing bytes, and verify the hashes are equal.  Also
+        //:   verify that changing any one byte of the name, or its length,
+        //:   changes the hash.  (C-2)
+        //:
+        //: 3 Verify that the hashes of a name with 1000 consecutive seeds are
+        //:   distinct.  (C-3)
+        //
+        // Testing:
+        //   Uint64 hash(const char *name, int nameLength, unsigned int seed);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'hash'" << endl
+                          << "==============" << endl;
+
+        if (verbose) cout << "\tExpected values." << endl;
+        {
+            static const struct {
+                int           d_line;   // source line number
+                const char   *d_name_p; // name to hash
+                unsigned int  d_seed;   // seed
+                Uint64        d_exp;    // expected hash
+            } DATA[] = {
+                //LINE  NAME                   SEED    EXPECTED
+                //----  ----                   ----    --------
+                { L_,   "",                    0,      0x47848A75B935E302ULL },
+                { L_,   "",                    1,      0x994F5CC9254D54DEULL },
+                { L_,   "a",                   0,      0xD7DF07663DE0058FULL },
+                { L_,   "a",                   1,      0x10D256626C57EDD8ULL },
+                { L_,   "id",                  0,      0x41701574A9A90409ULL },
+                { L_,   "age",                 0,      0x57F3184C03D9C98BULL },
+                { L_,   "name",                0,      0x7FE927B5326C63BFULL },
+                { L_,   "city",                7,      0x2602C9B665134A62ULL },
+                { L_,   "state",               0,      0xB3A61DC9EB808ED3ULL },
+                { L_,   "street",              0,      0x94F8AEDE3DD1F099ULL },
+                { L_,   "element",             0,      0x637FE838818AAB96ULL },
+                { L_,   "element1",            0,      0x83611AA2E7903786ULL },
+                { L_,   "element19",           0,      0x120FEF4622396AA9ULL },
+                { L_,   "selection1",          3,      0xCFDCF45D576F0827ULL },
+                { L_,   "homeAddress",         0,      0xDF40E879570E3DDDULL },
+                { L_,   "VALUE1VALUE2",        0,      0x464C32F7253B2084ULL },
+                { L_,   "\x80\xff\x01\x7f",    0,      0x07045EB2FA12BBA0ULL },
+                { L_,   "anElementName17",     0,      0x504601A17EB5E0ABULL },
+                { L_,   "veryLongElementName", 0,      0xB617D170AA3FD8A3ULL },
+                { L_,   "veryLongElementName", 65537,  0xA28A4837EAD33D1CULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE = DATA[ti].d_line;
+                const char        *NAME = DATA[ti].d_name_p;
+                const unsigned int SEED = DATA[ti].d_seed;
+                const Uint64       EXP  = DATA[ti].d_exp;
+
+                const Uint64 h = Util::hash(NAME,
+                                            static_cast<int>(
+                                                          bsl::strlen(NAME)),
+                                            SEED);
+
+                if (veryVerbose) {
+                    cout << "\t\t" << LINE << ' ' << SEED << ' ' << bsl::hex
+                         << h << bsl::dec << endl;
+                }
+                ASSERTV(LINE, EXP, h, EXP == h);
+            }
+        }
+
+        if (verbose) cout << "\tDependence on the name." << endl;
+        {
+            const char NAME[] = "abcdefghijklmnopqrstuvwxyz0123456789ABCD";
+
+            for (int len = 0; len < 41; ++len) {
+                char buffer1[64];
+                char buffer2[64];
+                bsl::memset(buffer1, 'x', sizeof buffer1);
+                bsl::memset(buffer2, '\0', sizeof buffer2);
+                bsl::memcpy(buffer1 + 1, NAME, len);
+                bsl::memcpy(buffer2 + 3, NAME, len);
+
+                const Uint64 H = Util::hash(buffer1 + 1, len, 0);
+
+                ASSERTV(len, H == Util::hash(buffer2 + 3, len, 0));
+                ASSERTV(len, H != Util::hash(buffer1 + 1, len + 1, 0));
+
+                for (int i = 0; i < len; ++i) {
+                    buffer1[1 + i] ^= 1;
+                    ASSERTV(len, i, H != Util::hash(buffer1 + 1, len, 0));
+                    buffer1[1 + i] ^= 1;
+                }
+            }
+        }
+
+        if (verbose) cout << "\tDependence on the seed." << endl;
+        {
+            bsl::vector<Uint64> hashes;
+            for (unsigned int seed = 0; seed < 1000; ++seed) {
+                hashes.push_back(Util::hash("element", 7, seed));
+            }
+            bsl::sort(hashes.begin(), hashes.end());
+            ASSERT(hashes.end() == bsl::adjacent_find(hashes.begin(),
+                                                      hashes.end()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a table for a few names, and look up names in and not in
+        //:   the table.  (C-1)
+        //:
+        //: 2 Verify the value of 'k_MIN_RECOMMENDED_NUM_NAMES'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   k_MIN_RECOMMENDED_NUM_NAMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlat_EnumeratorInfo INFOS[] = {
+            { 0, "RED",   3, "" },
+            { 1, "GREEN", 5, "" },
+            { 2, "BLUE",  4, "" },
+        };
+
+        unsigned int                seed;
+        bsl::vector<unsigned short> displacements;
+        bsl::vector<unsigned short> slots;
+
+        ASSERT(0 == Util::build(&seed, &displacements, &slots, INFOS, 3));
+
+        const Table TABLE = { seed,
+                              static_cast<int>(displacements.size()),
+                              static_cast<int>(slots.size()),
+                              displacements.data(),
+                              slots.data() };
+
+        ASSERT(INFOS + 0 == Util::lookup(TABLE, INFOS, "RED",   3));
+        ASSERT(INFOS + 1 == Util::lookup(TABLE, INFOS, "GREEN", 5));
+        ASSERT(INFOS + 2 == Util::lookup(TABLE, INFOS, "BLUE",  4));
+        ASSERT(0         == Util::lookup(TABLE, INFOS, "BLUE",  3));
+        ASSERT(0         == Util::lookup(TABLE, INFOS, "CYAN",  4));
+
+        ASSERT(13 == Util::k_MIN_RECOMMENDED_NUM_NAMES);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LINEAR SEARCH AND PERFECT HASH
+        //
+        // Concerns:
+        //: 1 Report the time to look up a name by searching the info array in
+        //:   order, as generated code does, and by using a perfect-hash
+        //:   table, for types with few and with many attributes.
+        //
+        // Plan:
+        //: 1 For info arrays of 3 to 300 attributes, time looking up every
+        //:   name repeatedly using each method.  The number of repetitions
+        //:   may be given as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LINEAR SEARCH AND PERFECT HASH
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: LINEAR SEARCH AND PERFECT HASH" << endl
+             << "===========================================" << endl;
+
+        const int NUM_LOOKUPS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        static const int SIZES[] = { 3, 8, 11, 12, 16, 19, 32, 300 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int NUM_NAMES = SIZES[ti];
+
+            bsl::vector<bsl::string> strings;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                bsl::ostringstream oss;
+                oss << "element" << i + 1;
+                strings.push_back(oss.str());
+            }
+
+            bsl::vector<bdlat_AttributeInfo> infos(NUM_NAMES);
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                bdlat_AttributeInfo& info = infos[i];
+                info.d_id             = i;
+                info.d_name_p         = strings[i].c_str();
+                info.d_nameLength     = static_cast<int>(strings[i].length());
+                info.d_annotation_p   = "";
+                info.d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+            }
+
+            unsigned int                seed;
+            bsl::vector<unsigned short> displacements;
+            bsl::vector<unsigned short> slots;
+            ASSERT(0 == Util::build(&seed,
+                                    &displacements,
+                                    &slots,
+                                    infos.data(),
+                                    NUM_NAMES));
+            const Table TABLE = { seed,
+                                  static_cast<int>(displacements.size()),
+                                  static_cast<int>(slots.size()),
+                                  displacements.data(),
+                                  slots.data() };
+
+            for (int method = 0; method < 2; ++method) {
+                bsl::size_t found = 0;
+
+                int next = 0;
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    const bsl::string& NAME = strings[next];
+                    const int          LEN  = static_cast<int>(NAME.length());
+
+                    if (++next == NUM_NAMES) {
+                        next = 0;
+                    }
+
+                    const bdlat_AttributeInfo *info = method
+                       ? Util::lookup(TABLE, infos.data(), NAME.data(), LEN)
+                       : linearLookup(infos.data(),
+                                      NUM_NAMES,
+                                      NAME.data(),
+                                      LEN);
+                    found += 0 != info;
+                }
+                timer.stop();
+
+                ASSERT(static_cast<bsl::size_t>(NUM_LOOKUPS) == found);
+
+                cout << NUM_NAMES << " attributes ("
+                     << (method ? "perfect hash" : "linear search") << "): "
+                     << timer.elapsedTime() * 1e9 / NUM_LOOKUPS
+                     << " ns per lookup" << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -10,6 +10,8 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_alignmentfromtype.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -23,6 +25,21 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
+#include <bsl_cstring.h>     // 'bsl::memcmp'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLB_BITSTRINGUTIL_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+#include <immintrin.h>
+
+#define BDLB_BITSTRINGUTIL_TARGET_AVX2 __attribute__((target("avx2")))
+    // Allow the AVX2 instruction set in the annotated function only, so that
+    // the rest of the component runs on processors without it.
+#endif
 
 using namespace BloombergLP;
 using bsl::size_t;
@@ -419,6 +436,360 @@ BitPtrDiff operator-(const BitPtr& lhs, const BitPtr& rhs)
     return BitPtrDiff(retHi, retLo);
 }
 
+                        // ---------------------------
+                        // whole-word kernel functions
+                        // ---------------------------
+
+// The functions in this section do most of the work on long bit strings,
+// operating on arrays of whole 'uint64_t' words.  Each has a portable
+// implementation and, on x86-64 processors found at run time to support AVX2,
+// one processing 256 bits per instruction.
+
+const size_t k_MIN_WORDS_FOR_AVX2 = 8;
+    // The smallest number of words for which the AVX2 implementations are
+    // used.
+
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+
+bool hasAvx2()
+    // Return 'true' if the current processor supports AVX2, and 'false'
+    // otherwise.  The processor is queried only on the first call.
+{
+    static bool s_hasAvx2 = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        s_hasAvx2 = __builtin_cpu_supports("avx2");
+    }
+
+    return s_hasAvx2;
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+inline
+__m256i loadAvx2(const uint64_t *words)
+    // Return the 4 words at the specified 'words'.
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words));
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+inline
+void storeAvx2(uint64_t *words, __m256i value)
+    // Store the specified 'value' to the 4 words at the specified 'words'.
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(words), value);
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+inline
+__m256i num1PerWordAvx2(__m256i value)
+    // Return the number of set bits in each 64-bit lane of the specified
+    // 'value'.  Each byte is counted by looking up its two nibbles in a
+    // 16-entry table, and the bytes of each lane are then summed.
+{
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+
+    const __m256i lo = _mm256_and_si256(value, lowNibble);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(value, 4),
+                                        lowNibble);
+    const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, lo),
+                                          _mm256_shuffle_epi8(table, hi));
+
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+inline
+void carrySaveAdd(__m256i *high, __m256i *low, __m256i a, __m256i b, __m256i c)
+    // Add the specified 'a', 'b', and 'c' bitwise, loading the carry bits of
+    // the sums into the specified 'high' and the sum bits into the specified
+    // 'low'.
+{
+    const __m256i u = _mm256_xor_si256(a, b);
+
+    *high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    *low  = _mm256_xor_si256(u, c);
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+size_t num1WordsAvx2(const uint64_t *words, size_t numWords)
+    // Return the number of set bits in the specified 'numWords' words of the
+    // specified 'words'.  Blocks of 64 words are reduced by a Harley-Seal
+    // carry-save adder tree, so that only one vector in 16 is counted with
+    // table lookups.
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i total  = zero;
+    __m256i ones   = zero;
+    __m256i twos   = zero;
+    __m256i fours  = zero;
+    __m256i eights = zero;
+    __m256i sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+
+    const uint64_t *pw  = words;
+    const uint64_t *end = words + numWords;
+
+    for (; end - pw >= 64; pw += 64) {
+        carrySaveAdd(&twosA,    &ones,   ones,   loadAvx2(pw +  0),
+                                                 loadAvx2(pw +  4));
+        carrySaveAdd(&twosB,    &ones,   ones,   loadAvx2(pw +  8),
+                                                 loadAvx2(pw + 12));
+        carrySaveAdd(&foursA,   &twos,   twos,   twosA,  twosB);
+        carrySaveAdd(&twosA,    &ones,   ones,   loadAvx2(pw + 16),
+                                                 loadAvx2(pw + 20));
+        carrySaveAdd(&twosB,    &ones,   ones,   loadAvx2(pw + 24),
+                                                 loadAvx2(pw + 28));
+        carrySaveAdd(&foursB,   &twos,   twos,   twosA,  twosB);
+        carrySaveAdd(&eightsA,  &fours,  fours,  foursA, foursB);
+        carrySaveAdd(&twosA,    &ones,   ones,   loadAvx2(pw + 32),
+                                                 loadAvx2(pw + 36));
+        carrySaveAdd(&twosB,    &ones,   ones,   loadAvx2(pw + 40),
+                                                 loadAvx2(pw + 44));
+        carrySaveAdd(&foursA,   &twos,   twos,   twosA,  twosB);
+        carrySaveAdd(&twosA,    &ones,   ones,   loadAvx2(pw + 48),
+                                                 loadAvx2(pw + 52));
+        carrySaveAdd(&twosB,    &ones,   ones,   loadAvx2(pw + 56),
+                                                 loadAvx2(pw + 60));
+        carrySaveAdd(&foursB,   &twos,   twos,   twosA,  twosB);
+        carrySaveAdd(&eightsB,  &fours,  fours,  foursA, foursB);
+        carrySaveAdd(&sixteens, &eights, eights, eightsA, eightsB);
+
+        total = _mm256_add_epi64(total, num1PerWordAvx2(sixteens));
+    }
+
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total,
+                          _mm256_slli_epi64(num1PerWordAvx2(eights), 3));
+    total = _mm256_add_epi64(total,
+                          _mm256_slli_epi64(num1PerWordAvx2(fours),  2));
+    total = _mm256_add_epi64(total,
+                          _mm256_slli_epi64(num1PerWordAvx2(twos),   1));
+    total = _mm256_add_epi64(total, num1PerWordAvx2(ones));
+
+    for (; end - pw >= 4; pw += 4) {
+        total = _mm256_add_epi64(total, num1PerWordAvx2(loadAvx2(pw)));
+    }
+
+    size_t ret = static_cast<size_t>(_mm256_extract_epi64(total, 0) +
+                                     _mm256_extract_epi64(total, 1) +
+                                     _mm256_extract_epi64(total, 2) +
+                                     _mm256_extract_epi64(total, 3));
+
+    for (; pw < end; ++pw) {
+        ret += BitUtil::numBitsSet(*pw);
+    }
+
+    return ret;
+}
+
+template <void OPER_DO_ALIGNED_WORD(uint64_t *, uint64_t)>
+struct Avx2Operation;
+    // This 'struct' template provides a namespace for a function applying the
+    // bitwise-logical operation of 'OPER_DO_ALIGNED_WORD' to each 64-bit lane
+    // of a vector.  It is specialized for each of the operations used by
+    // 'Mover'.
+
+template <>
+struct Avx2Operation<&Imp::andEqWord> {
+    static BDLB_BITSTRINGUTIL_TARGET_AVX2
+    __m256i apply(__m256i dst, __m256i src)
+        // Return 'dst & src' for the specified 'dst' and 'src'.
+    {
+        return _mm256_and_si256(dst, src);
+    }
+};
+
+template <>
+struct Avx2Operation<&Imp::minusEqWord> {
+    static BDLB_BITSTRINGUTIL_TARGET_AVX2
+    __m256i apply(__m256i dst, __m256i src)
+        // Return 'dst & ~src' for the specified 'dst' and 'src'.
+    {
+        return _mm256_andnot_si256(src, dst);
+    }
+};
+
+template <>
+struct Avx2Operation<&Imp::orEqWord> {
+    static BDLB_BITSTRINGUTIL_TARGET_AVX2
+    __m256i apply(__m256i dst, __m256i src)
+        // Return 'dst | src' for the specified 'dst' and 'src'.
+    {
+        return _mm256_or_si256(dst, src);
+    }
+};
+
+template <>
+struct Avx2Operation<&Imp::setEqWord> {
+    static BDLB_BITSTRINGUTIL_TARGET_AVX2
+    __m256i apply(__m256i, __m256i src)
+        // Return the specified 'src'.
+    {
+        return src;
+    }
+};
+
+template <>
+struct Avx2Operation<&Imp::xorEqWord> {
+    static BDLB_BITSTRINGUTIL_TARGET_AVX2
+    __m256i apply(__m256i dst, __m256i src)
+        // Return 'dst ^ src' for the specified 'dst' and 'src'.
+    {
+        return _mm256_xor_si256(dst, src);
+    }
+};
+
+template <void OPER_DO_ALIGNED_WORD(uint64_t *, uint64_t)>
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+size_t doAlignedWordsAvx2(uint64_t       *dstWords,
+                          const uint64_t *srcWords,
+                          size_t          numWords)
+    // Apply 'OPER_DO_ALIGNED_WORD' between the words of the specified
+    // 'dstWords' and the corresponding words of the specified 'srcWords', 8
+    // at a time, for as many of the specified 'numWords' words as is possible,
+    // and return the number of words done.  Note that the words of each block
+    // of 8 are all loaded before any is stored, so this function is alias-safe
+    // provided 'dstWords <= srcWords'.
+{
+    typedef Avx2Operation<OPER_DO_ALIGNED_WORD> Operation;
+
+    size_t ii = 0;
+    for (; numWords - ii >= 8; ii += 8) {
+        const __m256i src0 = loadAvx2(srcWords + ii);
+        const __m256i src1 = loadAvx2(srcWords + ii + 4);
+        const __m256i dst0 = loadAvx2(dstWords + ii);
+        const __m256i dst1 = loadAvx2(dstWords + ii + 4);
+
+        storeAvx2(dstWords + ii,     Operation::apply(dst0, src0));
+        storeAvx2(dstWords + ii + 4, Operation::apply(dst1, src1));
+    }
+
+    return ii;
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+size_t skipWordsAvx2(const uint64_t *words, size_t numWords, uint64_t fill)
+    // Return the index of the first block of 8 words in the specified 'words'
+    // having a word that differs from the specified 'fill', or of the first
+    // word after the last whole block if there is none, given that 'words'
+    // has the specified 'numWords' words.  Note that all the words before the
+    // returned index equal 'fill'.
+{
+    const __m256i fills = _mm256_set1_epi64x(static_cast<Int64>(fill));
+
+    size_t ii = 0;
+    for (; numWords - ii >= 8; ii += 8) {
+        const __m256i diff = _mm256_or_si256(
+                           _mm256_xor_si256(loadAvx2(words + ii),     fills),
+                           _mm256_xor_si256(loadAvx2(words + ii + 4), fills));
+        if (!_mm256_testz_si256(diff, diff)) {
+            break;
+        }
+    }
+
+    return ii;
+}
+
+BDLB_BITSTRINGUTIL_TARGET_AVX2
+size_t skipWordsBackwardAvx2(const uint64_t *words,
+                             size_t          numWords,
+                             uint64_t        fill)
+    // Return the index after the last block of 8 words, counted back from the
+    // end of the specified 'words' having the specified 'numWords' words,
+    // having a word that differs from the specified 'fill', or of the first
+    // word of the last whole block if there is none.  Note that all the words
+    // from the returned index up to 'numWords' equal 'fill'.
+{
+    const __m256i fills = _mm256_set1_epi64x(static_cast<Int64>(fill));
+
+    size_t ii = numWords;
+    for (; ii >= 8; ii -= 8) {
+        const __m256i diff = _mm256_or_si256(
+                           _mm256_xor_si256(loadAvx2(words + ii - 8), fills),
+                           _mm256_xor_si256(loadAvx2(words + ii - 4), fills));
+        if (!_mm256_testz_si256(diff, diff)) {
+            break;
+        }
+    }
+
+    return ii;
+}
+
+#endif  // BDLB_BITSTRINGUTIL_X86_SIMD
+
+template <void OPER_DO_ALIGNED_WORD(uint64_t *, uint64_t)>
+inline
+void doAlignedWords(uint64_t       *dstWords,
+                    const uint64_t *srcWords,
+                    size_t          numWords)
+    // Apply 'OPER_DO_ALIGNED_WORD' between each of the specified 'numWords'
+    // words of the specified 'dstWords' and the corresponding word of the
+    // specified 'srcWords', from the lowest-order word to the highest.  Note
+    // that this function is alias-safe provided 'dstWords <= srcWords'.
+{
+    size_t ii = 0;
+
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+    if (numWords >= k_MIN_WORDS_FOR_AVX2 && hasAvx2()) {
+        ii = doAlignedWordsAvx2<OPER_DO_ALIGNED_WORD>(dstWords,
+                                                      srcWords,
+                                                      numWords);
+    }
+#endif
+
+    for (; ii < numWords; ++ii) {
+        OPER_DO_ALIGNED_WORD(&dstWords[ii], srcWords[ii]);
+    }
+}
+
+size_t findWord(const uint64_t *words, size_t numWords, uint64_t fill)
+    // Return the index of the first of the specified 'numWords' words of the
+    // specified 'words' that differs from the specified 'fill', or 'numWords'
+    // if they all equal 'fill'.
+{
+    size_t ii = 0;
+
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+    if (numWords >= k_MIN_WORDS_FOR_AVX2 && hasAvx2()) {
+        ii = skipWordsAvx2(words, numWords, fill);
+    }
+#endif
+
+    while (ii < numWords && fill == words[ii]) {
+        ++ii;
+    }
+
+    return ii;
+}
+
+size_t findWordBackward(const uint64_t *words, size_t numWords, uint64_t fill)
+    // Return the index of the last of the specified 'numWords' words of the
+    // specified 'words' that differs from the specified 'fill', or 'numWords'
+    // if they all equal 'fill'.
+{
+    size_t ii = numWords;
+
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+    if (numWords >= k_MIN_WORDS_FOR_AVX2 && hasAvx2()) {
+        ii = skipWordsBackwardAvx2(words, numWords, fill);
+    }
+#endif
+
+    while (ii > 0) {
+        if (fill != words[--ii]) {
+            return ii;                                                // RETURN
+        }
+    }
+
+    return numWords;
+}
+
                               // -----------
                               // class Mover
                               // -----------
@@ -679,10 +1050,14 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::left(
     else {
         // The source and destination locations are both aligned.
 
-        for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-            OPER_DO_ALIGNED_WORD(&dstBitString[dstIndex++],
-                                 srcBitString[ srcIndex++]);
-        }
+        const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+        doAlignedWords<OPER_DO_ALIGNED_WORD>(&dstBitString[dstIndex],
+                                             &srcBitString[ srcIndex],
+                                             numWords);
+        dstIndex += numWords;
+        srcIndex += numWords;
+        numBits  -= numWords * k_BITS_PER_UINT64;
     }
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
@@ -844,7 +1219,10 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::move(
     const BitPtr     src(srcBitString, srcIndex);
     const BitPtrDiff diff(dst - src);
 
-    if (diff > 0) {
+    // Only a destination range overlapping the source range from above must
+    // be processed from the high-order end, and 'left' is faster.
+
+    if (diff > 0 && BitPtrDiff(numBits) > diff) {
         right(dstBitString,
               dstIndex,
               srcBitString,
@@ -1570,10 +1948,10 @@ bool BitStringUtil::areEqual(const uint64_t *bitString1,
 
     const size_t lastWord = (numBits - 1) / k_BITS_PER_UINT64;
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        if (bitString1[ii] != bitString2[ii]) {
-            return false;                                             // RETURN
-        }
+    if (0 != bsl::memcmp(bitString1,
+                         bitString2,
+                         lastWord * sizeof(uint64_t))) {
+        return false;                                                 // RETURN
     }
 
     const int endPos = u32(numBits - 1) % k_BITS_PER_UINT64 + 1;
@@ -1621,12 +1999,18 @@ bool BitStringUtil::areEqual(const uint64_t *bitString1,
         // 'bitString2'.  'pos1', 'pos2', 'rem1', 'rem2', and 'nb' are no
         // longer updated or relevant.
 
-        for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-            if (*++bitString1 != *++bitString2) {
-                return false;                                         // RETURN
-            }
+        const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+        if (0 != bsl::memcmp(bitString1 + 1,
+                             bitString2 + 1,
+                             numWords * sizeof(uint64_t))) {
+            return false;                                             // RETURN
         }
 
+        bitString1 += numWords;
+        bitString2 += numWords;
+        numBits    -= numWords * k_BITS_PER_UINT64;
+
         if (0 == numBits) {
             return true;                                              // RETURN
         }
@@ -1777,18 +2161,18 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString, size_t length)
     const size_t lastWord =    (length - 1) / k_BITS_PER_UINT64;
     const int    endPos   = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    uint64_t     value    = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const uint64_t value  = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; true; value = ~bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findWordBackward(bitString, lastWord, ~0ULL);
+
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(~bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
@@ -1808,11 +2192,28 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = ~bitString[--ii]) {
+    if (lastWord > beginWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMaxIndexRaw(value);
+                                                                      // RETURN
+        }
+
+        // Search the words strictly between 'beginWord' and 'lastWord'.
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findWordBackward(bitString + beginWord + 1,
+                                                 numWords,
+                                                 ~0ULL);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                                  + Imp::find1AtMaxIndexRaw(~bitString[word]);
                                                                       // RETURN
         }
+
+        value = ~bitString[beginWord];
     }
 
     const int beginIdx = u32(begin) % k_BITS_PER_UINT64;
@@ -1832,19 +2233,17 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findWord(bitString, lastWord, ~0ULL);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = ~bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64
+                                    + Imp::find1AtMinIndexRaw(~bitString[ii]);
                                                                       // RETURN
-        }
     }
 
-    const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const int      endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const uint64_t value  = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    value = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -1868,11 +2267,25 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = ~bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        // Search the words strictly between 'beginWord' and 'lastWord'.
+
+        const size_t ii = beginWord + 1 + findWord(bitString + beginWord + 1,
+                                                   lastWord - beginWord - 1,
+                                                   ~0ULL);
+        if (ii < lastWord) {
+            return ii * k_BITS_PER_UINT64
+                                    + Imp::find1AtMinIndexRaw(~bitString[ii]);
+                                                                      // RETURN
+        }
+
+        value = ~bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -1892,18 +2305,18 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString, size_t length)
     const size_t lastWord =    (length - 1) / k_BITS_PER_UINT64;
     const int    endPos   = u32(length - 1) % k_BITS_PER_UINT64 + 1;
 
-    uint64_t     value    = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const uint64_t value  = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; true; value = bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findWordBackward(bitString, lastWord, 0);
+
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
@@ -1924,11 +2337,28 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
 
     uint64_t  value     = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = bitString[--ii]) {
+    if (lastWord > beginWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMaxIndexRaw(value);
+                                                                      // RETURN
+        }
+
+        // Search the words strictly between 'beginWord' and 'lastWord'.
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findWordBackward(bitString + beginWord + 1,
+                                                 numWords,
+                                                 0);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                                   + Imp::find1AtMaxIndexRaw(bitString[word]);
                                                                       // RETURN
         }
+
+        value = bitString[beginWord];
     }
 
     value &= ge64Raw(beginIdx);
@@ -1946,19 +2376,16 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findWord(bitString, lastWord, 0);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(bitString[ii]);
                                                                       // RETURN
-        }
     }
 
-    const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const int      endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const uint64_t value  = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    value = bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -1982,11 +2409,25 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        // Search the words strictly between 'beginWord' and 'lastWord'.
+
+        const size_t ii = beginWord + 1 + findWord(bitString + beginWord + 1,
+                                                   lastWord - beginWord - 1,
+                                                   0);
+        if (ii < lastWord) {
+            return ii * k_BITS_PER_UINT64
+                                     + Imp::find1AtMinIndexRaw(bitString[ii]);
+                                                                      // RETURN
+        }
+
+        value = bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -2015,11 +2456,13 @@ bool BitStringUtil::isAny0(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-        if (~bitString[++idx]) {
-            return true;                                              // RETURN
-        }
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (findWord(bitString + idx + 1, numWords, ~0ULL) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2049,12 +2492,13 @@ bool BitStringUtil::isAny1(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    while (numBits >= k_BITS_PER_UINT64) {
-        if (bitString[++idx]) {
-            return true;                                              // RETURN
-        }
-        numBits -= k_BITS_PER_UINT64;
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (findWord(bitString + idx + 1, numWords, 0) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2116,6 +2560,13 @@ size_t BitStringUtil::num1(const uint64_t *bitString,
                                      - 1  // adjust from 'bitString' to 'array'
                                      + 1; // preparation for pre-decrement
 
+#if defined(BDLB_BITSTRINGUTIL_X86_SIMD)
+    if (ii >= k_MIN_WORDS_FOR_AVX2 && hasAvx2()) {
+        ret += num1WordsAvx2(array, ii);
+        ii  =  0;
+    }
+#endif
+
     while (ii >= 8) {
         ret +=       BitUtil::numBitsSet(array[--ii]);
         ret +=       BitUtil::numBitsSet(array[--ii]);
@@ -8,12 +8,15 @@
 #include <bsls_alignmentfromtype.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstddef.h>     // 'bsl::size_t'
 #include <bsl_cstdlib.h>     // 'bsl::rand'
@@ -81,7 +84,9 @@ using bsl::flush;
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [23] TESTING LONG BIT STRINGS
+// [24] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: LONG BIT STRINGS
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -961,7 +966,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1116,323 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING LONG BIT STRINGS
+        //   Ensure the methods that process whole blocks of words at once
+        //   behave as on short bit strings.
+        //
+        // Concerns:
+        //: 1 'andEqual', 'minusEqual', 'orEqual', 'xorEqual', and 'copy'
+        //:   produce the same results as their oracles on bit strings long
+        //:   enough to be processed in blocks of words, whether or not the
+        //:   source and destination are word-aligned relative to each other,
+        //:   and whether or not they overlap.
+        //:
+        //: 2 'num0' and 'num1' count the bits of any range of a long bit
+        //:   string of any density.
+        //:
+        //: 3 The 'find*' methods, 'isAny0', and 'isAny1' find a single bit
+        //:   differing from a long run of cleared or set bits wherever it is,
+        //:   and wherever the searched range begins and ends.
+        //:
+        //: 4 'areEqual' detects a single differing bit in long bit strings
+        //:   wherever it is.
+        //
+        // Plan:
+        //: 1 Apply each operation to random bit strings of 160 words, for
+        //:   a variety of source and destination indices and numbers of bits,
+        //:   and for ranges in one bit string overlapping in both directions,
+        //:   and compare with the oracle applied to a separate copy of the
+        //:   source.  (C-1)
+        //:
+        //: 2 Compare 'num0' and 'num1' with 'countOnes' for a variety of
+        //:   ranges of random bit strings that are dense, sparse, all
+        //:   cleared, and all set.  (C-2)
+        //:
+        //: 3 For every fill value, and for a variety of positions, toggle the
+        //:   bit at that position in a bit string otherwise of the fill value
+        //:   and verify the results of the 'find*' and 'isAny*' methods for a
+        //:   variety of ranges, computing the expected values directly.
+        //:   (C-3)
+        //:
+        //: 4 Toggle the bit at a variety of positions in a copy of a random
+        //:   bit string, and verify the result of both 'areEqual' methods for
+        //:   a variety of ranges.  (C-4)
+        //
+        // Testing:
+        //   void andEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void minusEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void orEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void xorEqual(U64 *dBS, St dIdx, U64 *sBS, St sIdx, St nb);
+        //   void copy(U64 *dstBS, St dIdx, U64 *srcBS St sIdx, St nb);
+        //   bool areEqual(U64 *lhsBitString, U64 *rhsBitString, St numBits);
+        //   bool areEqual(U64 *lBS, St lIdx, U64 *rBS, St rIdx, St nb);
+        //   St find0AtMaxIndex(const uint64_t *bitString, St length);
+        //   St find0AtMaxIndex(U64 *bitString, St begin, St end);
+        //   St find0AtMinIndex(const uint64_t *bitString, St length);
+        //   St find0AtMinIndex(U64 *bitString, St begin, St end);
+        //   St find1AtMaxIndex(const uint64_t *bitString, St length);
+        //   St find1AtMaxIndex(U64 *bitString, St begin, St end);
+        //   St find1AtMinIndex(const uint64_t *bitString, St length);
+        //   St find1AtMinIndex(U64 *bitString, St begin, St end);
+        //   bool isAny0(const uint64_t *bitString, St index, St numBits);
+        //   bool isAny1(const uint64_t *bitString, St index, St numBits);
+        //   St num0(const uint64_t *bitString, St index, St numBits);
+        //   St num1(const uint64_t *bitString, St index, St numBits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING LONG BIT STRINGS\n"
+                          << "========================\n";
+
+        enum { k_NUM_WORDS = 160,
+               k_NUM_BITS  = k_NUM_WORDS * k_BITS_PER_UINT64 };
+
+        static const size_t INDICES[] = { 0, 1, 63, 64, 130, 512 };
+        enum { k_NUM_INDICES = sizeof INDICES / sizeof *INDICES };
+
+        uint64_t src[k_NUM_WORDS];
+        uint64_t dst[k_NUM_WORDS];
+        uint64_t exp[k_NUM_WORDS];
+
+        if (veryVerbose) cout << "Bitwise-logical operations and 'copy'\n";
+
+        typedef void (*Operation)(uint64_t       *,
+                                  size_t          ,
+                                  const uint64_t *,
+                                  size_t          ,
+                                  size_t          );
+
+        static const struct {
+            int       d_line;     // source line number
+            Operation d_op;       // method under test
+            Operation d_oracle;   // oracle, or 0 for a copy
+        } OPS[] = {
+            { L_, &Util::andEqual,   &andOracle   },
+            { L_, &Util::minusEqual, &minusOracle },
+            { L_, &Util::orEqual,    &orOracle    },
+            { L_, &Util::xorEqual,   &xorOracle   },
+            { L_, &Util::copy,       0            },
+        };
+        enum { k_NUM_OPS = sizeof OPS / sizeof *OPS };
+
+        for (int ti = 0; ti < k_NUM_OPS; ++ti) {
+            const int       LINE   = OPS[ti].d_line;
+            const Operation OP     = OPS[ti].d_op;
+            const Operation ORACLE = OPS[ti].d_oracle;
+
+            for (int di = 0; di < k_NUM_INDICES; ++di) {
+                const size_t DST_IDX = INDICES[di];
+
+                for (int si = 0; si < k_NUM_INDICES; ++si) {
+                    const size_t SRC_IDX = INDICES[si];
+                    const size_t MAX_NB  = k_NUM_BITS -
+                                                  bsl::max(DST_IDX, SRC_IDX);
+
+                    for (size_t nb = 0; nb <= MAX_NB; incSizeT(&nb, MAX_NB)) {
+                        fillWithGarbage(src, sizeof(src));
+                        fillWithGarbage(dst, sizeof(dst));
+                        wordCpy(exp, dst, sizeof(dst));
+
+                        // Separate bit strings.
+
+                        if (ORACLE) {
+                            ORACLE(exp, DST_IDX, src, SRC_IDX, nb);
+                        }
+                        else {
+                            for (size_t ii = 0; ii < nb; ++ii) {
+                                Util::assign(exp,
+                                             DST_IDX + ii,
+                                             Util::bit(src, SRC_IDX + ii));
+                            }
+                        }
+                        OP(dst, DST_IDX, src, SRC_IDX, nb);
+
+                        ASSERTV(LINE, DST_IDX, SRC_IDX, nb,
+                                0 == wordCmp(dst, exp, sizeof(dst)));
+
+                        // Overlapping ranges within 'dst', with the source
+                        // being a copy of the original 'dst'.
+
+                        wordCpy(src, dst, sizeof(dst));
+                        wordCpy(exp, dst, sizeof(dst));
+
+                        if (ORACLE) {
+                            ORACLE(exp, DST_IDX, src, SRC_IDX, nb);
+                        }
+                        else {
+                            for (size_t ii = 0; ii < nb; ++ii) {
+                                Util::assign(exp,
+                                             DST_IDX + ii,
+                                             Util::bit(src, SRC_IDX + ii));
+                            }
+                        }
+                        OP(dst, DST_IDX, dst, SRC_IDX, nb);
+
+                        ASSERTV(LINE, DST_IDX, SRC_IDX, nb,
+                                0 == wordCmp(dst, exp, sizeof(dst)));
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "'num0' and 'num1'\n";
+
+        for (int density = 0; density < 4; ++density) {
+            switch (density) {
+              case 0: {
+                fillWithGarbage(src, sizeof(src));
+              } break;
+              case 1: {
+                fillWithGarbage(src, sizeof(src));
+                fillWithGarbage(dst, sizeof(dst));
+                for (int ii = 0; ii < k_NUM_WORDS; ++ii) {
+                    src[ii] &= dst[ii] & (dst[ii] >> 7);
+                }
+              } break;
+              case 2: {
+                bsl::fill(src + 0, src + k_NUM_WORDS, 0ULL);
+              } break;
+              default: {
+                bsl::fill(src + 0, src + k_NUM_WORDS, ~0ULL);
+              } break;
+            }
+
+            for (int ii = 0; ii < k_NUM_INDICES; ++ii) {
+                const size_t IDX    = INDICES[ii];
+                const size_t MAX_NB = k_NUM_BITS - IDX;
+
+                for (size_t nb = 0; nb <= MAX_NB; incSizeT(&nb, MAX_NB)) {
+                    const size_t EXP = countOnes(src, IDX, nb);
+
+                    ASSERTV(density, IDX, nb, EXP,
+                            EXP == Util::num1(src, IDX, nb));
+                    ASSERTV(density, IDX, nb, EXP,
+                            nb - EXP == Util::num0(src, IDX, nb));
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "'find*' and 'isAny*'\n";
+
+        for (int fi = 0; fi < 2; ++fi) {
+            const bool     FILL      = fi;
+            const uint64_t FILL_WORD = FILL ? ~0ULL : 0;
+
+            for (size_t pos = 0; pos < k_NUM_BITS;
+                                           incSizeT(&pos, k_NUM_BITS - 1)) {
+                bsl::fill(src + 0, src + k_NUM_WORDS, FILL_WORD);
+                Util::assign(src, pos, !FILL);
+
+                // The only bit of value '!FILL' is at 'pos'.
+
+                {
+                    const size_t LEN = k_NUM_BITS;
+
+                    const size_t MIN_FILL = 0 != pos ? 0 : 1;
+                    const size_t MAX_FILL = LEN - 1 != pos ? LEN - 1
+                                                           : LEN - 2;
+
+                    ASSERTV(pos, pos == (FILL
+                                         ? Util::find0AtMinIndex(src, LEN)
+                                         : Util::find1AtMinIndex(src, LEN)));
+                    ASSERTV(pos, pos == (FILL
+                                         ? Util::find0AtMaxIndex(src, LEN)
+                                         : Util::find1AtMaxIndex(src, LEN)));
+                    ASSERTV(pos, MIN_FILL == (FILL
+                                         ? Util::find1AtMinIndex(src, LEN)
+                                         : Util::find0AtMinIndex(src, LEN)));
+                    ASSERTV(pos, MAX_FILL == (FILL
+                                         ? Util::find1AtMaxIndex(src, LEN)
+                                         : Util::find0AtMaxIndex(src, LEN)));
+                }
+
+                for (int bi = 0; bi < k_NUM_INDICES; ++bi) {
+                    const size_t BEGIN = INDICES[bi];
+
+                    for (size_t end = BEGIN; end <= k_NUM_BITS;
+                                                 incSizeT(&end, k_NUM_BITS)) {
+                        const bool   IN_RANGE = BEGIN <= pos && pos < end;
+                        const size_t NB       = end - BEGIN;
+
+                        const size_t EXP_MIN  = IN_RANGE ? pos
+                                                         : k_INVALID_INDEX;
+                        const size_t EXP_MAX  = EXP_MIN;
+
+                        // Expected results of searching for 'FILL'.
+
+                        size_t expMinFill = BEGIN == pos ? BEGIN + 1 : BEGIN;
+                        if (expMinFill >= end) {
+                            expMinFill = k_INVALID_INDEX;
+                        }
+
+                        size_t expMaxFill = k_INVALID_INDEX;
+                        if (end > BEGIN) {
+                            expMaxFill = end - 1;
+                            if (expMaxFill == pos) {
+                                expMaxFill = end - 1 > BEGIN
+                                             ? end - 2
+                                             : k_INVALID_INDEX;
+                            }
+                        }
+
+                        size_t min0, max0, min1, max1;
+                        min0 = Util::find0AtMinIndex(src, BEGIN, end);
+                        max0 = Util::find0AtMaxIndex(src, BEGIN, end);
+                        min1 = Util::find1AtMinIndex(src, BEGIN, end);
+                        max1 = Util::find1AtMaxIndex(src, BEGIN, end);
+
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                EXP_MIN    == (FILL ? min0 : min1));
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                EXP_MAX    == (FILL ? max0 : max1));
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                expMinFill == (FILL ? min1 : min0));
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                expMaxFill == (FILL ? max1 : max0));
+
+                        const bool ANY_FILL = k_INVALID_INDEX != expMinFill;
+
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                IN_RANGE == (FILL
+                                             ? Util::isAny0(src, BEGIN, NB)
+                                             : Util::isAny1(src, BEGIN, NB)));
+                        ASSERTV(FILL, pos, BEGIN, end,
+                                ANY_FILL == (FILL
+                                             ? Util::isAny1(src, BEGIN, NB)
+                                             : Util::isAny0(src, BEGIN, NB)));
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "'areEqual'\n";
+
+        for (size_t pos = 0; pos < k_NUM_BITS;
+                                           incSizeT(&pos, k_NUM_BITS - 1)) {
+            fillWithGarbage(src, sizeof(src));
+            wordCpy(dst, src, sizeof(src));
+            Util::assign(dst, pos, !Util::bit(src, pos));
+
+            for (size_t nb = 0; nb <= k_NUM_BITS;
+                                                 incSizeT(&nb, k_NUM_BITS)) {
+                ASSERTV(pos, nb, (pos >= nb) == Util::areEqual(src, dst, nb));
+            }
+
+            for (int ii = 0; ii < k_NUM_INDICES; ++ii) {
+                const size_t IDX    = INDICES[ii];
+                const size_t MAX_NB = k_NUM_BITS - IDX;
+
+                for (size_t nb = 0; nb <= MAX_NB; incSizeT(&nb, MAX_NB)) {
+                    const bool EXP = !(IDX <= pos && pos < IDX + nb);
+
+                    ASSERTV(pos, IDX, nb,
+                            EXP == Util::areEqual(src, IDX, dst, IDX, nb));
+                }
+            }
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
@@ -6007,6 +6329,125 @@ int main(int argc, char *argv[])
 
         if (veryVerbose) P(k_ALIGNMENT);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LONG BIT STRINGS
+        //
+        // Concerns:
+        //: 1 The methods processing long bit strings in blocks of words are
+        //:   fast across a range of lengths.
+        //
+        // Plan:
+        //: 1 For bit strings of 2^10 to 2^23 bits, time 'num1', 'andEqual',
+        //:   'xorEqual', 'copy', 'areEqual', 'find1AtMinIndex',
+        //:   'find1AtMaxIndex', and 'isAny1' applied repeatedly to the whole
+        //:   bit string, and report the rate in bits per nanosecond.  The
+        //:   searches are of a bit string whose only set bit is its last or
+        //:   first, respectively.  Report the best of several trials, to
+        //:   reduce the noise from other activity on the machine.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LONG BIT STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: LONG BIT STRINGS\n"
+                          << "==================================\n";
+
+        static const int LOG_LENGTHS[] = { 10, 13, 16, 20, 23 };
+        enum { k_NUM_LENGTHS = sizeof LOG_LENGTHS / sizeof *LOG_LENGTHS };
+
+        enum { k_MAX_WORDS = (1 << 23) / k_BITS_PER_UINT64 };
+
+        bsl::vector<uint64_t> aVec(k_MAX_WORDS);
+        bsl::vector<uint64_t> bVec(k_MAX_WORDS);
+        bsl::vector<uint64_t> zVec(k_MAX_WORDS, 0);
+        uint64_t *a = &aVec[0];
+        uint64_t *b = &bVec[0];
+        uint64_t *z = &zVec[0];
+
+        fillWithGarbage(a, k_MAX_WORDS * sizeof(uint64_t));
+        fillWithGarbage(b, k_MAX_WORDS * sizeof(uint64_t));
+
+        const char *const NAMES[] = { "num1", "andEqual", "xorEqual", "copy",
+                                      "areEqual", "find1AtMinIndex",
+                                      "find1AtMaxIndex", "isAny1" };
+        enum { k_NUM_NAMES = sizeof NAMES / sizeof *NAMES };
+
+        enum { k_NUM_TRIALS = 5 };
+
+        bsl::size_t sink = 0;
+
+        for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+            const size_t NUM_BITS = size_t(1) << LOG_LENGTHS[li];
+            const int    REPS     = static_cast<int>(
+                           bsl::max<size_t>(1, (size_t(1) << 30) / NUM_BITS));
+
+            cout << "Length 2^" << LOG_LENGTHS[li] << " bits:\n";
+
+            for (int ni = 0; ni < k_NUM_NAMES; ++ni) {
+                Util::assign1(z, NUM_BITS - 1);
+
+                double bestNs = 0;
+                for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+                    bsls::Stopwatch timer;
+                    timer.start(true);
+
+                    for (int rep = 0; rep < REPS; ++rep) {
+                        switch (ni) {
+                          case 0: {
+                            sink += Util::num1(a, 0, NUM_BITS);
+                          } break;
+                          case 1: {
+                            Util::andEqual(a, 0, b, 0, NUM_BITS);
+                          } break;
+                          case 2: {
+                            Util::xorEqual(a, 0, b, 0, NUM_BITS);
+                          } break;
+                          case 3: {
+                            Util::copy(a, 0, b, 0, NUM_BITS);
+                          } break;
+                          case 4: {
+                            sink += Util::areEqual(a, b, NUM_BITS);
+                          } break;
+                          case 5: {
+                            sink += Util::find1AtMinIndex(z, NUM_BITS);
+                          } break;
+                          case 6: {
+                            Util::assign0(z, NUM_BITS - 1);
+                            Util::assign1(z, 0);
+                            sink += Util::find1AtMaxIndex(z, NUM_BITS);
+                            Util::assign0(z, 0);
+                            Util::assign1(z, NUM_BITS - 1);
+                          } break;
+                          default: {
+                            Util::assign0(z, NUM_BITS - 1);
+                            sink += Util::isAny1(z, 0, NUM_BITS);
+                            Util::assign1(z, NUM_BITS - 1);
+                          } break;
+                        }
+                    }
+
+                    timer.stop();
+
+                    const double NS = timer.accumulatedWallTime() * 1e9;
+                    if (0 == trial || NS < bestNs) {
+                        bestNs = NS;
+                    }
+                }
+
+                Util::assign0(z, NUM_BITS - 1);
+
+                cout << "    " << bsl::setw(16) << bsl::left << NAMES[ni]
+                     << bsl::right << bsl::setw(10) << bsl::fixed
+                     << bsl::setprecision(1)
+                     << static_cast<double>(NUM_BITS) * REPS / bestNs
+                     << " bits/ns\n";
+            }
+        }
+
+        if (veryVerbose) P(sink);
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND.\n";
         testStatus = -1;
@@ -0,0 +1,209 @@
+// bdlb_chacha20randomgenerator.cpp                                   -*-C++-*-
+#include <bdlb_chacha20randomgenerator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_chacha20randomgenerator_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// 'computeBlocks' computes 'k_NUM_BLOCKS' consecutive 64-byte blocks of key
+// stream at a time, iterating over the blocks in the innermost loops, so that
+// compilers can hold the same word of each block in the lanes of a vector
+// register.  The blocks of a buffer are numbered from 0 for each key, which
+// is safe because no key is used for more than one buffer.
+
+namespace BloombergLP {
+namespace bdlb {
+namespace {
+
+enum {
+    k_BLOCK_SIZE = 64,  // bytes of key stream per ChaCha20 block
+    k_NUM_BLOCKS = 4    // blocks computed at a time by 'computeBlocks'
+};
+
+const bsl::uint32_t k_CONSTANTS[4] = {
+    0x61707865, 0x3320646e, 0x79622d32, 0x6b206574  // "expand 32-byte k"
+};
+
+inline
+bsl::uint32_t loadLittleEndian(const unsigned char *bytes)
+    // Return the 32-bit word encoded in little-endian order in the 4 bytes at
+    // the specified 'bytes'.
+{
+    return  static_cast<bsl::uint32_t>(bytes[0])
+         | (static_cast<bsl::uint32_t>(bytes[1]) <<  8)
+         | (static_cast<bsl::uint32_t>(bytes[2]) << 16)
+         | (static_cast<bsl::uint32_t>(bytes[3]) << 24);
+}
+
+inline
+void storeLittleEndian(unsigned char *bytes, bsl::uint32_t word)
+    // Encode the specified 'word' in little-endian order into the 4 bytes at
+    // the specified 'bytes'.
+{
+    bytes[0] = static_cast<unsigned char>(word);
+    bytes[1] = static_cast<unsigned char>(word >>  8);
+    bytes[2] = static_cast<unsigned char>(word >> 16);
+    bytes[3] = static_cast<unsigned char>(word >> 24);
+}
+
+inline
+void quarterRound(bsl::uint32_t (*x)[k_NUM_BLOCKS], int a, int b, int c, int d)
+    // Apply the ChaCha quarter round to the words at the specified indices
+    // 'a', 'b', 'c', and 'd' of each of the blocks whose words are held in
+    // the columns of the specified 'x'.
+{
+    for (int i = 0; i != k_NUM_BLOCKS; ++i) {
+        x[a][i] += x[b][i];
+        x[d][i] ^= x[a][i];
+        x[d][i]  = (x[d][i] << 16) | (x[d][i] >> 16);
+        x[c][i] += x[d][i];
+        x[b][i] ^= x[c][i];
+        x[b][i]  = (x[b][i] << 12) | (x[b][i] >> 20);
+        x[a][i] += x[b][i];
+        x[d][i] ^= x[a][i];
+        x[d][i]  = (x[d][i] <<  8) | (x[d][i] >> 24);
+        x[c][i] += x[d][i];
+        x[b][i] ^= x[c][i];
+        x[b][i]  = (x[b][i] <<  7) | (x[b][i] >> 25);
+    }
+}
+
+void computeBlocks(unsigned char       *result,
+                   const bsl::uint32_t *key,
+                   bsl::uint64_t        counter)
+    // Load into the specified 'result' the 'k_NUM_BLOCKS' blocks of the key
+    // stream of ChaCha20 with the specified 'key' and a zero nonce, starting
+    // with the block having the specified 'counter'.
+{
+    bsl::uint32_t input[16][k_NUM_BLOCKS];
+    for (int i = 0; i != k_NUM_BLOCKS; ++i) {
+        for (int word = 0; word != 4; ++word) {
+            input[word][i] = k_CONSTANTS[word];
+        }
+        for (int word = 0; word != 8; ++word) {
+            input[4 + word][i] = key[word];
+        }
+        input[12][i] = static_cast<bsl::uint32_t>(counter + i);
+        input[13][i] = static_cast<bsl::uint32_t>((counter + i) >> 32);
+        input[14][i] = 0;
+        input[15][i] = 0;
+    }
+
+    bsl::uint32_t x[16][k_NUM_BLOCKS];
+    bsl::memcpy(x, input, sizeof x);
+
+    for (int round = 0; round != 20; round += 2) {
+        quarterRound(x, 0, 4,  8, 12);
+        quarterRound(x, 1, 5,  9, 13);
+        quarterRound(x, 2, 6, 10, 14);
+        quarterRound(x, 3, 7, 11, 15);
+        quarterRound(x, 0, 5, 10, 15);
+        quarterRound(x, 1, 6, 11, 12);
+        quarterRound(x, 2, 7,  8, 13);
+        quarterRound(x, 3, 4,  9, 14);
+    }
+
+    for (int i = 0; i != k_NUM_BLOCKS; ++i) {
+        for (int word = 0; word != 16; ++word) {
+            storeLittleEndian(result + i * k_BLOCK_SIZE + word * 4,
+                              x[word][i] + input[word][i]);
+        }
+    }
+}
+
+void erase(void *memory, bsl::size_t numBytes)
+    // Overwrite with zeros the specified 'numBytes' at the specified
+    // 'memory', in a way that the compiler does not elide even if 'memory' is
+    // not read afterwards.
+{
+    volatile unsigned char *bytes = static_cast<unsigned char *>(memory);
+    while (numBytes--) {
+        *bytes++ = 0;
+    }
+}
+
+}  // close unnamed namespace
+
+                       // -----------------------------
+                       // class ChaCha20RandomGenerator
+                       // -----------------------------
+
+// PRIVATE MANIPULATORS
+void ChaCha20RandomGenerator::refill()
+{
+    for (int block = 0;
+         block != k_BUFFER_SIZE / k_BLOCK_SIZE;
+         block += k_NUM_BLOCKS) {
+        computeBlocks(d_buffer + block * k_BLOCK_SIZE, d_key, block);
+    }
+
+    for (int word = 0; word != 8; ++word) {
+        d_key[word] = loadLittleEndian(d_buffer + word * 4);
+    }
+    bsl::memset(d_buffer, 0, k_SEED_SIZE);
+    d_position = k_SEED_SIZE;
+}
+
+// CREATORS
+ChaCha20RandomGenerator::ChaCha20RandomGenerator(const unsigned char *seed)
+{
+    this->seed(seed);
+}
+
+ChaCha20RandomGenerator::~ChaCha20RandomGenerator()
+{
+    erase(d_key, sizeof d_key);
+    erase(d_buffer, sizeof d_buffer);
+}
+
+// MANIPULATORS
+void ChaCha20RandomGenerator::getRandomBytes(unsigned char *buffer,
+                                             bsl::size_t    numBytes)
+{
+    while (numBytes) {
+        if (k_BUFFER_SIZE == d_position) {
+            refill();
+        }
+
+        const bsl::size_t numCopied = bsl::min<bsl::size_t>(
+                                                  numBytes,
+                                                  k_BUFFER_SIZE - d_position);
+        bsl::memcpy(buffer, d_buffer + d_position, numCopied);
+        bsl::memset(d_buffer + d_position, 0, numCopied);
+
+        d_position += numCopied;
+        buffer     += numCopied;
+        numBytes   -= numCopied;
+    }
+}
+
+void ChaCha20RandomGenerator::seed(const unsigned char *seed)
+{
+    for (int word = 0; word != 8; ++word) {
+        d_key[word] = loadLittleEndian(seed + word * 4);
+    }
+    refill();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
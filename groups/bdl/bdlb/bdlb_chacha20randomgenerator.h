@@ -0,0 +1,174 @@
+// bdlb_chacha20randomgenerator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLB_CHACHA20RANDOMGENERATOR
+#define INCLUDED_BDLB_CHACHA20RANDOMGENERATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fast, cryptographically secure random-byte generator.
+//
+//@CLASSES:
+//  bdlb::ChaCha20RandomGenerator: random-byte generator based on ChaCha20
+//
+//@SEE_ALSO: bdlb_randomdevice, bdlb_guidutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlb::ChaCha20RandomGenerator', that expands a 32-byte seed into an
+// unbounded sequence of random bytes using the key stream of the ChaCha20
+// stream cipher (RFC 8439, with a 64-bit block counter and a zero nonce).
+// Provided that its seed is random and secret, the output of the generator
+// cannot be distinguished from random bytes, nor can its seed be recovered
+// from its output.
+//
+// The functions of 'bdlb::RandomDevice' read a system device on each call,
+// which is far too slow to supply, e.g., the random bits of every GUID that a
+// process creates.  A 'bdlb::ChaCha20RandomGenerator' is meant to be seeded
+// once from 'bdlb::RandomDevice', and then produces bytes at a rate
+// comparable to copying memory.
+//
+///Forward Secrecy
+///---------------
+// The generator computes the key stream 'k_BUFFER_SIZE' bytes at a time.  The
+// first 'k_SEED_SIZE' bytes of each such buffer are never returned: they
+// replace the key used to compute the buffer, and the bytes returned from the
+// buffer are erased from it.  The state of a generator therefore does not
+// reveal any of the bytes it has already returned (a design known as "fast
+// key erasure").
+//
+///Thread Safety
+///-------------
+// 'bdlb::ChaCha20RandomGenerator' is *not* thread-safe: an object must not be
+// used from several threads concurrently.  Each thread needing random bytes
+// should have its own generator, seeded independently.
+//
+// Note that a generator is copied, along with the rest of the memory of a
+// process, by 'fork'.  The parent and child processes would then produce the
+// same bytes, so a process that forks must reseed the generators that the
+// child will use.  Objects of this type can neither be copied nor assigned,
+// for the same reason.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Generating Session Tokens
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that a server needs to hand out unguessable 16-byte tokens to
+// identify sessions, at a rate that makes reading the system random device for
+// each token too expensive.
+//
+// First, we obtain a seed from the system random device:
+//..
+//  unsigned char seed[bdlb::ChaCha20RandomGenerator::k_SEED_SIZE];
+//  int           rc = bdlb::RandomDevice::getRandomBytesNonBlocking(
+//                                                                seed,
+//                                                                sizeof seed);
+//  assert(0 == rc);
+//..
+// Then, we create a generator with that seed:
+//..
+//  bdlb::ChaCha20RandomGenerator generator(seed);
+//..
+// Now, we generate as many tokens as we need:
+//..
+//  unsigned char tokens[100][16];
+//  for (int i = 0; i < 100; ++i) {
+//      generator.getRandomBytes(tokens[i], sizeof tokens[i]);
+//  }
+//..
+// Finally, we observe that the tokens differ:
+//..
+//  for (int i = 1; i < 100; ++i) {
+//      assert(0 != bsl::memcmp(tokens[i - 1], tokens[i], 16));
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                       // =============================
+                       // class ChaCha20RandomGenerator
+                       // =============================
+
+class ChaCha20RandomGenerator {
+    // This class implements a cryptographically secure pseudo-random byte
+    // generator producing the key stream of the ChaCha20 stream cipher keyed
+    // by a seed, with fast key erasure (see {Forward Secrecy}).
+
+  public:
+    // TYPES
+    enum {
+        k_SEED_SIZE   = 32,   // size (in bytes) of a seed
+        k_BUFFER_SIZE = 1024  // size (in bytes) of the key stream computed at
+                              // a time
+    };
+
+  private:
+    // DATA
+    bsl::uint32_t d_key[8];                  // key of the next buffer
+
+    unsigned char d_buffer[k_BUFFER_SIZE];   // key stream, erased up to
+                                             // 'd_position'
+
+    bsl::size_t   d_position;                // index in 'd_buffer' of the
+                                             // next byte to return
+
+    // NOT IMPLEMENTED
+    ChaCha20RandomGenerator(const ChaCha20RandomGenerator&);
+    ChaCha20RandomGenerator& operator=(const ChaCha20RandomGenerator&);
+
+    // PRIVATE MANIPULATORS
+    void refill();
+        // Compute the next 'k_BUFFER_SIZE' bytes of key stream into
+        // 'd_buffer', replace 'd_key' by its first 'k_SEED_SIZE' bytes, and
+        // erase them.
+
+  public:
+    // CREATORS
+    explicit ChaCha20RandomGenerator(const unsigned char *seed);
+        // Create a generator whose output is determined by the specified
+        // 'seed'.  The behavior is undefined unless 'seed' refers to at least
+        // 'k_SEED_SIZE' bytes.
+
+    ~ChaCha20RandomGenerator();
+        // Erase the state of this generator, and destroy it.
+
+    // MANIPULATORS
+    void getRandomBytes(unsigned char *buffer, bsl::size_t numBytes);
+        // Load the specified 'numBytes' next bytes of the output of this
+        // generator into the specified 'buffer'.  The behavior is undefined
+        // unless 'buffer' refers to at least 'numBytes' bytes.  Note that the
+        // output does not depend on how it is split into calls.
+
+    void seed(const unsigned char *seed);
+        // Reset the state of this generator so that its output is determined
+        // by the specified 'seed' alone, as if it was newly created with
+        // 'seed'.  The behavior is undefined unless 'seed' refers to at least
+        // 'k_SEED_SIZE' bytes.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
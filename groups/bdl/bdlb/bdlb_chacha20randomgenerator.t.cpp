@@ -0,0 +1,540 @@
+// bdlb_chacha20randomgenerator.t.cpp                                 -*-C++-*-
+#include <bdlb_chacha20randomgenerator.h>
+
+#include <bdlb_randomdevice.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism whose output is a deterministic
+// function of its seed.  The output is verified against the key stream of
+// ChaCha20 given by the test vectors of RFC 8439, and against values computed
+// by an independent implementation of the fast key erasure performed between
+// buffers.  We then verify that the output does not depend on how it is split
+// into calls, and that reseeding restarts the output.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ChaCha20RandomGenerator(const unsigned char *seed);
+// [ 2] ~ChaCha20RandomGenerator();
+//
+// MANIPULATORS
+// [ 2] void getRandomBytes(unsigned char *buffer, size_t numBytes);
+// [ 3] void getRandomBytes(unsigned char *buffer, size_t numBytes);
+// [ 4] void seed(const unsigned char *seed);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::ChaCha20RandomGenerator Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bsl::string toHex(const unsigned char *bytes, bsl::size_t numBytes)
+    // Return the hexadecimal representation of the specified 'numBytes' at
+    // the specified 'bytes'.
+{
+    static const char k_DIGITS[] = "0123456789abcdef";
+
+    bsl::string result;
+    for (bsl::size_t i = 0; i < numBytes; ++i) {
+        result.push_back(k_DIGITS[bytes[i] >> 4]);
+        result.push_back(k_DIGITS[bytes[i] & 0xF]);
+    }
+    return result;
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Generating Session Tokens
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that a server needs to hand out unguessable 16-byte tokens to
+// identify sessions, at a rate that makes reading the system random device for
+// each token too expensive.
+//
+// First, we obtain a seed from the system random device:
+//..
+        unsigned char seed[bdlb::ChaCha20RandomGenerator::k_SEED_SIZE];
+        int           rc = bdlb::RandomDevice::getRandomBytesNonBlocking(
+                                                                seed,
+                                                                sizeof seed);
+        ASSERT(0 == rc);
+//..
+// Then, we create a generator with that seed:
+//..
+        bdlb::ChaCha20RandomGenerator generator(seed);
+//..
+// Now, we generate as many tokens as we need:
+//..
+        unsigned char tokens[100][16];
+        for (int i = 0; i < 100; ++i) {
+            generator.getRandomBytes(tokens[i], sizeof tokens[i]);
+        }
+//..
+// Finally, we observe that the tokens differ:
+//..
+        for (int i = 1; i < 100; ++i) {
+            ASSERT(0 != bsl::memcmp(tokens[i - 1], tokens[i], 16));
+        }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'seed'
+        //
+        // Concerns:
+        //: 1 After 'seed', the output of a generator is that of a generator
+        //:   newly created with the same seed, whatever it output before.
+        //:
+        //: 2 Generators with seeds differing in a single bit have unrelated
+        //:   outputs.
+        //
+        // Plan:
+        //: 1 For various amounts of output drawn beforehand, reseed a
+        //:   generator, and compare its output with that of a new generator
+        //:   having the same seed.  (C-1)
+        //:
+        //: 2 For each bit of the seed, compare the output of a generator whose
+        //:   seed has only that bit set with that of a generator with a zero
+        //:   seed, and verify that about half of the output bits differ.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void seed(const unsigned char *seed);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'seed'" << endl
+                          << "==============" << endl;
+
+        unsigned char seed[Obj::k_SEED_SIZE];
+        for (int i = 0; i < Obj::k_SEED_SIZE; ++i) {
+            seed[i] = static_cast<unsigned char>(i * 37 + 11);
+        }
+        const unsigned char zeroSeed[Obj::k_SEED_SIZE] = { 0 };
+
+        enum { k_LENGTH = 256 };
+
+        unsigned char expected[k_LENGTH];
+        {
+            Obj generator(seed);
+            generator.getRandomBytes(expected, k_LENGTH);
+        }
+
+        const bsl::size_t DRAWN[] = { 0, 1, 31, 500, 992, 993, 5000 };
+        for (bsl::size_t ti = 0; ti < sizeof DRAWN / sizeof *DRAWN; ++ti) {
+            Obj generator(zeroSeed);
+
+            bsl::vector<unsigned char> drawn(DRAWN[ti] + 1);
+            generator.getRandomBytes(drawn.data(), DRAWN[ti]);
+
+            generator.seed(seed);
+
+            unsigned char output[k_LENGTH];
+            generator.getRandomBytes(output, k_LENGTH);
+            ASSERTV(DRAWN[ti], 0 == bsl::memcmp(expected, output, k_LENGTH));
+        }
+
+        unsigned char zeroOutput[k_LENGTH];
+        {
+            Obj generator(zeroSeed);
+            generator.getRandomBytes(zeroOutput, k_LENGTH);
+        }
+
+        for (int bit = 0; bit < Obj::k_SEED_SIZE * 8; ++bit) {
+            unsigned char oneBitSeed[Obj::k_SEED_SIZE] = { 0 };
+            oneBitSeed[bit / 8] = static_cast<unsigned char>(1 << bit % 8);
+
+            Obj           generator(oneBitSeed);
+            unsigned char output[k_LENGTH];
+            generator.getRandomBytes(output, k_LENGTH);
+
+            int numDifferent = 0;
+            for (int i = 0; i < k_LENGTH; ++i) {
+                for (int b = 0; b < 8; ++b) {
+                    numDifferent += (output[i] ^ zeroOutput[i]) >> b & 1;
+                }
+            }
+
+            // 2048 bits differ with probability 1/2 each: the standard
+            // deviation of their number is about 23.
+
+            ASSERTV(bit, numDifferent, 1024 - 160 < numDifferent);
+            ASSERTV(bit, numDifferent, numDifferent < 1024 + 160);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'getRandomBytes' SPLIT INTO CALLS
+        //
+        // Concerns:
+        //: 1 The output of a generator does not depend on how it is split
+        //:   into calls, including calls spanning several buffers and calls
+        //:   for no bytes.
+        //:
+        //: 2 'getRandomBytes' writes exactly 'numBytes' bytes.
+        //
+        // Plan:
+        //: 1 Draw 5000 bytes in a single call, then, from generators with the
+        //:   same seed, in calls of each size from 0 to 70 and of sizes
+        //:   following a pseudo-random sequence, and compare the outputs.
+        //:   (C-1)
+        //:
+        //: 2 Verify that the byte following the bytes requested in each call
+        //:   is unchanged.  (C-2)
+        //
+        // Testing:
+        //   void getRandomBytes(unsigned char *buffer, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'getRandomBytes' SPLIT INTO CALLS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        enum { k_LENGTH = 5000 };
+
+        unsigned char seed[Obj::k_SEED_SIZE];
+        for (int i = 0; i < Obj::k_SEED_SIZE; ++i) {
+            seed[i] = static_cast<unsigned char>(255 - i);
+        }
+
+        unsigned char expected[k_LENGTH];
+        {
+            Obj generator(seed);
+            generator.getRandomBytes(expected, k_LENGTH);
+        }
+
+        for (int chunk = 0; chunk <= 71; ++chunk) {
+            // Chunk sizes 1 to 70 are fixed, 0 and 71 are pseudo-random.
+
+            if (veryVerbose) { P(chunk) }
+
+            Obj           generator(seed);
+            unsigned char output[k_LENGTH + 1];
+            unsigned int  random = 12345;
+
+            bsl::memset(output, 0xA5, sizeof output);
+
+            int position = 0;
+            while (position < k_LENGTH) {
+                random = random * 1103515245 + 12345;
+
+                int size = 0 < chunk && chunk < 71
+                           ? chunk
+                           : static_cast<int>(random >> 16) % 1500;
+                size = bsl::min(size, k_LENGTH - position);
+
+                generator.getRandomBytes(output + position, size);
+                ASSERTV(chunk, position, size,
+                        0xA5 == output[position + size]);
+                position += size;
+            }
+
+            ASSERTV(chunk, 0 == bsl::memcmp(expected, output, k_LENGTH));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING KNOWN ANSWERS
+        //
+        // Concerns:
+        //: 1 The output of a generator is the ChaCha20 key stream for its
+        //:   seed, without its first 32 bytes.
+        //:
+        //: 2 After each 1024 bytes of key stream, the generator continues with
+        //:   the key stream for a key made of the first 32 bytes of the
+        //:   previous 1024.
+        //
+        // Plan:
+        //: 1 Compare the output of generators seeded with the keys of the
+        //:   test vectors of section A.1 of RFC 8439 (with a zero nonce) with
+        //:   the blocks of key stream given there.  (C-1)
+        //:
+        //: 2 Compare the bytes following the first and second buffers with
+        //:   values computed by an independent implementation.  (C-2)
+        //
+        // Testing:
+        //   explicit ChaCha20RandomGenerator(const unsigned char *seed);
+        //   ~ChaCha20RandomGenerator();
+        //   void getRandomBytes(unsigned char *buffer, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING KNOWN ANSWERS" << endl
+                          << "=====================" << endl;
+
+        enum { k_LENGTH = 2016 };
+
+        const unsigned char zeroSeed[Obj::k_SEED_SIZE] = { 0 };
+
+        unsigned char output[k_LENGTH];
+        {
+            Obj generator(zeroSeed);
+            generator.getRandomBytes(output, k_LENGTH);
+        }
+
+        // RFC 8439, A.1, test vector #1 (block 0), after the first 32 bytes.
+
+        ASSERT(toHex(output, 32) ==
+               "da41597c5157488d7724e03fb8d84a37"
+               "6a43b8f41518a11cc387b669b2ee6586");
+
+        // RFC 8439, A.1, test vector #2 (block 1).
+
+        ASSERT(toHex(output + 32, 64) ==
+               "9f07e7be5551387a98ba977c732d080d"
+               "cb0f29a048e3656912c6533e32ee7aed"
+               "29b721769ce64e43d57133b074d839d5"
+               "31ed1f28510afb45ace10a1f4b794d6f");
+
+        // Beginnings of the second and third buffers.
+
+        ASSERT(toHex(output + 992, 32) ==
+               "afbdad2845b93cdbb2fe6463d2fe162a"
+               "dae0f6e676f0494218f5ce0596e79f5c");
+        ASSERT(toHex(output + 1984, 32) ==
+               "835c9677f558611a69389b6ee93b0430"
+               "29b657d23144c775f0d0454bce601267");
+
+        // RFC 8439, A.1, test vector #3 (key ending in 1, block 1).
+
+        unsigned char seed[Obj::k_SEED_SIZE] = { 0 };
+        seed[Obj::k_SEED_SIZE - 1] = 1;
+        {
+            Obj generator(seed);
+            generator.getRandomBytes(output, 96);
+        }
+        ASSERT(toHex(output + 32, 64) ==
+               "3aeb5224ecf849929b9d828db1ced4dd"
+               "832025e8018b8160b82284f3c949aa5a"
+               "8eca00bbb4a73bdad192b5c42f73f2fd"
+               "4e273644c8b36125a64addeb006c13a0");
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create two generators with the same seed, and one with another
+        //:   seed, and compare their outputs.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        unsigned char seedA[Obj::k_SEED_SIZE] = { 1, 2, 3 };
+        unsigned char seedB[Obj::k_SEED_SIZE] = { 1, 2, 4 };
+
+        Obj mX(seedA), mY(seedA), mZ(seedB);
+
+        unsigned char x[64], y[64], z[64];
+        mX.getRandomBytes(x, sizeof x);
+        mY.getRandomBytes(y, sizeof y);
+        mZ.getRandomBytes(z, sizeof z);
+
+        ASSERT(0 == bsl::memcmp(x, y, sizeof x));
+        ASSERT(0 != bsl::memcmp(x, z, sizeof x));
+
+        mX.getRandomBytes(x, sizeof x);
+        ASSERT(0 != bsl::memcmp(x, y, sizeof x));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'getRandomBytes', for large requests and
+        //:   for the 16-byte requests of GUID generation, and that of
+        //:   'bdlb::RandomDevice::getRandomBytesNonBlocking' for comparison.
+        //
+        // Plan:
+        //: 1 Time the generation of 256 MB in 1 MB requests and of 64 MB in
+        //:   16-byte requests, and of a thousand 16-byte requests from the
+        //:   random device.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: THROUGHPUT" << endl
+                          << "============================" << endl;
+
+        const unsigned char seed[Obj::k_SEED_SIZE] = { 0 };
+
+        Obj                        generator(seed);
+        bsl::vector<unsigned char> buffer(1 << 20);
+        bsls::Stopwatch            timer;
+
+        timer.start();
+        for (int i = 0; i < 256; ++i) {
+            generator.getRandomBytes(buffer.data(), buffer.size());
+        }
+        timer.stop();
+        cout << "1 MB requests:  "
+             << 256 * 1.048576 / timer.accumulatedWallTime() << " MB/s\n";
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < 4 << 20; ++i) {
+            generator.getRandomBytes(&buffer[i % 4096 * 16], 16);
+        }
+        timer.stop();
+        cout << "16-byte requests: "
+             << 4 * 1.048576 / timer.accumulatedWallTime()
+             << " million per second\n";
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < 1000; ++i) {
+            bdlb::RandomDevice::getRandomBytesNonBlocking(&buffer[i * 16],
+                                                          16);
+        }
+        timer.stop();
+        cout << "16-byte requests to 'RandomDevice': "
+             << 1e-3 / timer.accumulatedWallTime()
+             << " million per second\n";
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,660 @@
+// bdlb_floatconvertutil.cpp                                          -*-C++-*-
+#include <bdlb_floatconvertutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_floatconvertutil_cpp,"$Id$ $CSID$")
+
+#include <bdlb_float.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_c_stdio.h>   // 'snprintf'
+#include <bsl_cfloat.h>
+#include <bsl_cstdlib.h>   // 'strtod'
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_MAX_FAST_PRECISION = 40,
+        // largest precision formatted without 'snprintf'
+
+    k_MAX_INTEGER_DIGITS = 20,
+        // number of digits of the largest 'Uint64'
+
+    k_MAX_DIGITS         = k_MAX_INTEGER_DIGITS + k_MAX_FAST_PRECISION + 1,
+        // most digits generated for one value, including the first
+        // discarded one
+
+    k_MAX_FAST_LENGTH    = k_MAX_DIGITS + 8,
+        // longest text formatted without 'snprintf' (sign, digits, point,
+        // and exponent)
+
+    k_MAX_SIGNIFICANT_DIGITS = 19,
+        // most significant digits parsed by 'parseSimpleDouble'
+
+    k_MAX_EXACT_POWER    = 22,
+        // largest power of 10 that a 'double' represents exactly
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+    k_MIN_EXPONENT_DIGITS = 3
+        // fewest exponent digits written by 'printf' (older Windows C
+        // libraries pad the exponent to three digits)
+#else
+    k_MIN_EXPONENT_DIGITS = 2
+        // fewest exponent digits written by 'printf'
+#endif
+};
+
+const Uint64 k_MAX_EXACT_INTEGER = 1ULL << 53;
+    // largest integer that, along with every smaller positive integer, is
+    // exactly representable as a 'double'
+
+const double k_POWERS_OF_TEN[k_MAX_EXACT_POWER + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+struct Decimal {
+    // This 'struct' holds the decimal digits of a value, rounded to a given
+    // number of places.  The value is '0.d1 d2 ... dn * 10^pointPosition',
+    // where 'd1' is not 0, or 0 if there are no digits.
+
+    char d_digits[k_MAX_DIGITS + 1];  // ASCII digits
+    int  d_numDigits;                 // number of digits
+    int  d_pointPosition;             // number of digits before the point
+};
+
+bool decompose(bool   *isNegative,
+               Uint64 *integer,
+               Uint64 *fraction,
+               double  value)
+    // Load the sign of the specified 'value' into the specified 'isNegative',
+    // the integral part of its magnitude into the specified 'integer', and the
+    // fractional part of its magnitude, as a fixed-point number with 64
+    // fraction bits, into the specified 'fraction', and return 'true' if the
+    // magnitude of 'value' is in the range '[2^-12 .. 2^64)', and 'false'
+    // (with no effect) otherwise.  Note that both parts of the values in that
+    // range are exactly representable in this way.
+{
+    Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    const int    biasedExponent = static_cast<int>(bits >> 52) & 0x7FF;
+    const int    exponent       = biasedExponent - 1075;
+    const Uint64 mantissa       = (bits & ((1ULL << 52) - 1)) | (1ULL << 52);
+
+    // 'value' is 'mantissa * 2^exponent', unless it is zero, subnormal,
+    // infinite, or NaN.
+
+    if (0 == biasedExponent || exponent < -64 || 11 < exponent) {
+        return false;                                                 // RETURN
+    }
+
+    *isNegative = 0 != (bits >> 63);
+
+    if (0 <= exponent) {
+        *integer  = mantissa << exponent;
+        *fraction = 0;
+    }
+    else if (-64 == exponent) {
+        *integer  = 0;
+        *fraction = mantissa;
+    }
+    else {
+        *integer  = mantissa >> -exponent;
+        *fraction = mantissa << (64 + exponent);
+    }
+
+    return true;
+}
+
+inline
+char nextFractionDigit(Uint64 *fraction)
+    // Multiply the specified 'fraction', a fixed-point number with 64
+    // fraction bits, by 10, and return the integral part of the product, as
+    // an ASCII digit, after loading its fractional part into 'fraction'.
+{
+    const Uint64 low  = (*fraction & 0xFFFFFFFFULL) * 10;
+    const Uint64 high = (*fraction >> 32) * 10 + (low >> 32);
+
+    *fraction = (high << 32) | (low & 0xFFFFFFFFULL);
+    return static_cast<char>('0' + (high >> 32));
+}
+
+void toDecimal(Decimal *result,
+               Uint64   integer,
+               Uint64   fraction,
+               int      precision,
+               bool     isFixed)
+    // Load into the specified 'result' the digits of the value
+    // 'integer + fraction / 2^64' of the specified 'integer' and 'fraction',
+    // rounded, to the nearest and ties to even, to the specified 'precision'
+    // places after the decimal point if the specified 'isFixed' is 'true',
+    // and to 'precision' significant digits otherwise.  The behavior is
+    // undefined unless the value is in the range '[2^-12 .. 2^64)',
+    // 'precision <= k_MAX_FAST_PRECISION', and '0 <= precision' if 'isFixed',
+    // or '0 < precision' otherwise.
+{
+    char *digits        = result->d_digits;
+    int   numDigits     = 0;
+    int   pointPosition = 0;
+
+    if (0 != integer) {
+        char reversed[k_MAX_INTEGER_DIGITS];
+        int  count = 0;
+
+        do {
+            reversed[count++] = static_cast<char>('0' + integer % 10);
+            integer /= 10;
+        } while (0 != integer);
+
+        while (0 < count) {
+            digits[numDigits++] = reversed[--count];
+        }
+        pointPosition = numDigits;
+    }
+    else {
+        // Skip the leading zeros of the fraction; note that the value is at
+        // least 2^-12, so there are at most three of them.
+
+        char digit;
+        while ('0' == (digit = nextFractionDigit(&fraction))) {
+            --pointPosition;
+        }
+        digits[numDigits++] = digit;
+    }
+
+    // Digits at index 'end' and beyond are rounded off.
+
+    const int end = isFixed ? pointPosition + precision : precision;
+
+    result->d_pointPosition = pointPosition;
+
+    if (end < 0) {
+        // The value is less than a tenth of the last place, and rounds to 0.
+
+        result->d_numDigits = 0;
+        return;                                                       // RETURN
+    }
+
+    while (numDigits <= end && 0 != fraction) {
+        digits[numDigits++] = nextFractionDigit(&fraction);
+    }
+
+    if (numDigits <= end) {
+        // The value is exact: pad it with zeros.
+
+        while (numDigits < end) {
+            digits[numDigits++] = '0';
+        }
+        result->d_numDigits = end;
+        return;                                                       // RETURN
+    }
+
+    const char roundingDigit = digits[end];
+    bool       isSticky      = 0 != fraction;
+    for (int i = end + 1; i < numDigits && !isSticky; ++i) {
+        isSticky = '0' != digits[i];
+    }
+    const bool isOdd = 0 < end && 0 != ((digits[end - 1] - '0') & 1);
+
+    numDigits = end;
+
+    if ('5' < roundingDigit
+     || ('5' == roundingDigit && (isSticky || isOdd))) {
+        int i = end - 1;
+        while (0 <= i && '9' == digits[i]) {
+            digits[i--] = '0';
+        }
+
+        if (0 <= i) {
+            ++digits[i];
+        }
+        else {
+            // The carry propagated out of the first digit: all the digits are
+            // now '0', and the value is a power of 10.
+
+            if (isFixed) {
+                digits[end] = '0';
+                numDigits   = end + 1;
+            }
+
+            digits[0] = '1';
+            ++result->d_pointPosition;
+        }
+    }
+
+    result->d_numDigits = numDigits;
+}
+
+int writeFixed(char           *text,
+               bool            isNegative,
+               const Decimal&  decimal,
+               int             precision)
+    // Write into the specified 'text' the specified 'decimal', negated if the
+    // specified 'isNegative' is 'true', with the specified 'precision' places
+    // after the decimal point, as "%.*f" would, and return the number of
+    // characters written.
+{
+    char      *out           = text;
+    const int  pointPosition = decimal.d_pointPosition;
+    const int  numDigits     = decimal.d_numDigits;
+
+    if (isNegative) {
+        *out++ = '-';
+    }
+
+    if (0 < numDigits && 0 < pointPosition) {
+        bsl::memcpy(out, decimal.d_digits, pointPosition);
+        out += pointPosition;
+    }
+    else {
+        *out++ = '0';
+    }
+
+    if (0 < precision) {
+        *out++ = '.';
+
+        for (int i = pointPosition; i < pointPosition + precision; ++i) {
+            *out++ = 0 <= i && i < numDigits ? decimal.d_digits[i] : '0';
+        }
+    }
+
+    return static_cast<int>(out - text);
+}
+
+int writeGeneral(char           *text,
+                 bool            isNegative,
+                 const Decimal&  decimal,
+                 int             precision)
+    // Write into the specified 'text' the specified 'decimal', having the
+    // specified 'precision' significant digits, negated if the specified
+    // 'isNegative' is 'true', as "%.*g" would, and return the number of
+    // characters written.
+{
+    char       *out           = text;
+    const char *digits        = decimal.d_digits;
+    const int   pointPosition = decimal.d_pointPosition;
+    const int   exponent      = pointPosition - 1;
+
+    if (isNegative) {
+        *out++ = '-';
+    }
+
+    if (exponent < -4 || precision <= exponent) {
+        int end = precision;
+        while (1 < end && '0' == digits[end - 1]) {
+            --end;
+        }
+
+        *out++ = digits[0];
+        if (1 < end) {
+            *out++ = '.';
+            bsl::memcpy(out, digits + 1, end - 1);
+            out += end - 1;
+        }
+
+        *out++ = 'e';
+        *out++ = exponent < 0 ? '-' : '+';
+
+        const int magnitude = exponent < 0 ? -exponent : exponent;
+        if (100 <= magnitude || 3 == u::k_MIN_EXPONENT_DIGITS) {
+            *out++ = static_cast<char>('0' + magnitude / 100);
+        }
+        *out++ = static_cast<char>('0' + magnitude / 10 % 10);
+        *out++ = static_cast<char>('0' + magnitude % 10);
+    }
+    else {
+        int end = precision;
+        while (pointPosition < end && 0 < end && '0' == digits[end - 1]) {
+            --end;
+        }
+
+        if (0 < pointPosition) {
+            bsl::memcpy(out, digits, pointPosition);
+            out += pointPosition;
+        }
+        else {
+            *out++ = '0';
+        }
+
+        if (pointPosition < end) {
+            *out++ = '.';
+
+            for (int i = pointPosition; i < end; ++i) {
+                *out++ = 0 <= i ? digits[i] : '0';
+            }
+        }
+    }
+
+    return static_cast<int>(out - text);
+}
+
+int copyText(char *buffer, int bufferLength, const char *text, int length)
+    // Load at most the specified 'bufferLength - 1' characters of the
+    // specified 'text' having the specified 'length', followed by a null
+    // character, into the specified 'buffer' (or nothing if
+    // '0 == bufferLength'), and return 'length'.
+{
+    if (0 < bufferLength) {
+        const int numCopied = length < bufferLength ? length
+                                                    : bufferLength - 1;
+
+        bsl::memcpy(buffer, text, numCopied);
+        buffer[numCopied] = '\0';
+    }
+
+    return length;
+}
+
+double parseBack(const char *text, int length)
+    // Return the value of the specified null-terminated 'text' having the
+    // specified 'length', formatted by 'formatGeneral'.
+{
+    double result;
+    if (0 != FloatConvertUtil::parseSimpleDouble(&result, text, length)) {
+        result = bsl::strtod(text, 0);
+    }
+
+    return result;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // struct FloatConvertUtil
+                          // -----------------------
+
+// CLASS METHODS
+int FloatConvertUtil::formatFixed(char   *buffer,
+                                  int     bufferLength,
+                                  double  value,
+                                  int     precision)
+{
+    BSLS_ASSERT(0 <= bufferLength);
+    BSLS_ASSERT(buffer || 0 == bufferLength);
+
+    if (0 <= precision && precision <= u::k_MAX_FAST_PRECISION) {
+        char       text[u::k_MAX_FAST_LENGTH];
+        u::Decimal decimal;
+        bool       isNegative;
+        u::Uint64  integer;
+        u::Uint64  fraction;
+
+        if (Float::isZero(value)) {
+            decimal.d_numDigits     = 0;
+            decimal.d_pointPosition = 0;
+
+            const int length = u::writeFixed(text,
+                                             Float::signBit(value),
+                                             decimal,
+                                             precision);
+            return u::copyText(buffer, bufferLength, text, length);   // RETURN
+        }
+
+        if (u::decompose(&isNegative, &integer, &fraction, value)) {
+            u::toDecimal(&decimal, integer, fraction, precision, true);
+
+            const int length = u::writeFixed(text,
+                                             isNegative,
+                                             decimal,
+                                             precision);
+            return u::copyText(buffer, bufferLength, text, length);   // RETURN
+        }
+    }
+
+    return snprintf(buffer, bufferLength, "%.*f", precision, value);
+}
+
+int FloatConvertUtil::formatGeneral(char   *buffer,
+                                    int     bufferLength,
+                                    double  value,
+                                    int     precision)
+{
+    BSLS_ASSERT(0 <= bufferLength);
+    BSLS_ASSERT(buffer || 0 == bufferLength);
+
+    if (0 <= precision && precision <= u::k_MAX_FAST_PRECISION) {
+        char       text[u::k_MAX_FAST_LENGTH];
+        u::Decimal decimal;
+        bool       isNegative;
+        u::Uint64  integer;
+        u::Uint64  fraction;
+
+        if (Float::isZero(value)) {
+            int length = 0;
+            if (Float::signBit(value)) {
+                text[length++] = '-';
+            }
+            text[length++] = '0';
+
+            return u::copyText(buffer, bufferLength, text, length);   // RETURN
+        }
+
+        if (u::decompose(&isNegative, &integer, &fraction, value)) {
+            const int numDigits = 0 == precision ? 1 : precision;
+
+            u::toDecimal(&decimal, integer, fraction, numDigits, false);
+
+            const int length = u::writeGeneral(text,
+                                               isNegative,
+                                               decimal,
+                                               numDigits);
+            return u::copyText(buffer, bufferLength, text, length);   // RETURN
+        }
+    }
+
+    return snprintf(buffer, bufferLength, "%.*g", precision, value);
+}
+
+int FloatConvertUtil::formatShortest(char *buffer, double value)
+{
+    BSLS_ASSERT(buffer);
+
+    // 'DBL_DIG + 2' (i.e., 17) digits always suffice.  Note that infinite
+    // values parse back at the first attempt, and that NaN never does, so
+    // that both are formatted as "%g" would format them.
+
+    int length = 0;
+    for (int precision = DBL_DIG; precision <= DBL_DIG + 2; ++precision) {
+        length = formatGeneral(buffer,
+                               k_SHORTEST_BUFFER_SIZE,
+                               value,
+                               precision);
+
+        if (value == u::parseBack(buffer, length)) {
+            break;
+        }
+    }
+
+    return length;
+}
+
+int FloatConvertUtil::formatShortest(char *buffer, float value)
+{
+    BSLS_ASSERT(buffer);
+
+    // 'FLT_DIG + 3' (i.e., 9) digits always suffice.
+
+    int length = 0;
+    for (int precision = FLT_DIG; precision <= FLT_DIG + 3; ++precision) {
+        length = formatGeneral(buffer,
+                               k_SHORTEST_BUFFER_SIZE,
+                               value,
+                               precision);
+
+        if (value == static_cast<float>(u::parseBack(buffer, length))) {
+            break;
+        }
+    }
+
+    return length;
+}
+
+int FloatConvertUtil::parseSimpleDouble(double     *result,
+                                        const char *input,
+                                        int         inputLength)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+
+#if defined(FLT_EVAL_METHOD) && 0 != FLT_EVAL_METHOD
+    // Intermediate results may be rounded twice (e.g., on the x87 FPU), so
+    // the fast path is not exact.
+
+    (void)result;
+    (void)input;
+    (void)inputLength;
+    return -1;
+#else
+    const char *iter = input;
+    const char *end  = input + inputLength;
+
+    bool isNegative = false;
+    if (iter < end && ('-' == *iter || '+' == *iter)) {
+        isNegative = '-' == *iter;
+        ++iter;
+    }
+
+    u::Uint64 mantissa      = 0;
+    int       numSignificant = 0;
+    int       exponent       = 0;
+
+    const char *digitsBegin = iter;
+    while (iter < end && '0' <= *iter && *iter <= '9') {
+        if (0 != mantissa || '0' != *iter) {
+            if (u::k_MAX_SIGNIFICANT_DIGITS == numSignificant) {
+                return -1;                                            // RETURN
+            }
+            mantissa = mantissa * 10 + (*iter - '0');
+            ++numSignificant;
+        }
+        ++iter;
+    }
+    if (digitsBegin == iter) {
+        return -1;                                                    // RETURN
+    }
+
+    if (iter < end && '.' == *iter) {
+        ++iter;
+
+        const char *fractionBegin = iter;
+        while (iter < end && '0' <= *iter && *iter <= '9') {
+            if (0 != mantissa || '0' != *iter) {
+                if (u::k_MAX_SIGNIFICANT_DIGITS == numSignificant) {
+                    return -1;                                        // RETURN
+                }
+                mantissa = mantissa * 10 + (*iter - '0');
+                ++numSignificant;
+            }
+            --exponent;
+            ++iter;
+        }
+        if (fractionBegin == iter) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (iter < end && ('e' == *iter || 'E' == *iter)) {
+        ++iter;
+
+        bool isNegativeExponent = false;
+        if (iter < end && ('-' == *iter || '+' == *iter)) {
+            isNegativeExponent = '-' == *iter;
+            ++iter;
+        }
+
+        const char *exponentBegin = iter;
+        int         value         = 0;
+        while (iter < end && '0' <= *iter && *iter <= '9') {
+            if (value < 100000) {
+                value = value * 10 + (*iter - '0');
+            }
+            ++iter;
+        }
+        if (exponentBegin == iter) {
+            return -1;                                                // RETURN
+        }
+
+        exponent += isNegativeExponent ? -value : value;
+    }
+
+    if (iter != end) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == mantissa) {
+        *result = isNegative ? -0.0 : 0.0;
+        return 0;                                                     // RETURN
+    }
+
+    if (u::k_MAX_EXACT_INTEGER < mantissa) {
+        return -1;                                                    // RETURN
+    }
+
+    // Both the mantissa and the power of 10 are exact, so the one operation
+    // below is correctly rounded.  Exponents beyond the exactly representable
+    // powers of 10 are handled if the excess can be moved into the mantissa
+    // without loss.
+
+    for (; u::k_MAX_EXACT_POWER < exponent; --exponent) {
+        if (u::k_MAX_EXACT_INTEGER / 10 < mantissa) {
+            return -1;                                                // RETURN
+        }
+        mantissa *= 10;
+    }
+
+    if (exponent < -u::k_MAX_EXACT_POWER) {
+        return -1;                                                    // RETURN
+    }
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0) {
+        value /= u::k_POWERS_OF_TEN[-exponent];
+    }
+    else {
+        value *= u::k_POWERS_OF_TEN[exponent];
+    }
+
+    *result = isNegative ? -value : value;
+    return 0;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
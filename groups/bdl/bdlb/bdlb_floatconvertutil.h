@@ -0,0 +1,196 @@
+// bdlb_floatconvertutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLB_FLOATCONVERTUTIL
+#define INCLUDED_BDLB_FLOATCONVERTUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide fast, exact conversions between 'double' and text.
+//
+//@CLASSES:
+//  bdlb::FloatConvertUtil: namespace for 'double' formatting and parsing
+//
+//@SEE_ALSO: bdlb_numericparseutil, bdlb_float
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bdlb::FloatConvertUtil', containing functions that convert floating-point
+// values to text and back without going through the 'printf' and 'strtod'
+// machinery of the C library in the common cases.
+//
+// 'formatGeneral' and 'formatFixed' are drop-in replacements for 'snprintf'
+// with the "%.*g" and "%.*f" formats, respectively: they produce the same
+// bytes (in the "C" locale) and return the same value.  For values whose
+// magnitude is in the range '[2^-12 .. 2^64)' (which covers most prices,
+// quantities, and rates) and precisions of at most 40, the digits are
+// generated exactly, with 64-bit integer arithmetic, and correctly rounded
+// (ties to even), as 'printf' does; other values are handed to 'snprintf'.
+//
+// 'formatShortest' produces the text, in the "%g" style, having the fewest
+// significant digits that converts back to the same value, so that, for
+// example, '0.1' is formatted as "0.1" rather than as "0.10000000000000001"
+// (the result of "%.17g").  More precisely, it formats the value with "%.*g"
+// for the smallest precision, starting at 'DBL_DIG' (or 'FLT_DIG' for
+// 'float'), for which the text parses back to the value; hence, if there is
+// any correctly rounded representation of at most 'DBL_DIG' digits, the
+// result is the shortest such representation.
+//
+// 'parseSimpleDouble' is the matching fast path for parsing.  It converts
+// decimal text (an optional sign, digits, an optional fraction, and an
+// optional exponent) having at most 19 significant digits and a value that
+// can be computed with a single correctly rounded floating-point operation
+// (Clinger's fast path), and reports failure for all other input, in which
+// case the caller should fall back to 'strtod'.  Note that
+// 'parseSimpleDouble' never produces a result that differs from that of
+// 'strtod'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Prices
+///- - - - - - - - - - - - - -
+// Suppose that we are writing an encoder that must emit prices in the same
+// format as a legacy encoder that used 'snprintf' with "%.*g".
+//
+// First, we format a price with 15 significant digits, just as the legacy
+// encoder did:
+//..
+//  char buffer[32];
+//
+//  int length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+//                                                     sizeof buffer,
+//                                                     101.25,
+//                                                     15);
+//  assert(6 == length);
+//  assert(0 == bsl::strcmp("101.25", buffer));
+//..
+// Then, we observe that 15 digits are not always sufficient to preserve the
+// value, while 17 digits show the error in the binary representation:
+//..
+//  length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+//                                                 sizeof buffer,
+//                                                 0.1 + 0.2,
+//                                                 15);
+//  assert(0 == bsl::strcmp("0.3", buffer));
+//
+//  length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+//                                                 sizeof buffer,
+//                                                 0.1 + 0.2,
+//                                                 17);
+//  assert(0 == bsl::strcmp("0.30000000000000004", buffer));
+//..
+// Next, we format the values with as few digits as preserve them:
+//..
+//  char shortest[bdlb::FloatConvertUtil::k_SHORTEST_BUFFER_SIZE];
+//
+//  length = bdlb::FloatConvertUtil::formatShortest(shortest, 101.25);
+//  assert(0 == bsl::strcmp("101.25", shortest));
+//
+//  length = bdlb::FloatConvertUtil::formatShortest(shortest, 0.1 + 0.2);
+//  assert(0 == bsl::strcmp("0.30000000000000004", shortest));
+//..
+// Finally, we parse the text back, falling back to 'strtod' when the fast
+// path does not apply:
+//..
+//  double value;
+//  if (0 != bdlb::FloatConvertUtil::parseSimpleDouble(&value,
+//                                                     shortest,
+//                                                     length)) {
+//      value = bsl::strtod(shortest, 0);
+//  }
+//  assert(0.1 + 0.2 == value);
+//..
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // =======================
+                          // struct FloatConvertUtil
+                          // =======================
+
+struct FloatConvertUtil {
+    // This 'struct' provides a namespace for functions that convert
+    // floating-point values to text and back.
+
+    // CONSTANTS
+    enum {
+        k_SHORTEST_BUFFER_SIZE = 32  // size sufficient for 'formatShortest'
+    };
+
+    // CLASS METHODS
+    static int formatFixed(char   *buffer,
+                           int     bufferLength,
+                           double  value,
+                           int     precision);
+        // Format the specified 'value' with the specified 'precision' as
+        // 'snprintf(buffer, bufferLength, "%.*f", precision, value)' would in
+        // the "C" locale: load at most 'bufferLength - 1' characters of the
+        // result, followed by a null character, into the specified 'buffer'
+        // (or nothing if '0 == bufferLength'), and return the length of the
+        // complete result.  The behavior is undefined unless
+        // '0 <= bufferLength' and 'buffer' has at least 'bufferLength'
+        // characters.
+
+    static int formatGeneral(char   *buffer,
+                             int     bufferLength,
+                             double  value,
+                             int     precision);
+        // Format the specified 'value' with the specified 'precision' as
+        // 'snprintf(buffer, bufferLength, "%.*g", precision, value)' would in
+        // the "C" locale: load at most 'bufferLength - 1' characters of the
+        // result, followed by a null character, into the specified 'buffer'
+        // (or nothing if '0 == bufferLength'), and return the length of the
+        // complete result.  The behavior is undefined unless
+        // '0 <= bufferLength' and 'buffer' has at least 'bufferLength'
+        // characters.
+
+    static int formatShortest(char *buffer, double value);
+    static int formatShortest(char *buffer, float value);
+        // Load into the specified 'buffer', followed by a null character, the
+        // text having the fewest significant digits (as described in the
+        // component documentation) that parses back to the specified 'value',
+        // formatted as "%.*g" would format it, and return its length.  If
+        // 'value' is infinite or NaN, load the text that "%g" produces.  A
+        // 'float' 'value' parses back if parsing the text as a 'double' and
+        // converting the result to 'float' yields 'value'.  The behavior is
+        // undefined unless 'buffer' has at least 'k_SHORTEST_BUFFER_SIZE'
+        // characters.
+
+    static int parseSimpleDouble(double     *result,
+                                 const char *input,
+                                 int         inputLength);
+        // Load into the specified 'result' the value of the decimal number in
+        // the specified 'input' of the specified 'inputLength' if 'input'
+        // consists of an optional sign, one or more digits, optionally a '.'
+        // followed by one or more digits, and optionally an 'e' or 'E'
+        // followed by an optional sign and one or more digits, has at most 19
+        // significant digits, and denotes a value that can be computed
+        // exactly (see the component documentation).  Return 0 on success,
+        // and a non-zero value (with no effect) otherwise.  Note that failure
+        // does not imply that 'input' is not a valid number: it can be parsed
+        // with 'strtod', which yields the same result on success.  The
+        // behavior is undefined unless '0 <= inputLength'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,933 @@
+// bdlb_floatconvertutil.t.cpp                                        -*-C++-*-
+#include <bdlb_floatconvertutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_c_stdio.h>
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility whose formatting functions are
+// specified to produce the same results as 'snprintf', and whose parsing
+// function is specified to produce the same results as 'strtod' (or to
+// decline).  Hence, besides table-driven tests of boundary cases, we compare
+// the functions with their C library counterparts for large numbers of
+// pseudo-random values, chosen both from all 'double' bit patterns and from
+// the range in which the fast paths apply.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int parseSimpleDouble(double *, const char *, int);
+// [ 3] int formatFixed(char *, int, double, int);
+// [ 4] int formatGeneral(char *, int, double, int);
+// [ 5] int formatShortest(char *, double);
+// [ 5] int formatShortest(char *, float);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::FloatConvertUtil Util;
+typedef bsls::Types::Uint64    Uint64;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+    // 'snprintf' on older Windows libraries outputs an additional '0' in the
+    // exponent for scientific notation.
+# define BDLB_FLOATCONVERTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
+#endif
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+class Random {
+    // This class provides a deterministic generator of pseudo-random 64-bit
+    // values (xorshift64*).
+
+    // DATA
+    Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(Uint64 seed)
+    : d_state(seed ? seed : 1)
+        // Create a generator having the specified 'seed'.
+    {
+    }
+
+    // MANIPULATORS
+    Uint64 next()
+        // Return the next pseudo-random value.
+    {
+        d_state ^= d_state >> 12;
+        d_state ^= d_state << 25;
+        d_state ^= d_state >> 27;
+        return d_state * 2685821657736338717ULL;
+    }
+};
+
+double randomDouble(Random *random, int kind)
+    // Return a pseudo-random finite 'double' obtained from the specified
+    // 'random' generator and distributed according to the specified 'kind':
+    // 0 for any bit pattern, 1 for magnitudes around the range of the fast
+    // paths, and 2 for prices with two decimal places.
+{
+    switch (kind) {
+      case 0: {
+        double result;
+        do {
+            const Uint64 bits = random->next();
+            bsl::memcpy(&result, &bits, sizeof result);
+        } while (!(result == result) || result - result != 0);
+        return result;                                                // RETURN
+      }
+      case 1: {
+        const double mantissa = static_cast<double>(random->next() >> 11);
+        const int    exponent = static_cast<int>(random->next() % 90) - 120;
+        const double result   = bsl::ldexp(mantissa, exponent);
+        return random->next() & 1 ? -result : result;                 // RETURN
+      }
+      default: {
+        return static_cast<double>(random->next() % 100000000) / 100;
+                                                                      // RETURN
+      }
+    }
+}
+
+void verifyFixed(int line, double value, int precision)
+    // Verify, reporting failures at the specified 'line', that 'formatFixed'
+    // formats the specified 'value' with the specified 'precision' exactly as
+    // 'snprintf' does, both with a sufficient buffer and with a truncating
+    // one.
+{
+    char expected[512];
+    char actual[512];
+
+    const int EXP_LEN = snprintf(expected,
+                                 sizeof expected,
+                                 "%.*f",
+                                 precision,
+                                 value);
+    const int LEN     = Util::formatFixed(actual,
+                                          sizeof actual,
+                                          value,
+                                          precision);
+
+    ASSERTV(line, value, precision, EXP_LEN, LEN, EXP_LEN == LEN);
+    ASSERTV(line, value, precision, expected, actual,
+            0 == bsl::strcmp(expected, actual));
+
+    const int SHORT = EXP_LEN / 2 + 1;
+
+    bsl::memset(actual, 'x', sizeof actual);
+    ASSERTV(line, EXP_LEN == Util::formatFixed(actual,
+                                               SHORT,
+                                               value,
+                                               precision));
+    ASSERTV(line, 0 == bsl::strncmp(expected, actual, SHORT - 1));
+    ASSERTV(line, '\0' == actual[SHORT - 1]);
+    ASSERTV(line, 'x'  == actual[SHORT]);
+}
+
+void verifyGeneral(int line, double value, int precision)
+    // Verify, reporting failures at the specified 'line', that
+    // 'formatGeneral' formats the specified 'value' with the specified
+    // 'precision' exactly as 'snprintf' does, both with a sufficient buffer
+    // and with a truncating one.
+{
+    char expected[512];
+    char actual[512];
+
+    const int EXP_LEN = snprintf(expected,
+                                 sizeof expected,
+                                 "%.*g",
+                                 precision,
+                                 value);
+    const int LEN     = Util::formatGeneral(actual,
+                                            sizeof actual,
+                                            value,
+                                            precision);
+
+    ASSERTV(line, value, precision, EXP_LEN, LEN, EXP_LEN == LEN);
+    ASSERTV(line, value, precision, expected, actual,
+            0 == bsl::strcmp(expected, actual));
+
+    const int SHORT = EXP_LEN / 2 + 1;
+
+    bsl::memset(actual, 'x', sizeof actual);
+    ASSERTV(line, EXP_LEN == Util::formatGeneral(actual,
+                                                 SHORT,
+                                                 value,
+                                                 precision));
+    ASSERTV(line, 0 == bsl::strncmp(expected, actual, SHORT - 1));
+    ASSERTV(line, '\0' == actual[SHORT - 1]);
+    ASSERTV(line, 'x'  == actual[SHORT]);
+}
+
+template <class TYPE>
+void verifyShortest(int line, TYPE value, int minPrecision)
+    // Verify, reporting failures at the specified 'line', that
+    // 'formatShortest' formats the specified 'value' as "%.*g" does with the
+    // smallest precision, starting at the specified 'minPrecision', for which
+    // the text parses back to 'value'.
+{
+    char actual[Util::k_SHORTEST_BUFFER_SIZE];
+
+    const int LEN = Util::formatShortest(actual, value);
+    ASSERTV(line, actual, LEN == static_cast<int>(bsl::strlen(actual)));
+
+    const TYPE PARSED = static_cast<TYPE>(bsl::strtod(actual, 0));
+    ASSERTV(line, value, actual, PARSED == value);
+
+    for (int precision = minPrecision; precision < minPrecision + 3;
+                                                                 ++precision) {
+        char text[64];
+        snprintf(text, sizeof text, "%.*g", precision, value);
+
+        if (static_cast<TYPE>(bsl::strtod(text, 0)) == value) {
+            ASSERTV(line, value, precision, text, actual,
+                    0 == bsl::strcmp(text, actual));
+            return;                                                   // RETURN
+        }
+    }
+
+    char text[64];
+    snprintf(text, sizeof text, "%.*g", minPrecision + 3, value);
+    ASSERTV(line, value, text, actual, 0 == bsl::strcmp(text, actual));
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Prices
+///- - - - - - - - - - - - - -
+// Suppose that we are writing an encoder that must emit prices in the same
+// format as a legacy encoder that used 'snprintf' with "%.*g".
+//
+// First, we format a price with 15 significant digits, just as the legacy
+// encoder did:
+//..
+    char buffer[32];
+
+    int length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+                                                       sizeof buffer,
+                                                       101.25,
+                                                       15);
+    ASSERT(6 == length);
+    ASSERT(0 == bsl::strcmp("101.25", buffer));
+//..
+// Then, we observe that 15 digits are not always sufficient to preserve the
+// value, while 17 digits show the error in the binary representation:
+//..
+    length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+                                                   sizeof buffer,
+                                                   0.1 + 0.2,
+                                                   15);
+    ASSERT(0 == bsl::strcmp("0.3", buffer));
+
+    length = bdlb::FloatConvertUtil::formatGeneral(buffer,
+                                                   sizeof buffer,
+                                                   0.1 + 0.2,
+                                                   17);
+    ASSERT(0 == bsl::strcmp("0.30000000000000004", buffer));
+//..
+// Next, we format the values with as few digits as preserve them:
+//..
+    char shortest[bdlb::FloatConvertUtil::k_SHORTEST_BUFFER_SIZE];
+
+    length = bdlb::FloatConvertUtil::formatShortest(shortest, 101.25);
+    ASSERT(0 == bsl::strcmp("101.25", shortest));
+
+    length = bdlb::FloatConvertUtil::formatShortest(shortest, 0.1 + 0.2);
+    ASSERT(0 == bsl::strcmp("0.30000000000000004", shortest));
+//..
+// Finally, we parse the text back, falling back to 'strtod' when the fast
+// path does not apply:
+//..
+    double value;
+    if (0 != bdlb::FloatConvertUtil::parseSimpleDouble(&value,
+                                                       shortest,
+                                                       length)) {
+        value = bsl::strtod(shortest, 0);
+    }
+    ASSERT(0.1 + 0.2 == value);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'formatShortest'
+        //
+        // Concerns:
+        //: 1 The text parses back to the value ('double'), or to a 'double'
+        //:   that converts to the value ('float').
+        //:
+        //: 2 The text is that of "%.*g" for the smallest precision, starting
+        //:   at 'DBL_DIG' ('FLT_DIG' for 'float'), for which concern 1 holds.
+        //:
+        //: 3 The length of the text is returned, and the text is
+        //:   null-terminated.
+        //:
+        //: 4 Zeros, extreme values, infinities, and NaN are formatted as "%g"
+        //:   formats them (for the values that do not need more digits).
+        //
+        // Plan:
+        //: 1 Using a table of values, verify the exact text produced for
+        //:   both 'double' and 'float'.  (C-1..4)
+        //:
+        //: 2 For pseudo-random values of each kind, verify concerns 1-3 by
+        //:   comparison with 'snprintf' and 'strtod'.  (C-1..3)
+        //
+        // Testing:
+        //   int formatShortest(char *, double);
+        //   int formatShortest(char *, float);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatShortest'" << endl
+                          << "================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double QNAN = bsl::numeric_limits<double>::quiet_NaN();
+
+        if (verbose) cout << "\nTable-driven 'double' values." << endl;
+        {
+            static const struct {
+                int         d_line;
+                double      d_value;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUE                     EXPECTED
+                //----  ------------------------  -----------------------
+                { L_,   0.0,                      "0"                     },
+                { L_,   1.0,                      "1"                     },
+                { L_,   -1.5,                     "-1.5"                  },
+                { L_,   0.1,                      "0.1"                   },
+                { L_,   0.1 + 0.2,                "0.30000000000000004"   },
+                { L_,   101.25,                   "101.25"                },
+                { L_,   1.0 / 3,                  "0.3333333333333333"    },
+                { L_,   2.0 / 3,                  "0.6666666666666666"    },
+#if defined(BDLB_FLOATCONVERTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
+                { L_,   1e15,                     "1e+015"                },
+#else
+                { L_,   1e15,                     "1e+15"                 },
+#endif
+                { L_,   123456789012345.0,        "123456789012345"       },
+                { L_,   1234567890123456.0,       "1234567890123456"      },
+                { L_,   12345678901234568.0,      "12345678901234568"     },
+#if defined(BDLB_FLOATCONVERTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
+                { L_,   1e21,                     "1e+021"                },
+                { L_,   1e-7,                     "1e-007"                },
+#else
+                { L_,   1e21,                     "1e+21"                 },
+                { L_,   1e-7,                     "1e-07"                 },
+#endif
+                { L_,   5e-324,                   "4.94065645841247e-324" },
+                { L_,   DBL_MAX,                  "1.7976931348623157e+308"},
+                { L_,   DBL_MIN,                  "2.2250738585072014e-308"},
+                { L_,   INF,                      "inf"                   },
+                { L_,   -INF,                     "-inf"                  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const double      VALUE    = DATA[ti].d_value;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                char      buffer[Util::k_SHORTEST_BUFFER_SIZE];
+                const int LEN = Util::formatShortest(buffer, VALUE);
+
+                if (veryVerbose) { T_ P_(LINE) P_(VALUE) P(buffer) }
+
+                ASSERTV(LINE, EXPECTED, buffer,
+                        0 == bsl::strcmp(EXPECTED, buffer));
+                ASSERTV(LINE, LEN,
+                        static_cast<int>(bsl::strlen(EXPECTED)) == LEN);
+            }
+
+            char buffer[Util::k_SHORTEST_BUFFER_SIZE];
+
+            Util::formatShortest(buffer, -0.0);
+            ASSERTV(buffer, 0 == bsl::strcmp("-0", buffer));
+
+            char expected[32];
+            snprintf(expected, sizeof expected, "%g", QNAN);
+            Util::formatShortest(buffer, QNAN);
+            ASSERTV(expected, buffer, 0 == bsl::strcmp(expected, buffer));
+        }
+
+        if (verbose) cout << "\nTable-driven 'float' values." << endl;
+        {
+            static const struct {
+                int         d_line;
+                float       d_value;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUE                     EXPECTED
+                //----  ------------------------  -----------------------
+                { L_,   0.0f,                     "0"                     },
+                { L_,   0.1f,                     "0.1"                   },
+                { L_,   101.25f,                  "101.25"                },
+                { L_,   1.0f / 3,                 "0.33333334"            },
+                { L_,   16777216.0f,              "16777216"              },
+                { L_,   16777218.0f,              "16777218"              },
+#if defined(BDLB_FLOATCONVERTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
+                { L_,   FLT_MAX,                  "3.4028235e+038"        },
+                { L_,   FLT_MIN,                  "1.1754944e-038"        },
+#else
+                { L_,   FLT_MAX,                  "3.4028235e+38"         },
+                { L_,   FLT_MIN,                  "1.1754944e-38"         },
+#endif
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const float       VALUE    = DATA[ti].d_value;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                char buffer[Util::k_SHORTEST_BUFFER_SIZE];
+                Util::formatShortest(buffer, VALUE);
+
+                if (veryVerbose) { T_ P_(LINE) P_(VALUE) P(buffer) }
+
+                ASSERTV(LINE, EXPECTED, buffer,
+                        0 == bsl::strcmp(EXPECTED, buffer));
+            }
+        }
+
+        if (verbose) cout << "\nPseudo-random values." << endl;
+        {
+            u::Random random(5);
+
+            for (int i = 0; i < 30000; ++i) {
+                const double VALUE = u::randomDouble(&random, i % 3);
+
+                u::verifyShortest(L_, VALUE, DBL_DIG);
+                u::verifyShortest(L_, static_cast<float>(VALUE), FLT_DIG);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'formatGeneral'
+        //
+        // Concerns:
+        //: 1 The text, and the returned length, are those of 'snprintf' with
+        //:   "%.*g", for all values and precisions, including the choice
+        //:   between the fixed and exponential styles, the removal of
+        //:   trailing zeros, and rounding to even on exact ties.
+        //:
+        //: 2 The text is truncated, and null-terminated, as 'snprintf' does
+        //:   when the buffer is too short.
+        //
+        // Plan:
+        //: 1 For a table of values, each negated too, exercising rounding
+        //:   carries, ties, style boundaries, and the limits of the fast path,
+        //:   compare the results with those of 'snprintf' for every precision
+        //:   in the range '[-1 .. 45]'.  (C-1..2)
+        //:
+        //: 2 Do the same for pseudo-random values of each kind and precisions
+        //:   in the range '[0 .. 19]'.  (C-1..2)
+        //
+        // Testing:
+        //   int formatGeneral(char *, int, double, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatGeneral'" << endl
+                          << "===============" << endl;
+
+        static const double DATA[] = {
+            0.0, 0.5, 1.5, 2.5, 0.125, 0.0625, 9.5, 99.5, 999.5, 0.95, 0.995,
+            9.9999999999999995, 1e15, 1e16, 1e17, 123456789012345678.0,
+            0.000244140625, 0.00024414062499999997, 0.0001, 0.00009999,
+            18446744073709549568.0, 18446744073709551616.0, 0.1, 0.2, 0.3,
+            101.25, 1.005, 2.675, 1e-5, 1e300, 5e-324, DBL_MAX, DBL_MIN,
+            bsl::numeric_limits<double>::infinity()
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int precision = -1; precision <= 45; ++precision) {
+                u::verifyGeneral(L_,  DATA[ti], precision);
+                u::verifyGeneral(L_, -DATA[ti], precision);
+            }
+        }
+
+        u::Random random(4);
+
+        for (int i = 0; i < 300000; ++i) {
+            const double VALUE     = u::randomDouble(&random, i % 3);
+            const int    PRECISION = static_cast<int>(random.next() % 20);
+
+            u::verifyGeneral(L_, VALUE, PRECISION);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'formatFixed'
+        //
+        // Concerns:
+        //: 1 The text, and the returned length, are those of 'snprintf' with
+        //:   "%.*f", for all values and precisions, including values that
+        //:   round to zero or carry into a new integral digit, and rounding
+        //:   to even on exact ties.
+        //:
+        //: 2 The text is truncated, and null-terminated, as 'snprintf' does
+        //:   when the buffer is too short.
+        //
+        // Plan:
+        //: 1 For a table of values, each negated too, compare the results
+        //:   with those of 'snprintf' for every precision in the range
+        //:   '[-1 .. 45]'.  (C-1..2)
+        //:
+        //: 2 Do the same for pseudo-random values of each kind and precisions
+        //:   in the range '[0 .. 19]'.  (C-1..2)
+        //
+        // Testing:
+        //   int formatFixed(char *, int, double, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatFixed'" << endl
+                          << "=============" << endl;
+
+        static const double DATA[] = {
+            0.0, 0.5, 1.5, 2.5, 0.125, 0.0625, 9.5, 99.5, 999.5, 0.95, 0.995,
+            0.0005, 0.0006, 0.00049, 0.000244140625, 0.00024414062499999997,
+            18446744073709549568.0, 18446744073709551616.0, 0.1, 0.2, 0.3,
+            101.25, 1.005, 2.675, 1e-5, 1e22, 1e300, 5e-324, DBL_MAX,
+            bsl::numeric_limits<double>::infinity()
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int precision = -1; precision <= 45; ++precision) {
+                u::verifyFixed(L_,  DATA[ti], precision);
+                u::verifyFixed(L_, -DATA[ti], precision);
+            }
+        }
+
+        u::Random random(3);
+
+        for (int i = 0; i < 300000; ++i) {
+            const double VALUE     = u::randomDouble(&random, i % 3);
+            const int    PRECISION = static_cast<int>(random.next() % 20);
+
+            u::verifyFixed(L_, VALUE, PRECISION);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'parseSimpleDouble'
+        //
+        // Concerns:
+        //: 1 Input in the accepted syntax, with at most 19 significant
+        //:   digits and an exactly computable value, is parsed, and the
+        //:   result is that of 'strtod'.
+        //:
+        //: 2 Other input, including valid numbers outside the fast path and
+        //:   input with trailing characters, is declined, and 'result' is
+        //:   unchanged.
+        //:
+        //: 3 Only 'inputLength' characters are examined.
+        //
+        // Plan:
+        //: 1 Using a table of inputs, verify the status and the value, and,
+        //:   on success, that the value is that of 'strtod'.  Pass the input
+        //:   followed by a character that would change the result, to verify
+        //:   that it is not examined.  (C-1..3)
+        //:
+        //: 2 Format pseudo-random values with a variety of formats, and
+        //:   verify that, when the input is parsed, the result is that of
+        //:   'strtod'.  (C-1)
+        //
+        // Testing:
+        //   int parseSimpleDouble(double *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseSimpleDouble'" << endl
+                          << "===================" << endl;
+
+        if (verbose) cout << "\nTable-driven inputs." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                bool        d_isParsed;
+            } DATA[] = {
+                //LINE  INPUT                         PARSED
+                //----  ----------------------------  ------
+                { L_,   "0",                          true   },
+                { L_,   "-0",                         true   },
+                { L_,   "+0.0",                       true   },
+                { L_,   "0e500",                      true   },
+                { L_,   "1",                          true   },
+                { L_,   "-1",                         true   },
+                { L_,   "101.25",                     true   },
+                { L_,   "0.1",                        true   },
+                { L_,   "0.30000000000000004",        false  },
+                { L_,   "9007199254740992",           true   },
+                { L_,   "9007199254740993",           false  },
+                { L_,   "0000000000000000000000001",  true   },
+                { L_,   "1234567890123456789",        false  },
+                { L_,   "12345678901234567890",       false  },
+                { L_,   "1e22",                       true   },
+                { L_,   "1e23",                       true   },
+                { L_,   "1e37",                       true   },
+                { L_,   "1e38",                       false  },
+                { L_,   "123e30",                     true   },
+                { L_,   "1e-22",                      true   },
+                { L_,   "1e-23",                      false  },
+                { L_,   "1.5E+3",                     true   },
+                { L_,   "1.5e-3",                     true   },
+                { L_,   "0.0000000000000000000001",   true   },
+                { L_,   "1e99999999999",              false  },
+                { L_,   "",                           false  },
+                { L_,   "-",                          false  },
+                { L_,   ".5",                         false  },
+                { L_,   "1.",                         false  },
+                { L_,   "1e",                         false  },
+                { L_,   "1e+",                        false  },
+                { L_,   "1x",                         false  },
+                { L_,   " 1",                         false  },
+                { L_,   "inf",                        false  },
+                { L_,   "nan",                        false  },
+                { L_,   "0x10",                       false  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const char *const INPUT     = DATA[ti].d_input;
+                const bool        IS_PARSED = DATA[ti].d_isParsed;
+                const int         LENGTH    = static_cast<int>(
+                                                         bsl::strlen(INPUT));
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                const bsl::string extended = bsl::string(INPUT) + "9";
+
+                double    result = -42.0;
+                const int rc     = Util::parseSimpleDouble(&result,
+                                                           extended.c_str(),
+                                                           LENGTH);
+
+#if !defined(FLT_EVAL_METHOD) || 0 == FLT_EVAL_METHOD
+                ASSERTV(LINE, INPUT, rc, IS_PARSED == (0 == rc));
+#endif
+                if (0 == rc) {
+                    const double EXPECTED = bsl::strtod(INPUT, 0);
+
+                    ASSERTV(LINE, INPUT, result, EXPECTED,
+                            EXPECTED == result);
+                    ASSERTV(LINE, INPUT, 0 == bsl::memcmp(&EXPECTED,
+                                                          &result,
+                                                          sizeof result));
+                }
+                else {
+                    ASSERTV(LINE, INPUT, result, -42.0 == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nPseudo-random inputs." << endl;
+        {
+            static const char *const FORMATS[] = {
+                "%.15g", "%.17g", "%.2f", "%.6e", "%.10e", "%.3f"
+            };
+            const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+            u::Random random(2);
+
+            for (int i = 0; i < 300000; ++i) {
+                const double VALUE  = u::randomDouble(&random, i % 3);
+                const char  *FORMAT = FORMATS[random.next() % NUM_FORMATS];
+
+                char      input[512];
+                const int LENGTH = snprintf(input,
+                                            sizeof input,
+                                            FORMAT,
+                                            VALUE);
+
+                double result;
+                if (0 == Util::parseSimpleDouble(&result, input, LENGTH)) {
+                    ASSERTV(input, bsl::strtod(input, 0) == result);
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format and parse a few values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char buffer[64];
+
+        ASSERT(6 == Util::formatGeneral(buffer, sizeof buffer, 3.1416, 15));
+        ASSERT(0 == bsl::strcmp("3.1416", buffer));
+
+        ASSERT(4 == Util::formatFixed(buffer, sizeof buffer, 3.1416, 2));
+        ASSERT(0 == bsl::strcmp("3.14", buffer));
+
+        ASSERT(6 == Util::formatShortest(buffer, 3.1416));
+        ASSERT(0 == bsl::strcmp("3.1416", buffer));
+
+        double value = 0;
+        ASSERT(0 == Util::parseSimpleDouble(&value, buffer, 6));
+        ASSERT(3.1416 == value);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Formatting and parsing prices is faster than with 'snprintf'
+        //:   and 'strtod'.
+        //
+        // Plan:
+        //: 1 Format 1000 prices, with two decimal places, repeatedly with
+        //:   'snprintf' and with each formatting function of this component,
+        //:   and report the time per value.  Likewise, parse the text.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_VALUES = 1000, k_NUM_ROUNDS = 1000 };
+
+        double   values[k_NUM_VALUES];
+        char     texts[k_NUM_VALUES][32];
+        int      lengths[k_NUM_VALUES];
+        u::Random random(1);
+
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            values[i]  = u::randomDouble(&random, 2);
+            lengths[i] = snprintf(texts[i], sizeof texts[i], "%.15g",
+                                  values[i]);
+        }
+
+        const double COUNT = static_cast<double>(k_NUM_VALUES) * k_NUM_ROUNDS;
+
+        char   buffer[64];
+        Uint64 checksum = 0;
+        double times[7];
+
+        for (int method = 0; method < 7; ++method) {
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (int i = 0; i < k_NUM_VALUES; ++i) {
+                    double parsed;
+
+                    switch (method) {
+                      case 0: {
+                        checksum += snprintf(buffer, sizeof buffer, "%.*g",
+                                             15, values[i]);
+                      } break;
+                      case 1: {
+                        checksum += Util::formatGeneral(buffer,
+                                                        sizeof buffer,
+                                                        values[i],
+                                                        15);
+                      } break;
+                      case 2: {
+                        checksum += snprintf(buffer, sizeof buffer, "%.*f",
+                                             15, values[i]);
+                      } break;
+                      case 3: {
+                        checksum += Util::formatFixed(buffer,
+                                                      sizeof buffer,
+                                                      values[i],
+                                                      15);
+                      } break;
+                      case 4: {
+                        checksum += Util::formatShortest(buffer, values[i]);
+                      } break;
+                      case 5: {
+                        parsed = bsl::strtod(texts[i], 0);
+                        checksum += parsed == values[i];
+                      } break;
+                      default: {
+                        Util::parseSimpleDouble(&parsed,
+                                                texts[i],
+                                                lengths[i]);
+                        checksum += parsed == values[i];
+                      } break;
+                    }
+                }
+            }
+
+            timer.stop();
+            times[method] = timer.accumulatedWallTime() * 1e9 / COUNT;
+        }
+
+        cout << "\"%.15g\":  snprintf " << times[0]
+             << " ns, formatGeneral "     << times[1] << " ns\n"
+             << "\"%.15f\":  snprintf " << times[2]
+             << " ns, formatFixed "       << times[3] << " ns\n"
+             << "shortest:  formatShortest " << times[4] << " ns\n"
+             << "parse:     strtod " << times[5]
+             << " ns, parseSimpleDouble " << times[6] << " ns\n"
+             << "(checksum " << checksum << ")" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,22 +4,279 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(RCSid_bdlb_guidutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_chacha20randomgenerator.h>
 #include <bdlb_guid.h>
 #include <bdlb_randomdevice.h>
 
+#include <bslma_newdeleteallocator.h>
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_byteorder.h>
+#include <bsls_log.h>
 #include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each thread generating GUIDs owns a 'GuidGenerator', created on first use
+// and held in thread-specific storage (cached in a thread-local variable
+// where supported), whose 'ChaCha20RandomGenerator' is seeded once from
+// 'RandomDevice' and supplies the random bits of all the GUIDs the thread
+// generates.  The generators are allocated from the new/delete allocator
+// rather than the global allocator, because they live as long as their
+// threads, which may outlive a global allocator installed by 'main'.
+//
+// Should 'RandomDevice' fail, after a few non-blocking attempts and a
+// blocking one, the generator is seeded from the timer and the thread and
+// process identifiers, which keeps the GUIDs of different threads distinct
+// but not unpredictable.  This degraded mode is logged as an error, and the
+// generator tries again to reseed from 'RandomDevice' each time it has
+// generated as many bytes as a refill of the buffer of its
+// 'ChaCha20RandomGenerator', until it succeeds.
+//
+// A child process created by 'fork' inherits the generator of the forking
+// thread, and would generate the same GUIDs as its parent.  A handler
+// registered with 'pthread_atfork' therefore increments 'g_forkGeneration' in
+// the child, and a generator seeded before that is reseeded on its next use.
+//
+// A time-ordered GUID holds in its first 60 bits, around the version field,
+// the number of 1/4096 milliseconds since the Unix epoch: the milliseconds in
+// the 48-bit 'unix_ts_ms' field, and the fraction in the 12-bit 'rand_a'
+// field, as allowed by method 3 of section 6.2 of RFC 9562.  Each generator
+// remembers the last such timestamp it used, and uses the next one if the
+// clock has not advanced since (or went backwards), so that the GUIDs
+// generated by a thread are strictly increasing.
+
 namespace BloombergLP {
 namespace bdlb {
 
 namespace {
 
+enum { k_NUM_NONBLOCKING_ATTEMPTS = 3 };
+    // number of times the non-blocking random device is read before falling
+    // back to the blocking one
+
+bool loadSeed(unsigned char *seed)
+    // Load into the specified 'seed' 'ChaCha20RandomGenerator::k_SEED_SIZE'
+    // bytes from the system random device, and return 'true'.  Should the
+    // device fail to deliver them, after a few attempts without blocking and
+    // one blocking, load bytes that are merely distinct from those loaded by
+    // other threads and processes, and return 'false'.
+{
+    for (int attempt = 0; attempt != k_NUM_NONBLOCKING_ATTEMPTS; ++attempt) {
+        if (0 == RandomDevice::getRandomBytesNonBlocking(
+                                       seed,
+                                       ChaCha20RandomGenerator::k_SEED_SIZE)) {
+            return true;                                              // RETURN
+        }
+    }
+
+    if (0 == RandomDevice::getRandomBytes(
+                                       seed,
+                                       ChaCha20RandomGenerator::k_SEED_SIZE)) {
+        return true;                                                  // RETURN
+    }
+
+    const bsls::Types::Int64  timer  = bsls::TimeUtil::getTimer();
+    const bsls::Types::Uint64 thread = bslmt::ThreadUtil::selfIdAsUint64();
+#ifdef BSLS_PLATFORM_OS_UNIX
+    const bsls::Types::Int64  process = ::getpid();
+#else
+    const bsls::Types::Int64  process = 0;
+#endif
+
+    bsl::memset(seed, 0, ChaCha20RandomGenerator::k_SEED_SIZE);
+    bsl::memcpy(seed,      &timer,   sizeof timer);
+    bsl::memcpy(seed +  8, &thread,  sizeof thread);
+    bsl::memcpy(seed + 16, &process, sizeof process);
+    return false;
+}
+
+void reportWeakSeed()
+    // Log that a generator was seeded without the system random device.
+{
+    BSLS_LOG_ERROR("bdlb::GuidUtil: the system random number generator is"
+                   " unavailable; the GUIDs of this thread are generated from"
+                   " a seed derived from the time and the thread and process"
+                   " identifiers, and may be predictable, until it can be"
+                   " reseeded");
+}
+
+                        // ====================
+                        // struct GuidGenerator
+                        // ====================
+
+struct GuidGenerator {
+    // This 'struct' holds the state of the generation of GUIDs by one thread.
+
+    // DATA
+    ChaCha20RandomGenerator d_random;         // source of the random bits
+
+    int                     d_forkGeneration; // 'g_forkGeneration' when
+                                              // 'd_random' was seeded
+
+    bool                    d_isSeedWeak;     // 'true' if 'd_random' was not
+                                              // seeded from 'RandomDevice'
+
+    bsl::size_t             d_numWeakBytes;   // bytes generated since the
+                                              // last attempt to seed
+                                              // 'd_random' from
+                                              // 'RandomDevice'
+
+    bsls::Types::Uint64     d_lastTimestamp;  // timestamp of the last
+                                              // time-ordered GUID, in 1/4096
+                                              // milliseconds
+
+    // CREATORS
+    GuidGenerator(const unsigned char *seed,
+                  bool                 isSeedWeak,
+                  int                  forkGeneration)
+        // Create a generator whose random bits are determined by the
+        // specified 'seed', which is weak if the specified 'isSeedWeak' is
+        // 'true', recording the specified 'forkGeneration'.
+    : d_random(seed)
+    , d_forkGeneration(forkGeneration)
+    , d_isSeedWeak(isSeedWeak)
+    , d_numWeakBytes(0)
+    , d_lastTimestamp(0)
+    {
+    }
+
+    // MANIPULATORS
+    void getRandomBytes(unsigned char *buffer, bsl::size_t numBytes)
+        // Load the specified 'numBytes' next random bytes into the specified
+        // 'buffer'.  If the seed of this generator is weak, first try to
+        // reseed it from 'RandomDevice' each time it has generated enough
+        // bytes since the last attempt for 'd_random' to refill its buffer.
+    {
+        if (d_isSeedWeak) {
+            d_numWeakBytes += numBytes;
+            if (d_numWeakBytes >= ChaCha20RandomGenerator::k_BUFFER_SIZE) {
+                unsigned char seed[ChaCha20RandomGenerator::k_SEED_SIZE];
+                if (loadSeed(seed)) {
+                    d_random.seed(seed);
+                    d_isSeedWeak = false;
+                    BSLS_LOG_INFO("bdlb::GuidUtil: reseeded from the system"
+                                  " random number generator");
+                }
+                d_numWeakBytes = 0;
+            }
+        }
+        d_random.getRandomBytes(buffer, numBytes);
+    }
+
+    void reseed(int forkGeneration)
+        // Reseed this generator from 'RandomDevice' if possible, recording
+        // the specified 'forkGeneration'.
+    {
+        unsigned char seed[ChaCha20RandomGenerator::k_SEED_SIZE];
+        d_isSeedWeak     = !loadSeed(seed);
+        d_numWeakBytes   = 0;
+        d_forkGeneration = forkGeneration;
+        d_random.seed(seed);
+        if (d_isSeedWeak) {
+            reportWeakSeed();
+        }
+    }
+};
+
+bsls::AtomicOperations::AtomicTypes::Int g_forkGeneration = { 0 };
+    // number of times this process was created by 'fork' from a process
+    // having GUID generators
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(GuidGenerator *, g_threadLocalGenerator, 0);
+    // cache for the 'bslmt::ThreadUtil::getSpecific' of 'generatorKey()'
+#endif
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+extern "C" void bdlb_GuidUtil_onFork()
+    // Record that the process was created by 'fork'.
+{
+    bsls::AtomicOperations::addIntNv(&g_forkGeneration, 1);
+}
+#endif
+
+extern "C" void bdlb_GuidUtil_deleteGenerator(void *generator)
+    // Destroy the specified 'generator' of the exiting thread, and deallocate
+    // its memory.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadLocalGenerator = 0;
+#endif
+    bslma::NewDeleteAllocator::singleton().deleteObject(
+                                      static_cast<GuidGenerator *>(generator));
+}
+
+const bslmt::ThreadUtil::Key& generatorKey()
+    // Return the key of the thread-specific storage holding the generator of
+    // each thread.
+{
+    static bslmt::ThreadUtil::Key s_generatorKey;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_generatorKey,
+                                     &bdlb_GuidUtil_deleteGenerator);
+#ifdef BSLS_PLATFORM_OS_UNIX
+        pthread_atfork(0, 0, &bdlb_GuidUtil_onFork);
+#endif
+    }
+    return s_generatorKey;
+}
+
+GuidGenerator *currentGenerator()
+    // Return the GUID generator of the calling thread, creating it on first
+    // use, and reseeding it if the process was created by 'fork' since it
+    // was seeded.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    GuidGenerator *generator = g_threadLocalGenerator;
+#else
+    GuidGenerator *generator = static_cast<GuidGenerator *>(
+                              bslmt::ThreadUtil::getSpecific(generatorKey()));
+#endif
+
+    if (!generator) {
+        const bslmt::ThreadUtil::Key& key = generatorKey();
+
+        unsigned char seed[ChaCha20RandomGenerator::k_SEED_SIZE];
+        const bool    isSeedWeak = !loadSeed(seed);
+        if (isSeedWeak) {
+            reportWeakSeed();
+        }
+
+        generator = new (bslma::NewDeleteAllocator::singleton())
+              GuidGenerator(seed,
+                            isSeedWeak,
+                            bsls::AtomicOperations::getInt(&g_forkGeneration));
+        bslmt::ThreadUtil::setSpecific(key, generator);
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        g_threadLocalGenerator = generator;
+#endif
+    }
+    else {
+        const int forkGeneration =
+                     bsls::AtomicOperations::getIntRelaxed(&g_forkGeneration);
+        if (generator->d_forkGeneration != forkGeneration) {
+            generator->reseed(forkGeneration);
+        }
+    }
+    return generator;
+}
+
                         // ---------------
                         // struct GuidUtil
                         // ---------------
@@ -123,7 +380,7 @@ void GuidUtil::generate(unsigned char *result, bsl::size_t numGuids)
 {
     unsigned char *bytes = result;
     unsigned char *end = bytes + numGuids * Guid::k_GUID_NUM_BYTES;
-    RandomDevice::getRandomBytesNonBlocking(bytes, end - bytes);
+    currentGenerator()->getRandomBytes(bytes, end - bytes);
     while (bytes != end) {
         typedef unsigned char uc;
         bytes[6] = uc(0x40 | (bytes[6] & 0x0F));
@@ -137,6 +394,58 @@ void GuidUtil::generate(Guid *result, bsl::size_t numGuids)
     generate(reinterpret_cast<unsigned char *>(result), numGuids);
 }
 
+Guid GuidUtil::generateTimeOrdered()
+{
+    Guid result;
+    generateTimeOrdered(&result);
+    return result;
+}
+
+void GuidUtil::generateTimeOrdered(unsigned char *result, bsl::size_t numGuids)
+{
+    GuidGenerator *generator = currentGenerator();
+
+    unsigned char *bytes = result;
+    unsigned char *end = bytes + numGuids * Guid::k_GUID_NUM_BYTES;
+    generator->getRandomBytes(bytes, end - bytes);
+
+    const bsls::TimeInterval now = bsls::SystemTime::nowRealtimeClock();
+
+    bsls::Types::Uint64 timestamp = 0;
+    if (now.seconds() >= 0) {
+        const bsls::Types::Uint64 nanoseconds = now.nanoseconds();
+
+        timestamp = (static_cast<bsls::Types::Uint64>(now.seconds()) * 1000
+                     + nanoseconds / 1000000) << 12
+                  | (nanoseconds % 1000000) * 4096 / 1000000;
+    }
+
+    while (bytes != end) {
+        if (timestamp <= generator->d_lastTimestamp) {
+            timestamp = generator->d_lastTimestamp + 1;
+        }
+        generator->d_lastTimestamp = timestamp;
+
+        const bsls::Types::Uint64 milliseconds = timestamp >> 12;
+        const unsigned int        fraction     =
+                                static_cast<unsigned int>(timestamp) & 0xFFF;
+
+        typedef unsigned char uc;
+        for (int i = 0; i != 6; ++i) {
+            bytes[i] = uc(milliseconds >> (40 - 8 * i));
+        }
+        bytes[6] = uc(0x70 | fraction >> 8);
+        bytes[7] = uc(fraction);
+        bytes[8] = uc(0x80 | (bytes[8] & 0x3F));
+        bytes += Guid::k_GUID_NUM_BYTES;
+    }
+}
+
+void GuidUtil::generateTimeOrdered(Guid *result, bsl::size_t numGuids)
+{
+    generateTimeOrdered(reinterpret_cast<unsigned char *>(result), numGuids);
+}
+
 bsls::Types::Uint64 GuidUtil::getLeastSignificantBits(const Guid& guid)
 {
     bsls::Types::Uint64 result = 0;
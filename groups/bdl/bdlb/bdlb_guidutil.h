@@ -16,6 +16,37 @@ BSLS_IDENT("$Id: $")
 // serves as a namespace for utility functions that create and work with
 // Globally Unique Identifiers (GUIDs).
 //
+///GUID Generation
+///---------------
+// Two kinds of GUIDs can be generated.  'generate' produces RFC 4122 version 4
+// GUIDs, whose 122 bits other than the version and variant fields are random.
+// 'generateTimeOrdered' produces RFC 9562 version 7 GUIDs, which begin with
+// the time of their generation, in units of 1/4096 of a millisecond since the
+// Unix epoch, followed by 62 random bits.  Time-ordered GUIDs compare (with
+// 'operator<') in the order they were generated, to within the precision of
+// the system clock, which makes them efficient keys for indexes such as
+// B-trees: new keys are inserted next to each other rather than at random
+// places.  The time-ordered GUIDs generated by any one thread are strictly
+// increasing, even if they are generated within the same clock tick or the
+// system clock is set back.
+//
+// The random bits of both kinds of GUIDs are drawn from a cryptographically
+// secure generator (see 'bdlb_chacha20randomgenerator') owned by the calling
+// thread, which is seeded from 'bdlb::RandomDevice' when the thread first
+// generates a GUID, and reseeded in a child process created by 'fork'.
+// Generating a GUID thus costs no more than computing 16 random bytes in
+// memory, and never involves a system call nor synchronization between
+// threads.  It is also more efficient to generate GUIDs in batches, by
+// passing 'numGuids' to 'generate' or 'generateTimeOrdered', than one at a
+// time.  See test case -1 in the test driver for the rates achieved.
+//
+// In the unlikely event that 'bdlb::RandomDevice' fails, even when read in
+// blocking mode, the generator is seeded from the time and the thread and
+// process identifiers instead: the GUIDs remain distinct, but may be
+// predictable.  This is logged as an error through 'bsls::Log', and the
+// generator is reseeded from 'bdlb::RandomDevice' as soon as it succeeds
+// again.
+//
 ///Grammar for GUIDs Used in 'GuidFromString'
 ///------------------------------------------
 // This conversion performed by 'GuidFromString' is intended to be used for
@@ -46,6 +77,10 @@ BSLS_IDENT("$Id: $")
 //
 ///Usage
 ///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Identifying Employees
+/// - - - - - - - - - - - - - - - -
 // Suppose we are building a system for managing records for employees in a
 // large international firm.  These records have no natural field which can be
 // used as a unique ID, so a GUID must be created for each employee.
@@ -149,6 +184,32 @@ BSLS_IDENT("$Id: $")
 //      assert(e2 < e3 || e3 < e2);
 //      assert(e1 < e3 || e3 < e1);
 //..
+//
+///Example 2: Generating Keys for an Index
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we assign an identifier to each order entering a trading
+// system, and that orders are stored in a database indexed by that
+// identifier.  Random GUIDs would scatter the insertions of new orders all
+// over the index, so we use time-ordered GUIDs instead.
+//
+// First, we generate the identifiers of a batch of incoming orders:
+//..
+//  bdlb::Guid orderIds[10];
+//  bdlb::GuidUtil::generateTimeOrdered(orderIds, 10);
+//..
+// Then, we generate the identifier of an order arriving later:
+//..
+//  bdlb::Guid lateOrderId = bdlb::GuidUtil::generateTimeOrdered();
+//..
+// Finally, we observe that the identifiers sort in the order in which they
+// were generated, and that they are version 7 GUIDs:
+//..
+//  for (int i = 1; i < 10; ++i) {
+//      assert(orderIds[i - 1] < orderIds[i]);
+//  }
+//  assert(orderIds[9] < lateOrderId);
+//  assert(7 == bdlb::GuidUtil::getVersion(lateOrderId));
+//..
 
 #include <bdlscm_version.h>
 
@@ -199,6 +260,38 @@ struct GuidUtil {
         // specification, consisting of 122 randomly generated bits, two
         // 'variant' bits set to '10' and four 'version' bits set to '0100'.
 
+    static void generateTimeOrdered(Guid *result, bsl::size_t numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 9562 version 7
+        // specification, and load the resulting GUIDs into the array referred
+        // to by the specified 'result'.  Optionally specify 'numGuids',
+        // indicating the number of GUIDs to load into the 'result' array.  If
+        // 'numGuids' is not supplied, a default of 1 is used.  A version 7
+        // GUID consists of a 48-bit big-endian count of milliseconds since the
+        // Unix epoch, four 'version' bits set to '0111', 12 bits holding a
+        // fraction of a millisecond, two 'variant' bits set to '10', and 62
+        // randomly generated bits.  The GUIDs are greater than any GUID
+        // previously generated by this method in the calling thread, and
+        // increasing along 'result'.  The behavior is undefined unless
+        // 'result' refers to a contiguous sequence of at least 'numGuids' Guid
+        // objects.
+
+    static void generateTimeOrdered(unsigned char *result,
+                                    bsl::size_t    numGuids = 1);
+        // Generate a sequence of GUIDs meeting the RFC 9562 version 7
+        // specification, and load the bytes of the resulting GUIDs into the
+        // array referred to by the specified 'result'.  Optionally specify
+        // 'numGuids', indicating the number of GUIDs to load into the 'result'
+        // array.  If 'numGuids' is not supplied, a default of 1 is used.  See
+        // the overload taking a 'Guid *' for the format and ordering of the
+        // GUIDs.  The behavior is undefined unless 'result' refers to a
+        // contiguous sequence of at least '16 * numGuids' bytes.
+
+    static Guid generateTimeOrdered();
+        // Generate and return a single GUID meeting the RFC 9562 version 7
+        // specification, greater than any GUID previously generated by
+        // 'generateTimeOrdered' in the calling thread (see the overload taking
+        // a 'Guid *').
+
     static int guidFromString(Guid *result, bslstl::StringRef guidString);
         // Parse the specified 'guidString' (in {GUID String Format}) and load
         // its value into the specified 'result'.  Return 0 if 'result'
@@ -2,6 +2,7 @@
 #include <bdlb_guidutil.h>
 
 #include <bdlb_guid.h>
+#include <bdlb_randomdevice.h>
 
 #include <bslim_testutil.h>
 
@@ -11,15 +12,29 @@
 
 #include <bslmf_assert.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_byteorder.h>
+#include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -45,8 +60,13 @@ using namespace bsl;
 // [4] bsl::string guidToString(const Guid& guid)
 // [5] Uint64 getMostSignificantBits(const Guid& guid)
 // [6] Uint64 getLeastSignificantBits(const Guid& guid)
+// [7] void generateTimeOrdered(Guid *out, size_t cnt)
+// [7] void generateTimeOrdered(unsigned char *out, size_t cnt)
+// [7] Guid generateTimeOrdered()
 // ----------------------------------------------------------------------------
-// [7] USAGE EXAMPLE
+// [8] CONCERN: GUIDs are unique across threads and forked processes.
+// [9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: GUIDS PER SECOND
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -178,9 +198,123 @@ const Element &V0 = VALUES[0],            // V0, V1, ... are used in
               &V7 = VALUES[7],
               &V8 = VALUES[8];
 
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+bsls::Types::Uint64 timestampOf(const Obj& guid)
+    // Return the timestamp, in 1/4096 milliseconds since the Unix epoch, held
+    // by the specified time-ordered 'guid'.
+{
+    bsls::Types::Uint64 milliseconds = 0;
+    for (int i = 0; i != 6; ++i) {
+        milliseconds = milliseconds << 8 | guid[i];
+    }
+    return milliseconds << 12 | (guid[6] & 0x0F) << 8 | guid[7];
+}
+
+bsls::Types::Uint64 nowInMilliseconds()
+    // Return the current time in milliseconds since the Unix epoch.
+{
+    const bsls::TimeInterval now = bsls::SystemTime::nowRealtimeClock();
+    return now.seconds() * 1000 + now.nanoseconds() / 1000000;
+}
+
+struct GenerateGuids {
+    // This functor generates GUIDs into a range of an array when invoked,
+    // alternating between random and time-ordered GUIDs.
+
+    // DATA
+    Obj *d_guids_p;    // GUIDs to generate
+    int  d_numGuids;   // number of GUIDs to generate
+
+    // MANIPULATORS
+    void operator()()
+        // Generate 'd_numGuids' GUIDs into 'd_guids_p', and verify that the
+        // time-ordered ones increase.
+    {
+        for (int i = 0; i < d_numGuids; ++i) {
+            if (i % 2) {
+                Util::generate(&d_guids_p[i]);
+            }
+            else {
+                Util::generateTimeOrdered(&d_guids_p[i]);
+                if (i) {
+                    ASSERTV(i, d_guids_p[i - 2] < d_guids_p[i]);
+                }
+            }
+        }
+    }
+};
+
+struct MeasureGuidRate {
+    // This functor measures, when invoked, the rate at which the calling
+    // thread generates GUIDs in each of several ways.
+
+    enum {
+        k_NUM_METHODS = 5,     // ways of generating GUIDs
+        k_BATCH_SIZE  = 64     // GUIDs per batch
+    };
+
+    // DATA
+    int     d_numGuids;   // number of GUIDs to generate each way
+    double *d_rates_p;    // GUIDs per second, each way
+
+    // MANIPULATORS
+    void operator()()
+        // Generate 'd_numGuids' GUIDs in each way, and load the rates achieved
+        // into the 'k_NUM_METHODS' elements of 'd_rates_p'.
+    {
+        Obj             guids[k_BATCH_SIZE];
+        bsls::Stopwatch timer;
+
+        for (int method = 0; method != k_NUM_METHODS; ++method) {
+            // The first way is the reading of the random device for each
+            // GUID, which 'generate' used to do; it is much slower, so fewer
+            // GUIDs are generated.
+
+            const int numGuids = method ? d_numGuids : d_numGuids / 100;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numGuids; i += k_BATCH_SIZE) {
+                switch (method) {
+                  case 0: {
+                    for (int j = 0; j != k_BATCH_SIZE; ++j) {
+                        bdlb::RandomDevice::getRandomBytesNonBlocking(
+                                  reinterpret_cast<unsigned char *>(&guids[j]),
+                                  sizeof guids[j]);
+                    }
+                  } break;
+                  case 1: {
+                    for (int j = 0; j != k_BATCH_SIZE; ++j) {
+                        guids[j] = Util::generate();
+                    }
+                  } break;
+                  case 2: {
+                    Util::generate(guids, k_BATCH_SIZE);
+                  } break;
+                  case 3: {
+                    for (int j = 0; j != k_BATCH_SIZE; ++j) {
+                        guids[j] = Util::generateTimeOrdered();
+                    }
+                  } break;
+                  default: {
+                    Util::generateTimeOrdered(guids, k_BATCH_SIZE);
+                  } break;
+                }
+            }
+            timer.stop();
+            d_rates_p[method] = numGuids / timer.accumulatedWallTime();
+        }
+    }
+};
+
 //=============================================================================
 //                              USAGE EXAMPLE
 //-----------------------------------------------------------------------------
+///Example 1: Identifying Employees
+/// - - - - - - - - - - - - - - - -
 // Suppose we are building a system for managing records for employees in a
 // large international firm.  These records have no natural field which can be
 // used as a unique ID, so a GUID must be created for each employee.
@@ -295,7 +429,7 @@ int main(int argc, char *argv[])
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
     switch (test)  { case 0:
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -328,6 +462,258 @@ int main(int argc, char *argv[])
         ASSERT(e1 < e2 || e2 < e1);
         ASSERT(e2 < e3 || e3 < e2);
         ASSERT(e1 < e3 || e3 < e1);
+//..
+//
+///Example 2: Generating Keys for an Index
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we assign an identifier to each order entering a trading
+// system, and that orders are stored in a database indexed by that
+// identifier.  Random GUIDs would scatter the insertions of new orders all
+// over the index, so we use time-ordered GUIDs instead.
+//
+// First, we generate the identifiers of a batch of incoming orders:
+//..
+        bdlb::Guid orderIds[10];
+        bdlb::GuidUtil::generateTimeOrdered(orderIds, 10);
+//..
+// Then, we generate the identifier of an order arriving later:
+//..
+        bdlb::Guid lateOrderId = bdlb::GuidUtil::generateTimeOrdered();
+//..
+// Finally, we observe that the identifiers sort in the order in which they
+// were generated, and that they are version 7 GUIDs:
+//..
+        for (int i = 1; i < 10; ++i) {
+            ASSERT(orderIds[i - 1] < orderIds[i]);
+        }
+        ASSERT(orderIds[9] < lateOrderId);
+        ASSERT(7 == bdlb::GuidUtil::getVersion(lateOrderId));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: GUIDS ARE UNIQUE ACROSS THREADS AND FORKED PROCESSES
+        //
+        // Concerns:
+        //: 1 GUIDs generated concurrently by several threads are distinct.
+        //:
+        //: 2 GUIDs generated by a child process created by 'fork' are
+        //:   distinct from those generated by its parent, although the
+        //:   child inherits the state of the forking thread.
+        //
+        // Plan:
+        //: 1 Generate GUIDs from several threads at once, alternating random
+        //:   and time-ordered ones, and verify that all are distinct.  (C-1)
+        //:
+        //: 2 On UNIX platforms, generate a GUID, fork, generate GUIDs in both
+        //:   processes, send those of the child to the parent through a pipe,
+        //:   and verify that all are distinct.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: GUIDs are unique across threads and forked processes.
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+               << "CONCERN: GUIDS ARE UNIQUE ACROSS THREADS AND PROCESSES"
+               << endl
+               << "====================================================="
+               << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_GUIDS = 10000 };
+
+        {
+            bsl::vector<Obj>                      guids(k_NUM_THREADS *
+                                                        k_NUM_GUIDS);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_THREADS);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                GenerateGuids generator = { &guids[i * k_NUM_GUIDS],
+                                            k_NUM_GUIDS };
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          generator));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            bsl::sort(guids.begin(), guids.end());
+            ASSERT(guids.end() == bsl::adjacent_find(guids.begin(),
+                                                     guids.end()));
+        }
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\nGenerating GUIDs in forked processes.\n";
+        {
+            enum { k_NUM_FORKED_GUIDS = 64 };
+
+            Obj guids[2 * k_NUM_FORKED_GUIDS];
+            Util::generate(guids, 1);
+
+            int fds[2];
+            ASSERT(0 == pipe(fds));
+
+            const pid_t child = fork();
+            ASSERT(0 <= child);
+
+            if (0 == child) {
+                Util::generate(guids, k_NUM_FORKED_GUIDS / 2);
+                Util::generateTimeOrdered(guids + k_NUM_FORKED_GUIDS / 2,
+                                          k_NUM_FORKED_GUIDS / 2);
+                const ssize_t numBytes = write(fds[1],
+                                               guids,
+                                               k_NUM_FORKED_GUIDS * 16);
+                _exit(k_NUM_FORKED_GUIDS * 16 == numBytes ? 0 : 1);
+            }
+
+            Util::generate(guids + k_NUM_FORKED_GUIDS,
+                           k_NUM_FORKED_GUIDS / 2);
+            Util::generateTimeOrdered(
+                                  guids + k_NUM_FORKED_GUIDS * 3 / 2,
+                                  k_NUM_FORKED_GUIDS / 2);
+
+            bsl::size_t numRead = 0;
+            while (numRead < k_NUM_FORKED_GUIDS * 16) {
+                const ssize_t rc = read(
+                                  fds[0],
+                                  reinterpret_cast<char *>(guids) + numRead,
+                                  k_NUM_FORKED_GUIDS * 16 - numRead);
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            }
+            ASSERTV(numRead, k_NUM_FORKED_GUIDS * 16 == numRead);
+
+            int status = -1;
+            ASSERT(child == waitpid(child, &status, 0));
+            ASSERTV(status, 0 == status);
+            close(fds[0]);
+            close(fds[1]);
+
+            bsl::sort(guids, guids + 2 * k_NUM_FORKED_GUIDS);
+            ASSERT(guids + 2 * k_NUM_FORKED_GUIDS ==
+                   bsl::adjacent_find(guids, guids + 2 * k_NUM_FORKED_GUIDS));
+        }
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'generateTimeOrdered'
+        //
+        // Concerns:
+        //: 1 The GUIDs have version 7 and the RFC 4122 variant.
+        //:
+        //: 2 The timestamp of the GUIDs is the time of their generation, in
+        //:   milliseconds since the Unix epoch.
+        //:
+        //: 3 GUIDs generated by a thread are strictly increasing, whether
+        //:   they are generated one at a time or in batches, and within the
+        //:   same clock tick.
+        //:
+        //: 4 If 'count' is passed, 'count' GUIDs are returned, and memory
+        //:   outside the designated range is left unchanged.
+        //:
+        //: 5 The bits following the timestamp are random.
+        //
+        // Plan:
+        //: 1 Generate GUIDs with each overload, one at a time and in batches
+        //:   of various sizes, between two readings of the clock, verifying
+        //:   their version, variant, and that their timestamps lie between
+        //:   the readings.  (C-1..2)
+        //:
+        //: 2 Verify that each GUID is greater than the previous one.  (C-3)
+        //:
+        //: 3 Verify that the GUID following a batch is left zero.  (C-4)
+        //:
+        //: 4 Verify that each of the 62 random bits is set in some, but not
+        //:   all, of the GUIDs.  (C-5)
+        //
+        // Testing:
+        //   void generateTimeOrdered(Guid *out, size_t cnt)
+        //   void generateTimeOrdered(unsigned char *out, size_t cnt)
+        //   Guid generateTimeOrdered()
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING 'generateTimeOrdered'" << endl
+                          << "=============================" << endl;
+
+        enum { NUM_ITERS = 200, MAX_BATCH = 33 };
+
+        Obj                 previous;
+        unsigned char       setBits[8]   = { 0 };
+        unsigned char       clearBits[8] = { 0 };
+
+        for (int i = 0; i < NUM_ITERS; ++i) {
+            Obj               guids[MAX_BATCH + 1];
+            const bsl::size_t count = i % MAX_BATCH;
+
+            bsl::memset(guids, 0, sizeof guids);
+
+            const bsls::Types::Uint64 before = nowInMilliseconds();
+            switch (i % 3) {
+              case 0: {
+                Util::generateTimeOrdered(guids, count);
+              } break;
+              case 1: {
+                Util::generateTimeOrdered(
+                                   reinterpret_cast<unsigned char *>(guids),
+                                   count);
+              } break;
+              default: {
+                guids[0] = Util::generateTimeOrdered();
+              }
+            }
+            const bsls::Types::Uint64 after = nowInMilliseconds();
+
+            const bsl::size_t numGenerated = 2 == i % 3 ? 1 : count;
+
+            for (bsl::size_t j = 0; j < numGenerated; ++j) {
+                const Obj& guid = guids[j];
+                if (veryVeryVerbose) { P_(i) P_(j) P(guid) }
+
+                ASSERTV(i, j, 7 == Util::getVersion(guid));
+                ASSERTV(i, j, 0x80 == (guid[8] & 0xC0));
+
+                // Timestamps may run ahead of the clock by a fraction of a
+                // millisecond per GUID generated within a clock tick.
+
+                const bsls::Types::Uint64 milliseconds =
+                                                       timestampOf(guid) >> 12;
+                ASSERTV(i, j, before, milliseconds, before <= milliseconds);
+                ASSERTV(i, j, after, milliseconds, milliseconds <= after + 1);
+
+                ASSERTV(i, j, previous < guid);
+                previous = guid;
+
+                for (int k = 0; k < 8; ++k) {
+                    setBits[k]   |= guid[8 + k];
+                    clearBits[k] |= static_cast<unsigned char>(~guid[8 + k]);
+                }
+            }
+            for (bsl::size_t j = numGenerated; j < MAX_BATCH + 1; ++j) {
+                ASSERTV(i, j, Obj() == guids[j]);
+            }
+        }
+
+        ASSERTV(int(setBits[0]),   0xBF == setBits[0]);
+        ASSERTV(int(clearBits[0]), 0x7F == clearBits[0]);
+        for (int k = 1; k < 8; ++k) {
+            ASSERTV(k, int(setBits[k]),   0xFF == setBits[k]);
+            ASSERTV(k, int(clearBits[k]), 0xFF == clearBits[k]);
+        }
+
+        if (verbose) cout << "\nGenerating many GUIDs in one tick.\n";
+        {
+            enum { k_NUM_GUIDS = 10000 };
+
+            bsl::vector<Obj> guids(k_NUM_GUIDS);
+            Util::generateTimeOrdered(guids.data(), k_NUM_GUIDS);
+            for (int i = 1; i < k_NUM_GUIDS; ++i) {
+                ASSERTV(i, guids[i - 1] < guids[i]);
+                ASSERTV(i, timestampOf(guids[i - 1]) + 1 ==
+                                                      timestampOf(guids[i]));
+            }
+            ASSERT(guids.back() < Util::generateTimeOrdered());
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -729,6 +1115,69 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: GUIDS PER SECOND
+        //
+        // Concerns:
+        //: 1 Report the number of GUIDs generated per second by each thread,
+        //:   for each way of generating them, as the number of threads
+        //:   generating GUIDs at once grows.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, generate a million GUIDs in each
+        //:   thread, one at a time and in batches of 64, random and
+        //:   time-ordered, as well as (a hundredth as many) by reading the
+        //:   random device for each GUID, and report the average rate per
+        //:   thread.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: GUIDS PER SECOND
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: GUIDS PER SECOND" << endl
+                          << "==================================" << endl;
+
+        const char *METHODS[MeasureGuidRate::k_NUM_METHODS] = {
+            "RandomDevice, one at a time",
+            "generate, one at a time",
+            "generate, in batches",
+            "generateTimeOrdered, one at a time",
+            "generateTimeOrdered, in batches"
+        };
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            bsl::vector<double> rates(numThreads *
+                                      MeasureGuidRate::k_NUM_METHODS);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+            for (int i = 0; i < numThreads; ++i) {
+                MeasureGuidRate measure = {
+                    1000 * 1000,
+                    &rates[i * MeasureGuidRate::k_NUM_METHODS]
+                };
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          measure));
+            }
+            for (int i = 0; i < numThreads; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            cout << numThreads << " thread(s):\n";
+            for (int method = 0;
+                 method < MeasureGuidRate::k_NUM_METHODS;
+                 ++method) {
+                double total = 0;
+                for (int i = 0; i < numThreads; ++i) {
+                    total += rates[i * MeasureGuidRate::k_NUM_METHODS
+                                                                    + method];
+                }
+                cout << "    " << METHODS[method] << ": "
+                     << total / numThreads / 1e6
+                     << " million GUIDs per second per thread\n";
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -4,8 +4,52 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlb_tokenizer_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__SSSE3__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLB_TOKENIZER_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLB_TOKENIZER_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// 'Tokenizer::operator++' and 'TokenizerIterator::operator++' run the state
+// machine defined below over the input, one character at a time.
+// 'Tokenizer::loadTokens' instead classifies the input in blocks of 64
+// characters into two bit masks, one of the delimiter characters and one of
+// the hard delimiter characters, and locates each token and delimiter with a
+// few bit scans over those masks.  Starting at the cursor, the token extends
+// to the first delimiter character, and the delimiter that follows it extends
+// to the first token character, unless the delimiter contains two hard
+// delimiter characters, in which case it ends just before the second one.
+// This is exactly the sequence of states 'TOKEN', 'DHEAD', and 'DTAIL' that
+// the state machine goes through.
+//
+// The classification of a block is vectorized on platforms supporting SSSE3
+// by looking up the high and low nibble of each character in 16-entry tables
+// with a byte shuffle.  Each distinct high nibble occurring among the
+// delimiter characters is assigned its own bit (its *group*); the entry of the
+// low-nibble table for 'n' is the union of the groups of the high nibbles 'h'
+// for which '16 * h + n' is a delimiter character, and the entry of the
+// high-nibble table for 'h' is the group of 'h'.  A character is then a
+// delimiter character exactly if the intersection of its two entries is not
+// empty, and a second low-nibble table, built from the hard delimiter
+// characters alone, identifies those.  The tables are built once per set of
+// delimiters by 'Tokenizer_Data', and are usable only if the delimiter
+// characters have at most 8 distinct high nibbles; otherwise (and on other
+// platforms) blocks are classified with the 'd_charTypes' lookup table.
+
 namespace {
 
 // The character inputs break down into the following types:
@@ -51,12 +95,173 @@ const Action actionTable[NUM_INPUTS][NUM_STATES] = {
     {  ACC_DELIM,  ACC_DELIM,  STOP      }   // HRD
 };
 
+const int k_BLOCK_SIZE = 64;  // number of characters classified at once
+
+#if defined(BDLB_TOKENIZER_X86_SIMD)
+void classifyBlock(bsl::uint64_t       *delimiterMask,
+                   bsl::uint64_t       *hardMask,
+                   const unsigned char *delimiterNibbles,
+                   const unsigned char *hardNibbles,
+                   const unsigned char *highNibbleGroups,
+                   const char          *input)
+    // Load into the specified 'delimiterMask' and 'hardMask' the masks of the
+    // delimiter and hard delimiter characters, respectively, among the
+    // 'k_BLOCK_SIZE' characters starting at the specified 'input', using the
+    // specified 'delimiterNibbles', 'hardNibbles', and 'highNibbleGroups'
+    // tables (see the implementation notes).
+{
+    const __m128i delimiterTable =
+       _mm_loadu_si128(reinterpret_cast<const __m128i *>(delimiterNibbles));
+    const __m128i hardTable      =
+       _mm_loadu_si128(reinterpret_cast<const __m128i *>(hardNibbles));
+    const __m128i groupTable     =
+       _mm_loadu_si128(reinterpret_cast<const __m128i *>(highNibbleGroups));
+    const __m128i lowNibble      = _mm_set1_epi8(0x0f);
+    const __m128i zero           = _mm_setzero_si128();
+
+    bsl::uint64_t delimiters = 0;
+    bsl::uint64_t hards      = 0;
+
+    for (int i = 0; i < k_BLOCK_SIZE; i += 16) {
+        const __m128i chars  = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(input + i));
+        const __m128i low    = _mm_and_si128(chars, lowNibble);
+        const __m128i high   = _mm_and_si128(_mm_srli_epi16(chars, 4),
+                                             lowNibble);
+        const __m128i groups = _mm_shuffle_epi8(groupTable, high);
+
+        const __m128i delimiter = _mm_and_si128(
+                               _mm_shuffle_epi8(delimiterTable, low), groups);
+        const __m128i hard      = _mm_and_si128(
+                                    _mm_shuffle_epi8(hardTable, low), groups);
+
+        const __m128i notDelimiter = _mm_cmpeq_epi8(delimiter, zero);
+        const __m128i notHard      = _mm_cmpeq_epi8(hard, zero);
+
+        delimiters |= static_cast<bsl::uint64_t>(
+                             ~_mm_movemask_epi8(notDelimiter) & 0xffff) << i;
+        hards      |= static_cast<bsl::uint64_t>(
+                                  ~_mm_movemask_epi8(notHard) & 0xffff) << i;
+    }
+
+    *delimiterMask = delimiters;
+    *hardMask      = hards;
+}
+#endif  // BDLB_TOKENIZER_X86_SIMD
+
 }  // close unnamed namespace
 
 namespace BloombergLP {
 
 namespace bdlb {
 
+namespace {
+
+                        // ==================
+                        // class BlockScanner
+                        // ==================
+
+class BlockScanner {
+    // This mechanism searches a sequence of characters, classified by a
+    // 'Tokenizer_Data' object, for the next character of a given kind,
+    // classifying the sequence 'k_BLOCK_SIZE' characters at a time and
+    // retaining the classification of the most recently examined block.
+
+  public:
+    // TYPES
+    enum Kind {
+        e_TOKEN,      // token character
+        e_DELIMITER,  // soft or hard delimiter character
+        e_HARD        // hard delimiter character
+    };
+
+  private:
+    // DATA
+    const Tokenizer_Data *d_data_p;      // delimiter character categories
+    const char           *d_block_p;     // first character of current block
+    const char           *d_end_p;       // one past the end of the input
+    bsl::uint64_t         d_delimiters;  // delimiter characters in block
+    bsl::uint64_t         d_hards;       // hard delimiter characters in block
+
+  public:
+    // CREATORS
+    BlockScanner(const Tokenizer_Data *data, const char *end);
+        // Create a scanner for input ending at the specified 'end' whose
+        // characters are classified by the specified 'data'.
+
+    // MANIPULATORS
+    const char *find(const char *position, const char *limit, Kind kind);
+        // Return the address of the first character of the specified 'kind'
+        // in the range '[position .. limit)' of the input, or 'limit' if
+        // there is no such character.  The behavior is undefined unless
+        // 'position <= limit' and 'limit' does not follow the end of the
+        // input.
+};
+
+                        // ------------------
+                        // class BlockScanner
+                        // ------------------
+
+// CREATORS
+BlockScanner::BlockScanner(const Tokenizer_Data *data, const char *end)
+: d_data_p(data)
+, d_block_p(end)
+, d_end_p(end)
+, d_delimiters(0)
+, d_hards(0)
+{
+}
+
+// MANIPULATORS
+inline
+const char *BlockScanner::find(const char *position,
+                               const char *limit,
+                               Kind        kind)
+{
+    while (position != limit) {
+        bsl::size_t offset = position - d_block_p;
+
+        if (offset >= static_cast<bsl::size_t>(k_BLOCK_SIZE)) {
+            // 'position' is outside of the current block (or precedes it, in
+            // which case the difference wraps around).
+
+            const bsl::ptrdiff_t numCharacters = d_end_p - position;
+
+            d_data_p->classify(&d_delimiters,
+                               &d_hards,
+                               position,
+                               numCharacters < k_BLOCK_SIZE
+                               ? static_cast<int>(numCharacters)
+                               : k_BLOCK_SIZE);
+            d_block_p = position;
+            offset    = 0;
+        }
+
+        const bsl::uint64_t mask = e_TOKEN     == kind ? ~d_delimiters
+                                 : e_DELIMITER == kind ?  d_delimiters
+                                 :                        d_hards;
+        const bsl::uint64_t bits = mask >> offset;
+
+        const bsl::ptrdiff_t numRemaining = limit - position;
+        const bsl::ptrdiff_t numInBlock   = k_BLOCK_SIZE - offset;
+
+        if (bits) {
+            const int index = BitUtil::numTrailingUnsetBits(bits);
+            return index < numRemaining && index < numInBlock
+                   ? position + index
+                   : limit;                                           // RETURN
+        }
+
+        if (numRemaining <= numInBlock) {
+            return limit;                                             // RETURN
+        }
+        position += numInBlock;
+    }
+    return limit;
+}
+
+}  // close unnamed namespace
+
                         // --------------------
                         // class Tokenizer_Data
                         // --------------------
@@ -73,6 +278,8 @@ Tokenizer_Data::Tokenizer_Data(const bslstl::StringRef& softDelimiters)
         index = static_cast<unsigned char>(*it);
         d_charTypes[index] = SFT;
     }
+
+    loadNibbleTables();
 }
 
 Tokenizer_Data::Tokenizer_Data(const bslstl::StringRef& softDelimiters,
@@ -95,6 +302,80 @@ Tokenizer_Data::Tokenizer_Data(const bslstl::StringRef& softDelimiters,
         index = static_cast<unsigned char>(*it);
         d_charTypes[index] = HRD;
     }
+
+    loadNibbleTables();
+}
+
+// PRIVATE MANIPULATORS
+void Tokenizer_Data::loadNibbleTables()
+{
+    bsl::memset(d_delimiterNibbles, 0, k_NUM_NIBBLES);
+    bsl::memset(d_hardNibbles,      0, k_NUM_NIBBLES);
+    bsl::memset(d_highNibbleGroups, 0, k_NUM_NIBBLES);
+    d_hasNibbleTables = true;
+
+    int numGroups = 0;
+
+    for (int i = 0; i < k_MAX_CHARS; ++i) {
+        if (TOK == d_charTypes[i]) {
+            continue;                                               // CONTINUE
+        }
+
+        const int high = i >> 4;
+        const int low  = i & 0x0f;
+
+        if (0 == d_highNibbleGroups[high]) {
+            if (8 == numGroups) {
+                d_hasNibbleTables = false;
+                return;                                               // RETURN
+            }
+            d_highNibbleGroups[high] =
+                                 static_cast<unsigned char>(1 << numGroups++);
+        }
+
+        d_delimiterNibbles[low] |= d_highNibbleGroups[high];
+        if (HRD == d_charTypes[i]) {
+            d_hardNibbles[low] |= d_highNibbleGroups[high];
+        }
+    }
+}
+
+// ACCESSORS
+void Tokenizer_Data::classify(bsl::uint64_t *delimiterMask,
+                              bsl::uint64_t *hardMask,
+                              const char    *input,
+                              int            numCharacters) const
+{
+    BSLS_ASSERT(delimiterMask);
+    BSLS_ASSERT(hardMask);
+    BSLS_ASSERT(input || 0 == numCharacters);
+    BSLS_ASSERT(0 <= numCharacters);
+    BSLS_ASSERT(numCharacters <= k_BLOCK_SIZE);
+
+#if defined(BDLB_TOKENIZER_X86_SIMD)
+    if (k_BLOCK_SIZE == numCharacters && d_hasNibbleTables) {
+        classifyBlock(delimiterMask,
+                      hardMask,
+                      d_delimiterNibbles,
+                      d_hardNibbles,
+                      d_highNibbleGroups,
+                      input);
+        return;                                                       // RETURN
+    }
+#endif
+
+    bsl::uint64_t delimiters = 0;
+    bsl::uint64_t hards      = 0;
+
+    for (int i = 0; i < numCharacters; ++i) {
+        const int type = inputType(input[i]);
+
+        delimiters |= static_cast<bsl::uint64_t>(TOK != type) << i;
+        hards      |= static_cast<bsl::uint64_t>(HRD == type) << i;
+    }
+
+    *delimiterMask = delimiters;
+    *hardMask      = hards;
 }
 
                         // -----------------------
@@ -480,6 +761,72 @@ void Tokenizer::resetImpl(const char *input, const char *endOfInput)
     ++*this;                 // find first token
 }
 
+int Tokenizer::loadTokens(bslstl::StringRef *tokens, int maxNumTokens)
+{
+    return loadTokens(tokens, 0, maxNumTokens);
+}
+
+int Tokenizer::loadTokens(bslstl::StringRef *tokens,
+                          bslstl::StringRef *delimiters,
+                          int                maxNumTokens)
+{
+    BSLS_ASSERT(tokens || 0 == maxNumTokens);
+    BSLS_ASSERT(0 <= maxNumTokens);
+
+    int numTokens = 0;
+
+    if (!d_end_p) {
+        // The end of null-terminated input is not known in advance, so it
+        // cannot be classified in blocks.
+
+        for (; numTokens < maxNumTokens && !d_endFlag; ++numTokens) {
+            tokens[numTokens] = token();
+            if (delimiters) {
+                delimiters[numTokens] = trailingDelimiter();
+            }
+            ++*this;
+        }
+        return numTokens;                                             // RETURN
+    }
+
+    BlockScanner scanner(&d_sharedData, d_end_p);
+
+    for (; numTokens < maxNumTokens && !d_endFlag; ++numTokens) {
+        tokens[numTokens].assign(d_token_p, d_postDelim_p);
+        if (delimiters) {
+            delimiters[numTokens].assign(d_postDelim_p, d_cursor_p);
+        }
+
+        // Advance to the next token exactly as 'operator++' does (see the
+        // implementation notes).
+
+        d_prevDelim_p = d_postDelim_p;
+        d_token_p     = d_cursor_p;
+
+        if (d_end_p == d_cursor_p) {
+            d_postDelim_p = d_cursor_p;
+            d_endFlag     = true;
+            continue;                                               // CONTINUE
+        }
+
+        d_postDelim_p = scanner.find(d_cursor_p,
+                                     d_end_p,
+                                     BlockScanner::e_DELIMITER);
+
+        const char *next = scanner.find(d_postDelim_p,
+                                        d_end_p,
+                                        BlockScanner::e_TOKEN);
+        const char *hard = scanner.find(d_postDelim_p,
+                                        next,
+                                        BlockScanner::e_HARD);
+        if (hard != next) {
+            next = scanner.find(hard + 1, next, BlockScanner::e_HARD);
+        }
+        d_cursor_p = next;
+    }
+    return numTokens;
+}
+
 void Tokenizer::reset(const char *input)
 {
     BSLS_ASSERT(input);
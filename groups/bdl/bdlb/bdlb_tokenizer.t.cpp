@@ -6,6 +6,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>                  // 'bsl::atoi'
@@ -109,6 +110,7 @@ using namespace bsl;
 //
 // ACCESSORS
 // [ 2] int inputType(char character) const;
+// [12] void classify(uint64_t *, uint64_t *, const char *, int) const;
 //
 //                        // -----------------------
 //                        // class TokenizerIterator
@@ -147,6 +149,8 @@ using namespace bsl;
 //
 // MANIPULATORS
 // [ 4] Tokenizer& operator++();
+// [12] int loadTokens(StringRef *tokens, int maxNumTokens);
+// [12] int loadTokens(StringRef *tokens, StringRef *delims, int max);
 // [ 6] void reset(const char *input);
 // [ 6] void reset(const StringRef& input);
 //
@@ -173,7 +177,8 @@ using namespace bsl;
 // [ 9] DRQS 101217017
 // [10] STANDARD INPUT ITERATOR INTERFACE
 // [11] STANDARD ALGORITHMS
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'loadTokens'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -382,7 +387,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -525,6 +530,266 @@ int main(int argc, char **argv)
     ASSERT(EXPECTED3 == result3);
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadTokens'
+        //
+        // Concerns:
+        //: 1 'classify' sets exactly the bits of the (hard) delimiter
+        //:   characters among the specified number of characters, whether or
+        //:   not the delimiters can be classified by their nibbles.
+        //:
+        //: 2 'loadTokens' loads the same tokens and (trailing) delimiters,
+        //:   and leaves the tokenizer in the same state, as the equivalent
+        //:   sequence of calls to 'operator++', for input supplied as a
+        //:   'StringRef' or a null-terminated string.
+        //:
+        //: 3 'loadTokens' loads at most the specified number of tokens, and
+        //:   fewer only when the end of the input is reached.
+        //:
+        //: 4 Tokens and delimiters spanning blocks of 64 characters, and
+        //:   input ending in the middle of a block, are handled correctly.
+        //
+        // Plan:
+        //: 1 For a table of delimiter sets, including sets having more than 8
+        //:   distinct high nibbles and sets of characters having the high bit
+        //:   set, compare the masks loaded by 'classify' for pseudo-random
+        //:   input of every length from 0 to 64 with the result of
+        //:   'inputType'.  (C-1)
+        //:
+        //: 2 For the same delimiter sets, generate pseudo-random input of
+        //:   lengths up to 400 characters from an alphabet biased towards the
+        //:   delimiter characters, and compare the tokens, delimiters, and
+        //:   state of a tokenizer advanced with 'loadTokens', in batches of
+        //:   various sizes, with those of a tokenizer advanced with
+        //:   'operator++'.  (C-2..4)
+        //
+        // Testing:
+        //   void classify(uint64_t *, uint64_t *, const char *, int) const;
+        //   int loadTokens(StringRef *tokens, int maxNumTokens);
+        //   int loadTokens(StringRef *tokens, StringRef *delims, int max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadTokens'" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_soft;       // soft delimiter characters
+            const char *d_hard;       // hard delimiter characters
+            const char *d_tokens;     // token characters in the alphabet
+            bool        d_hasNull;    // '\0' is a delimiter character
+        } DATA[] = {
+            //LN  SOFT              HARD             TOKENS   NULL
+            //--  ----------------  ---------------  -------  -----
+            { L_, "",               "",              "ab",    false },
+            { L_, " ",              "",              "ab",    false },
+            { L_, "",               ",",             "ab",    false },
+            { L_, " \t",            ",\n",           "ab\r",  false },
+            { L_, "stuv",           "HIJK",          "0123",  false },
+            { L_, " \t\n\r\f\v",     ",;:|/\\",       "aZ9",   false },
+            { L_, "\x80\xff",       "\xa0",          "a\x7f",  false },
+            { L_, "\x01\x11!1AQaq", "\x81\x91\xf0",   "b\x82",  false },
+            { L_, "\x12\x34\x56\x78", "\x9a\xbc\xde\xf0", "\x13",   false },
+            { L_, " ",              "",              "a",     true  },
+            { L_, "",               "",              "a",     true  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        unsigned int seed = 12345;  // for a simple linear congruential
+                                    // generator, reproducible across platforms
+
+        if (verbose) cout << "\nTesting 'classify'." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SOFT = DATA[ti].d_soft;
+            const char *const HARD = DATA[ti].d_hard;
+
+            bsl::string hard(HARD);
+            if (DATA[ti].d_hasNull) {
+                hard.push_back('\0');
+            }
+
+            const bdlb::Tokenizer_Data mX(SOFT, hard);
+
+            char buffer[64];
+            for (int trial = 0; trial < 20; ++trial) {
+                for (int i = 0; i < 64; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    buffer[i] = static_cast<char>(seed >> 16);
+                    if (0 == (seed >> 8) % 3) {
+                        // Make delimiter characters more frequent.
+
+                        const bsl::string all = SOFT + hard;
+                        if (!all.empty()) {
+                            buffer[i] = all[(seed >> 20) % all.size()];
+                        }
+                    }
+                }
+
+                for (int n = 0; n <= 64; ++n) {
+                    bsl::uint64_t delimiters = ~0ULL;
+                    bsl::uint64_t hards      = ~0ULL;
+                    mX.classify(&delimiters, &hards, buffer, n);
+
+                    bsl::uint64_t expDelimiters = 0;
+                    bsl::uint64_t expHards      = 0;
+                    for (int i = 0; i < n; ++i) {
+                        const int type = mX.inputType(buffer[i]);
+                        if (0 != type) {
+                            expDelimiters |= 1ULL << i;
+                        }
+                        if (2 == type) {
+                            expHards |= 1ULL << i;
+                        }
+                    }
+                    ASSERTV(LINE, trial, n, expDelimiters == delimiters);
+                    ASSERTV(LINE, trial, n, expHards      == hards);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'loadTokens'." << endl;
+
+        static const int BATCH_SIZES[] = { 0, 1, 2, 3, 7, 64, 1000 };
+        const int NUM_BATCH_SIZES = static_cast<int>(sizeof  BATCH_SIZES
+                                                     / sizeof *BATCH_SIZES);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const SOFT    = DATA[ti].d_soft;
+            const char *const HARD    = DATA[ti].d_hard;
+            const char *const TOKENS  = DATA[ti].d_tokens;
+            const bool        NULL_HD = DATA[ti].d_hasNull;
+
+            bsl::string hard(HARD);
+            if (NULL_HD) {
+                hard.push_back('\0');
+            }
+            const bsl::string soft(SOFT);
+            const bsl::string tokenChars(TOKENS);
+
+            if (veryVerbose) { T_ P_(LINE) P_(soft) P(hard) }
+
+            for (int trial = 0; trial < 200; ++trial) {
+                seed = seed * 1103515245 + 12345;
+                const int LENGTH = trial < 100 ? trial
+                                               : (seed >> 16) % 400;
+
+                bsl::string input;
+                for (int i = 0; i < LENGTH; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    const unsigned int r = (seed >> 16) % 16;
+
+                    // Favor long tokens in half of the trials, and short
+                    // tokens and long delimiters in the other half.
+
+                    const unsigned int numTokenOdds = trial % 2 ? 13 : 6;
+                    if (r < numTokenOdds || (soft.empty() && hard.empty())) {
+                        input.push_back(
+                                 tokenChars[(seed >> 24) % tokenChars.size()]);
+                    }
+                    else if ((r & 1) && !soft.empty()) {
+                        input.push_back(soft[(seed >> 24) % soft.size()]);
+                    }
+                    else if (!hard.empty()) {
+                        input.push_back(hard[(seed >> 24) % hard.size()]);
+                    }
+                    else {
+                        input.push_back(soft[(seed >> 24) % soft.size()]);
+                    }
+                }
+                const StringRef INPUT(input.data(), input.size());
+
+                for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                for (int nullTerminated = 0; nullTerminated < 2;
+                                                            ++nullTerminated) {
+                for (int withDelims = 0; withDelims < 2; ++withDelims) {
+                    const int BATCH = BATCH_SIZES[bi];
+
+                    if (nullTerminated && NULL_HD) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    Obj mO(INPUT, soft, hard);    const Obj& O = mO;
+                    Obj mX(INPUT, soft, hard);    const Obj& X = mX;
+                    if (nullTerminated) {
+                        mO.reset(input.c_str());
+                        mX.reset(input.c_str());
+                    }
+
+                    bsl::vector<StringRef> tokens(BATCH);
+                    bsl::vector<StringRef> delims(BATCH);
+
+                    int numBatches = 0;
+                    do {
+                        const int N = withDelims
+                                      ? mX.loadTokens(tokens.data(),
+                                                      delims.data(),
+                                                      BATCH)
+                                      : mX.loadTokens(tokens.data(), BATCH);
+
+                        ASSERTV(LINE, trial, BATCH, N, 0 <= N && N <= BATCH);
+                        ASSERTV(LINE, trial, BATCH, N,
+                                N == BATCH || !X.isValid());
+
+                        for (int i = 0; i < N; ++i) {
+                            ASSERTV(LINE, trial, BATCH, i, O.isValid());
+                            if (!O.isValid()) {
+                                break;
+                            }
+                            ASSERTV(LINE, trial, BATCH, i,
+                                    O.token() == tokens[i]);
+                            ASSERTV(LINE, trial, BATCH, i,
+                                    O.token().data() == tokens[i].data());
+                            if (withDelims) {
+                                ASSERTV(LINE, trial, BATCH, i,
+                                        O.trailingDelimiter().data() ==
+                                                             delims[i].data());
+                                ASSERTV(LINE, trial, BATCH, i,
+                                        O.trailingDelimiter().length() ==
+                                                           delims[i].length());
+                            }
+                            ++mO;
+                        }
+
+                        ASSERTV(LINE, trial, BATCH,
+                                O.isValid() == X.isValid());
+                        ASSERTV(LINE, trial, BATCH,
+                                O.previousDelimiter().data() ==
+                                                X.previousDelimiter().data());
+                        ASSERTV(LINE, trial, BATCH,
+                                O.previousDelimiter().length() ==
+                                              X.previousDelimiter().length());
+                        if (O.isValid() && X.isValid()) {
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.token().data() == X.token().data());
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.token().length() == X.token().length());
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.trailingDelimiter().data() ==
+                                                X.trailingDelimiter().data());
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.trailingDelimiter().length() ==
+                                              X.trailingDelimiter().length());
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.hasTrailingSoft() ==
+                                                        X.hasTrailingSoft());
+                            ASSERTV(LINE, trial, BATCH,
+                                    O.isTrailingHard() == X.isTrailingHard());
+                        }
+                        if (testStatus) {
+                            break;
+                        }
+                    } while (0 < BATCH && X.isValid() && ++numBatches < 1000);
+                }
+                }
+                }
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // Testing support for 'advance' algorithm.
@@ -3459,6 +3724,110 @@ int main(int argc, char **argv)
 
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'loadTokens'
+        //
+        // Concerns:
+        //: 1 'loadTokens' is substantially faster than 'operator++' on long
+        //:   input, for both short and long tokens.
+        //
+        // Plan:
+        //: 1 Generate comma-separated (with optional spaces) input of about
+        //:   8 MB having fields of various average lengths, and time the
+        //:   extraction of all of its tokens with 'Tokenizer::operator++',
+        //:   with 'TokenizerIterator::operator++', and with 'loadTokens' in
+        //:   batches of 256 tokens, reporting the rate in MB per second.
+        //:   Report the best of several trials, to reduce the noise from
+        //:   other activity on the machine.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'loadTokens'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'loadTokens'" << endl
+                          << "==============================" << endl;
+
+        static const int FIELD_LENGTHS[] = { 2, 8, 32, 128 };
+        enum { k_NUM_LENGTHS = sizeof FIELD_LENGTHS / sizeof *FIELD_LENGTHS };
+
+        enum { k_INPUT_SIZE = 8 << 20, k_BATCH = 256, k_NUM_TRIALS = 5 };
+
+        const char *const NAMES[] = { "Tokenizer::operator++",
+                                      "TokenizerIterator::operator++",
+                                      "loadTokens" };
+        enum { k_NUM_NAMES = sizeof NAMES / sizeof *NAMES };
+
+        unsigned int seed = 12345;
+        bsl::size_t  sink = 0;
+
+        for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+            const int FIELD_LENGTH = FIELD_LENGTHS[li];
+
+            bsl::string input;
+            input.reserve(k_INPUT_SIZE + 2 * FIELD_LENGTH + 2);
+            while (input.size() < k_INPUT_SIZE) {
+                seed = seed * 1103515245 + 12345;
+                const int length = 1 + (seed >> 16) % (2 * FIELD_LENGTH);
+                for (int i = 0; i < length; ++i) {
+                    input.push_back(static_cast<char>('a' + i % 26));
+                }
+                input.push_back(0 == (seed >> 8) % 16 ? '\n' : ',');
+                if (0 == (seed >> 12) % 4) {
+                    input.push_back(' ');
+                }
+            }
+            const StringRef INPUT(input.data(), input.size());
+
+            cout << "Average field length " << FIELD_LENGTH << ":\n";
+
+            for (int ni = 0; ni < k_NUM_NAMES; ++ni) {
+                double bestSeconds = 0;
+                for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+                    bsls::Stopwatch timer;
+                    timer.start(true);
+
+                    switch (ni) {
+                      case 0: {
+                        for (Obj mX(INPUT, " ", ",\n"); mX.isValid(); ++mX) {
+                            sink += mX.token().length();
+                        }
+                      } break;
+                      case 1: {
+                        Obj mX(INPUT, " ", ",\n");
+                        for (ObjIt it = mX.begin(); it != mX.end(); ++it) {
+                            sink += (*it).length();
+                        }
+                      } break;
+                      default: {
+                        Obj       mX(INPUT, " ", ",\n");
+                        StringRef tokens[k_BATCH];
+                        while (mX.isValid()) {
+                            const int N = mX.loadTokens(tokens, k_BATCH);
+                            for (int i = 0; i < N; ++i) {
+                                sink += tokens[i].length();
+                            }
+                        }
+                      } break;
+                    }
+
+                    timer.stop();
+
+                    const double SECONDS = timer.accumulatedWallTime();
+                    if (0 == trial || SECONDS < bestSeconds) {
+                        bestSeconds = SECONDS;
+                    }
+                }
+
+                cout << "    " << NAMES[ni] << ": "
+                     << static_cast<double>(input.size()) / bestSeconds / 1e6
+                     << " MB/s" << endl;
+            }
+        }
+
+        if (veryVerbose) { P(sink) }
+      } break;
 
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -0,0 +1,686 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__SSSE3__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_BASE64UTIL_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLDE_BASE64UTIL_X86_SIMD)
+#include <immintrin.h>
+
+#define BDLDE_BASE64UTIL_TARGET_AVX2 __attribute__((target("avx2")))
+    // Allow the AVX2 instruction set in the annotated function only, so that
+    // the rest of the component runs on processors without it.
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The scalar implementation is the obvious one: three input bytes are split
+// into four 6-bit indices into the alphabet when encoding, and four table
+// lookups (which also classify whitespace and padding) are combined into
+// three bytes when decoding.
+//
+///Vectorized Encoding
+///- - - - - - - - - -
+// Each 16-byte vector holds 12 input bytes, which a byte shuffle spreads so
+// that every 32-bit lane holds the three bytes of one quantum (duplicating the
+// middle one).  Two masks and two 16-bit multiplications (one taking the high
+// half of the product) then shift each 6-bit field into the low bits of its
+// own byte, yielding four indices per lane.  An index is turned into its
+// character by adding an offset that is constant over each of the five ranges
+// 'A-Z', 'a-z', '0-9', 62, and 63; a saturating subtraction and a comparison
+// map each index to a number identifying its range, which selects the offset
+// from a 16-entry table with a second shuffle.  The URL alphabet differs from
+// the basic one only in that table.  The AVX2 variant processes two such
+// vectors, loaded from 12 bytes apart, in the two halves of a 256-bit
+// register.
+//
+///Vectorized Decoding
+///- - - - - - - - - -
+// Decoding classifies 16 characters at once by their high and low nibbles:
+// each of two 16-entry tables, indexed by one of the nibbles with a shuffle,
+// yields a set of bits, arranged so that the bitwise AND of the two sets is
+// zero exactly for the characters of the alphabet (the tables are derived by
+// grouping the high nibbles having the same set of valid low nibbles).  If any
+// character is invalid (most commonly a line break, but also padding or an
+// error) the block is left to the scalar loop, which handles that character
+// before the vectorized loop is resumed.  Otherwise, the value of each
+// character is obtained by adding an offset selected by its high nibble,
+// except that the character encoding 63 (which shares its high nibble with
+// other characters in both alphabets) is sent to the otherwise unused entry
+// 0.  Two multiply-add instructions then merge the four 6-bit values of each
+// lane into 24 bits, and a final shuffle packs the 12 bytes together.
+//
+// The vectorized loops run only while enough input remains that their
+// full-width stores cannot overrun the output buffer (whose size is at least
+// 3/4 of the input's), and only at quantum boundaries.
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+const char k_BASIC_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                "abcdefghijklmnopqrstuvwxyz"
+                                "0123456789+/";
+
+const char k_URL_ALPHABET[]   = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                "abcdefghijklmnopqrstuvwxyz"
+                                "0123456789-_";
+
+const signed char ff = -1;  // a character that is never valid
+const signed char sp = -2;  // whitespace, which is ignored
+const signed char eq = -3;  // the padding character, '='
+
+const signed char k_BASIC_DECODING[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, sp, sp, sp, sp, sp, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       sp, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff, ff, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, eq, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, ff,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+const signed char k_URL_DECODING[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, sp, sp, sp, sp, sp, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       sp, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, eq, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, 63,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+#if defined(BDLDE_BASE64UTIL_X86_SIMD)
+
+struct VectorTables {
+    // This 'struct' holds the shuffle tables used by the vectorized kernels
+    // for one alphabet (see the implementation notes).
+
+    signed char d_encodeOffsets[16];  // index range to character offset
+    signed char d_decodeLow[16];      // low nibble to class bits
+    signed char d_decodeHigh[16];     // high nibble to class bits
+    signed char d_decodeOffsets[16];  // high nibble to value offset
+    char        d_char63;             // character encoding the value 63
+};
+
+const VectorTables k_BASIC_TABLES = {
+    { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0 },
+    { 0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15 },
+    { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+    { 16, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+    '/'
+};
+
+const VectorTables k_URL_TABLES = {
+    { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 65, 0, 0 },
+    { 0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27 },
+    { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+    { -32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+    '_'
+};
+
+inline
+__m128i loadTable(const signed char *table)
+    // Return the 16 bytes at the specified 'table'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+}
+
+bool hasAvx2()
+    // Return 'true' if the current processor supports AVX2, and 'false'
+    // otherwise.  The processor is queried only on the first call.
+{
+    static bool s_hasAvx2 = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        s_hasAvx2 = __builtin_cpu_supports("avx2");
+    }
+
+    return s_hasAvx2;
+}
+
+inline
+__m128i encodeVector(__m128i input, __m128i offsets)
+    // Return the 16 characters encoding the first 12 bytes of the specified
+    // 'input', using the specified 'offsets' table of the alphabet.
+{
+    const __m128i spread = _mm_shuffle_epi8(
+                          input,
+                          _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                        7, 6, 8, 7, 10, 9, 11, 10));
+
+    const __m128i ac = _mm_mulhi_epu16(
+                             _mm_and_si128(spread, _mm_set1_epi32(0x0fc0fc00)),
+                             _mm_set1_epi32(0x04000040));
+    const __m128i bd = _mm_mullo_epi16(
+                             _mm_and_si128(spread, _mm_set1_epi32(0x003f03f0)),
+                             _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(ac, bd);
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range,
+                         _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                      indices),
+                                       _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+void encodeVectors(char               **output,
+                   const char         **input,
+                   const char          *end,
+                   const VectorTables&  tables)
+    // Encode 12-byte blocks from the specified '*input' into 16-character
+    // blocks at the specified '*output' while at least 16 bytes remain before
+    // the specified 'end', using the specified 'tables', and advance
+    // '*input' and '*output' past the data processed.
+{
+    const __m128i offsets = loadTable(tables.d_encodeOffsets);
+
+    const char *in  = *input;
+    char       *out = *output;
+
+    while (end - in >= 16) {
+        const __m128i data = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeVector(data, offsets));
+        in  += 12;
+        out += 16;
+    }
+
+    *input  = in;
+    *output = out;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+void encodeVectorsAvx2(char               **output,
+                       const char         **input,
+                       const char          *end,
+                       const VectorTables&  tables)
+    // Encode 24-byte blocks from the specified '*input' into 32-character
+    // blocks at the specified '*output' while at least 28 bytes remain before
+    // the specified 'end', using the specified 'tables', and advance
+    // '*input' and '*output' past the data processed.  The behavior is
+    // undefined unless the current processor supports AVX2.
+{
+    const __m256i offsets = _mm256_broadcastsi128_si256(
+                                         loadTable(tables.d_encodeOffsets));
+    const __m256i spreadMask = _mm256_setr_epi8(
+                                   1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9,
+                                   11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7,
+                                   10, 9, 11, 10);
+
+    const char *in  = *input;
+    char       *out = *output;
+
+    while (end - in >= 28) {
+        const __m256i data = _mm256_inserti128_si256(
+              _mm256_castsi128_si256(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(in))),
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 12)),
+              1);
+        const __m256i spread = _mm256_shuffle_epi8(data, spreadMask);
+
+        const __m256i ac = _mm256_mulhi_epu16(
+                          _mm256_and_si256(spread,
+                                           _mm256_set1_epi32(0x0fc0fc00)),
+                          _mm256_set1_epi32(0x04000040));
+        const __m256i bd = _mm256_mullo_epi16(
+                          _mm256_and_si256(spread,
+                                           _mm256_set1_epi32(0x003f03f0)),
+                          _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(ac, bd);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(
+                    range,
+                    _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26),
+                                                       indices),
+                                     _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(
+                  reinterpret_cast<__m256i *>(out),
+                  _mm256_add_epi8(indices,
+                                  _mm256_shuffle_epi8(offsets, range)));
+        in  += 24;
+        out += 32;
+    }
+
+    *input  = in;
+    *output = out;
+}
+
+const char *decodeVectors(char               **output,
+                          const char         **input,
+                          const char          *end,
+                          const VectorTables&  tables)
+    // Decode 16-character blocks from the specified '*input' into 12-byte
+    // blocks at the specified '*output' while at least 24 characters remain
+    // before the specified 'end' and the next block consists only of
+    // characters of the alphabet described by the specified 'tables', and
+    // advance '*input' and '*output' past the data processed.  Return the
+    // address following the first character outside the alphabet in the
+    // block that stopped the loop, or 'end' if the loop stopped for lack of
+    // input.
+{
+    const __m128i low      = loadTable(tables.d_decodeLow);
+    const __m128i high     = loadTable(tables.d_decodeHigh);
+    const __m128i offsets  = loadTable(tables.d_decodeOffsets);
+    const __m128i char63   = _mm_set1_epi8(tables.d_char63);
+    const __m128i nibble   = _mm_set1_epi8(0x0f);
+    const __m128i packMask = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                           14, 13, 12, -1, -1, -1, -1);
+
+    const char *in  = *input;
+    char       *out = *output;
+    const char *resume = end;
+
+    while (end - in >= 24) {
+        const __m128i chars = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(in));
+        const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4),
+                                                  nibble);
+        const __m128i lowNibbles = _mm_and_si128(chars, nibble);
+        const __m128i classes = _mm_and_si128(
+                                      _mm_shuffle_epi8(low, lowNibbles),
+                                      _mm_shuffle_epi8(high, highNibbles));
+        const int invalid = _mm_movemask_epi8(
+                             _mm_cmpgt_epi8(classes, _mm_setzero_si128()));
+        if (invalid) {
+            resume = in + bdlb::BitUtil::numTrailingUnsetBits(
+                                  static_cast<bsl::uint32_t>(invalid)) + 1;
+            break;
+        }
+
+        const __m128i values = _mm_add_epi8(
+                 chars,
+                 _mm_shuffle_epi8(offsets,
+                                  _mm_andnot_si128(_mm_cmpeq_epi8(chars,
+                                                                  char63),
+                                                   highNibbles)));
+        const __m128i merged = _mm_madd_epi16(
+                     _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+                     _mm_set1_epi32(0x00011000));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_shuffle_epi8(merged, packMask));
+        in  += 16;
+        out += 12;
+    }
+
+    *input  = in;
+    *output = out;
+    return resume;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+const char *decodeVectorsAvx2(char               **output,
+                              const char         **input,
+                              const char          *end,
+                              const VectorTables&  tables)
+    // Decode 32-character blocks from the specified '*input' into 24-byte
+    // blocks at the specified '*output' while at least 44 characters remain
+    // before the specified 'end' and the next block consists only of
+    // characters of the alphabet described by the specified 'tables', and
+    // advance '*input' and '*output' past the data processed.  Return the
+    // address following the first character outside the alphabet in the
+    // block that stopped the loop, or 'end' if the loop stopped for lack of
+    // input.  The behavior is undefined unless the current processor
+    // supports AVX2.
+{
+    const __m256i low     = _mm256_broadcastsi128_si256(
+                                              loadTable(tables.d_decodeLow));
+    const __m256i high    = _mm256_broadcastsi128_si256(
+                                             loadTable(tables.d_decodeHigh));
+    const __m256i offsets = _mm256_broadcastsi128_si256(
+                                          loadTable(tables.d_decodeOffsets));
+    const __m256i char63   = _mm256_set1_epi8(tables.d_char63);
+    const __m256i nibble   = _mm256_set1_epi8(0x0f);
+    const __m256i packMask = _mm256_setr_epi8(
+                                   2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                   -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                   14, 13, 12, -1, -1, -1, -1);
+    const __m256i laneMask = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+    const char *in  = *input;
+    char       *out = *output;
+    const char *resume = end;
+
+    while (end - in >= 44) {
+        const __m256i chars = _mm256_loadu_si256(
+                                       reinterpret_cast<const __m256i *>(in));
+        const __m256i highNibbles = _mm256_and_si256(
+                                                 _mm256_srli_epi32(chars, 4),
+                                                 nibble);
+        const __m256i lowNibbles = _mm256_and_si256(chars, nibble);
+        const __m256i classes = _mm256_and_si256(
+                                   _mm256_shuffle_epi8(low, lowNibbles),
+                                   _mm256_shuffle_epi8(high, highNibbles));
+        const int invalid = _mm256_movemask_epi8(
+                          _mm256_cmpgt_epi8(classes, _mm256_setzero_si256()));
+        if (invalid) {
+            resume = in + bdlb::BitUtil::numTrailingUnsetBits(
+                                  static_cast<bsl::uint32_t>(invalid)) + 1;
+            break;
+        }
+
+        const __m256i values = _mm256_add_epi8(
+              chars,
+              _mm256_shuffle_epi8(offsets,
+                                  _mm256_andnot_si256(
+                                          _mm256_cmpeq_epi8(chars, char63),
+                                          highNibbles)));
+        const __m256i merged = _mm256_madd_epi16(
+               _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)),
+               _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_permutevar8x32_epi32(
+                                     _mm256_shuffle_epi8(merged, packMask),
+                                     laneMask);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), packed);
+        in  += 32;
+        out += 24;
+    }
+
+    *input  = in;
+    *output = out;
+    return resume;
+}
+
+#endif  // BDLDE_BASE64UTIL_X86_SIMD
+
+char *encodeScalar(char                *output,
+                   const unsigned char *input,
+                   bsl::size_t          length,
+                   const char          *alphabet)
+    // Load into the specified 'output' the padded Base64 encoding, using the
+    // specified 'alphabet', of the specified 'input' having the specified
+    // 'length', and return the address following the last character written.
+{
+    while (length >= 3) {
+        const unsigned int value = (input[0] << 16) | (input[1] << 8)
+                                 |  input[2];
+
+        output[0] = alphabet[ value >> 18        ];
+        output[1] = alphabet[(value >> 12) & 0x3f];
+        output[2] = alphabet[(value >>  6) & 0x3f];
+        output[3] = alphabet[ value        & 0x3f];
+
+        input  += 3;
+        output += 4;
+        length -= 3;
+    }
+
+    if (length) {
+        const unsigned int value = (input[0] << 16)
+                                 | (2 == length ? input[1] << 8 : 0);
+
+        output[0] = alphabet[ value >> 18        ];
+        output[1] = alphabet[(value >> 12) & 0x3f];
+        output[2] = 2 == length ? alphabet[(value >> 6) & 0x3f] : '=';
+        output[3] = '=';
+        output += 4;
+    }
+
+    return output;
+}
+
+void insertLineBreaks(char        *output,
+                      const char  *encoded,
+                      bsl::size_t  length,
+                      bsl::size_t  maxLineLength)
+    // Copy the specified 'encoded' characters having the specified 'length'
+    // to the specified 'output', inserting a CRLF sequence after every
+    // specified 'maxLineLength' characters except at the end.  The behavior
+    // is undefined unless 'encoded' is the last 'length' characters of the
+    // buffer of 'length + 2 * ((length - 1) / maxLineLength)' characters at
+    // 'output' (so that each line is moved toward the front of the buffer
+    // before the characters following it are overwritten).
+{
+    while (length > maxLineLength) {
+        bsl::memmove(output, encoded, maxLineLength);
+        output  += maxLineLength;
+        encoded += maxLineLength;
+        length  -= maxLineLength;
+
+        *output++ = '\r';
+        *output++ = '\n';
+    }
+    bsl::memmove(output, encoded, length);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+bsl::size_t Base64Util::encodedLength(bsl::size_t inputLength,
+                                      int         maxLineLength)
+{
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const bsl::size_t length = (inputLength + 2) / 3 * 4;
+
+    return 0 == maxLineLength
+        || length <= static_cast<bsl::size_t>(maxLineLength)
+           ? length
+           : length + 2 * ((length - 1) / maxLineLength);
+}
+
+bsl::size_t Base64Util::encode(char        *output,
+                               const char  *input,
+                               bsl::size_t  inputLength,
+                               int          maxLineLength,
+                               Alphabet     alphabet)
+{
+    BSLS_ASSERT(output || !inputLength);
+    BSLS_ASSERT(input  || !inputLength);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const bsl::size_t length      = (inputLength + 2) / 3 * 4;
+    const bsl::size_t totalLength = encodedLength(inputLength, maxLineLength);
+
+    // Encode into the end of 'output', then spread the lines out if needed.
+
+    char       *out = output + (totalLength - length);
+    const char *in  = input;
+    const char *end = input + inputLength;
+
+#if defined(BDLDE_BASE64UTIL_X86_SIMD)
+    const u::VectorTables& tables = e_URL == alphabet ? u::k_URL_TABLES
+                                                     : u::k_BASIC_TABLES;
+    if (inputLength >= 28 && u::hasAvx2()) {
+        u::encodeVectorsAvx2(&out, &in, end, tables);
+    }
+    u::encodeVectors(&out, &in, end, tables);
+#endif
+
+    u::encodeScalar(out,
+                    reinterpret_cast<const unsigned char *>(in),
+                    end - in,
+                    e_URL == alphabet ? u::k_URL_ALPHABET
+                                      : u::k_BASIC_ALPHABET);
+
+    if (totalLength != length) {
+        u::insertLineBreaks(output,
+                            output + (totalLength - length),
+                            length,
+                            maxLineLength);
+    }
+
+    return totalLength;
+}
+
+int Base64Util::decode(char        *output,
+                       bsl::size_t *outputLength,
+                       const char  *input,
+                       bsl::size_t  inputLength,
+                       Alphabet     alphabet)
+{
+    BSLS_ASSERT(output || !inputLength);
+    BSLS_ASSERT(outputLength);
+    BSLS_ASSERT(input  || !inputLength);
+
+    const signed char *decoding = e_URL == alphabet ? u::k_URL_DECODING
+                                                    : u::k_BASIC_DECODING;
+
+    const char *in  = input;
+    const char *end = input + inputLength;
+    char       *out = output;
+
+    unsigned int quantum  = 0;  // values of the current quantum's characters
+    int          numChars = 0;  // number of characters in 'quantum'
+
+#if defined(BDLDE_BASE64UTIL_X86_SIMD)
+    const u::VectorTables& tables = e_URL == alphabet ? u::k_URL_TABLES
+                                                      : u::k_BASIC_TABLES;
+    const bool  avx2   = inputLength >= 44 && u::hasAvx2();
+    const char *resume = in;  // where the vectorized loop may resume
+#endif
+
+    while (in != end) {
+#if defined(BDLDE_BASE64UTIL_X86_SIMD)
+        if (0 == numChars && in >= resume) {
+            resume = avx2 ? u::decodeVectorsAvx2(&out, &in, end, tables)
+                          : end;
+            if (resume == end) {
+                resume = u::decodeVectors(&out, &in, end, tables);
+            }
+            if (in == end) {
+                break;
+            }
+        }
+#endif
+
+        const signed char value = decoding[static_cast<unsigned char>(*in)];
+
+        if (0 <= value) {
+            quantum = (quantum << 6) | value;
+            if (4 == ++numChars) {
+                out[0] = static_cast<char>(quantum >> 16);
+                out[1] = static_cast<char>(quantum >>  8);
+                out[2] = static_cast<char>(quantum);
+                out += 3;
+
+                quantum  = 0;
+                numChars = 0;
+            }
+        }
+        else if (u::eq == value) {
+            break;
+        }
+        else if (u::sp != value) {
+            return -1;                                                // RETURN
+        }
+        ++in;
+    }
+
+    if (in != end) {
+        // '*in' is the first padding character.  It must complete a quantum
+        // of 2 or 3 characters, whose unused low bits must be 0, and only
+        // whitespace (and a second '=' after 2 characters) may follow.
+
+        int numPadding;
+        if (2 == numChars && 0 == (quantum & 0xf)) {
+            *out++ = static_cast<char>(quantum >> 4);
+            numPadding = 2;
+        }
+        else if (3 == numChars && 0 == (quantum & 0x3)) {
+            *out++ = static_cast<char>(quantum >> 10);
+            *out++ = static_cast<char>(quantum >>  2);
+            numPadding = 1;
+        }
+        else {
+            return -1;                                                // RETURN
+        }
+
+        for (++in, --numPadding; in != end; ++in) {
+            const signed char value =
+                                   decoding[static_cast<unsigned char>(*in)];
+
+            if (u::eq == value && 0 < numPadding) {
+                --numPadding;
+            }
+            else if (u::sp != value) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        if (numPadding) {
+            return -1;                                                // RETURN
+        }
+    }
+    else if (numChars) {
+        return -1;                                                    // RETURN
+    }
+
+    *outputLength = out - output;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
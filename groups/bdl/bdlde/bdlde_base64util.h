@@ -0,0 +1,215 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide functions to encode and decode whole buffers in Base64.
+//
+//@CLASSES:
+//  bdlde::Base64Util: namespace for one-shot Base64 encoding and decoding
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Base64Util', that
+// serves as a namespace for functions converting a complete, contiguous buffer
+// to and from the Base64 representation described in 'bdlde_base64encoder'.
+// Where 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder' are automata that
+// accept their input in arbitrary pieces through arbitrary iterators, and so
+// must process it one character at a time, the functions of this component
+// see all of their input at once, which lets them work on blocks of input at
+// a time.  They should be preferred whenever the input is already in memory,
+// e.g., when encoding a message attachment.
+//
+// Two alphabets are supported, both defined in RFC 4648: the basic alphabet
+// (the one used by 'bdlde::Base64Encoder', ending in '+' and '/') and the
+// "URL and filename safe" alphabet, which replaces those two characters by '-'
+// and '_' respectively.  In both cases the output of 'encode' is padded with
+// '=' to a multiple of four characters, and 'decode' requires that padding.
+//
+///Output Format and Acceptable Input
+///----------------------------------
+// For any 'maxLineLength', 'encode' produces exactly the characters that a
+// 'bdlde::Base64Encoder' constructed with that 'maxLineLength' would produce
+// (with the characters '+' and '/' substituted when the URL alphabet is
+// used): a CRLF sequence is inserted after every 'maxLineLength' characters
+// except at the end of the output, and a 'maxLineLength' of 0 (the default for
+// this component, unlike 'bdlde::Base64Encoder') produces a single line.
+//
+// 'decode' accepts the same input as a 'bdlde::Base64Decoder' constructed to
+// treat unrecognized characters as errors: whitespace (' ', '\t', '\n',
+// '\v', '\f', and '\r') is ignored wherever it appears, and any other
+// character that is neither in the selected alphabet nor correctly placed
+// padding is an error, as are non-zero bits in the last character before the
+// padding and input that ends in the middle of a four-character quantum.
+//
+///Performance
+///-----------
+// On x86-64 platforms, blocks of input are translated with SSSE3 shuffles,
+// and with AVX2 if the running processor supports it (which is determined at
+// runtime), falling back to a table-driven implementation for the remaining
+// input and on other platforms.  See test case -1 in the test driver for
+// throughput comparisons with 'bdlde::Base64Encoder' and
+// 'bdlde::Base64Decoder'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding an Attachment
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to embed a binary attachment in a MIME message, which
+// requires lines of at most 76 characters, and to recover it on receipt.
+//
+// First, we create the attachment:
+//..
+//  bsl::vector<char> attachment(1000);
+//  for (bsl::size_t i = 0; i < attachment.size(); ++i) {
+//      attachment[i] = static_cast<char>(i * 7);
+//  }
+//..
+// Next, we size a buffer for the encoded text, and encode the attachment:
+//..
+//  bsl::string text(bdlde::Base64Util::encodedLength(attachment.size(), 76),
+//                   '\0');
+//
+//  bsl::size_t numChars = bdlde::Base64Util::encode(&text[0],
+//                                                   attachment.data(),
+//                                                   attachment.size(),
+//                                                   76);
+//  assert(text.size() == numChars);
+//  assert("AAcOFRwjKjE4P0ZNVFtiaXB3foWMk5qhqK+2vcTL0tng5+71/AMKERgfJi00"
+//         "O0JJUFdeZWxzeoGI\r\n" == text.substr(0, 78));
+//..
+// Then, on the receiving side, we size a buffer for the decoded data:
+//..
+//  bsl::vector<char> received(
+//                       bdlde::Base64Util::maxDecodedLength(text.size()));
+//..
+// Finally, we decode the text, which ignores the line breaks, and verify that
+// we received the original attachment:
+//..
+//  bsl::size_t numBytes;
+//  int         rc = bdlde::Base64Util::decode(received.data(),
+//                                             &numBytes,
+//                                             text.data(),
+//                                             text.size());
+//  assert(0 == rc);
+//
+//  received.resize(numBytes);
+//  assert(attachment == received);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                             // =================
+                             // struct Base64Util
+                             // =================
+
+struct Base64Util {
+    // This 'struct' provides a namespace for functions that encode a buffer
+    // into, and decode a buffer from, its Base64 representation.
+
+    // TYPES
+    enum Alphabet {
+        // Enumeration of the supported Base64 alphabets, which differ in the
+        // characters encoding the values 62 and 63.
+
+        e_BASIC,  // RFC 4648 section 4: '+' and '/'
+        e_URL     // RFC 4648 section 5: '-' and '_'
+    };
+
+    // CLASS METHODS
+    static bsl::size_t encodedLength(bsl::size_t inputLength,
+                                     int         maxLineLength = 0);
+        // Return the number of characters in the Base64 encoding of an input
+        // of the specified 'inputLength' bytes, including the padding and,
+        // unless the optionally specified 'maxLineLength' is 0, the CRLF
+        // sequences separating lines of at most 'maxLineLength' characters.
+        // The behavior is undefined unless '0 <= maxLineLength'.
+
+    static bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // Return the number of bytes that 'decode' may require in its output
+        // buffer to decode an input of the specified 'inputLength'
+        // characters.  Note that the returned value is at least the length of
+        // the decoded data, which is shorter if the input contains padding or
+        // whitespace.
+
+    static bsl::size_t encode(char        *output,
+                              const char  *input,
+                              bsl::size_t  inputLength,
+                              int          maxLineLength = 0,
+                              Alphabet     alphabet = e_BASIC);
+        // Load into the specified 'output' the Base64 encoding of the
+        // specified 'input' having the specified 'inputLength' bytes, split
+        // into lines of at most the optionally specified 'maxLineLength'
+        // characters (with no line breaks if 'maxLineLength' is 0, the
+        // default), using the optionally specified 'alphabet' (the basic
+        // alphabet by default).  Return the number of characters written,
+        // which is 'encodedLength(inputLength, maxLineLength)'.  The behavior
+        // is undefined unless '0 <= maxLineLength', 'output' refers to a
+        // buffer of at least 'encodedLength(inputLength, maxLineLength)'
+        // characters that does not overlap 'input', and 'input' refers to at
+        // least 'inputLength' bytes.  Note that 'input' and 'output' may be 0
+        // if 'inputLength' is 0.
+
+    static int decode(char        *output,
+                      bsl::size_t *outputLength,
+                      const char  *input,
+                      bsl::size_t  inputLength,
+                      Alphabet     alphabet = e_BASIC);
+        // Load into the specified 'output' the bytes encoded in Base64, using
+        // the optionally specified 'alphabet' (the basic alphabet by
+        // default), by the specified 'input' having the specified
+        // 'inputLength' characters, and load the number of bytes written into
+        // the specified 'outputLength'.  Return 0 on success, and a non-zero
+        // value if 'input' is not a valid Base64 encoding (see {Output Format
+        // and Acceptable Input}), in which case the contents of 'output' and
+        // '*outputLength' are unspecified.  The behavior is undefined unless
+        // 'output' refers to a buffer of at least
+        // 'maxDecodedLength(inputLength)' bytes that does not overlap 'input',
+        // and 'input' refers to at least 'inputLength' characters.  Note that
+        // 'input' and 'output' may be 0 if 'inputLength' is 0.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+inline
+bsl::size_t Base64Util::maxDecodedLength(bsl::size_t inputLength)
+{
+    return (inputLength + 3) / 4 * 3;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,901 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64encoder.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a utility 'struct' whose functions encode
+// and decode complete buffers.  Its output format and the input it accepts are
+// defined by reference to 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder',
+// which we therefore use as oracles, over input lengths covering every
+// combination of vectorized blocks and scalar tail that the implementation
+// can choose.  Decoding must also detect every kind of invalid input wherever
+// it appears, in particular inside a block that would otherwise be decoded by
+// a vectorized loop.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(bsl::size_t inputLength, int maxLineLength);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+// [ 3] bsl::size_t encode(char *, const char *, size_t, int, Alphabet);
+// [ 4] int decode(char *, size_t *, const char *, size_t, Alphabet);
+// [ 5] int decode(char *, size_t *, const char *, size_t, Alphabet);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util Util;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void fillData(bsl::vector<char> *data, bsl::size_t length, unsigned seed)
+    // Load into the specified 'data' the specified 'length' pseudo-random
+    // bytes generated from the specified 'seed'.
+{
+    data->resize(length);
+    for (bsl::size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*data)[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+static
+bsl::string encodeWithEncoder(const bsl::vector<char>& data,
+                              int                      maxLineLength)
+    // Return the encoding of the specified 'data' produced by a
+    // 'bdlde::Base64Encoder' having the specified 'maxLineLength'.
+{
+    bsl::string          result;
+    bdlde::Base64Encoder encoder(maxLineLength);
+
+    encoder.convert(bsl::back_inserter(result), data.begin(), data.end());
+    encoder.endConvert(bsl::back_inserter(result));
+    return result;
+}
+
+static
+bsl::string toUrl(bsl::string text)
+    // Return the specified 'text' with each '+' replaced by '-' and each '/'
+    // replaced by '_'.
+{
+    for (bsl::size_t i = 0; i < text.size(); ++i) {
+        if ('+' == text[i]) {
+            text[i] = '-';
+        }
+        else if ('/' == text[i]) {
+            text[i] = '_';
+        }
+    }
+    return text;
+}
+
+static
+bsl::string encode(const bsl::vector<char>& data,
+                   int                      maxLineLength,
+                   Util::Alphabet           alphabet = Util::e_BASIC)
+    // Return the encoding of the specified 'data' produced by 'Util::encode'
+    // with the specified 'maxLineLength' and the optionally specified
+    // 'alphabet'.  Note that the output is written to an exactly sized
+    // buffer, so that any overrun is visible to memory checkers.
+{
+    const bsl::size_t length = Util::encodedLength(data.size(),
+                                                   maxLineLength);
+
+    bsl::vector<char> buffer(length);
+    const bsl::size_t numChars = Util::encode(buffer.data(),
+                                              data.data(),
+                                              data.size(),
+                                              maxLineLength,
+                                              alphabet);
+    ASSERTV(length, numChars, length == numChars);
+
+    return bsl::string(buffer.begin(), buffer.end());
+}
+
+static
+int decode(bsl::vector<char>  *result,
+           const bsl::string&  text,
+           Util::Alphabet      alphabet = Util::e_BASIC)
+    // Load into the specified 'result' the decoding of the specified 'text'
+    // produced by 'Util::decode' with the optionally specified 'alphabet', and
+    // return its status.  Note that the output is written to a buffer of
+    // exactly 'Util::maxDecodedLength(text.size())' bytes.
+{
+    result->resize(Util::maxDecodedLength(text.size()));
+
+    bsl::size_t numBytes = ~bsl::size_t();
+    const int   rc       = Util::decode(result->data(),
+                                        &numBytes,
+                                        text.data(),
+                                        text.size(),
+                                        alphabet);
+    if (0 == rc) {
+        ASSERTV(numBytes, result->size(), numBytes <= result->size());
+        result->resize(numBytes);
+    }
+    return rc;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding an Attachment
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to embed a binary attachment in a MIME message, which
+// requires lines of at most 76 characters, and to recover it on receipt.
+//
+// First, we create the attachment:
+//..
+    bsl::vector<char> attachment(1000);
+    for (bsl::size_t i = 0; i < attachment.size(); ++i) {
+        attachment[i] = static_cast<char>(i * 7);
+    }
+//..
+// Next, we size a buffer for the encoded text, and encode the attachment:
+//..
+    bsl::string text(bdlde::Base64Util::encodedLength(attachment.size(), 76),
+                     '\0');
+
+    bsl::size_t numChars = bdlde::Base64Util::encode(&text[0],
+                                                     attachment.data(),
+                                                     attachment.size(),
+                                                     76);
+    ASSERT(text.size() == numChars);
+    ASSERT("AAcOFRwjKjE4P0ZNVFtiaXB3foWMk5qhqK+2vcTL0tng5+71/AMKERgfJi00"
+           "O0JJUFdeZWxzeoGI\r\n" == text.substr(0, 78));
+//..
+// Then, on the receiving side, we size a buffer for the decoded data:
+//..
+    bsl::vector<char> received(
+                         bdlde::Base64Util::maxDecodedLength(text.size()));
+//..
+// Finally, we decode the text, which ignores the line breaks, and verify that
+// we received the original attachment:
+//..
+    bsl::size_t numBytes;
+    int         rc = bdlde::Base64Util::decode(received.data(),
+                                               &numBytes,
+                                               text.data(),
+                                               text.size());
+    ASSERT(0 == rc);
+
+    received.resize(numBytes);
+    ASSERT(attachment == received);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DECODING INVALID INPUT
+        //
+        // Concerns:
+        //: 1 A character that is neither whitespace, in the selected
+        //:   alphabet, nor padding is an error wherever it appears, including
+        //:   inside a block that would otherwise be decoded by a vectorized
+        //:   loop.
+        //:
+        //: 2 The characters '+' and '/' are errors with the URL alphabet, and
+        //:   '-' and '_' are errors with the basic alphabet.
+        //:
+        //: 3 Padding is an error unless it completes a quantum of two or three
+        //:   characters whose unused bits are 0, and only whitespace may
+        //:   follow it.
+        //:
+        //: 4 Input ending in the middle of a quantum is an error.
+        //
+        // Plan:
+        //: 1 Encode data long enough to exercise every vectorized loop, then,
+        //:   for each position that does not hold padding, replace the
+        //:   character at that position with each of a set of invalid
+        //:   characters (including '=') and verify that 'decode' fails.
+        //:   (C-1..2)
+        //:
+        //: 2 Using the table-driven technique, verify the status returned for
+        //:   short inputs with correct and incorrect padding, and truncated
+        //:   inputs.  (C-3..4)
+        //
+        // Testing:
+        //   int decode(char *, size_t *, const char *, size_t, Alphabet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODING INVALID INPUT" << endl
+                          << "======================" << endl;
+
+        if (verbose) cout << "\nInvalid characters at every position." << endl;
+        {
+            static const char BASIC_BAD[] = { '!', '\0', '\x80', '\xff', '-',
+                                              '_', '=', '.', '@', '[', '`',
+                                              '{' };
+            static const char URL_BAD[]   = { '!', '\0', '\x80', '\xff', '+',
+                                              '/', '=', '.', '@', '[', '`',
+                                              '{' };
+            const int NUM_BAD = sizeof BASIC_BAD / sizeof *BASIC_BAD;
+
+            bsl::vector<char> data;
+            fillData(&data, 100, 5);
+
+            for (int ai = 0; ai < 2; ++ai) {
+                const Util::Alphabet ALPHABET = ai ? Util::e_URL
+                                                   : Util::e_BASIC;
+                const char *BAD = ai ? URL_BAD : BASIC_BAD;
+
+                const bsl::string TEXT = encode(data, 0, ALPHABET);
+
+                bsl::vector<char> result;
+                ASSERT(0 == decode(&result, TEXT, ALPHABET));
+                ASSERT(data == result);
+
+                for (bsl::size_t pos = 0; pos < TEXT.size(); ++pos) {
+                    if ('=' == TEXT[pos]) {
+                        continue;
+                    }
+                    for (int bi = 0; bi < NUM_BAD; ++bi) {
+                        bsl::string text(TEXT);
+                        text[pos] = BAD[bi];
+
+                        ASSERTV(ai, pos, bi, 0 != decode(&result,
+                                                         text,
+                                                         ALPHABET));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nPadding and truncation." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input_p;   // encoded input
+                int         d_valid;     // 1 if valid, 0 otherwise
+                const char *d_output_p;  // decoded output if valid
+            } DATA[] = {
+                //LINE  INPUT             VALID  OUTPUT
+                //----  ----------------  -----  --------
+                { L_,   "",                   1, ""       },
+                { L_,   " \r\n\t",            1, ""       },
+                { L_,   "QQ==",               1, "A"      },
+                { L_,   "QUI=",               1, "AB"     },
+                { L_,   "QUJD",               1, "ABC"    },
+                { L_,   "Q Q = =",            1, "A"      },
+                { L_,   "QUI=\r\n",           1, "AB"     },
+                { L_,   "QQ==  ",             1, "A"      },
+                { L_,   "QUJDQQ==",           1, "ABCA"   },
+
+                { L_,   "Q",                  0, ""       },
+                { L_,   "QQ",                 0, ""       },
+                { L_,   "QUI",                0, ""       },
+                { L_,   "QUJDQ",              0, ""       },
+                { L_,   "QQ=",                0, ""       },
+                { L_,   "=",                  0, ""       },
+                { L_,   "====",               0, ""       },
+                { L_,   "Q===",               0, ""       },
+                { L_,   "QUJD====",           0, ""       },
+                { L_,   "QUJD=",              0, ""       },
+                { L_,   "QQ===",              0, ""       },
+                { L_,   "QUI==",              0, ""       },
+                { L_,   "QQ=Q",               0, ""       },
+                { L_,   "QUI=Q",              0, ""       },
+                { L_,   "QQ==QQ==",           0, ""       },
+                { L_,   "QUI=QUJD",           0, ""       },
+                { L_,   "QR==",               0, ""       },
+                { L_,   "QUJ=",               0, ""       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const bsl::string INPUT  = DATA[ti].d_input_p;
+                const bool        VALID  = DATA[ti].d_valid;
+                const bsl::string OUTPUT = DATA[ti].d_output_p;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                bsl::vector<char> result;
+                const int         rc = decode(&result, INPUT);
+
+                ASSERTV(LINE, rc, VALID == (0 == rc));
+                if (VALID && 0 == rc) {
+                    ASSERTV(LINE, OUTPUT == bsl::string(result.begin(),
+                                                        result.end()));
+                }
+
+                // The same input after a prefix long enough to be decoded by
+                // the vectorized loops.
+
+                bsl::vector<char> prefix;
+                fillData(&prefix, 96, ti);
+
+                const bsl::string LONG_INPUT = encode(prefix, 0) + INPUT;
+
+                ASSERTV(LINE, VALID == (0 == decode(&result, LONG_INPUT)));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DECODING VALID INPUT
+        //
+        // Concerns:
+        //: 1 'decode' inverts 'encode' for every input length, line length,
+        //:   and alphabet, writing at most 'maxDecodedLength' bytes.
+        //:
+        //: 2 Whitespace is ignored wherever it appears, including inside a
+        //:   block that would otherwise be decoded by a vectorized loop.
+        //:
+        //: 3 'decode' produces the same output as a 'bdlde::Base64Decoder'
+        //:   that treats unrecognized characters as errors.
+        //
+        // Plan:
+        //: 1 For input lengths from 0 to 300 and a set of line lengths,
+        //:   verify that decoding the output of 'encode' with each alphabet
+        //:   yields the original data, and that 'bdlde::Base64Decoder' agrees
+        //:   on the basic alphabet.  (C-1, 3)
+        //:
+        //: 2 Insert each whitespace character at every position of an
+        //:   encoding long enough to exercise every vectorized loop, and
+        //:   verify that decoding yields the original data.  (C-2)
+        //
+        // Testing:
+        //   int decode(char *, size_t *, const char *, size_t, Alphabet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODING VALID INPUT" << endl
+                          << "====================" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 4, 5, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                   / sizeof *LINE_LENGTHS;
+
+        if (verbose) cout << "\nRound trips." << endl;
+
+        for (bsl::size_t length = 0; length <= 300; ++length) {
+            bsl::vector<char> data;
+            fillData(&data, length, static_cast<unsigned>(length));
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                const int MAX_LINE_LENGTH = LINE_LENGTHS[li];
+
+                for (int ai = 0; ai < 2; ++ai) {
+                    const Util::Alphabet ALPHABET = ai ? Util::e_URL
+                                                       : Util::e_BASIC;
+
+                    const bsl::string text = encode(data,
+                                                    MAX_LINE_LENGTH,
+                                                    ALPHABET);
+
+                    bsl::vector<char> result;
+                    ASSERTV(length, li, ai, 0 == decode(&result,
+                                                        text,
+                                                        ALPHABET));
+                    ASSERTV(length, li, ai, data == result);
+
+                    if (Util::e_BASIC == ALPHABET) {
+                        bsl::vector<char>    expected;
+                        bdlde::Base64Decoder decoder(true);
+
+                        ASSERT(0 <= decoder.convert(
+                                                bsl::back_inserter(expected),
+                                                text.begin(),
+                                                text.end()));
+                        ASSERT(0 <= decoder.endConvert(
+                                               bsl::back_inserter(expected)));
+                        ASSERTV(length, li, expected == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nWhitespace at every position." << endl;
+        {
+            static const char SPACES[] = { ' ', '\t', '\n', '\v', '\f', '\r' };
+            const int NUM_SPACES = sizeof SPACES / sizeof *SPACES;
+
+            bsl::vector<char> data;
+            fillData(&data, 100, 3);
+
+            const bsl::string TEXT = encode(data, 0);
+
+            for (bsl::size_t pos = 0; pos <= TEXT.size(); ++pos) {
+                for (int si = 0; si < NUM_SPACES; ++si) {
+                    bsl::string text(TEXT);
+                    text.insert(pos, 1, SPACES[si]);
+
+                    bsl::vector<char> result;
+                    ASSERTV(pos, si, 0 == decode(&result, text));
+                    ASSERTV(pos, si, data == result);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ENCODING
+        //
+        // Concerns:
+        //: 1 'encode' produces the same characters as a 'bdlde::Base64Encoder'
+        //:   having the same maximum line length, for every input length,
+        //:   including those leaving every possible scalar tail after the
+        //:   vectorized loops.
+        //:
+        //: 2 The URL alphabet differs from the basic alphabet only in the
+        //:   characters encoding 62 and 63.
+        //:
+        //: 3 'encode' writes exactly the number of characters it returns.
+        //
+        // Plan:
+        //: 1 For input lengths from 0 to 300, a set of line lengths, and each
+        //:   alphabet, compare the output of 'encode' with that of
+        //:   'bdlde::Base64Encoder' (with '+' and '/' substituted for the URL
+        //:   alphabet).  Write the output into an exactly sized buffer.
+        //:   (C-1..3)
+        //:
+        //: 2 Encode the input bytes encoding every 6-bit value in each
+        //:   position.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::size_t encode(char *, const char *, size_t, int, Alphabet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODING" << endl
+                          << "========" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 64, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                   / sizeof *LINE_LENGTHS;
+
+        if (verbose) cout << "\nComparison with 'Base64Encoder'." << endl;
+
+        for (bsl::size_t length = 0; length <= 300; ++length) {
+            bsl::vector<char> data;
+            fillData(&data, length, static_cast<unsigned>(length) + 1000);
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                const int MAX_LINE_LENGTH = LINE_LENGTHS[li];
+
+                const bsl::string EXPECTED = encodeWithEncoder(
+                                                             data,
+                                                             MAX_LINE_LENGTH);
+
+                ASSERTV(length, MAX_LINE_LENGTH,
+                        EXPECTED == encode(data, MAX_LINE_LENGTH));
+                ASSERTV(length, MAX_LINE_LENGTH,
+                        toUrl(EXPECTED) == encode(data,
+                                                  MAX_LINE_LENGTH,
+                                                  Util::e_URL));
+            }
+        }
+
+        if (verbose) cout << "\nEvery 6-bit value." << endl;
+        {
+            // The 48 bytes '00 10 83 10 51 87 ...' encode the 64 characters of
+            // the alphabet in order.
+
+            static const char BASIC[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                        "abcdefghijklmnopqrstuvwxyz"
+                                        "0123456789+/";
+            static const char URL[]   = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                        "abcdefghijklmnopqrstuvwxyz"
+                                        "0123456789-_";
+
+            bsl::vector<char> data(48);
+            for (int i = 0; i < 16; ++i) {
+                const unsigned int value = ((4 * i) << 18)
+                                         | ((4 * i + 1) << 12)
+                                         | ((4 * i + 2) << 6)
+                                         |  (4 * i + 3);
+                data[3 * i]     = static_cast<char>(value >> 16);
+                data[3 * i + 1] = static_cast<char>(value >> 8);
+                data[3 * i + 2] = static_cast<char>(value);
+            }
+
+            for (bsl::size_t offset = 0; offset < 4; ++offset) {
+                // Rotate so that each value is seen in each lane position.
+
+                bsl::vector<char> rotated(data.begin() + 3 * offset,
+                                          data.end());
+                rotated.insert(rotated.end(),
+                               data.begin(),
+                               data.begin() + 3 * offset);
+
+                const bsl::string text = encode(rotated, 0);
+                const bsl::string url  = encode(rotated, 0, Util::e_URL);
+
+                for (bsl::size_t i = 0; i < 64; ++i) {
+                    const bsl::size_t VALUE = (i + 4 * offset) % 64;
+
+                    ASSERTV(offset, i, BASIC[VALUE] == text[i]);
+                    ASSERTV(offset, i, URL[VALUE]   == url[i]);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LENGTH CALCULATIONS
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the padded length of the encoding, plus
+        //:   two characters per line break when 'maxLineLength' is positive.
+        //:
+        //: 2 'maxDecodedLength' returns at least the decoded length of any
+        //:   input of the given length.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify 'encodedLength' and
+        //:   'maxDecodedLength' for representative lengths.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative line length.  (C-3)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(bsl::size_t, int maxLineLength);
+        //   bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LENGTH CALCULATIONS" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int         d_line;           // source line number
+            bsl::size_t d_inputLength;    // input length
+            int         d_maxLineLength;  // maximum line length
+            bsl::size_t d_expected;       // expected encoded length
+        } DATA[] = {
+            //LINE  INPUT  MAX LINE  EXPECTED
+            //----  -----  --------  --------
+            { L_,       0,        0,        0 },
+            { L_,       1,        0,        4 },
+            { L_,       2,        0,        4 },
+            { L_,       3,        0,        4 },
+            { L_,       4,        0,        8 },
+            { L_,     100,        0,      136 },
+
+            { L_,       0,        4,        0 },
+            { L_,       3,        4,        4 },
+            { L_,       4,        4,       10 },
+            { L_,       6,        4,       10 },
+            { L_,       7,        4,       16 },
+
+            { L_,       1,        1,       10 },
+            { L_,       1,        3,        6 },
+            { L_,      57,       76,       76 },
+            { L_,      58,       76,       82 },
+            { L_,     114,       76,      154 },
+            { L_,     115,       76,      160 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE            = DATA[ti].d_line;
+            const bsl::size_t INPUT_LENGTH    = DATA[ti].d_inputLength;
+            const int         MAX_LINE_LENGTH = DATA[ti].d_maxLineLength;
+            const bsl::size_t EXPECTED        = DATA[ti].d_expected;
+
+            ASSERTV(LINE, EXPECTED, Util::encodedLength(INPUT_LENGTH,
+                                                        MAX_LINE_LENGTH),
+                    EXPECTED == Util::encodedLength(INPUT_LENGTH,
+                                                    MAX_LINE_LENGTH));
+        }
+
+        ASSERT(0 == Util::encodedLength(0));
+        ASSERT(8 == Util::encodedLength(6));
+
+        ASSERT(0 == Util::maxDecodedLength(0));
+        ASSERT(3 == Util::maxDecodedLength(1));
+        ASSERT(3 == Util::maxDecodedLength(4));
+        ASSERT(6 == Util::maxDecodedLength(5));
+        ASSERT(6 == Util::maxDecodedLength(8));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::encodedLength(3, 0));
+            ASSERT_FAIL(Util::encodedLength(3, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode the test vectors of RFC 4648 section 10.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        static const struct {
+            const char *d_data_p;
+            const char *d_text_p;
+        } DATA[] = {
+            { "",       ""         },
+            { "f",      "Zg=="     },
+            { "fo",     "Zm8="     },
+            { "foo",    "Zm9v"     },
+            { "foob",   "Zm9vYg==" },
+            { "fooba",  "Zm9vYmE=" },
+            { "foobar", "Zm9vYmFy" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::string       DATA_STR = DATA[ti].d_data_p;
+            const bsl::vector<char> INPUT(DATA_STR.begin(), DATA_STR.end());
+            const bsl::string       TEXT = DATA[ti].d_text_p;
+
+            if (veryVerbose) { T_ P_(DATA_STR) P(TEXT) }
+
+            ASSERTV(ti, TEXT == encode(INPUT, 0));
+
+            bsl::vector<char> result;
+            ASSERTV(ti, 0 == decode(&result, TEXT));
+            ASSERTV(ti, INPUT == result);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput, in GB/s of binary data, of 'encode' and
+        //:   'decode' and of the 'bdlde::Base64Encoder' and
+        //:   'bdlde::Base64Decoder' they replace.
+        //
+        // Plan:
+        //: 1 For each input length, time the repeated encoding (without line
+        //:   breaks) and decoding of about 256 MB of data using each
+        //:   implementation.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: THROUGHPUT" << endl
+                          << "============================" << endl;
+
+        const int LENGTHS[]   = { 64, 1024, 64 * 1024, 1024 * 1024 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const bsls::Types::Int64 TOTAL = 1 << 28;
+        const double             GB    = static_cast<double>(TOTAL) / 1e9;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int                LENGTH     = LENGTHS[ti];
+            const bsls::Types::Int64 ITERATIONS = TOTAL / LENGTH;
+
+            bsl::vector<char> data;
+            fillData(&data, LENGTH, 7);
+
+            const bsl::string TEXT = encode(data, 0);
+
+            bsl::vector<char> text(TEXT.size());
+            bsl::vector<char> result(Util::maxDecodedLength(TEXT.size()));
+            bsl::size_t       sum = 0;
+            bsls::Stopwatch   timer;
+
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                bdlde::Base64Encoder encoder(0);
+                int                  numOut, numIn;
+
+                encoder.convert(text.data(),
+                                &numOut,
+                                &numIn,
+                                data.data(),
+                                data.data() + data.size());
+                sum += numOut;
+                encoder.endConvert(text.data() + numOut, &numOut);
+                sum += numOut;
+            }
+            timer.stop();
+            const double encoder = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Util::encode(text.data(), data.data(), data.size());
+            }
+            timer.stop();
+            const double utilEncode = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                bdlde::Base64Decoder decoder(true);
+                int                  numOut, numIn;
+
+                decoder.convert(result.data(),
+                                &numOut,
+                                &numIn,
+                                TEXT.data(),
+                                TEXT.data() + TEXT.size());
+                sum += numOut;
+                decoder.endConvert(result.data() + numOut, &numOut);
+                sum += numOut;
+            }
+            timer.stop();
+            const double decoder = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                bsl::size_t numBytes;
+                sum += Util::decode(result.data(),
+                                    &numBytes,
+                                    TEXT.data(),
+                                    TEXT.size());
+                sum += numBytes;
+            }
+            timer.stop();
+            const double utilDecode = timer.accumulatedWallTime();
+
+            cout << "length " << LENGTH
+                 << ": Base64Encoder " << GB / encoder << " GB/s"
+                 << ", encode " << GB / utilEncode << " GB/s"
+                 << ", Base64Decoder " << GB / decoder << " GB/s"
+                 << ", decode " << GB / utilDecode << " GB/s"
+                 << " (" << sum % 10 << ")" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
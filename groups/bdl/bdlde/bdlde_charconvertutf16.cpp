@@ -14,15 +14,29 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
+#include <bsl_cstring.h>    // 'memcpy'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__SSE2__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_CHARCONVERTUTF16_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+#include <emmintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -196,6 +210,39 @@ BSLS_IDENT("$Id$ $CSID$")
 //   recovery is provided.
 //
 ///////////////////////////// END VERBATIM RFC TEXT ///////////////////////////
+//
+///Single-Octet Runs
+///-----------------
+// Text that is mostly ASCII is translated far faster if runs of single-octet
+// code points are copied in blocks rather than one code point at a time.  The
+// functions 'widenSingleOctets' and 'narrowSingleOctets' translate the longest
+// such run (of at most a given length) at the current position of the input,
+// 16 code points at a time with SSE2 on x86-64 (and not at all elsewhere),
+// after which the one-code-point-at-a-time logic resumes.  Since a run of
+// single-octet code points contains no error sequences and yields one
+// code point of output per code unit of input, this changes neither the
+// output nor the counts returned.  The runs are bounded by both the capacity
+// of the output and the length of the input; the latter is known only when
+// the input is not null-terminated (i.e., when the end functor is a
+// 'PtrBasedEnd'), as we must not read past the null terminator, so the
+// null-terminated overloads always take the one-code-point-at-a-time path.
+//
+///Runs in the Basic Multilingual Plane
+///------------------------------------
+// Every code point of the Basic Multilingual Plane other than a surrogate is
+// encoded in a single word of UTF-16 and in 1 to 3 octets of UTF-8.  The
+// functions 'widenBmpSequences' and 'narrowBmpWords' translate runs of such
+// code points, 16 octets or 8 words at a time with SSE2 on x86-64, and
+// 'numBmpSequences' and 'numBmpWords' measure them in the same way for the
+// buffer-length computations.  A block is translated only up to its first
+// surrogate, four-octet sequence, non-minimal or truncated sequence, or
+// stray continuation octet, and the one-code-point-at-a-time logic handles
+// that code point (and any error it contains) as before, so again neither
+// the output nor the counts change.  'narrowBmpWords' returns as soon as a
+// whole block is single-octet code points, leaving them to the faster
+// 'narrowSingleOctets'.  Note that the output of 'narrowBmpWords' is not the
+// same length as its input, so it stops at the first block whose encoding
+// would not fit in the capacity of the output.
 
 namespace {
 
@@ -203,6 +250,7 @@ namespace {
 
 typedef BloombergLP::bdlde::CharConvertUtf16 Util;
 typedef BloombergLP::bslstl::StringRef      StringRef;
+typedef BloombergLP::bdlb::BitUtil          BitUtil;
 
 enum {
     INVALID_INPUT_BIT =
@@ -325,13 +373,22 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t length) const
+        // Return the lesser of the specified 'length' and the number of units
+        // of output that fit in the remaining capacity while leaving room for
+        // a null terminator.  The behavior is undefined unless
+        // '1 <= d_capacity'.
+    {
+        return bsl::min(length, d_capacity - 1);
+    }
 };
 
 struct NoOpCapacity {
@@ -345,12 +402,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t limit(bsl::size_t length) const { return length; }
+        // Return the specified 'length'.
 };
 
 // LOCAL HELPER STRUCT
@@ -404,6 +464,14 @@ struct Utf8 {
         {}
 
         // ACCESSORS
+        bsl::size_t numRemaining(const OctetType *position) const
+            // Return the number of octets from the specified 'position' to
+            // the end of input.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            return d_end - position;
+        }
+
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
             // input, and 'false' otherwise.  The behavior is undefined unless
@@ -472,6 +540,13 @@ struct Utf8 {
         }
 
         // ACCESSORS
+        bsl::size_t numRemaining(const OctetType *) const
+            // Return 0, as the length of the remaining input is not known
+            // without scanning it for the null terminator.
+        {
+            return 0;
+        }
+
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
             // input, and 'false' otherwise.
@@ -739,6 +814,14 @@ struct Utf16 {
             // 'end'.
 
         // ACCESSORS
+        bsl::size_t numRemaining(const UTF16_WORD *utf16Buf) const
+            // Return the number of words from the specified 'utf16Buf' to the
+            // end of input.  The behavior is undefined unless
+            // 'utf16Buf <= d_end'.
+        {
+            return d_end - utf16Buf;
+        }
+
         bool isFinished(const UTF16_WORD *utf16Buf) const
             // Return 'true' if the specified 'utf16Buf' is at the end of
             // input, and 'false' otherwise.
@@ -766,6 +849,13 @@ struct Utf16 {
         }
 
         // ACCESSORS
+        bsl::size_t numRemaining(const UTF16_WORD *) const
+            // Return 0, as the length of the remaining input is not known
+            // without scanning it for the null terminator.
+        {
+            return 0;
+        }
+
         bool isFinished(const UTF16_WORD *u16Buf) const
             // Return 'true' if the specified 'utf16Buf' is at the end of
             // input, and 'false' otherwise.
@@ -906,7 +996,7 @@ struct Swapper {
     // This 'struct' contains static functions that facilitate doing encoding
     // and decoding of swapped UTF-16 data.
 
-    enum { k_SIZE = sizeof(UTF16_WORD) };
+    enum { k_SIZE = sizeof(UTF16_WORD), k_SWAPPED = 1 };
 
     // CLASS METHODS
     static
@@ -962,6 +1052,8 @@ struct NoOpSwapper {
     // byte order -- the UTF-16 data that is being input or output is assumed
     // to be in host byte order.
 
+    enum { k_SIZE = sizeof(UTF16_WORD), k_SWAPPED = 0 };
+
     // CLASS METHODS
     static
     UnicodeCodePoint decodeSingleWord(const UTF16_WORD *u16Buf)
@@ -1012,6 +1104,795 @@ struct NoOpSwapper {
 BSLMF_ASSERT(sizeof(wchar_t)                  >= sizeof(unsigned short));
 BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+
+inline
+__m128i swapBytes32(__m128i words)
+    // Return the specified 'words' with the order of the bytes of each of
+    // their four 32-bit lanes reversed.
+{
+    words = _mm_or_si128(_mm_slli_epi16(words, 8), _mm_srli_epi16(words, 8));
+    return _mm_shufflelo_epi16(_mm_shufflehi_epi16(words, 0xb1), 0xb1);
+}
+
+inline
+__m128i byteVector(unsigned char value)
+    // Return a vector each of whose 16 bytes has the specified 'value'.
+{
+    return _mm_set1_epi8(static_cast<char>(value));
+}
+
+inline
+unsigned int bmpSequencesPrefix(unsigned int *starts, __m128i octets)
+    // Return the length of the longest prefix of the specified 16 'octets'
+    // that consists of whole, minimally encoded UTF-8 sequences of 1 to 3
+    // octets encoding code points of the Basic Multilingual Plane other than
+    // surrogates, and that ends at an octet beginning a sequence (so that it
+    // is shorter than 16), and load into the specified 'starts' a 16-bit mask
+    // in which bit 'i' is set if a sequence of the prefix begins at octet
+    // 'i'.  Note that the prefix is empty, and '*starts' 0, if the first
+    // octet does not begin such a sequence.
+{
+    const __m128i next = _mm_srli_si128(octets, 1);
+
+    const __m128i isContinuation = _mm_cmpeq_epi8(
+                               _mm_and_si128(octets, byteVector(0xc0)),
+                               byteVector(0x80));
+    const __m128i isTwoOctetHeader = _mm_cmpeq_epi8(
+                               _mm_and_si128(octets, byteVector(0xe0)),
+                               byteVector(0xc0));
+    const __m128i isThreeOctetHeader = _mm_cmpeq_epi8(
+                               _mm_and_si128(octets, byteVector(0xf0)),
+                               byteVector(0xe0));
+
+    // Headers of sequences translated one code point at a time: those of
+    // four or more octets, of non-minimal two-octet sequences ('0xc0' and
+    // '0xc1'), of non-minimal three-octet sequences ('0xe0' followed by less
+    // than '0xa0'), and of surrogates ('0xed' followed by '0xa0' or more).
+
+    const __m128i nextHasBit5 = _mm_cmpeq_epi8(
+                               _mm_and_si128(next, byteVector(0x20)),
+                               byteVector(0x20));
+    const __m128i isOther = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(_mm_and_si128(octets, byteVector(0xf0)),
+                                    byteVector(0xf0)),
+                     _mm_cmpeq_epi8(_mm_and_si128(octets, byteVector(0xfe)),
+                                    byteVector(0xc0))),
+        _mm_or_si128(_mm_andnot_si128(nextHasBit5,
+                                      _mm_cmpeq_epi8(octets,
+                                                     byteVector(0xe0))),
+                     _mm_and_si128(nextHasBit5,
+                                   _mm_cmpeq_epi8(octets,
+                                                  byteVector(0xed)))));
+
+    const unsigned int continuations = _mm_movemask_epi8(isContinuation);
+    const unsigned int twos          = _mm_movemask_epi8(isTwoOctetHeader);
+    const unsigned int threes        = _mm_movemask_epi8(isThreeOctetHeader);
+    const unsigned int others        = _mm_movemask_epi8(isOther);
+
+    // Every sequence beginning before the first octet that is, or is not, a
+    // continuation contrary to the headers preceding it is whole, and so is
+    // every sequence beginning at or before the first header of a sequence
+    // not translated here.
+
+    const unsigned int mismatches =
+               (continuations ^ ((twos | threes) << 1 | threes << 2)) & 0xffff;
+
+    unsigned int valid = 0xffff;
+    if (mismatches) {
+        valid &= (1u << BitUtil::numTrailingUnsetBits(
+                                static_cast<bsl::uint32_t>(mismatches))) - 1;
+    }
+    if (others) {
+        valid &= (2u << BitUtil::numTrailingUnsetBits(
+                                    static_cast<bsl::uint32_t>(others))) - 1;
+    }
+
+    const unsigned int headers = ~continuations & valid;
+    if (0 == headers) {
+        *starts = 0;
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned int length = 31 - BitUtil::numLeadingUnsetBits(
+                                         static_cast<bsl::uint32_t>(headers));
+    *starts = headers & ((1u << length) - 1);
+    return length;
+}
+
+inline
+void decodeBmpSequences(bsl::uint16_t *codePoints, __m128i octets)
+    // Store into 'codePoints[i]', for each 'i' in '[0 .. 15]', the code point
+    // encoded by the sequence of 1 to 3 octets beginning at octet 'i' of the
+    // specified 'octets', if it begins a sequence of at most 3 octets that
+    // ends within 'octets', and an unspecified value otherwise.  The behavior
+    // is undefined unless the sequences are minimal and have enough
+    // continuation octets.
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i next1 = _mm_srli_si128(octets, 1);
+    const __m128i next2 = _mm_srli_si128(octets, 2);
+
+    const __m128i isTwoOctetHeader = _mm_cmpeq_epi8(
+                               _mm_and_si128(octets, byteVector(0xe0)),
+                               byteVector(0xc0));
+    const __m128i isThreeOctetHeader = _mm_cmpeq_epi8(
+                               _mm_and_si128(octets, byteVector(0xf0)),
+                               byteVector(0xe0));
+
+    const __m128i low5 = _mm_set1_epi16(0x1f);
+    const __m128i low6 = _mm_set1_epi16(0x3f);
+
+    __m128i *dst = reinterpret_cast<__m128i *>(codePoints);
+    for (int half = 0; half < 2; ++half) {
+        const __m128i octet0 = half ? _mm_unpackhi_epi8(octets, zero)
+                                    : _mm_unpacklo_epi8(octets, zero);
+        const __m128i octet1 = half ? _mm_unpackhi_epi8(next1,  zero)
+                                    : _mm_unpacklo_epi8(next1,  zero);
+        const __m128i octet2 = half ? _mm_unpackhi_epi8(next2,  zero)
+                                    : _mm_unpacklo_epi8(next2,  zero);
+        const __m128i isTwo  = half
+                     ? _mm_unpackhi_epi8(isTwoOctetHeader, isTwoOctetHeader)
+                     : _mm_unpacklo_epi8(isTwoOctetHeader, isTwoOctetHeader);
+        const __m128i isThree = half
+                 ? _mm_unpackhi_epi8(isThreeOctetHeader, isThreeOctetHeader)
+                 : _mm_unpacklo_epi8(isThreeOctetHeader, isThreeOctetHeader);
+
+        const __m128i bits1 = _mm_and_si128(octet1, low6);
+        const __m128i two   = _mm_or_si128(
+                            _mm_slli_epi16(_mm_and_si128(octet0, low5), 6),
+                            bits1);
+        const __m128i three = _mm_or_si128(
+                            _mm_or_si128(_mm_slli_epi16(octet0, 12),
+                                         _mm_slli_epi16(bits1, 6)),
+                            _mm_and_si128(octet2, low6));
+
+        __m128i result = octet0;
+        result = _mm_or_si128(_mm_andnot_si128(isTwo, result),
+                              _mm_and_si128(isTwo, two));
+        result = _mm_or_si128(_mm_andnot_si128(isThree, result),
+                              _mm_and_si128(isThree, three));
+
+        _mm_storeu_si128(dst + half, result);
+    }
+}
+
+inline
+unsigned int bmpWordsPrefix(__m128i words, __m128i isWide)
+    // Return the number of leading words among the 8 16-bit words in the
+    // specified 'words' that are not surrogates and whose lane in the
+    // specified 'isWide' is 0.
+{
+    const __m128i isSurrogate = _mm_cmpeq_epi16(
+                                   _mm_and_si128(words, _mm_set1_epi16(
+                                                 static_cast<short>(0xf800))),
+                                   _mm_set1_epi16(static_cast<short>(0xd800)));
+    const unsigned int mask =
+              _mm_movemask_epi8(_mm_or_si128(isSurrogate, isWide)) | 0x10000;
+    return BitUtil::numTrailingUnsetBits(static_cast<bsl::uint32_t>(mask)) / 2;
+}
+
+inline
+void encodeBmpWords(bsl::uint32_t *sequences,
+                    bsl::uint16_t *lengths,
+                    __m128i        words)
+    // Store into 'sequences[i]' and 'lengths[i]', for each 'i' in
+    // '[0 .. 7]', the UTF-8 encoding, in its low-order bytes in memory order,
+    // and the length of that encoding, of the code point in the 16-bit word
+    // 'i' of the specified 'words'.  The behavior is undefined unless none
+    // of 'words' is a surrogate.
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low6 = _mm_set1_epi16(0x3f);
+    const __m128i cont = _mm_set1_epi16(0x80);
+
+    const __m128i isSingle = _mm_cmpeq_epi16(
+                     _mm_and_si128(words,
+                                   _mm_set1_epi16(static_cast<short>(0xff80))),
+                     zero);
+    const __m128i isShort  = _mm_cmpeq_epi16(
+                     _mm_and_si128(words,
+                                   _mm_set1_epi16(static_cast<short>(0xf800))),
+                     zero);
+        // lanes encoded in at most two octets
+
+    const __m128i last    = _mm_or_si128(_mm_and_si128(words, low6), cont);
+    const __m128i middle  = _mm_or_si128(
+                         _mm_and_si128(_mm_srli_epi16(words, 6), low6), cont);
+    const __m128i header2 = _mm_or_si128(_mm_srli_epi16(words, 6),
+                                         _mm_set1_epi16(0xc0));
+    const __m128i header3 = _mm_or_si128(_mm_srli_epi16(words, 12),
+                                         _mm_set1_epi16(0xe0));
+
+    // Octets 0 and 1 of each encoding go in 'first', and octet 2 in 'third'.
+
+    __m128i first = _mm_or_si128(
+               _mm_and_si128(isShort,
+                             _mm_or_si128(header2, _mm_slli_epi16(last, 8))),
+               _mm_andnot_si128(isShort,
+                                _mm_or_si128(header3,
+                                             _mm_slli_epi16(middle, 8))));
+    first = _mm_or_si128(_mm_and_si128(isSingle, words),
+                         _mm_andnot_si128(isSingle, first));
+    const __m128i third = _mm_andnot_si128(isShort, last);
+
+    __m128i *dst = reinterpret_cast<__m128i *>(sequences);
+    _mm_storeu_si128(dst,     _mm_unpacklo_epi16(first, third));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(first, third));
+
+    // The masks are -1 where set, so adding them subtracts 1.
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lengths),
+                     _mm_add_epi16(_mm_add_epi16(_mm_set1_epi16(3), isSingle),
+                                   isShort));
+}
+
+template <int WORD_SIZE, int SWAPPED>
+struct SingleOctetBlock;
+    // This 'struct' template provides, through its partial specializations
+    // for 2- and 4-byte words, functions that translate blocks of 16
+    // single-octet code points between UTF-8 and UTF-16 stored in
+    // 'WORD_SIZE'-byte words, where the words are in host byte order if
+    // 'SWAPPED' is 0, and in the opposite byte order otherwise.  Each
+    // specialization provides:
+    //..
+    //  static void widen(void *dstBuffer, __m128i octets);
+    //      // Store at the specified 'dstBuffer' the 16 words encoding the 16
+    //      // single-octet code points in the specified 'octets'.
+    //
+    //  static unsigned int multiOctetMask(const void *srcBuffer);
+    //      // Return a 16-bit mask in which bit 'i' is set if word 'i' of the
+    //      // specified 'srcBuffer' is not a single-octet code point.
+    //
+    //  static void narrow(char *dstBuffer, const void *srcBuffer);
+    //      // Store at the specified 'dstBuffer' the 16 octets encoding the
+    //      // code points in the 16 words at the specified 'srcBuffer'.  The
+    //      // behavior is undefined unless '0 == multiOctetMask(srcBuffer)'.
+    //
+    //  static __m128i loadBmpWords(unsigned int *numWords,
+    //                              const void   *srcBuffer);
+    //      // Return, in host byte order in 16-bit lanes, the low-order 16
+    //      // bits of the 8 words at the specified 'srcBuffer', and load into
+    //      // the specified 'numWords' the number of leading words among them
+    //      // that encode code points of the Basic Multilingual Plane, other
+    //      // than surrogates, on their own.
+    //..
+
+template <int SWAPPED>
+struct SingleOctetBlock<2, SWAPPED> {
+    // CLASS METHODS
+    static void widen(void *dstBuffer, __m128i octets)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i      *dst  = static_cast<__m128i *>(dstBuffer);
+
+        _mm_storeu_si128(dst,     SWAPPED ? _mm_unpacklo_epi8(zero, octets)
+                                          : _mm_unpacklo_epi8(octets, zero));
+        _mm_storeu_si128(dst + 1, SWAPPED ? _mm_unpackhi_epi8(zero, octets)
+                                          : _mm_unpackhi_epi8(octets, zero));
+    }
+
+    static unsigned int multiOctetMask(const void *srcBuffer)
+    {
+        const __m128i *src  = static_cast<const __m128i *>(srcBuffer);
+        const __m128i  zero = _mm_setzero_si128();
+        const __m128i  high = _mm_set1_epi16(
+                         static_cast<short>(SWAPPED ? 0x80ff : 0xff80));
+
+        const __m128i  lo   = _mm_cmpeq_epi16(
+                         _mm_and_si128(_mm_loadu_si128(src),     high), zero);
+        const __m128i  hi   = _mm_cmpeq_epi16(
+                         _mm_and_si128(_mm_loadu_si128(src + 1), high), zero);
+
+        return ~_mm_movemask_epi8(_mm_packs_epi16(lo, hi)) & 0xffff;
+    }
+
+    static void narrow(char *dstBuffer, const void *srcBuffer)
+    {
+        const __m128i *src = static_cast<const __m128i *>(srcBuffer);
+        __m128i        lo  = _mm_loadu_si128(src);
+        __m128i        hi  = _mm_loadu_si128(src + 1);
+
+        if (SWAPPED) {
+            lo = _mm_srli_epi16(lo, 8);
+            hi = _mm_srli_epi16(hi, 8);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer),
+                         _mm_packus_epi16(lo, hi));
+    }
+
+    static __m128i loadBmpWords(unsigned int *numWords, const void *srcBuffer)
+    {
+        __m128i words = _mm_loadu_si128(
+                                 static_cast<const __m128i *>(srcBuffer));
+        if (SWAPPED) {
+            words = _mm_or_si128(_mm_slli_epi16(words, 8),
+                                 _mm_srli_epi16(words, 8));
+        }
+
+        *numWords = bmpWordsPrefix(words, _mm_setzero_si128());
+        return words;
+    }
+};
+
+template <int SWAPPED>
+struct SingleOctetBlock<4, SWAPPED> {
+    // CLASS METHODS
+    static void widen(void *dstBuffer, __m128i octets)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i      *dst  = static_cast<__m128i *>(dstBuffer);
+
+        if (SWAPPED) {
+            const __m128i lo = _mm_unpacklo_epi8(zero, octets);
+            const __m128i hi = _mm_unpackhi_epi8(zero, octets);
+
+            _mm_storeu_si128(dst,     _mm_unpacklo_epi16(zero, lo));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(zero, lo));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(zero, hi));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(zero, hi));
+        }
+        else {
+            const __m128i lo = _mm_unpacklo_epi8(octets, zero);
+            const __m128i hi = _mm_unpackhi_epi8(octets, zero);
+
+            _mm_storeu_si128(dst,     _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+
+    static unsigned int multiOctetMask(const void *srcBuffer)
+    {
+        const __m128i *src  = static_cast<const __m128i *>(srcBuffer);
+        const __m128i  zero = _mm_setzero_si128();
+        const __m128i  high = _mm_set1_epi32(
+                    static_cast<int>(SWAPPED ? 0x80ffffffu : 0xffffff80u));
+
+        __m128i isSingle[4];
+        for (int i = 0; i < 4; ++i) {
+            isSingle[i] = _mm_cmpeq_epi32(
+                      _mm_and_si128(_mm_loadu_si128(src + i), high), zero);
+        }
+
+        return ~_mm_movemask_epi8(_mm_packs_epi16(
+                                 _mm_packs_epi32(isSingle[0], isSingle[1]),
+                                 _mm_packs_epi32(isSingle[2], isSingle[3])))
+             & 0xffff;
+    }
+
+    static void narrow(char *dstBuffer, const void *srcBuffer)
+    {
+        const __m128i *src = static_cast<const __m128i *>(srcBuffer);
+
+        __m128i words[4];
+        for (int i = 0; i < 4; ++i) {
+            words[i] = _mm_loadu_si128(src + i);
+            if (SWAPPED) {
+                words[i] = _mm_srli_epi32(words[i], 24);
+            }
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer),
+                         _mm_packus_epi16(_mm_packs_epi32(words[0], words[1]),
+                                          _mm_packs_epi32(words[2],
+                                                          words[3])));
+    }
+
+    static __m128i loadBmpWords(unsigned int *numWords, const void *srcBuffer)
+    {
+        const __m128i *src  = static_cast<const __m128i *>(srcBuffer);
+        const __m128i  zero = _mm_setzero_si128();
+        const __m128i  bias = _mm_set1_epi32(0x8000);
+
+        __m128i lo = _mm_loadu_si128(src);
+        __m128i hi = _mm_loadu_si128(src + 1);
+        if (SWAPPED) {
+            lo = swapBytes32(lo);
+            hi = swapBytes32(hi);
+        }
+
+        // Biasing the words makes those that fit in 16 bits pack without
+        // saturation.
+
+        const __m128i isWide = _mm_packs_epi32(
+                    _mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_srli_epi32(lo, 16),
+                                                    zero),
+                                    zero),
+                    _mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_srli_epi32(hi, 16),
+                                                    zero),
+                                    zero));
+        const __m128i words  = _mm_xor_si128(
+                        _mm_packs_epi32(_mm_sub_epi32(lo, bias),
+                                        _mm_sub_epi32(hi, bias)),
+                        _mm_set1_epi16(static_cast<short>(0x8000)));
+
+        *numWords = bmpWordsPrefix(words, isWide);
+        return words;
+    }
+};
+
+#endif  // BDLDE_CHARCONVERTUTF16_X86_SIMD
+
+bsl::size_t numSingleOctets(const Utf8::OctetType *octets,
+                            bsl::size_t            maxLength)
+    // Return the length of the longest sequence of single-octet code points
+    // beginning at the specified 'octets' that is no longer than the
+    // specified 'maxLength', or 0 if 'maxLength < 16' or if this platform
+    // does not support examining blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    bsl::size_t length = 0;
+    while (maxLength - length >= 16) {
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(octets + length)));
+        if (0 != mask) {
+            return length + BitUtil::numTrailingUnsetBits(
+                                        static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        length += 16;
+    }
+    return length;
+#else
+    (void) octets;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenSingleOctets(UTF16_WORD            *dstBuffer,
+                              const Utf8::OctetType *octets,
+                              bsl::size_t            maxLength)
+    // Write to the specified 'dstBuffer' the UTF-16 encoding, in the byte
+    // order determined by 'SWAPPER', of the longest sequence of single-octet
+    // code points beginning at the specified 'octets' that is no longer than
+    // the specified 'maxLength', and return the length of that sequence.
+    // Write nothing and return 0 if 'maxLength < 16' or if this platform does
+    // not support translating blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    while (maxLength - length >= 16) {
+        const __m128i block = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(octets + length));
+        const int     mask  = _mm_movemask_epi8(block);
+        if (0 != mask) {
+            const bsl::size_t end = length + BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+            for (; length < end; ++length) {
+                dstBuffer[length] = SWAPPER::encodeSingleWord(octets[length]);
+            }
+            return length;                                            // RETURN
+        }
+        Block::widen(dstBuffer + length, block);
+        length += 16;
+    }
+    return length;
+#else
+    (void) dstBuffer;
+    (void) octets;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t numSingleOctetWords(const UTF16_WORD *srcBuffer,
+                                bsl::size_t       maxLength)
+    // Return the length of the longest sequence of words, in the byte order
+    // determined by 'SWAPPER', each encoding a single-octet code point,
+    // beginning at the specified 'srcBuffer' that is no longer than the
+    // specified 'maxLength', or 0 if 'maxLength < 16' or if this platform does
+    // not support examining blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    while (maxLength - length >= 16) {
+        const unsigned int mask = Block::multiOctetMask(srcBuffer + length);
+        if (0 != mask) {
+            return length + BitUtil::numTrailingUnsetBits(
+                                        static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        length += 16;
+    }
+    return length;
+#else
+    (void) srcBuffer;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t narrowSingleOctets(char             *dstBuffer,
+                               const UTF16_WORD *srcBuffer,
+                               bsl::size_t       maxLength)
+    // Write to the specified 'dstBuffer' the UTF-8 encoding of the longest
+    // sequence of words, in the byte order determined by 'SWAPPER', each
+    // encoding a single-octet code point, beginning at the specified
+    // 'srcBuffer' that is no longer than the specified 'maxLength', and return
+    // the length of that sequence.  Write nothing and return 0 if
+    // 'maxLength < 16' or if this platform does not support translating
+    // blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    while (maxLength - length >= 16) {
+        const unsigned int mask = Block::multiOctetMask(srcBuffer + length);
+        if (0 != mask) {
+            const bsl::size_t end = length + BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+            for (; length < end; ++length) {
+                dstBuffer[length] = static_cast<char>(
+                               SWAPPER::decodeSingleWord(srcBuffer + length));
+            }
+            return length;                                            // RETURN
+        }
+        Block::narrow(dstBuffer + length, srcBuffer + length);
+        length += 16;
+    }
+    return length;
+#else
+    (void) dstBuffer;
+    (void) srcBuffer;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+bsl::size_t numBmpSequences(bsl::size_t           *numCodePoints,
+                            const Utf8::OctetType *octets,
+                            bsl::size_t            maxLength)
+    // Return the length of a sequence of UTF-8 sequences of 1 to 3 octets,
+    // validly encoding code points of the Basic Multilingual Plane other than
+    // surrogates, beginning at the specified 'octets' and no longer than the
+    // specified 'maxLength', found by examining blocks of octets, and load
+    // into the specified 'numCodePoints' the number of code points it
+    // encodes.  Return 0, leaving '*numCodePoints' unspecified, if
+    // 'maxLength < 16', if the first octet begins no such sequence, or if
+    // this platform does not support examining blocks of code points.  Note
+    // that the sequence may stop short of the longest such.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    bsl::size_t length = 0;
+    bsl::size_t count  = 0;
+    while (maxLength - length >= 16) {
+        const __m128i      block = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(octets + length));
+        if (0 == _mm_movemask_epi8(block)) {
+            length += 16;
+            count  += 16;
+            continue;
+        }
+
+        unsigned int       starts;
+        const unsigned int numOctets = bmpSequencesPrefix(&starts, block);
+        if (0 == numOctets) {
+            break;
+        }
+        length += numOctets;
+        count  += BitUtil::numBitsSet(static_cast<bsl::uint32_t>(starts));
+    }
+    *numCodePoints = count;
+    return length;
+#else
+    (void) numCodePoints;
+    (void) octets;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenBmpSequences(UTF16_WORD            *dstBuffer,
+                              bsl::size_t           *numWords,
+                              const Utf8::OctetType *octets,
+                              bsl::size_t            maxLength)
+    // Write to the specified 'dstBuffer' the UTF-16 encoding, in the byte
+    // order determined by 'SWAPPER', of a sequence of UTF-8 sequences of 1 to
+    // 3 octets, validly encoding code points of the Basic Multilingual Plane
+    // other than surrogates, beginning at the specified 'octets' and no
+    // longer than the specified 'maxLength', found by examining blocks of
+    // octets; load into the specified 'numWords' the number of words
+    // written, which is at most the length of the sequence, and return that
+    // length.  Write nothing and return 0, leaving '*numWords' unspecified,
+    // if 'maxLength < 16', if the first octet begins no such sequence, or if
+    // this platform does not support translating blocks of code points.  Note
+    // that the sequence may stop short of the longest such.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    bsl::size_t count  = 0;
+    while (maxLength - length >= 16) {
+        const __m128i block = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(octets + length));
+        if (0 == _mm_movemask_epi8(block)) {
+            Block::widen(dstBuffer + count, block);
+            length += 16;
+            count  += 16;
+            continue;
+        }
+
+        unsigned int       starts;
+        const unsigned int numOctets = bmpSequencesPrefix(&starts, block);
+        if (0 == numOctets) {
+            break;
+        }
+
+        bsl::uint16_t codePoints[16];
+        decodeBmpSequences(codePoints, block);
+        do {
+            dstBuffer[count++] = SWAPPER::encodeSingleWord(
+                                   codePoints[BitUtil::numTrailingUnsetBits(
+                                        static_cast<bsl::uint32_t>(starts))]);
+            starts &= starts - 1;
+        } while (starts);
+
+        length += numOctets;
+    }
+    *numWords = count;
+    return length;
+#else
+    (void) dstBuffer;
+    (void) numWords;
+    (void) octets;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t numBmpWords(bsl::size_t      *numOctets,
+                        const UTF16_WORD *srcBuffer,
+                        bsl::size_t       maxLength)
+    // Return the length of a sequence of words, in the byte order determined
+    // by 'SWAPPER', each encoding a code point of the Basic Multilingual
+    // Plane other than a surrogate, beginning at the specified 'srcBuffer'
+    // and no longer than the specified 'maxLength', found by examining blocks
+    // of words, and load into the specified 'numOctets' the length of its
+    // UTF-8 encoding.  Return 0, leaving '*numOctets' unspecified, if
+    // 'maxLength < 8', if the first word is a surrogate, or if this platform
+    // does not support examining blocks of code points.  Note that the
+    // sequence may stop short of the longest such.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    bsl::size_t count  = 0;
+    while (maxLength - length >= 8) {
+        unsigned int  numWords;
+        const __m128i words = Block::loadBmpWords(&numWords,
+                                                  srcBuffer + length);
+        if (0 == numWords) {
+            break;
+        }
+
+        bsl::uint32_t sequences[8];
+        bsl::uint16_t lengths[8];
+        encodeBmpWords(sequences, lengths, words);
+        for (unsigned int i = 0; i < numWords; ++i) {
+            count += lengths[i];
+        }
+        length += numWords;
+        if (numWords < 8) {
+            break;
+        }
+    }
+    *numOctets = count;
+    return length;
+#else
+    (void) numOctets;
+    (void) srcBuffer;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t narrowBmpWords(char             *dstBuffer,
+                           bsl::size_t      *numOctets,
+                           bsl::size_t       maxOctets,
+                           const UTF16_WORD *srcBuffer,
+                           bsl::size_t       maxLength)
+    // Write to the specified 'dstBuffer' the UTF-8 encoding, of length at
+    // most the specified 'maxOctets', of a sequence of words, in the byte
+    // order determined by 'SWAPPER', each encoding a code point of the Basic
+    // Multilingual Plane other than a surrogate, beginning at the specified
+    // 'srcBuffer' and no longer than the specified 'maxLength', found by
+    // examining blocks of words; load into the specified 'numOctets' the
+    // length of the encoding, and return the length of the sequence.  Write
+    // nothing and return 0, leaving '*numOctets' unspecified, if
+    // 'maxLength < 8', if the first word is a surrogate, if its encoding
+    // does not fit, or if this platform does not support translating blocks
+    // of code points.  Note that the sequence may stop short of the longest
+    // such.
+{
+#if defined(BDLDE_CHARCONVERTUTF16_X86_SIMD)
+    typedef SingleOctetBlock<SWAPPER::k_SIZE, SWAPPER::k_SWAPPED> Block;
+
+    bsl::size_t length = 0;
+    bsl::size_t count  = 0;
+    while (maxLength - length >= 8) {
+        unsigned int  numWords;
+        const __m128i words = Block::loadBmpWords(&numWords,
+                                                  srcBuffer + length);
+        if (0 == numWords) {
+            break;
+        }
+
+        bsl::uint32_t sequences[8];
+        bsl::uint16_t lengths[8];
+        encodeBmpWords(sequences, lengths, words);
+
+        bsl::size_t blockLength = 0;
+        for (unsigned int i = 0; i < numWords; ++i) {
+            blockLength += lengths[i];
+        }
+        if (blockLength > maxOctets - count) {
+            break;
+        }
+        if (0 != length && blockLength == numWords) {
+            // Leave a run of single-octet code points to the caller, which
+            // translates them in larger blocks.
+
+            break;
+        }
+
+        // Copy 4 octets for each encoding, each overwriting the excess of the
+        // previous one, except for the last 3, whose excess could extend past
+        // the end.
+
+        char         *dst = dstBuffer + count;
+        unsigned int  i   = 0;
+        for (; i + 3 < numWords; ++i) {
+            bsl::memcpy(dst, &sequences[i], 4);
+            dst += lengths[i];
+        }
+        for (; i < numWords; ++i) {
+            bsl::memcpy(dst, &sequences[i], lengths[i]);
+            dst += lengths[i];
+        }
+
+        length += numWords;
+        count  += blockLength;
+        if (numWords < 8) {
+            break;
+        }
+    }
+    *numOctets = count;
+    return length;
+#else
+    (void) dstBuffer;
+    (void) numOctets;
+    (void) maxOctets;
+    (void) srcBuffer;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
 // These template functions should be in the unnamed namespace, because if they
 // are declared static, you have to fully specialize them every time you call
 // them.
@@ -1040,7 +1921,29 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
     while (!endFunctor.isFinished(octets)) {
+        if (!Utf8::isSingleOctet(*octets)) {
+            bsl::size_t       numCodePoints = 0;
+            const bsl::size_t numOctets     = numBmpSequences(
+                                             &numCodePoints,
+                                             octets,
+                                             endFunctor.numRemaining(octets));
+            if (numOctets) {
+                octets      += numOctets;
+                wordsNeeded += numCodePoints;
+                continue;
+            }
+        }
+
         if      (Utf8::isSingleOctet(     *octets)) {
+            const bsl::size_t numOctets = numSingleOctets(
+                                             octets,
+                                             endFunctor.numRemaining(octets));
+            if (numOctets) {
+                octets      += numOctets;
+                wordsNeeded += numOctets;
+                continue;
+            }
+
             ++octets;
             ++wordsNeeded;
         }
@@ -1176,6 +2079,22 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
+            // Translate the whole run of single-octet code points beginning
+            // here, if possible.
+
+            const bsl::size_t numOctets =
+                  widenSingleOctets<UTF16_WORD, SWAPPER>(
+                         dstBuffer,
+                         octets,
+                         dstCapacity.limit(endFunctor.numRemaining(octets)));
+            if (numOctets) {
+                octets      += numOctets;
+                dstBuffer   += numOctets;
+                dstCapacity -= numOctets;
+                nCodePoints += numOctets;
+                continue;
+            }
+
             *dstBuffer = SWAPPER::encodeSingleWord(*octets);
             ++octets;
             ++dstBuffer;
@@ -1184,6 +2103,24 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
             continue;
         }
 
+        // Translate the whole run of code points of the Basic Multilingual
+        // Plane beginning here, if possible.
+
+        bsl::size_t       numWords  = 0;
+        const bsl::size_t numOctets =
+                  widenBmpSequences<UTF16_WORD, SWAPPER>(
+                         dstBuffer,
+                         &numWords,
+                         octets,
+                         dstCapacity.limit(endFunctor.numRemaining(octets)));
+        if (numOctets) {
+            octets      += numOctets;
+            dstBuffer   += numWords;
+            dstCapacity -= numWords;
+            nCodePoints += numWords;
+            continue;
+        }
+
         // Two, three, or four octets needed.
 
         // The error cases have a lot of repetition.  With the optimizer on,
@@ -1384,10 +2321,31 @@ bsl::size_t utf8BufferLength(const UTF16_WORD *srcBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if      (Utf16::isSingleUtf8(word0)) {
+            const bsl::size_t numWords =
+                      numSingleOctetWords<UTF16_WORD, SWAPPER>(
+                                          srcBuffer,
+                                          endFunctor.numRemaining(srcBuffer));
+            if (numWords) {
+                srcBuffer   += numWords;
+                bytesNeeded += numWords;
+                continue;
+            }
+
             ++srcBuffer;
             ++bytesNeeded;
         }
         else if (Utf16::isSingleWord(word0)) {
+            bsl::size_t       numOctets = 0;
+            const bsl::size_t numWords  = numBmpWords<UTF16_WORD, SWAPPER>(
+                                          &numOctets,
+                                          srcBuffer,
+                                          endFunctor.numRemaining(srcBuffer));
+            if (numWords) {
+                srcBuffer   += numWords;
+                bytesNeeded += numOctets;
+                continue;
+            }
+
             ++srcBuffer;
             bytesNeeded += Utf8::fitsInTwoOctets(word0) ? 2 : 3;
         }
@@ -1474,6 +2432,23 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
+
+            // Translate the whole run of single-octet code points beginning
+            // here, if possible.
+
+            const bsl::size_t numWords =
+                   narrowSingleOctets<UTF16_WORD, SWAPPER>(
+                      dstBuffer,
+                      srcBuffer,
+                      dstCapacity.limit(endFunctor.numRemaining(srcBuffer)));
+            if (numWords) {
+                srcBuffer   += numWords;
+                dstBuffer   += numWords;
+                dstCapacity -= numWords;
+                nCodePoints += numWords;
+                continue;
+            }
+
             *dstBuffer = Utf16::getUtf8Value(word0);
             ++srcBuffer;
             ++dstBuffer;
@@ -1487,6 +2462,27 @@ int localUtf16ToUtf8(char             *dstBuffer,
         // Is it a single-word code point?
 
         if (Utf16::isSingleWord(word0)) {
+            // Translate the whole run of code points of the Basic
+            // Multilingual Plane beginning here, if possible.
+
+            const bsl::size_t numRemaining =
+                                           endFunctor.numRemaining(srcBuffer);
+            bsl::size_t       numOctets    = 0;
+            const bsl::size_t numWords     =
+                            narrowBmpWords<UTF16_WORD, SWAPPER>(
+                                           dstBuffer,
+                                           &numOctets,
+                                           dstCapacity.limit(3 * numRemaining),
+                                           srcBuffer,
+                                           numRemaining);
+            if (numWords) {
+                srcBuffer   += numWords;
+                dstBuffer   += numOctets;
+                dstCapacity -= numOctets;
+                nCodePoints += numWords;
+                continue;
+            }
+
             convBuf = word0;
             ++srcBuffer;
 
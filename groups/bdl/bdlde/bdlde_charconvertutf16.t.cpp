@@ -18,6 +18,7 @@
 
 #include <bslim_testutil.h>
 
+#include <bsls_byteorderutil.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
 #include <bsls_stopwatch.h>
@@ -128,8 +129,10 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [17] USAGE EXAMPLE 2
+// [16] USAGE EXAMPLE 1
+// [15] TESTING RUNS OF BMP CODE POINTS
+// [14] TESTING RUNS OF SINGLE OCTETS
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -143,7 +146,12 @@ using namespace bsl;
 // [ 3] CONVERT UTF-8 TO UTF-16 and UTF-16 to UTF-8 in strings.
 // [ 2] SINGLE-VALUE, LEGAL VALUE TEST
 // [ 1] BREATHING/USAGE TEST
+// [-2] THROUGHPUT OF TRANSLATING NON-ASCII TEXT
 //-----------------------------------------------------------------------------
+// [15] utf8ToUtf16 (all overloads taking 'bslstl::StringRef')
+// [15] utf16ToUtf8 (all overloads taking a length)
+// [14] utf8ToUtf16 (all overloads taking 'bslstl::StringRef')
+// [14] utf16ToUtf8 (all overloads taking a length)
 // [13] utf8ToUtf16 (all container overloads)
 // [13] utf16ToUtf8 (all container overloads)
 // [12] utf8ToUtf16 (single container overload)
@@ -4426,6 +4434,280 @@ bsl::size_t localUtf16Len(const UTF16_WORD *str)
 }
 
 
+// ============================================================================
+//                   TEST FUNCTIONS FOR RUNS OF SINGLE OCTETS
+// ----------------------------------------------------------------------------
+
+static
+int utf16ToUtf8Bounded(char                   *dstBuffer,
+                       bsl::size_t             dstCapacity,
+                       const unsigned short   *srcString,
+                       bsl::size_t             srcLength,
+                       bsl::size_t            *numCodePointsWritten,
+                       bsl::size_t            *numBytesWritten,
+                       char                    errorByte,
+                       bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'utf16ToUtf8' overload taking a pointer and a length for the
+    // specified 'srcString' of the specified 'srcLength' words, passing it the
+    // specified 'dstBuffer', 'dstCapacity', 'numCodePointsWritten',
+    // 'numBytesWritten', 'errorByte', and 'byteOrder', and return its result.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             srcString,
+                             srcLength,
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             errorByte,
+                             byteOrder);
+}
+
+static
+int utf16ToUtf8Bounded(char                   *dstBuffer,
+                       bsl::size_t             dstCapacity,
+                       const wchar_t          *srcString,
+                       bsl::size_t             srcLength,
+                       bsl::size_t            *numCodePointsWritten,
+                       bsl::size_t            *numBytesWritten,
+                       char                    errorByte,
+                       bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'utf16ToUtf8' overload taking a 'bslstl::StringRefWide' for
+    // the specified 'srcString' of the specified 'srcLength' words, passing it
+    // the specified 'dstBuffer', 'dstCapacity', 'numCodePointsWritten',
+    // 'numBytesWritten', 'errorByte', and 'byteOrder', and return its result.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             bslstl::StringRefWide(srcString, srcLength),
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             errorByte,
+                             byteOrder);
+}
+
+static
+int utf16ToUtf8Bounded(bsl::string            *dstString,
+                       const unsigned short   *srcString,
+                       bsl::size_t             srcLength,
+                       bsl::size_t            *numCodePointsWritten,
+                       char                    errorByte,
+                       bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'utf16ToUtf8' overload taking a pointer and a length for the
+    // specified 'srcString' of the specified 'srcLength' words, passing it the
+    // specified 'dstString', 'numCodePointsWritten', 'errorByte', and
+    // 'byteOrder', and return its result.
+{
+    return Util::utf16ToUtf8(dstString,
+                             srcString,
+                             srcLength,
+                             numCodePointsWritten,
+                             errorByte,
+                             byteOrder);
+}
+
+static
+int utf16ToUtf8Bounded(bsl::string            *dstString,
+                       const wchar_t          *srcString,
+                       bsl::size_t             srcLength,
+                       bsl::size_t            *numCodePointsWritten,
+                       char                    errorByte,
+                       bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'utf16ToUtf8' overload taking a 'bslstl::StringRefWide' for
+    // the specified 'srcString' of the specified 'srcLength' words, passing it
+    // the specified 'dstString', 'numCodePointsWritten', 'errorByte', and
+    // 'byteOrder', and return its result.
+{
+    return Util::utf16ToUtf8(dstString,
+                             bslstl::StringRefWide(srcString, srcLength),
+                             numCodePointsWritten,
+                             errorByte,
+                             byteOrder);
+}
+
+template <class WORD_TYPE>
+void testUtf8ToUtf16Run(int                     line,
+                        const bsl::string&      utf8,
+                        WORD_TYPE               errorWord,
+                        bdlde::ByteOrder::Enum  byteOrder)
+    // Translate the specified 'utf8' to UTF-16 stored in 'WORD_TYPE' words,
+    // using the specified 'errorWord' and 'byteOrder', through the overloads
+    // taking the input as a 'bslstl::StringRef' and as a null-terminated
+    // string, with a container destination and with buffers of every
+    // capacity up to that required, and verify that the results are
+    // identical, using the specified 'line' to report failures.  The behavior
+    // is undefined unless 'utf8' contains no null characters.
+{
+    const bsl::size_t LEN  = utf8.length();
+    const WORD_TYPE   FILL = static_cast<WORD_TYPE>(0xa5a5);
+
+    bsl::vector<WORD_TYPE> expected(LEN + 4, FILL, &ta);
+    bsl::vector<WORD_TYPE> actual(  LEN + 4, FILL, &ta);
+
+    for (bsl::size_t capacity = 0; capacity <= LEN + 2; ++capacity) {
+        bsl::fill(expected.begin(), expected.end(), FILL);
+        bsl::fill(actual.begin(),   actual.end(),   FILL);
+
+        bsl::size_t expNumCodePoints = 0, expNumWords = 0;
+        bsl::size_t numCodePoints    = 0, numWords    = 0;
+
+        const int expRc = Util::utf8ToUtf16(expected.data(),
+                                            capacity,
+                                            utf8.c_str(),
+                                            &expNumCodePoints,
+                                            &expNumWords,
+                                            errorWord,
+                                            byteOrder);
+        const int rc    = Util::utf8ToUtf16(actual.data(),
+                                            capacity,
+                                            bslstl::StringRef(utf8),
+                                            &numCodePoints,
+                                            &numWords,
+                                            errorWord,
+                                            byteOrder);
+
+        ASSERTV(line, capacity, expRc,            rc,
+                expRc            == rc);
+        ASSERTV(line, capacity, expNumCodePoints, numCodePoints,
+                expNumCodePoints == numCodePoints);
+        ASSERTV(line, capacity, expNumWords,      numWords,
+                expNumWords      == numWords);
+        ASSERTV(line, capacity, expected == actual);
+    }
+
+    bsl::vector<unsigned short> expVector(&ta), vector(3, 0xa5a5, &ta);
+    bsl::size_t                 expNumCodePoints = 0, numCodePoints = 0;
+
+    const int expRc = Util::utf8ToUtf16(&expVector,
+                                        utf8.c_str(),
+                                        &expNumCodePoints,
+                                        static_cast<unsigned short>(errorWord),
+                                        byteOrder);
+    const int rc    = Util::utf8ToUtf16(&vector,
+                                        bslstl::StringRef(utf8),
+                                        &numCodePoints,
+                                        static_cast<unsigned short>(errorWord),
+                                        byteOrder);
+
+    ASSERTV(line, expRc,            rc,            expRc == rc);
+    ASSERTV(line, expNumCodePoints, numCodePoints,
+            expNumCodePoints == numCodePoints);
+    ASSERTV(line, expVector == vector);
+
+    bsl::wstring expWstring(&ta), wstring(L"xyz", &ta);
+
+    ASSERTV(line, expRc == Util::utf8ToUtf16(&expWstring,
+                                             utf8.c_str(),
+                                             0,
+                                             static_cast<wchar_t>(errorWord),
+                                             byteOrder));
+    ASSERTV(line, expRc == Util::utf8ToUtf16(&wstring,
+                                             bslstl::StringRef(utf8),
+                                             0,
+                                             static_cast<wchar_t>(errorWord),
+                                             byteOrder));
+    ASSERTV(line, expWstring == wstring);
+}
+
+template <class WORD_TYPE>
+void testUtf16ToUtf8Run(int                           line,
+                        const bsl::vector<WORD_TYPE>& utf16,
+                        char                          errorByte,
+                        bdlde::ByteOrder::Enum        byteOrder)
+    // Translate the specified 'utf16', which is null-terminated, to UTF-8
+    // using the specified 'errorByte' and 'byteOrder', through the overloads
+    // taking the input with a length and as a null-terminated string, with a
+    // container destination and with buffers of every capacity up to that
+    // required, and verify that the results are identical, using the
+    // specified 'line' to report failures.  The behavior is undefined unless
+    // 'utf16' contains no null words other than the last.
+{
+    BSLS_ASSERT(!utf16.empty() && 0 == utf16.back());
+
+    const bsl::size_t LEN = utf16.size() - 1;
+    const char        FILL = static_cast<char>(0xa5);
+
+    bsl::vector<char> expected(3 * LEN + 4, FILL, &ta);
+    bsl::vector<char> actual(  3 * LEN + 4, FILL, &ta);
+
+    for (bsl::size_t capacity = 0; capacity <= 3 * LEN + 2; ++capacity) {
+        bsl::fill(expected.begin(), expected.end(), FILL);
+        bsl::fill(actual.begin(),   actual.end(),   FILL);
+
+        bsl::size_t expNumCodePoints = 0, expNumBytes = 0;
+        bsl::size_t numCodePoints    = 0, numBytes    = 0;
+
+        const int expRc = Util::utf16ToUtf8(expected.data(),
+                                            capacity,
+                                            utf16.data(),
+                                            &expNumCodePoints,
+                                            &expNumBytes,
+                                            errorByte,
+                                            byteOrder);
+        const int rc    = utf16ToUtf8Bounded(actual.data(),
+                                             capacity,
+                                             utf16.data(),
+                                             LEN,
+                                             &numCodePoints,
+                                             &numBytes,
+                                             errorByte,
+                                             byteOrder);
+
+        ASSERTV(line, capacity, expRc,            rc,
+                expRc            == rc);
+        ASSERTV(line, capacity, expNumCodePoints, numCodePoints,
+                expNumCodePoints == numCodePoints);
+        ASSERTV(line, capacity, expNumBytes,      numBytes,
+                expNumBytes      == numBytes);
+        ASSERTV(line, capacity, expected == actual);
+    }
+
+    bsl::string expString(&ta), string("xyz", &ta);
+    bsl::size_t expNumCodePoints = 0, numCodePoints = 0;
+
+    const int expRc = Util::utf16ToUtf8(&expString,
+                                        utf16.data(),
+                                        &expNumCodePoints,
+                                        errorByte,
+                                        byteOrder);
+    const int rc    = utf16ToUtf8Bounded(&string,
+                                         utf16.data(),
+                                         LEN,
+                                         &numCodePoints,
+                                         errorByte,
+                                         byteOrder);
+
+    ASSERTV(line, expRc,            rc,            expRc == rc);
+    ASSERTV(line, expNumCodePoints, numCodePoints,
+            expNumCodePoints == numCodePoints);
+    ASSERTV(line, expString, string, expString == string);
+}
+
+void appendBmpCodePoint(bsl::string                 *utf8,
+                        bsl::vector<unsigned short> *utf16,
+                        unsigned int                 codePoint)
+    // Append the UTF-8 encoding of the specified 'codePoint' to the specified
+    // 'utf8', and its UTF-16 encoding, in host byte order, to the specified
+    // 'utf16'.  The behavior is undefined unless 'codePoint' is in the Basic
+    // Multilingual Plane and is not a surrogate.
+{
+    BSLS_ASSERT(codePoint < 0x10000);
+    BSLS_ASSERT(codePoint < 0xd800 || 0xdfff < codePoint);
+
+    if (codePoint < 0x80) {
+        utf8->push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800) {
+        utf8->push_back(static_cast<char>(0xc0 | codePoint >> 6));
+        utf8->push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+    else {
+        utf8->push_back(static_cast<char>(0xe0 | codePoint >> 12));
+        utf8->push_back(static_cast<char>(0x80 | (codePoint >> 6 & 0x3f)));
+        utf8->push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+    utf16->push_back(static_cast<unsigned short>(codePoint));
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -4448,7 +4730,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4574,7 +4856,160 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 14: {
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING RUNS OF BMP CODE POINTS
+        //
+        // Concerns:
+        //: 1 Runs of code points of the Basic Multilingual Plane, other than
+        //:   surrogates, in input whose length is known (which are translated
+        //:   in blocks on some platforms) are translated exactly as they are
+        //:   in null-terminated input (which are always translated one code
+        //:   point at a time), whatever the mix of 1-, 2-, and 3-octet
+        //:   encodings, the length of the run, and the input that follows it.
+        //:
+        //: 2 The translation of a run stops at the first surrogate, 4-octet
+        //:   sequence, or invalid sequence, and at the end of the capacity of
+        //:   the output buffer, leaving the rest of that buffer untouched,
+        //:   and returning the same status and counts as the
+        //:   one-code-point-at-a-time translation.
+        //:
+        //: 3 The above holds for both byte orders, for both word types, with
+        //:   and without an error word or byte, and for both container and
+        //:   buffer destinations.
+        //
+        // Plan:
+        //: 1 Build UTF-8 and UTF-16 inputs consisting of a run of BMP code
+        //:   points, mixing encodings of every length including those at the
+        //:   boundaries between lengths, of every length up to 40, followed
+        //:   by each of a table of sequences that are 4-octet, surrogates,
+        //:   non-minimal, truncated, invalid, or empty, followed by another
+        //:   run of BMP code points of lengths straddling the size of a
+        //:   block.  Translate each input through the overloads taking its
+        //:   length, and through those taking it as a null-terminated string,
+        //:   into buffers of every capacity up to that required, and into
+        //:   containers, and verify that the results are identical, including
+        //:   the contents of the output buffers beyond the bytes or words
+        //:   written.  (C-1..3)
+        //
+        // Testing:
+        //   utf8ToUtf16 (all overloads taking 'bslstl::StringRef')
+        //   utf16ToUtf8 (all overloads taking a length)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING RUNS OF BMP CODE POINTS\n"
+                             "===============================\n";
+
+        static const unsigned int CODE_POINTS[] = {
+            0x4e2d, 'a',    0xe9,   0x800,  0x7f,   0x20ac, 0x7ff,  0xd7ff,
+            0x80,   0xe000, 0x3b1,  0xfffd, 0x1,    0xffff, 0x44f,  0x915
+        };
+        enum { NUM_CODE_POINTS = sizeof  CODE_POINTS / sizeof *CODE_POINTS };
+
+        static const struct {
+            int         d_line;
+            const char *d_utf8;     // UTF-8 sequence following the first run
+            int         d_utf16[3]; // UTF-16 sequence following the first
+                                    // run, in host byte order, terminated by
+                                    // 0
+        } DATA[] = {
+            //LINE  UTF-8                  UTF-16
+            //----  ---------------------  ------------------------
+            { L_,   "",                    { 0                      } },
+            { L_,   "\xf0\x9f\x98\x80",    { 0xd83d, 0xde00, 0      } },
+            { L_,   "\xed\xa0\x80",        { 0xd800, 0              } },
+            { L_,   "\xed\xbf\xbf",        { 0xdfff, 0              } },
+            { L_,   "\xe0\x9f\xbf",        { 0xdbff, 0xdbff, 0      } },
+            { L_,   "\xc1\xbf",            { 0xdc00, 0xd800, 0      } },
+            { L_,   "\xe2\x82",            { 0xde00, 0              } },
+            { L_,   "\xc3",                { 0xd83d, 'a',    0      } },
+            { L_,   "\x80",                { 0xdfff, 0xdfff, 0      } },
+            { L_,   "\xf8\x88\x80",        { 0xdc00, 0              } },
+            { L_,   "\xff",                { 0xd800, 0xe9,   0      } },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        static const bsl::size_t SUFFIX_LENGTHS[] = { 0, 1, 8, 17 };
+        enum { NUM_SUFFIX_LENGTHS = sizeof  SUFFIX_LENGTHS
+                                  / sizeof *SUFFIX_LENGTHS };
+
+        static const bdlde::ByteOrder::Enum BYTE_ORDERS[] = {
+                                      bdlde::ByteOrder::e_HOST, e_BACKWARDS };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *UTF8 = DATA[ti].d_utf8;
+
+            if (veryVerbose) { P_(LINE) P(prHexRange(UTF8, strlen(UTF8))) }
+
+            for (bsl::size_t prefixLen = 0; prefixLen <= 40; ++prefixLen) {
+                for (int si = 0; si < NUM_SUFFIX_LENGTHS; ++si) {
+                    const bsl::size_t suffixLen = SUFFIX_LENGTHS[si];
+
+                    // Vary the mix of encodings, starting the run with each
+                    // of them.
+
+                    bsl::string                 utf8(&ta);
+                    bsl::vector<unsigned short> utf16(&ta);
+                    for (bsl::size_t i = 0; i < prefixLen; ++i) {
+                        appendBmpCodePoint(&utf8,
+                                           &utf16,
+                                           CODE_POINTS[(prefixLen + i * 7)
+                                                       % NUM_CODE_POINTS]);
+                    }
+                    utf8.append(UTF8);
+                    for (int i = 0; DATA[ti].d_utf16[i]; ++i) {
+                        utf16.push_back(static_cast<unsigned short>(
+                                                       DATA[ti].d_utf16[i]));
+                    }
+                    for (bsl::size_t i = 0; i < suffixLen; ++i) {
+                        appendBmpCodePoint(&utf8,
+                                           &utf16,
+                                           CODE_POINTS[(i * 5 + 3)
+                                                       % NUM_CODE_POINTS]);
+                    }
+                    utf16.push_back(0);
+
+                    for (int bi = 0; bi < 2; ++bi) {
+                        const bdlde::ByteOrder::Enum ORDER = BYTE_ORDERS[bi];
+
+                        bsl::vector<unsigned short> utf16s(utf16, &ta);
+                        bsl::vector<wchar_t>        utf16w(&ta);
+                        for (bsl::size_t i = 0; i < utf16.size(); ++i) {
+                            unsigned short word = utf16[i];
+                            wchar_t        wide = utf16[i];
+                            if (e_BACKWARDS == ORDER) {
+                                word = bsls::ByteOrderUtil::swapBytes(word);
+                                wide = 2 == sizeof(wchar_t)
+                                     ? static_cast<wchar_t>(word)
+                                     : static_cast<wchar_t>(
+                                           bsls::ByteOrderUtil::swapBytes(
+                                               static_cast<unsigned int>(
+                                                                  utf16[i])));
+                            }
+                            utf16s[i] = word;
+                            utf16w.push_back(wide);
+                        }
+
+                        testUtf8ToUtf16Run<unsigned short>(LINE,
+                                                           utf8,
+                                                           '?',
+                                                           ORDER);
+                        testUtf8ToUtf16Run<unsigned short>(LINE,
+                                                           utf8,
+                                                           0,
+                                                           ORDER);
+                        testUtf8ToUtf16Run<wchar_t>(LINE, utf8, L'?', ORDER);
+
+                        testUtf16ToUtf8Run(LINE, utf16s, '?', ORDER);
+                        testUtf16ToUtf8Run(LINE, utf16s,   0, ORDER);
+                        testUtf16ToUtf8Run(LINE, utf16w, '?', ORDER);
+                    }
+                }
+            }
+        }
+      } break;
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -4667,6 +5102,147 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING RUNS OF SINGLE OCTETS
+        //
+        // Concerns:
+        //: 1 Runs of single-octet code points in input whose length is known
+        //:   (which are translated in blocks on some platforms) are
+        //:   translated exactly as they are in null-terminated input (which
+        //:   are always translated one code point at a time), whatever the
+        //:   length of the run and of the input that follows it.
+        //:
+        //: 2 The translation of a run stops at the first code point that is
+        //:   not a single octet, and at the end of the capacity of the output
+        //:   buffer, leaving the rest of that buffer untouched, and returning
+        //:   the same status and counts as the one-code-point-at-a-time
+        //:   translation.
+        //:
+        //: 3 The above holds for both byte orders, for both word types, with
+        //:   and without an error word or byte, and for both container and
+        //:   buffer destinations.
+        //
+        // Plan:
+        //: 1 Build UTF-8 and UTF-16 inputs consisting of a run of single-octet
+        //:   code points of every length up to 40, followed by each of a
+        //:   table of sequences that are multi-octet, invalid, or empty,
+        //:   followed by another run of single-octet code points of lengths
+        //:   straddling the size of a block.  Translate each input through
+        //:   the overloads taking its length, and through those taking it as
+        //:   a null-terminated string, into buffers of every capacity up to
+        //:   that required, and into containers, and verify that the results
+        //:   are identical, including the contents of the output buffers
+        //:   beyond the bytes or words written.  (C-1..3)
+        //
+        // Testing:
+        //   utf8ToUtf16 (all overloads taking 'bslstl::StringRef')
+        //   utf16ToUtf8 (all overloads taking a length)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING RUNS OF SINGLE OCTETS\n"
+                             "=============================\n";
+
+        static const struct {
+            int         d_line;
+            const char *d_utf8;     // UTF-8 sequence following the first run
+            int         d_utf16[3]; // UTF-16 sequence following the first
+                                    // run, in host byte order, terminated by
+                                    // 0
+        } DATA[] = {
+            //LINE  UTF-8                  UTF-16
+            //----  ---------------------  ------------------------
+            { L_,   "",                    { 0                      } },
+            { L_,   "\xc3\xa9",            { 0xe9,   0              } },
+            { L_,   "\xdf\xbf",            { 0x7ff,  0              } },
+            { L_,   "\xe2\x82\xac",        { 0x20ac, 0              } },
+            { L_,   "\xef\xbf\xbf",        { 0xffff, 0              } },
+            { L_,   "\xf0\x9f\x98\x80",    { 0xd83d, 0xde00, 0      } },
+            { L_,   "\x80",                { 0xdc00, 0              } },
+            { L_,   "\xc3",                { 0xd800, 0              } },
+            { L_,   "\xe0\x80\xaf",        { 0xdbff, 0xd800, 0      } },
+            { L_,   "\xed\xa0\x80",        { 0xdfff, 0              } },
+            { L_,   "\xff",                { 0x80,   0              } },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        static const bsl::size_t SUFFIX_LENGTHS[] = { 0, 1, 16, 17, 40 };
+        enum { NUM_SUFFIX_LENGTHS = sizeof  SUFFIX_LENGTHS
+                                  / sizeof *SUFFIX_LENGTHS };
+
+        static const bdlde::ByteOrder::Enum BYTE_ORDERS[] = {
+                                      bdlde::ByteOrder::e_HOST, e_BACKWARDS };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *UTF8 = DATA[ti].d_utf8;
+
+            if (veryVerbose) { P_(LINE) P(prHexRange(UTF8, strlen(UTF8))) }
+
+            for (bsl::size_t prefixLen = 0; prefixLen <= 40; ++prefixLen) {
+                for (int si = 0; si < NUM_SUFFIX_LENGTHS; ++si) {
+                    const bsl::size_t suffixLen = SUFFIX_LENGTHS[si];
+
+                    // Vary the single-octet code points, avoiding 0.
+
+                    bsl::string                 utf8(&ta);
+                    bsl::vector<unsigned short> utf16(&ta);
+                    for (bsl::size_t i = 0; i < prefixLen; ++i) {
+                        const char ch = static_cast<char>(1 + i * 37 % 127);
+                        utf8.push_back(ch);
+                        utf16.push_back(ch);
+                    }
+                    utf8.append(UTF8);
+                    for (int i = 0; DATA[ti].d_utf16[i]; ++i) {
+                        utf16.push_back(static_cast<unsigned short>(
+                                                       DATA[ti].d_utf16[i]));
+                    }
+                    for (bsl::size_t i = 0; i < suffixLen; ++i) {
+                        const char ch = static_cast<char>(127 - i * 11 % 127);
+                        utf8.push_back(ch);
+                        utf16.push_back(ch);
+                    }
+                    utf16.push_back(0);
+
+                    for (int bi = 0; bi < 2; ++bi) {
+                        const bdlde::ByteOrder::Enum ORDER = BYTE_ORDERS[bi];
+
+                        bsl::vector<unsigned short> utf16s(utf16, &ta);
+                        bsl::vector<wchar_t>        utf16w(&ta);
+                        for (bsl::size_t i = 0; i < utf16.size(); ++i) {
+                            unsigned short word = utf16[i];
+                            wchar_t        wide = utf16[i];
+                            if (e_BACKWARDS == ORDER) {
+                                word = bsls::ByteOrderUtil::swapBytes(word);
+                                wide = 2 == sizeof(wchar_t)
+                                     ? static_cast<wchar_t>(word)
+                                     : static_cast<wchar_t>(
+                                           bsls::ByteOrderUtil::swapBytes(
+                                               static_cast<unsigned int>(
+                                                                  utf16[i])));
+                            }
+                            utf16s[i] = word;
+                            utf16w.push_back(wide);
+                        }
+
+                        testUtf8ToUtf16Run<unsigned short>(LINE,
+                                                           utf8,
+                                                           '?',
+                                                           ORDER);
+                        testUtf8ToUtf16Run<unsigned short>(LINE,
+                                                           utf8,
+                                                           0,
+                                                           ORDER);
+                        testUtf8ToUtf16Run<wchar_t>(LINE, utf8, L'?', ORDER);
+
+                        testUtf16ToUtf8Run(LINE, utf16s, '?', ORDER);
+                        testUtf16ToUtf8Run(LINE, utf16s,   0, ORDER);
+                        testUtf16ToUtf8Run(LINE, utf16w, '?', ORDER);
+                    }
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // BACKWARDS BYTE ORDER TEST
@@ -8799,6 +9375,121 @@ int main(int argc, char**argv)
       case -1: {
           runPlainTextPerformanceTest();
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT OF TRANSLATING NON-ASCII TEXT
+        //
+        // Concerns:
+        //: 1 Text consisting mostly of 2- and 3-octet code points is
+        //:   translated in both directions faster when its length is known
+        //:   (and it is translated in blocks on some platforms) than when it
+        //:   is null-terminated (and it is translated one code point at a
+        //:   time).
+        //
+        // Plan:
+        //: 1 Build a megabyte each of Russian and of Chinese text, and time
+        //:   their translation to UTF-16 and back, with input of known length
+        //:   and null-terminated input.
+        //
+        // Testing:
+        //   THROUGHPUT OF TRANSLATING NON-ASCII TEXT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "THROUGHPUT OF TRANSLATING NON-ASCII TEXT\n"
+                             "========================================\n";
+
+        bslma::DefaultAllocatorGuard daGuard(&ta);
+
+        typedef bdlde::CharConvertUtf16 Util;
+
+        static const struct {
+            const char *d_name;
+            const char *d_text;
+        } TEXTS[] = {
+            { "Russian",
+              "\xd0\xa1\xd1\x8a\xd0\xb5\xd1\x88\xd1\x8c \xd0\xb6\xd0\xb5 "
+              "\xd0\xb5\xd1\x89\xd1\x91 \xd1\x8d\xd1\x82\xd0\xb8\xd1\x85 "
+              "\xd0\xbc\xd1\x8f\xd0\xb3\xd0\xba\xd0\xb8\xd1\x85 "
+              "\xd1\x84\xd1\x80\xd0\xb0\xd0\xbd\xd1\x86\xd1\x83\xd0\xb7"
+              "\xd1\x81\xd0\xba\xd0\xb8\xd1\x85 \xd0\xb1\xd1\x83\xd0\xbb"
+              "\xd0\xbe\xd0\xba, \xd0\xb4\xd0\xb0 \xd0\xb2\xd1\x8b\xd0\xbf"
+              "\xd0\xb5\xd0\xb9 \xd1\x87\xd0\xb0\xd1\x8e.\n" },
+            { "Chinese",
+              "\xe6\x88\x91\xe8\x83\xbd\xe5\x90\x9e\xe4\xb8\x8b\xe7\x8e"
+              "\xbb\xe7\x92\x83\xe8\x80\x8c\xe4\xb8\x8d\xe4\xbc\xa4\xe8"
+              "\xba\xab\xe4\xbd\x93\xe3\x80\x82\xe5\xa4\xa9\xe5\x9c\xb0"
+              "\xe7\x8e\x84\xe9\xbb\x84\xef\xbc\x8c\xe5\xae\x87\xe5\xae"
+              "\x99\xe6\xb4\xaa\xe8\x8d\x92\xe3\x80\x82\n" },
+        };
+        enum { NUM_TEXTS = sizeof TEXTS / sizeof *TEXTS };
+
+        enum { k_ITERATIONS = 50 };
+
+        for (int ti = 0; ti < NUM_TEXTS; ++ti) {
+            bsl::string utf8;
+            while (utf8.length() < 1024 * 1024) {
+                utf8 += TEXTS[ti].d_text;
+            }
+
+            const bsl::size_t           LEN = utf8.length();
+            bsl::vector<unsigned short> utf16(LEN + 1);
+            bsl::vector<char>           back(LEN + 1);
+            bsl::size_t                 numWords = 0, numBytes = 0;
+
+            cout << TEXTS[ti].d_name << " text:\n";
+
+            for (int withLength = 1; withLength >= 0; --withLength) {
+                bsls::Stopwatch sw;
+
+                sw.start(true);
+                for (int i = 0; i < k_ITERATIONS; ++i) {
+                    ASSERT(0 == (withLength
+                            ? Util::utf8ToUtf16(utf16.data(),
+                                                utf16.size(),
+                                                bslstl::StringRef(utf8),
+                                                0,
+                                                &numWords)
+                            : Util::utf8ToUtf16(utf16.data(),
+                                                utf16.size(),
+                                                utf8.c_str(),
+                                                0,
+                                                &numWords)));
+                }
+                sw.stop();
+                const double toUtf16 = sw.accumulatedUserTime();
+
+                sw.reset();
+                sw.start(true);
+                for (int i = 0; i < k_ITERATIONS; ++i) {
+                    bsl::size_t numCodePoints;
+                    ASSERT(0 == (withLength
+                            ? Util::utf16ToUtf8(back.data(),
+                                                back.size(),
+                                                utf16.data(),
+                                                numWords - 1,
+                                                &numCodePoints,
+                                                &numBytes)
+                            : Util::utf16ToUtf8(back.data(),
+                                                back.size(),
+                                                utf16.data(),
+                                                &numCodePoints,
+                                                &numBytes)));
+                }
+                sw.stop();
+                const double toUtf8 = sw.accumulatedUserTime();
+
+                ASSERT(utf8 == back.data());
+
+                const double megabytes = k_ITERATIONS * LEN / 1.0e6;
+                cout << (withLength ? "  input of known length:\n"
+                                    : "  null-terminated input:\n")
+                     << "\tUTF-8 -> UTF-16: " << megabytes / toUtf16
+                     << " MB/s of UTF-8\n"
+                     << "\tUTF-16 -> UTF-8: " << megabytes / toUtf8
+                     << " MB/s of UTF-8\n";
+            }
+        }
+      } break;
 
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
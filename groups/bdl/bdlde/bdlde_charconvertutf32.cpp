@@ -13,18 +13,32 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bslmf_assert.h>     // 'BSLMF_ASSERT'
 #include <bslmf_issame.h>
 
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
 
 #include <bsl_climits.h>      // 'CHAR_BIT'
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__SSE2__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_CHARCONVERTUTF32_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -111,6 +125,17 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 // UTF-32 encoding is straightforward -- one 'unsigned int' *word* of UTF-32
 // corresponds to one code point of Unicode.  Values must be in the range
 // '[0 .. 0xd7ff]' or in the range '[ 0xe000 .. 0x10ffff ]'.
+//
+// Runs of single-octet code points, which make up most of typical text, are
+// translated 16 code points at a time with SSE2 on x86-64 (see
+// 'widenSingleOctets' and 'narrowSingleOctets'), after which translation
+// resumes one code point at a time.  Such a run contains no error sequences
+// and yields exactly one code point of output per code point of input, so
+// the output and the counts returned are the same either way.  A run is
+// bounded by the capacity of the output and by the end of the input, which is
+// known only if the input is not null-terminated, as we must not read past a
+// null terminator; null-terminated input is always translated one code point
+// at a time.
 
 namespace {
 
@@ -161,6 +186,15 @@ enum Utf8Bits {
     k_FOUR_OCTET_TAG     = k_THREE_OCTET_MASK // compare this to masked bits
 };
 
+enum {
+    // The number of code points examined at a time when skipping or
+    // translating runs of single-octet code points.  A run is attempted only
+    // if at least this many code points remain in the input, which is never
+    // the case, as far as the translators know, for null-terminated input.
+
+    k_BLOCK_LENGTH = 16
+};
+
                            // =====================
                            // local struct Capacity
                            // =====================
@@ -182,7 +216,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +227,12 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t length) const;
+        // Return the lesser of the specified 'length' and the number of units
+        // of output that fit in the remaining capacity while leaving room for
+        // a null terminator.  The behavior is undefined unless
+        // '1 <= d_capacity'.
 };
 
                            // ---------------------
@@ -214,7 +254,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +277,14 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::limit(bsl::size_t length) const
+{
+    BSLS_ASSERT(1 <= d_capacity);
+
+    return bsl::min(length, d_capacity - 1);
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +305,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +314,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t limit(bsl::size_t length) const;
+        // Return the specified 'length'.
 };
 
                          // -------------------------
@@ -285,7 +336,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +355,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::limit(bsl::size_t length) const
+    // Return the specified 'length'.
+{
+    return length;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -312,6 +370,8 @@ struct Swapper {
     // This 'struct' serves as a template argument.  The type is used for
     // reversing the byte order of 'unsigned int' values passed to 'swapBytes'.
 
+    enum { k_SWAPPED = 1 };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' with its byte order reversed;
@@ -334,6 +394,8 @@ struct NoopSwapper {
     // function name and signature must match that of the function in
     // 'Swapper'.
 
+    enum { k_SWAPPED = 0 };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' without modification.
@@ -365,6 +427,10 @@ class Utf8PtrBasedEnd {
         // 'end'.
 
     // ACCESSORS
+    bsl::size_t numRemaining(const OctetType *position) const;
+        // Return the number of octets from the specified 'position' to the end
+        // of input.  The behavior is undefined unless 'position <= d_end'.
+
     bool isFinished(const OctetType *position) const;
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
@@ -394,6 +460,14 @@ Utf8PtrBasedEnd::Utf8PtrBasedEnd(const char *end)
 {}
 
 // ACCESSORS
+inline
+bsl::size_t Utf8PtrBasedEnd::numRemaining(const OctetType *position) const
+{
+    BSLS_ASSERT(position <= d_end);
+
+    return d_end - position;
+}
+
 inline
 bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
 {
@@ -458,6 +532,11 @@ struct Utf8ZeroBasedEnd {
         // Create a 'Utf8ZeroBasedEnd' object.
 
     // ACCESSORS
+    bsl::size_t numRemaining(const OctetType *position) const;
+        // Return 0, as the number of octets from the specified 'position' to
+        // the end of input is not known without scanning for the null
+        // terminator.
+
     bool isFinished(const OctetType *position) const;
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
@@ -487,6 +566,12 @@ Utf8ZeroBasedEnd::Utf8ZeroBasedEnd()
 }
 
 // ACCESSORS
+inline
+bsl::size_t Utf8ZeroBasedEnd::numRemaining(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
 {
@@ -550,6 +635,10 @@ class Utf32PtrBasedEnd {
         // 'end'.
 
     // ACCESSORS
+    bsl::size_t numRemaining(const unsigned int *position) const;
+        // Return the number of words from the specified 'position' to the end
+        // of input.  The behavior is undefined unless 'position <= d_end'.
+
     bool isFinished(const unsigned int *position) const;
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
@@ -567,6 +656,14 @@ Utf32PtrBasedEnd::Utf32PtrBasedEnd(const unsigned int *end)
 {}
 
 // ACCESSORS
+inline
+bsl::size_t Utf32PtrBasedEnd::numRemaining(const unsigned int *position) const
+{
+    BSLS_ASSERT(position <= d_end_p);
+
+    return d_end_p - position;
+}
+
 inline
 bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
 {
@@ -589,6 +686,11 @@ struct Utf32ZeroBasedEnd {
         // Create a 'Utf32ZeroBasedEnd' object.
 
     // ACCESSORS
+    bsl::size_t numRemaining(const unsigned int *position) const;
+        // Return 0, as the number of words from the specified 'position' to
+        // the end of input is not known without scanning for the null
+        // terminator.
+
     bool isFinished(const unsigned int *position) const;
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
@@ -605,6 +707,12 @@ Utf32ZeroBasedEnd::Utf32ZeroBasedEnd()
 }
 
 // ACCESSORS
+inline
+bsl::size_t Utf32ZeroBasedEnd::numRemaining(const unsigned int *) const
+{
+    return 0;
+}
+
 inline
 bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
 {
@@ -841,6 +949,228 @@ const OctetType *skipUtf8CodePoint(const OctetType *input)
     return input + lookaheadContinuations(input, expected);
 }
 
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+
+template <int SWAPPED>
+static inline
+void widenBlock(unsigned int *output, __m128i octets)
+    // Store at the specified 'output' the 16 words of UTF-32 encoding the 16
+    // single-octet code points in the specified 'octets', in host byte order
+    // if 'SWAPPED' is 0, and in the opposite byte order otherwise.
+{
+    const __m128i  zero = _mm_setzero_si128();
+    __m128i       *dst  = reinterpret_cast<__m128i *>(output);
+
+    if (SWAPPED) {
+        const __m128i lo = _mm_unpacklo_epi8(zero, octets);
+        const __m128i hi = _mm_unpackhi_epi8(zero, octets);
+
+        _mm_storeu_si128(dst,     _mm_unpacklo_epi16(zero, lo));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(zero, lo));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(zero, hi));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(zero, hi));
+    }
+    else {
+        const __m128i lo = _mm_unpacklo_epi8(octets, zero);
+        const __m128i hi = _mm_unpackhi_epi8(octets, zero);
+
+        _mm_storeu_si128(dst,     _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+}
+
+template <int SWAPPED>
+static inline
+unsigned int multiOctetMask(const unsigned int *input)
+    // Return a 16-bit mask in which bit 'i' is set if word 'i' of the UTF-32
+    // at the specified 'input', which is in host byte order if 'SWAPPED' is 0
+    // and in the opposite byte order otherwise, is not a single-octet code
+    // point.
+{
+    const __m128i *src  = reinterpret_cast<const __m128i *>(input);
+    const __m128i  zero = _mm_setzero_si128();
+    const __m128i  high = _mm_set1_epi32(
+                    static_cast<int>(SWAPPED ? 0x80ffffffu : 0xffffff80u));
+
+    __m128i isSingle[4];
+    for (int i = 0; i < 4; ++i) {
+        isSingle[i] = _mm_cmpeq_epi32(
+                          _mm_and_si128(_mm_loadu_si128(src + i), high), zero);
+    }
+
+    return ~_mm_movemask_epi8(_mm_packs_epi16(
+                                 _mm_packs_epi32(isSingle[0], isSingle[1]),
+                                 _mm_packs_epi32(isSingle[2], isSingle[3])))
+         & 0xffff;
+}
+
+template <int SWAPPED>
+static inline
+void narrowBlock(OctetType *output, const unsigned int *input)
+    // Store at the specified 'output' the 16 octets encoding the code points
+    // in the 16 words of UTF-32 at the specified 'input', which is in host
+    // byte order if 'SWAPPED' is 0 and in the opposite byte order otherwise.
+    // The behavior is undefined unless '0 == multiOctetMask(input)'.
+{
+    const __m128i *src = reinterpret_cast<const __m128i *>(input);
+
+    __m128i words[4];
+    for (int i = 0; i < 4; ++i) {
+        words[i] = _mm_loadu_si128(src + i);
+        if (SWAPPED) {
+            words[i] = _mm_srli_epi32(words[i], 24);
+        }
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                     _mm_packus_epi16(_mm_packs_epi32(words[0], words[1]),
+                                      _mm_packs_epi32(words[2], words[3])));
+}
+
+#endif  // BDLDE_CHARCONVERTUTF32_X86_SIMD
+
+static
+bsl::size_t numSingleOctets(const OctetType *input, bsl::size_t maxLength)
+    // Return the length of the longest sequence of single-octet code points
+    // beginning at the specified 'input' that is no longer than the specified
+    // 'maxLength', or 0 if 'maxLength < k_BLOCK_LENGTH' or if this platform
+    // does not support examining blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+    bsl::size_t length = 0;
+    while (maxLength - length >= k_BLOCK_LENGTH) {
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(input + length)));
+        if (0 != mask) {
+            return length + BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        length += k_BLOCK_LENGTH;
+    }
+    return length;
+#else
+    (void) input;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class SWAPPER>
+static
+bsl::size_t widenSingleOctets(unsigned int    *output,
+                              const OctetType *input,
+                              bsl::size_t      maxLength)
+    // Write to the specified 'output' the UTF-32 encoding, in the byte order
+    // determined by 'SWAPPER', of the longest sequence of single-octet code
+    // points beginning at the specified 'input' that is no longer than the
+    // specified 'maxLength', and return the length of that sequence.  Write
+    // nothing and return 0 if 'maxLength < k_BLOCK_LENGTH' or if this
+    // platform does not support translating blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+    bsl::size_t length = 0;
+    while (maxLength - length >= k_BLOCK_LENGTH) {
+        const __m128i block = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(input + length));
+        const int     mask  = _mm_movemask_epi8(block);
+        if (0 != mask) {
+            const bsl::size_t end = length +
+                             BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+            for (; length < end; ++length) {
+                output[length] = SWAPPER::swapBytes(input[length]);
+            }
+            return length;                                            // RETURN
+        }
+        widenBlock<SWAPPER::k_SWAPPED>(output + length, block);
+        length += k_BLOCK_LENGTH;
+    }
+    return length;
+#else
+    (void) output;
+    (void) input;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class SWAPPER>
+static
+bsl::size_t numSingleOctetWords(const unsigned int *input,
+                                bsl::size_t         maxLength)
+    // Return the length of the longest sequence of words of UTF-32, in the
+    // byte order determined by 'SWAPPER', each encoding a single-octet code
+    // point, beginning at the specified 'input' that is no longer than the
+    // specified 'maxLength', or 0 if 'maxLength < k_BLOCK_LENGTH' or if this
+    // platform does not support examining blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+    bsl::size_t length = 0;
+    while (maxLength - length >= k_BLOCK_LENGTH) {
+        const unsigned int mask = multiOctetMask<SWAPPER::k_SWAPPED>(
+                                                              input + length);
+        if (0 != mask) {
+            return length + BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        length += k_BLOCK_LENGTH;
+    }
+    return length;
+#else
+    (void) input;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
+template <class SWAPPER>
+static
+bsl::size_t narrowSingleOctets(OctetType          *output,
+                               const unsigned int *input,
+                               bsl::size_t         maxLength)
+    // Write to the specified 'output' the UTF-8 encoding of the longest
+    // sequence of words of UTF-32, in the byte order determined by 'SWAPPER',
+    // each encoding a single-octet code point, beginning at the specified
+    // 'input' that is no longer than the specified 'maxLength', and return the
+    // length of that sequence.  Write nothing and return 0 if
+    // 'maxLength < k_BLOCK_LENGTH' or if this platform does not support
+    // translating blocks of code points.
+{
+#if defined(BDLDE_CHARCONVERTUTF32_X86_SIMD)
+    bsl::size_t length = 0;
+    while (maxLength - length >= k_BLOCK_LENGTH) {
+        const unsigned int mask = multiOctetMask<SWAPPER::k_SWAPPED>(
+                                                              input + length);
+        if (0 != mask) {
+            const bsl::size_t end = length +
+                             BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+            for (; length < end; ++length) {
+                output[length] = static_cast<OctetType>(
+                                           SWAPPER::swapBytes(input[length]));
+            }
+            return length;                                            // RETURN
+        }
+        narrowBlock<SWAPPER::k_SWAPPED>(output + length, input + length);
+        length += k_BLOCK_LENGTH;
+    }
+    return length;
+#else
+    (void) output;
+    (void) input;
+    (void) maxLength;
+
+    return 0;
+#endif
+}
+
 template <class END_FUNCTOR>
 static
 bsl::size_t utf32BufferLengthNeeded(const char  *input,
@@ -868,6 +1198,16 @@ bsl::size_t utf32BufferLengthNeeded(const char  *input,
 
     bsl::size_t ret = 0;
     for (; ! endFunctor.isFinished(octets); ++ret) {
+        const bsl::size_t numRemaining = endFunctor.numRemaining(octets);
+        if (numRemaining >= k_BLOCK_LENGTH && isSingleOctet(*octets)) {
+            const bsl::size_t numOctets = numSingleOctets(octets,
+                                                          numRemaining);
+            if (numOctets) {
+                octets += numOctets;
+                ret    += numOctets - 1;
+                continue;
+            }
+        }
         octets = skipUtf8CodePoint(octets);
     }
 
@@ -900,6 +1240,17 @@ bsl::size_t utf8BufferLengthNeeded(const unsigned int *input,
     bsl::size_t ret = 0;
     for (; !endFunctor.isFinished(input); ++input) {
         uc = SWAPPER::swapBytes(*input);
+        const bsl::size_t numRemaining = endFunctor.numRemaining(input);
+        if (numRemaining >= k_BLOCK_LENGTH && fitsInSingleOctet(uc)) {
+            const bsl::size_t numWords = numSingleOctetWords<SWAPPER>(
+                                                                 input,
+                                                                 numRemaining);
+            if (numWords) {
+                input += numWords - 1;
+                ret   += numWords;
+                continue;
+            }
+        }
         ret += fitsInSingleOctet(uc)
                ? 1
                : fitsInTwoOctets(uc)
@@ -1083,6 +1434,23 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
     }
 
     if      (isSingleOctet(     firstOctet)) {
+        // Translate the whole run of single-octet code points beginning here,
+        // if possible.
+
+        const bsl::size_t numRemaining = d_endFunctor.numRemaining(d_input);
+        if (numRemaining >= k_BLOCK_LENGTH) {
+            const bsl::size_t numOctets = widenSingleOctets<SWAPPER>(
+                                               d_output,
+                                               d_input,
+                                               d_capacity.limit(numRemaining));
+            if (numOctets) {
+                d_input    += numOctets;
+                d_output   += numOctets;
+                d_capacity -= numOctets;
+                return 0;                                             // RETURN
+            }
+        }
+
         len = 1;
         good = true;
         decodedCodePoint = firstOctet;
@@ -1432,6 +1800,28 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     int          ret = 0;
     unsigned int uc;
     while (!endFunctor.isFinished(translator.d_input)) {
+        const bsl::size_t numRemaining =
+                                   endFunctor.numRemaining(translator.d_input);
+        if (numRemaining >= k_BLOCK_LENGTH
+         && fitsInSingleOctet(SWAPPER::swapBytes(*translator.d_input))) {
+            // Translate the whole run of single-octet code points beginning
+            // here, if possible.
+
+            const bsl::size_t maxLength =
+                                     translator.d_capacity.limit(numRemaining);
+            const bsl::size_t numWords  = narrowSingleOctets<SWAPPER>(
+                                                           translator.d_output,
+                                                           translator.d_input,
+                                                           maxLength);
+            if (numWords) {
+                translator.d_input                += numWords;
+                translator.d_output               += numWords;
+                translator.d_capacity             -= numWords;
+                translator.d_numCodePointsWritten += numWords;
+                continue;
+            }
+        }
+
         uc = SWAPPER::swapBytes(*translator.d_input++);
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
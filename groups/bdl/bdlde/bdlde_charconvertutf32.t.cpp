@@ -74,7 +74,9 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
+// [18] TESTING RUNS OF SINGLE OCTETS
+// [17] UTF-32 <- UTF-8 Random table driven sequences with embedded nulls
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
 // [14] UTF-8 <- UTF-32 Random garbage input, random error byte
@@ -91,6 +93,7 @@ using bsl::size_t;
 // [ 3] UTF-32 <- UTF-8 Translation to vector, default error word
 // [ 2] UTF-32 <- UTF-8 Translation to fixed-length buffers, default error word
 // [ 1] Breathing Test
+// [-2] THROUGHPUT OF TRANSLATING MOSTLY-ASCII TEXT
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -2742,7 +2745,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Simple example illustrating how one might use the 'utf8ToUtf32'
@@ -2872,6 +2875,231 @@ int main(int argc, char **argv)
     ASSERT(v32.size()                   == codePointsWritten);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING RUNS OF SINGLE OCTETS
+        //
+        // Concerns:
+        //: 1 Runs of single-octet code points in input whose length is known
+        //:   (which are translated in blocks on some platforms) are
+        //:   translated exactly as they are in null-terminated input (which
+        //:   are always translated one code point at a time), whatever the
+        //:   length of the run and of the input that follows it.
+        //:
+        //: 2 The translation of a run stops at the first code point that is
+        //:   not a single octet, and at the end of the capacity of the output
+        //:   buffer, leaving the rest of that buffer untouched, and returning
+        //:   the same status and counts as the one-code-point-at-a-time
+        //:   translation.
+        //:
+        //: 3 The above holds for both byte orders, with and without an error
+        //:   word or byte, and for both container and buffer destinations.
+        //
+        // Plan:
+        //: 1 Build UTF-8 and UTF-32 inputs consisting of a run of single-octet
+        //:   code points of every length up to 40, followed by each of a
+        //:   table of sequences that are multi-octet, invalid, or empty,
+        //:   followed by another run of single-octet code points of lengths
+        //:   straddling the size of a block.  Translate each input through
+        //:   the overloads taking its length, and through those taking it as
+        //:   a null-terminated string, into buffers of every capacity up to
+        //:   that required, and into containers, and verify that the results
+        //:   are identical, including the contents of the output buffers
+        //:   beyond the bytes or words written.  (C-1..3)
+        //
+        // Testing:
+        //   utf8ToUtf32 (all overloads taking 'bslstl::StringRef')
+        //   utf32ToUtf8 (all overloads taking a length)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING RUNS OF SINGLE OCTETS\n"
+                             "=============================\n";
+
+        static const struct {
+            int          d_line;
+            const char  *d_utf8;      // UTF-8 sequence following the first
+                                      // run
+            unsigned int d_utf32[2];  // UTF-32 sequence following the first
+                                      // run, in host byte order, terminated
+                                      // by 0
+        } DATA[] = {
+            //LINE  UTF-8                  UTF-32
+            //----  ---------------------  --------------
+            { L_,   "",                    { 0          } },
+            { L_,   "\xc3\xa9",            { 0xe9,     0 } },
+            { L_,   "\xdf\xbf",            { 0x7ff,    0 } },
+            { L_,   "\xe2\x82\xac",        { 0x20ac,   0 } },
+            { L_,   "\xef\xbf\xbf",        { 0xffff,   0 } },
+            { L_,   "\xf0\x9f\x98\x80",    { 0x1f600,  0 } },
+            { L_,   "\x80",                { 0xd800,   0 } },
+            { L_,   "\xc3",                { 0xdfff,   0 } },
+            { L_,   "\xe0\x80\xaf",        { 0x110000, 0 } },
+            { L_,   "\xed\xa0\x80",        { 0x80,     0 } },
+            { L_,   "\xff",                { 0x100,    0 } },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        static const bsl::size_t SUFFIX_LENGTHS[] = { 0, 1, 16, 17, 40 };
+        enum { NUM_SUFFIX_LENGTHS = sizeof  SUFFIX_LENGTHS
+                                  / sizeof *SUFFIX_LENGTHS };
+
+        typedef bdlde::CharConvertUtf32 Util;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *UTF8 = DATA[ti].d_utf8;
+
+            if (veryVerbose) { P_(LINE) P(DATA[ti].d_utf32[0]) }
+
+            for (bsl::size_t prefixLen = 0; prefixLen <= 40; ++prefixLen) {
+              for (int si = 0; si < NUM_SUFFIX_LENGTHS; ++si) {
+                const bsl::size_t suffixLen = SUFFIX_LENGTHS[si];
+
+                // Vary the single-octet code points, avoiding 0.
+
+                bsl::string               utf8;
+                bsl::vector<unsigned int> utf32;
+                for (bsl::size_t i = 0; i < prefixLen; ++i) {
+                    const char ch = static_cast<char>(1 + i * 37 % 127);
+                    utf8.push_back(ch);
+                    utf32.push_back(ch);
+                }
+                utf8.append(UTF8);
+                if (DATA[ti].d_utf32[0]) {
+                    utf32.push_back(DATA[ti].d_utf32[0]);
+                }
+                for (bsl::size_t i = 0; i < suffixLen; ++i) {
+                    const char ch = static_cast<char>(127 - i * 11 % 127);
+                    utf8.push_back(ch);
+                    utf32.push_back(ch);
+                }
+                utf32.push_back(0);
+
+                const bsl::size_t LEN8  = utf8.length();
+                const bsl::size_t LEN32 = utf32.size() - 1;
+
+                for (int bi = 0; bi < 2; ++bi) {
+                  const bdlde::ByteOrder::Enum ORDER =
+                                       bi ? oppositeEndian
+                                          : bdlde::ByteOrder::e_HOST;
+
+                  bsl::vector<unsigned int> src32(utf32);
+                  if (bi) {
+                      for (bsl::size_t i = 0; i < src32.size(); ++i) {
+                          src32[i] = sb(src32[i]);
+                      }
+                  }
+
+                  for (int ei = 0; ei < 2; ++ei) {
+                    const unsigned int  ERROR_WORD = ei ? 0 : '?';
+                    const unsigned char ERROR_BYTE = ei ? 0 : '?';
+
+                    // UTF-8 -> UTF-32
+
+                    bsl::vector<unsigned int> exp32(LEN8 + 4, 0xa5a5a5a5);
+                    bsl::vector<unsigned int> act32(LEN8 + 4, 0xa5a5a5a5);
+                    for (bsl::size_t cap = 0; cap <= LEN8 + 2; ++cap) {
+                        bsl::fill(exp32.begin(), exp32.end(), 0xa5a5a5a5);
+                        bsl::fill(act32.begin(), act32.end(), 0xa5a5a5a5);
+
+                        bsl::size_t expNum = 0, num = 0;
+
+                        const int expRc = Util::utf8ToUtf32(exp32.data(),
+                                                            cap,
+                                                            utf8.c_str(),
+                                                            &expNum,
+                                                            ERROR_WORD,
+                                                            ORDER);
+                        const int rc    = Util::utf8ToUtf32(
+                                                       act32.data(),
+                                                       cap,
+                                                       bslstl::StringRef(utf8),
+                                                       &num,
+                                                       ERROR_WORD,
+                                                       ORDER);
+
+                        LOOP4_ASSERT(LINE, cap, expRc,  rc,  expRc  == rc);
+                        LOOP4_ASSERT(LINE, cap, expNum, num, expNum == num);
+                        LOOP2_ASSERT(LINE, cap, exp32 == act32);
+                    }
+                    {
+                        bsl::vector<unsigned int> expV, v(3, 0xa5a5a5a5);
+
+                        const int expRc = Util::utf8ToUtf32(&expV,
+                                                            utf8.c_str(),
+                                                            ERROR_WORD,
+                                                            ORDER);
+                        const int rc    = Util::utf8ToUtf32(
+                                                       &v,
+                                                       bslstl::StringRef(utf8),
+                                                       ERROR_WORD,
+                                                       ORDER);
+
+                        LOOP3_ASSERT(LINE, expRc, rc, expRc == rc);
+                        LOOP_ASSERT(LINE, expV == v);
+                    }
+
+                    // UTF-32 -> UTF-8
+
+                    bsl::vector<char> exp8(3 * LEN32 + 4, '\xa5');
+                    bsl::vector<char> act8(3 * LEN32 + 4, '\xa5');
+                    for (bsl::size_t cap = 0; cap <= 3 * LEN32 + 2; ++cap) {
+                        bsl::fill(exp8.begin(), exp8.end(), '\xa5');
+                        bsl::fill(act8.begin(), act8.end(), '\xa5');
+
+                        bsl::size_t expNum = 0, expBytes = 0;
+                        bsl::size_t num    = 0, bytes    = 0;
+
+                        const int expRc = Util::utf32ToUtf8(exp8.data(),
+                                                            cap,
+                                                            src32.data(),
+                                                            &expNum,
+                                                            &expBytes,
+                                                            ERROR_BYTE,
+                                                            ORDER);
+                        const int rc    = Util::utf32ToUtf8(act8.data(),
+                                                            cap,
+                                                            src32.data(),
+                                                            LEN32,
+                                                            &num,
+                                                            &bytes,
+                                                            ERROR_BYTE,
+                                                            ORDER);
+
+                        LOOP4_ASSERT(LINE, cap, expRc,    rc,
+                                     expRc    == rc);
+                        LOOP4_ASSERT(LINE, cap, expNum,   num,
+                                     expNum   == num);
+                        LOOP4_ASSERT(LINE, cap, expBytes, bytes,
+                                     expBytes == bytes);
+                        LOOP2_ASSERT(LINE, cap, exp8 == act8);
+                    }
+                    {
+                        bsl::string expS, s("xyz");
+                        bsl::size_t expNum = 0, num = 0;
+
+                        const int expRc = Util::utf32ToUtf8(&expS,
+                                                            src32.data(),
+                                                            &expNum,
+                                                            ERROR_BYTE,
+                                                            ORDER);
+                        const int rc    = Util::utf32ToUtf8(&s,
+                                                            src32.data(),
+                                                            LEN32,
+                                                            &num,
+                                                            ERROR_BYTE,
+                                                            ORDER);
+
+                        LOOP3_ASSERT(LINE, expRc,  rc,  expRc  == rc);
+                        LOOP3_ASSERT(LINE, expNum, num, expNum == num);
+                        LOOP3_ASSERT(LINE, expS,   s,   expS   == s);
+                    }
+                  }
+                }
+              }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // RANDOM TABLE DRIVEN UTF-8 -> UTF-32 TEST PLUS EMBEDDED NULLS
@@ -7232,6 +7460,90 @@ int main(int argc, char **argv)
             "valid: " << seq8 << '\n';
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT OF TRANSLATING MOSTLY-ASCII TEXT
+        //
+        // Concerns:
+        //: 1 Text consisting mostly of single-octet code points is translated
+        //:   in both directions at a rate approaching that of a copy.
+        //
+        // Plan:
+        //: 1 Build a megabyte of text that is ASCII except for an occasional
+        //:   multi-octet code point, and time its translation to UTF-32 and
+        //:   back, with input of known length and null-terminated input.
+        //
+        // Testing:
+        //   THROUGHPUT OF TRANSLATING MOSTLY-ASCII TEXT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "THROUGHPUT OF TRANSLATING MOSTLY-ASCII TEXT\n"
+                             "===========================================\n";
+
+        typedef bdlde::CharConvertUtf32 Util;
+
+        bsl::string utf8;
+        while (utf8.length() < 1024 * 1024) {
+            utf8 += "The quick brown fox jumps over the lazy dog, then naps."
+                    "  Na\xc3\xafvet\xc3\xa9 aside, the dog is unimpressed.\n";
+        }
+
+        const bsl::size_t         LEN = utf8.length();
+        bsl::vector<unsigned int> utf32(LEN + 1);
+        bsl::vector<char>         back(LEN + 1);
+        bsl::size_t               numWords = 0, numBytes = 0;
+
+        enum { k_ITERATIONS = 50 };
+
+        for (int withLength = 1; withLength >= 0; --withLength) {
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < k_ITERATIONS; ++i) {
+                ASSERT(0 == (withLength
+                        ? Util::utf8ToUtf32(utf32.data(),
+                                            utf32.size(),
+                                            bslstl::StringRef(utf8),
+                                            &numWords)
+                        : Util::utf8ToUtf32(utf32.data(),
+                                            utf32.size(),
+                                            utf8.c_str(),
+                                            &numWords)));
+            }
+            sw.stop();
+            const double toUtf32 = sw.accumulatedUserTime();
+
+            sw.reset();
+            sw.start(true);
+            for (int i = 0; i < k_ITERATIONS; ++i) {
+                bsl::size_t numCodePoints;
+                ASSERT(0 == (withLength
+                        ? Util::utf32ToUtf8(back.data(),
+                                            back.size(),
+                                            utf32.data(),
+                                            numWords - 1,
+                                            &numCodePoints,
+                                            &numBytes)
+                        : Util::utf32ToUtf8(back.data(),
+                                            back.size(),
+                                            utf32.data(),
+                                            &numCodePoints,
+                                            &numBytes)));
+            }
+            sw.stop();
+            const double toUtf8 = sw.accumulatedUserTime();
+
+            ASSERT(utf8 == back.data());
+
+            const double megabytes = k_ITERATIONS * LEN / 1.0e6;
+            cout << (withLength ? "input of known length:\n"
+                                : "null-terminated input:\n")
+                 << "\tUTF-8 -> UTF-32: " << megabytes / toUtf32
+                 << " MB/s of UTF-8\n"
+                 << "\tUTF-32 -> UTF-8: " << megabytes / toUtf8
+                 << " MB/s of UTF-8\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
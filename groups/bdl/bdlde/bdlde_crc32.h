@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc32: stores and updates a CRC-32 checksum
+//  bdlde::Crc32_Impl: calculates CRC-32 checksum with alternative impl.
 //
 //@SEE_ALSO:
 //
@@ -27,7 +28,18 @@ BSLS_IDENT("$Id: $")
 // does not aid in error correction and is not naively useful in any sort of
 // cryptographic application.  Compared to other methods such as MD5 and
 // SHA-256, it is relatively easy to find alternate texts with identical
-// checksum.
+// checksum.  This component additionally defines the struct
+// 'bdlde::Crc32_Impl' to expose the alternative implementations used by
+// 'bdlde::Crc32::update', which should not be used other than to test and
+// benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86-64 platforms, when built with a compatible compiler, 'update' uses
+// carry-less multiplication (the PCLMULQDQ instruction) to process large
+// inputs if a runtime check finds that the running processor supports it, and
+// a portable table-driven ("slicing-by-8") implementation otherwise.  Both
+// produce exactly the same checksums.
 //
 ///Usage
 ///-----
@@ -243,6 +255,40 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Crc32& checksum);
     // Write to the specified output 'stream' the specified 'checksum' value
     // and return a reference to the modifiable 'stream'.
 
+                             // =================
+                             // struct Crc32_Impl
+                             // =================
+
+struct Crc32_Impl {
+    // This 'struct' provides a namespace for the alternative implementations
+    // of the CRC-32 calculation that underlie 'Crc32::update'.
+
+    // CLASS METHODS
+    static unsigned int calculateSoftware(const void   *data,
+                                          bsl::size_t   length,
+                                          unsigned int  crc = 0);
+        // Return the CRC-32 checksum of the specified 'data' having the
+        // specified 'length', continuing from the optionally specified 'crc'
+        // checksum of preceding data, using the portable table-driven
+        // implementation.  The behavior is undefined unless 'data' refers to
+        // at least 'length' bytes; 'data' may be 0 if 'length' is 0.
+
+    static unsigned int calculateHardware(const void   *data,
+                                          bsl::size_t   length,
+                                          unsigned int  crc = 0);
+        // Return the CRC-32 checksum of the specified 'data' having the
+        // specified 'length', continuing from the optionally specified 'crc'
+        // checksum of preceding data, using carry-less multiplication if
+        // 'isHardwareAccelerated' is 'true', and the portable implementation
+        // otherwise.  The behavior is undefined unless 'data' refers to at
+        // least 'length' bytes; 'data' may be 0 if 'length' is 0.
+
+    static bool isHardwareAccelerated();
+        // Return 'true' if this platform supports, and 'Crc32::update' uses,
+        // the carry-less multiplication implementation, and 'false'
+        // otherwise.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -22,6 +22,8 @@
 #include <bsl_sstream.h>
 #include <bsl_vector.h>
 
+#include <bsls_types.h>
+
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
 
@@ -98,10 +100,14 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] unsigned int Crc32_Impl::calculateSoftware(data, length, crc);
+// [15] unsigned int Crc32_Impl::calculateHardware(data, length, crc);
+// [15] bool Crc32_Impl::isHardwareAccelerated();
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: THROUGHPUT
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -516,7 +522,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -547,6 +553,92 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ALTERNATIVE IMPLEMENTATIONS
+        //   This will test 'bdlde::Crc32_Impl', whose functions are the
+        //   implementations selected by 'update'.
+        //
+        // Concerns:
+        //   The table-driven ("slicing-by-8") and carry-less multiplication
+        //   implementations must produce exactly the checksum of the RFC 1952
+        //   byte-at-a-time algorithm for every length (in particular around
+        //   the 8-, 16-, and 64-byte boundaries at which the implementations
+        //   change strategy), every alignment of the data, and any starting
+        //   checksum, and 'update' must produce the same checksum however the
+        //   data is split between calls.
+        //
+        // Plan:
+        //   Fill a buffer with pseudo-random bytes.  For every length up to
+        //   300, and a few longer lengths, at each of 16 alignments, compare
+        //   the results of 'calculateSoftware' and 'calculateHardware', from
+        //   both a zero and a non-zero starting checksum, and of 'update'
+        //   called on the whole data and on the data split in two, against
+        //   the 'update_crc' oracle.
+        //
+        // Testing:
+        //   unsigned int Crc32_Impl::calculateSoftware(data, length, crc);
+        //   unsigned int Crc32_Impl::calculateHardware(data, length, crc);
+        //   bool Crc32_Impl::isHardwareAccelerated();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ALTERNATIVE IMPLEMENTATIONS"
+                          << "\n===================================" << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+
+        if (verbose) {
+            P(Impl::isHardwareAccelerated());
+        }
+
+        const int LONG_LENGTHS[] = { 511, 512, 513, 1000, 1023, 1024, 1025,
+                                     4095, 4096, 4097 };
+        const int NUM_LONG_LENGTHS = sizeof LONG_LENGTHS
+                                                       / sizeof *LONG_LENGTHS;
+        const int MAX_SHORT_LENGTH = 300;
+        const int MAX_LENGTH       = 4097;
+
+        bsl::vector<char> buffer(MAX_LENGTH + 16);
+        unsigned int      seed = 12345;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        const unsigned int CRCS[] = { 0, 0xdeadbeef };
+        const int          NUM_CRCS = sizeof CRCS / sizeof *CRCS;
+
+        for (int ti = 0; ti <= MAX_SHORT_LENGTH + NUM_LONG_LENGTHS; ++ti) {
+            const int LENGTH = ti <= MAX_SHORT_LENGTH
+                             ? ti
+                             : LONG_LENGTHS[ti - MAX_SHORT_LENGTH - 1];
+
+            for (int align = 0; align < 16; ++align) {
+                const char *DATA  = buffer.data() + align;
+                const int   SPLIT = LENGTH * align / 16;
+
+                for (int ci = 0; ci < NUM_CRCS; ++ci) {
+                    const unsigned int CRC = CRCS[ci];
+                    const unsigned int EXP = update_crc(CRC, DATA, LENGTH);
+
+                    LOOP3_ASSERT(LENGTH, align, CRC,
+                          EXP == Impl::calculateSoftware(DATA, LENGTH, CRC));
+                    LOOP3_ASSERT(LENGTH, align, CRC,
+                          EXP == Impl::calculateHardware(DATA, LENGTH, CRC));
+                }
+
+                const unsigned int EXP = update_crc(0, DATA, LENGTH);
+
+                Obj mX(DATA, LENGTH);  const Obj& X = mX;
+                LOOP2_ASSERT(LENGTH, align, EXP == X.checksum());
+
+                Obj mY;  const Obj& Y = mY;
+                mY.update(DATA, SPLIT);
+                mY.update(DATA + SPLIT, LENGTH - SPLIT);
+                LOOP3_ASSERT(LENGTH, align, SPLIT, EXP == Y.checksum());
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -554,10 +646,11 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //   The CRC algorithm depends on a static constant array of unsigned
-        //   integers defined in bdlde_crc32.cpp as 'CRC_TABLE[256]'.  This
-        //   array was generated from the initialization step found at the end
-        //   of RFC 1952.  We want to ensure that the values in the table are
-        //   correct.
+        //   integers defined in bdlde_crc32.cpp as 'CRC_TABLE[8][256]'.  The
+        //   first row of this array was generated from the initialization
+        //   step found at the end of RFC 1952 (the other rows are derived
+        //   from it, and are covered by test case 15).  We want to ensure
+        //   that the values in the table are correct.
         //
         // Plan:
         //   We cannot access the array directly from this test driver because
@@ -580,7 +673,7 @@ int main(int argc, char *argv[])
         //   'update' and 'checksum' methods are correct.
         //
         // Testing:
-        //   static const unsigned int CRC_TABLE[256]; (bdlde_crc32.cpp)
+        //   static const unsigned int CRC_TABLE[8][256]; (bdlde_crc32.cpp)
         // --------------------------------------------------------------------
 
         if (verbose) cout << "\nTesting CRC_TABLE"
@@ -2680,6 +2773,84 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //   We want to report the throughput, in GB/s, of each implementation
+        //   for inputs ranging from a cache line to a megabyte.
+        //
+        // Plan:
+        //   For each input length, time repeated checksums of the same
+        //   buffer (about 1 GB in total; a tenth of that for the
+        //   byte-at-a-time 'update_crc' oracle) using each implementation.
+        //
+        // Testing:
+        //   void update(const void *data, int length);  // performance
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: THROUGHPUT"
+                          << "\n============================" << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+
+        cout << "isHardwareAccelerated: " << Impl::isHardwareAccelerated()
+             << endl;
+
+        const int LENGTHS[]   = { 64, 1024, 64 * 1024, 1024 * 1024 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        bsl::vector<char> buffer(LENGTHS[NUM_LENGTHS - 1]);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 131 + (i >> 9));
+        }
+        const char *DATA = buffer.data();
+
+        const bsls::Types::Int64 TOTAL = 1 << 30;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int                LENGTH     = LENGTHS[ti];
+            const bsls::Types::Int64 ITERATIONS = TOTAL / LENGTH;
+
+            unsigned int    sum = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS / 10; ++i) {
+                sum += update_crc(0, DATA, LENGTH);
+            }
+            timer.stop();
+            const double oracle = timer.accumulatedWallTime() * 10;
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Impl::calculateSoftware(DATA, LENGTH);
+            }
+            timer.stop();
+            const double software = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Impl::calculateHardware(DATA, LENGTH);
+            }
+            timer.stop();
+            const double hardware = timer.accumulatedWallTime();
+
+            const double GB = static_cast<double>(TOTAL) / 1e9;
+
+            cout << "length " << LENGTH
+                 << ": byte-at-a-time " << GB / oracle << " GB/s"
+                 << ", software " << GB / software << " GB/s"
+                 << ", hardware " << GB / hardware << " GB/s";
+            if (veryVerbose) {
+                cout << " (" << sum << ")";
+            }
+            cout << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc64: stores and updates a CRC-64 checksum
+//  bdlde::Crc64_Impl: calculates CRC-64 checksum with alternative impl.
 //
 //@SEE_ALSO:
 //
@@ -19,7 +20,15 @@ BSLS_IDENT("$Id: $")
 // aid in error correction and is not naively useful in any sort of
 // cryptographic application.  Compared to other methods such as MD5 and
 // SHA-256, it is relatively easy to find alternate texts with identical
-// checksum.
+// checksum.  The struct 'bdlde::Crc64_Impl' exposes the implementations
+// underlying 'bdlde::Crc64::update' for testing and benchmarking only.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// As for 'bdlde::Crc32', 'update' folds large inputs using carry-less
+// multiplication (PCLMULQDQ) on x86-64 processors found, at runtime, to
+// support it, and otherwise falls back on a table-driven "slicing-by-8"
+// implementation that yields identical checksums on every platform.
 //
 ///Usage
 ///-----
@@ -220,6 +229,42 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Crc64& checksum);
     // Write to the specified output 'stream' the specified 'checksum' value
     // and return a reference to the modifiable 'stream'.
 
+                             // =================
+                             // struct Crc64_Impl
+                             // =================
+
+struct Crc64_Impl {
+    // This 'struct' provides a namespace for the alternative implementations
+    // of the CRC-64 calculation that underlie 'Crc64::update'.
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 calculateSoftware(
+                                           const void          *data,
+                                           bsl::size_t          length,
+                                           bsls::Types::Uint64  crc = 0);
+        // Return the CRC-64 checksum of the specified 'data' having the
+        // specified 'length', continuing from the optionally specified 'crc'
+        // checksum of preceding data, using the portable table-driven
+        // implementation.  The behavior is undefined unless 'data' refers to
+        // at least 'length' bytes; 'data' may be 0 if 'length' is 0.
+
+    static bsls::Types::Uint64 calculateHardware(
+                                           const void          *data,
+                                           bsl::size_t          length,
+                                           bsls::Types::Uint64  crc = 0);
+        // Return the CRC-64 checksum of the specified 'data' having the
+        // specified 'length', continuing from the optionally specified 'crc'
+        // checksum of preceding data, using carry-less multiplication if
+        // 'isHardwareAccelerated' is 'true', and the portable implementation
+        // otherwise.  The behavior is undefined unless 'data' refers to at
+        // least 'length' bytes; 'data' may be 0 if 'length' is 0.
+
+    static bool isHardwareAccelerated();
+        // Return 'true' if this platform supports, and 'Crc64::update' uses,
+        // the carry-less multiplication implementation, and 'false'
+        // otherwise.
+};
+
 // ============================================================================
 //                        INLINE DEFINITIONS
 // ============================================================================
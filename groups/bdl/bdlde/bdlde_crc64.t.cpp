@@ -89,10 +89,14 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] Uint64 Crc64_Impl::calculateSoftware(data, length, crc);
+// [15] Uint64 Crc64_Impl::calculateHardware(data, length, crc);
+// [15] bool Crc64_Impl::isHardwareAccelerated();
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: THROUGHPUT
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -484,7 +488,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -515,6 +519,99 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ALTERNATIVE IMPLEMENTATIONS
+        //   This will test 'bdlde::Crc64_Impl', whose functions are the
+        //   implementations selected by 'update'.
+        //
+        // Concerns:
+        //: 1 The slicing-by-8 and carry-less multiplication implementations
+        //:   produce the same checksum as the byte-at-a-time algorithm.
+        //:
+        //: 2 This holds for every length, notably those around the 8-, 16-,
+        //:   and 64-byte boundaries at which the implementations change
+        //:   strategy, and for every alignment of the data.
+        //:
+        //: 3 Both implementations correctly continue from a non-zero
+        //:   checksum, and 'update' is insensitive to how the data is split
+        //:   between calls.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random bytes.  For every length up to
+        //:   300, and a few longer lengths, at each of 16 alignments, compare
+        //:   the results of 'calculateSoftware' and 'calculateHardware' with
+        //:   those of the 'update_crc' oracle, starting from both a zero and a
+        //:   non-zero checksum.  (C-1..3)
+        //:
+        //: 2 For the same data, compare the checksum of an object updated
+        //:   with all the data at once, and of one updated in two pieces,
+        //:   with that of the oracle.  (C-3)
+        //
+        // Testing:
+        //   Uint64 Crc64_Impl::calculateSoftware(data, length, crc);
+        //   Uint64 Crc64_Impl::calculateHardware(data, length, crc);
+        //   bool Crc64_Impl::isHardwareAccelerated();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING ALTERNATIVE IMPLEMENTATIONS"
+                             "\n" "===================================" "\n";
+
+        typedef bdlde::Crc64_Impl Impl;
+
+        if (verbose) {
+            P(Impl::isHardwareAccelerated());
+        }
+
+        const int LONG_LENGTHS[] = { 511, 512, 513, 1000, 1023, 1024, 1025,
+                                     4095, 4096, 4097 };
+        const int NUM_LONG_LENGTHS = sizeof LONG_LENGTHS
+                                                       / sizeof *LONG_LENGTHS;
+        const int MAX_SHORT_LENGTH = 300;
+        const int MAX_LENGTH       = 4097;
+
+        bsl::vector<char> buffer(MAX_LENGTH + 16);
+        unsigned int      seed = 54321;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        const bsls::Types::Uint64 CRCS[] = { 0, 0x0123456789abcdefULL };
+        const int                 NUM_CRCS = sizeof CRCS / sizeof *CRCS;
+
+        for (int ti = 0; ti <= MAX_SHORT_LENGTH + NUM_LONG_LENGTHS; ++ti) {
+            const int LENGTH = ti <= MAX_SHORT_LENGTH
+                             ? ti
+                             : LONG_LENGTHS[ti - MAX_SHORT_LENGTH - 1];
+
+            for (int align = 0; align < 16; ++align) {
+                const char *DATA  = buffer.data() + align;
+                const int   SPLIT = LENGTH * align / 16;
+
+                for (int ci = 0; ci < NUM_CRCS; ++ci) {
+                    const bsls::Types::Uint64 CRC = CRCS[ci];
+                    const bsls::Types::Uint64 EXP =
+                                                update_crc(CRC, DATA, LENGTH);
+
+                    ASSERTV(LENGTH, align, CRC,
+                           EXP == Impl::calculateSoftware(DATA, LENGTH, CRC));
+                    ASSERTV(LENGTH, align, CRC,
+                           EXP == Impl::calculateHardware(DATA, LENGTH, CRC));
+                }
+
+                const bsls::Types::Uint64 EXP = update_crc(0, DATA, LENGTH);
+
+                Obj mX(DATA, LENGTH);  const Obj& X = mX;
+                ASSERTV(LENGTH, align, EXP == X.checksum());
+
+                Obj mY;  const Obj& Y = mY;
+                mY.update(DATA, SPLIT);
+                mY.update(DATA + SPLIT, LENGTH - SPLIT);
+                ASSERTV(LENGTH, align, SPLIT, EXP == Y.checksum());
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -522,8 +619,9 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 The CRC algorithm depends on a static constant array of values
-        //:   defined in bdlde_crc64.cpp as 'CRC_TABLE[256]'.  We want to
-        //:   ensure that the values in the table are correct.
+        //:   defined in bdlde_crc64.cpp as 'CRC_TABLE[8][256]'.  We want to
+        //:   ensure that the values in its first row, from which the other
+        //:   rows are derived, are correct.
         //
         // Plan:
         //: 1 We cannot access the array directly from this test driver because
@@ -544,7 +642,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   CRC_TABLE TEST
-        //   static bsls::Types::Uint64 CRC_TABLE[256]; (bdlde_crc64.cpp)
+        //   static bsls::Types::Uint64 CRC_TABLE[8][256]; (bdlde_crc64.cpp)
         // --------------------------------------------------------------------
 
         if (verbose) cout << "\n" "TESTING CRC_TABLE"
@@ -2659,6 +2757,85 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput, in GB/s, of the byte-at-a-time oracle and
+        //:   of each 'Crc64_Impl' implementation, for inputs ranging from a
+        //:   cache line to a megabyte.
+        //
+        // Plan:
+        //: 1 For each input length, time repeated checksums of one buffer,
+        //:   about 1 GB in total for each implementation (and a tenth of that
+        //:   for the slow 'update_crc' oracle).  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "PERFORMANCE TEST: THROUGHPUT"
+                             "\n" "============================" "\n";
+
+        typedef bdlde::Crc64_Impl Impl;
+
+        cout << "isHardwareAccelerated: " << Impl::isHardwareAccelerated()
+             << endl;
+
+        const int LENGTHS[]   = { 64, 1024, 64 * 1024, 1024 * 1024 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        bsl::vector<char> buffer(LENGTHS[NUM_LENGTHS - 1]);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 131 + (i >> 9));
+        }
+        const char *DATA = buffer.data();
+
+        const bsls::Types::Int64 TOTAL = 1 << 30;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int                LENGTH     = LENGTHS[ti];
+            const bsls::Types::Int64 ITERATIONS = TOTAL / LENGTH;
+
+            bsls::Types::Uint64 sum = 0;
+            bsls::Stopwatch     timer;
+
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS / 10; ++i) {
+                sum += update_crc(0, DATA, LENGTH);
+            }
+            timer.stop();
+            const double oracle = timer.accumulatedWallTime() * 10;
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Impl::calculateSoftware(DATA, LENGTH);
+            }
+            timer.stop();
+            const double software = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Impl::calculateHardware(DATA, LENGTH);
+            }
+            timer.stop();
+            const double hardware = timer.accumulatedWallTime();
+
+            const double GB = static_cast<double>(TOTAL) / 1e9;
+
+            cout << "length " << LENGTH
+                 << ": byte-at-a-time " << GB / oracle << " GB/s"
+                 << ", software " << GB / software << " GB/s"
+                 << ", hardware " << GB / hardware << " GB/s";
+            if (veryVerbose) {
+                cout << " (" << sum << ")";
+            }
+            cout << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
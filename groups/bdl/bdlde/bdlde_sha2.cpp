@@ -1,10 +1,63 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_SHA2_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLDE_SHA2_X86_SIMD)
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define BDLDE_SHA2_TARGET_SHA __attribute__((target("sha,sse4.1")))
+    // Allow the SHA extensions, and the SSE4.1 instructions used to arrange
+    // their operands, in the annotated function only, so that the rest of the
+    // component runs on processors without them.
+
+#define BDLDE_SHA2_TARGET_AVX2 __attribute__((target("avx2")))
+    // Allow the AVX2 instruction set in the annotated function only.
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// All four hashes share 'transform', the compression function of FIPS 180-4
+// applied to a sequence of blocks, instantiated for 32-bit words (SHA-224 and
+// SHA-256) and for 64-bit words (SHA-384 and SHA-512), and called through the
+// 'compress' overloads.  On x86-64 processors supporting the SHA extensions,
+// which is determined at runtime, 'compress' replaces the 32-bit compression
+// function by 'transformShaExtensions', which performs two rounds per
+// 'sha256rnds2' instruction and computes the message schedule with
+// 'sha256msg1' and 'sha256msg2'.  There are no such instructions for 64-bit
+// words, and the rounds of a single message form a chain of dependencies that
+// general-purpose vector instructions do not shorten.
+//
+// Vector instructions pay off across independent messages instead, which
+// 'loadDigests' exploits: on processors supporting AVX2, each 256-bit
+// register holds the same word of the states of 8 (SHA-224 and SHA-256) or 4
+// (SHA-384 and SHA-512) messages, one per *lane*, so that each instruction
+// advances all of them (see 'compressLanes').  A single stream of SHA
+// extension instructions outpaces 8 AVX2 lanes, however, so on processors
+// supporting the SHA extensions the 32-bit hashes use 2 lanes instead, whose
+// 'sha256rnds2' instructions are interleaved to hide their latency (see
+// 'ShaExtensionsLanes2').  'hashInLanes' feeds each lane the blocks of one
+// message followed by its padding, as many contiguous blocks at a time as
+// all busy lanes have, gives the lane the next message as soon as it is done,
+// and finishes the last messages with 'compress' once there are too few to
+// keep the lanes busy.
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -196,6 +249,34 @@ const bsl::uint64_t sha512Constants[80] =
              0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
+// Second 32 bits of the fractional parts of the square root of the 9th
+// through 16th primes.
+const bsl::uint32_t sha224InitialState[8] =
+            {0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+             0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialState[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+// First 64 bits of the fractional parts of the square root of the 9th
+// through 16th primes.
+const bsl::uint64_t sha384InitialState[8] =
+            {0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL,
+             0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+             0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL,
+             0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL};
+
+// First 64 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint64_t sha512InitialState[8] =
+            {0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+             0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+             0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+             0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
 void transform(INTEGER             *state,
                const unsigned char *message,
@@ -247,6 +328,198 @@ void transform(INTEGER             *state,
     }
 }
 
+typedef void (*Sha256Transform)(bsl::uint32_t       *state,
+                                const unsigned char *message,
+                                bsl::uint64_t        numberOfBuffers);
+    // 'Sha256Transform' is an alias for a function that updates the specified
+    // 'state' of a SHA-224 or SHA-256 hash with the specified
+    // 'numberOfBuffers' 64-byte blocks at the specified 'message'.
+
+void transformPortable(bsl::uint32_t       *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' of a SHA-224 or SHA-256 hash with the
+    // specified 'numberOfBuffers' 64-byte blocks at the specified 'message'.
+{
+    transform(state, message, numberOfBuffers, 64, sha256Constants);
+}
+
+#if defined(BDLDE_SHA2_X86_SIMD)
+
+bool hasShaExtensions()
+    // Return 'true' if the current processor supports the SHA extensions and
+    // SSE4.1, and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx)
+        && (ecx & bit_SSE4_1)
+        && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        && (ebx & bit_SHA);
+}
+
+BDLDE_SHA2_TARGET_SHA inline
+void shaRounds(__m128i             *abef,
+               __m128i             *cdgh,
+               __m128i              words,
+               const bsl::uint32_t *constants)
+    // Apply to the state of a SHA-256 hash held in the specified 'abef' and
+    // 'cdgh' the four rounds mixing in the specified 'words' of the message
+    // schedule and the corresponding four specified 'constants'.
+{
+    const __m128i input = _mm_add_epi32(
+                      words,
+                      _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(constants)));
+
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, input);
+    *abef = _mm_sha256rnds2_epu32(*abef,
+                                  *cdgh,
+                                  _mm_shuffle_epi32(input, 0x0e));
+}
+
+BDLDE_SHA2_TARGET_SHA inline
+__m128i shaSchedule(__m128i w0, __m128i w1, __m128i w2, __m128i w3)
+    // Return the four words of the SHA-256 message schedule that follow the
+    // sixteen words in the specified 'w0', 'w1', 'w2', and 'w3'.
+{
+    return _mm_sha256msg2_epu32(
+                           _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1),
+                                         _mm_alignr_epi8(w3, w2, 4)),
+                           w3);
+}
+
+BDLDE_SHA2_TARGET_SHA inline
+__m128i shaLoadWords(const unsigned char *block, int index)
+    // Return the four big-endian words of the specified 'block' beginning at
+    // the word having the specified 'index'.
+{
+    return _mm_shuffle_epi8(
+               _mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(block + 4 * index)),
+               _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL));
+}
+
+BDLDE_SHA2_TARGET_SHA inline
+void shaLoadState(__m128i *abef, __m128i *cdgh, const bsl::uint32_t *state)
+    // Load into the specified 'abef' and 'cdgh' the specified 'state' of a
+    // SHA-256 hash, arranged as 'sha256rnds2' takes it: as the vectors
+    // (A, B, E, F) and (C, D, G, H), listed from the highest element to the
+    // lowest.
+{
+    const __m128i cdab = _mm_shuffle_epi32(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(state)),
+                   0xb1);
+    const __m128i efgh = _mm_shuffle_epi32(
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)),
+               0x1b);
+
+    *abef = _mm_alignr_epi8(cdab, efgh, 8);
+    *cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+}
+
+BDLDE_SHA2_TARGET_SHA inline
+void shaStoreState(bsl::uint32_t *state, __m128i abef, __m128i cdgh)
+    // Store into the specified 'state' of a SHA-256 hash the value held in
+    // the specified 'abef' and 'cdgh' (see 'shaLoadState').
+{
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+BDLDE_SHA2_TARGET_SHA
+void transformShaExtensions(bsl::uint32_t       *state,
+                            const unsigned char *message,
+                            bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' of a SHA-224 or SHA-256 hash with the
+    // specified 'numberOfBuffers' 64-byte blocks at the specified 'message',
+    // using the SHA extensions.  The behavior is undefined unless the current
+    // processor supports the SHA extensions and SSE4.1.
+{
+    __m128i abef, cdgh;
+    shaLoadState(&abef, &cdgh, state);
+
+    for (; numberOfBuffers; --numberOfBuffers, message += 64) {
+        const __m128i abefSaved = abef;
+        const __m128i cdghSaved = cdgh;
+
+        __m128i w0 = shaLoadWords(message,  0);
+        __m128i w1 = shaLoadWords(message,  4);
+        __m128i w2 = shaLoadWords(message,  8);
+        __m128i w3 = shaLoadWords(message, 12);
+
+        shaRounds(&abef, &cdgh, w0, sha256Constants);
+        shaRounds(&abef, &cdgh, w1, sha256Constants + 4);
+        shaRounds(&abef, &cdgh, w2, sha256Constants + 8);
+        shaRounds(&abef, &cdgh, w3, sha256Constants + 12);
+
+        for (int index = 16; index != 64; index += 16) {
+            w0 = shaSchedule(w0, w1, w2, w3);
+            shaRounds(&abef, &cdgh, w0, sha256Constants + index);
+            w1 = shaSchedule(w1, w2, w3, w0);
+            shaRounds(&abef, &cdgh, w1, sha256Constants + index + 4);
+            w2 = shaSchedule(w2, w3, w0, w1);
+            shaRounds(&abef, &cdgh, w2, sha256Constants + index + 8);
+            w3 = shaSchedule(w3, w0, w1, w2);
+            shaRounds(&abef, &cdgh, w3, sha256Constants + index + 12);
+        }
+
+        abef = _mm_add_epi32(abef, abefSaved);
+        cdgh = _mm_add_epi32(cdgh, cdghSaved);
+    }
+
+    shaStoreState(state, abef, cdgh);
+}
+
+#endif  // BDLDE_SHA2_X86_SIMD
+
+Sha256Transform sha256Transform()
+    // Return the fastest 'Sha256Transform' supported by the current
+    // processor.  The processor is queried only on the first call.
+{
+    static Sha256Transform s_transform_p = 0;
+
+    BSLMT_ONCE_DO {
+        s_transform_p = transformPortable;
+
+#if defined(BDLDE_SHA2_X86_SIMD)
+        if (hasShaExtensions()) {
+            s_transform_p = transformShaExtensions;
+        }
+#endif
+    }
+
+    return s_transform_p;
+}
+
+void compress(bsl::uint32_t        *state,
+              const unsigned char  *message,
+              bsl::uint64_t         numberOfBuffers,
+              const bsl::uint32_t (&)[64])
+    // Update the specified 'state' of a SHA-224 or SHA-256 hash with the
+    // specified 'numberOfBuffers' 64-byte blocks at the specified 'message',
+    // using the fastest compression function supported by the current
+    // processor.
+{
+    sha256Transform()(state, message, numberOfBuffers);
+}
+
+void compress(bsl::uint64_t        *state,
+              const unsigned char  *message,
+              bsl::uint64_t         numberOfBuffers,
+              const bsl::uint64_t (&constants)[80])
+    // Update the specified 'state' of a SHA-384 or SHA-512 hash with the
+    // specified 'numberOfBuffers' 128-byte blocks at the specified 'message',
+    // mixing it with the values in the specified 'constants'.
+{
+    transform(state, message, numberOfBuffers, 128, constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -277,12 +550,12 @@ void updateImpl(INTEGER             *state,
         return;                                                       // RETURN
     }
 
-    transform(state, buffer, 1, BUFFER_CAPACITY, constants);
+    compress(state, buffer, 1, constants);
 
     const unsigned char *remaining        = message + prologueSize;
     const bsl::uint64_t  remainingSize    = messageSize - prologueSize;
     const bsl::uint64_t  remainingBuffers = remainingSize / BUFFER_CAPACITY;
-    transform(state, remaining, remainingBuffers, BUFFER_CAPACITY, constants);
+    compress(state, remaining, remainingBuffers, constants);
 
     *bufferSize = remainingSize % BUFFER_CAPACITY;
     const unsigned char *epilogue = remaining
@@ -320,17 +593,892 @@ void finalize(unsigned char        *result,
     finalBuffers[bufferSize] = 1 << 7;
     unsigned char *end = finalBuffers + remainingBuffers * BUFFER_CAPACITY;
     unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
-    transform(state,
-              finalBuffers,
-              remainingBuffers,
-              BUFFER_CAPACITY,
-              constants);
+    compress(state, finalBuffers, remainingBuffers, constants);
 
     for (unsigned index = 0 ; index < digestSize / sizeof(INTEGER); ++index) {
         unpack(state[index], &result[index * sizeof(INTEGER)]);
     }
 }
 
+template <class HASHER>
+void hashEach(unsigned char      *results,
+              const void * const *messages,
+              const bsl::size_t  *lengths,
+              bsl::size_t         numMessages)
+    // Load into the specified 'results' the digests, computed by 'HASHER', of
+    // the specified 'numMessages' messages at the specified 'messages' having
+    // the specified 'lengths', one message at a time.
+{
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        HASHER(messages[index], lengths[index]).loadDigest(
+                                     results + index * HASHER::k_DIGEST_SIZE);
+    }
+}
+
+#if defined(BDLDE_SHA2_X86_SIMD)
+
+const bsl::size_t k_MIN_MESSAGES_IN_LANES = 2;
+    // The smallest number of messages that 'loadDigests' hashes in lanes.
+
+bool hasAvx2()
+    // Return 'true' if the current processor supports AVX2, and 'false'
+    // otherwise.  The processor is queried only on the first call.
+{
+    static bool s_hasAvx2 = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        s_hasAvx2 = __builtin_cpu_supports("avx2");
+    }
+
+    return s_hasAvx2;
+}
+
+struct Avx2Lanes32 {
+    // This 'struct' provides the operations on vectors of 32-bit words needed
+    // by 'compressLanes' to hash 8 SHA-224 or SHA-256 messages at a time.
+
+    // TYPES
+    typedef bsl::uint32_t Word;
+
+    enum {
+        k_NUM_LANES  = 8,   // messages hashed at a time
+        k_BLOCK_SIZE = 64,  // bytes per block
+        k_NUM_ROUNDS = 64,  // rounds per block
+        k_MIN_ACTIVE = 2    // fewest lanes in use worth hashing in lanes
+    };
+
+    // CLASS METHODS
+    static void compress(Word                 (*state)[k_NUM_LANES],
+                         const unsigned char *const *blocks,
+                         bsl::uint64_t               numBlocks,
+                         const Word                 *constants);
+        // Update the specified 'state', holding in its column 'i' the state
+        // of the hash of the message in lane 'i', with the specified
+        // 'numBlocks' consecutive 64-byte blocks beginning at 'blocks[i]',
+        // mixing them with the specified 'constants'.  The behavior is
+        // undefined unless the current processor supports AVX2.
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i add(__m256i x, __m256i y)
+        // Return the lane-wise sum of the specified 'x' and 'y'.
+    {
+        return _mm256_add_epi32(x, y);
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i broadcast(Word value)
+        // Return a vector holding the specified 'value' in every lane.
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i rotateRight(__m256i x, int shift)
+        // Return the words of the specified 'x' rotated right by the
+        // specified 'shift' bits.
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, shift),
+                               _mm256_slli_epi32(x, 32 - shift));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f1(__m256i x)
+        // Return the first mixing function of SHA-256 applied to each word of
+        // the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x,  2),
+                                                 rotateRight(x, 13)),
+                                rotateRight(x, 22));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f2(__m256i x)
+        // Return the second mixing function of SHA-256 applied to each word
+        // of the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x,  6),
+                                                 rotateRight(x, 11)),
+                                rotateRight(x, 25));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f3(__m256i x)
+        // Return the third mixing function of SHA-256 applied to each word of
+        // the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x,  7),
+                                                 rotateRight(x, 18)),
+                                _mm256_srli_epi32(x, 3));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f4(__m256i x)
+        // Return the fourth mixing function of SHA-256 applied to each word
+        // of the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x, 17),
+                                                 rotateRight(x, 19)),
+                                _mm256_srli_epi32(x, 10));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i loadWord(const unsigned char *const *blocks, int index)
+        // Return a vector holding in each lane 'i' the big-endian word at the
+        // specified 'index' of the block at 'blocks[i]'.
+    {
+        const bsl::size_t offset = index * sizeof(Word);
+
+        return _mm256_setr_epi32(
+                         static_cast<int>(pack<Word>(blocks[0] + offset)),
+                         static_cast<int>(pack<Word>(blocks[1] + offset)),
+                         static_cast<int>(pack<Word>(blocks[2] + offset)),
+                         static_cast<int>(pack<Word>(blocks[3] + offset)),
+                         static_cast<int>(pack<Word>(blocks[4] + offset)),
+                         static_cast<int>(pack<Word>(blocks[5] + offset)),
+                         static_cast<int>(pack<Word>(blocks[6] + offset)),
+                         static_cast<int>(pack<Word>(blocks[7] + offset)));
+    }
+};
+
+struct Avx2Lanes64 {
+    // This 'struct' provides the operations on vectors of 64-bit words needed
+    // by 'compressLanes' to hash 4 SHA-384 or SHA-512 messages at a time.
+
+    // TYPES
+    typedef bsl::uint64_t Word;
+
+    enum {
+        k_NUM_LANES  = 4,    // messages hashed at a time
+        k_BLOCK_SIZE = 128,  // bytes per block
+        k_NUM_ROUNDS = 80,   // rounds per block
+        k_MIN_ACTIVE = 2     // fewest lanes in use worth hashing in lanes
+    };
+
+    // CLASS METHODS
+    static void compress(Word                 (*state)[k_NUM_LANES],
+                         const unsigned char *const *blocks,
+                         bsl::uint64_t               numBlocks,
+                         const Word                 *constants);
+        // Update the specified 'state', holding in its column 'i' the state
+        // of the hash of the message in lane 'i', with the specified
+        // 'numBlocks' consecutive 128-byte blocks beginning at 'blocks[i]',
+        // mixing them with the specified 'constants'.  The behavior is
+        // undefined unless the current processor supports AVX2.
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i add(__m256i x, __m256i y)
+        // Return the lane-wise sum of the specified 'x' and 'y'.
+    {
+        return _mm256_add_epi64(x, y);
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i broadcast(Word value)
+        // Return a vector holding the specified 'value' in every lane.
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i rotateRight(__m256i x, int shift)
+        // Return the words of the specified 'x' rotated right by the
+        // specified 'shift' bits.
+    {
+        return _mm256_or_si256(_mm256_srli_epi64(x, shift),
+                               _mm256_slli_epi64(x, 64 - shift));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f1(__m256i x)
+        // Return the first mixing function of SHA-512 applied to each word of
+        // the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x, 28),
+                                                 rotateRight(x, 34)),
+                                rotateRight(x, 39));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f2(__m256i x)
+        // Return the second mixing function of SHA-512 applied to each word
+        // of the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x, 14),
+                                                 rotateRight(x, 18)),
+                                rotateRight(x, 41));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f3(__m256i x)
+        // Return the third mixing function of SHA-512 applied to each word of
+        // the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x, 1),
+                                                 rotateRight(x, 8)),
+                                _mm256_srli_epi64(x, 7));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i f4(__m256i x)
+        // Return the fourth mixing function of SHA-512 applied to each word
+        // of the specified 'x'.
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(rotateRight(x, 19),
+                                                 rotateRight(x, 61)),
+                                _mm256_srli_epi64(x, 6));
+    }
+
+    BDLDE_SHA2_TARGET_AVX2 static inline
+    __m256i loadWord(const unsigned char *const *blocks, int index)
+        // Return a vector holding in each lane 'i' the big-endian word at the
+        // specified 'index' of the block at 'blocks[i]'.
+    {
+        const bsl::size_t offset = index * sizeof(Word);
+
+        return _mm256_setr_epi64x(
+                   static_cast<long long>(pack<Word>(blocks[0] + offset)),
+                   static_cast<long long>(pack<Word>(blocks[1] + offset)),
+                   static_cast<long long>(pack<Word>(blocks[2] + offset)),
+                   static_cast<long long>(pack<Word>(blocks[3] + offset)));
+    }
+};
+
+template <class LANES>
+BDLDE_SHA2_TARGET_AVX2
+void compressLanes(typename LANES::Word        (*state)[LANES::k_NUM_LANES],
+                   const unsigned char *const   *blocks,
+                   bsl::uint64_t                 numBlocks,
+                   const typename LANES::Word   *constants)
+    // Update the specified 'state', holding in its column 'i' the state of
+    // the hash of the message in lane 'i', with the specified 'numBlocks'
+    // consecutive blocks beginning at 'blocks[i]', mixing them with the
+    // specified 'constants'.  The behavior is undefined unless the current
+    // processor supports AVX2.
+{
+    const unsigned char *current[LANES::k_NUM_LANES];
+    bsl::copy(blocks, blocks + LANES::k_NUM_LANES, current);
+
+    __m256i wv[8];
+    for (int index = 0; index != 8; ++index) {
+        wv[index] = _mm256_loadu_si256(
+                                 reinterpret_cast<__m256i *>(state[index]));
+    }
+
+    for (; numBlocks; --numBlocks) {
+        __m256i w[LANES::k_NUM_ROUNDS];
+        for (int index = 0; index != 16; ++index) {
+            w[index] = LANES::loadWord(current, index);
+        }
+        for (int index = 16; index != LANES::k_NUM_ROUNDS; ++index) {
+            w[index] = LANES::add(LANES::add(LANES::f4(w[index -  2]),
+                                             w[index -  7]),
+                                  LANES::add(LANES::f3(w[index - 15]),
+                                             w[index - 16]));
+        }
+        for (int lane = 0; lane != LANES::k_NUM_LANES; ++lane) {
+            current[lane] += LANES::k_BLOCK_SIZE;
+        }
+
+        __m256i a = wv[0], b = wv[1], c = wv[2], d = wv[3];
+        __m256i e = wv[4], f = wv[5], g = wv[6], h = wv[7];
+
+        for (int index = 0; index != LANES::k_NUM_ROUNDS; ++index) {
+            const __m256i ch  = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                                 _mm256_andnot_si256(e, g));
+            const __m256i maj = _mm256_or_si256(
+                              _mm256_and_si256(a, b),
+                              _mm256_and_si256(_mm256_or_si256(a, b), c));
+            const __m256i t1  = LANES::add(
+                               LANES::add(LANES::add(h, LANES::f2(e)), ch),
+                               LANES::add(LANES::broadcast(constants[index]),
+                                          w[index]));
+            const __m256i t2  = LANES::add(LANES::f1(a), maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = LANES::add(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = LANES::add(t1, t2);
+        }
+
+        wv[0] = LANES::add(wv[0], a);
+        wv[1] = LANES::add(wv[1], b);
+        wv[2] = LANES::add(wv[2], c);
+        wv[3] = LANES::add(wv[3], d);
+        wv[4] = LANES::add(wv[4], e);
+        wv[5] = LANES::add(wv[5], f);
+        wv[6] = LANES::add(wv[6], g);
+        wv[7] = LANES::add(wv[7], h);
+    }
+
+    for (int index = 0; index != 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            wv[index]);
+    }
+}
+
+void Avx2Lanes32::compress(Word                 (*state)[k_NUM_LANES],
+                           const unsigned char *const *blocks,
+                           bsl::uint64_t               numBlocks,
+                           const Word                 *constants)
+{
+    compressLanes<Avx2Lanes32>(state, blocks, numBlocks, constants);
+}
+
+void Avx2Lanes64::compress(Word                 (*state)[k_NUM_LANES],
+                           const unsigned char *const *blocks,
+                           bsl::uint64_t               numBlocks,
+                           const Word                 *constants)
+{
+    compressLanes<Avx2Lanes64>(state, blocks, numBlocks, constants);
+}
+
+struct ShaExtensionsLanes2 {
+    // This 'struct' provides a compression function that hashes 2 SHA-224 or
+    // SHA-256 messages at a time with the SHA extensions, interleaving their
+    // instructions to hide the latency of 'sha256rnds2'.
+
+    // TYPES
+    typedef bsl::uint32_t Word;
+
+    enum {
+        k_NUM_LANES  = 2,   // messages hashed at a time
+        k_BLOCK_SIZE = 64,  // bytes per block
+        k_MIN_ACTIVE = 2    // fewest lanes in use worth hashing in lanes
+    };
+
+    // CLASS METHODS
+    BDLDE_SHA2_TARGET_SHA static
+    void compress(Word                 (*state)[k_NUM_LANES],
+                  const unsigned char *const *blocks,
+                  bsl::uint64_t               numBlocks,
+                  const Word                 *constants)
+        // Update the specified 'state', holding in its column 'i' the state
+        // of the hash of the message in lane 'i', with the specified
+        // 'numBlocks' consecutive 64-byte blocks beginning at 'blocks[i]',
+        // mixing them with the specified 'constants'.  The behavior is
+        // undefined unless the current processor supports the SHA extensions
+        // and SSE4.1.
+    {
+        Word state0[8], state1[8];
+        for (int index = 0; index != 8; ++index) {
+            state0[index] = state[index][0];
+            state1[index] = state[index][1];
+        }
+
+        __m128i abef0, cdgh0, abef1, cdgh1;
+        shaLoadState(&abef0, &cdgh0, state0);
+        shaLoadState(&abef1, &cdgh1, state1);
+
+        const unsigned char *block0 = blocks[0];
+        const unsigned char *block1 = blocks[1];
+
+        for (; numBlocks; --numBlocks, block0 += 64, block1 += 64) {
+            compressBlocks(&abef0, &cdgh0, &abef1, &cdgh1,
+                           block0, block1,
+                           constants);
+        }
+
+        shaStoreState(state0, abef0, cdgh0);
+        shaStoreState(state1, abef1, cdgh1);
+
+        for (int index = 0; index != 8; ++index) {
+            state[index][0] = state0[index];
+            state[index][1] = state1[index];
+        }
+    }
+
+    BDLDE_SHA2_TARGET_SHA static inline
+    void compressBlocks(__m128i             *abef0,
+                        __m128i             *cdgh0,
+                        __m128i             *abef1,
+                        __m128i             *cdgh1,
+                        const unsigned char *block0,
+                        const unsigned char *block1,
+                        const Word          *constants)
+        // Update the states of two SHA-256 hashes held in the specified
+        // 'abef0' and 'cdgh0', and in the specified 'abef1' and 'cdgh1' (see
+        // 'shaLoadState'), with the specified 64-byte 'block0' and 'block1'
+        // respectively, mixing them with the specified 'constants'.
+    {
+        const __m128i abefSaved0 = *abef0, cdghSaved0 = *cdgh0;
+        const __m128i abefSaved1 = *abef1, cdghSaved1 = *cdgh1;
+
+        __m128i w0 = shaLoadWords(block0,  0);
+        __m128i w1 = shaLoadWords(block0,  4);
+        __m128i w2 = shaLoadWords(block0,  8);
+        __m128i w3 = shaLoadWords(block0, 12);
+        __m128i v0 = shaLoadWords(block1,  0);
+        __m128i v1 = shaLoadWords(block1,  4);
+        __m128i v2 = shaLoadWords(block1,  8);
+        __m128i v3 = shaLoadWords(block1, 12);
+
+        shaRounds(abef0, cdgh0, w0, constants);
+        shaRounds(abef1, cdgh1, v0, constants);
+        shaRounds(abef0, cdgh0, w1, constants + 4);
+        shaRounds(abef1, cdgh1, v1, constants + 4);
+        shaRounds(abef0, cdgh0, w2, constants + 8);
+        shaRounds(abef1, cdgh1, v2, constants + 8);
+        shaRounds(abef0, cdgh0, w3, constants + 12);
+        shaRounds(abef1, cdgh1, v3, constants + 12);
+
+        for (int index = 16; index != 64; index += 16) {
+            w0 = shaSchedule(w0, w1, w2, w3);
+            v0 = shaSchedule(v0, v1, v2, v3);
+            shaRounds(abef0, cdgh0, w0, constants + index);
+            shaRounds(abef1, cdgh1, v0, constants + index);
+            w1 = shaSchedule(w1, w2, w3, w0);
+            v1 = shaSchedule(v1, v2, v3, v0);
+            shaRounds(abef0, cdgh0, w1, constants + index + 4);
+            shaRounds(abef1, cdgh1, v1, constants + index + 4);
+            w2 = shaSchedule(w2, w3, w0, w1);
+            v2 = shaSchedule(v2, v3, v0, v1);
+            shaRounds(abef0, cdgh0, w2, constants + index + 8);
+            shaRounds(abef1, cdgh1, v2, constants + index + 8);
+            w3 = shaSchedule(w3, w0, w1, w2);
+            v3 = shaSchedule(v3, v0, v1, v2);
+            shaRounds(abef0, cdgh0, w3, constants + index + 12);
+            shaRounds(abef1, cdgh1, v3, constants + index + 12);
+        }
+
+        *abef0 = _mm_add_epi32(*abef0, abefSaved0);
+        *cdgh0 = _mm_add_epi32(*cdgh0, cdghSaved0);
+        *abef1 = _mm_add_epi32(*abef1, abefSaved1);
+        *cdgh1 = _mm_add_epi32(*cdgh1, cdghSaved1);
+    }
+};
+
+#endif  // BDLDE_SHA2_X86_SIMD
+
+template <class LANES>
+struct Lane {
+    // This 'struct' describes the message being hashed in one lane by
+    // 'hashInLanes': its blocks, followed by the blocks holding the end of
+    // the message and the SHA-2 padding.
+
+    enum { k_BLOCK_SIZE = LANES::k_BLOCK_SIZE };
+
+    // DATA
+    const unsigned char *d_message_p;     // message being hashed
+
+    bsl::size_t          d_index;         // index of the message
+
+    bsl::uint64_t        d_numFull;       // blocks entirely in the message
+
+    bsl::uint64_t        d_numBlocks;     // blocks including the padding
+
+    bsl::uint64_t        d_next;          // index of the next block
+
+    unsigned char        d_tail[2 * k_BLOCK_SIZE];
+                                          // end of the message and padding
+
+    // MANIPULATORS
+    void start(const void *message, bsl::size_t length, bsl::size_t index)
+        // Prepare to hash the specified 'message' having the specified
+        // 'length' and the specified 'index'.
+    {
+        d_message_p = static_cast<const unsigned char *>(message);
+        d_index     = index;
+        d_numFull   = length / k_BLOCK_SIZE;
+        d_next      = 0;
+
+        const bsl::size_t remainder = length % k_BLOCK_SIZE;
+        const bsl::size_t numTail   =
+            remainder + 1 + 2 * sizeof(typename LANES::Word) <= k_BLOCK_SIZE
+            ? 1
+            : 2;
+
+        if (remainder) {
+            bsl::memcpy(d_tail,
+                        d_message_p + d_numFull * k_BLOCK_SIZE,
+                        remainder);
+        }
+        d_tail[remainder] = 1 << 7;
+        bsl::fill(d_tail + remainder + 1,
+                  d_tail + numTail * k_BLOCK_SIZE - sizeof(bsl::uint64_t),
+                  0);
+        unpack(static_cast<bsl::uint64_t>(length) * 8,
+               d_tail + numTail * k_BLOCK_SIZE - sizeof(bsl::uint64_t));
+
+        d_numBlocks = d_numFull + numTail;
+    }
+
+    void advance(bsl::uint64_t numBlocks)
+        // Advance past the specified 'numBlocks' blocks.  The behavior is
+        // undefined unless 'numBlocks <= numContiguous()'.
+    {
+        d_next += numBlocks;
+    }
+
+    // ACCESSORS
+    const unsigned char *block() const
+        // Return the address of the next block of the message.  The behavior
+        // is undefined unless '!isDone()'.
+    {
+        return d_next < d_numFull
+               ? d_message_p + d_next * k_BLOCK_SIZE
+               : d_tail + (d_next - d_numFull) * k_BLOCK_SIZE;
+    }
+
+    bsl::uint64_t numContiguous() const
+        // Return the number of blocks, starting with the next one, that are
+        // contiguous in memory.
+    {
+        return d_next < d_numFull ? d_numFull - d_next : d_numBlocks - d_next;
+    }
+
+    bool isDone() const
+        // Return 'true' if all the blocks of the message have been hashed,
+        // and 'false' otherwise.
+    {
+        return d_next == d_numBlocks;
+    }
+};
+
+template <class LANES, bsl::size_t ARRAY_SIZE>
+void hashInLanes(unsigned char              *results,
+                 bsl::size_t                 digestSize,
+                 const void * const         *messages,
+                 const bsl::size_t          *lengths,
+                 bsl::size_t                 numMessages,
+                 const typename LANES::Word (&initialState)[8],
+                 const typename LANES::Word (&constants)[ARRAY_SIZE])
+    // Load into the specified 'results' the digests having the specified
+    // 'digestSize' of the specified 'numMessages' messages at the specified
+    // 'messages' having the specified 'lengths', starting from the specified
+    // 'initialState' and mixing in the specified 'constants', hashing
+    // 'LANES::k_NUM_LANES' messages at a time.  The behavior is undefined
+    // unless the current processor supports the instructions used by
+    // 'LANES::compress'.
+{
+    typedef typename LANES::Word Word;
+
+    enum { k_NUM_LANES = LANES::k_NUM_LANES };
+
+    Word                 state[8][k_NUM_LANES];
+    Lane<LANES>          lanes[k_NUM_LANES];
+    bool                 isActive[k_NUM_LANES] = {};
+    const unsigned char *blocks[k_NUM_LANES];
+
+    bsl::size_t next      = 0;  // index of the next message to start
+    int         numActive = 0;  // number of lanes hashing a message
+
+    for (;;) {
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (!isActive[lane] && next != numMessages) {
+                lanes[lane].start(messages[next], lengths[next], next);
+                for (int word = 0; word != 8; ++word) {
+                    state[word][lane] = initialState[word];
+                }
+                isActive[lane] = true;
+                ++numActive;
+                ++next;
+            }
+        }
+
+        if (next == numMessages && numActive < LANES::k_MIN_ACTIVE) {
+            break;
+        }
+
+        // Hash as many blocks as are contiguous in every active lane.  Idle
+        // lanes hash the blocks of an active one, and their state is
+        // discarded.
+
+        bsl::uint64_t        numBlocks = ~bsl::uint64_t();
+        const unsigned char *anyBlock  = 0;
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (isActive[lane]) {
+                anyBlock  = lanes[lane].block();
+                numBlocks = bsl::min(numBlocks, lanes[lane].numContiguous());
+            }
+        }
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            blocks[lane] = isActive[lane] ? lanes[lane].block() : anyBlock;
+        }
+
+        LANES::compress(state, blocks, numBlocks, constants);
+
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (!isActive[lane]) {
+                continue;
+            }
+            lanes[lane].advance(numBlocks);
+            if (lanes[lane].isDone()) {
+                unsigned char *result = results
+                                      + lanes[lane].d_index * digestSize;
+                for (bsl::size_t word = 0;
+                     word != digestSize / sizeof(Word);
+                     ++word) {
+                    unpack(state[word][lane], result + word * sizeof(Word));
+                }
+                isActive[lane] = false;
+                --numActive;
+            }
+        }
+    }
+
+    // Finish the messages left in lanes one at a time.
+
+    for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+        if (!isActive[lane]) {
+            continue;
+        }
+
+        Lane<LANES>& current = lanes[lane];
+
+        Word laneState[8];
+        for (int word = 0; word != 8; ++word) {
+            laneState[word] = state[word][lane];
+        }
+
+        if (current.d_next < current.d_numFull) {
+            compress(laneState,
+                     current.d_message_p
+                                     + current.d_next * LANES::k_BLOCK_SIZE,
+                     current.d_numFull - current.d_next,
+                     constants);
+            current.d_next = current.d_numFull;
+        }
+        compress(laneState,
+                 current.d_tail
+                      + (current.d_next - current.d_numFull)
+                      * LANES::k_BLOCK_SIZE,
+                 current.d_numBlocks - current.d_next,
+                 constants);
+
+        unsigned char *result = results + current.d_index * digestSize;
+        for (bsl::size_t word = 0; word != digestSize / sizeof(Word); ++word) {
+            unpack(laneState[word], result + word * sizeof(Word));
+        }
+    }
+}
+
+template <class WORD,
+          void (*TRANSFORM)(WORD *, const unsigned char *, bsl::uint64_t)>
+struct OneLane {
+    // This 'struct' provides a compression function for 'hashInLanes' that
+    // hashes one message at a time with the specified 'TRANSFORM', so that a
+    // batch can be hashed by any single-message implementation.
+
+    // TYPES
+    typedef WORD Word;
+
+    enum {
+        k_NUM_LANES  = 1,
+        k_BLOCK_SIZE = 16 * sizeof(WORD),
+        k_MIN_ACTIVE = 1
+    };
+
+    // CLASS METHODS
+    static void compress(Word                 (*state)[k_NUM_LANES],
+                         const unsigned char *const *blocks,
+                         bsl::uint64_t               numBlocks,
+                         const Word                 *)
+        // Update the specified 'state' with the specified 'numBlocks'
+        // contiguous blocks at 'blocks[0]' using 'TRANSFORM'.
+    {
+        Word laneState[8];
+        for (int word = 0; word != 8; ++word) {
+            laneState[word] = state[word][0];
+        }
+        TRANSFORM(laneState, blocks[0], numBlocks);
+        for (int word = 0; word != 8; ++word) {
+            state[word][0] = laneState[word];
+        }
+    }
+};
+
+void transformPortable512(bsl::uint64_t       *state,
+                          const unsigned char *message,
+                          bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' of a SHA-384 or SHA-512 hash with the
+    // specified 'numberOfBuffers' 128-byte blocks at the specified 'message'.
+{
+    transform(state, message, numberOfBuffers, 128, sha512Constants);
+}
+
+#if defined(BDLDE_SHA2_X86_SIMD)
+
+bool hashSha256InLanes(unsigned char       *results,
+                       bsl::size_t          digestSize,
+                       const void * const  *messages,
+                       const bsl::size_t   *lengths,
+                       bsl::size_t          numMessages,
+                       const bsl::uint32_t (&initialState)[8])
+    // Load into the specified 'results' the SHA-224 or SHA-256 digests,
+    // having the specified 'digestSize' and starting from the specified
+    // 'initialState', of the specified 'numMessages' messages at the
+    // specified 'messages' having the specified 'lengths', hashing several
+    // messages at a time, and return 'true', if the current processor
+    // supports doing so and there are enough messages for it to pay off.
+    // Otherwise, return 'false' with no effect.
+{
+    if (numMessages < k_MIN_MESSAGES_IN_LANES) {
+        return false;                                                 // RETURN
+    }
+
+    if (transformShaExtensions == sha256Transform()) {
+        hashInLanes<ShaExtensionsLanes2>(results,
+                                         digestSize,
+                                         messages,
+                                         lengths,
+                                         numMessages,
+                                         initialState,
+                                         sha256Constants);
+        return true;                                                  // RETURN
+    }
+
+    if (hasAvx2()) {
+        hashInLanes<Avx2Lanes32>(results,
+                                 digestSize,
+                                 messages,
+                                 lengths,
+                                 numMessages,
+                                 initialState,
+                                 sha256Constants);
+        return true;                                                  // RETURN
+    }
+
+    return false;
+}
+
+bool hashSha512InLanes(unsigned char       *results,
+                       bsl::size_t          digestSize,
+                       const void * const  *messages,
+                       const bsl::size_t   *lengths,
+                       bsl::size_t          numMessages,
+                       const bsl::uint64_t (&initialState)[8])
+    // Load into the specified 'results' the SHA-384 or SHA-512 digests,
+    // having the specified 'digestSize' and starting from the specified
+    // 'initialState', of the specified 'numMessages' messages at the
+    // specified 'messages' having the specified 'lengths', hashing several
+    // messages at a time, and return 'true', if the current processor
+    // supports doing so and there are enough messages for it to pay off.
+    // Otherwise, return 'false' with no effect.
+{
+    if (numMessages < k_MIN_MESSAGES_IN_LANES || !hasAvx2()) {
+        return false;                                                 // RETURN
+    }
+
+    hashInLanes<Avx2Lanes64>(results,
+                             digestSize,
+                             messages,
+                             lengths,
+                             numMessages,
+                             initialState,
+                             sha512Constants);
+    return true;
+}
+
+#endif  // BDLDE_SHA2_X86_SIMD
+
+void hashWith(Sha2_Impl::Implementation  implementation,
+              unsigned char             *results,
+              bsl::size_t                digestSize,
+              const void * const        *messages,
+              const bsl::size_t         *lengths,
+              bsl::size_t                numMessages,
+              const bsl::uint32_t      (&initialState)[8])
+    // Load into the specified 'results' the SHA-224 or SHA-256 digests,
+    // having the specified 'digestSize' and starting from the specified
+    // 'initialState', of the specified 'numMessages' messages at the
+    // specified 'messages' having the specified 'lengths', using the
+    // specified 'implementation'.  The behavior is undefined unless the
+    // current processor supports 'implementation'.
+{
+    switch (implementation) {
+      case Sha2_Impl::e_PORTABLE: {
+        hashInLanes<OneLane<bsl::uint32_t, transformPortable> >(
+                                                              results,
+                                                              digestSize,
+                                                              messages,
+                                                              lengths,
+                                                              numMessages,
+                                                              initialState,
+                                                              sha256Constants);
+      } break;
+#if defined(BDLDE_SHA2_X86_SIMD)
+      case Sha2_Impl::e_SHA_EXTENSIONS: {
+        hashInLanes<OneLane<bsl::uint32_t, transformShaExtensions> >(
+                                                              results,
+                                                              digestSize,
+                                                              messages,
+                                                              lengths,
+                                                              numMessages,
+                                                              initialState,
+                                                              sha256Constants);
+      } break;
+      case Sha2_Impl::e_SHA_EXTENSIONS_LANES: {
+        hashInLanes<ShaExtensionsLanes2>(results,
+                                         digestSize,
+                                         messages,
+                                         lengths,
+                                         numMessages,
+                                         initialState,
+                                         sha256Constants);
+      } break;
+      case Sha2_Impl::e_AVX2_LANES: {
+        hashInLanes<Avx2Lanes32>(results,
+                                 digestSize,
+                                 messages,
+                                 lengths,
+                                 numMessages,
+                                 initialState,
+                                 sha256Constants);
+      } break;
+#endif
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("unsupported implementation");
+      } break;
+    }
+}
+
+void hashWith(Sha2_Impl::Implementation  implementation,
+              unsigned char             *results,
+              bsl::size_t                digestSize,
+              const void * const        *messages,
+              const bsl::size_t         *lengths,
+              bsl::size_t                numMessages,
+              const bsl::uint64_t      (&initialState)[8])
+    // Load into the specified 'results' the SHA-384 or SHA-512 digests,
+    // having the specified 'digestSize' and starting from the specified
+    // 'initialState', of the specified 'numMessages' messages at the
+    // specified 'messages' having the specified 'lengths', using the
+    // specified 'implementation'.  The behavior is undefined unless the
+    // current processor supports 'implementation'.
+{
+    switch (implementation) {
+      case Sha2_Impl::e_PORTABLE: {
+        hashInLanes<OneLane<bsl::uint64_t, transformPortable512> >(
+                                                              results,
+                                                              digestSize,
+                                                              messages,
+                                                              lengths,
+                                                              numMessages,
+                                                              initialState,
+                                                              sha512Constants);
+      } break;
+#if defined(BDLDE_SHA2_X86_SIMD)
+      case Sha2_Impl::e_AVX2_LANES: {
+        hashInLanes<Avx2Lanes64>(results,
+                                 digestSize,
+                                 messages,
+                                 lengths,
+                                 numMessages,
+                                 initialState,
+                                 sha512Constants);
+      } break;
+#endif
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("unsupported implementation");
+      } break;
+    }
+}
+
 template<bsl::size_t SIZE>
 void toHex(char *output, const unsigned char (&input)[SIZE])
     // Store into the specified 'output' the hex representation of the bytes in
@@ -346,6 +1494,80 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+// CLASS METHODS
+void Sha224::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_X86_SIMD)
+    if (hashSha256InLanes(results,
+                          k_DIGEST_SIZE,
+                          messages,
+                          lengths,
+                          numMessages,
+                          sha224InitialState)) {
+        return;                                                       // RETURN
+    }
+#endif
+    hashEach<Sha224>(results, messages, lengths, numMessages);
+}
+
+void Sha256::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_X86_SIMD)
+    if (hashSha256InLanes(results,
+                          k_DIGEST_SIZE,
+                          messages,
+                          lengths,
+                          numMessages,
+                          sha256InitialState)) {
+        return;                                                       // RETURN
+    }
+#endif
+    hashEach<Sha256>(results, messages, lengths, numMessages);
+}
+
+void Sha384::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_X86_SIMD)
+    if (hashSha512InLanes(results,
+                          k_DIGEST_SIZE,
+                          messages,
+                          lengths,
+                          numMessages,
+                          sha384InitialState)) {
+        return;                                                       // RETURN
+    }
+#endif
+    hashEach<Sha384>(results, messages, lengths, numMessages);
+}
+
+void Sha512::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_X86_SIMD)
+    if (hashSha512InLanes(results,
+                          k_DIGEST_SIZE,
+                          messages,
+                          lengths,
+                          numMessages,
+                          sha512InitialState)) {
+        return;                                                       // RETURN
+    }
+#endif
+    hashEach<Sha512>(results, messages, lengths, numMessages);
+}
+
+// CREATORS
 Sha224::Sha224()
 {
     reset();
@@ -394,64 +1616,28 @@ void Sha224::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // Second 32 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xc1059ed8;
-    d_state[1] = 0x367cd507;
-    d_state[2] = 0x3070dd17;
-    d_state[3] = 0xf70e5939;
-    d_state[4] = 0xffc00b31;
-    d_state[5] = 0x68581511;
-    d_state[6] = 0x64f98fa7;
-    d_state[7] = 0xbefa4fa4;
+    bsl::copy(sha224InitialState, sha224InitialState + 8, d_state);
 }
 
 void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialState, sha256InitialState + 8, d_state);
 }
 
 void Sha384::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 64 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xcbbb9d5dc1059ed8ULL;
-    d_state[1] = 0x629a292a367cd507ULL;
-    d_state[2] = 0x9159015a3070dd17ULL;
-    d_state[3] = 0x152fecd8f70e5939ULL;
-    d_state[4] = 0x67332667ffc00b31ULL;
-    d_state[5] = 0x8eb44a8768581511ULL;
-    d_state[6] = 0xdb0c2e0d64f98fa7ULL;
-    d_state[7] = 0x47b5481dbefa4fa4ULL;
+    bsl::copy(sha384InitialState, sha384InitialState + 8, d_state);
 }
 
 void Sha512::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 64 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667f3bcc908ULL;
-    d_state[1] = 0xbb67ae8584caa73bULL;
-    d_state[2] = 0x3c6ef372fe94f82bULL;
-    d_state[3] = 0xa54ff53a5f1d36f1ULL;
-    d_state[4] = 0x510e527fade682d1ULL;
-    d_state[5] = 0x9b05688c2b3e6c1fULL;
-    d_state[6] = 0x1f83d9abfb41bd6bULL;
-    d_state[7] = 0x5be0cd19137e2179ULL;
+    bsl::copy(sha512InitialState, sha512InitialState + 8, d_state);
 }
 
 void Sha224::update(const void *message, bsl::size_t length)
@@ -650,6 +1836,96 @@ bsl::ostream& Sha512::print(bsl::ostream& stream) const
     return stream;
 }
 
+                              // ----------------
+                              // struct Sha2_Impl
+                              // ----------------
+
+// CLASS METHODS
+bool Sha2_Impl::isSupported(Implementation implementation,
+                            bsl::size_t    digestSize)
+{
+    BSLS_ASSERT(Sha224::k_DIGEST_SIZE == digestSize
+             || Sha256::k_DIGEST_SIZE == digestSize
+             || Sha384::k_DIGEST_SIZE == digestSize
+             || Sha512::k_DIGEST_SIZE == digestSize);
+
+    switch (implementation) {
+      case e_PORTABLE: {
+        return true;                                                  // RETURN
+      }
+#if defined(BDLDE_SHA2_X86_SIMD)
+      case e_SHA_EXTENSIONS:
+      case e_SHA_EXTENSIONS_LANES: {
+        return digestSize <= Sha256::k_DIGEST_SIZE
+            && transformShaExtensions == sha256Transform();           // RETURN
+      }
+      case e_AVX2_LANES: {
+        return hasAvx2();                                             // RETURN
+      }
+#endif
+      default: {
+        (void)digestSize;
+      } break;
+    }
+    return false;
+}
+
+bool Sha2_Impl::loadDigests(Implementation      implementation,
+                            bsl::size_t         digestSize,
+                            unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    if (!isSupported(implementation, digestSize)) {
+        return false;                                                 // RETURN
+    }
+
+    switch (digestSize) {
+      case Sha224::k_DIGEST_SIZE: {
+        hashWith(implementation,
+                 results,
+                 digestSize,
+                 messages,
+                 lengths,
+                 numMessages,
+                 sha224InitialState);
+      } break;
+      case Sha256::k_DIGEST_SIZE: {
+        hashWith(implementation,
+                 results,
+                 digestSize,
+                 messages,
+                 lengths,
+                 numMessages,
+                 sha256InitialState);
+      } break;
+      case Sha384::k_DIGEST_SIZE: {
+        hashWith(implementation,
+                 results,
+                 digestSize,
+                 messages,
+                 lengths,
+                 numMessages,
+                 sha384InitialState);
+      } break;
+      default: {
+        hashWith(implementation,
+                 results,
+                 digestSize,
+                 messages,
+                 lengths,
+                 numMessages,
+                 sha512InitialState);
+      } break;
+    }
+    return true;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
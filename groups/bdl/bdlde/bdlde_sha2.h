@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2_Impl: computes SHA-2 digests with a chosen implementation
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,13 +26,43 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+// This component additionally defines the struct 'bdlde::Sha2_Impl' to expose
+// the alternative implementations underlying the classes above, which should
+// not be used other than to test and benchmark.
+//
+///Hashing Many Messages
+///---------------------
+// Each class provides a class method, 'loadDigests', that computes the
+// digests of a batch of independent, complete messages (e.g., the records of
+// a file being checksummed, or the leaves of a Merkle tree).  Its results are
+// identical to those of hashing each message in turn with 'update' and
+// 'loadDigest', but, given the whole batch, it can hash several messages at
+// once in the *lanes* of vector registers, which is considerably faster than
+// hashing them one at a time.  It should be preferred whenever more than one
+// message is to be hashed.
+//
+///Performance
+///-----------
+// On x86-64 platforms, the processor features used are determined at runtime.
+// SHA-224 and SHA-256 use the SHA extensions if the processor supports them,
+// both for single messages and, 2 messages at a time, in 'loadDigests'; on
+// processors lacking them, 'loadDigests' hashes 8 messages at a time with
+// AVX2.  SHA-384 and SHA-512 hash single messages with portable code (there
+// are no corresponding instructions for 64-bit words), and 'loadDigests'
+// hashes 4 messages at a time with AVX2.  Other platforms, and processors
+// supporting none of these features, use portable code throughout.  See test
+// case -1 in the test driver for throughput comparisons.
+//
 ///Usage
 ///-----
-// In this section we show intended usage of this component.  The
-// 'validatePassword' function below returns whether a specified password has a
-// specified hash value.  The 'assertPasswordIsExpected' function below has a
-// sample password to hash and a hash value that matches it.  Note that the
-// output of 'loadDigest' is a binary representation.  When hashes are
+// This section illustrates intended use of this component.
+//
+///Example 1: Validating a Password
+/// - - - - - - - - - - - - - - - -
+// The 'validatePassword' function below returns whether a specified password
+// has a specified hash value.  The 'assertPasswordIsExpected' function below
+// has a sample password to hash and a hash value that matches it.  Note that
+// the output of 'loadDigest' is a binary representation.  When hashes are
 // displayed for human consumption, they are typically converted to hex, but
 // that would create unnecessary overhead here.
 //..
@@ -73,6 +104,44 @@ BSLS_IDENT("$Id$ $CSID$")
 //      ASSERT(validatePassword(password, salt, expected));
 //  }
 //..
+//
+///Example 2: Hashing Many Messages
+/// - - - - - - - - - - - - - - - -
+// Suppose that we need to compute the SHA-256 digest of each of a set of
+// records, for instance to detect which of them have changed since they were
+// last stored.
+//
+// First, we gather the addresses and lengths of the records:
+//..
+//  const char *records[] = { "alpha", "bravo", "charlie", "delta", "echo" };
+//  enum { k_NUM_RECORDS = sizeof records / sizeof *records };
+//
+//  const void  *messages[k_NUM_RECORDS];
+//  bsl::size_t  lengths[k_NUM_RECORDS];
+//  for (int i = 0; i < k_NUM_RECORDS; ++i) {
+//      messages[i] = records[i];
+//      lengths[i]  = bsl::strlen(records[i]);
+//  }
+//..
+// Then, we compute all of the digests with a single call:
+//..
+//  unsigned char digests[k_NUM_RECORDS][bdlde::Sha256::k_DIGEST_SIZE];
+//  bdlde::Sha256::loadDigests(digests[0], messages, lengths, k_NUM_RECORDS);
+//..
+// Finally, we verify that each digest is the one we would have obtained by
+// hashing its record alone:
+//..
+//  for (int i = 0; i < k_NUM_RECORDS; ++i) {
+//      bdlde::Sha256 hasher(records[i], lengths[i]);
+//
+//      unsigned char digest[bdlde::Sha256::k_DIGEST_SIZE];
+//      hasher.loadDigest(digest);
+//
+//      ASSERT(bsl::equal(digest,
+//                        digest + bdlde::Sha256::k_DIGEST_SIZE,
+//                        digests[i]));
+//  }
+//..
 
 #include <bdlscm_version.h>
 
@@ -121,6 +190,22 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-224 digests of the
+        // specified 'numMessages' messages, the digest of the message at
+        // 'messages[i]' having the length 'lengths[i]' (in bytes) being
+        // loaded at 'results + i * k_DIGEST_SIZE'.  Messages are hashed
+        // several at a time if the current processor supports it (see
+        // {Hashing Many Messages}).  The behavior is undefined unless
+        // 'results' refers to at least 'numMessages * k_DIGEST_SIZE' bytes,
+        // and the range '[messages[i], messages[i] + lengths[i])' is valid
+        // for every 'i < numMessages'.  Note that 'messages[i]' may be 0 if
+        // 'lengths[i]' is 0.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +286,22 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages, the digest of the message at
+        // 'messages[i]' having the length 'lengths[i]' (in bytes) being
+        // loaded at 'results + i * k_DIGEST_SIZE'.  Messages are hashed
+        // several at a time if the current processor supports it (see
+        // {Hashing Many Messages}).  The behavior is undefined unless
+        // 'results' refers to at least 'numMessages * k_DIGEST_SIZE' bytes,
+        // and the range '[messages[i], messages[i] + lengths[i])' is valid
+        // for every 'i < numMessages'.  Note that 'messages[i]' may be 0 if
+        // 'lengths[i]' is 0.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -281,6 +382,22 @@ class Sha384 {
     static const bsl::size_t k_DIGEST_SIZE = 384 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-384 digests of the
+        // specified 'numMessages' messages, the digest of the message at
+        // 'messages[i]' having the length 'lengths[i]' (in bytes) being
+        // loaded at 'results + i * k_DIGEST_SIZE'.  Messages are hashed
+        // several at a time if the current processor supports it (see
+        // {Hashing Many Messages}).  The behavior is undefined unless
+        // 'results' refers to at least 'numMessages * k_DIGEST_SIZE' bytes,
+        // and the range '[messages[i], messages[i] + lengths[i])' is valid
+        // for every 'i < numMessages'.  Note that 'messages[i]' may be 0 if
+        // 'lengths[i]' is 0.
+
     // CREATORS
     Sha384();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -361,6 +478,22 @@ class Sha512 {
     static const bsl::size_t k_DIGEST_SIZE = 512 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-512 digests of the
+        // specified 'numMessages' messages, the digest of the message at
+        // 'messages[i]' having the length 'lengths[i]' (in bytes) being
+        // loaded at 'results + i * k_DIGEST_SIZE'.  Messages are hashed
+        // several at a time if the current processor supports it (see
+        // {Hashing Many Messages}).  The behavior is undefined unless
+        // 'results' refers to at least 'numMessages * k_DIGEST_SIZE' bytes,
+        // and the range '[messages[i], messages[i] + lengths[i])' is valid
+        // for every 'i < numMessages'.  Note that 'messages[i]' may be 0 if
+        // 'lengths[i]' is 0.
+
     // CREATORS
     Sha512();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -484,6 +617,58 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
     // Write to the specified output 'stream' the specified SHA-2 'digest' and
     // return a reference to the modifiable 'stream'.
 
+                              // ================
+                              // struct Sha2_Impl
+                              // ================
+
+struct Sha2_Impl {
+    // This 'struct' provides a namespace for the alternative implementations
+    // of the SHA-2 compression function that underlie 'update' and
+    // 'loadDigests', so that each can be exercised regardless of which one
+    // the running processor would select.
+
+    // TYPES
+    enum Implementation {
+        e_PORTABLE,              // portable code, one message at a time
+
+        e_SHA_EXTENSIONS,        // x86 SHA extensions, one message at a time
+                                 // (SHA-224 and SHA-256 only)
+
+        e_SHA_EXTENSIONS_LANES,  // x86 SHA extensions, 2 messages at a time
+                                 // (SHA-224 and SHA-256 only)
+
+        e_AVX2_LANES             // AVX2, 8 (SHA-224 and SHA-256) or 4
+                                 // (SHA-384 and SHA-512) messages at a time
+    };
+
+    // CLASS METHODS
+    static bool isSupported(Implementation implementation,
+                            bsl::size_t    digestSize);
+        // Return 'true' if the specified 'implementation' can compute digests
+        // having the specified 'digestSize' on this platform and the running
+        // processor, and 'false' otherwise.  The behavior is undefined unless
+        // 'digestSize' is the 'k_DIGEST_SIZE' of 'Sha224', 'Sha256',
+        // 'Sha384', or 'Sha512'.
+
+    static bool loadDigests(Implementation      implementation,
+                            bsl::size_t         digestSize,
+                            unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the digests, having the specified
+        // 'digestSize', of the specified 'numMessages' messages at the
+        // specified 'messages' having the specified 'lengths', computed with
+        // the specified 'implementation', and return 'true', if
+        // 'isSupported(implementation, digestSize)'.  Otherwise, return
+        // 'false' with no effect.  Messages left alone in the last lanes of a
+        // multi-lane 'implementation' are finished with the single-message
+        // implementation used by 'update'.  The behavior is undefined unless
+        // 'digestSize' is the 'k_DIGEST_SIZE' of 'Sha224', 'Sha256',
+        // 'Sha384', or 'Sha512', and 'results', 'messages', and 'lengths'
+        // are as described for 'Sha256::loadDigests'.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
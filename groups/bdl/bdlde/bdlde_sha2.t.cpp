@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,14 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha224::loadDigests(results, messages, lengths, num);
+// [26] void Sha256::loadDigests(results, messages, lengths, num);
+// [26] void Sha384::loadDigests(results, messages, lengths, num);
+// [26] void Sha512::loadDigests(results, messages, lengths, num);
+// [27] bool Sha2_Impl::isSupported(implementation, digestSize);
+// [27] bool Sha2_Impl::loadDigests(impl, size, results, msgs, lens, num);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +144,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -291,11 +301,14 @@ const char *const sha512Results[6] =
 
 ///Usage
 ///-----
-// In this section we show intended usage of this component.  The
-// 'validatePassword' function below returns whether a specified password has a
-// specified hash value.  The 'assertPasswordIsExpected' function below has a
-// sample password to hash and a hash value that matches it.  Note that the
-// output of 'loadDigest' is a binary representation.  When hashes are
+// This section illustrates intended use of this component.
+//
+///Example 1: Validating a Password
+/// - - - - - - - - - - - - - - - -
+// The 'validatePassword' function below returns whether a specified password
+// has a specified hash value.  The 'assertPasswordIsExpected' function below
+// has a sample password to hash and a hash value that matches it.  Note that
+// the output of 'loadDigest' is a binary representation.  When hashes are
 // displayed for human consumption, they are typically converted to hex, but
 // that would create unnecessary overhead here.
 //..
@@ -420,6 +433,211 @@ void testKnownHashes(const char *const (&expected)[6])
     }
 }
 
+const int k_DEFAULT_IMPLEMENTATION = -1;
+    // value passed to 'testLoadDigests' to test 'HASHER::loadDigests'
+
+template<class HASHER>
+void loadDigests(int                 implementation,
+                 unsigned char      *results,
+                 const void * const *messages,
+                 const bsl::size_t  *lengths,
+                 bsl::size_t         numMessages)
+    // Load into the specified 'results' the digests of the specified
+    // 'numMessages' messages at the specified 'messages' having the specified
+    // 'lengths', using 'HASHER::loadDigests' if the specified
+    // 'implementation' is 'k_DEFAULT_IMPLEMENTATION', and the
+    // 'Sha2_Impl::Implementation' having the value 'implementation'
+    // otherwise.  The behavior is undefined unless the current processor
+    // supports 'implementation'.
+{
+    if (k_DEFAULT_IMPLEMENTATION == implementation) {
+        HASHER::loadDigests(results, messages, lengths, numMessages);
+    }
+    else {
+        ASSERTV(implementation,
+                bdlde::Sha2_Impl::loadDigests(
+                       static_cast<bdlde::Sha2_Impl::Implementation>(
+                                                              implementation),
+                       HASHER::k_DIGEST_SIZE,
+                       results,
+                       messages,
+                       lengths,
+                       numMessages));
+    }
+}
+
+template<class HASHER>
+void testLoadDigests(const char *const (&expected)[6],
+                     int                 implementation =
+                                                     k_DEFAULT_IMPLEMENTATION)
+    // Verify that 'HASHER::loadDigests', or 'Sha2_Impl::loadDigests' with the
+    // optionally specified 'implementation', loads the specified 'expected'
+    // hashes of the known messages, and the same digests as hashing each
+    // message with an instance of 'HASHER', for batches of various numbers of
+    // messages of various lengths and alignments.  The behavior is undefined
+    // unless the current processor supports 'implementation'.
+{
+    enum { k_DIGEST_SIZE = HASHER::k_DIGEST_SIZE };
+
+    // Known messages
+
+    {
+        const bsl::size_t NUM_MESSAGES = arraySize(inputMessages);
+
+        const void    *messages[NUM_MESSAGES];
+        bsl::size_t    lengths[NUM_MESSAGES];
+        unsigned char  results[NUM_MESSAGES][k_DIGEST_SIZE];
+
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            messages[index] = inputMessages[index].data();
+            lengths[index]  = inputMessages[index].size();
+        }
+        loadDigests<HASHER>(implementation,
+                            results[0],
+                            messages,
+                            lengths,
+                            NUM_MESSAGES);
+
+        bsl::string hexDigest;
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            toHex(&hexDigest, results[index]);
+            ASSERTV(implementation, index, hexDigest == expected[index]);
+        }
+    }
+
+    // Generated messages, sharing one buffer so that they are misaligned
+
+    bsl::vector<unsigned char> buffer(8192 + 32);
+    for (bsl::size_t index = 0; index != buffer.size(); ++index) {
+        buffer[index] = static_cast<unsigned char>(index * 131 + index / 7);
+    }
+
+    const int NUM_MESSAGES_LIST[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17,
+                                      20, 33, 100 };
+
+    const bsl::size_t BOUNDARIES[] = { 55, 56, 63, 64, 111, 112, 127, 128 };
+        // lengths at which the padding of 32-bit and 64-bit hashes needs an
+        // extra block, and multiples of the block sizes
+
+    for (bsl::size_t ti = 0; ti != arraySize(NUM_MESSAGES_LIST); ++ti) {
+        const bsl::size_t NUM_MESSAGES = NUM_MESSAGES_LIST[ti];
+
+        for (int mode = 0; mode != 4; ++mode) {
+            // Mode 0: equal lengths around block boundaries; mode 1: lengths
+            // 0 to 300, each message longer than the previous; mode 2: a
+            // pseudo-random mix of lengths; mode 3: one long message among
+            // short ones.
+
+            bsl::vector<const void *>  messages(NUM_MESSAGES + 1);
+            bsl::vector<bsl::size_t>   lengths(NUM_MESSAGES + 1);
+            bsl::vector<unsigned char> results(
+                                        (NUM_MESSAGES + 1) * k_DIGEST_SIZE,
+                                        0xA5);
+
+            unsigned int seed = static_cast<unsigned int>(ti * 4 + mode);
+            for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+                seed = seed * 1103515245 + 12345;
+
+                bsl::size_t length;
+                switch (mode) {
+                  case 0: length = BOUNDARIES[ti % 8];                break;
+                  case 1: length = index * 301 / (NUM_MESSAGES + 1);  break;
+                  case 2: length = (seed >> 8) % 600;                 break;
+                  default: length = 1 == index % 5 ? 8000 : index;
+                }
+
+                messages[index] = &buffer[(seed >> 16) % 32];
+                lengths[index]  = length;
+            }
+            if (NUM_MESSAGES && 0 == lengths[0]) {
+                messages[0] = 0;
+            }
+
+            loadDigests<HASHER>(implementation,
+                                results.data(),
+                                messages.data(),
+                                lengths.data(),
+                                NUM_MESSAGES);
+
+            for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+                unsigned char digest[k_DIGEST_SIZE];
+                HASHER        hasher(messages[index], lengths[index]);
+                hasher.loadDigest(digest);
+
+                ASSERTV(implementation, NUM_MESSAGES, mode, index,
+                        lengths[index],
+                        bsl::equal(digest,
+                                   digest + k_DIGEST_SIZE,
+                                   &results[index * k_DIGEST_SIZE]));
+            }
+
+            // Verify that nothing was written past the last digest.
+
+            ASSERTV(implementation, NUM_MESSAGES, mode,
+                    bsl::count(results.end() - k_DIGEST_SIZE,
+                               results.end(),
+                               0xA5) == k_DIGEST_SIZE);
+        }
+    }
+}
+
+template<class HASHER>
+void reportThroughput(const char *name)
+    // Print to 'cout' the throughput of hashing messages of various lengths
+    // one at a time with an instance of 'HASHER' and in batches with
+    // 'HASHER::loadDigests', labeled with the specified 'name'.
+{
+    enum { k_NUM_MESSAGES = 64 };
+
+    const bsl::size_t LENGTHS[] = { 64, 1024, 64 * 1024 };
+
+    const bsls::Types::Int64 TOTAL = 1 << 28;
+
+    for (bsl::size_t ti = 0; ti != arraySize(LENGTHS); ++ti) {
+        const bsl::size_t        LENGTH     = LENGTHS[ti];
+        const bsls::Types::Int64 ITERATIONS =
+                                           TOTAL / (LENGTH * k_NUM_MESSAGES);
+
+        bsl::vector<char> data(LENGTH * k_NUM_MESSAGES);
+        for (bsl::size_t index = 0; index != data.size(); ++index) {
+            data[index] = static_cast<char>(index * 7);
+        }
+
+        const void    *messages[k_NUM_MESSAGES];
+        bsl::size_t    lengths[k_NUM_MESSAGES];
+        unsigned char  results[k_NUM_MESSAGES][HASHER::k_DIGEST_SIZE];
+        for (int index = 0; index != k_NUM_MESSAGES; ++index) {
+            messages[index] = &data[index * LENGTH];
+            lengths[index]  = LENGTH;
+        }
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+            for (int index = 0; index != k_NUM_MESSAGES; ++index) {
+                HASHER hasher(messages[index], LENGTH);
+                hasher.loadDigest(results[index]);
+            }
+        }
+        timer.stop();
+        const double single = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+            HASHER::loadDigests(results[0], messages, lengths, k_NUM_MESSAGES);
+        }
+        timer.stop();
+        const double many = timer.accumulatedWallTime();
+
+        const double MB = static_cast<double>(TOTAL) / 1e6;
+        cout << name << ", " << LENGTH << "-byte messages: "
+             << MB / single << " MB/s one at a time, "
+             << MB / many   << " MB/s with 'loadDigests'\n";
+    }
+}
+
 template<class HASHER, bsl::size_t LENGTH>
 void testLoadDigestAndReset(const char (&message)[LENGTH])
     // Test the member function 'loadDigestAndReset' after updating the digest
@@ -509,7 +727,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -520,7 +738,8 @@ int main(int argc, char *argv[])
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example function 'assertPasswordIsExpected'.
+        //   Run the usage example function 'assertPasswordIsExpected', and
+        //   the code of the second usage example.
         //
         // Testing:
         //   Usage example.
@@ -530,6 +749,206 @@ int main(int argc, char *argv[])
                           << "=====================" "\n";
 
         assertPasswordIsExpected();
+
+///Example 2: Hashing Many Messages
+/// - - - - - - - - - - - - - - - -
+// Suppose that we need to compute the SHA-256 digest of each of a set of
+// records, for instance to detect which of them have changed since they were
+// last stored.
+//
+// First, we gather the addresses and lengths of the records:
+//..
+        const char *records[] = { "alpha", "bravo", "charlie", "delta",
+                                  "echo" };
+        enum { k_NUM_RECORDS = sizeof records / sizeof *records };
+
+        const void  *messages[k_NUM_RECORDS];
+        bsl::size_t  lengths[k_NUM_RECORDS];
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            messages[i] = records[i];
+            lengths[i]  = bsl::strlen(records[i]);
+        }
+//..
+// Then, we compute all of the digests with a single call:
+//..
+        unsigned char digests[k_NUM_RECORDS][bdlde::Sha256::k_DIGEST_SIZE];
+        bdlde::Sha256::loadDigests(digests[0],
+                                   messages,
+                                   lengths,
+                                   k_NUM_RECORDS);
+//..
+// Finally, we verify that each digest is the one we would have obtained by
+// hashing its record alone:
+//..
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bdlde::Sha256 hasher(records[i], lengths[i]);
+
+            unsigned char digest[bdlde::Sha256::k_DIGEST_SIZE];
+            hasher.loadDigest(digest);
+
+            ASSERT(bsl::equal(digest,
+                              digest + bdlde::Sha256::k_DIGEST_SIZE,
+                              digests[i]));
+        }
+//..
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha2_Impl'
+        //
+        // Concerns:
+        //: 1 Each implementation (the portable and SHA-extensions transforms,
+        //:   and the SHA-extensions and AVX2 lane kernels) computes the known
+        //:   hashes of the known messages, for every digest size it supports,
+        //:   whichever implementation the running processor would select.
+        //:
+        //: 2 Each implementation computes the same digests as the others for
+        //:   batches of various numbers of messages of various lengths and
+        //:   alignments.
+        //:
+        //: 3 'isSupported' reports the portable implementation as supported
+        //:   for every digest size, and the SHA-extensions implementations as
+        //:   unsupported for SHA-384 and SHA-512.
+        //:
+        //: 4 'loadDigests' returns 'false' for an unsupported implementation.
+        //
+        // Plan:
+        //: 1 For each implementation supported by the running processor, and
+        //:   each digest size, repeat the checks of case 26 with
+        //:   'Sha2_Impl::loadDigests', which compare its digests with the
+        //:   known hashes and with those computed by 'loadDigest'.  (C-1..2)
+        //:
+        //: 2 Verify the expected results of 'isSupported', and that
+        //:   'loadDigests' returns 'false' for each unsupported combination.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   bool Sha2_Impl::isSupported(implementation, digestSize);
+        //   bool Sha2_Impl::loadDigests(impl, size, results, msgs, lens, num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha2_Impl'" "\n"
+                          << "===================" "\n";
+
+        typedef bdlde::Sha2_Impl Impl;
+
+        const struct {
+            Impl::Implementation  d_implementation;
+            const char           *d_name_p;
+        } IMPLEMENTATIONS[] = {
+            { Impl::e_PORTABLE,             "e_PORTABLE"             },
+            { Impl::e_SHA_EXTENSIONS,       "e_SHA_EXTENSIONS"       },
+            { Impl::e_SHA_EXTENSIONS_LANES, "e_SHA_EXTENSIONS_LANES" },
+            { Impl::e_AVX2_LANES,           "e_AVX2_LANES"           }
+        };
+
+        const bsl::size_t DIGEST_SIZES[] = { bdlde::Sha224::k_DIGEST_SIZE,
+                                             bdlde::Sha256::k_DIGEST_SIZE,
+                                             bdlde::Sha384::k_DIGEST_SIZE,
+                                             bdlde::Sha512::k_DIGEST_SIZE };
+
+        for (bsl::size_t ti = 0; ti != arraySize(IMPLEMENTATIONS); ++ti) {
+            const Impl::Implementation IMPL =
+                                          IMPLEMENTATIONS[ti].d_implementation;
+            const char *const          NAME = IMPLEMENTATIONS[ti].d_name_p;
+
+            for (bsl::size_t si = 0; si != arraySize(DIGEST_SIZES); ++si) {
+                const bsl::size_t SIZE      = DIGEST_SIZES[si];
+                const bool        SUPPORTED = Impl::isSupported(IMPL, SIZE);
+
+                if (verbose) {
+                    cout << NAME << ", " << SIZE * 8 << " bits: "
+                         << (SUPPORTED ? "testing" : "not supported") << '\n';
+                }
+
+                if (Impl::e_PORTABLE == IMPL) {
+                    ASSERTV(NAME, SIZE, SUPPORTED);
+                }
+                if (Impl::e_SHA_EXTENSIONS       == IMPL
+                 || Impl::e_SHA_EXTENSIONS_LANES == IMPL) {
+                    ASSERTV(NAME, SIZE,
+                            !SUPPORTED
+                                  || SIZE <= bdlde::Sha256::k_DIGEST_SIZE);
+                }
+
+                if (!SUPPORTED) {
+                    const char     *message = "abc";
+                    bsl::size_t     length  = 3;
+                    const void     *address = message;
+                    unsigned char   result[bdlde::Sha512::k_DIGEST_SIZE];
+
+                    ASSERTV(NAME, SIZE, !Impl::loadDigests(IMPL,
+                                                           SIZE,
+                                                           result,
+                                                           &address,
+                                                           &length,
+                                                           1));
+                    continue;                                       // CONTINUE
+                }
+
+                switch (SIZE) {
+                  case bdlde::Sha224::k_DIGEST_SIZE: {
+                    testLoadDigests<bdlde::Sha224>(sha224Results, IMPL);
+                  } break;
+                  case bdlde::Sha256::k_DIGEST_SIZE: {
+                    testLoadDigests<bdlde::Sha256>(sha256Results, IMPL);
+                  } break;
+                  case bdlde::Sha384::k_DIGEST_SIZE: {
+                    testLoadDigests<bdlde::Sha384>(sha384Results, IMPL);
+                  } break;
+                  default: {
+                    testLoadDigests<bdlde::Sha512>(sha512Results, IMPL);
+                  } break;
+                }
+            }
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' loads the known hashes of the known messages.
+        //:
+        //: 2 'loadDigests' loads the digest of each message that hashing it
+        //:   alone would produce, whatever the number of messages in the
+        //:   batch, their lengths (in particular around block boundaries,
+        //:   where the padding spills into an extra block), their alignment,
+        //:   and the order in which they complete.
+        //:
+        //: 3 'loadDigests' writes nothing past the digest of the last
+        //:   message, and accepts an empty batch.
+        //:
+        //: 4 A message of length 0 may have a null address.
+        //
+        // Plan:
+        //: 1 Hash the known messages in a single batch, and compare the
+        //:   digests with the known hashes.  (C-1)
+        //:
+        //: 2 For batches of 0 to 100 messages taken at various offsets in a
+        //:   buffer, having equal lengths, increasing lengths from 0 to 300
+        //:   bytes, pseudo-random lengths, and a few long messages among
+        //:   short ones, compare the digests with those computed by
+        //:   'loadDigest', and verify that the bytes following the last
+        //:   digest are unchanged.  Use a null address for the first message
+        //:   when its length is 0.  (C-2..4)
+        //:
+        //: 3 Repeat for each of the four classes.  (C-1..4)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(results, messages, lengths, num);
+        //   void Sha256::loadDigests(results, messages, lengths, num);
+        //   void Sha384::loadDigests(results, messages, lengths, num);
+        //   void Sha512::loadDigests(results, messages, lengths, num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                          << "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>(sha224Results);
+        testLoadDigests<bdlde::Sha256>(sha256Results);
+        testLoadDigests<bdlde::Sha384>(sha384Results);
+        testLoadDigests<bdlde::Sha512>(sha512Results);
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -1250,6 +1669,31 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of hashing messages one at a time and with
+        //:   'loadDigests'.
+        //
+        // Plan:
+        //: 1 For each class and each of several message lengths, time the
+        //:   hashing of about 256 MB of data in batches of 64 messages, one
+        //:   message at a time and with 'loadDigests'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TEST: THROUGHPUT" "\n"
+                          << "============================" "\n";
+
+        reportThroughput<bdlde::Sha224>("SHA-224");
+        reportThroughput<bdlde::Sha256>("SHA-256");
+        reportThroughput<bdlde::Sha384>("SHA-384");
+        reportThroughput<bdlde::Sha512>("SHA-512");
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
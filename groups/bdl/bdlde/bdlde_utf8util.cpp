@@ -12,8 +12,29 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) && defined(__SSSE3__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_UTF8UTIL_X86_SIMD
+#endif
+#endif
+
+#if defined(BDLDE_UTF8UTIL_X86_SIMD)
+#include <immintrin.h>
+
+#define BDLDE_UTF8UTIL_TARGET_AVX2 __attribute__((target("avx2")))
+    // Allow the AVX2 instruction set in the annotated function only, so that
+    // the rest of the component runs on processors without it.
+#endif
 
 // LOCAL MACROS
 
@@ -400,6 +421,406 @@ static int validateAndCountCodePoints(const char             **invalidString,
 }
 
 
+#if defined(BDLDE_UTF8UTIL_X86_SIMD)
+
+// The vectorized validation below is the "lookup" algorithm described in
+// Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"
+// (Software: Practice and Experience, 2021).  Every byte is checked together
+// with the (up to) three bytes preceding it: three 16-entry tables, indexed by
+// the high and low nibbles of the preceding byte and by the high nibble of the
+// byte itself, each yield a set of the error kinds (below) that the pair of
+// bytes may exhibit, so that the bitwise AND of the three sets is the set of
+// errors the pair does exhibit.  Only the requirement that the second byte
+// after a 3- or 4-byte lead, or the third after a 4-byte lead, be a
+// continuation is not visible from adjacent bytes; it is checked separately,
+// and the continuation bytes it accounts for are flagged by the tables as
+// 'k_TWO_CONTS', so that the two are combined with an XOR.  Blocks are
+// independent except that the last three bytes of each block are carried
+// into the next, and a block of ASCII needs only to check that its
+// predecessor did not end in the middle of a sequence.
+//
+// The vectorized loop reports only which block contains the first error, so
+// the scalar 'validateAndCountCodePoints' is resumed a few bytes before that
+// block to compute the exact position of the invalid sequence (and to process
+// the final partial block).
+
+enum {
+    // Kinds of errors detected by the tables of the vectorized validation.
+    // Note that 'k_TOO_LARGE_1000' and 'k_OVERLONG_4' can share a bit, since
+    // they are never both possible for the same lead byte.
+
+    k_TOO_SHORT      = 1 << 0,  // lead byte not followed by a continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII followed by a continuation
+    k_OVERLONG_3     = 1 << 2,  // 'e0' followed by '80 .. 9f'
+    k_TOO_LARGE      = 1 << 3,  // 'f4' followed by '90 .. bf', or 'f5 .. ff'
+    k_SURROGATE      = 1 << 4,  // 'ed' followed by 'a0 .. bf'
+    k_OVERLONG_2     = 1 << 5,  // 'c0' or 'c1' followed by a continuation
+    k_TOO_LARGE_1000 = 1 << 6,  // 'f5 .. ff' followed by '80 .. 8f'
+    k_OVERLONG_4     = 1 << 6,  // 'f0' followed by '80 .. 8f'
+    k_TWO_CONTS      = 1 << 7,  // a continuation following a continuation
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+static const unsigned char k_PREVIOUS_HIGH_NIBBLE[16] = {
+    // errors possible after a byte, indexed by the byte's high nibble
+
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,        // ASCII
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,    // continuation
+    k_TOO_SHORT | k_OVERLONG_2,                            // 'c0 .. cf'
+    k_TOO_SHORT,                                           // 'd0 .. df'
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,              // 'e0 .. ef'
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+                                                           // 'f0 .. ff'
+};
+
+static const unsigned char k_PREVIOUS_LOW_NIBBLE[16] = {
+    // errors possible after a byte, indexed by the byte's low nibble
+
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,  // 'x0'
+    k_CARRY | k_OVERLONG_2,                                // 'x1'
+    k_CARRY,                                               // 'x2'
+    k_CARRY,                                               // 'x3'
+    k_CARRY | k_TOO_LARGE,                                 // 'x4'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'x5'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'x6'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'x7'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'x8'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'x9'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'xa'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'xb'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'xc'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE,
+                                                           // 'xd'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,              // 'xe'
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000               // 'xf'
+};
+
+static const unsigned char k_CURRENT_HIGH_NIBBLE[16] = {
+    // errors possible for a byte, indexed by the byte's high nibble
+
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,    // ASCII
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                        | k_TOO_LARGE_1000 | k_OVERLONG_4, // '80 .. 8f'
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                                         | k_TOO_LARGE,    // '90 .. 9f'
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE
+                                         | k_TOO_LARGE,    // 'a0 .. af'
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE
+                                         | k_TOO_LARGE,    // 'b0 .. bf'
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT     // lead bytes
+};
+
+static inline
+__m128i loadTable(const unsigned char *table)
+    // Return the 16 bytes at the specified 'table'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+}
+
+static
+bool hasAvx2()
+    // Return 'true' if the current processor supports AVX2, and 'false'
+    // otherwise.  The processor is queried only on the first call.
+{
+    static bool s_hasAvx2 = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        s_hasAvx2 = __builtin_cpu_supports("avx2");
+    }
+
+    return s_hasAvx2;
+}
+
+static inline
+__m128i checkBlock(__m128i input, __m128i previous)
+    // Return a vector that is non-zero if the specified 'input' block,
+    // preceded by the specified 'previous' block, contains an invalid UTF-8
+    // sequence other than one that is incomplete at the end of 'input', and
+    // zero otherwise.
+{
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i prevHigh = _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble);
+    const __m128i prevLow  = _mm_and_si128(prev1, nibble);
+    const __m128i high     = _mm_and_si128(_mm_srli_epi16(input, 4), nibble);
+
+    const __m128i special = _mm_and_si128(
+        _mm_and_si128(_mm_shuffle_epi8(loadTable(k_PREVIOUS_HIGH_NIBBLE),
+                                       prevHigh),
+                      _mm_shuffle_epi8(loadTable(k_PREVIOUS_LOW_NIBBLE),
+                                       prevLow)),
+        _mm_shuffle_epi8(loadTable(k_CURRENT_HIGH_NIBBLE), high));
+
+    const __m128i third  = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+    const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+    const __m128i mustBeContinuation = _mm_and_si128(
+                                             _mm_or_si128(third, fourth),
+                                             _mm_set1_epi8(-0x80));
+
+    return _mm_xor_si128(mustBeContinuation, special);
+}
+
+static
+const char *validateBlocks(bsls::Types::IntPtr *count,
+                           const char          *string,
+                           const char          *end)
+    // Validate the 16-byte blocks of the specified 'string' up to the
+    // specified 'end', stopping at the first block containing an invalid
+    // sequence, and load into the specified 'count' the number of bytes of the
+    // validated blocks that are not continuation bytes.  Return the address
+    // of the first block not validated.  Note that the last 3 bytes before the
+    // returned address may begin a sequence that is incomplete.
+{
+    const __m128i incompleteMax = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1,
+                                                -1, -1, -1, -1, -1, -1,
+                                                0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+    const __m128i lastContinuation = _mm_set1_epi8(-65);  // 'bf'
+    const __m128i zero             = _mm_setzero_si128();
+
+    __m128i previous   = zero;
+    __m128i incomplete = zero;
+
+    bsls::Types::IntPtr numCodePoints = 0;
+
+    const char *pc = string;
+    for (; end - pc >= 16; pc += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(pc));
+
+        __m128i error;
+        int     numLeadBytes;
+        if (0 == _mm_movemask_epi8(input)) {
+            error        = incomplete;
+            incomplete   = zero;
+            numLeadBytes = 16;
+        }
+        else {
+            error        = checkBlock(input, previous);
+            incomplete   = _mm_subs_epu8(input, incompleteMax);
+            numLeadBytes = bdlb::BitUtil::numBitsSet(
+                         static_cast<bsl::uint32_t>(_mm_movemask_epi8(
+                               _mm_cmpgt_epi8(input, lastContinuation))));
+        }
+
+        if (UNLIKELY(0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error,
+                                                                zero)))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            break;
+        }
+
+        numCodePoints += numLeadBytes;
+        previous       = input;
+    }
+
+    *count = numCodePoints;
+    return pc;
+}
+
+BDLDE_UTF8UTIL_TARGET_AVX2 static inline
+__m256i checkBlockAvx2(__m256i input, __m256i previous)
+    // Return a vector that is non-zero if the specified 'input' block,
+    // preceded by the specified 'previous' block, contains an invalid UTF-8
+    // sequence other than one that is incomplete at the end of 'input', and
+    // zero otherwise.  The behavior is undefined unless the current processor
+    // supports AVX2.
+{
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+    const __m256i straddle = _mm256_permute2x128_si256(previous, input, 0x21);
+    const __m256i prev1    = _mm256_alignr_epi8(input, straddle, 15);
+    const __m256i prev2    = _mm256_alignr_epi8(input, straddle, 14);
+    const __m256i prev3    = _mm256_alignr_epi8(input, straddle, 13);
+
+    const __m256i prevHigh = _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                              nibble);
+    const __m256i prevLow  = _mm256_and_si256(prev1, nibble);
+    const __m256i high     = _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                              nibble);
+
+    const __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+                                     loadTable(k_PREVIOUS_HIGH_NIBBLE)),
+                                prevHigh),
+            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+                                     loadTable(k_PREVIOUS_LOW_NIBBLE)),
+                                prevLow)),
+        _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+                                     loadTable(k_CURRENT_HIGH_NIBBLE)),
+                            high));
+
+    const __m256i third  = _mm256_subs_epu8(prev2,
+                                            _mm256_set1_epi8(0xe0 - 0x80));
+    const __m256i fourth = _mm256_subs_epu8(prev3,
+                                            _mm256_set1_epi8(0xf0 - 0x80));
+    const __m256i mustBeContinuation = _mm256_and_si256(
+                                             _mm256_or_si256(third, fourth),
+                                             _mm256_set1_epi8(-0x80));
+
+    return _mm256_xor_si256(mustBeContinuation, special);
+}
+
+BDLDE_UTF8UTIL_TARGET_AVX2 static
+const char *validateBlocksAvx2(bsls::Types::IntPtr *count,
+                               const char          *string,
+                               const char          *end)
+    // Validate the 32-byte blocks of the specified 'string' up to the
+    // specified 'end', stopping at the first block containing an invalid
+    // sequence, and load into the specified 'count' the number of bytes of the
+    // validated blocks that are not continuation bytes.  Return the address
+    // of the first block not validated.  The behavior is undefined unless the
+    // current processor supports AVX2.  Note that the last 3 bytes before the
+    // returned address may begin a sequence that is incomplete.
+{
+    const __m256i incompleteMax = _mm256_setr_epi8(
+                                   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                   -1, -1, -1, -1, -1, -1, -1,
+                                   0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+    const __m256i lastContinuation = _mm256_set1_epi8(-65);  // 'bf'
+    const __m256i zero             = _mm256_setzero_si256();
+
+    __m256i previous   = zero;
+    __m256i incomplete = zero;
+
+    bsls::Types::IntPtr numCodePoints = 0;
+
+    const char *pc = string;
+    for (; end - pc >= 32; pc += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                        reinterpret_cast<const __m256i *>(pc));
+
+        __m256i error;
+        int     numLeadBytes;
+        if (0 == _mm256_movemask_epi8(input)) {
+            error        = incomplete;
+            incomplete   = zero;
+            numLeadBytes = 32;
+        }
+        else {
+            error        = checkBlockAvx2(input, previous);
+            incomplete   = _mm256_subs_epu8(input, incompleteMax);
+            numLeadBytes = bdlb::BitUtil::numBitsSet(
+                         static_cast<bsl::uint32_t>(_mm256_movemask_epi8(
+                               _mm256_cmpgt_epi8(input, lastContinuation))));
+        }
+
+        if (UNLIKELY(!_mm256_testz_si256(error, error))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            break;
+        }
+
+        numCodePoints += numLeadBytes;
+        previous       = input;
+    }
+
+    *count = numCodePoints;
+    return pc;
+}
+
+static inline
+int numLeadingAsciiBytes(const char *string)
+    // Return the number of ASCII bytes at the start of the 32 bytes at the
+    // specified 'string', or 32 if they are all ASCII.
+{
+    const __m128i low  = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(string));
+    const __m128i high = _mm_loadu_si128(
+                               reinterpret_cast<const __m128i *>(string + 16));
+
+    const bsl::uint32_t mask =
+                   static_cast<bsl::uint32_t>(_mm_movemask_epi8(low))
+                 | static_cast<bsl::uint32_t>(_mm_movemask_epi8(high)) << 16;
+
+    return 0 == mask ? 32 : bdlb::BitUtil::numTrailingUnsetBits(mask);
+}
+
+#endif  // BDLDE_UTF8UTIL_X86_SIMD
+
+static
+bsls::Types::IntPtr validateAndCountCodePointsFast(
+                                     const char             **invalidString,
+                                     const char              *string,
+                                     bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' (in bytes) if 'string' contains valid
+    // UTF-8, with no effect on the specified 'invalidString'.  Otherwise,
+    // return a negative value and load into 'invalidString' the address of the
+    // first byte in 'string' that does not constitute the start of a valid
+    // UTF-8 encoding.  Validate blocks of 'string' with SIMD instructions if
+    // they are available, producing the same result as the overload of
+    // 'validateAndCountCodePoints' taking a length.
+{
+#if defined(BDLDE_UTF8UTIL_X86_SIMD)
+    if (length >= 16) {
+        const char *const end = string + length;
+
+        bsls::Types::IntPtr count;
+        const char *pc = hasAvx2()
+                         ? validateBlocksAvx2(&count, string, end)
+                         : validateBlocks(&count, string, end);
+
+        if (pc != string) {
+            // Every sequence ending before the last 3 bytes of the validated
+            // blocks is valid, so resume at the first sequence starting in
+            // the last 4 bytes.
+
+            const char *resume = pc - 4;
+            while (!isNotContinuation(*resume)) {
+                ++resume;
+            }
+            for (const char *pl = resume; pl < pc; ++pl) {
+                count -= isNotContinuation(*pl);
+            }
+
+            const int rest = validateAndCountCodePoints(invalidString,
+                                                        resume,
+                                                        end - resume);
+            return rest < 0 ? rest : count + rest;                    // RETURN
+        }
+    }
+#endif
+
+    return validateAndCountCodePoints(invalidString, string, length);
+}
+
+static
+bsls::Types::IntPtr validateAndCountCodePointsFast(
+                                               const char **invalidString,
+                                               const char  *string)
+    // Return the number of Unicode code points in the specified
+    // null-terminated 'string' if it contains valid UTF-8, with no effect on
+    // the specified 'invalidString'.  Otherwise, return a negative value and
+    // load into 'invalidString' the address of the first sequence in 'string'
+    // that does not constitute the start of a valid UTF-8 encoding.  Validate
+    // blocks of 'string' with SIMD instructions if they are available,
+    // producing the same result as the overload of
+    // 'validateAndCountCodePoints' taking a null-terminated string.
+{
+#if defined(BDLDE_UTF8UTIL_X86_SIMD)
+    // The terminating null byte ends the string wherever it appears, even
+    // within a multi-byte sequence, so measuring the string first yields the
+    // same result.
+
+    const bsl::size_t length = bsl::strlen(string);
+    if (length >= 16) {
+        return validateAndCountCodePointsFast(invalidString,
+                                              string,
+                                              length);                // RETURN
+    }
+#endif
+
+    return validateAndCountCodePoints(invalidString, string);
+}
+
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -654,6 +1075,17 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
           case 7: {
             // binary: 0xxxxxxx: ASCII and possible '\0'
 
+#if defined(BDLDE_UTF8UTIL_X86_SIMD)
+            // Skip the whole run of ASCII (up to 32 bytes) starting here.
+            // Note that the loop increment accounts for one code point.
+
+            if (endOfInput - string >= 32 && numCodePoints - ret >= 32) {
+                const int numAscii = numLeadingAsciiBytes(string);
+
+                next  = string + numAscii;
+                ret  += numAscii - 1;
+            }
+#endif
           } continue;
 
           case 8:
@@ -1038,7 +1470,7 @@ bool Utf8Util::isValid(const char **invalidString, const char *string)
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string) >= 0;
+    return validateAndCountCodePointsFast(invalidString, string) >= 0;
 }
 
 bool Utf8Util::isValid(const char **invalidString,
@@ -1049,7 +1481,7 @@ bool Utf8Util::isValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length) >= 0;
+    return validateAndCountCodePointsFast(invalidString, string, length) >= 0;
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1058,7 +1490,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string);
+    return validateAndCountCodePointsFast(invalidString, string);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1069,7 +1501,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length);
+    return validateAndCountCodePointsFast(invalidString, string, length);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string)
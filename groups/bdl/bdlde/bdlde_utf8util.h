@@ -59,6 +59,13 @@ BSLS_IDENT("$Id: $")
 // explicit length argument.  Naturally, null-terminated C-style strings cannot
 // contain embedded null code points.
 //
+// On x86-64 platforms, 'isValid' and 'numCodePointsIfValid' validate their
+// input 16 bytes at a time using SSSE3 instructions, or 32 bytes at a time if
+// the running processor supports AVX2 (which is determined at runtime), and
+// 'advanceIfValid', when passed the length of its input, skips runs of ASCII
+// up to 32 bytes at a time.  The results, including the reported position of
+// any invalid sequence, are the same on all platforms.
+//
 // The UTF-8 format is described in the RFC 3629 document at:
 //..
 //  http://tools.ietf.org/html/rfc3629
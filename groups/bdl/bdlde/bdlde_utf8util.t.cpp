@@ -14,6 +14,7 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -57,6 +58,8 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test validation, counting, and advancing on input long
+//:   enough to be processed in blocks.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
@@ -97,11 +100,13 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [13] TESTING LONG INPUT
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE TEST: VALIDATION THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2802,7 +2807,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +2918,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3012,6 +3017,221 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING LONG INPUT
+        //
+        // Concerns:
+        //: 1 'isValid' and 'numCodePointsIfValid' accept, and correctly count
+        //:   the code points of, valid input of any length, whatever the
+        //:   mix of ASCII and multi-byte sequences and wherever the
+        //:   sequences fall relative to the blocks validated at once.
+        //:
+        //: 2 They report the position of the first invalid sequence, of every
+        //:   kind, wherever it falls relative to those blocks, including when
+        //:   it straddles two blocks, follows a long run of ASCII, or is
+        //:   truncated by the end of the input.
+        //:
+        //: 3 'advanceIfValid' advances by the requested number of code points
+        //:   through input containing long runs of ASCII, however that
+        //:   number and the end of the input fall relative to the runs, and
+        //:   stops at the first invalid sequence.
+        //
+        // Plan:
+        //: 1 Build strings from a prefix of random valid code points or of
+        //:   ASCII, of every length up to several blocks, followed by one of a
+        //:   table of invalid sequences (or none) and a suffix of random
+        //:   valid code points (or none).  Verify the results of 'isValid' and
+        //:   'numCodePointsIfValid', with and without a length, against the
+        //:   known number of code points and position of the invalid
+        //:   sequence.  (C-1..2)
+        //:
+        //: 2 Build strings of random valid code points separated by runs of
+        //:   ASCII of various lengths, recording the position of each code
+        //:   point, and verify the result of 'advanceIfValid' for every
+        //:   number of code points, with and without an invalid sequence at
+        //:   the end.  (C-3)
+        //
+        // Testing:
+        //   bool isValid(const char **err, const char *s);
+        //   bool isValid(const char **err, const char *s, int len);
+        //   int numCodePointsIfValid(**err, const char *s);
+        //   int numCodePointsIfValid(**err, const char *s, int len);
+        //   int advanceIfValid(int *, const char **, const char *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING LONG INPUT\n"
+                             "==================\n";
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_invalid;   // invalid sequence
+            bool        d_atEnd;     // invalid only at the end of input
+        } DATA[] = {
+            //LINE  INVALID SEQUENCE              AT END
+            //----  ----------------------------  ------
+            { L_,   "",                           false },  // valid
+            { L_,   "\x80",                       false },
+            { L_,   "\xbf",                       false },
+            { L_,   "\xc0\x80",                   false },
+            { L_,   "\xc1\xbf",                   false },
+            { L_,   "\xc2" "a",                   false },
+            { L_,   "\xdf\xc2\x80",               false },
+            { L_,   "\xe0\x80\x80",               false },
+            { L_,   "\xe0\x9f\xbf",               false },
+            { L_,   "\xed\xa0\x80",               false },
+            { L_,   "\xed\xbf\xbf",               false },
+            { L_,   "\xe1" "a",                   false },
+            { L_,   "\xe1\x80" "a",               false },
+            { L_,   "\xef\xbf\xc2\x80",           false },
+            { L_,   "\xf0\x80\x80\x80",           false },
+            { L_,   "\xf0\x8f\xbf\xbf",           false },
+            { L_,   "\xf4\x90\x80\x80",           false },
+            { L_,   "\xf5\x80\x80\x80",           false },
+            { L_,   "\xf7\xbf\xbf\xbf",           false },
+            { L_,   "\xf8\x88\x80\x80\x80",       false },
+            { L_,   "\xff",                       false },
+            { L_,   "\xf1" "a",                   false },
+            { L_,   "\xf1\x80" "a",               false },
+            { L_,   "\xf1\x80\x80" "a",           false },
+            { L_,   "\xc2",                       true  },
+            { L_,   "\xe1\x80",                   true  },
+            { L_,   "\xf1\x80\x80",               true  },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        if (verbose) cout << "Validating and counting.\n";
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const bsl::string INVALID = DATA[ti].d_invalid;
+            const bool        AT_END  = DATA[ti].d_atEnd;
+            const bool        VALID   = INVALID.empty();
+
+            for (int ascii = 0; ascii < 2; ++ascii) {
+                for (int numPrefix = 0; numPrefix < 100; ++numPrefix) {
+                    for (int numSuffix = 0; numSuffix < (AT_END ? 1 : 60);
+                                                       numSuffix += 59) {
+                        bsl::string str;
+                        for (int i = 0; i < numPrefix; ++i) {
+                            if (ascii) {
+                                appendRand1Byte(&str);
+                            }
+                            else {
+                                appendRandCorrectCodePoint(&str, false);
+                            }
+                        }
+                        const size_t POSITION = str.length();
+
+                        str += INVALID;
+                        for (int i = 0; i < numSuffix; ++i) {
+                            appendRandCorrectCodePoint(&str, false);
+                        }
+
+                        const char *const STR = str.c_str();
+                        const int         LEN = static_cast<int>(
+                                                                str.length());
+
+                        const char *err = 0;
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID == Obj::isValid(&err, STR, LEN));
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID ? 0 == err : STR + POSITION == err);
+
+                        err = 0;
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID == Obj::isValid(&err, STR));
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID ? 0 == err : STR + POSITION == err);
+
+                        const Obj::IntPtr EXPECTED = VALID
+                                                     ? numPrefix + numSuffix
+                                                     : -1;
+
+                        err = 0;
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                EXPECTED ==
+                                    Obj::numCodePointsIfValid(&err, STR, LEN));
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID ? 0 == err : STR + POSITION == err);
+
+                        err = 0;
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                EXPECTED ==
+                                         Obj::numCodePointsIfValid(&err, STR));
+                        ASSERTV(LINE, ascii, numPrefix, numSuffix,
+                                VALID ? 0 == err : STR + POSITION == err);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Advancing.\n";
+
+        static const int RUNS[] = { 0, 1, 15, 31, 32, 33, 64, 100 };
+        enum { NUM_RUNS = sizeof RUNS / sizeof *RUNS };
+
+        for (int ri = 0; ri < NUM_RUNS; ++ri) {
+            for (int rj = 0; rj < NUM_RUNS; ++rj) {
+                const int RUN1 = RUNS[ri];
+                const int RUN2 = RUNS[rj];
+
+                // Build 'RUN1' ASCII bytes, a multi-byte code point, 'RUN2'
+                // ASCII bytes, and another multi-byte code point, recording
+                // where each code point starts.
+
+                bsl::string      str;
+                bsl::vector<int> starts;
+                for (int part = 0; part < 2; ++part) {
+                    const int RUN = part ? RUN2 : RUN1;
+                    for (int i = 0; i < RUN; ++i) {
+                        starts.push_back(static_cast<int>(str.length()));
+                        appendRand1Byte(&str);
+                    }
+                    starts.push_back(static_cast<int>(str.length()));
+                    appendRand3Byte(&str);
+                }
+                const int NUM_CODE_POINTS = static_cast<int>(starts.size());
+                starts.push_back(static_cast<int>(str.length()));
+
+                for (int invalid = 0; invalid < 2; ++invalid) {
+                    const bsl::string STR = invalid ? str + "\xff" : str;
+                    const int         LEN = static_cast<int>(STR.length());
+
+                    for (int n = 0; n <= NUM_CODE_POINTS + 1; ++n) {
+                        const int EXPECTED = bsl::min(n, NUM_CODE_POINTS);
+                        const int STATUS   = invalid && n > NUM_CODE_POINTS;
+
+                        int         status = -2;
+                        const char *result = 0;
+                        const int   rc     = static_cast<int>(
+                                          Obj::advanceIfValid(&status,
+                                                              &result,
+                                                              STR.data(),
+                                                              LEN,
+                                                              n));
+                        ASSERTV(RUN1, RUN2, invalid, n, rc, EXPECTED == rc);
+                        ASSERTV(RUN1, RUN2, invalid, n, status,
+                                STATUS == (0 != status));
+                        ASSERTV(RUN1, RUN2, invalid, n,
+                                STR.data() + starts[EXPECTED] == result);
+
+                        status = -2;
+                        result = 0;
+                        ASSERTV(RUN1, RUN2, invalid, n,
+                                EXPECTED == Obj::advanceIfValid(&status,
+                                                                &result,
+                                                                STR.c_str(),
+                                                                n));
+                        ASSERTV(RUN1, RUN2, invalid, n, status,
+                                STATUS == (0 != status));
+                        ASSERTV(RUN1, RUN2, invalid, n,
+                                STR.data() + starts[EXPECTED] == result);
+                    }
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING 'appendUtf8Character'
@@ -5059,6 +5279,75 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: VALIDATION THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput, in GB/s, of 'isValid' and
+        //:   'numCodePointsIfValid' on ASCII and on multilingual input.
+        //
+        // Plan:
+        //: 1 Time the repeated validation of about 1 GB of a 64 KiB string of
+        //:   ASCII, and of one made of copies of the multilingual prose used
+        //:   by other test cases.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: VALIDATION THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TEST: VALIDATION THROUGHPUT\n"
+                             "=======================================\n";
+
+        enum { k_LENGTH = 64 * 1024 };
+
+        bsl::string ascii;
+        while (ascii.length() < k_LENGTH) {
+            appendRand1Byte(&ascii);
+        }
+
+        bsl::string prose;
+        while (prose.length() < k_LENGTH) {
+            prose += charUtf8MultiLang;
+        }
+
+        const bsls::Types::Int64 TOTAL = 1 << 30;
+
+        for (int si = 0; si < 2; ++si) {
+            const bsl::string& STR = si ? prose : ascii;
+
+            const bsls::Types::Int64 ITERATIONS = TOTAL / STR.length();
+            const double             GB = static_cast<double>(
+                                                  ITERATIONS * STR.length())
+                                        / 1e9;
+
+            const char      *err;
+            Obj::IntPtr      sum = 0;
+            bsls::Stopwatch  timer;
+
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Obj::isValid(&err, STR.data(), STR.length());
+            }
+            timer.stop();
+            const double isValid = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < ITERATIONS; ++i) {
+                sum += Obj::numCodePointsIfValid(&err,
+                                                 STR.data(),
+                                                 STR.length());
+            }
+            timer.stop();
+            const double numCodePoints = timer.accumulatedWallTime();
+
+            cout << (si ? "prose" : "ascii")
+                 << ": isValid " << GB / isValid << " GB/s"
+                 << ", numCodePointsIfValid " << GB / numCodePoints << " GB/s"
+                 << " (" << sum % 10 << ")" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -10,7 +10,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslh::DefaultHashAlgorithm: a default hashing algorithm
 //
-//@SEE_ALSO: bslh_hash, bslh_defaultseededhashalgorithm
+//@SEE_ALSO: bslh_hash, bslh_defaultseededhashalgorithm,
+//           bslh_randomizedhashalgorithm
 //
 //@DESCRIPTION: 'bslh::DefaultHashAlgorithm' provides an unspecified default
 // hashing algorithm.  The supplied algorithm is suitable for general purpose
@@ -28,11 +29,15 @@ BSLS_IDENT("$Id: $")
 // hashes that are not predictable by an attacker.  Security is a concern when
 // an attacker may be able to provide malicious input into a hash table,
 // thereby causing hashes to collide to buckets, which degrades performance.
-// There are *no* security guarantees made by 'bslh::DefaultHashAlgorithm',
-// meaning attackers may be able to engineer keys that will cause a Denial of
-// Service (DoS) attack in hash tables using this algorithm.  If security is
-// required, an algorithm that documents better secure properties should be
-// used, such as 'bslh_siphashalgorithm'.
+// By default, 'bslh::DefaultHashAlgorithm' is seeded with a seed generated at
+// random once per process (see 'bslh_randomizedhashalgorithm'), so that
+// attackers cannot compute, ahead of time, keys that collide in the hash
+// tables of a process.  However, *no* further security guarantees are made by
+// 'bslh::DefaultHashAlgorithm', meaning attackers may still be able to
+// engineer keys that will cause a Denial of Service (DoS) attack in hash
+// tables using this algorithm.  If security is required, an algorithm that
+// documents better secure properties should be used, such as
+// 'bslh_siphashalgorithm'.
 //
 ///Speed
 ///-----
@@ -60,6 +65,34 @@ BSLS_IDENT("$Id: $")
 // write hashes from 'bslh::DefaultHashAlgorithm' to any memory accessible by
 // multiple machines.
 //
+///Selecting the Underlying Algorithm
+///-----------------------------------
+// 'bslh::DefaultHashAlgorithm' currently uses 'bslh::RandomizedHashAlgorithm',
+// i.e., 'bslh::WyHashAlgorithm' seeded with a seed generated at random once
+// per process.  As 'bslh::Hash<>', and therefore 'bsl::hash' for strings and
+// for types that have a 'hashAppend' function, use
+// 'bslh::DefaultHashAlgorithm', the hashes used by default in unordered
+// containers are unpredictable outside of the process (except in the degraded
+// mode, described in the component documentation of
+// 'bslh_randomizedhashalgorithm', in which the random number generator of the
+// operating system is unavailable), and differ from one run of a program to
+// the next (and, therefore, so does the iteration order of the containers).
+// The following macros select a different algorithm:
+//
+//: 'BSLH_DEFAULTHASHALGORITHM_USE_SPOOKYHASH':
+//:   Use 'bslh::SpookyHashAlgorithm', unseeded, which was the algorithm used
+//:   by earlier releases.
+//:
+//: 'BSLH_DEFAULTHASHALGORITHM_USE_WYHASH':
+//:   Use 'bslh::WyHashAlgorithm', unseeded.
+//
+// Either macro makes the hashes, and the iteration order of unordered
+// containers, reproducible from one run to the next (which may help when
+// debugging), at the cost of the protection afforded by the random seed.  Note
+// that these macros must be defined consistently for all translation units of
+// a program (typically on the command line of the compiler), as they change
+// the layout of 'bslh::DefaultHashAlgorithm'.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -279,7 +312,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bslh_randomizedhashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 namespace BloombergLP {
 
@@ -292,10 +327,16 @@ class DefaultHashAlgorithm {
 
   private:
     // PRIVATE TYPES
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_SPOOKYHASH)
     typedef bslh::SpookyHashAlgorithm InternalHashAlgorithm;
+#elif defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+    typedef bslh::WyHashAlgorithm InternalHashAlgorithm;
+#else
+    typedef bslh::RandomizedHashAlgorithm InternalHashAlgorithm;
+#endif
         // Typedef indicating the algorithm currently being used by
         // 'bslh::DefualtHashAlgorithm' to compute hashes.  This algorithm is
-        // subject to change.
+        // subject to change (see {Selecting the Underlying Algorithm}).
 
     // DATA
     InternalHashAlgorithm d_state;
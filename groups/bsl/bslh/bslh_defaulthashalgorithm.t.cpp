@@ -1,6 +1,10 @@
 // bslh_defaulthashalgorithm.t.cpp                                    -*-C++-*-
 #include <bslh_defaulthashalgorithm.h>
 
+#include <bslh_randomizedhashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
+
 #include <bslmf_issame.h>
 
 #include <bsls_assert.h>
@@ -358,6 +362,15 @@ bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
 
 typedef DefaultHashAlgorithm Obj;
 
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_SPOOKYHASH)
+typedef SpookyHashAlgorithm InternalHashAlgorithm;
+#elif defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+typedef WyHashAlgorithm InternalHashAlgorithm;
+#else
+typedef RandomizedHashAlgorithm InternalHashAlgorithm;
+#endif
+    // The algorithm expected to be used by 'DefaultHashAlgorithm'.
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -433,7 +446,7 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 The typedef 'result_type' is publicly accessible and an alias for
-        //:   'bslh::SpookyHashAlgorithm::result_type'.
+        //:   'InternalHashAlgorithm::result_type'.
         //:
         //: 2 'computeHash()' returns 'result_type'
         //
@@ -455,7 +468,7 @@ int main(int argc, char *argv[])
                             " correct type using 'bslmf::IsSame'. (C-1)\n");
         {
             ASSERT((bslmf::IsSame<Obj::result_type,
-                                  SpookyHashAlgorithm::result_type>::VALUE));
+                                  InternalHashAlgorithm::result_type>::VALUE));
         }
 
         if (verbose) printf("Declare the expected signature of 'computeHash()'"
@@ -476,7 +489,7 @@ int main(int argc, char *argv[])
         //   operator that can be called with some bytes and a length.  Verify
         //   that calling 'operator()' will permute the algorithm's internal
         //   state as specified by the underlying hashing algorithm
-        //   (bslh::SpookyHashAlgorithm).  Verify that 'computeHash()' returns
+        //   ('InternalHashAlgorithm').  Verify that 'computeHash()' returns
         //   the final value specified by the canonical implementation of the
         //   underlying hashing algorithm.
         //
@@ -493,7 +506,7 @@ int main(int argc, char *argv[])
         //
         // Plan:
         //: 1 Hash a number of values with 'bslh::DefaultHashAlgorithm' and
-        //:   'bslh::SpookyHashAlgorithm' and verify that the outputs match.
+        //:   'InternalHashAlgorithm' and verify that the outputs match.
         //:   (C-1,2,3)
         //:
         //: 2 Call 'operator()' with a null pointer. (C-4)
@@ -537,7 +550,7 @@ int main(int argc, char *argv[])
 
         if (verbose) printf("Hash a number of values with"
                             " 'bslh::DefaultHashAlgorithm' and"
-                            " 'bslh::SpookyHashAlgorithm' and verify that the"
+                            " 'InternalHashAlgorithm' and verify that the"
                             " outputs match. (C-1,2,3)\n");
         {
             for (int i = 0; i != NUM_DATA; ++i) {
@@ -546,11 +559,11 @@ int main(int argc, char *argv[])
 
                 if (veryVerbose) printf("Hashing: %s\n with"
                                         " 'bslh::DefaultHashAlgorithm' and"
-                                        " 'bslh::SpookyHashAlgorithm'", VALUE);
+                                        " 'InternalHashAlgorithm'", VALUE);
 
-                Obj                 contiguousHash;
-                Obj                 dispirateHash;
-                SpookyHashAlgorithm cannonicalHashAlgorithm;
+                Obj                   contiguousHash;
+                Obj                   dispirateHash;
+                InternalHashAlgorithm cannonicalHashAlgorithm;
 
                 cannonicalHashAlgorithm(VALUE, strlen(VALUE));
                 contiguousHash(VALUE, strlen(VALUE));
@@ -561,7 +574,7 @@ int main(int argc, char *argv[])
                     dispirateHash(&VALUE[j], sizeof(char));
                 }
 
-                SpookyHashAlgorithm::result_type hash =
+                InternalHashAlgorithm::result_type hash =
                                          cannonicalHashAlgorithm.computeHash();
 
                 LOOP_ASSERT(LINE, hash == contiguousHash.computeHash());
@@ -1,8 +1,10 @@
 // bslh_hash.t.cpp                                                    -*-C++-*-
 #include <bslh_hash.h>
 #include <bslh_defaultseededhashalgorithm.h>
+#include <bslh_randomizedhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
@@ -1080,10 +1082,22 @@ int main(int argc, char *argv[])
         //:   used.
         //:
         //: 2 The function call operator can be invoked on constant objects.
+        //:
+        //: 3 'bslh::Hash<>' uses the algorithm selected for
+        //:   'bslh::DefaultHashAlgorithm' (by default, wyhash seeded with the
+        //:   process seed of 'bslh::RandomizedHashAlgorithm').
         //
         // Plan:
-        //: 1 Create 'const' ints and hash them.  Compare the results against
-        //:   known good values. (C-1,2)
+        //: 1 Create 'const' ints and hash them with 'bslh::Hash' instantiated
+        //:   with 'bslh::SpookyHashAlgorithm' and 'bslh::WyHashAlgorithm'.
+        //:   Compare the results against known good values for each
+        //:   algorithm. (C-1,2)
+        //:
+        //: 2 Hash the same ints with 'bslh::Hash<>', and compare the results
+        //:   against the known good values for the algorithm selected for
+        //:   'bslh::DefaultHashAlgorithm' or, if it is randomly seeded,
+        //:   against the hash computed by wyhash seeded with the process
+        //:   seed. (C-1..3)
         //
         // Testing:
         //   operator()(const T&) const
@@ -1096,35 +1110,70 @@ int main(int argc, char *argv[])
             int                  d_line;
             const int            d_value;
             bsls::Types::Uint64  d_expectedHash;
+            bsls::Types::Uint64  d_expectedWyHash;
         } DATA[] = {
-        // LINE    DATA              HASH
-         {  L_,        1,  9778072230994240314ULL,},
-         {  L_,        3, 16874605512690156844ULL,},
-         {  L_,        9,  6609278684846086166ULL,},
-         {  L_,       27, 14610053422485613907ULL,},
-         {  L_,       81,  4473763709117720193ULL,},
-         {  L_,      243,  6469189993869193617ULL,},
-         {  L_,      729, 18245170745653607298ULL,},
-         {  L_,     2187,  4418771231001558887ULL,},
-         {  L_,     6561,  8361494415593539480ULL,},
-         {  L_,    19683,  8034516711244389554ULL,},
-         {  L_,    59049, 15257840606198213647ULL,},
-         {  L_,   177147,  9838846006369268307ULL,},
-         {  L_,   531441,  2891007685366740764ULL,},
-         {  L_,  1594323,  3005240762459740192ULL,},
-         {  L_,  4782969,  3383268391725748969ULL,},
+        // LINE      DATA     HASH (SPOOKYHASH)           HASH (WYHASH)
+         {  L_,        1,  9778072230994240314ULL,  1489959078149032791ULL },
+         {  L_,        3, 16874605512690156844ULL, 10785815834190492667ULL },
+         {  L_,        9,  6609278684846086166ULL,  4545947166749760840ULL },
+         {  L_,       27, 14610053422485613907ULL, 16214440194457727407ULL },
+         {  L_,       81,  4473763709117720193ULL, 10856838873274793583ULL },
+         {  L_,      243,  6469189993869193617ULL,  7121698142467755658ULL },
+         {  L_,      729, 18245170745653607298ULL, 17860481109597868947ULL },
+         {  L_,     2187,  4418771231001558887ULL, 13741818234888842879ULL },
+         {  L_,     6561,  8361494415593539480ULL,  8460019142431240994ULL },
+         {  L_,    19683,  8034516711244389554ULL, 14796989208508862067ULL },
+         {  L_,    59049, 15257840606198213647ULL,   562489244959138016ULL },
+         {  L_,   177147,  9838846006369268307ULL,  7190805184287993316ULL },
+         {  L_,   531441,  2891007685366740764ULL,  2449802180982419993ULL },
+         {  L_,  1594323,  3005240762459740192ULL, 15572508454787908069ULL },
+         {  L_,  4782969,  3383268391725748969ULL, 10764191690996211860ULL },
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
-        if (verbose) printf("Create 'const' strings and hash them.  Compare"
-                            " the results against known good values."
-                            " (C-1,2)\n");
+        if (verbose) printf("Create 'const' ints and hash them with each"
+                            " algorithm.  Compare the results against known"
+                            " good values. (C-1,2)\n");
+        {
+            typedef bslh::Hash<bslh::SpookyHashAlgorithm> SpookyHash;
+            typedef bslh::Hash<bslh::WyHashAlgorithm>     WyHash;
+
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int    LINE        = DATA[i].d_line;
+                const int    VALUE       = DATA[i].d_value;
+                const size_t SPOOKY_HASH =
+                                   static_cast<size_t>(DATA[i].d_expectedHash);
+                const size_t WY_HASH     =
+                                 static_cast<size_t>(DATA[i].d_expectedWyHash);
+
+                const SpookyHash spookyHash = SpookyHash();
+                LOOP_ASSERT(LINE, spookyHash(VALUE) == SPOOKY_HASH);
+
+                const WyHash wyHash = WyHash();
+                LOOP_ASSERT(LINE, wyHash(VALUE) == WY_HASH);
+            }
+        }
+
+        if (verbose) printf("Create 'const' ints and hash them with"
+                            " 'bslh::Hash<>'.  Compare the results against"
+                            " the selected algorithm. (C-1..3)\n");
         {
             for (int i = 0; i != NUM_DATA; ++i) {
                 const int    LINE  = DATA[i].d_line;
                 const int    VALUE = DATA[i].d_value;
+#if defined(BSLH_DEFAULTHASHALGORITHM_USE_SPOOKYHASH)
                 const size_t HASH  =
                                    static_cast<size_t>(DATA[i].d_expectedHash);
+#elif defined(BSLH_DEFAULTHASHALGORITHM_USE_WYHASH)
+                const size_t HASH  =
+                                 static_cast<size_t>(DATA[i].d_expectedWyHash);
+#else
+                bslh::WyHashAlgorithm seededAlg(
+                                       bslh::RandomizedHashAlgorithm::seed());
+                seededAlg(&VALUE, sizeof VALUE);
+                const size_t HASH  =
+                                 static_cast<size_t>(seededAlg.computeHash());
+#endif
 
                 if (veryVerbose) printf("Hashing: %i, Expecting: " ZU "\n",
                                         VALUE,
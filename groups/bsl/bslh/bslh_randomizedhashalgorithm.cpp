@@ -0,0 +1,191 @@
+// bslh_randomizedhashalgorithm.cpp                                   -*-C++-*-
+#include <bslh_randomizedhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_bslonce.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <string.h>  // for 'memcpy', 'memset'
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#include <wincrypt.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(__GLIBC__)                    \
+ && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+#define BSLH_RANDOMIZEDHASHALGORITHM_GETRANDOM
+#include <sys/random.h>
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+int loadSystemRandomBytes(unsigned char *buffer, size_t numBytes)
+    // Load into the specified 'buffer' the specified 'numBytes' random bytes
+    // obtained from the random number generator of the operating system.
+    // Return 0 on success, and a non-zero value (leaving 'buffer' in an
+    // unspecified state) otherwise.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    HCRYPTPROV provider;
+    if (!CryptAcquireContext(&provider,
+                             NULL,
+                             NULL,
+                             PROV_RSA_FULL,
+                             CRYPT_VERIFYCONTEXT | CRYPT_SILENT)) {
+        return -1;                                                    // RETURN
+    }
+
+    const BOOL success = CryptGenRandom(provider,
+                                        static_cast<DWORD>(numBytes),
+                                        buffer);
+    CryptReleaseContext(provider, 0);
+
+    return success ? 0 : -1;
+#else
+    size_t numRead = 0;
+
+#if defined(BSLH_RANDOMIZEDHASHALGORITHM_GETRANDOM)
+    // 'getrandom' needs neither a file descriptor nor access to '/dev', so it
+    // succeeds in a 'chroot' environment and when the process has run out of
+    // file descriptors.  It fails with 'ENOSYS' on kernels older than 3.17,
+    // in which case '/dev/urandom' is read below.
+
+    while (numRead < numBytes) {
+        const ssize_t rc = getrandom(buffer + numRead, numBytes - numRead, 0);
+        if (rc > 0) {
+            numRead += static_cast<size_t>(rc);
+        }
+        else if (rc < 0 && EINTR == errno) {
+            continue;                                               // CONTINUE
+        }
+        else {
+            break;
+        }
+    }
+
+    if (numRead == numBytes) {
+        return 0;                                                     // RETURN
+    }
+#endif
+
+#if defined(O_CLOEXEC)
+    const int flags = O_RDONLY | O_CLOEXEC;
+#else
+    const int flags = O_RDONLY;
+#endif
+
+    int fd;
+    do {
+        fd = open("/dev/urandom", flags);
+    } while (fd < 0 && EINTR == errno);
+
+    if (fd < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    while (numRead < numBytes) {
+        const ssize_t rc = read(fd, buffer + numRead, numBytes - numRead);
+        if (rc > 0) {
+            numRead += static_cast<size_t>(rc);
+        }
+        else if (rc < 0 && EINTR == errno) {
+            continue;                                               // CONTINUE
+        }
+        else {
+            break;
+        }
+    }
+    close(fd);
+
+    return numRead == numBytes ? 0 : -1;
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bslh {
+
+                      // -----------------------------------
+                      // class bslh::RandomizedHashAlgorithm
+                      // -----------------------------------
+
+// PRIVATE CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int
+RandomizedHashAlgorithm::s_seedIsReady = { 0 };
+
+char RandomizedHashAlgorithm::s_seed[WyHashAlgorithm::k_SEED_LENGTH];
+
+// PRIVATE CLASS METHODS
+void RandomizedHashAlgorithm::generateSeed()
+{
+    static bsls::BslOnce once = BSLS_BSLONCE_INITIALIZER;
+
+    bsls::BslOnceGuard onceGuard;
+    if (onceGuard.enter(&once)) {
+        // The seed is the hash of the output of the random number generator of
+        // the operating system, together with values that differ from one run
+        // to the next even if that generator is unavailable.
+
+        struct {
+            unsigned char      d_random[16];
+            bsls::Types::Int64 d_timer;
+            const void        *d_stackAddress;
+            const void        *d_dataAddress;
+        } entropy;
+
+        memset(&entropy, 0, sizeof entropy);
+
+        if (0 != loadSystemRandomBytes(entropy.d_random,
+                                       sizeof entropy.d_random)) {
+            BSLS_LOG_ERROR("bslh::RandomizedHashAlgorithm: the random number"
+                           " generator of the operating system is"
+                           " unavailable; the process seed is derived from"
+                           " the time and addresses only, and may be"
+                           " predictable");
+        }
+
+        entropy.d_timer        = bsls::TimeUtil::getTimer();
+        entropy.d_stackAddress = &entropy;
+        entropy.d_dataAddress  = &once;
+
+        WyHashAlgorithm hashAlg;
+        hashAlg(&entropy, sizeof entropy);
+        const bsls::Types::Uint64 seed = hashAlg.computeHash();
+
+        memcpy(s_seed, &seed, sizeof s_seed);
+
+        bsls::AtomicOperations::setIntRelease(&s_seedIsReady, 1);
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,279 @@
+// bslh_randomizedhashalgorithm.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLH_RANDOMIZEDHASHALGORITHM
+#define INCLUDED_BSLH_RANDOMIZEDHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hashing algorithm seeded randomly once per process.
+//
+//@CLASSES:
+//  bslh::RandomizedHashAlgorithm: wyhash seeded with a per-process seed
+//
+//@SEE_ALSO: bslh_hash, bslh_wyhashalgorithm, bslh_defaulthashalgorithm
+//
+//@DESCRIPTION: 'bslh::RandomizedHashAlgorithm' provides a regular (i.e.,
+// default constructible) 'bslh' hashing algorithm that computes the wyhash
+// (see 'bslh_wyhashalgorithm') of its input, seeded with a seed generated at
+// random once per process, the *process* *seed*.  Every object of this class
+// in a process therefore computes the same hash for the same input, as
+// required of a hashing algorithm used in a hash table, but hashes differ from
+// one run of a program to the next.  This is the algorithm used by
+// 'bslh::DefaultHashAlgorithm' (see {'bslh_defaulthashalgorithm'|Selecting the
+// Underlying Algorithm}), and therefore, by default, by 'bslh::Hash<>' and the
+// unordered containers.
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms,
+// defined in 'bslh_hash.h'.  More information can be found in the package
+// level documentation for 'bslh' (internal users can also find information
+// here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///The Process Seed
+///----------------
+// The process seed is generated when it is first needed, i.e., on the first
+// construction of a 'bslh::RandomizedHashAlgorithm' object or the first call
+// to 'bslh::RandomizedHashAlgorithm::seed', in a thread-safe manner.  It is
+// obtained from the random number generator of the operating system
+// ('getrandom' on Linux, falling back to '/dev/urandom', '/dev/urandom' on
+// other Unix platforms, and 'CryptGenRandom' on Windows), mixed with the value
+// of a high-resolution timer and with addresses that vary from one run to the
+// next on platforms randomizing the layout of the address space.  The process
+// seed is not changed afterwards; in particular, it is shared by the child
+// processes created with 'fork' after it is generated.
+//
+// If the random number generator of the operating system cannot be used
+// (e.g., '/dev/urandom' cannot be opened in a 'chroot' environment lacking
+// '/dev', or because the process has run out of file descriptors, on a
+// platform that does not provide 'getrandom'), a seed is still generated,
+// from the timer value and the addresses alone, and an error is logged using
+// 'bsls::Log'.  In this *degraded* mode the process seed may be guessed by an
+// attacker able to estimate when the process started and how its address
+// space is laid out, and the protection described in {Security} is weakened
+// accordingly.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+//
+// As the process seed is not known outside of the process (unless it was
+// generated in the degraded mode described in {The Process Seed}), an attacker
+// cannot compute, ahead of time, a set of keys that collide in the hash tables
+// of a process using 'bslh::RandomizedHashAlgorithm' (as they can for an
+// unseeded algorithm, or one seeded with a fixed seed), which defeats the most
+// common form of hash flooding attacks at a negligible cost in speed.
+// However, wyhash is not a cryptographically secure algorithm, and *no*
+// guarantee is made that an attacker able to observe the behavior of the hash
+// tables of a process (e.g., through their iteration order or timing) cannot
+// engineer colliding keys.  If such guarantees are required, an algorithm that
+// documents better secure properties should be used, such as
+// 'bslh::SipHashAlgorithm' (through 'bslh::SeededHash').
+//
+///Speed
+///-----
+// This algorithm computes a hash on the order of O(n) where 'n' is the length
+// of the input data.  Constructing an object of this class costs one
+// (uncontended, and usually cached) atomic load and a 64-bit multiplication
+// more than constructing an unseeded 'bslh::WyHashAlgorithm', so it is nearly
+// as fast as 'bslh::WyHashAlgorithm', and therefore faster than
+// 'bslh::SpookyHashAlgorithm', on short keys.
+//
+///Hash Consistency
+///----------------
+// The hashes produced by this algorithm are consistent only within a single
+// process.  They must not be sent to, or compared with hashes computed by,
+// another process (or another run of the same program), and they must not be
+// persisted.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Keys Supplied by Clients
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a hash table of the sessions of a service, keyed by
+// names supplied by the clients of the service.  A client that knew the hash
+// function used by the table could choose names that all hash to the same
+// bucket, and make every lookup in the table take time linear in the number of
+// sessions.  We hash the names with 'bslh::RandomizedHashAlgorithm' to prevent
+// that, as the hashes it produces cannot be predicted outside of the process.
+//
+// First, we hash the name of a session:
+//..
+//  const char *name = "Jane Doe";
+//
+//  bslh::RandomizedHashAlgorithm hashAlg;
+//  hashAlg(name, strlen(name));
+//  bslh::RandomizedHashAlgorithm::result_type hash = hashAlg.computeHash();
+//..
+// Then, we verify that it is the hash of the name computed by wyhash seeded
+// with the process seed:
+//..
+//  bslh::WyHashAlgorithm wyHashAlg(bslh::RandomizedHashAlgorithm::seed());
+//  wyHashAlg(name, strlen(name));
+//  assert(wyHashAlg.computeHash() == hash);
+//..
+// Finally, we verify that the hash does not change during the lifetime of the
+// process:
+//..
+//  bslh::RandomizedHashAlgorithm otherHashAlg;
+//  otherHashAlg(name, strlen(name));
+//  assert(otherHashAlg.computeHash() == hash);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+#include <stddef.h>  // for 'size_t'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                      // ===================================
+                      // class bslh::RandomizedHashAlgorithm
+                      // ===================================
+
+class RandomizedHashAlgorithm {
+    // This class wraps 'bslh::WyHashAlgorithm', seeded with a seed generated
+    // at random once per process, in an interface that is usable in the
+    // modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int s_seedIsReady;
+        // Non-zero once the process seed has been generated.
+
+    static char s_seed[WyHashAlgorithm::k_SEED_LENGTH];
+        // The process seed.
+
+    // DATA
+    WyHashAlgorithm d_state;  // wyhash, seeded with the process seed
+
+    // NOT IMPLEMENTED
+    RandomizedHashAlgorithm(const RandomizedHashAlgorithm& original);
+                                                                  // = delete;
+        // Do not allow copy construction.
+
+    RandomizedHashAlgorithm& operator=(const RandomizedHashAlgorithm& rhs);
+                                                                  // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static void generateSeed();
+        // Generate the process seed, unless it has already been generated.
+        // This method is thread-safe.
+
+  public:
+    // TYPES
+    typedef WyHashAlgorithm::result_type result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CLASS METHODS
+    static const char *seed();
+        // Return the address of the 'WyHashAlgorithm::k_SEED_LENGTH' bytes of
+        // the process seed, generating it if it has not yet been generated.
+        // This method is thread-safe.
+
+    // CREATORS
+    RandomizedHashAlgorithm();
+        // Create a 'bslh::RandomizedHashAlgorithm' seeded with the process
+        // seed, generating it if it has not yet been generated.
+
+    //! ~RandomizedHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// CLASS METHODS
+inline
+const char *RandomizedHashAlgorithm::seed()
+{
+    if (!bsls::AtomicOperations::getIntAcquire(&s_seedIsReady)) {
+        generateSeed();
+    }
+    return s_seed;
+}
+
+// CREATORS
+inline
+RandomizedHashAlgorithm::RandomizedHashAlgorithm()
+: d_state(seed())
+{
+}
+
+// MANIPULATORS
+inline
+void RandomizedHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    d_state(data, numBytes);
+}
+
+inline
+RandomizedHashAlgorithm::result_type RandomizedHashAlgorithm::computeHash()
+{
+    return d_state.computeHash();
+}
+
+}  // close package namespace
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::RandomizedHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,640 @@
+// bslh_randomizedhashalgorithm.t.cpp                                 -*-C++-*-
+#include <bslh_randomizedhashalgorithm.h>
+
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm that forwards to
+// 'bslh::WyHashAlgorithm' seeded with a per-process seed.  The basic test
+// plan is to verify that the process seed is generated once and is then
+// stable, and that the output of the algorithm is the output of
+// 'bslh::WyHashAlgorithm' seeded with the process seed.  The component will
+// also be tested for conformance to the requirements on 'bslh' hashing
+// algorithms, outlined in the 'bslh' package level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef WyHashAlgorithm::result_type result_type;
+//
+// CLASS METHODS
+// [ 2] static const char *seed();
+//
+// CREATORS
+// [ 2] RandomizedHashAlgorithm();
+// [ 2] ~RandomizedHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] Trait IsBitwiseMoveable
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: HASHING SHORT KEYS
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef RandomizedHashAlgorithm Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class ALGORITHM>
+double measureShortKeys(const char *keys, int numKeys, size_t keyLength)
+    // Return the time, in nanoseconds, that a default constructed object of
+    // the (template parameter) 'ALGORITHM' takes to be created and to hash
+    // each of the specified 'numKeys' keys of the specified 'keyLength' bytes
+    // stored consecutively at the specified 'keys', averaged over the keys.
+    // Note that this is the work done by 'bslh::Hash<ALGORITHM>' for each key
+    // looked up in a hash table.
+{
+    enum { k_NUM_ROUNDS = 5 };
+
+    Uint64          sum = 0;
+    bsls::Stopwatch timer;
+
+    timer.start();
+    for (int round = 0; round != k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i != numKeys; ++i) {
+            ALGORITHM hashAlg;
+            hashAlg(keys + i * keyLength, keyLength);
+            sum += hashAlg.computeHash();
+        }
+    }
+    timer.stop();
+
+    if (0 == sum) {
+        printf("(all hashes are zero)\n");
+    }
+    return timer.accumulatedWallTime() * 1e9 / (k_NUM_ROUNDS * numKeys);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Keys Supplied by Clients
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a hash table of the sessions of a service, keyed by
+// names supplied by the clients of the service.  A client that knew the hash
+// function used by the table could choose names that all hash to the same
+// bucket, and make every lookup in the table take time linear in the number of
+// sessions.  We hash the names with 'bslh::RandomizedHashAlgorithm' to prevent
+// that, as the hashes it produces cannot be predicted outside of the process.
+//
+// First, we hash the name of a session:
+//..
+        const char *name = "Jane Doe";
+
+        bslh::RandomizedHashAlgorithm hashAlg;
+        hashAlg(name, strlen(name));
+        bslh::RandomizedHashAlgorithm::result_type hash =
+                                                        hashAlg.computeHash();
+//..
+// Then, we verify that it is the hash of the name computed by wyhash seeded
+// with the process seed:
+//..
+        bslh::WyHashAlgorithm wyHashAlg(bslh::RandomizedHashAlgorithm::seed());
+        wyHashAlg(name, strlen(name));
+        ASSERT(wyHashAlg.computeHash() == hash);
+//..
+// Finally, we verify that the hash does not change during the lifetime of the
+// process:
+//..
+        bslh::RandomizedHashAlgorithm otherHashAlg;
+        otherHashAlg(name, strlen(name));
+        ASSERT(otherHashAlg.computeHash() == hash);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the
+        //:   'bslmf::IsBitwiseMoveable' metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslmf::IsBitwiseMoveable' metafunction."
+                            " (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<RandomizedHashAlgorithm>::value);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef WyHashAlgorithm::result_type result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  Obj::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void)expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length, and that
+        //   the hash it computes is wyhash seeded with the process seed.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 The 'computeHash()' function is callable.
+        //:
+        //: 3 The output of calling 'operator()' and then 'computeHash()'
+        //:   matches the output of 'bslh::WyHashAlgorithm' seeded with the
+        //:   process seed, for inputs of any length.
+        //:
+        //: 4 The output does not depend on how the input is split into calls
+        //:   to 'operator()'.
+        //:
+        //: 5 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 For each length from 0 to 200 bytes, hash a pseudo-random input
+        //:   with an 'Obj' and with a 'WyHashAlgorithm' seeded with 'seed()',
+        //:   and verify that the outputs match.  (C-1..3)
+        //:
+        //: 2 Hash each input again in pieces of 7 bytes, and verify that the
+        //:   output is unchanged.  (C-4)
+        //:
+        //: 3 Call 'operator()' with a null pointer.  (C-5)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\nTESTING 'operator()' AND 'computeHash()'"
+                       "\n========================================\n");
+
+        if (verbose) printf("Compare with 'WyHashAlgorithm' seeded with the"
+                            " process seed. (C-1..4)\n");
+        {
+            enum { k_MAX_LENGTH = 200 };
+
+            char         input[k_MAX_LENGTH];
+            unsigned int random = 1;
+            for (int i = 0; i != k_MAX_LENGTH; ++i) {
+                random   = random * 1103515245 + 12345;
+                input[i] = static_cast<char>(random >> 16);
+            }
+
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                if (veryVerbose) { P(length) }
+
+                WyHashAlgorithm wyHashAlg(Obj::seed());
+                wyHashAlg(input, length);
+                const Uint64 EXPECTED = wyHashAlg.computeHash();
+
+                Obj hashAlg;
+                hashAlg(input, length);
+                LOOP_ASSERT(length, EXPECTED == hashAlg.computeHash());
+
+                Obj piecesAlg;
+                for (int position = 0; position < length; position += 7) {
+                    piecesAlg(input + position,
+                              length - position < 7 ? length - position : 7);
+                }
+                LOOP_ASSERT(length, EXPECTED == piecesAlg.computeHash());
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj()(   0, 5));
+            ASSERT_PASS(Obj()(   0, 0));
+            ASSERT_PASS(Obj()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND 'seed'
+        //   Ensure that the implicit destructor as well as the default
+        //   constructor are publicly callable, and that every object is
+        //   seeded with the same process seed.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be destroyed.
+        //:
+        //: 3 'seed' returns the same address, holding the same bytes, on each
+        //:   call.
+        //:
+        //: 4 The process seed is not the zero seed used by a default
+        //:   constructed 'WyHashAlgorithm'.
+        //:
+        //: 5 Every object computes the same hash for the same input.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'RandomizedHashAlgorithm' and allow
+        //:   it to leave scope to be destroyed. (C-1,2)
+        //:
+        //: 2 Call 'seed' before and after creating objects, and verify that it
+        //:   returns the same address and the same bytes. (C-3)
+        //:
+        //: 3 Verify that the process seed is not all zero. (C-4)
+        //:
+        //: 4 Hash the same input with several objects, and verify that the
+        //:   hashes are equal, and differ from the unseeded wyhash of the
+        //:   input. (C-4,5)
+        //
+        // Testing:
+        //   static const char *seed();
+        //   RandomizedHashAlgorithm();
+        //   ~RandomizedHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS AND 'seed'"
+                   "\n===========================\n");
+
+        const char *SEED = Obj::seed();
+        ASSERT(SEED);
+
+        char seedCopy[WyHashAlgorithm::k_SEED_LENGTH];
+        memcpy(seedCopy, SEED, sizeof seedCopy);
+
+        if (verbose) printf("Create a default constructed"
+                            " 'RandomizedHashAlgorithm' and allow it to leave"
+                            " scope to be destroyed. (C-1,2)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Verify that the process seed is stable."
+                            " (C-3)\n");
+        {
+            ASSERT(SEED == Obj::seed());
+            ASSERT(0    == memcmp(seedCopy, Obj::seed(), sizeof seedCopy));
+        }
+
+        if (verbose) printf("Verify that the process seed is not zero."
+                            " (C-4)\n");
+        {
+            const char ZERO[WyHashAlgorithm::k_SEED_LENGTH] = { 0 };
+
+            ASSERT(0 != memcmp(ZERO, SEED, sizeof ZERO));
+        }
+
+        if (verbose) printf("Hash the same input with several objects."
+                            " (C-4,5)\n");
+        {
+            const char *DATA = "Hello World";
+
+            WyHashAlgorithm unseededAlg;
+            unseededAlg(DATA, strlen(DATA));
+            const Uint64 UNSEEDED = unseededAlg.computeHash();
+
+            Obj alg1;
+            alg1(DATA, strlen(DATA));
+            const Uint64 HASH = alg1.computeHash();
+
+            ASSERT(UNSEEDED != HASH);
+
+            for (int i = 0; i != 4; ++i) {
+                Obj alg;
+                alg(DATA, strlen(DATA));
+                LOOP_ASSERT(i, HASH == alg.computeHash());
+            }
+
+            ASSERT(0 == memcmp(seedCopy, Obj::seed(), sizeof seedCopy));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::RandomizedHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::RandomizedHashAlgorithm'\n");
+        {
+            RandomizedHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            RandomizedHashAlgorithm hashAlg1;
+            RandomizedHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            RandomizedHashAlgorithm hashAlg1;
+            RandomizedHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different 'int's.\n");
+        {
+            RandomizedHashAlgorithm hashAlg1;
+            RandomizedHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " 'int's.\n");
+        {
+            RandomizedHashAlgorithm hashAlg1;
+            RandomizedHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: HASHING SHORT KEYS
+        //
+        // Concerns:
+        //: 1 Report the time taken to create a 'RandomizedHashAlgorithm' and
+        //:   hash a short key with it, compared to the same with an unseeded
+        //:   'WyHashAlgorithm' and with 'SpookyHashAlgorithm' (the algorithms
+        //:   that can otherwise be selected by 'bslh::DefaultHashAlgorithm').
+        //
+        // Plan:
+        //: 1 For key lengths from 4 to 64 bytes, create an object of each
+        //:   algorithm and hash with it each of a million pseudo-random keys,
+        //:   and print the average time per key.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: HASHING SHORT KEYS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: HASHING SHORT KEYS"
+                            "\n====================================\n");
+
+        enum { k_NUM_KEYS = 1000 * 1000, k_MAX_LENGTH = 64 };
+
+        char         *keys   = static_cast<char *>(
+                                         malloc(k_NUM_KEYS * k_MAX_LENGTH));
+        unsigned int  random = 1;
+        for (int i = 0; i != k_NUM_KEYS * k_MAX_LENGTH; ++i) {
+            random  = random * 1103515245 + 12345;
+            keys[i] = static_cast<char>(random >> 16);
+        }
+
+        static const size_t LENGTHS[] = { 4, 8, 16, 32, 64 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        printf("Creating and hashing (ns per key):\n"
+               "%6s %11s %11s %11s\n",
+               "bytes", "Randomized", "WyHash", "SpookyHash");
+        for (int i = 0; i != NUM_LENGTHS; ++i) {
+            const size_t LENGTH = LENGTHS[i];
+
+            printf("%6d %11.2f %11.2f %11.2f\n",
+                   static_cast<int>(LENGTH),
+                   measureShortKeys<RandomizedHashAlgorithm>(keys,
+                                                             k_NUM_KEYS,
+                                                             LENGTH),
+                   measureShortKeys<WyHashAlgorithm>(keys,
+                                                     k_NUM_KEYS,
+                                                     LENGTH),
+                   measureShortKeys<SpookyHashAlgorithm>(keys,
+                                                         k_NUM_KEYS,
+                                                         LENGTH));
+        }
+
+        free(keys);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,85 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE CLASS DATA
+const bsls::Types::Uint64 WyHashAlgorithm::k_SECRET0;
+const bsls::Types::Uint64 WyHashAlgorithm::k_SECRET1;
+const bsls::Types::Uint64 WyHashAlgorithm::k_SECRET2;
+const bsls::Types::Uint64 WyHashAlgorithm::k_SECRET3;
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashAlgorithm::consumeBlock(const unsigned char *block)
+{
+    d_seed = mix(load64(block)      ^ k_SECRET1, load64(block +  8) ^ d_seed);
+    d_see1 = mix(load64(block + 16) ^ k_SECRET2, load64(block + 24) ^ d_see1);
+    d_see2 = mix(load64(block + 32) ^ k_SECRET3, load64(block + 40) ^ d_see2);
+}
+
+void WyHashAlgorithm::consume(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(numBytes > k_BLOCK_SIZE - d_bufferLength);
+
+    // The canonical algorithm runs the 48-byte loop only on blocks followed
+    // by more input, so a block is consumed only once the byte following it
+    // has been received.
+
+    unsigned char *pending = d_buffer + k_HISTORY_SIZE;
+
+    if (d_bufferLength) {
+        const size_t numCopied = k_BLOCK_SIZE - d_bufferLength;
+
+        memcpy(pending + d_bufferLength, data, numCopied);
+        data     += numCopied;
+        numBytes -= numCopied;
+
+        consumeBlock(pending);
+        memcpy(d_buffer, pending + k_BLOCK_SIZE - k_HISTORY_SIZE,
+               k_HISTORY_SIZE);
+        d_bufferLength = 0;
+    }
+
+    if (numBytes > k_BLOCK_SIZE) {
+        do {
+            consumeBlock(data);
+            data     += k_BLOCK_SIZE;
+            numBytes -= k_BLOCK_SIZE;
+        } while (numBytes > k_BLOCK_SIZE);
+
+        memcpy(d_buffer, data - k_HISTORY_SIZE, k_HISTORY_SIZE);
+    }
+
+    memcpy(pending, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,441 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_spookyhashalgorithm, bslh_defaulthashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm by Wang
+// Yi (version "final 4").  wyhash is a general purpose algorithm built around
+// a single operation, the 64x64-bit to 128-bit multiplication, that modern
+// processors perform in a few cycles.  It consumes short keys, such as
+// integers and short strings, in a handful of instructions, and it is among
+// the fastest algorithms passing the SMHasher test suite on long keys.  It is
+// therefore a good choice for hashing values in unordered associative
+// containers.  For more information, see:
+// https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Incremental Hashing
+///-------------------
+// The canonical wyhash function takes the whole of its input at once, whereas
+// the 'bslh' hashing algorithms must accept input in pieces, through several
+// calls to 'operator()'.  'bslh::WyHashAlgorithm' buffers its input, and
+// consumes it in 48-byte blocks as the canonical function does, so that the
+// hash produced is that of the canonical function applied to the
+// concatenation of all the input, regardless of how the input was split.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm.  Note that even if an
+// attacker does not know the seed used to initialize this algorithm, they may
+// still be able to produce keys that will cause a DoS attack in hash tables
+// using this algorithm.  If security is required, an algorithm that documents
+// better secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  It is quicker than 'bslh::SpookyHashAlgorithm' on
+// inputs of all lengths, and two to three times quicker on the short inputs
+// that are typical of hash table keys.  Note that the speed of the algorithm
+// depends on that of the 128-bit multiplication: on platforms that do not
+// provide one, it is emulated with four 32-bit multiplications.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm reads its input as little-endian words on all
+// platforms, and therefore produces the same hashes on all platforms, which
+// are those of the canonical implementation.  Note, however, that the hashes
+// of values of types other than arrays of bytes depend on the representation
+// of these values, which is platform-specific.  It is therefore not
+// recommended to send hashes from 'bslh::WyHashAlgorithm' over a network.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Strings Received in Pieces
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a table of the names of the instruments we trade,
+// which we receive in packets that may split a name in several pieces.  We
+// want to compute the hash of each name as its pieces arrive, so that we do
+// not have to copy the pieces into a contiguous buffer.
+//
+// First, we create a 'bslh::WyHashAlgorithm' object for the name being
+// received, and pass it each piece in turn:
+//..
+//  const char *pieces[] = { "Canadian ", "Dollar ", "Futures" };
+//
+//  bslh::WyHashAlgorithm incrementalHash;
+//  for (int i = 0; i < 3; ++i) {
+//      incrementalHash(pieces[i], strlen(pieces[i]));
+//  }
+//..
+// Then, we compute the hash of the whole name:
+//..
+//  bslh::WyHashAlgorithm::result_type hash1 = incrementalHash.computeHash();
+//..
+// Finally, we verify that the hash is the one that would have been computed,
+// had we received the name at once:
+//..
+//  const char *name = "Canadian Dollar Futures";
+//
+//  bslh::WyHashAlgorithm wholeHash;
+//  wholeHash(name, strlen(name));
+//
+//  assert(wholeHash.computeHash() == hash1);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>  // for '_umul128'
+#endif
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class wraps an implementation of the "wyhash" hash algorithm in an
+    // interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_SIZE   = 48,  // bytes consumed by each round of the long loop
+        k_HISTORY_SIZE = 16   // bytes of consumed input kept in 'd_buffer'
+    };
+
+    // PRIVATE CLASS DATA
+    static const Uint64 k_SECRET0 = 0x2d358dccaa6c78a5ULL;
+    static const Uint64 k_SECRET1 = 0x8bb84b93962eacc9ULL;
+    static const Uint64 k_SECRET2 = 0x4b33a62ed433d4a3ULL;
+    static const Uint64 k_SECRET3 = 0x4d5a2da51de1aa47ULL;
+        // The default secret of the canonical implementation, which the
+        // algorithm mixes with its input.
+
+    // DATA
+    Uint64 d_seed;
+    Uint64 d_see1;
+    Uint64 d_see2;
+        // Stores the intermediate state of the algorithm as values are
+        // accumulated.  'd_see1' and 'd_see2' are the states of the second and
+        // third lanes of the 48-byte loop.
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment
+        unsigned char d_buffer[k_HISTORY_SIZE + k_BLOCK_SIZE];
+            // The last 'k_HISTORY_SIZE' bytes of the input already consumed
+            // by the 48-byte loop, followed by the input not yet consumed.
+            // The canonical algorithm reads the last 16 bytes of its input,
+            // which may precede the input not yet consumed.
+    };
+
+    size_t d_bufferLength;
+        // The length of the input not yet consumed, stored in 'd_buffer'
+        // after the first 'k_HISTORY_SIZE' bytes.
+
+    Uint64 d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 load32(const unsigned char *data);
+        // Return the 32-bit little-endian word at the specified 'data'.
+
+    static Uint64 load64(const unsigned char *data);
+        // Return the 64-bit little-endian word at the specified 'data'.
+
+    static Uint64 mix(Uint64 lhs, Uint64 rhs);
+        // Return the exclusive or of the low and high halves of the 128-bit
+        // product of the specified 'lhs' and 'rhs'.
+
+    static void multiply(Uint64 *lhs, Uint64 *rhs);
+        // Load the low and high halves of the 128-bit product of the
+        // specified 'lhs' and 'rhs' into 'lhs' and 'rhs' respectively.
+
+    // PRIVATE MANIPULATORS
+    void consumeBlock(const unsigned char *block);
+        // Run one round of the 48-byte loop on the specified 'block'.
+
+    void consume(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the internal state of the algorithm, where 'numBytes' exceeds the
+        // space left in the buffer.  Run the 48-byte loop on all but the last
+        // 1 to 48 bytes of the input received so far, and buffer these.
+
+    void initialize(Uint64 seed);
+        // Initialize the state of this algorithm for the specified 'seed'.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behaviour is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// PRIVATE CLASS METHODS
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::load32(const unsigned char *data)
+{
+    unsigned int word;
+    memcpy(&word, data, sizeof word);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(word);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::load64(const unsigned char *data)
+{
+    Uint64 word;
+    memcpy(&word, data, sizeof word);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(word);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 lhs, Uint64 rhs)
+{
+    multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+inline
+void WyHashAlgorithm::multiply(Uint64 *lhs, Uint64 *rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(*lhs) * *rhs;
+    *lhs = static_cast<Uint64>(product);
+    *rhs = static_cast<Uint64>(product >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    *lhs = _umul128(*lhs, *rhs, rhs);
+#else
+    const Uint64 lhsHigh = *lhs >> 32, lhsLow = *lhs & 0xFFFFFFFF;
+    const Uint64 rhsHigh = *rhs >> 32, rhsLow = *rhs & 0xFFFFFFFF;
+
+    const Uint64 high    = lhsHigh * rhsHigh;
+    const Uint64 middle0 = lhsHigh * rhsLow;
+    const Uint64 middle1 = rhsHigh * lhsLow;
+    const Uint64 low     = lhsLow  * rhsLow;
+
+    const Uint64 partial = low + (middle0 << 32);
+    Uint64       carry   = partial < low;
+    const Uint64 result  = partial + (middle1 << 32);
+    carry += result < partial;
+
+    *lhs = result;
+    *rhs = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+}
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashAlgorithm::initialize(Uint64 seed)
+{
+    d_seed         = seed ^ mix(seed ^ k_SECRET0, k_SECRET1);
+    d_see1         = d_seed;
+    d_see2         = d_seed;
+    d_bufferLength = 0;
+    d_totalLength  = 0;
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+{
+    initialize(0);
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    initialize(load64(reinterpret_cast<const unsigned char *>(seed)));
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    d_totalLength += numBytes;
+    if (numBytes <= k_BLOCK_SIZE - d_bufferLength) {
+        if (numBytes) {
+            memcpy(d_buffer + k_HISTORY_SIZE + d_bufferLength,
+                   data,
+                   numBytes);
+            d_bufferLength += numBytes;
+        }
+    }
+    else {
+        consume(static_cast<const unsigned char *>(data), numBytes);
+    }
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const unsigned char *data   = d_buffer + k_HISTORY_SIZE;
+    size_t               length = d_bufferLength;
+    Uint64               a, b;
+
+    if (d_totalLength <= 16) {
+        if (length >= 4) {
+            const size_t offset = (length >> 3) << 2;
+            a = load32(data) << 32 | load32(data + offset);
+            b = load32(data + length - 4) << 32
+              | load32(data + length - 4 - offset);
+        }
+        else if (length > 0) {
+            a = static_cast<Uint64>(data[0]) << 16
+              | static_cast<Uint64>(data[length >> 1]) << 8
+              | data[length - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        // 'd_see1' and 'd_see2' equal 'd_seed' unless the 48-byte loop ran.
+
+        d_seed ^= d_see1 ^ d_see2;
+
+        while (length > 16) {
+            d_seed  = mix(load64(data) ^ k_SECRET1, load64(data + 8) ^ d_seed);
+            data   += 16;
+            length -= 16;
+        }
+
+        // This may read the history preceding the input not yet consumed.
+
+        a = load64(data + length - 16);
+        b = load64(data + length - 8);
+    }
+
+    a ^= k_SECRET1;
+    b ^= d_seed;
+    multiply(&a, &b);
+    return mix(a ^ k_SECRET0 ^ d_totalLength, b ^ k_SECRET1);
+}
+
+}  // close package namespace
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,873 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm,
+// and to verify that the output does not depend on how the input is split
+// into calls.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT AND HASH TABLE LOOKUPS
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+Uint64 hashInPieces(const char  *data,
+                    size_t       numBytes,
+                    const char  *seed,
+                    const int   *pieceLengths,
+                    int          numPieceLengths)
+    // Return the hash of the specified 'numBytes' at the specified 'data',
+    // computed by an 'Obj' seeded with the specified 'seed', passing the
+    // input in pieces whose lengths cycle through the specified
+    // 'numPieceLengths' elements of the specified 'pieceLengths'.
+{
+    Obj    hashAlg(seed);
+    size_t position = 0;
+    for (int i = 0; position < numBytes; ++i) {
+        size_t length = pieceLengths[i % numPieceLengths];
+        if (length > numBytes - position) {
+            length = numBytes - position;
+        }
+        hashAlg(data + position, length);
+        position += length;
+    }
+    return hashAlg.computeHash();
+}
+
+template <class ALGORITHM>
+struct KeyHasher {
+    // This functor hashes keys of a fixed length with the (template
+    // parameter) 'ALGORITHM', seeded with a fixed seed.
+
+    // DATA
+    size_t d_keyLength;  // length of the keys
+
+    // ACCESSORS
+    size_t operator()(const char *key) const
+        // Return the hash of the key at the specified 'key'.
+    {
+        static const char k_SEED[16] = { 0 };
+
+        ALGORITHM hashAlg(k_SEED);
+        hashAlg(key, d_keyLength);
+        return static_cast<size_t>(hashAlg.computeHash());
+    }
+};
+
+template <class ALGORITHM>
+double measureThroughput(const char *keys, int numKeys, size_t keyLength)
+    // Return the time, in nanoseconds, that the (template parameter)
+    // 'ALGORITHM' takes to hash each of the specified 'numKeys' keys of the
+    // specified 'keyLength' bytes stored consecutively at the specified
+    // 'keys', averaged over the keys.
+{
+    enum { k_NUM_ROUNDS = 5 };
+
+    KeyHasher<ALGORITHM> hasher = { keyLength };
+    size_t               sum    = 0;
+    bsls::Stopwatch      timer;
+
+    timer.start();
+    for (int round = 0; round != k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i != numKeys; ++i) {
+            sum += hasher(keys + i * keyLength);
+        }
+    }
+    timer.stop();
+
+    if (0 == sum) {
+        printf("(all hashes are zero)\n");
+    }
+    return timer.accumulatedWallTime() * 1e9 / (k_NUM_ROUNDS * numKeys);
+}
+
+template <class ALGORITHM>
+double measureLookups(const char *keys, int numKeys, size_t keyLength)
+    // Return the time, in nanoseconds, taken to look up the specified
+    // 'numKeys' keys of the specified 'keyLength' bytes, stored consecutively
+    // at the specified 'keys', in a linear probing hash table holding half of
+    // them and hashing with the (template parameter) 'ALGORITHM', averaged
+    // over the lookups.  The behavior is undefined unless the keys are
+    // distinct.
+{
+    enum { k_NUM_ROUNDS = 5 };
+
+    KeyHasher<ALGORITHM> hasher = { keyLength };
+
+    size_t numBuckets = 1;
+    while (numBuckets < static_cast<size_t>(numKeys)) {
+        numBuckets *= 2;
+    }
+    const size_t mask = numBuckets - 1;
+
+    const char **buckets = static_cast<const char **>(
+                                    calloc(numBuckets, sizeof(const char *)));
+    for (int i = 0; i < numKeys; i += 2) {
+        const char *key    = keys + i * keyLength;
+        size_t      bucket = hasher(key) & mask;
+        while (buckets[bucket]) {
+            bucket = (bucket + 1) & mask;
+        }
+        buckets[bucket] = key;
+    }
+
+    int             numFound = 0;
+    bsls::Stopwatch timer;
+
+    timer.start();
+    for (int round = 0; round != k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i != numKeys; ++i) {
+            const char *key    = keys + i * keyLength;
+            size_t      bucket = hasher(key) & mask;
+            while (buckets[bucket]) {
+                if (0 == memcmp(buckets[bucket], key, keyLength)) {
+                    ++numFound;
+                    break;
+                }
+                bucket = (bucket + 1) & mask;
+            }
+        }
+    }
+    timer.stop();
+
+    ASSERTV(numFound, numKeys, numFound == k_NUM_ROUNDS * (numKeys / 2));
+
+    free(buckets);
+    return timer.accumulatedWallTime() * 1e9 / (k_NUM_ROUNDS * numKeys);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Strings Received in Pieces
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a table of the names of the instruments we trade,
+// which we receive in packets that may split a name in several pieces.  We
+// want to compute the hash of each name as its pieces arrive, so that we do
+// not have to copy the pieces into a contiguous buffer.
+//
+// First, we create a 'bslh::WyHashAlgorithm' object for the name being
+// received, and pass it each piece in turn:
+//..
+        const char *pieces[] = { "Canadian ", "Dollar ", "Futures" };
+
+        bslh::WyHashAlgorithm incrementalHash;
+        for (int i = 0; i < 3; ++i) {
+            incrementalHash(pieces[i], strlen(pieces[i]));
+        }
+//..
+// Then, we compute the hash of the whole name:
+//..
+        bslh::WyHashAlgorithm::result_type hash1 =
+                                                incrementalHash.computeHash();
+//..
+// Finally, we verify that the hash is the one that would have been computed,
+// had we received the name at once:
+//..
+        const char *name = "Canadian Dollar Futures";
+
+        bslh::WyHashAlgorithm wholeHash;
+        wholeHash(name, strlen(name));
+
+        ASSERT(wholeHash.computeHash() == hash1);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the
+        //:   'bslmf::IsBitwiseMoveable' metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslmf::IsBitwiseMoveable' metafunction."
+                            " (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  Obj::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void)expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by wyhash.  Verify that 'computeHash()' returns
+        //   the final value specified by the canonical wyhash implementation.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 The 'computeHash()' function is callable.
+        //:
+        //: 3 The output of calling 'operator()' and then 'computeHash()'
+        //:   matches the output of the canonical implementation, for inputs
+        //:   of lengths exercising each of its paths (up to 3 bytes, up to 16
+        //:   bytes, up to 48 bytes, and longer).
+        //:
+        //: 4 The output does not depend on how the input is split into calls
+        //:   to 'operator()', including calls with no input and calls whose
+        //:   input straddles the 48-byte blocks of the algorithm.
+        //:
+        //: 5 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 Hash the test vectors published with the canonical
+        //:   implementation, each with its own seed, and verify that the
+        //:   outputs match the published values.  (C-1..3)
+        //:
+        //: 2 For each length from 0 to 300 bytes, hash a pseudo-random input
+        //:   at once, then in pieces of a fixed length for each length from 0
+        //:   to 100 bytes, then in pieces of lengths following irregular
+        //:   cycles, and verify that the outputs match.  (C-4)
+        //:
+        //: 3 Call 'operator()' with a null pointer.  (C-5)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\nTESTING 'operator()' AND 'computeHash()'"
+                       "\n========================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_value_p;
+            Uint64      d_hash;
+        } DATA[] = {
+            // LINE  DATA (hashed with seed 'i' for the 'i'th value)
+            // ----  ----------------------------------------------------------
+            {  L_,   "",
+                                               0x93228a4de0eec5a2ULL        },
+            {  L_,   "a",
+                                               0xc5bac3db178713c4ULL        },
+            {  L_,   "abc",
+                                               0xa97f2f7b1d9b3314ULL        },
+            {  L_,   "message digest",
+                                               0x786d1f1df3801df4ULL        },
+            {  L_,   "abcdefghijklmnopqrstuvwxyz",
+                                               0xdca5a8138ad37c87ULL        },
+            {  L_,   "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                     "0123456789",
+                                               0xb9e734f117cfaf70ULL        },
+            {  L_,   "1234567890123456789012345678901234567890"
+                     "1234567890123456789012345678901234567890",
+                                               0x6cc5eab49a92d617ULL        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("Hash the test vectors published with the"
+                            " canonical implementation. (C-1..3)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value_p;
+                const char  SEED[Obj::k_SEED_LENGTH] = {
+                                                    static_cast<char>(i) };
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj hashAlg(SEED);
+                hashAlg(VALUE, strlen(VALUE));
+
+                LOOP_ASSERT(LINE, DATA[i].d_hash == hashAlg.computeHash());
+            }
+
+            Obj hashAlg;
+            ASSERT(DATA[0].d_hash == hashAlg.computeHash());
+        }
+
+        if (verbose) printf("Hash inputs of each length in various pieces."
+                            " (C-4)\n");
+        {
+            enum { k_MAX_LENGTH = 300 };
+
+            char         input[k_MAX_LENGTH];
+            unsigned int random = 1;
+            for (int i = 0; i != k_MAX_LENGTH; ++i) {
+                random   = random * 1103515245 + 12345;
+                input[i] = static_cast<char>(random >> 16);
+            }
+
+            const char SEED[Obj::k_SEED_LENGTH] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+            static const int CYCLES[][5] = {
+                {  0,  1, 47,  0, 49 },
+                { 48,  0, 48, 48,  1 },
+                {  3, 61,  5, 16, 17 },
+                { 95,  2, 33,  0, 96 },
+            };
+            const int NUM_CYCLES = sizeof CYCLES / sizeof *CYCLES;
+
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                if (veryVerbose) { P(length) }
+
+                Obj hashAlg(SEED);
+                hashAlg(input, length);
+                const Uint64 EXPECTED = hashAlg.computeHash();
+
+                for (int piece = 1; piece <= 100; ++piece) {
+                    const Uint64 HASH = hashInPieces(input,
+                                                     length,
+                                                     SEED,
+                                                     &piece,
+                                                     1);
+                    LOOP2_ASSERT(length, piece, EXPECTED == HASH);
+                }
+
+                for (int i = 0; i != NUM_CYCLES; ++i) {
+                    const Uint64 HASH = hashInPieces(input,
+                                                     length,
+                                                     SEED,
+                                                     CYCLES[i],
+                                                     5);
+                    LOOP2_ASSERT(length, i, EXPECTED == HASH);
+                }
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj()(   0, 5));
+            ASSERT_PASS(Obj()(   0, 0));
+            ASSERT_PASS(Obj()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //   Verify that the algorithm can be instantiated with or without a
+        //   seed, and that each bit of the seed affects the hash.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 The default constructor uses a zero seed.
+        //:
+        //: 5 Each bit of the seed contributes to the hash.
+        //:
+        //: 6 The parameterized constructor asserts on a null seed.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'WyHashAlgorithm' and allow it to
+        //:   leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor with a zero seed, and verify
+        //:   that the hash of some input matches that of a default
+        //:   constructed object. (C-2,4)
+        //:
+        //: 3 For each bit of the seed, hash the same input with a seed having
+        //:   only that bit set, and verify that the hashes are distinct.
+        //:   (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null seed.  (C-6)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Create a default constructed"
+                            " 'WyHashAlgorithm' and allow it to leave"
+                            " scope to be destroyed. (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a zero"
+                            " seed. (C-2,4)\n");
+        {
+            const char  SEED[Obj::k_SEED_LENGTH] = { 0 };
+            const char *DATA = "Hello World";
+
+            Obj alg1(SEED);
+            Obj alg2;
+            alg1(DATA, strlen(DATA));
+            alg2(DATA, strlen(DATA));
+            ASSERT(alg1.computeHash() == alg2.computeHash());
+        }
+
+        if (verbose) printf("Hash the same input with each one-bit seed."
+                            " (C-5)\n");
+        {
+            const char *DATA = "Hello World";
+            Uint64      hashes[Obj::k_SEED_LENGTH * 8 + 1];
+
+            for (int bit = 0; bit <= Obj::k_SEED_LENGTH * 8; ++bit) {
+                char seed[Obj::k_SEED_LENGTH] = { 0 };
+                if (bit < Obj::k_SEED_LENGTH * 8) {
+                    seed[bit / 8] = static_cast<char>(1 << bit % 8);
+                }
+
+                Obj alg(seed);
+                alg(DATA, strlen(DATA));
+                hashes[bit] = alg.computeHash();
+
+                for (int i = 0; i < bit; ++i) {
+                    LOOP2_ASSERT(i, bit, hashes[i] != hashes[bit]);
+                }
+            }
+        }
+
+        if (verbose) printf("Verify that defensive checks are triggered for a"
+                            " null seed. (C-6)\n");
+        {
+            const char SEED[Obj::k_SEED_LENGTH] = { 0 };
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(SEED));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bsl::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bsl::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different 'int's.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " 'int's.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT AND HASH TABLE LOOKUPS
+        //
+        // Concerns:
+        //: 1 Report the time taken to hash keys of various lengths with
+        //:   'WyHashAlgorithm', 'SpookyHashAlgorithm', and 'SipHashAlgorithm'.
+        //:
+        //: 2 Report the time taken to look up keys of various lengths in a
+        //:   hash table using each of these algorithms.
+        //
+        // Plan:
+        //: 1 For key lengths from 4 to 1024 bytes, hash a million
+        //:   pseudo-random keys (stored consecutively) with each algorithm,
+        //:   and print the average time per key and the throughput.  (C-1)
+        //:
+        //: 2 For key lengths up to 64 bytes, insert half of the keys into a
+        //:   linear probing hash table, look all of them up, and print the
+        //:   average time per lookup.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT AND HASH TABLE LOOKUPS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST: THROUGHPUT AND HASH TABLE"
+                            " LOOKUPS"
+                            "\n==========================================="
+                            "========\n");
+
+        enum { k_MAX_BYTES = 64 * 1024 * 1024 };
+
+        char         *keys   = static_cast<char *>(malloc(k_MAX_BYTES));
+        unsigned int  random = 1;
+        for (int i = 0; i != k_MAX_BYTES; ++i) {
+            random  = random * 1103515245 + 12345;
+            keys[i] = static_cast<char>(random >> 16);
+        }
+
+        static const size_t LENGTHS[] = { 4, 8, 16, 32, 64, 256, 1024 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        printf("Hashing (ns per key, GB/s):\n"
+               "%6s %18s %18s %18s\n",
+               "bytes", "WyHash", "SpookyHash", "SipHash");
+        for (int i = 0; i != NUM_LENGTHS; ++i) {
+            const size_t LENGTH  = LENGTHS[i];
+            int          numKeys = static_cast<int>(k_MAX_BYTES / LENGTH);
+            if (numKeys > 1000 * 1000) {
+                numKeys = 1000 * 1000;
+            }
+
+            const double WY     = measureThroughput<WyHashAlgorithm>(
+                                                     keys, numKeys, LENGTH);
+            const double SPOOKY = measureThroughput<SpookyHashAlgorithm>(
+                                                     keys, numKeys, LENGTH);
+            const double SIP    = measureThroughput<SipHashAlgorithm>(
+                                                     keys, numKeys, LENGTH);
+
+            printf("%6d %8.2f %8.2f  %8.2f %8.2f  %8.2f %8.2f\n",
+                   static_cast<int>(LENGTH),
+                   WY,     LENGTH / WY,
+                   SPOOKY, LENGTH / SPOOKY,
+                   SIP,    LENGTH / SIP);
+        }
+
+        printf("Hash table lookups (ns per lookup):\n"
+               "%6s %9s %9s %9s\n",
+               "bytes", "WyHash", "Spooky", "SipHash");
+        for (int i = 0; i != NUM_LENGTHS && LENGTHS[i] <= 64; ++i) {
+            const size_t LENGTH  = LENGTHS[i];
+            const int    numKeys = 1 << 20;
+
+            // Keys of 4 bytes are drawn at random from a space of 2^32 keys,
+            // so make them distinct: the table needs them to be.
+
+            if (4 == LENGTH) {
+                for (int k = 0; k != numKeys; ++k) {
+                    memcpy(keys + 4 * k, &k, 4);
+                }
+            }
+
+            printf("%6d %9.2f %9.2f %9.2f\n",
+                   static_cast<int>(LENGTH),
+                   measureLookups<WyHashAlgorithm>(keys, numKeys, LENGTH),
+                   measureLookups<SpookyHashAlgorithm>(keys, numKeys, LENGTH),
+                   measureLookups<SipHashAlgorithm>(keys, numKeys, LENGTH));
+        }
+
+        free(keys);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
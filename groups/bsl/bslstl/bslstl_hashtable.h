@@ -2885,6 +2885,15 @@ class HashTable {
         // 'index'.  Note that this operation has linear run-time complexity
         // with respect to the number of elements in the indexed bucket.
 
+    SizeType countElementsInLargestBucket() const;
+        // Return the number of elements contained in the bucket of this hash
+        // table holding the most elements, i.e., the length of the longest
+        // chain of elements that a lookup may have to traverse, or 0 if this
+        // hash table is empty.  Note that this operation has linear run-time
+        // complexity with respect to 'size() + numBuckets()'.  Also note that
+        // this statistic can be used to detect a poor distribution of hash
+        // values, e.g., one caused by keys chosen to collide.
+
     bslalg::BidirectionalLink *elementListRoot() const;
         // Return the address of the first element in this hash table, or a
         // null pointer value if this hash table is empty.
@@ -6969,6 +6978,25 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::countElementsInBucket(
     return static_cast<SizeType>(bucketAtIndex(index).countElements());
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                           countElementsInLargestBucket() const
+{
+    SizeType result = 0;
+
+    const SizeType numBuckets = this->numBuckets();
+    for (SizeType i = 0; i != numBuckets; ++i) {
+        const SizeType count =
+                       static_cast<SizeType>(bucketAtIndex(i).countElements());
+        if (count > result) {
+            result = count;
+        }
+    }
+
+    return result;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 bslalg::BidirectionalLink *
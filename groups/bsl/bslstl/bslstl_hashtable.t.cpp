@@ -189,6 +189,7 @@ using bslstl::CallableVariable;
 // [ 4] bucketAtIndex(SizeType index) const;
 // [ 4] bucketIndexForKey(const KeyType& key) const;
 // [ 4] countElementsInBucket(SizeType index) const;
+// [ 4] countElementsInLargestBucket() const;
 //
 // [ 6] bool operator==(const HashTable& lhs, const HashTable& rhs);
 // [ 6] bool operator!=(const HashTable& lhs, const HashTable& rhs);
@@ -6471,6 +6472,7 @@ void TestDriver<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::testCase4()
     //   bucketAtIndex(SizeType index) const;
     //   bucketIndexForKey(const KeyType& key) const;
     //   countElementsInBucket(SizeType index) const;
+    //   countElementsInLargestBucket() const;
     // ------------------------------------------------------------------------
 
     typedef typename KEY_CONFIG::ValueType Element;
@@ -6638,11 +6640,15 @@ void TestDriver<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::testCase4()
                             NUM_BUCKETS <= bucketCount);
 
                     SizeType elementCount = 0;
+                    SizeType largestBucketSize = 0;
                     for (SizeType iBkt = 0; iBkt != bucketCount; ++iBkt) {
                         const bslalg::HashTableBucket& bucket =
                                                          X.bucketAtIndex(iBkt);
                         bslalg::BidirectionalLink *bucketRoot = bucket.first();
                         SizeType bucketSize = X.countElementsInBucket(iBkt);
+                        if (bucketSize > largestBucketSize) {
+                            largestBucketSize = bucketSize;
+                        }
                         if (!bucketSize) {
                             ASSERTV(bucketSize, bucketRoot, 0 == bucketRoot);
                         }
@@ -6658,6 +6664,10 @@ void TestDriver<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::testCase4()
                         }
                     }
                     ASSERTV(X.size(), elementCount, X.size() == elementCount);
+                    ASSERTV(largestBucketSize,
+                            X.countElementsInLargestBucket(),
+                            largestBucketSize ==
+                                            X.countElementsInLargestBucket());
 
                     ASSERT(oam.isTotalSame());
 
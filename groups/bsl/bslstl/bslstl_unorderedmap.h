@@ -1733,6 +1733,17 @@ class unordered_map {
         // unordered map.  The behavior is undefined unless
         // 'index < bucket_count()'.
 
+    size_type countElementsInLargestBucket() const;
+        // Return the number of elements contained in the bucket holding the
+        // most elements in the array of buckets maintained by this unordered
+        // map, i.e., the length of the longest chain of elements that a lookup
+        // may have to traverse, or 0 if this unordered map is empty.  Note
+        // that this operation has linear run-time complexity with respect to
+        // 'size() + bucket_count()'.  Also note that this statistic can be
+        // used to detect a poor distribution of hash values, e.g., one caused
+        // by keys chosen to collide.  Finally note that this method is a BDE
+        // extension and not part of the C++ standard interface.
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects contained within this
         // unordered map having the specified 'key'.  Note that since an
@@ -2713,6 +2724,15 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::bucket_size(
     return d_impl.countElementsInBucket(index);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+                                           countElementsInLargestBucket() const
+{
+    return d_impl.countElementsInLargestBucket();
+}
+
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
@@ -198,6 +198,7 @@ using bsl::pair;
 // [14] size_t bucket(const KEY&) const;
 // [14] size_t bucket_count() const;
 // [14] size_t bucket_size(size_t) const;
+// [ 1] size_t countElementsInLargestBucket() const;
 //
 // container comparisons:
 // [ 6] bool operator==(const Obj&, const Obj&);
@@ -10045,6 +10046,7 @@ void testBuckets(CONTAINER& mX)
     //: 5 adding elements from all buckets should exactly equal 'size'
     //: 6 large buckets imply many hash collisions, which is undesirable
     //: 7 large buckets may be consequence of multicontainers
+    //: 8 'countElementsInLargestBucket' is the largest 'bucket_size'
 
     typedef typename            CONTAINER::size_type             SizeType;
     typedef typename       CONTAINER::local_iterator       local_iterator;
@@ -10055,6 +10057,7 @@ void testBuckets(CONTAINER& mX)
     SizeType bucketCount = x.bucket_count();
     SizeType collisions = 0;
     SizeType itemCount  = 0;
+    SizeType largestCount = 0;
 
     for (SizeType i = 0; i != bucketCount; ++i ) {
         const SizeType count = x.bucket_size(i);
@@ -10069,6 +10072,9 @@ void testBuckets(CONTAINER& mX)
         }
 
         itemCount += count;
+        if (count > largestCount) {
+            largestCount = count;
+        }
         collisions += count-1;
         SizeType bucketItems = 0;
         for (const_local_iterator iter = x.begin(i); iter != x.end(i); ++iter)
@@ -10097,6 +10103,9 @@ void testBuckets(CONTAINER& mX)
 
     }
     ASSERT(itemCount == x.size());
+    ASSERTV(largestCount,
+            x.countElementsInLargestBucket(),
+            largestCount == x.countElementsInLargestBucket());
 }
 
 
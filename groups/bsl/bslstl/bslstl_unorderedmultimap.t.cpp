@@ -165,6 +165,7 @@ using bsls::NameOf;
 // [ 4] size_type bucket_count() const;
 // [ 4] size_type max_bucket_count() const;
 // [ 4] size_type bucket_size(size_type n) const;
+// [ 1] size_type countElementsInLargestBucket() const;
 // [ 4] size_type bucket(const key_type& k) const;
 //
 // bucket iterators:
@@ -5432,6 +5433,7 @@ void testBuckets(CONTAINER& mX)
     // adding elements from all buckets should exactly equal 'size'
     // large buckets imply many hash collisions, which is undesirable
     //    large buckets may be consequence of multicontainers
+    // 'countElementsInLargestBucket' is the largest 'bucket_size'
     typedef typename       CONTAINER::local_iterator       local_iterator;
     typedef typename CONTAINER::const_local_iterator const_local_iterator;
 
@@ -5441,6 +5443,7 @@ void testBuckets(CONTAINER& mX)
     size_t bucketCount = x.bucket_count();
     size_t collisions = 0;
     size_t itemCount  = 0;
+    size_t largestCount = 0;
 
     for (size_t i = 0; i != bucketCount; ++i ) {
         const size_t count = x.bucket_size(i);
@@ -5455,6 +5458,9 @@ void testBuckets(CONTAINER& mX)
         }
 
         itemCount += count;
+        if (count > largestCount) {
+            largestCount = count;
+        }
         collisions += count-1;
         unsigned int bucketItems = 0;
         for (const_local_iterator iter = x.begin(i); iter != x.end(i); ++iter)
@@ -5483,6 +5489,9 @@ void testBuckets(CONTAINER& mX)
 
     }
     ASSERT(itemCount == x.size());
+    ASSERTV(largestCount,
+            x.countElementsInLargestBucket(),
+            largestCount == x.countElementsInLargestBucket());
 }
 
 
@@ -1591,6 +1591,17 @@ class unordered_multiset
         // container.  The behavior is undefined unless 'index <
         // bucket_count()'.
 
+    size_type countElementsInLargestBucket() const;
+        // Return the number of elements contained in the bucket holding the
+        // most elements in the array of buckets maintained by this container,
+        // i.e., the length of the longest chain of elements that a lookup may
+        // have to traverse, or 0 if this container is empty.  Note that this
+        // operation has linear run-time complexity with respect to
+        // 'size() + bucket_count()'.  Also note that this statistic can be
+        // used to detect a poor distribution of hash values, e.g., one caused
+        // by keys chosen to collide.  Finally note that this method is a BDE
+        // extension and not part of the C++ standard interface.
+
 
     float load_factor() const BSLS_KEYWORD_NOEXCEPT;
         // Return the current ratio between the 'size' of this container and
@@ -2840,6 +2851,15 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::bucket_size(
     return d_impl.countElementsInBucket(index);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::
+                                           countElementsInLargestBucket() const
+{
+    return d_impl.countElementsInLargestBucket();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::size_type
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::count(
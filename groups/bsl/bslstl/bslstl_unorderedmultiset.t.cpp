@@ -170,6 +170,7 @@ using bsls::NameOf;
 // [ 4] size_type bucket_count() const;
 // [ 4] size_type max_bucket_count() const;
 // [ 4] size_type bucket_size(size_type n) const;
+// [ 1] size_type countElementsInLargestBucket() const;
 // [ 4] size_type bucket(const key_type& k) const;
 //
 // bucket iterators:
@@ -661,6 +662,7 @@ void testBuckets(CONTAINER& mX)
     // adding elements from all buckets should exactly equal 'size'
     // large buckets imply many hash collisions, which is undesirable
     //    large buckets may be consequence of multicontainers
+    // 'countElementsInLargestBucket' is the largest 'bucket_size'
     typedef typename CONTAINER::size_type            SizeType;
     typedef typename CONTAINER::local_iterator       local_iterator;
     typedef typename CONTAINER::const_local_iterator const_local_iterator;
@@ -670,6 +672,7 @@ void testBuckets(CONTAINER& mX)
     SizeType bucketCount = x.bucket_count();
     SizeType collisions = 0;
     SizeType itemCount  = 0;
+    SizeType largestCount = 0;
 
     for (unsigned i = 0; i != bucketCount; ++i ) {
         const SizeType count = x.bucket_size(i);
@@ -684,6 +687,9 @@ void testBuckets(CONTAINER& mX)
         }
 
         itemCount += count;
+        if (count > largestCount) {
+            largestCount = count;
+        }
         collisions += count-1;
         SizeType bucketItems = 0;
         for (const_local_iterator iter = x.begin(i); iter != x.end(i); ++iter)
@@ -712,6 +718,9 @@ void testBuckets(CONTAINER& mX)
 
     }
     ASSERTV(itemCount, x.size(), itemCount == x.size());
+    ASSERTV(largestCount,
+            x.countElementsInLargestBucket(),
+            largestCount == x.countElementsInLargestBucket());
 }
 
 
@@ -1508,6 +1508,17 @@ class unordered_set {
         // specified 'index' in the array of buckets maintained by this
         // container.
 
+    size_type countElementsInLargestBucket() const;
+        // Return the number of elements contained in the bucket holding the
+        // most elements in the array of buckets maintained by this container,
+        // i.e., the length of the longest chain of elements that a lookup may
+        // have to traverse, or 0 if this container is empty.  Note that this
+        // operation has linear run-time complexity with respect to
+        // 'size() + bucket_count()'.  Also note that this statistic can be
+        // used to detect a poor distribution of hash values, e.g., one caused
+        // by keys chosen to collide.  Finally note that this method is a BDE
+        // extension and not part of the C++ standard interface.
+
     size_type bucket(const key_type& key) const;
         // Return the index of the bucket, in the array of buckets of this
         // container, where a value equivalent to the specified 'key' would be
@@ -2921,6 +2932,15 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::bucket_size(size_type index) const
     return d_impl.countElementsInBucket(index);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::
+                                           countElementsInLargestBucket() const
+{
+    return d_impl.countElementsInLargestBucket();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
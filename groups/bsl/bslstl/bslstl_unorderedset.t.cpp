@@ -173,6 +173,7 @@ using bsls::NameOf;
 //*[26] size_type bucket_count() const;
 //*[26] size_type max_bucket_count() const;    <<NOT WORKING>>
 //*[26] size_type bucket_size(size_type n) const;
+// [ 1] size_type countElementsInLargestBucket() const;
 //*[26] size_type bucket(const key_type& k) const;
 //
 // bucket iterators:
@@ -576,6 +577,7 @@ void testBuckets(CONTAINER& mX)
     // adding elements from all buckets should exactly equal 'size'
     // large buckets imply many hash collisions, which is undesirable
     //    large buckets may be consequence of multicontainers
+    // 'countElementsInLargestBucket' is the largest 'bucket_size'
     typedef typename CONTAINER::size_type            SizeType;
     typedef typename CONTAINER::local_iterator       local_iterator;
     typedef typename CONTAINER::const_local_iterator const_local_iterator;
@@ -586,6 +588,7 @@ void testBuckets(CONTAINER& mX)
     SizeType bucketCount = x.bucket_count();
 //    SizeType collisions = 0;
     SizeType itemCount  = 0;
+    SizeType largestCount = 0;
 
     for (SizeType i = 0; i != bucketCount; ++i ) {
         const SizeType count = x.bucket_size(i);
@@ -602,6 +605,9 @@ void testBuckets(CONTAINER& mX)
         }
 
         itemCount += count;
+        if (count > largestCount) {
+            largestCount = count;
+        }
         //collisions += count-1;
         SizeType bucketItems = 0;
         for (const_local_iterator iter = x.begin(i); iter != x.end(i); ++iter)
@@ -630,6 +636,9 @@ void testBuckets(CONTAINER& mX)
 
     }
     LOOP2_ASSERT(itemCount, x.size(), itemCount == x.size());
+    LOOP2_ASSERT(largestCount,
+                 x.countElementsInLargestBucket(),
+                 largestCount == x.countElementsInLargestBucket());
 }
 
 
@@ -47,4 +47,10 @@ function(bdeproj_project_process_uors proj listDir)
         ${listDir}/thirdparty/pcre2
         ${listDir}/standalones/s_baltst
     )
+
+    bde_project_process_applications(
+        ${proj}
+        ${listDir}/applications/m_balcodecbenchmark
+        ${listDir}/applications/m_ballmappedfiledecoder
+    )
 endfunction()
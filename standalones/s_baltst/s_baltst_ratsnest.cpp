@@ -23,6 +23,7 @@ BSLS_IDENT_RCSID(s_baltst_ratsnest_cpp,"$Id$ $CSID$")
 #include <s_baltst_voidsequence.h>
 
 #include <bdlat_formattingmode.h>
+#include <bdlat_namelookuputil.h>
 #include <bdlat_valuetypefunctions.h>
 #include <bdlb_nullableallocatedvalue.h>
 #include <bdlb_nullablevalue.h>
@@ -2365,24 +2366,39 @@ const bdlat_AttributeInfo Sequence4::ATTRIBUTE_INFO_ARRAY[] = {
     }
 };
 
+namespace {
+
+const unsigned short SEQUENCE4_ATTRIBUTE_LOOKUP_DISPLACEMENTS[] = {
+    1, 0, 1, 0, 6, 1, 0, 0, 2, 0, 0, 5,
+    0, 0, 2, 5
+};
+
+const unsigned short SEQUENCE4_ATTRIBUTE_LOOKUP_SLOTS[] = {
+    0, 11, 0, 13, 16, 2, 1, 7, 10, 5, 8, 6,
+    19, 15, 0, 0, 14, 0, 4, 18, 0, 12, 3, 0,
+    17, 9, 0, 0, 0, 0, 0, 0
+};
+
+const bdlat_NameLookupTable SEQUENCE4_ATTRIBUTE_LOOKUP_TABLE = {
+    0,
+    16,
+    32,
+    SEQUENCE4_ATTRIBUTE_LOOKUP_DISPLACEMENTS,
+    SEQUENCE4_ATTRIBUTE_LOOKUP_SLOTS
+};
+
+}  // close unnamed namespace
+
 // CLASS METHODS
 
 const bdlat_AttributeInfo *Sequence4::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 19; ++i) {
-        const bdlat_AttributeInfo& attributeInfo =
-                    Sequence4::ATTRIBUTE_INFO_ARRAY[i];
-
-        if (nameLength == attributeInfo.d_nameLength
-        &&  0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength))
-        {
-            return &attributeInfo;
-        }
-    }
-
-    return 0;
+    return bdlat_NameLookupUtil::lookup(SEQUENCE4_ATTRIBUTE_LOOKUP_TABLE,
+                                        Sequence4::ATTRIBUTE_INFO_ARRAY,
+                                        name,
+                                        nameLength);
 }
 
 const bdlat_AttributeInfo *Sequence4::lookupAttributeInfo(int id)
@@ -3037,24 +3053,37 @@ const bdlat_AttributeInfo Sequence6::ATTRIBUTE_INFO_ARRAY[] = {
     }
 };
 
+namespace {
+
+const unsigned short SEQUENCE6_ATTRIBUTE_LOOKUP_DISPLACEMENTS[] = {
+    1, 2, 6, 0, 5, 1, 2, 9
+};
+
+const unsigned short SEQUENCE6_ATTRIBUTE_LOOKUP_SLOTS[] = {
+    13, 12, 15, 3, 6, 9, 10, 4, 5, 7, 0, 2,
+    8, 14, 1, 11
+};
+
+const bdlat_NameLookupTable SEQUENCE6_ATTRIBUTE_LOOKUP_TABLE = {
+    1,
+    8,
+    16,
+    SEQUENCE6_ATTRIBUTE_LOOKUP_DISPLACEMENTS,
+    SEQUENCE6_ATTRIBUTE_LOOKUP_SLOTS
+};
+
+}  // close unnamed namespace
+
 // CLASS METHODS
 
 const bdlat_AttributeInfo *Sequence6::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 15; ++i) {
-        const bdlat_AttributeInfo& attributeInfo =
-                    Sequence6::ATTRIBUTE_INFO_ARRAY[i];
-
-        if (nameLength == attributeInfo.d_nameLength
-        &&  0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength))
-        {
-            return &attributeInfo;
-        }
-    }
-
-    return 0;
+    return bdlat_NameLookupUtil::lookup(SEQUENCE6_ATTRIBUTE_LOOKUP_TABLE,
+                                        Sequence6::ATTRIBUTE_INFO_ARRAY,
+                                        name,
+                                        nameLength);
 }
 
 const bdlat_AttributeInfo *Sequence6::lookupAttributeInfo(int id)
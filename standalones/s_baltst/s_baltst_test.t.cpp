@@ -43,7 +43,12 @@
 
 #include <bslim_testutil.h>
 
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_string.h>
 
 using namespace BloombergLP;
 using bsl::cout;
@@ -95,6 +100,117 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+template <class INFO_TYPE>
+const INFO_TYPE *linearLookup(const INFO_TYPE *infoArray,
+                              int              numInfos,
+                              const char      *name,
+                              int              nameLength)
+    // Return the address of the element of the specified 'infoArray' of the
+    // specified 'numInfos' elements whose name is the specified 'name' of the
+    // specified 'nameLength', or 0 if there is no such element, by comparing
+    // 'name' with each element in turn, as generated code did before opting
+    // into 'bdlat_NameLookupUtil'.
+{
+    for (int i = 0; i < numInfos; ++i) {
+        const INFO_TYPE& info = infoArray[i];
+
+        if (nameLength == info.d_nameLength
+        &&  0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class INFO_TYPE>
+void testLookup(int               line,
+                const INFO_TYPE *(*lookup)(const char *, int),
+                const INFO_TYPE  *infoArray,
+                int               numInfos)
+    // Verify that the specified 'lookup' function, originating at the
+    // specified 'line', finds each element of the specified 'infoArray' of
+    // the specified 'numInfos' elements by its name, and that it agrees with
+    // 'linearLookup' for truncated, extended, and altered names.
+{
+    for (int i = 0; i < numInfos; ++i) {
+        const INFO_TYPE&  INFO = infoArray[i];
+        const char       *NAME = INFO.d_name_p;
+        const int         LEN  = INFO.d_nameLength;
+
+        ASSERTV(line, NAME, &INFO == lookup(NAME, LEN));
+
+        bsl::string name(NAME, LEN);
+        ASSERTV(line, NAME,
+                linearLookup(infoArray, numInfos, name.c_str(), LEN - 1) ==
+                                                lookup(name.c_str(), LEN - 1));
+
+        name.push_back('x');
+        ASSERTV(line, NAME, 0 == lookup(name.c_str(), LEN + 1));
+
+        name.resize(LEN);
+        name[LEN - 1] = static_cast<char>(name[LEN - 1] ^ 0x20);
+        ASSERTV(line, NAME, 0 == lookup(name.c_str(), LEN));
+    }
+
+    ASSERTV(line, 0 == lookup("", 0));
+}
+
+template <class INFO_TYPE>
+void benchmarkLookup(const char       *typeName,
+                     const INFO_TYPE *(*lookup)(const char *, int),
+                     const INFO_TYPE  *infoArray,
+                     int               numInfos,
+                     int               numLookups)
+    // Look up the names of the specified 'infoArray' of the specified
+    // 'numInfos' elements in turn, the specified 'numLookups' times in all,
+    // first with 'linearLookup' and then with the specified 'lookup'
+    // function, and print the time per lookup of each method, labeled with
+    // the specified 'typeName', to 'cout'.
+{
+    const INFO_TYPE *found[2] = { 0, 0 };
+    double           times[2];
+
+    for (int method = 0; method < 2; ++method) {
+        int next = 0;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numLookups; ++i) {
+            const INFO_TYPE& INFO = infoArray[next];
+
+            if (++next == numInfos) {
+                next = 0;
+            }
+
+            found[method] = 0 == method
+                          ? linearLookup(infoArray,
+                                         numInfos,
+                                         INFO.d_name_p,
+                                         INFO.d_nameLength)
+                          : lookup(INFO.d_name_p, INFO.d_nameLength);
+        }
+        timer.stop();
+        times[method] = timer.accumulatedWallTime();
+    }
+    ASSERTV(typeName, found[0] == found[1]);
+
+    cout << typeName << " (" << numInfos << " names): "
+         << times[0] * 1e9 / numLookups << " ns per linear search, "
+         << times[1] * 1e9 / numLookups << " ns per generated lookup"
+         << endl;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
 int main(int argc, char **argv)
 {
     int test = argc > 1 ? atoi(argv[1]) : 0;
@@ -104,6 +220,80 @@ int main(int argc, char **argv)
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // NAME LOOKUP
+        //
+        // Concern:
+        //: 1 The generated functions that look up attributes, selections, and
+        //:   enumerators by name find each of them, whether they search the
+        //:   info array or use a 'bdlat_NameLookupUtil' table.
+        //:
+        //: 2 Names that differ from every info name, however slightly, are
+        //:   not found, and lookups agree with a linear search of the info
+        //:   array.
+        //
+        // Plan:
+        //: 1 For types that opted into 'bdlat_NameLookupUtil', and for some
+        //:   that did not, look up every name in the info array, and verify
+        //:   that the corresponding info is returned.  (C-1)
+        //:
+        //: 2 Look up each name truncated, extended, and with its last
+        //:   character altered, and verify that the result is that of a
+        //:   linear search (nothing, unless the truncated name is another
+        //:   name).  (C-2)
+        //:
+        //: 3 Convert each enumerator name of 's_baltst::Enumerated' with
+        //:   'fromString', and verify the result; verify that altered names
+        //:   fail to convert and leave the result unchanged.  (C-1..2)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "NAME LOOKUP\n"
+                             "===========\n";
+
+        u::testLookup(L_,
+                      &s_baltst::Sequence4::lookupAttributeInfo,
+                      s_baltst::Sequence4::ATTRIBUTE_INFO_ARRAY,
+                      s_baltst::Sequence4::NUM_ATTRIBUTES);
+        u::testLookup(L_,
+                      &s_baltst::Sequence6::lookupAttributeInfo,
+                      s_baltst::Sequence6::ATTRIBUTE_INFO_ARRAY,
+                      s_baltst::Sequence6::NUM_ATTRIBUTES);
+        u::testLookup(L_,
+                      &s_baltst::FeatureTestMessage::lookupSelectionInfo,
+                      s_baltst::FeatureTestMessage::SELECTION_INFO_ARRAY,
+                      s_baltst::FeatureTestMessage::NUM_SELECTIONS);
+        u::testLookup(L_,
+                      &s_baltst::Sequence5::lookupAttributeInfo,
+                      s_baltst::Sequence5::ATTRIBUTE_INFO_ARRAY,
+                      s_baltst::Sequence5::NUM_ATTRIBUTES);
+        u::testLookup(L_,
+                      &s_baltst::Choice1::lookupSelectionInfo,
+                      s_baltst::Choice1::SELECTION_INFO_ARRAY,
+                      s_baltst::Choice1::NUM_SELECTIONS);
+
+        typedef s_baltst::Enumerated Enum;
+
+        for (int i = 0; i < Enum::NUM_ENUMERATORS; ++i) {
+            const bdlat_EnumeratorInfo&  INFO = Enum::ENUMERATOR_INFO_ARRAY[i];
+            const char                  *NAME = INFO.d_name_p;
+            const int                    LEN  = INFO.d_nameLength;
+
+            Enum::Value value = Enum::NEW_YORK;
+            ASSERTV(NAME, 0 == Enum::fromString(&value, NAME, LEN));
+            ASSERTV(NAME, INFO.d_value == value);
+
+            const Enum::Value ORIGINAL = value;
+
+            ASSERTV(NAME, 0 != Enum::fromString(&value, NAME, LEN - 1));
+            ASSERTV(NAME, ORIGINAL == value);
+
+            bsl::string name(NAME, LEN);
+            name[0] = static_cast<char>(name[0] ^ 0x20);
+            ASSERTV(NAME, 0 != Enum::fromString(&value, name.c_str(), LEN));
+            ASSERTV(NAME, ORIGINAL == value);
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST
@@ -392,6 +582,41 @@ int main(int argc, char **argv)
             ASSERTV(a, b, !(a != b));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: NAME LOOKUP
+        //
+        // Concern:
+        //: 1 Looking up names through a 'bdlat_NameLookupUtil' table is
+        //:   faster than comparing them with each info name in turn.
+        //
+        // Plan:
+        //: 1 For each type that opted into 'bdlat_NameLookupUtil', look up
+        //:   all of its names repeatedly, both with the generated function
+        //:   and with a linear search of its info array, and report the time
+        //:   per lookup.  The optional second argument gives the number of
+        //:   lookups (10000000 by default).
+        //
+        // Testing:
+        //   BENCHMARK: NAME LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BENCHMARK: NAME LOOKUP\n"
+                             "======================\n";
+
+        const int NUM_LOOKUPS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+
+        u::benchmarkLookup("Sequence4",
+                           &s_baltst::Sequence4::lookupAttributeInfo,
+                           s_baltst::Sequence4::ATTRIBUTE_INFO_ARRAY,
+                           s_baltst::Sequence4::NUM_ATTRIBUTES,
+                           NUM_LOOKUPS);
+        u::benchmarkLookup("Sequence6",
+                           &s_baltst::Sequence6::lookupAttributeInfo,
+                           s_baltst::Sequence6::ATTRIBUTE_INFO_ARRAY,
+                           s_baltst::Sequence6::NUM_ATTRIBUTES,
+                           NUM_LOOKUPS);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;